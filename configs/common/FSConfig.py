@@ -742,12 +742,40 @@ def makeBareMetalRiscvSystem(mem_mode, mdesc=None, cmdline=None):
     return self
 
 
-def makeDualRoot(full_system, testSystem, driveSystem, dumpfile):
+def makeDualRoot(
+    full_system,
+    testSystem,
+    driveSystem,
+    dumpfile,
+    drive_eventq_index=None,
+    link_delay=None,
+):
+    """Connect two systems with an ethernet link.
+
+    When drive_eventq_index is given, the drive system is simulated on
+    that event queue, in parallel with the test system. The link delay,
+    which is required then, is the lookahead between the two systems and
+    becomes the simulation quantum.
+    """
     self = Root(full_system=full_system)
     self.testsys = testSystem
     self.drivesys = driveSystem
     self.etherlink = EtherLink()
 
+    if link_delay is not None:
+        self.etherlink.delay = link_delay
+
+    if drive_eventq_index is not None:
+        if link_delay is None:
+            fatal("Parallel systems need the delay of the link between them")
+        driveSystem.eventq_index = drive_eventq_index
+        self.etherlink.int0_eventq_index = 0
+        self.etherlink.int1_eventq_index = drive_eventq_index
+        m5.ticks.fixGlobalFrequency()
+        self.sim_quantum = m5.ticks.fromSeconds(
+            m5.util.convert.toLatency(link_delay)
+        )
+
     if hasattr(testSystem, "realview"):
         self.etherlink.int0 = Parent.testsys.realview.ethernet.interface
         self.etherlink.int1 = Parent.drivesys.realview.ethernet.interface
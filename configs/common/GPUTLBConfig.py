@@ -119,8 +119,18 @@ def create_TLB_Coalescer(
 
 
 def config_tlb_hierarchy(
-    options, system, shader_idx, gpu_ctrl=None, full_system=False
+    options,
+    system,
+    shader_idx,
+    gpu_ctrl=None,
+    full_system=False,
+    cu_eventqs=None,
+    bridge_latency=None,
 ):
+    # cu_eventqs optionally gives the event queue of each CU. The L1 TLBs
+    # and their coalescers are then put on the queue of the CUs they serve,
+    # and reach the L2 coalescer on event queue 0 through a ThreadBridge
+    # with a delay of bridge_latency.
     n_cu = options.num_compute_units
 
     if options.TLB_config == "perLane":
@@ -205,6 +215,40 @@ def config_tlb_hierarchy(
             exec(f"system.{system_TLB_name} = TLB_array")
             exec(f"system.{system_Coalescer_name} = Coalescer_array")
 
+    # Find the event queue of each L1 TLB from the CUs it serves
+    L1_eventqs = {}
+    for TLB_type in L1:
+        name = TLB_type["name"]
+        width = TLB_type["width"]
+        if name == "sqc":
+            cus_per_tlb = options.cu_per_sqc
+        elif name == "scalar":
+            cus_per_tlb = options.cu_per_scalar_cache
+        else:
+            cus_per_tlb = max(n_cu // width, 1)
+        tlbs_per_cu = max(width // n_cu, 1)
+        eventqs = []
+        for index in range(width):
+            first_cu = index // tlbs_per_cu * cus_per_tlb
+            cus = range(first_cu, min(first_cu + cus_per_tlb, n_cu))
+            if cu_eventqs:
+                cu_queues = set(cu_eventqs[cu] for cu in cus)
+            else:
+                cu_queues = {0}
+            if len(cu_queues) != 1:
+                m5.util.fatal(
+                    "The CUs of %s_tlb[%d] are on different event queues"
+                    % (name, index)
+                )
+            eventq = cu_queues.pop()
+            if eventq != 0:
+                getattr(system, name + "_tlb")[index].eventq_index = eventq
+                getattr(system, name + "_coalescer")[
+                    index
+                ].eventq_index = eventq
+            eventqs.append(eventq)
+        L1_eventqs[name] = eventqs
+
     # ===========================================================
     # Specify the TLB hierarchy (i.e., port connections)
     # All TLBs but the last level TLB need to have a memSidePort
@@ -281,16 +325,36 @@ def config_tlb_hierarchy(
     # cpuSidePorts of the Coalescers of the next level
     # < Modify here if you want a different configuration >
     # L1 <-> L2
+    # L1 TLBs on another event queue than the L2 cross through a bridge
     l2_coalescer_index = 0
+    tlb_bridges = []
     for TLB_type in L1:
         name = TLB_type["name"]
         for index in range(TLB_type["width"]):
-            exec(
-                "system.%s_tlb[%d].mem_side_ports[0] = \
-                    system.l2_coalescer[0].cpu_side_ports[%d]"
-                % (name, index, l2_coalescer_index)
-            )
+            eventq = L1_eventqs[name][index]
+            if eventq != 0:
+                tlb_bridges.append(
+                    ThreadBridge(
+                        eventq_index=0,
+                        in_eventq_index=eventq,
+                        delay=bridge_latency,
+                    )
+                )
+                getattr(system, name + "_tlb")[
+                    index
+                ].mem_side_ports[0] = tlb_bridges[-1].in_port
+                tlb_bridges[-1].out_port = system.l2_coalescer[
+                    0
+                ].cpu_side_ports[l2_coalescer_index]
+            else:
+                exec(
+                    "system.%s_tlb[%d].mem_side_ports[0] = \
+                        system.l2_coalescer[0].cpu_side_ports[%d]"
+                    % (name, index, l2_coalescer_index)
+                )
             l2_coalescer_index += 1
+    if tlb_bridges:
+        system.l1_tlb_bridges = tlb_bridges
 
     # L2 <-> L3
     system.l2_tlb[0].mem_side_ports[0] = system.l3_coalescer[0].cpu_side_ports[
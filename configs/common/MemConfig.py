@@ -144,6 +144,11 @@ def config_mem(options, system):
     opt_dram_powerdown = getattr(options, "enable_dram_powerdown", None)
     opt_mem_channels_intlv = getattr(options, "mem_channels_intlv", 128)
     opt_xor_low_bit = getattr(options, "xor_low_bit", 0)
+    opt_mem_parallel = getattr(options, "mem_parallel", False)
+    opt_mem_parallel_first_eventq = getattr(
+        options, "mem_parallel_first_eventq", 1
+    )
+    opt_mem_parallel_latency = getattr(options, "mem_parallel_latency", "4ns")
 
     if opt_mem_type == "HMC_2500_1x32":
         HMChost = HMC.config_hmc_host_ctrl(options, system)
@@ -271,7 +276,11 @@ def config_mem(options, system):
     for i in range(len(nvm_intfs)):
         mem_ctrls[i].nvm = nvm_intfs[i]
 
+    if opt_mem_parallel and opt_mem_type == "HMC_2500_1x32":
+        fatal("Parallel memory channels are not supported with HMC")
+
     # Connect the controller to the xbar port
+    mem_bridges = []
     for i in range(len(mem_ctrls)):
         if opt_mem_type == "HMC_2500_1x32":
             # Connect the controllers to the membus
@@ -279,8 +288,25 @@ def config_mem(options, system):
             # Set memory device size. There is an independent controller
             # for each vault. All vaults are same size.
             mem_ctrls[i].dram.device_size = options.hmc_dev_vault_size
+        elif opt_mem_parallel:
+            # Put the controller, and with it its interfaces, on an event
+            # queue of its own, and cross into it through a thread bridge
+            # on the same queue. The responses return to the queue of the
+            # membus.
+            eventq = opt_mem_parallel_first_eventq + i
+            mem_ctrls[i].eventq_index = eventq
+            bridge = m5.objects.ThreadBridge(
+                eventq_index=eventq,
+                in_eventq_index=xbar.eventq_index,
+                delay=opt_mem_parallel_latency,
+            )
+            bridge.in_port = xbar.mem_side_ports
+            bridge.out_port = mem_ctrls[i].port
+            mem_bridges.append(bridge)
         else:
             # Connect the controllers to the membus
             mem_ctrls[i].port = xbar.mem_side_ports
 
     subsystem.mem_ctrls = mem_ctrls
+    if mem_bridges:
+        subsystem.mem_bridges = mem_bridges
@@ -169,6 +169,26 @@ def addNoISAOptions(parser):
         default=0,
         help="Memory channels interleave",
     )
+    parser.add_argument(
+        "--mem-parallel",
+        action="store_true",
+        help="Simulate every memory channel on its own event queue, "
+        "behind a ThreadBridge. Root.sim_quantum or Root.sim_lookahead "
+        "must be set, and must not exceed --mem-parallel-latency.",
+    )
+    parser.add_argument(
+        "--mem-parallel-first-eventq",
+        type=int,
+        default=1,
+        help="Event queue of the first memory channel with --mem-parallel",
+    )
+    parser.add_argument(
+        "--mem-parallel-latency",
+        type=str,
+        default="4ns",
+        help="Latency added by the crossing into a memory channel with "
+        "--mem-parallel, which is the lookahead between the queues",
+    )
 
     parser.add_argument("--memchecker", action="store_true")
 
@@ -566,6 +586,19 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         type=int,
         help="restore from checkpoint <N>",
     )
+    parser.add_argument(
+        "--checkpoint-transplant",
+        action="store_true",
+        help="only restore the architectural state of the checkpoint, "
+        "e.g. into different caches",
+    )
+    parser.add_argument(
+        "--checkpoint-rename",
+        action="append",
+        default=[],
+        metavar="OLD=NEW",
+        help="restore the checkpointed state of object OLD into NEW",
+    )
     parser.add_argument(
         "--checkpoint-at-end",
         action="store_true",
@@ -643,6 +676,14 @@ def addCommonOptions(parser, default_isa: Optional[ISA] = None):
         default=None,
         help="Number of instructions to fast forward before switching",
     )
+    parser.add_argument(
+        "--fast-forward-cpu",
+        default="atomic",
+        choices=["atomic", "fast"],
+        help="""CPU used for --fast-forward. 'fast' uses the ISA's
+                FastForwardCPU, which executes cached decoded blocks and
+                does not model fetch timing.""",
+    )
     parser.add_argument(
         "-S",
         "--simpoint",
@@ -840,6 +881,12 @@ def addFSOptions(parser):
         action="store_true",
         help="Simulate two systems attached with an ethernet link",
     )
+    parser.add_argument(
+        "--dual-parallel",
+        action="store_true",
+        help="Simulate the two systems of --dual on separate threads, "
+        "synchronized every --ethernet-linkdelay",
+    )
     parser.add_argument(
         "-b",
         "--benchmark",
@@ -82,10 +82,13 @@ def setCPUClass(options):
     elif options.fast_forward:
         CPUClass = TmpClass
         CPUISA = ObjectList.cpu_list.get_isa(options.cpu_type)
-        TmpClass = getCPUClass(
-            CpuConfig.isa_string_map[CPUISA] + "AtomicSimpleCPU"
+        fast_forward_cpu = {
+            "atomic": "AtomicSimpleCPU",
+            "fast": "FastForwardCPU",
+        }[options.fast_forward_cpu]
+        TmpClass, test_mem_mode = getCPUClass(
+            CpuConfig.isa_string_map[CPUISA] + fast_forward_cpu
         )
-        test_mem_mode = "atomic"
 
     # Ruby only supports atomic accesses in noncaching mode
     if test_mem_mode == "atomic" and options.ruby:
@@ -682,7 +685,13 @@ def run(options, root, testsys, cpu_class):
     if options.checkpoint_restore:
         cpt_starttick, checkpoint_dir = findCptDir(options, cptdir, testsys)
     root.apply_config(options.param)
-    m5.instantiate(checkpoint_dir)
+    m5.instantiate(
+        checkpoint_dir,
+        transplant=options.checkpoint_transplant,
+        section_renames=dict(
+            r.split("=", 1) for r in options.checkpoint_rename
+        ),
+    )
 
     # Initialization is complete.  If we're not in control of simulation
     # (that is, if we're a slave simulator acting as a component in another
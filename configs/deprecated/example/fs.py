@@ -387,7 +387,18 @@ test_sys = build_test_system(np, isa)
 
 if len(bm) == 2:
     drive_sys = build_drive_system(np)
-    root = makeDualRoot(True, test_sys, drive_sys, args.etherdump)
+    if args.dual_parallel:
+        # The test system may use queues 1 to np for KVM CPUs
+        root = makeDualRoot(
+            True,
+            test_sys,
+            drive_sys,
+            args.etherdump,
+            drive_eventq_index=np + 1,
+            link_delay=args.ethernet_linkdelay,
+        )
+    else:
+        root = makeDualRoot(True, test_sys, drive_sys, args.etherdump)
 elif len(bm) == 1 and args.dist:
     # This system is part of a dist-gem5 simulation
     root = makeDistRoot(
@@ -408,10 +419,13 @@ else:
     print("Error I don't know how to create more than 2 systems.")
     sys.exit(1)
 
-if ObjectList.is_kvm_cpu(TestCPUClass) or ObjectList.is_kvm_cpu(FutureClass):
+if (
+    ObjectList.is_kvm_cpu(TestCPUClass) or ObjectList.is_kvm_cpu(FutureClass)
+) and not args.dual_parallel:
     # Required for running kvm on multiple host cores.
     # Uses gem5's parallel event queue feature
     # Note: The simulator is quite picky about this number!
+    # Parallel dual systems already synchronize every link delay.
     root.sim_quantum = int(1e9)  # 1 ms
 
 if args.timesync:
@@ -0,0 +1,227 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script calibrates a RowBufferMemory against a DRAM controller
+# and interface. It runs three short TrafficGen phases on the detailed
+# model: a serialised stream of row hits, a serialised stream of row
+# conflicts within one bank, and a saturating sequential stream. The
+# measured latencies and bandwidth are then turned into the parameters
+# of a RowBufferMemory, which tracks only open rows and a bandwidth
+# limit and is therefore much faster to simulate. The parameters are
+# printed so that they can be pasted into a configuration, e.g.:
+#
+#   build/ALL/gem5.opt configs/dram/calibrate_row_buffer_mem.py \
+#       --mem-type DDR4_2400_8x8
+#
+# The latencies are measured at the traffic generator and thus include
+# the crossbar in front of the controller.
+
+import argparse
+
+import m5
+from m5.objects import *
+from m5.util import addToPath
+
+addToPath("../")
+
+from common import (
+    MemConfig,
+    ObjectList,
+)
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+
+parser.add_argument(
+    "--mem-type",
+    default="DDR4_2400_8x8",
+    choices=ObjectList.mem_list.get_names(),
+    help="type of memory to calibrate against",
+)
+parser.add_argument(
+    "--mem-ranks", type=int, default=1, help="Number of ranks per channel"
+)
+parser.add_argument(
+    "--duration",
+    default="250us",
+    help="Simulated time spent in each calibration phase",
+)
+parser.add_argument(
+    "--idle-period",
+    default="200ns",
+    help="Time between requests in the latency phases, it should be "
+    "long enough for requests to never queue",
+)
+
+args = parser.parse_args()
+
+system = System(membus=IOXBar(width=32))
+system.clk_domain = SrcClockDomain(
+    clock="2.0GHz", voltage_domain=VoltageDomain(voltage="1V")
+)
+
+mem_range = AddrRange("256MiB")
+system.mem_ranges = [mem_range]
+system.mmap_using_noreserve = True
+
+# calibrate a single channel, the row buffer memory models one channel
+# per instance just like the controller
+args.mem_channels = 1
+args.external_memory_system = 0
+args.tlm_memory = 0
+args.elastic_trace_en = 0
+MemConfig.config_mem(args, system)
+
+if not isinstance(system.mem_ctrls[0], m5.objects.MemCtrl):
+    fatal("This script assumes the controller is a MemCtrl subclass")
+if not isinstance(system.mem_ctrls[0].dram, m5.objects.DRAMInterface):
+    fatal("This script assumes the memory is a DRAMInterface subclass")
+
+dram = system.mem_ctrls[0].dram
+dram.null = True
+
+# the row buffer memory maps rows above banks above columns
+addr_map = "RoRaBaCoCh"
+dram.addr_mapping = addr_map
+
+nbr_banks = dram.banks_per_rank.value
+burst_size = (
+    dram.devices_per_rank.value
+    * dram.device_bus_width.value
+    * dram.burst_length.value
+    // 8
+)
+page_size = dram.devices_per_rank.value * dram.device_rowbuffer_size.value
+bursts_per_page = page_size // burst_size
+
+system.tgen = PyTrafficGen()
+system.tgen.port = system.membus.cpu_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+
+m5.instantiate()
+
+# the tick frequency is fixed once the system is instantiated
+ticks_per_second = m5.ticks.fromSeconds(1.0)
+duration = Latency(args.duration).getValue()
+idle_period = Latency(args.idle_period).getValue()
+burst_period = m5.ticks.fromSeconds(
+    getattr(dram.tBURST_MIN, "value", dram.tBURST.value)
+)
+
+
+def phase(period, num_seq_pkts, banks_util):
+    return system.tgen.createDram(
+        duration,
+        0,
+        mem_range.end,
+        burst_size,
+        period,
+        period,
+        100,
+        0,
+        num_seq_pkts,
+        page_size,
+        nbr_banks,
+        banks_util,
+        ObjectList.dram_addr_map_list.get(addr_map),
+        args.mem_ranks,
+    )
+
+
+def trace():
+    # whole rows in a single bank, the first access of every row is a
+    # conflict and the rest are hits
+    yield phase(idle_period, bursts_per_page, 1)
+    yield system.tgen.createIdle(idle_period)
+    yield system.tgen.createExit(0)
+    # a new row for every access in a single bank
+    yield phase(idle_period, 1, 1)
+    yield system.tgen.createIdle(idle_period)
+    yield system.tgen.createExit(0)
+    # back-to-back whole rows over all banks
+    yield phase(burst_period, bursts_per_page, nbr_banks)
+    yield system.tgen.createIdle(idle_period)
+    yield system.tgen.createExit(0)
+
+
+def get_stat(sim_object, name):
+    return sim_object.getCCObject().resolveStat(name).total
+
+
+def run_phase():
+    start = m5.curTick()
+    m5.simulate()
+    elapsed = m5.curTick() - start
+    reads = get_stat(system.tgen, "totalReads")
+    latency = get_stat(system.tgen, "totalReadLatency")
+    bytes_read = get_stat(system.tgen, "bytesRead")
+    m5.stats.reset()
+    if reads == 0:
+        fatal("No reads completed, increase the phase duration")
+    return latency / reads, bytes_read * ticks_per_second / elapsed
+
+
+system.tgen.start(trace())
+
+mixed_latency, _ = run_phase()
+miss_latency, _ = run_phase()
+_, bandwidth = run_phase()
+
+# the mixed phase has one conflict for every row
+hit_latency = (bursts_per_page * mixed_latency - miss_latency) / (
+    bursts_per_page - 1
+)
+row_latency = max(miss_latency - hit_latency, 0)
+
+# the measurement cannot separate the precharge from the activate, so
+# split the difference in the same proportion as the device timings
+trp = Latency(dram.tRP).value
+trcd = Latency(dram.tRCD).value
+precharge_latency = row_latency * trp / (trp + trcd)
+activate_latency = row_latency - precharge_latency
+
+
+def to_ns(ticks):
+    return ticks * 1e9 / ticks_per_second
+
+
+print(f"Calibrated {args.mem_type} with bursts of {burst_size} bytes")
+print(f"Measured row hit latency:      {to_ns(hit_latency):.3f} ns")
+print(f"Measured row conflict latency: {to_ns(miss_latency):.3f} ns")
+print(f"Measured sequential bandwidth: {bandwidth / 2**30:.3f} GiB/s")
+print()
+print("RowBufferMemory(")
+print(f'    latency="{to_ns(hit_latency):.3f}ns",')
+print(f'    bandwidth="{bandwidth:.0f}B/s",')
+print(f"    banks={nbr_banks * args.mem_ranks},")
+print(f'    row_buffer_size="{page_size}B",')
+print(f'    row_activate_latency="{to_ns(activate_latency):.3f}ns",')
+print(f'    row_precharge_latency="{to_ns(precharge_latency):.3f}ns",')
+print(")")
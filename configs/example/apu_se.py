@@ -257,6 +257,12 @@ parser.add_argument(
     action="store_true",
     help="Count Page Accesses and output in per-CU output files",
 )
+parser.add_argument(
+    "--skip-idle-cu-cycles",
+    action="store_true",
+    help="Stop ticking a CU while all of its waves wait on memory or a "
+    "barrier. The skipped cycles are still counted in the stats.",
+)
 parser.add_argument(
     "--max-cu-tokens",
     type=int,
@@ -431,6 +437,49 @@ parser.add_argument(
     help="Download resources to this directory",
 )
 
+parser.add_argument(
+    "--gpu-partitions",
+    type=int,
+    default=1,
+    help="Number of event queues, and so host threads, to split the "
+    "compute units over. Each partition holds whole groups of CUs which "
+    "share an SQC and a scalar cache. The first one also simulates the "
+    "rest of the system.",
+)
+
+parser.add_argument(
+    "--gpu-sim-quantum",
+    type=str,
+    default="500ps",
+    help="Synchronization period of the event queues with --gpu-partitions. "
+    "It must not be longer than the latency of any message between the "
+    "L1 controllers of the GPU and the network.",
+)
+
+parser.add_argument(
+    "--gpu-ff-kernels",
+    type=str,
+    default="",
+    help="Comma separated names of kernels to fast-forward, i.e., to run "
+    "with functional memory accesses instead of in detail",
+)
+
+parser.add_argument(
+    "--gpu-ff-kernel-ids",
+    type=str,
+    default="",
+    help="Comma separated dispatch IDs of kernels to fast-forward",
+)
+
+parser.add_argument(
+    "--gpu-detailed-launches",
+    type=int,
+    default=0,
+    help="Simulate this many launches of each kernel in detail and "
+    "fast-forward the others. The time of the fast-forwarded launches is "
+    "estimated from the detailed ones. 0 simulates all kernels in detail.",
+)
+
 Ruby.define_options(parser)
 
 # add TLB options to the parser
@@ -483,6 +532,24 @@ args.num_sqc = num_sqc  # pass this to Ruby
 num_scalar_cache = int(math.ceil(float(n_cu) / args.cu_per_scalar_cache))
 args.num_scalar_cache = num_scalar_cache
 
+# Split the CUs over the event queues. The CUs which share an SQC or a
+# scalar cache must be on the same queue as that cache.
+cu_eventqs = [0] * n_cu
+if args.gpu_partitions > 1:
+    group_size = (
+        args.cu_per_sqc
+        * args.cu_per_scalar_cache
+        // math.gcd(args.cu_per_sqc, args.cu_per_scalar_cache)
+    )
+    num_groups = int(math.ceil(float(n_cu) / group_size))
+    if args.gpu_partitions > num_groups:
+        fatal(
+            "Cannot split %d groups of %d CUs in %d partitions"
+            % (num_groups, group_size, args.gpu_partitions)
+        )
+    for i in range(n_cu):
+        cu_eventqs[i] = (i // group_size) * args.gpu_partitions // num_groups
+
 print(
     "Num SQC = ",
     num_sqc,
@@ -545,6 +612,7 @@ for i in range(n_cu):
             functionalTLB=args.FunctionalTLB,
             localMemBarrier=args.LocalMemBarrier,
             countPages=args.countPages,
+            skip_idle_cycles=args.skip_idle_cu_cycles,
             max_cu_tokens=args.max_cu_tokens,
             vrf_lm_bus_latency=args.vrf_lm_bus_latency,
             mem_req_latency=args.mem_req_latency,
@@ -634,6 +702,9 @@ for i in range(n_cu):
     ].localDataStore.cuPort
 
 # Attach compute units to GPU
+for i in range(n_cu):
+    compute_units[i].eventq_index = cu_eventqs[i]
+
 shader.CUs = compute_units
 
 ########################## Creating the CPU system ########################
@@ -748,7 +819,14 @@ render_driver = GPURenderDriver(filename=f"dri/renderD{renderDriNum}")
 gpu_hsapp = HSAPacketProcessor(
     pioAddr=hsapp_gpu_map_paddr, numHWQueues=args.num_hw_queues
 )
-dispatcher = GPUDispatcher(kernel_exit_events=True)
+dispatcher = GPUDispatcher(
+    kernel_exit_events=True,
+    fast_forward_kernels=[k for k in args.gpu_ff_kernels.split(",") if k],
+    fast_forward_kernel_ids=[
+        int(k) for k in args.gpu_ff_kernel_ids.split(",") if k
+    ],
+    detailed_launches_per_kernel=args.gpu_detailed_launches,
+)
 gpu_cmd_proc = GPUCommandProcessor(hsapp=gpu_hsapp, dispatcher=dispatcher)
 gpu_driver.device = gpu_cmd_proc
 shader.dispatcher = dispatcher
@@ -873,7 +951,13 @@ if fast_forward:
         fatal("KvmCPU can only be used in SE mode with x86")
 
 # configure the TLB hierarchy
-GPUTLBConfig.config_tlb_hierarchy(args, system, shader_idx)
+GPUTLBConfig.config_tlb_hierarchy(
+    args,
+    system,
+    shader_idx,
+    cu_eventqs=cu_eventqs,
+    bridge_latency=args.gpu_sim_quantum,
+)
 
 system.exit_on_work_items = True
 
@@ -892,6 +976,23 @@ gpu_hsapp.pio = system.piobus.mem_side_ports
 for i, dma_device in enumerate(dma_list):
     exec("system.dma_cntrl%d.clk_domain = system.ruby.clk_domain" % i)
 
+# Put the L1 controllers of the CUs, and with them their sequencers, on the
+# queues of the CUs. The TCCs, the directories and the network stay on
+# event queue 0, so the CUs only cross queues through the message buffers
+# between the L1 controllers and the network.
+for i in range(n_cu):
+    exec("system.ruby.tcp_cntrl%d.eventq_index = cu_eventqs[%d]" % (i, i))
+for i in range(num_sqc):
+    exec(
+        "system.ruby.sqc_cntrl%d.eventq_index = cu_eventqs[%d]"
+        % (i, i * args.cu_per_sqc)
+    )
+for i in range(num_scalar_cache):
+    exec(
+        "system.ruby.scalar_cntrl%d.eventq_index = cu_eventqs[%d]"
+        % (i, i * args.cu_per_scalar_cache)
+    )
+
 # attach the CPU ports to Ruby
 for i in range(args.num_cpus):
     ruby_port = system.ruby._cpu_ports[i]
@@ -1028,6 +1129,11 @@ else:
     hsaTopology.createRavenTopology(args)
 
 m5.ticks.setGlobalFrequency("1THz")
+if args.gpu_partitions > 1:
+    m5.ticks.fixGlobalFrequency()
+    root.sim_quantum = m5.ticks.fromSeconds(
+        m5.util.convert.toLatency(args.gpu_sim_quantum)
+    )
 if args.abs_max_tick:
     maxtick = args.abs_max_tick
 else:
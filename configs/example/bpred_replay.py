@@ -0,0 +1,151 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script replays branch traces through a branch predictor and reports
+# the misprediction rate of each trace, so that predictor configurations
+# can be swept without re-running the detailed simulations that produced
+# the traces. Every trace is replayed by its own BranchTraceEvaluator, and
+# each evaluator runs on its own event queue, so that traces are replayed
+# in parallel.
+#
+# To record a trace, attach a BranchTraceRecorder to a core that has a
+# branch predictor:
+#
+#   system.cpu.branch_trace = BranchTraceRecorder(trace_file="gcc.btrace")
+#
+# and then replay it, possibly together with other traces, with:
+#
+#   build/ALL/gem5.opt configs/example/bpred_replay.py \
+#       --bp-type LTAGE m5out/gcc.btrace m5out/mcf.btrace
+
+import argparse
+import sys
+import time
+
+import m5
+from m5.objects import *
+from m5.util import (
+    addToPath,
+    fatal,
+)
+
+addToPath("../")
+
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+
+parser.add_argument(
+    "traces",
+    nargs="*",
+    help="Branch traces to replay, as recorded by BranchTraceRecorder",
+)
+
+parser.add_argument(
+    "--bp-type",
+    default="TournamentBP",
+    help="Branch predictor to evaluate",
+)
+
+parser.add_argument(
+    "--list-bp-types",
+    action="store_true",
+    help="List the available branch predictors and exit",
+)
+
+parser.add_argument(
+    "--max-branches",
+    type=int,
+    default=0,
+    help="Number of branches to replay from every trace, 0 for all",
+)
+
+parser.add_argument(
+    "--serial",
+    action="store_true",
+    help="Replay all traces on the same thread",
+)
+
+args = parser.parse_args()
+
+if args.list_bp_types:
+    ObjectList.bp_list.print()
+    sys.exit(0)
+
+if not args.traces:
+    fatal("At least one trace to replay must be provided")
+
+bp_class = ObjectList.bp_list.get(args.bp_type)
+
+evaluators = []
+for i, trace in enumerate(args.traces):
+    evaluator = BranchTraceEvaluator(
+        bpred=bp_class(),
+        trace_file=trace,
+        max_branches=args.max_branches,
+    )
+    if not args.serial:
+        evaluator.eventq_index = i
+    evaluators.append(evaluator)
+
+# The BTBs of the evaluated predictors are clocked objects
+system = System(
+    clk_domain=SrcClockDomain(clock="1GHz", voltage_domain=VoltageDomain()),
+    evaluators=evaluators,
+)
+
+root = Root(full_system=False, system=system)
+if not args.serial and len(evaluators) > 1:
+    # The evaluators never communicate, the quantum only bounds how often
+    # the event queues synchronise.
+    root.sim_quantum = 1000000
+m5.instantiate()
+
+host_start = time.perf_counter()
+exit_event = m5.simulate()
+host_seconds = time.perf_counter() - host_start
+print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
+
+m5.stats.dump()
+
+
+def get_stat(sim_object, name):
+    return sim_object.getCCObject().resolveStat(name).total
+
+
+total_insts = 0
+for trace, evaluator in zip(args.traces, evaluators):
+    insts = get_stat(evaluator, "insts")
+    total_insts += insts
+    print(
+        f"{trace}: {int(get_stat(evaluator, 'branches'))} branches, "
+        f"MPKI {get_stat(evaluator, 'mpki'):.4f}, "
+        f"conditional MPKI {get_stat(evaluator, 'condMpki'):.4f}"
+    )
+if host_seconds > 0:
+    print(f"Replay rate: {total_insts / host_seconds / 1e6:.1f} MIPS")
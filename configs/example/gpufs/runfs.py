@@ -216,6 +216,23 @@ def addRunFSOptions(parser):
         help="cache replacement policy" "policy for sqc",
     )
 
+    parser.add_argument(
+        "--sdma-functional-copy-threshold",
+        type=str,
+        default="0",
+        help="SDMA copies and fills of at least this size bypass the DMA "
+        "ports and access memory through its backdoor (0 disables). "
+        "Requires --access-backing-store to stay coherent.",
+    )
+
+    parser.add_argument(
+        "--sdma-functional-copy-bandwidth",
+        type=str,
+        default="0GiB/s",
+        help="Bandwidth used to time functional SDMA copies (0 completes "
+        "them immediately)",
+    )
+
 
 def runGpuFSSystem(args):
     """
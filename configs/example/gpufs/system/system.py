@@ -174,6 +174,15 @@ def makeGpuFSSystem(args):
     else:
         m5.util.panic(f"Unknown GPU device {args.gpu_device}")
 
+    if (
+        args.sdma_functional_copy_threshold != "0"
+        and not args.access_backing_store
+    ):
+        m5.util.warn(
+            "Functional SDMA copies bypass the caches, consider "
+            "--access-backing-store to keep memory up to date"
+        )
+
     sdma_pt_walkers = []
     sdma_engines = []
     for sdma_idx in range(num_sdmas):
@@ -182,6 +191,8 @@ def makeGpuFSSystem(args):
             walker=sdma_pt_walker,
             mmio_base=sdma_bases[sdma_idx],
             mmio_size=sdma_sizes[sdma_idx],
+            functional_copy_threshold=args.sdma_functional_copy_threshold,
+            functional_copy_bandwidth=args.sdma_functional_copy_bandwidth,
         )
         sdma_pt_walkers.append(sdma_pt_walker)
         sdma_engines.append(sdma_engine)
@@ -0,0 +1,198 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script replays a recorded memory access stream through a single
+# cache with a configurable hardware prefetcher, so that prefetchers and
+# their table organisations can be evaluated without re-running the
+# workload that produced the stream. A PyTrafficGen plays the trace back
+# into the cache, which is backed by a SimpleMemory that does not store
+# data, and the prefetcher accuracy and coverage are reported together
+# with the host time spent per replayed access.
+#
+# Traces are in the protobuf packet trace format written by MemTraceProbe
+# (gem5 must be built with protobuf support). To record a stream, place a
+# CommMonitor in front of the cache whose accesses should be captured and
+# attach a probe to it:
+#
+#   system.monitor = CommMonitor()
+#   system.monitor.cpu_side_port = system.cpu.dcache_port
+#   system.monitor.mem_side_port = system.cpu.dcache.cpu_side
+#   system.monitor.trace = MemTraceProbe(trace_file="accesses.trc.gz")
+#
+# and then replay it with, for example:
+#
+#   build/ALL/gem5.opt configs/example/prefetcher_replay.py \
+#       --trace m5out/accesses.trc.gz --prefetcher StridePrefetcher
+
+import argparse
+import sys
+import time
+
+import m5
+from m5.objects import *
+from m5.util import (
+    addToPath,
+    fatal,
+)
+
+addToPath("../")
+
+from common import ObjectList
+
+parser = argparse.ArgumentParser(
+    formatter_class=argparse.ArgumentDefaultsHelpFormatter
+)
+
+parser.add_argument(
+    "--trace",
+    help="Packet trace to replay, as recorded by MemTraceProbe",
+)
+
+parser.add_argument(
+    "--prefetcher",
+    default=None,
+    help="Prefetcher to evaluate; no prefetching if not specified",
+)
+
+parser.add_argument(
+    "--list-prefetchers",
+    action="store_true",
+    help="List the available prefetchers and exit",
+)
+
+parser.add_argument(
+    "--cache-size", default="256KiB", help="Size of the replay cache"
+)
+
+parser.add_argument(
+    "--cache-assoc",
+    type=int,
+    default=8,
+    help="Associativity of the replay cache",
+)
+
+parser.add_argument(
+    "--cache-line-size",
+    type=int,
+    default=64,
+    help="Cache line size; must match the recorded system's",
+)
+
+parser.add_argument(
+    "--mshrs", type=int, default=16, help="Number of MSHRs of the cache"
+)
+
+parser.add_argument(
+    "--mem-size",
+    default="16GiB",
+    help="Size of the address range the trace accesses fall in",
+)
+
+parser.add_argument(
+    "--mem-latency", default="50ns", help="Latency of the backing memory"
+)
+
+parser.add_argument(
+    "--duration",
+    type=int,
+    default=m5.MaxTick // 2,
+    help="Upper bound, in ticks, on the length of the replay",
+)
+
+args = parser.parse_args()
+
+if args.list_prefetchers:
+    ObjectList.hwp_list.print()
+    sys.exit(0)
+
+if not args.trace:
+    fatal("A trace to replay must be provided with --trace")
+
+system = System(
+    cache_line_size=args.cache_line_size,
+    membus=SystemXBar(),
+    clk_domain=SrcClockDomain(clock="1GHz", voltage_domain=VoltageDomain()),
+)
+
+# The backing store only has to respond, not to hold any data
+system.mem_ctrl = SimpleMemory(
+    range=AddrRange(args.mem_size),
+    latency=args.mem_latency,
+    null=True,
+)
+system.mem_ctrl.port = system.membus.mem_side_ports
+system.system_port = system.membus.cpu_side_ports
+
+system.cache = Cache(
+    size=args.cache_size,
+    assoc=args.cache_assoc,
+    tag_latency=2,
+    data_latency=2,
+    response_latency=2,
+    mshrs=args.mshrs,
+    tgts_per_mshr=20,
+)
+if args.prefetcher:
+    system.cache.prefetcher = ObjectList.hwp_list.get(args.prefetcher)()
+system.cache.mem_side = system.membus.cpu_side_ports
+
+system.tgen = PyTrafficGen()
+system.tgen.port = system.cache.cpu_side
+
+root = Root(full_system=False, system=system)
+root.system.mem_mode = "timing"
+m5.instantiate()
+
+system.tgen.start(
+    [
+        system.tgen.createTrace(args.duration, args.trace),
+        system.tgen.createExit(0),
+    ]
+)
+
+host_start = time.perf_counter()
+exit_event = m5.simulate()
+host_seconds = time.perf_counter() - host_start
+print(f"Exiting @ tick {m5.curTick()} because {exit_event.getCause()}")
+
+m5.stats.dump()
+
+
+def get_stat(sim_object, name):
+    return sim_object.getCCObject().resolveStat(name).total
+
+
+accesses = get_stat(system.cache, "demandAccesses")
+print(f"Demand accesses replayed: {int(accesses)}")
+print(f"Demand MSHR misses: {int(get_stat(system.cache, 'demandMshrMisses'))}")
+if accesses:
+    print(f"Host time per access: {host_seconds * 1e9 / accesses:.1f} ns")
+
+if args.prefetcher:
+    prefetcher = system.cache.prefetcher
+    print(f"Prefetches issued: {int(get_stat(prefetcher, 'pfIssued'))}")
+    print(f"Prefetch accuracy: {get_stat(prefetcher, 'accuracy'):.4f}")
+    print(f"Prefetch coverage: {get_stat(prefetcher, 'coverage'):.4f}")
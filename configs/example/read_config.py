@@ -586,23 +586,32 @@ parser.add_argument(
     help="A checkpoint to directory to restore when starting "
     "the simulation",
 )
+parser.add_argument(
+    "--cxx",
+    action="store_true",
+    help="Instantiate an .ini file directly in C++ without building "
+    "Python SimObjects (needs a build with --with-cxx-config)",
+)
 
 args = parser.parse_args(sys.argv[1:])
 
-if args.config_file.endswith(".ini"):
-    config = ConfigIniFile()
-    config.load(args.config_file)
+if args.cxx:
+    m5.instantiateFromConfig(args.config_file, args.checkpoint_dir)
 else:
-    config = ConfigJsonFile()
-    config.load(args.config_file)
+    if args.config_file.endswith(".ini"):
+        config = ConfigIniFile()
+        config.load(args.config_file)
+    else:
+        config = ConfigJsonFile()
+        config.load(args.config_file)
 
-ticks.fixGlobalFrequency()
+    ticks.fixGlobalFrequency()
 
-mgr = ConfigManager(config)
+    mgr = ConfigManager(config)
 
-mgr.find_all_objects()
+    mgr.find_all_objects()
 
-m5.instantiate(args.checkpoint_dir)
+    m5.instantiate(args.checkpoint_dir)
 
 exit_event = m5.simulate()
 print("Exiting @ tick %i because %s" % (m5.curTick(), exit_event.getCause()))
@@ -55,8 +55,9 @@ def define_options(parser):
     parser.add_argument(
         "--network",
         default="simple",
-        choices=["simple", "garnet"],
-        help="""'simple'|'garnet' (garnet2.0 will be deprecated.)""",
+        choices=["simple", "garnet", "analytical"],
+        help="""'simple'|'garnet'|'analytical' (garnet2.0 will be
+            deprecated.)""",
     )
     parser.add_argument(
         "--router-latency",
@@ -116,6 +117,17 @@ def define_options(parser):
         default=50000,
         help="network-level deadlock threshold.",
     )
+    parser.add_argument(
+        "--garnet-partitions",
+        action="store",
+        type=int,
+        default=1,
+        help="""simulate the garnet network on this many event queues.
+            The routers are split into blocks of consecutive ids (rows
+            of a mesh), and each controller follows its router.
+            Root.sim_quantum or Root.sim_lookahead must be set and must
+            not exceed the link latency.""",
+    )
     parser.add_argument(
         "--simple-physical-channels",
         action="store_true",
@@ -144,6 +156,13 @@ def create_network(options, ruby):
         RouterClass = GarnetRouter
         InterfaceClass = GarnetNetworkInterface
 
+    elif options.network == "analytical":
+        NetworkClass = AnalyticalNetwork
+        IntLinkClass = BasicIntLink
+        ExtLinkClass = BasicExtLink
+        RouterClass = BasicRouter
+        InterfaceClass = None
+
     else:
         NetworkClass = SimpleNetwork
         IntLinkClass = SimpleIntLink
@@ -278,7 +297,27 @@ def init_network(options, network, InterfaceClass):
         ]
         network.netifs = netifs
 
+    if options.garnet_partitions > 1:
+        assert options.network == "garnet"
+        partition_network(network, options.garnet_partitions)
+
     if options.network_fault_model:
         assert options.network == "garnet"
         network.enable_fault_model = True
         network.fault_model = FaultModel()
+
+
+def partition_network(network, num_partitions):
+    """Spread the routers of a garnet network over several event queues.
+
+    Routers with consecutive ids share an event queue, which keeps mesh
+    rows together. The controller of each external link is put on the
+    event queue of the link's router, where its network interface runs
+    as well, so only router-to-router links cross between queues.
+    """
+    num_routers = len(network.routers)
+    for i, router in enumerate(network.routers):
+        router.eventq_index = i * num_partitions // num_routers
+
+    for ext_link in network.ext_links:
+        ext_link.ext_node.eventq_index = ext_link.int_node.eventq_index
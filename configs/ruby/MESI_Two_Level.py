@@ -31,6 +31,8 @@ import m5
 from m5.defines import buildEnv
 from m5.objects import *
 
+from common import ObjectList
+
 from .Ruby import (
     create_directories,
     create_topology,
@@ -96,6 +98,13 @@ def create_system(
 
         prefetcher = RubyPrefetcher(block_size=options.cacheline_size)
 
+        # A classic prefetcher, if requested, replaces the Ruby one
+        l1d_hwp_type = getattr(options, "l1d_hwp_type", None)
+        if l1d_hwp_type:
+            classic_prefetcher = ObjectList.hwp_list.get(l1d_hwp_type)()
+        else:
+            classic_prefetcher = NULL
+
         clk_domain = cpus[i].clk_domain
 
         l1_cntrl = L1Cache_Controller(
@@ -105,6 +114,8 @@ def create_system(
             l2_select_num_bits=l2_bits,
             send_evictions=send_evicts(options),
             prefetcher=prefetcher,
+            classic_prefetcher=classic_prefetcher,
+            use_classic_prefetcher=classic_prefetcher != NULL,
             ruby_system=ruby_system,
             clk_domain=clk_domain,
             transitions_per_cycle=options.ports,
@@ -123,7 +123,8 @@
 namespace py = pybind11;
 
 gem5Component::gem5Component(SST::ComponentId_t id, SST::Params& params):
-    SST::Component(id), threadInitialized(false)
+    SST::Component(id), threadInitialized(false), windowCycle(0),
+    windowPending(false), stopThread(false), windowExit(nullptr)
 {
     output.init("gem5Component-" + getName() + "->", 1, 0,
                 SST::Output::STDOUT);
@@ -165,6 +166,8 @@ gem5Component::gem5Component(SST::ComponentId_t id, SST::Params& params):
         gem5::setDebugFlag(debug_flag.c_str());
     }
 
+    threaded = params.find<bool>("threaded", false);
+
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
 
@@ -224,6 +227,10 @@ gem5Component::init(unsigned phase)
         gem5::Root* gem5_root = gem5::Root::root();
         for (auto &port : sstPorts) {
             port->findCorrespondingSimObject(gem5_root);
+            if (threaded) {
+                port->setAsyncResponses(true);
+                port->setBatchRequests(true);
+            }
         }
 
         // initialize the gem5 event queue
@@ -234,6 +241,7 @@ gem5Component::init(unsigned phase)
                 "simulate() limit reached",
                 0
             );
+            windowExit = gem5::simulate_limit_event;
         }
 
     }
@@ -249,33 +257,117 @@ gem5Component::setup()
     for (auto &port : sstPorts) {
         port->setup();
     }
+
+    if (threaded) {
+        // the event queue is thread local, and this thread still calls into
+        // gem5 when exchanging packets with the bridges
+        gem5::curEventQueue(gem5::mainEventQueue[0]);
+        gilRelease = std::make_unique<py::gil_scoped_release>();
+        gem5Thread = std::thread(&gem5Component::gem5ThreadLoop, this);
+    }
 }
 
 void
 gem5Component::finish()
 {
     output.verbose(CALL_INFO, 1, 0, "Component is being finished.\n");
+
+    if (gem5Thread.joinable()) {
+        waitForWindow();
+        {
+            std::lock_guard<std::mutex> lock(windowLock);
+            stopThread = true;
+        }
+        windowCond.notify_all();
+        gem5Thread.join();
+    }
+    gilRelease.reset();
+}
+
+void
+gem5Component::handleExit(gem5::GlobalSimLoopExitEvent *event)
+{
+    output.output("exiting: curTick()=%lu cause=`%s` code=%d\n",
+        gem5::curTick(), event->getCause().c_str(), event->getCode()
+    );
+    // output gem5 stats
+    const std::vector<std::string> output_stats_commands = {
+        "import m5.stats",
+        "m5.stats.dump()"
+    };
+    gilRelease.reset();
+    execPythonCommands(output_stats_commands);
+
+    primaryComponentOKToEndSim();
+}
+
+void
+gem5Component::waitForWindow()
+{
+    std::unique_lock<std::mutex> lock(windowLock);
+    windowCond.wait(lock, [this] { return !windowPending; });
+}
+
+void
+gem5Component::gem5ThreadLoop()
+{
+    gem5::curEventQueue(gem5::mainEventQueue[0]);
+
+    std::unique_lock<std::mutex> lock(windowLock);
+    while (true) {
+        windowCond.wait(lock, [this] { return windowPending || stopThread; });
+        if (stopThread)
+            return;
+
+        uint64_t cycle = windowCycle;
+        lock.unlock();
+        gem5::GlobalSimLoopExitEvent *event;
+        {
+            // SimObjects may call back into Python while simulating
+            py::gil_scoped_acquire gil;
+            event = simulateGem5(cycle);
+        }
+        lock.lock();
+
+        windowExit = event;
+        windowPending = false;
+        windowCond.notify_all();
+    }
 }
 
 bool
 gem5Component::clockTick(SST::Cycle_t currentCycle)
 {
+    clocksProcessed++;
+
+    if (threaded) {
+        // wait for the previous cycle to be simulated
+        waitForWindow();
+        if (windowExit != gem5::simulate_limit_event) {
+            handleExit(windowExit);
+            return true;
+        }
+
+        // gem5 is idle, so the bridges can be drained on this thread
+        for (auto &port : sstPorts) {
+            port->flushRequests();
+            port->deliverResponses();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(windowLock);
+            windowCycle = currentCycle;
+            windowPending = true;
+        }
+        windowCond.notify_all();
+        return false;
+    }
+
     // what to do in a SST's cycle
     gem5::GlobalSimLoopExitEvent *event = simulateGem5(currentCycle);
-    clocksProcessed++;
     // gem5 exits due to reasons other than reaching simulation limit
     if (event != gem5::simulate_limit_event) {
-        output.output("exiting: curTick()=%lu cause=`%s` code=%d\n",
-            gem5::curTick(), event->getCause().c_str(), event->getCode()
-        );
-        // output gem5 stats
-        const std::vector<std::string> output_stats_commands = {
-            "import m5.stats",
-            "m5.stats.dump()"
-        };
-        execPythonCommands(output_stats_commands);
-
-        primaryComponentOKToEndSim();
+        handleExit(event);
         return true;
     }
 
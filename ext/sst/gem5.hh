@@ -73,7 +73,11 @@
 
 #define TRACING_ON 0
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <sst/core/sst_config.h>
@@ -88,6 +92,11 @@
 
 #include "sst_responder_subcomponent.hh"
 
+namespace pybind11
+{
+class gil_scoped_release;
+} // namespace pybind11
+
 class gem5Component: public SST::Component
 {
   public:
@@ -127,6 +136,26 @@ class gem5Component: public SST::Component
 
     static gem5::Event* doSimLoop(gem5::EventQueue* eventq);
 
+    void handleExit(gem5::GlobalSimLoopExitEvent *event);
+
+    // When threaded, gem5 simulates each SST cycle in its own thread while
+    // SST carries on with the other components. The packets crossing the
+    // bridges are exchanged at the start of the next cycle, once the gem5
+    // thread has caught up.
+    bool threaded;
+    std::thread gem5Thread;
+    std::mutex windowLock;
+    std::condition_variable windowCond;
+    uint64_t windowCycle;
+    bool windowPending;
+    bool stopThread;
+    gem5::GlobalSimLoopExitEvent *windowExit;
+    // the GIL is released while the gem5 thread may run
+    std::unique_ptr<pybind11::gil_scoped_release> gilRelease;
+
+    void gem5ThreadLoop();
+    void waitForWindow();
+
   public: // register the component to SST
     SST_ELI_REGISTER_COMPONENT(
         gem5Component,
@@ -138,7 +167,9 @@ class gem5Component: public SST::Component
     )
 
     SST_ELI_DOCUMENT_PARAMS(
-        {"cmd", "command to run gem5's config"}
+        {"cmd", "command to run gem5's config"},
+        {"threaded", "run gem5 in its own thread, one SST cycle behind",
+         "false"}
     )
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
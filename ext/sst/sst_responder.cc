@@ -55,6 +55,17 @@ SSTResponder::handleRecvTimingReq(gem5::PacketPtr pkt)
     return owner->handleTimingReq(request);
 }
 
+void
+SSTResponder::handleRecvTimingReqs(const std::vector<gem5::PacketPtr> &pkts)
+{
+    for (auto pkt : pkts) {
+        auto request = Translator::gem5RequestToSSTRequest(
+            pkt, owner->sstRequestIdToPacketMap
+        );
+        owner->handleTimingReq(request);
+    }
+}
+
 void
 SSTResponder::handleRecvRespRetry()
 {
@@ -41,6 +41,7 @@ SSTResponderSubComponent::SSTResponderSubComponent(SST::ComponentId_t id,
     sstResponder = new SSTResponder(this);
     gem5SimObjectName = params.find<std::string>("response_receiver_name", "");
     memSize = params.find<std::string>("mem_size", "8GiB");
+    asyncResponses = params.find<bool>("async_responses", false);
     if (gem5SimObjectName == "")
         assert(false && "The response_receiver_name must be specified");
 }
@@ -88,6 +89,39 @@ SSTResponderSubComponent::setResponseReceiver(
     responseReceiver->setResponder(sstResponder);
 }
 
+void
+SSTResponderSubComponent::setAsyncResponses(bool async)
+{
+    asyncResponses = async;
+}
+
+void
+SSTResponderSubComponent::setBatchRequests(bool batch)
+{
+    responseReceiver->setBatchRequests(batch);
+}
+
+void
+SSTResponderSubComponent::flushRequests()
+{
+    responseReceiver->flushRequests();
+}
+
+void
+SSTResponderSubComponent::deliverResponses()
+{
+    responseReceiver->deliverResponses();
+}
+
+void
+SSTResponderSubComponent::sendResponse(gem5::PacketPtr pkt)
+{
+    if (asyncResponses)
+        responseReceiver->queueTimingResp(pkt);
+    else if (blocked() || !responseReceiver->sendTimingResp(pkt))
+        responseQueue.push(pkt);
+}
+
 bool
 SSTResponderSubComponent::handleTimingReq(
     SST::Interfaces::StandardMem::Request* request)
@@ -149,8 +183,7 @@ SSTResponderSubComponent::handleSwapReqResponse(
     );
     pkt->makeAtomicResponse();
     pkt->headerDelay = pkt->payloadDelay = 0;
-    if (blocked() || !responseReceiver->sendTimingResp(pkt))
-        responseQueue.push(pkt);
+    sendResponse(pkt);
 
     // step 2
     (*(pkt->getAtomicOp()))(data.data()); // apply the atomic op
@@ -196,9 +229,7 @@ SSTResponderSubComponent::portEventHandler(
 
         Translator::inplaceSSTRequestToGem5PacketPtr(pkt, request);
 
-        if (blocked() || !(responseReceiver->sendTimingResp(pkt))) {
-            responseQueue.push(pkt);
-        }
+        sendResponse(pkt);
     } else {
         // we can handle unexpected invalidates, but nothing else.
         if (SST::Interfaces::StandardMem::Read* test =
@@ -224,7 +255,10 @@ SSTResponderSubComponent::portEventHandler(
         // Clear out bus delay notifications
         pkt->headerDelay = pkt->payloadDelay = 0;
 
-        responseReceiver->sendTimingSnoopReq(pkt);
+        if (asyncResponses)
+            responseReceiver->queueTimingSnoopReq(pkt);
+        else
+            responseReceiver->sendTimingSnoopReq(pkt);
     }
 
     delete request;
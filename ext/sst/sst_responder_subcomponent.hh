@@ -67,6 +67,12 @@ class SSTResponderSubComponent: public SST::SubComponent
     std::string gem5SimObjectName;
     std::string memSize;
 
+    // whether responses are queued in the bridge rather than sent to gem5
+    // right away, which is needed when gem5 runs in its own thread
+    bool asyncResponses;
+
+    void sendResponse(gem5::PacketPtr pkt);
+
   public:
     SSTResponderSubComponent(SST::ComponentId_t id, SST::Params& params);
     ~SSTResponderSubComponent();
@@ -76,6 +82,13 @@ class SSTResponderSubComponent: public SST::SubComponent
     void setOutputStream(SST::Output* output_);
 
     void setResponseReceiver(gem5::OutgoingRequestBridge* gem5_bridge);
+    void setAsyncResponses(bool async);
+    void setBatchRequests(bool batch);
+
+    // exchange the packets held on either side of the bridge, at the
+    // boundary of a synchronization window
+    void flushRequests();
+    void deliverResponses();
     void portEventHandler(SST::Interfaces::StandardMem::Request* request);
 
     bool blocked();
@@ -113,7 +126,10 @@ class SSTResponderSubComponent: public SST::SubComponent
 
     SST_ELI_DOCUMENT_PARAMS(
         {"response_receiver_name", \
-         "Name of the SimObject receiving the responses"}
+         "Name of the SimObject receiving the responses"},
+        {"async_responses", \
+         "Queue responses in the bridge until the next synchronization", \
+         "false"}
     )
 
 };
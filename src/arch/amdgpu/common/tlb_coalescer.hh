@@ -35,6 +35,7 @@
 #include <list>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "arch/amdgpu/common/tlb.hh"
@@ -86,7 +87,7 @@ class TLBCoalescer : public ClockedObject
 
     /*
      * This is a hash map with <tick_index> as a key.
-     * It contains a vector of coalescedReqs per <tick_index>.
+     * It contains a bucket of coalescedReqs per <tick_index>.
      * Requests are buffered here until they can be issued to
      * the TLB, at which point they are copied to the
      * issuedTranslationsTable hash map.
@@ -97,9 +98,19 @@ class TLBCoalescer : public ClockedObject
      * of the pkt from the ComputeUnit's perspective, but another
      * option is to change it to curTick(), so we coalesce based
      * on the receive time.
+     *
+     * Within a bucket the coalesced requests are kept in arrival
+     * order. The index hashes the virtual page and TLB mode of each
+     * request that can still absorb packets, so finding a coalescing
+     * candidate is a single probe rather than a scan of the window.
      */
-    typedef std::map<int64_t, std::vector<coalescedReq>>
-        CoalescingFIFO;
+    struct CoalescingBucket
+    {
+        std::list<coalescedReq> reqs;
+        std::unordered_map<Addr, std::list<coalescedReq>::iterator> index;
+    };
+
+    typedef std::map<int64_t, CoalescingBucket> CoalescingFIFO;
 
     CoalescingFIFO coalescerFIFO;
 
@@ -117,6 +128,7 @@ class TLBCoalescer : public ClockedObject
     CoalescingTable issuedTranslationsTable;
 
     bool canCoalesce(PacketPtr pkt1, PacketPtr pkt2);
+    Addr coalescingKey(PacketPtr pkt);
     void updatePhysAddresses(PacketPtr pkt);
 
     class CpuSidePort : public ResponsePort
@@ -41,6 +41,9 @@ class VegaPagetableWalker(ClockedObject):
     cxx_header = "arch/amdgpu/vega/pagetable_walker.hh"
     port = RequestPort("Port for the hardware table walker")
     system = Param.System(Parent.any, "system object")
+    walk_cache_entries = Param.Unsigned(
+        32, "Number of page directory entries cached across walks"
+    )
 
 
 class VegaGPUTLB(ClockedObject):
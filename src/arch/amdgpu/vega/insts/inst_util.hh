@@ -33,6 +33,7 @@
 #define __ARCH_VEGA_INSTS_INST_UTIL_HH__
 
 #include <cmath>
+#include <tuple>
 
 #include "arch/amdgpu/vega/gpu_registers.hh"
 #include "arch/amdgpu/vega/insts/gpu_static_inst.hh"
@@ -903,6 +904,47 @@ namespace VegaISA
          */
         sdwaInstDstImpl(dst, origDst, clamp, dst_sel, dst_unusedBits_format);
     }
+
+    /**
+     * vecMap computes op over the values of the source operands for all
+     * lanes of a wavefront and stores the results in vdst. all lanes are
+     * computed whatever the exec mask, which is applied when vdst is
+     * written back to the register file. that keeps the loop free of
+     * branches and operand indirections, so that the compiler can turn
+     * it into host SIMD code. op must not have side effects.
+     */
+    template<typename Dst, typename Op, typename... Src>
+    inline void
+    vecMap(Dst &vdst, Op op, const Src &...src)
+    {
+        auto *dst = vdst.laneData();
+        const auto vals = std::make_tuple(src.laneValues()...);
+
+        std::apply([dst, &op](const auto &...val) {
+            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane)
+                dst[lane] = op(val[lane]...);
+        }, vals);
+    }
+
+    /**
+     * vecMask evaluates pred over the values of the source operands for
+     * all lanes of a wavefront, like vecMap, and returns a mask of the
+     * active lanes for which it holds, e.g. for VOPC comparisons.
+     */
+    template<typename Pred, typename... Src>
+    inline ScalarRegU64
+    vecMask(Wavefront *wf, Pred pred, const Src &...src)
+    {
+        const auto vals = std::make_tuple(src.laneValues()...);
+        ScalarRegU64 mask = 0;
+
+        std::apply([&mask, &pred](const auto &...val) {
+            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane)
+                mask |= ScalarRegU64(pred(val[lane]...) ? 1 : 0) << lane;
+        }, vals);
+
+        return mask & wf->execMask().to_ullong();
+    }
 } // namespace VegaISA
 } // namespace gem5
 
@@ -164,6 +164,8 @@ namespace VegaISA
 
             //check whether the workgroup is indicating the kernel end, i.e.,
             //the last workgroup in the kernel
+            Shader::ScopedReport report(cu);
+
             bool kernelEnd =
                 wf->computeUnit->shader->dispatcher().isReachingKernelEnd(wf);
 
@@ -204,6 +206,7 @@ namespace VegaISA
 
             wf->computeUnit->stats.completedWGs++;
         } else {
+            Shader::ScopedReport report(cu);
             wf->computeUnit->shader->dispatcher().scheduleDispatch();
         }
     } // execute
@@ -74,7 +74,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_MOV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
@@ -105,17 +104,9 @@ namespace VegaISA
             assert(!extData.iFmt_VOP_DPP.SRC1_NEG);
             processDPP(gpuDynInst, extData.iFmt_VOP_DPP, src_dpp);
 
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src_dpp[lane];
-                }
-            }
+            vecMap(vdst, [](auto a) { return a; }, src_dpp);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src[lane];
-                }
-            }
+            vecMap(vdst, [](auto a) { return a; }, src);
         }
 
         vdst.write();
@@ -228,7 +219,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -237,11 +227,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -263,7 +249,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -272,11 +257,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -298,7 +279,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -307,11 +287,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -624,7 +600,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -633,11 +608,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -659,7 +630,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -668,11 +638,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -694,7 +660,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_UBYTE0::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -703,11 +668,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 7, 0));
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)(bits(a, 7, 0)); }, src);
 
         vdst.write();
     } // execute
@@ -729,7 +690,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_UBYTE1::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -738,11 +698,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 15, 8));
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)(bits(a, 15, 8)); }, src);
 
         vdst.write();
     } // execute
@@ -764,7 +720,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_UBYTE2::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -773,11 +728,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 23, 16));
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)(bits(a, 23, 16)); },
+               src);
 
         vdst.write();
     } // execute
@@ -799,7 +751,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_UBYTE3::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -808,11 +759,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)(bits(src[lane], 31, 24));
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)(bits(a, 31, 24)); },
+               src);
 
         vdst.write();
     } // execute
@@ -885,7 +833,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -894,11 +841,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -1666,7 +1609,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_NOT_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
@@ -1675,11 +1617,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return ~a; }, src);
 
         vdst.write();
     } // execute
@@ -2069,7 +2007,6 @@ namespace VegaISA
     void
     Inst_VOP1__V_MOV_B64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU64 src(gpuDynInst, instData.SRC0);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
 
@@ -2078,11 +2015,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return a; }, src);
 
         vdst.write();
     } // execute
@@ -2581,11 +2514,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return a; }, src);
 
         vdst.write();
     } // execute
@@ -97,7 +97,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ADD_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         VecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -126,17 +125,9 @@ namespace VegaISA
 
             processDPP(gpuDynInst, extData.iFmt_VOP_DPP, src0_dpp, src1);
 
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0_dpp[lane] + src1[lane];
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a + b; }, src0_dpp, src1);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a + b; }, src0, src1);
         }
 
         vdst.write();
@@ -160,7 +151,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -171,11 +161,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -198,7 +184,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -209,11 +194,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -235,7 +216,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MUL_LEGACY_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -246,11 +226,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a * b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -499,7 +475,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -510,11 +485,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::fmin(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -536,7 +508,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -547,11 +518,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::fmax(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -572,7 +540,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -583,11 +550,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -608,7 +572,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -619,11 +582,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -644,7 +604,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -655,11 +614,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -680,7 +636,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -691,11 +646,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -718,7 +670,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHRREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -729,11 +680,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 4, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -756,7 +704,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ASHRREV_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -767,11 +714,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 4, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -843,11 +787,8 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a << bits(b, 4, 0); },
+                   src1, src0);
         }
 
         vdst.write();
@@ -870,7 +811,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_AND_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         VecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -899,17 +839,9 @@ namespace VegaISA
 
             processDPP(gpuDynInst, extData.iFmt_VOP_DPP, src0_dpp, src1);
 
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0_dpp[lane] & src1[lane];
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a & b; }, src0_dpp, src1);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] & src1[lane];
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a & b; }, src0, src1);
         }
 
         vdst.write();
@@ -982,11 +914,7 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] | src1[lane];
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a | b; }, src0, src1);
         }
 
         vdst.write();
@@ -1009,7 +937,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_XOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -1020,11 +947,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a ^ b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1674,7 +1597,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ADD_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1685,11 +1607,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1711,7 +1629,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1722,11 +1639,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1749,7 +1662,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1760,11 +1672,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -1786,7 +1694,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MUL_LO_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1797,11 +1704,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a * b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1823,7 +1726,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHLREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1834,11 +1736,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a << bits(b, 3, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -1861,7 +1760,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHRREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1872,11 +1770,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -1899,7 +1793,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ASHRREV_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -1910,11 +1803,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -1979,7 +1868,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1990,11 +1878,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2015,7 +1900,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2026,11 +1910,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2051,7 +1932,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -2062,11 +1942,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2087,7 +1964,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2098,11 +1974,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2193,11 +2066,7 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
-            for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
-            }
+            vecMap(vdst, [](auto a, auto b) { return a + b; }, src0, src1);
         }
 
         vdst.write();
@@ -2219,7 +2088,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2230,11 +2098,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2255,7 +2119,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2266,11 +2129,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -2291,7 +2150,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_FMAC_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -2303,11 +2161,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, vdst);
 
         vdst.write();
     } // execute
@@ -2328,7 +2183,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_XNOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2340,11 +2194,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not implemented for %s", _opcode);
         panic_if(isDPPInst(), "DPP not implemented for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~(src0[lane] ^ src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return ~(a ^ b); }, src0, src1);
 
         vdst.write();
     } // execute
@@ -94,7 +94,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -124,11 +123,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -151,7 +146,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUB_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -181,11 +175,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -208,7 +198,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUBREV_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -238,11 +227,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -646,7 +631,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -676,11 +660,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::fmin(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -702,7 +683,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -732,11 +712,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::fmax(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -757,7 +734,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -775,11 +751,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -800,7 +773,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -818,11 +790,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -843,7 +812,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -861,11 +829,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -886,7 +851,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -904,11 +868,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -931,7 +892,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHRREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -949,11 +909,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 4, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -976,7 +933,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ASHRREV_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -994,11 +950,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 4, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -1020,7 +973,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHLREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -1038,11 +990,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a << bits(b, 4, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -1064,7 +1013,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_AND_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -1082,11 +1030,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] & src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a & b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1108,7 +1052,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_OR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -1126,11 +1069,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a | b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1152,7 +1091,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_OR3_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -1172,11 +1110,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane] | src2[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return a | b | c; },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -1198,7 +1133,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_XOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -1216,11 +1150,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a ^ b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1244,7 +1174,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAC_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -1275,11 +1204,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, vdst);
 
         vdst.write();
     } // execute
@@ -1716,7 +1642,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1734,11 +1659,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1760,7 +1681,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUB_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1778,11 +1698,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1805,7 +1721,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUBREV_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1823,11 +1738,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -1849,7 +1760,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MUL_LO_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1867,11 +1777,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a * b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -1893,7 +1799,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHLREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1911,11 +1816,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a << bits(b, 3, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -1938,7 +1840,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHRREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -1962,11 +1863,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 3, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 3, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -1989,7 +1887,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ASHRREV_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2007,11 +1904,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 3, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 3, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -2076,7 +1970,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -2100,11 +1993,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2125,7 +2015,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2149,11 +2038,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::max(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2174,7 +2060,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -2198,11 +2083,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2223,7 +2105,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -2247,11 +2128,8 @@ namespace VegaISA
             src1.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::min(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -2292,7 +2170,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2310,11 +2187,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a + b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2335,7 +2208,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUB_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2353,11 +2225,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src0, src1);
 
         vdst.write();
     } // execute
@@ -2378,7 +2246,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUBREV_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -2396,11 +2263,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a - b; }, src1, src0);
 
         vdst.write();
     } // execute
@@ -2510,17 +2373,12 @@ namespace VegaISA
     void
     Inst_VOP3__V_MOV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return a; }, src);
 
         vdst.write();
     } // execute
@@ -2596,7 +2454,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F64_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -2610,11 +2467,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -2636,7 +2489,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         VecOperandI32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -2652,11 +2504,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -2678,7 +2526,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -2692,11 +2539,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -3069,7 +2912,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -3091,11 +2933,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)a; }, src);
 
         vdst.write();
     } // execute
@@ -3117,7 +2955,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F64_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -3139,11 +2976,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -3165,7 +2998,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_UBYTE0::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -3179,11 +3011,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 7, 0);
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)bits(a, 7, 0); }, src);
 
         vdst.write();
     } // execute
@@ -3205,7 +3033,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_UBYTE1::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -3219,11 +3046,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 15, 8);
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)bits(a, 15, 8); }, src);
 
         vdst.write();
     } // execute
@@ -3245,7 +3068,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_UBYTE2::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -3259,11 +3081,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 23, 16);
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)bits(a, 23, 16); }, src);
 
         vdst.write();
     } // execute
@@ -3285,7 +3103,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_UBYTE3::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -3299,11 +3116,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)bits(src[lane], 31, 24);
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF32)bits(a, 31, 24); }, src);
 
         vdst.write();
     } // execute
@@ -3381,7 +3194,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F64_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -3395,11 +3207,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return (VecElemF64)a; }, src);
 
         vdst.write();
     } // execute
@@ -4266,7 +4074,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_NOT_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
@@ -4280,11 +4087,7 @@ namespace VegaISA
             src.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
-        }
+        vecMap(vdst, [](auto a) { return ~a; }, src);
 
         vdst.write();
     } // execute
@@ -5185,7 +4988,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_LEGACY_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -5219,11 +5021,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5246,7 +5045,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -5280,11 +5078,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5632,7 +5427,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_FMA_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -5666,11 +5460,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -5693,7 +5484,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_FMA_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF64 src2(gpuDynInst, extData.SRC2);
@@ -5727,11 +5517,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -6944,7 +6731,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_DIV_FMAS_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -6978,11 +6764,8 @@ namespace VegaISA
             src2.negModifier();
         }
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return std::fma(a, b, c); },
+               src0, src1, src2);
 
         //vdst.write();
     } // execute
@@ -7250,7 +7033,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_XAD_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -7270,11 +7052,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] ^ src1[lane]) + src2[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return (a ^ b) + c; },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7387,7 +7166,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD3_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -7407,11 +7185,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane] + src2[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return a + b + c; },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7479,7 +7254,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_AND_OR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -7499,11 +7273,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] & src1[lane]) | src2[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return (a & b) | c; },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7548,7 +7319,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU16 src2(gpuDynInst, extData.SRC2);
@@ -7568,11 +7338,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return a * b + c; },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -7595,7 +7362,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandI16 src2(gpuDynInst, extData.SRC2);
@@ -7615,11 +7381,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane] + src2[lane];
-            }
-        }
+        vecMap(vdst, [](auto a, auto b, auto c) { return a * b + c; },
+               src0, src1, src2);
 
         vdst.write();
     } // execute
@@ -8205,7 +7968,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, extData.SRC1);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
@@ -8235,11 +7997,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::fmin(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -8261,7 +8020,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, extData.SRC1);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
@@ -8291,11 +8049,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return std::fmax(a, b); },
+               src0, src1);
 
         vdst.write();
     } // execute
@@ -8765,7 +8520,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHLREV_B64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU64 src1(gpuDynInst, extData.SRC1);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
@@ -8783,11 +8537,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 5, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a << bits(b, 5, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -8810,7 +8561,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHRREV_B64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU64 src1(gpuDynInst, extData.SRC1);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
@@ -8828,11 +8578,8 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 5, 0);
-            }
-        }
+        vecMap(vdst, [](auto a, auto b) { return a >> bits(b, 5, 0); },
+               src1, src0);
 
         vdst.write();
     } // execute
@@ -1346,11 +1346,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1381,11 +1377,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1416,11 +1408,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1451,11 +1439,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1486,11 +1470,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1521,11 +1501,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1626,11 +1602,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -1697,11 +1670,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a > b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -1732,11 +1702,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -1767,11 +1734,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -1802,11 +1765,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a < b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -1900,11 +1860,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -1937,11 +1893,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -1974,11 +1926,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2011,11 +1959,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2086,11 +2030,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2201,11 +2141,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2276,11 +2213,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a > b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2313,11 +2247,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2350,11 +2281,7 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2387,11 +2314,8 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a < b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -2506,11 +2430,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -2563,11 +2483,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -2620,11 +2536,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -2677,11 +2589,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -2792,11 +2700,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -2963,11 +2867,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -3078,11 +2979,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a > b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -3135,11 +3033,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -3192,11 +3087,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -3249,11 +3140,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a < b); },
+                       src0, src1);
 
         sdst.write();
     } // execute
@@ -3369,11 +3257,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3428,11 +3312,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3487,11 +3367,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3546,11 +3422,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3665,11 +3537,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3846,11 +3714,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -3965,11 +3830,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a > b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4024,11 +3886,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4083,11 +3942,7 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4142,11 +3997,8 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return !(a < b); },
+                       src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4247,11 +4099,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4291,11 +4139,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4335,11 +4179,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4379,11 +4219,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4423,11 +4259,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4467,11 +4299,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4567,11 +4395,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4611,11 +4435,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4655,11 +4475,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4699,11 +4515,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4743,11 +4555,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4787,11 +4595,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -4891,11 +4695,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4937,11 +4737,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -4983,11 +4779,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5029,11 +4821,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5075,11 +4863,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5121,11 +4905,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5229,11 +5009,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5275,11 +5051,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5321,11 +5093,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5367,11 +5135,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5413,11 +5177,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5459,11 +5219,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -5563,11 +5319,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5607,11 +5359,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5651,11 +5399,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5695,11 +5439,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5739,11 +5479,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5783,11 +5519,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5883,11 +5615,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5927,11 +5655,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -5971,11 +5695,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -6015,11 +5735,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -6059,11 +5775,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -6103,11 +5815,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -6207,11 +5915,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6253,11 +5957,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6299,11 +5999,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6345,11 +6041,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6391,11 +6083,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6437,11 +6125,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6545,11 +6229,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6591,11 +6271,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6637,11 +6313,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6683,11 +6355,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6729,11 +6397,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6775,11 +6439,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -6879,11 +6539,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -6923,11 +6579,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -6967,11 +6619,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7011,11 +6659,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7055,11 +6699,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7099,11 +6739,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7199,11 +6835,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7243,11 +6875,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7287,11 +6915,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7331,11 +6955,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7375,11 +6995,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7419,11 +7035,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         sdst.write();
     } // execute
@@ -7523,11 +7135,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7569,11 +7177,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7615,11 +7219,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7661,11 +7261,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7707,11 +7303,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7753,11 +7345,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7861,11 +7449,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7907,11 +7491,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7953,11 +7533,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -7999,11 +7575,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -8045,11 +7617,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -8091,11 +7659,7 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        sdst = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = sdst.rawData();
         sdst.write();
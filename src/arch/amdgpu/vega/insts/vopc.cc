@@ -1292,11 +1292,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1329,11 +1325,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1366,11 +1358,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1403,11 +1391,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1478,11 +1462,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1591,11 +1571,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                      src0, src1);
 
         vcc.write();
     } // execute
@@ -1666,11 +1643,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1703,11 +1676,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                      src0, src1);
 
         vcc.write();
     } // execute
@@ -1740,11 +1710,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1777,11 +1743,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -1875,11 +1837,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1914,11 +1872,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1953,11 +1907,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -1992,11 +1942,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2071,11 +2017,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2192,11 +2134,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                      src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2271,11 +2210,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2310,11 +2245,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                      src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2349,11 +2281,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] == src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a == b); },
+                      src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2388,11 +2317,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -2486,11 +2411,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2523,11 +2444,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2560,11 +2477,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2597,11 +2510,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2672,11 +2581,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2785,11 +2690,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                      src0, src1);
 
         vcc.write();
     } // execute
@@ -2860,11 +2762,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2897,11 +2795,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                      src0, src1);
 
         vcc.write();
     } // execute
@@ -2934,11 +2829,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -2971,11 +2862,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3069,11 +2956,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -3108,11 +2991,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -3147,11 +3026,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3186,11 +3061,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3265,11 +3136,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3386,11 +3253,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a >= b); },
+                      src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3465,11 +3329,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a > b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3504,11 +3364,8 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a <= b); },
+                      src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3543,11 +3400,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3582,11 +3435,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return !(a < b); }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -3678,11 +3527,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3714,11 +3559,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3750,11 +3591,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3786,11 +3623,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3822,11 +3655,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3858,11 +3687,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -3950,11 +3775,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4027,11 +3848,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4063,11 +3880,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4142,11 +3955,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4237,11 +4046,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4275,11 +4080,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4313,11 +4114,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4351,11 +4148,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4389,11 +4182,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4427,11 +4216,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4525,11 +4310,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4563,11 +4344,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4601,11 +4378,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4639,11 +4412,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4677,11 +4446,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4715,11 +4480,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -4810,11 +4571,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4846,11 +4603,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4882,11 +4635,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4918,11 +4667,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4954,11 +4699,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -4990,11 +4731,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5082,11 +4819,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5118,11 +4851,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5154,11 +4883,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5190,11 +4915,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5226,11 +4947,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5262,11 +4979,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5357,11 +5070,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5395,11 +5104,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5433,11 +5138,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5471,11 +5172,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5509,11 +5206,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5547,11 +5240,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5645,11 +5334,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5683,11 +5368,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5721,11 +5402,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5759,11 +5436,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5797,11 +5470,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5835,11 +5504,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -5930,11 +5595,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -5966,11 +5627,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6002,11 +5659,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6038,11 +5691,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6074,11 +5723,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6110,11 +5755,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6202,11 +5843,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6238,11 +5875,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6274,11 +5907,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6310,11 +5939,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6346,11 +5971,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6382,11 +6003,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         vcc.write();
     } // execute
@@ -6477,11 +6094,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6515,11 +6128,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6553,11 +6162,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6591,11 +6196,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6629,11 +6230,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6667,11 +6264,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6765,11 +6358,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a < b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6803,11 +6392,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a == b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6841,11 +6426,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a <= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6879,11 +6460,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a > b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6917,11 +6494,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a != b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -6955,11 +6528,7 @@ namespace VegaISA
         panic_if(isSDWAInst(), "SDWA not supported for %s", _opcode);
         panic_if(isDPPInst(), "DPP not supported for %s", _opcode);
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        vcc = vecMask(wf, [](auto a, auto b) { return a >= b; }, src0, src1);
 
         wf->execMask() = vcc.rawData();
         vcc.write();
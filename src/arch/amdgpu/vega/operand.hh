@@ -32,6 +32,7 @@
 #ifndef __ARCH_VEGA_OPERAND_HH__
 #define __ARCH_VEGA_OPERAND_HH__
 
+#include <algorithm>
 #include <array>
 
 #include "arch/amdgpu/vega/gpu_registers.hh"
@@ -301,6 +302,56 @@ namespace VegaISA
             }
         }
 
+        /**
+         * get the values of all lanes, with any modifiers applied. only
+         * enable if this operand can be represented using primitive types
+         * (i.e., 8b to 64b primitives). this lets instructions which
+         * compute all lanes in the same way run branch-free loops over
+         * plain arrays, see vecMap().
+         */
+        template<bool Condition = NumDwords == 1 || NumDwords == 2>
+        typename std::enable_if<Condition,
+            std::array<DataType, NumVecElemPerVecReg>>::type
+        laneValues() const
+        {
+            std::array<DataType, NumVecElemPerVecReg> lanes;
+
+            if (scalar) {
+                lanes.fill(scRegData.rawData());
+            } else {
+                auto vgpr = vecReg.template as<DataType>();
+                std::copy_n(vgpr, NumVecElemPerVecReg, lanes.begin());
+            }
+
+            if constexpr (std::is_floating_point_v<DataType>) {
+                if (absMod) {
+                    for (auto &lane : lanes)
+                        lane = std::fabs(lane);
+                }
+
+                if (negMod) {
+                    for (auto &lane : lanes)
+                        lane = -lane;
+                }
+            } else {
+                assert(!absMod && !negMod);
+            }
+
+            return lanes;
+        }
+
+        /**
+         * get the lanes of a destination operand for writing. only the
+         * active lanes are written back to the register file by write().
+         */
+        template<bool Condition = (NumDwords == 1 || NumDwords == 2) && !Const>
+        typename std::enable_if<Condition, DataType *>::type
+        laneData()
+        {
+            assert(!scalar);
+            return vecReg.template as<DataType>();
+        }
+
         /**
          * setter [] operator. only enable if this operand is non-constant
          * (i.e, a destination operand) and if it can be represented using
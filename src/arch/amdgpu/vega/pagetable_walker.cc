@@ -160,38 +160,49 @@ Walker::WalkerState::initState(BaseMMU::Mode _mode, Addr baseAddr, Addr vaddr,
 void
 Walker::WalkerState::startWalk()
 {
-    if (!started) {
-        // Read the first PDE to begin
-        DPRINTF(GPUPTWalker, "Sending timing read to %#lx\n",
-                read->getAddr());
-
-        sendPackets();
-        started = true;
-    } else {
+    if (started) {
         // This is mostly the same as stepWalk except we update the state and
         // send the new timing read request.
+        PageTableEntry pte = read->getLE<uint64_t>();
+        if (state != PTE && pte.v)
+            walker->insertWalkCache(read->getAddr(), pte);
+
         timingFault = stepWalk();
         assert(timingFault == NoFault || read == NULL);
 
         state = nextState;
+    }
+    started = true;
 
-        if (read) {
-            DPRINTF(GPUPTWalker, "Sending timing read to %#lx\n",
-                    read->getAddr());
-            sendPackets();
-        } else {
-            // Set physical page address in entry
-            entry.paddr = entry.pte.ppn << PageShift;
-            entry.paddr += entry.vaddr & mask(entry.logBytes);
+    // Directory entries held in the page-walk cache are consumed right
+    // away, so only the first level that misses is read from memory.
+    uint64_t pde;
+    while (read && state != PTE &&
+           walker->lookupWalkCache(read->getAddr(), pde)) {
+        read->setLE<uint64_t>(pde);
+
+        timingFault = stepWalk();
+        assert(timingFault == NoFault || read == NULL);
 
-            // Insert to TLB
-            assert(walker);
-            assert(walker->tlb);
-            walker->tlb->insert(entry.vaddr, entry);
+        state = nextState;
+    }
 
-            // Send translation return event
-            walker->walkerResponse(this, entry, tlbPkt);
-        }
+    if (read) {
+        DPRINTF(GPUPTWalker, "Sending timing read to %#lx\n",
+                read->getAddr());
+        sendPackets();
+    } else {
+        // Set physical page address in entry
+        entry.paddr = entry.pte.ppn << PageShift;
+        entry.paddr += entry.vaddr & mask(entry.logBytes);
+
+        // Insert to TLB
+        assert(walker);
+        assert(walker->tlb);
+        walker->tlb->insert(entry.vaddr, entry);
+
+        // Send translation return event
+        walker->walkerResponse(this, entry, tlbPkt);
     }
 }
 
@@ -444,6 +455,55 @@ Walker::walkerResponse(WalkerState *state, VegaTlbEntry& entry, PacketPtr pkt)
 }
 
 
+bool
+Walker::lookupWalkCache(Addr pde_addr, uint64_t &pde)
+{
+    if (!walkCacheEntries)
+        return false;
+
+    auto it = walkCache.find(pde_addr);
+    if (it == walkCache.end()) {
+        stats.walkCacheMisses++;
+        return false;
+    }
+
+    DPRINTF(GPUPTWalker, "Walk cache hit for PDE at %#lx: %#016x\n",
+            pde_addr, it->second);
+    stats.walkCacheHits++;
+    pde = it->second;
+    return true;
+}
+
+void
+Walker::insertWalkCache(Addr pde_addr, uint64_t pde)
+{
+    if (!walkCacheEntries || !walkCache.emplace(pde_addr, pde).second)
+        return;
+
+    walkCacheOrder.push_back(pde_addr);
+    if (walkCacheOrder.size() > walkCacheEntries) {
+        walkCache.erase(walkCacheOrder.front());
+        walkCacheOrder.pop_front();
+    }
+}
+
+void
+Walker::invalidateWalkCache()
+{
+    DPRINTF(GPUPTWalker, "Invalidating the walk cache\n");
+    walkCache.clear();
+    walkCacheOrder.clear();
+}
+
+Walker::WalkerStats::WalkerStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(walkCacheHits, statistics::units::Count::get(),
+               "Page directory reads served by the walk cache"),
+      ADD_STAT(walkCacheMisses, statistics::units::Count::get(),
+               "Page directory reads sent to memory")
+{
+}
+
 /*
  *  Helper methods
  */
@@ -32,10 +32,13 @@
 #ifndef __DEV_AMDGPU_PAGETABLE_WALKER_HH__
 #define __DEV_AMDGPU_PAGETABLE_WALKER_HH__
 
+#include <deque>
+#include <unordered_map>
 #include <vector>
 
 #include "arch/amdgpu/vega/pagetable.hh"
 #include "arch/amdgpu/vega/tlb.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "debug/GPUPTWalker.hh"
 #include "mem/packet.hh"
@@ -164,6 +167,9 @@ class Walker : public ClockedObject
     void setDevRequestor(RequestorID mid) { deviceRequestorId = mid; }
     RequestorID getDevRequestor() const { return deviceRequestorId; }
 
+    // Drop the page-walk cache, e.g., when the TLB is invalidated
+    void invalidateWalkCache();
+
   protected:
     // The TLB we're supposed to load.
     GpuTLB *tlb;
@@ -184,6 +190,29 @@ class Walker : public ClockedObject
     // System pointer for functional accesses
     System *system;
 
+    /**
+     * Page-walk cache shared by all timing walks of this walker. It maps
+     * the physical address of a valid page directory entry to its value
+     * so walks through the same upper levels of the page table skip
+     * those reads. Functional walks bypass it, as they are also issued
+     * by walkers with no TLB to invalidate them. Entries are replaced
+     * in insertion order.
+     */
+    std::unordered_map<Addr, uint64_t> walkCache;
+    std::deque<Addr> walkCacheOrder;
+    unsigned walkCacheEntries;
+
+    bool lookupWalkCache(Addr pde_addr, uint64_t &pde);
+    void insertWalkCache(Addr pde_addr, uint64_t pde);
+
+    struct WalkerStats : public statistics::Group
+    {
+        WalkerStats(statistics::Group *parent);
+
+        statistics::Scalar walkCacheHits;
+        statistics::Scalar walkCacheMisses;
+    } stats;
+
   public:
     void setTLB(GpuTLB * _tlb)
     {
@@ -196,7 +225,8 @@ class Walker : public ClockedObject
         port(name() + ".port", this),
         funcState(this, nullptr, true), tlb(nullptr),
         requestorId(p.system->getRequestorId(this)),
-        deviceRequestorId(999), system(p.system)
+        deviceRequestorId(999), system(p.system),
+        walkCacheEntries(p.walk_cache_entries), stats(this)
     {
         DPRINTF(GPUPTWalker, "Walker::Walker %p\n", this);
     }
@@ -63,15 +63,8 @@ GpuTLB::GpuTLB(const VegaGPUTLBParams &p)
 
     tlb.assign(size, VegaTlbEntry());
 
-    freeList.resize(numSets);
-    entryList.resize(numSets);
-
-    for (int set = 0; set < numSets; ++set) {
-        for (int way = 0; way < assoc; ++way) {
-            int x = set * assoc + way;
-            freeList[set].push_back(&tlb.at(x));
-        }
-    }
+    tags.assign(size, EntryTag());
+    lruClock = 0;
 
     FA = (size == assoc);
     setMask = numSets - 1;
@@ -156,20 +149,30 @@ GpuTLB::pageAlign(Addr vaddr)
 VegaTlbEntry*
 GpuTLB::insert(Addr vpn, VegaTlbEntry &entry)
 {
-    VegaTlbEntry *newEntry = nullptr;
-
     int set = (entry.vaddr >> VegaISA::PageShift) & setMask;
-
-    if (!freeList[set].empty()) {
-        newEntry = freeList[set].front();
-        freeList[set].pop_front();
-    } else {
-        newEntry = entryList[set].back();
-        entryList[set].pop_back();
+    int first = set * assoc;
+    int victim = -1;
+
+    // Reuse the way already caching this page, otherwise prefer a free
+    // way over the least recently used one.
+    for (int x = first; x < first + assoc; ++x) {
+        if (!tags[x].bytes) {
+            if (victim < 0 || tags[victim].bytes)
+                victim = x;
+        } else if (tags[x].vaddr == entry.vaddr) {
+            victim = x;
+            break;
+        } else if (victim < 0 || (tags[victim].bytes &&
+                   tags[x].lastUse < tags[victim].lastUse)) {
+            victim = x;
+        }
     }
 
+    VegaTlbEntry *newEntry = &tlb[victim];
     *newEntry = entry;
-    entryList[set].push_front(newEntry);
+    tags[victim].vaddr = newEntry->vaddr;
+    tags[victim].bytes = newEntry->size();
+    tags[victim].lastUse = ++lruClock;
 
     DPRINTF(GPUTLB, "Inserted %#lx -> %#lx of size %#lx into set %d\n",
             newEntry->vaddr, newEntry->paddr, entry.size(), set);
@@ -177,8 +180,8 @@ GpuTLB::insert(Addr vpn, VegaTlbEntry &entry)
     return newEntry;
 }
 
-GpuTLB::EntryList::iterator
-GpuTLB::lookupIt(Addr va, bool update_lru)
+int
+GpuTLB::lookupWay(Addr va, bool update_lru)
 {
     int set = (va >> VegaISA::PageShift) & setMask;
 
@@ -186,38 +189,30 @@ GpuTLB::lookupIt(Addr va, bool update_lru)
         assert(!set);
     }
 
-    auto entry = entryList[set].begin();
-    for (; entry != entryList[set].end(); ++entry) {
-        int page_size = (*entry)->size();
-
-        if ((*entry)->vaddr <= va && (*entry)->vaddr + page_size > va) {
+    int first = set * assoc;
+    for (int x = first; x < first + assoc; ++x) {
+        // Unsigned wrap-around turns the range check into one compare;
+        // free ways never match since they cache no bytes.
+        if (va - tags[x].vaddr < tags[x].bytes) {
             DPRINTF(GPUTLB, "Matched vaddr %#x to entry starting at %#x "
-                    "with size %#x.\n", va, (*entry)->vaddr, page_size);
+                    "with size %#x.\n", va, tags[x].vaddr, tags[x].bytes);
 
-            if (update_lru) {
-                entryList[set].push_front(*entry);
-                entryList[set].erase(entry);
-                entry = entryList[set].begin();
-            }
+            if (update_lru)
+                tags[x].lastUse = ++lruClock;
 
-            break;
+            return x;
         }
     }
 
-    return entry;
+    return -1;
 }
 
 VegaTlbEntry*
 GpuTLB::lookup(Addr va, bool update_lru)
 {
-    int set = (va >> VegaISA::PageShift) & setMask;
-
-    auto entry = lookupIt(va, update_lru);
+    int way = lookupWay(va, update_lru);
 
-    if (entry == entryList[set].end())
-        return nullptr;
-    else
-        return *entry;
+    return way < 0 ? nullptr : &tlb[way];
 }
 
 void
@@ -225,26 +220,20 @@ GpuTLB::invalidateAll()
 {
     DPRINTF(GPUTLB, "Invalidating all entries.\n");
 
-    for (int i = 0; i < numSets; ++i) {
-        while (!entryList[i].empty()) {
-            VegaTlbEntry *entry = entryList[i].front();
-            entryList[i].pop_front();
-            freeList[i].push_back(entry);
-        }
-    }
+    for (auto &tag : tags)
+        tag.bytes = 0;
+
+    // The page tables may have changed, drop the cached directory entries
+    walker->invalidateWalkCache();
 }
 
 void
 GpuTLB::demapPage(Addr va, uint64_t asn)
 {
+    int way = lookupWay(va, false);
 
-    int set = (va >> VegaISA::PageShift) & setMask;
-    auto entry = lookupIt(va, false);
-
-    if (entry != entryList[set].end()) {
-        freeList[set].push_back(*entry);
-        entryList[set].erase(entry);
-    }
+    if (way >= 0)
+        tags[way].bytes = 0;
 }
 
 
@@ -104,8 +104,7 @@ class GpuTLB : public ClockedObject
     void demapPage(Addr va, uint64_t asn);
 
   protected:
-    typedef std::list<VegaTlbEntry*> EntryList;
-    EntryList::iterator lookupIt(Addr va, bool update_lru=true);
+    int lookupWay(Addr va, bool update_lru=true);
     Walker *walker;
     AMDGPUDevice *gpuDevice;
 
@@ -132,21 +131,24 @@ class GpuTLB : public ClockedObject
 
     std::vector<VegaTlbEntry> tlb;
 
-    /*
-     * It's a per-set list. As long as we have not reached
-     * the full capacity of the given set, grab an entry from
-     * the freeList.
-     */
-    std::vector<EntryList> freeList;
-
     /**
-     * An entryList per set is the equivalent of an LRU stack;
-     * it's used to guide replacement decisions. The head of the list
-     * contains the MRU TLB entry of the given set. If the freeList
-     * for this set is empty, the last element of the list
-     * is evicted (i.e., dropped on the floor).
+     * Packed tags for the entries in tlb. Way w of set s is at index
+     * s * assoc + w of both vectors, so probing a set scans assoc
+     * adjacent tags instead of chasing list nodes. A way caching zero
+     * bytes is free. Replacement picks a free way first and otherwise
+     * the way with the oldest lastUse stamp.
      */
-    std::vector<EntryList> entryList;
+    struct EntryTag
+    {
+        Addr vaddr = 0;
+        Addr bytes = 0;
+        uint64_t lastUse = 0;
+    };
+
+    std::vector<EntryTag> tags;
+
+    // source of the lastUse stamps
+    uint64_t lruClock;
 
   public:
     // latencies for a TLB hit, miss and page fault
@@ -138,6 +138,21 @@ VegaTLBCoalescer::canCoalesce(PacketPtr incoming_pkt, PacketPtr coalesced_pkt)
     return true;
 }
 
+/*
+ * Key of the coalescing bucket index. Requests that share a key pass the
+ * rules in canCoalesce(); page addresses are aligned so the TLB mode fits
+ * in the page offset bits.
+ */
+Addr
+VegaTLBCoalescer::coalescingKey(PacketPtr pkt)
+{
+    GpuTranslationState *state =
+        safe_cast<GpuTranslationState*>(pkt->senderState);
+
+    return roundDown(pkt->req->getVaddr(), VegaISA::PageBytes) |
+        state->tlbMode;
+}
+
 /*
  * We need to update the physical addresses of all the translation requests
  * that were coalesced into the one that just returned.
@@ -241,13 +256,6 @@ VegaTLBCoalescer::updatePhysAddresses(PacketPtr pkt)
 bool
 VegaTLBCoalescer::CpuSidePort::recvTimingReq(PacketPtr pkt)
 {
-    // first packet of a coalesced request
-    PacketPtr first_packet = nullptr;
-    // true if we are able to do coalescing
-    bool didCoalesce = false;
-    // number of coalesced reqs for a given window
-    int coalescedReq_cnt = 0;
-
     GpuTranslationState *sender_state =
         safe_cast<GpuTranslationState*>(pkt->senderState);
 
@@ -290,41 +298,32 @@ VegaTLBCoalescer::CpuSidePort::recvTimingReq(PacketPtr pkt)
     // given coalescingWindow.
     Tick tick_index = sender_state->issueTime / coalescer->coalescingWindow;
 
-    if (coalescer->coalescerFIFO.count(tick_index)) {
-        coalescedReq_cnt = coalescer->coalescerFIFO[tick_index].size();
-    }
+    CoalescingBucket &bucket = coalescer->coalescerFIFO[tick_index];
+    Addr key = coalescer->coalescingKey(pkt);
 
     // see if we can coalesce the incoming pkt with another
     // coalesced request with the same tick_index
-    for (int i = 0; i < coalescedReq_cnt; ++i) {
-        first_packet = coalescer->coalescerFIFO[tick_index][i][0];
-
-        if (coalescer->canCoalesce(pkt, first_packet)) {
-            coalescer->coalescerFIFO[tick_index][i].push_back(pkt);
+    auto match = coalescer->disableCoalescing ? bucket.index.end() :
+        bucket.index.find(key);
 
-            DPRINTF(GPUTLB, "Coalesced req %i w/ tick_index %d has %d reqs\n",
-                    i, tick_index,
-                    coalescer->coalescerFIFO[tick_index][i].size());
+    if (match != bucket.index.end() &&
+        coalescer->canCoalesce(pkt, match->second->front())) {
+        match->second->push_back(pkt);
 
-            didCoalesce = true;
-            break;
-        }
-    }
-
-    // if this is the first request for this tick_index
-    // or we did not manage to coalesce, update stats
-    // and make necessary allocations.
-    if (!coalescedReq_cnt || !didCoalesce) {
+        DPRINTF(GPUTLB, "Coalesced req w/ tick_index %d has %d reqs\n",
+                tick_index, match->second->size());
+    } else {
+        // if this is the first request for this page and mode within
+        // the tick_index, update stats and make necessary allocations.
         if (update_stats)
             coalescer->coalescedAccesses++;
 
-        std::vector<PacketPtr> new_array;
-        new_array.push_back(pkt);
-        coalescer->coalescerFIFO[tick_index].push_back(new_array);
+        bucket.reqs.emplace_back(1, pkt);
+        if (!coalescer->disableCoalescing)
+            bucket.index[key] = std::prev(bucket.reqs.end());
 
         DPRINTF(GPUTLB, "coalescerFIFO[%d] now has %d coalesced reqs after "
-                "push\n", tick_index,
-                coalescer->coalescerFIFO[tick_index].size());
+                "push\n", tick_index, bucket.reqs.size());
     }
 
     //schedule probeTLBEvent next cycle to send the
@@ -444,16 +443,13 @@ VegaTLBCoalescer::processProbeTLBEvent()
 
     for (auto iter = coalescerFIFO.begin();
          iter != coalescerFIFO.end();) {
-        int coalescedReq_cnt = iter->second.size();
-        int i = 0;
-        int vector_index = 0;
+        CoalescingBucket &bucket = iter->second;
 
         DPRINTF(GPUTLB, "coalescedReq_cnt is %d for tick_index %d\n",
-               coalescedReq_cnt, iter->first);
+               bucket.reqs.size(), iter->first);
 
-        while (i < coalescedReq_cnt) {
-            ++i;
-            PacketPtr first_packet = iter->second[vector_index][0];
+        for (auto req = bucket.reqs.begin(); req != bucket.reqs.end();) {
+            PacketPtr first_packet = req->front();
             //The request to coalescer is origanized as follows.
             //The coalescerFIFO is a map which is indexed by coalescingWindow
             // cycle. Only requests that falls in the same coalescingWindow
@@ -474,7 +470,7 @@ VegaTLBCoalescer::processProbeTLBEvent()
                 DPRINTF(GPUTLB, "Cannot issue - There are pending reqs for "
                         "page %#x\n", virt_page_addr);
 
-                ++vector_index;
+                ++req;
                 continue;
             }
 
@@ -512,22 +508,19 @@ VegaTLBCoalescer::processProbeTLBEvent()
 
                     // pkt_cnt is number of packets we coalesced into the one
                     // we just sent but only at this coalescer level
-                    int pkt_cnt = iter->second[vector_index].size();
+                    int pkt_cnt = req->size();
                     localqueuingCycles += (curCycle() * pkt_cnt);
                 }
 
                 DPRINTF(GPUTLB, "Successfully sent TLB request for page %#x\n",
                        virt_page_addr);
 
-                //copy coalescedReq to issuedTranslationsTable
-                issuedTranslationsTable[virt_page_addr]
-                    = iter->second[vector_index];
+                //move coalescedReq to issuedTranslationsTable
+                issuedTranslationsTable[virt_page_addr] = std::move(*req);
 
                 //erase the entry of this coalesced req
-                iter->second.erase(iter->second.begin() + vector_index);
-
-                if (iter->second.empty())
-                    assert( i == coalescedReq_cnt );
+                bucket.index.erase(coalescingKey(first_packet));
+                req = bucket.reqs.erase(req);
 
                 sent_probes++;
 
@@ -536,7 +529,7 @@ VegaTLBCoalescer::processProbeTLBEvent()
                     //Before returning make sure that empty vectors are taken
                     // out. Not a big issue though since a later invocation
                     // will take it out anyway.
-                    if (iter->second.empty())
+                    if (bucket.reqs.empty())
                         coalescerFIFO.erase(iter);
 
                     //schedule probeTLBEvent next cycle to send the
@@ -552,7 +545,7 @@ VegaTLBCoalescer::processProbeTLBEvent()
 
         //if there are no more coalesced reqs for this tick_index
         //erase the hash_map with the first iterator
-        if (iter->second.empty()) {
+        if (bucket.reqs.empty()) {
             coalescerFIFO.erase(iter++);
         } else {
             ++iter;
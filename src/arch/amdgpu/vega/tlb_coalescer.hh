@@ -35,6 +35,7 @@
 #include <list>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "arch/amdgpu/vega/tlb.hh"
@@ -79,7 +80,7 @@ class VegaTLBCoalescer : public ClockedObject
 
     /*
      * This is a hash map with <tick_index> as a key.
-     * It contains a vector of coalescedReqs per <tick_index>.
+     * It contains a bucket of coalescedReqs per <tick_index>.
      * Requests are buffered here until they can be issued to
      * the TLB, at which point they are copied to the
      * issuedTranslationsTable hash map.
@@ -90,8 +91,19 @@ class VegaTLBCoalescer : public ClockedObject
      * of the pkt from the ComputeUnit's perspective, but another
      * option is to change it to curTick(), so we coalesce based
      * on the receive time.
+     *
+     * Within a bucket the coalesced requests are kept in arrival
+     * order. The index hashes the virtual page and TLB mode of each
+     * request that can still absorb packets, so finding a coalescing
+     * candidate is a single probe rather than a scan of the window.
      */
-    typedef std::map<Tick, std::vector<coalescedReq>> CoalescingFIFO;
+    struct CoalescingBucket
+    {
+        std::list<coalescedReq> reqs;
+        std::unordered_map<Addr, std::list<coalescedReq>::iterator> index;
+    };
+
+    typedef std::map<Tick, CoalescingBucket> CoalescingFIFO;
 
     CoalescingFIFO coalescerFIFO;
 
@@ -129,6 +141,7 @@ class VegaTLBCoalescer : public ClockedObject
     statistics::Formula latency;
 
     bool canCoalesce(PacketPtr pkt1, PacketPtr pkt2);
+    Addr coalescingKey(PacketPtr pkt);
     void updatePhysAddresses(PacketPtr pkt);
     void regStats() override;
 
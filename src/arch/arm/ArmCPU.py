@@ -28,6 +28,8 @@ from m5.objects.ArmInterrupts import ArmInterrupts
 from m5.objects.ArmISA import ArmISA
 from m5.objects.ArmMMU import ArmMMU
 from m5.objects.BaseAtomicSimpleCPU import BaseAtomicSimpleCPU
+from m5.objects.BaseFastForwardCPU import BaseFastForwardCPU
+from m5.objects.BaseIntervalSimpleCPU import BaseIntervalSimpleCPU
 from m5.objects.BaseMinorCPU import BaseMinorCPU
 from m5.objects.BaseNonCachingSimpleCPU import BaseNonCachingSimpleCPU
 from m5.objects.BaseO3Checker import BaseO3Checker
@@ -47,6 +49,14 @@ class ArmAtomicSimpleCPU(BaseAtomicSimpleCPU, ArmCPU):
     mmu = ArmMMU()
 
 
+class ArmFastForwardCPU(BaseFastForwardCPU, ArmCPU):
+    mmu = ArmMMU()
+
+
+class ArmIntervalSimpleCPU(BaseIntervalSimpleCPU, ArmCPU):
+    mmu = ArmMMU()
+
+
 class ArmNonCachingSimpleCPU(BaseNonCachingSimpleCPU, ArmCPU):
     mmu = ArmMMU()
 
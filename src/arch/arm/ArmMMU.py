@@ -55,6 +55,9 @@ class ArmTableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         2, "Number of outstanding walks that can be squashed per cycle"
     )
+    num_walks = Param.Unsigned(
+        1, "Maximum number of table walks in progress (timing mode only)"
+    )
 
     port = RequestPort("Table Walker port")
 
@@ -40,6 +40,8 @@
 
 #include "arch/arm/decoder.hh"
 
+#include <tuple>
+
 #include "arch/arm/isa.hh"
 #include "arch/arm/utility.hh"
 #include "base/cast.hh"
@@ -69,6 +71,12 @@ Decoder::Decoder(const ArmDecoderParams &params)
     smeLen = (safe_cast<ISA *>(params.isa)
             ->getCurSmeVecLenInBitsAtReset() >> 7) - 1;
 
+    // Everything else decoding depends on is part of the ExtMachInst.
+    if (_shareDecodeCache) {
+        defaultCache.share(
+                std::make_tuple(eventQueue(), dvmEnabled, decoderFlavor));
+    }
+
     if (dvmEnabled) {
         warn_once(
             "DVM Ops instructions are micro-architecturally "
@@ -47,6 +47,7 @@
 #include "arch/arm/types.hh"
 #include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
 #include "base/types.hh"
 #include "cpu/static_inst.hh"
 #include "debug/Decode.hh"
@@ -61,7 +62,7 @@ class BaseISA;
 namespace ArmISA
 {
 
-class Decoder : public InstDecoder
+class Decoder GEM5_ISA_FINAL : public InstDecoder
 {
   public: // Public decoder parameters
     /** True if the decoder should emit DVM Ops (treated as Loads) */
@@ -156,6 +157,8 @@ class Decoder : public InstDecoder
     void
     setContext(FPSCR fpscr)
     {
+        if (fpscrLen != fpscr.len || fpscrStride != fpscr.stride)
+            contextChanged();
         fpscrLen = fpscr.len;
         fpscrStride = fpscr.stride;
     }
@@ -163,12 +166,16 @@ class Decoder : public InstDecoder
     void
     setSveLen(uint8_t len)
     {
+        if (sveLen != len)
+            contextChanged();
         sveLen = len;
     }
 
     void
     setSmeLen(uint8_t len)
     {
+        if (smeLen != len)
+            contextChanged();
         smeLen = len;
     }
 };
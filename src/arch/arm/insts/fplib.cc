@@ -41,6 +41,7 @@
 #include <cassert>
 #include <cmath>
 
+#include "base/host_fp.hh"
 #include "base/logging.hh"
 #include "fplib.hh"
 
@@ -1219,6 +1220,63 @@ fp64_compare_un(uint64_t a, uint64_t b, int mode, int *flags)
     return 0;
 }
 
+// Host floating point gives the same results as the code below when
+// rounding to nearest, as long as the operands and the result are normal
+// (see base/host_fp.hh). Anything else falls back to the bit-accurate
+// implementation.
+
+static inline bool
+fp32_host_add(uint32_t a, uint32_t b, int neg, int mode, int *flags,
+              uint32_t *x)
+{
+    bool inexact;
+    if ((mode & 3) != FPLIB_RN ||
+        !hostFpAdd<float>(a, neg ? b ^ 1ULL << (FP32_BITS - 1) : b, *x,
+                          inexact)) {
+        return false;
+    }
+    if (inexact)
+        *flags |= FPLIB_IXC;
+    return true;
+}
+
+static inline bool
+fp64_host_add(uint64_t a, uint64_t b, int neg, int mode, int *flags,
+              uint64_t *x)
+{
+    bool inexact;
+    if ((mode & 3) != FPLIB_RN ||
+        !hostFpAdd<double>(a, neg ? b ^ 1ULL << (FP64_BITS - 1) : b, *x,
+                           inexact)) {
+        return false;
+    }
+    if (inexact)
+        *flags |= FPLIB_IXC;
+    return true;
+}
+
+static inline bool
+fp32_host_mul(uint32_t a, uint32_t b, int mode, int *flags, uint32_t *x)
+{
+    bool inexact;
+    if ((mode & 3) != FPLIB_RN || !hostFpMul<float>(a, b, *x, inexact))
+        return false;
+    if (inexact)
+        *flags |= FPLIB_IXC;
+    return true;
+}
+
+static inline bool
+fp64_host_mul(uint64_t a, uint64_t b, int mode, int *flags, uint64_t *x)
+{
+    bool inexact;
+    if ((mode & 3) != FPLIB_RN || !hostFpMul<double>(a, b, *x, inexact))
+        return false;
+    if (inexact)
+        *flags |= FPLIB_IXC;
+    return true;
+}
+
 static uint16_t
 fp16_add(uint16_t a, uint16_t b, int neg, int mode, int *flags)
 {
@@ -1285,6 +1343,9 @@ fp32_add(uint32_t a, uint32_t b, int neg, int mode, int *flags)
     int a_sgn, a_exp, b_sgn, b_exp, x_sgn, x_exp;
     uint32_t a_mnt, b_mnt, x, x_mnt;
 
+    if (fp32_host_add(a, b, neg, mode, flags, &x))
+        return x;
+
     fp32_unpack(&a_sgn, &a_exp, &a_mnt, a, mode, flags);
     fp32_unpack(&b_sgn, &b_exp, &b_mnt, b, mode, flags);
 
@@ -1345,6 +1406,9 @@ fp64_add(uint64_t a, uint64_t b, int neg, int mode, int *flags)
     int a_sgn, a_exp, b_sgn, b_exp, x_sgn, x_exp;
     uint64_t a_mnt, b_mnt, x, x_mnt;
 
+    if (fp64_host_add(a, b, neg, mode, flags, &x))
+        return x;
+
     fp64_unpack(&a_sgn, &a_exp, &a_mnt, a, mode, flags);
     fp64_unpack(&b_sgn, &b_exp, &b_mnt, b, mode, flags);
 
@@ -1443,6 +1507,9 @@ fp32_mul(uint32_t a, uint32_t b, int mode, int *flags)
     uint32_t a_mnt, b_mnt, x;
     uint64_t x_mnt;
 
+    if (fp32_host_mul(a, b, mode, flags, &x))
+        return x;
+
     fp32_unpack(&a_sgn, &a_exp, &a_mnt, a, mode, flags);
     fp32_unpack(&b_sgn, &b_exp, &b_mnt, b, mode, flags);
 
@@ -1480,6 +1547,9 @@ fp64_mul(uint64_t a, uint64_t b, int mode, int *flags)
     uint64_t a_mnt, b_mnt, x;
     uint64_t x0_mnt, x1_mnt;
 
+    if (fp64_host_mul(a, b, mode, flags, &x))
+        return x;
+
     fp64_unpack(&a_sgn, &a_exp, &a_mnt, a, mode, flags);
     fp64_unpack(&b_sgn, &b_exp, &b_mnt, b, mode, flags);
 
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "arch/arm/insts/fplib.hh"
+
+using namespace gem5;
+using namespace ArmISA;
+
+/*
+ * Additions and multiplications of normal numbers are computed with host
+ * floating point when rounding to nearest. Check them against a fused
+ * multiply-add which cannot take that shortcut: a + b * 1 and -0 + a * b
+ * are rounded once, exactly like a + b and a * b.
+ */
+
+namespace
+{
+
+constexpr uint32_t fp32One = 0x3f800000;
+constexpr uint64_t fp64One = 0x3ff0000000000000ULL;
+constexpr uint32_t fp32NegZero = 0x80000000;
+constexpr uint64_t fp64NegZero = 0x8000000000000000ULL;
+
+// Random numbers are drawn around 1.0 so that most results stay normal,
+// with a few going out of range to exercise the fallback.
+uint32_t
+randomFp32(std::mt19937_64 &rng)
+{
+    uint32_t sign = rng() & 1;
+    uint32_t exp = 127 + (int)(rng() % 161) - 80;
+    uint32_t mnt = rng() & ((1 << 23) - 1);
+    if (rng() % 4 == 0)
+        mnt &= ~((1 << 16) - 1);
+    return sign << 31 | exp << 23 | mnt;
+}
+
+uint64_t
+randomFp64(std::mt19937_64 &rng)
+{
+    uint64_t sign = rng() & 1;
+    uint64_t exp = 1023 + (int)(rng() % 1281) - 640;
+    uint64_t mnt = rng() & ((1ULL << 52) - 1);
+    if (rng() % 4 == 0)
+        mnt &= ~((1ULL << 40) - 1);
+    return sign << 63 | exp << 52 | mnt;
+}
+
+FPSCR
+fpscrWithMode(uint32_t rmode, bool fz)
+{
+    FPSCR fpscr = 0;
+    fpscr.rMode = rmode;
+    fpscr.fz = fz;
+    return fpscr;
+}
+
+} // anonymous namespace
+
+TEST(FplibTest, AddMatchesFusedFp32)
+{
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 100000; i++) {
+        uint32_t a = randomFp32(rng);
+        uint32_t b = randomFp32(rng);
+        for (bool fz : {false, true}) {
+            FPSCR fast = fpscrWithMode(0, fz);
+            FPSCR ref = fpscrWithMode(0, fz);
+            ASSERT_EQ(fplibAdd(a, b, fast), fplibMulAdd(a, b, fp32One, ref))
+                << std::hex << a << " + " << b;
+            ASSERT_EQ((uint32_t)fast, (uint32_t)ref);
+
+            fast = fpscrWithMode(0, fz);
+            ref = fpscrWithMode(0, fz);
+            ASSERT_EQ(fplibSub(a, b, fast),
+                      fplibMulAdd(a, fplibNeg(b), fp32One, ref))
+                << std::hex << a << " - " << b;
+            ASSERT_EQ((uint32_t)fast, (uint32_t)ref);
+        }
+    }
+}
+
+TEST(FplibTest, AddMatchesFusedFp64)
+{
+    std::mt19937_64 rng(2);
+    for (int i = 0; i < 100000; i++) {
+        uint64_t a = randomFp64(rng);
+        uint64_t b = randomFp64(rng);
+        FPSCR fast = fpscrWithMode(0, false);
+        FPSCR ref = fpscrWithMode(0, false);
+        ASSERT_EQ(fplibAdd(a, b, fast), fplibMulAdd(a, b, fp64One, ref))
+            << std::hex << a << " + " << b;
+        ASSERT_EQ((uint32_t)fast, (uint32_t)ref);
+
+        fast = fpscrWithMode(0, false);
+        ref = fpscrWithMode(0, false);
+        ASSERT_EQ(fplibSub(a, b, fast),
+                  fplibMulAdd(a, fplibNeg(b), fp64One, ref))
+            << std::hex << a << " - " << b;
+        ASSERT_EQ((uint32_t)fast, (uint32_t)ref);
+    }
+}
+
+TEST(FplibTest, MulMatchesFusedFp32)
+{
+    std::mt19937_64 rng(3);
+    for (int i = 0; i < 100000; i++) {
+        uint32_t a = randomFp32(rng);
+        uint32_t b = randomFp32(rng);
+        for (bool fz : {false, true}) {
+            FPSCR fast = fpscrWithMode(0, fz);
+            FPSCR ref = fpscrWithMode(0, fz);
+            ASSERT_EQ(fplibMul(a, b, fast),
+                      fplibMulAdd(fp32NegZero, a, b, ref))
+                << std::hex << a << " * " << b;
+            ASSERT_EQ((uint32_t)fast, (uint32_t)ref);
+        }
+    }
+}
+
+TEST(FplibTest, MulMatchesFusedFp64)
+{
+    std::mt19937_64 rng(4);
+    for (int i = 0; i < 100000; i++) {
+        uint64_t a = randomFp64(rng);
+        uint64_t b = randomFp64(rng);
+        FPSCR fast = fpscrWithMode(0, false);
+        FPSCR ref = fpscrWithMode(0, false);
+        ASSERT_EQ(fplibMul(a, b, fast), fplibMulAdd(fp64NegZero, a, b, ref))
+            << std::hex << a << " * " << b;
+        ASSERT_EQ((uint32_t)fast, (uint32_t)ref);
+    }
+}
+
+TEST(FplibTest, InexactFlag)
+{
+    FPSCR fpscr = 0;
+    // 1.0 + 1.0 is exact
+    EXPECT_EQ(fplibAdd<uint32_t>(fp32One, fp32One, fpscr), 0x40000000);
+    EXPECT_EQ(fpscr.ixc, 0);
+
+    // 1.0 + 2^-30 rounds back to 1.0
+    EXPECT_EQ(fplibAdd<uint32_t>(fp32One, 0x30800000, fpscr), fp32One);
+    EXPECT_EQ(fpscr.ixc, 1);
+
+    fpscr = 0;
+    // (1 + 2^-52)^2 needs 105 bits
+    EXPECT_EQ(fplibMul<uint64_t>(fp64One | 1, fp64One | 1, fpscr),
+              fp64One | 2);
+    EXPECT_EQ(fpscr.ixc, 1);
+}
+
+TEST(FplibTest, DirectedRounding)
+{
+    // Only round to nearest uses the host, the other modes must still
+    // round the right way.
+    FPSCR fpscr = fpscrWithMode(1, false);
+    EXPECT_EQ(fplibAdd<uint32_t>(fp32One, 0x30800000, fpscr), fp32One | 1);
+    fpscr = fpscrWithMode(3, false);
+    EXPECT_EQ(fplibAdd<uint32_t>(fp32One | 1, 0xb0800000, fpscr), fp32One);
+}
@@ -52,6 +52,7 @@
 #include "arch/arm/system.hh"
 #include "arch/arm/types.hh"
 #include "arch/arm/utility.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/isa.hh"
 #include "base/random.hh"
 #include "debug/Checkpoint.hh"
@@ -68,7 +69,7 @@ class EventManager;
 
 namespace ArmISA
 {
-    class ISA : public BaseISA
+    class ISA GEM5_ISA_FINAL : public BaseISA
     {
       protected:
         // Parent system
@@ -43,6 +43,7 @@
 
 #include "arch/arm/page_size.hh"
 #include "arch/arm/utility.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/mmu.hh"
 #include "base/memoizer.hh"
 #include "base/statistics.hh"
@@ -61,7 +62,7 @@ struct TlbEntry;
 class TLBIOp;
 class TlbTestInterface;
 
-class MMU : public BaseMMU
+class MMU GEM5_ISA_FINAL : public BaseMMU
 {
   protected:
     using LookupLevel = enums::ArmLookupLevel;
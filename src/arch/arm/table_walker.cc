@@ -36,6 +36,7 @@
  */
 #include "arch/arm/table_walker.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -65,7 +66,8 @@ TableWalker::TableWalker(const Params &p)
       requestorId(p.sys->getRequestorId(this)),
       port(new Port(*this)),
       isStage2(p.is_stage2), tlb(NULL),
-      currState(NULL), pending(false),
+      currState(NULL), respState(nullptr),
+      numActiveWalks(0), maxWalks(p.num_walks),
       numSquashable(p.num_squash_per_cycle),
       release(nullptr),
       stats(this),
@@ -449,14 +451,15 @@ TableWalker::walk(const RequestPtr &_req, ThreadContext *_tc, uint16_t _asid,
         ++stats.walksShortDescriptor;
     }
 
-    if (currState->timing && (pending || pendingQueue.size())) {
+    if (currState->timing &&
+        (numActiveWalks >= maxWalks || pendingQueue.size())) {
         pendingQueue.push_back(currState);
         currState = NULL;
         pendingChange();
         return NoFault;
     } else {
         if (currState->timing) {
-            pending = true;
+            ++numActiveWalks;
             pendingChange();
         }
 
@@ -476,7 +479,7 @@ TableWalker::walk(const RequestPtr &_req, ThreadContext *_tc, uint16_t _asid,
             currState = savedCurrState;
         } else if (currState->timing) {
             if (fault) {
-                pending = false;
+                --numActiveWalks;
                 nextWalk(currState->tc);
                 delete currState;
                 currState = NULL;
@@ -503,6 +506,12 @@ TableWalker::processWalkWrapper()
 {
     assert(!currState);
     assert(pendingQueue.size());
+
+    // All the walk slots are taken; the next walk to complete will
+    // reschedule us
+    if (numActiveWalks >= maxWalks)
+        return;
+
     pendingChange();
     currState = pendingQueue.front();
 
@@ -519,7 +528,7 @@ TableWalker::processWalkWrapper()
     // previous request has been successfully translated.
     if (!currState->transState->squashed() && (!te || te->partial)) {
         // We've got a valid request, lets process it
-        pending = true;
+        ++numActiveWalks;
         pendingQueue.pop_front();
 
         bool long_desc_format = currState->aarch64 || currState->el == EL2 ||
@@ -538,7 +547,7 @@ TableWalker::processWalkWrapper()
         }
 
         if (fault != NoFault) {
-            pending = false;
+            --numActiveWalks;
             nextWalk(currState->tc);
 
             currState->transState->finish(fault, currState->req,
@@ -550,7 +559,12 @@ TableWalker::processWalkWrapper()
             LookupLevel curr_lookup_level = long_desc_format ?
                 currState->longDesc.lookupLevel : LookupLevel::L1;
 
+            ThreadContext *tc = currState->tc;
             stashCurrState(curr_lookup_level);
+
+            // Start the next queued walk if there is a free slot for it
+            if (numActiveWalks < maxWalks)
+                nextWalk(tc);
         }
         return;
     }
@@ -1985,7 +1999,7 @@ TableWalker::doL2Descriptor()
 void
 TableWalker::doL1DescriptorWrapper()
 {
-    currState = stateQueues[LookupLevel::L1].front();
+    currState = respondingState(LookupLevel::L1);
     currState->delayed = false;
     // if there's a stage2 translation object we don't need it any more
     if (currState->stage2Tran) {
@@ -2010,7 +2024,7 @@ TableWalker::doL1DescriptorWrapper()
                                       currState->tc, currState->mode);
         stats.walksShortTerminatedAtLevel[0]++;
 
-        pending = false;
+        --numActiveWalks;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2030,7 +2044,7 @@ TableWalker::doL1DescriptorWrapper()
 
         stats.walksShortTerminatedAtLevel[0]++;
 
-        pending = false;
+        --numActiveWalks;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2047,7 +2061,7 @@ TableWalker::doL1DescriptorWrapper()
 void
 TableWalker::doL2DescriptorWrapper()
 {
-    currState = stateQueues[LookupLevel::L2].front();
+    currState = respondingState(LookupLevel::L2);
     assert(currState->delayed);
     // if there's a stage2 translation object we don't need it any more
     if (currState->stage2Tran) {
@@ -2077,7 +2091,7 @@ TableWalker::doL2DescriptorWrapper()
 
 
     stateQueues[LookupLevel::L2].pop_front();
-    pending = false;
+    --numActiveWalks;
     nextWalk(currState->tc);
 
     currState->req = NULL;
@@ -2115,7 +2129,7 @@ TableWalker::doL3LongDescriptorWrapper()
 void
 TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
 {
-    currState = stateQueues[curr_lookup_level].front();
+    currState = respondingState(curr_lookup_level);
     assert(curr_lookup_level == currState->longDesc.lookupLevel);
     currState->delayed = false;
 
@@ -2136,7 +2150,7 @@ TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
         currState->transState->finish(currState->fault, currState->req,
                                       currState->tc, currState->mode);
 
-        pending = false;
+        --numActiveWalks;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2154,7 +2168,7 @@ TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
 
         stats.walksLongTerminatedAtLevel[(unsigned) curr_lookup_level]++;
 
-        pending = false;
+        --numActiveWalks;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2174,10 +2188,48 @@ TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
 void
 TableWalker::nextWalk(ThreadContext *tc)
 {
-    if (pendingQueue.size())
-        schedule(doProcessEvent, clockEdge(Cycles(1)));
-    else
+    if (pendingQueue.size()) {
+        if (!doProcessEvent.scheduled())
+            schedule(doProcessEvent, clockEdge(Cycles(1)));
+    } else {
         completeDrain();
+    }
+}
+
+TableWalker::WalkerState *
+TableWalker::respondingState(LookupLevel lookup_level)
+{
+    auto &queue = stateQueues[lookup_level];
+    assert(!queue.empty());
+
+    WalkerState *state = respState ? respState : queue.front();
+    respState = nullptr;
+
+    // With concurrent walks the descriptors can come back out of
+    // order. Move the responding walk to the head of its queue so it
+    // can be retired from there.
+    if (state != queue.front()) {
+        auto it = std::find(queue.begin(), queue.end(), state);
+        assert(it != queue.end());
+        queue.erase(it);
+        queue.push_front(state);
+    }
+    return state;
+}
+
+Event *
+TableWalker::walkEvent(Event *event)
+{
+    // A single walk in flight always responds from the head of the
+    // queues; no need to tag the response
+    if (maxWalks == 1)
+        return event;
+
+    WalkerState *state = currState;
+    return new EventFunctionWrapper([this, state, event]{
+        respState = state;
+        event->process();
+    }, name() + ".walkEvent", true);
 }
 
 void
@@ -2200,7 +2252,7 @@ TableWalker::fetchDescriptor(Addr desc_addr,
 
         if (currState->timing) {
             auto *tran = new
-                Stage2Walk(*this, data, event, currState->vaddr,
+                Stage2Walk(*this, data, walkEvent(event), currState->vaddr,
                     currState->mode, currState->tranType);
             currState->stage2Tran = tran;
             readDataTimed(currState->tc, desc_addr, tran, num_bytes, flags);
@@ -2239,7 +2291,7 @@ TableWalker::fetchDescriptor(Addr desc_addr,
 
         if (currState->timing) {
             port->sendTimingReq(req, data,
-                currState->tc->getCpuPtr()->clockPeriod(), event);
+                currState->tc->getCpuPtr()->clockPeriod(), walkEvent(event));
 
         } else if (!currState->functional) {
             port->sendAtomicReq(req, data,
@@ -2555,8 +2607,13 @@ TableWalker::Stage2Walk::finish(const Fault &_fault,
             tc->getCpuPtr()->clockPeriod(), event);
     } else {
         // We can't do the DMA access as there's been a problem, so tell the
-        // event we're done
-        event->process();
+        // event we're done. Events tagged with their walk can only run
+        // once the walk has been stashed, so defer them to the end of
+        // the tick.
+        if (event->isAutoDelete())
+            parent.schedule(event, curTick());
+        else
+            event->process();
     }
 }
 
@@ -1095,8 +1095,14 @@ class TableWalker : public ClockedObject
 
     WalkerState *currState;
 
-    /** If a timing translation is currently in progress */
-    bool pending;
+    /** Timing mode: the walk whose descriptor has just been returned */
+    WalkerState *respState;
+
+    /** Number of timing walks currently in progress */
+    unsigned numActiveWalks;
+
+    /** Maximum number of timing walks in progress at any time */
+    const unsigned maxWalks;
 
     /** The number of walks belonging to squashed instructions that can be
      * removed from the pendingQueue per cycle. */
@@ -1235,6 +1241,19 @@ class TableWalker : public ClockedObject
 
     void nextWalk(ThreadContext *tc);
 
+    /**
+     * Timing mode: returns the walk a descriptor response at the given
+     * lookup level belongs to, moving it to the head of its queue.
+     */
+    WalkerState *respondingState(LookupLevel lookup_level);
+
+    /**
+     * Timing mode: wraps a descriptor event in a one-shot event
+     * remembering the current walk, so responses of concurrent walks
+     * can be matched to their state whatever order they return in.
+     */
+    Event *walkEvent(Event *event);
+
     void pendingChange();
 
     /** Timing mode: saves the currState into the stateQueues */
@@ -34,3 +34,8 @@ class InstDecoder(SimObject):
     cxx_class = "gem5::InstDecoder"
 
     isa = Param.BaseISA(NULL, "ISA object for this context")
+    share_decode_cache = Param.Bool(
+        False,
+        "Share decoded instructions with the other decoders of the same "
+        "kind running on the same event queue",
+    )
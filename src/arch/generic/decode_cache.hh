@@ -43,7 +43,8 @@ template <typename Decoder, typename EMI>
 class BasicDecodeCache
 {
   private:
-    decode_cache::InstMap<EMI> instMap;
+    decode_cache::InstMap<EMI> localInstMap;
+    decode_cache::InstMap<EMI> *instMap = &localInstMap;
     struct AddrMapEntry
     {
         StaticInstPtr inst;
@@ -52,6 +53,20 @@ class BasicDecodeCache
     decode_cache::AddrMap<AddrMapEntry> decodePages;
 
   public:
+    /**
+     * Look decoded instructions up in the map shared by the decode
+     * caches using the same key, see decode_cache::sharedInstMap(). The
+     * pages of recently decoded instructions stay private.
+     *
+     * @param key The key identifying the shared map.
+     */
+    template <typename Key>
+    void
+    share(const Key &key)
+    {
+        instMap = &decode_cache::sharedInstMap<EMI>(key);
+    }
+
     /// Decode a machine instruction.
     /// @param mach_inst The binary instruction to decode.
     /// @retval A pointer to the corresponding StaticInst object.
@@ -64,14 +79,14 @@ class BasicDecodeCache
 
         entry.machInst = mach_inst;
 
-        auto iter = instMap.find(mach_inst);
-        if (iter != instMap.end()) {
+        auto iter = instMap->find(mach_inst);
+        if (iter != instMap->end()) {
             entry.inst = iter->second;
             return entry.inst;
         }
 
         entry.inst = decoder->decodeInst(mach_inst);
-        instMap[mach_inst] = entry.inst;
+        (*instMap)[mach_inst] = entry.inst;
         return entry.inst;
     }
 };
@@ -49,12 +49,29 @@ class InstDecoder : public SimObject
     bool instDone = false;
     bool outOfBytes = true;
 
+    /**
+     * Whether decoded instructions should be kept in a decode cache
+     * shared with the other decoders of the same kind, when the ISA
+     * supports it.
+     */
+    const bool _shareDecodeCache;
+
+    /**
+     * Generation of the decoding context. It changes whenever state
+     * other than the PC state that affects how instructions decode,
+     * e.g. an operating mode, is updated.
+     */
+    uint64_t _contextGeneration = 0;
+
+    void contextChanged() { ++_contextGeneration; }
+
   public:
     template <typename MoreBytesType>
     InstDecoder(const InstDecoderParams &params, MoreBytesType *mb_buf) :
         SimObject(params), _moreBytesPtr(mb_buf),
         _moreBytesSize(sizeof(MoreBytesType)),
-        _pcMask(~mask(floorLog2(_moreBytesSize)))
+        _pcMask(~mask(floorLog2(_moreBytesSize))),
+        _shareDecodeCache(params.share_decode_cache)
     {}
 
     virtual StaticInstPtr fetchRomMicroop(
@@ -90,6 +107,7 @@ class InstDecoder : public SimObject
     {
         instDone = old->instDone;
         outOfBytes = old->outOfBytes;
+        contextChanged();
     }
 
     void *moreBytesPtr() const { return _moreBytesPtr; }
@@ -115,6 +133,15 @@ class InstDecoder : public SimObject
      */
     bool needMoreBytes() const { return outOfBytes; }
 
+    /**
+     * Get the generation of the decoding context.
+     *
+     * The same bytes at the same PC state decode to the same
+     * instruction for as long as the generation stays the same, which
+     * lets CPU models reuse decoded instructions safely.
+     */
+    uint64_t contextGeneration() const { return _contextGeneration; }
+
     /**
      * Feed data to the decoder.
      *
@@ -81,6 +81,13 @@ class BaseISA : public SimObject
     virtual void setMiscRegNoEffect(RegIndex idx, RegVal val) = 0;
     virtual void setMiscReg(RegIndex idx, RegVal val) = 0;
 
+    /**
+     * Whether a misc register index can be read and written without
+     * effect, e.g., to save and restore the state of a thread. Some
+     * ISAs leave holes in their misc register indices.
+     */
+    virtual bool isValidMiscReg(RegIndex idx) const { return true; }
+
     virtual void takeOverFrom(ThreadContext *new_tc, ThreadContext *old_tc) {}
     virtual void setThreadContext(ThreadContext *_tc) { tc = _tc; }
 
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * The concrete types of the ISA objects of a thread, for builds of a
+ * single ISA which devirtualize the calls into it (DEVIRTUALIZE_ISA).
+ * Other builds use the base types, so code going through bindIsa() works
+ * the same way in all of them:
+ *
+ *     bindIsa(isa)->readMiscReg(idx);
+ *
+ * is a direct call to the one ISA's readMiscReg() when devirtualizing,
+ * and the usual virtual call otherwise.
+ */
+
+#ifndef __ARCH_GENERIC_ISA_BINDING_HH__
+#define __ARCH_GENERIC_ISA_BINDING_HH__
+
+#include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
+#include "arch/generic/isa.hh"
+#include "arch/generic/mmu.hh"
+
+#if DEVIRTUALIZE_ISA
+
+#include "config/use_arm_isa.hh"
+#include "config/use_mips_isa.hh"
+#include "config/use_power_isa.hh"
+#include "config/use_riscv_isa.hh"
+#include "config/use_sparc_isa.hh"
+#include "config/use_x86_isa.hh"
+
+#if USE_ARM_ISA
+#include "arch/arm/decoder.hh"
+#include "arch/arm/isa.hh"
+#include "arch/arm/mmu.hh"
+#define GEM5_BOUND_ISA ArmISA
+#elif USE_MIPS_ISA
+#include "arch/mips/decoder.hh"
+#include "arch/mips/isa.hh"
+#include "arch/mips/mmu.hh"
+#define GEM5_BOUND_ISA MipsISA
+#elif USE_POWER_ISA
+#include "arch/power/decoder.hh"
+#include "arch/power/isa.hh"
+#include "arch/power/mmu.hh"
+#define GEM5_BOUND_ISA PowerISA
+#elif USE_RISCV_ISA
+#include "arch/riscv/decoder.hh"
+#include "arch/riscv/isa.hh"
+#include "arch/riscv/mmu.hh"
+#define GEM5_BOUND_ISA RiscvISA
+#elif USE_SPARC_ISA
+#include "arch/sparc/decoder.hh"
+#include "arch/sparc/isa.hh"
+#include "arch/sparc/mmu.hh"
+#define GEM5_BOUND_ISA SparcISA
+#elif USE_X86_ISA
+#include "arch/x86/decoder.hh"
+#include "arch/x86/isa.hh"
+#include "arch/x86/mmu.hh"
+#define GEM5_BOUND_ISA X86ISA
+#else
+#error "DEVIRTUALIZE_ISA needs exactly one ISA"
+#endif
+
+#endif // DEVIRTUALIZE_ISA
+
+namespace gem5
+{
+
+namespace bound_isa
+{
+
+#if DEVIRTUALIZE_ISA
+using ISA = GEM5_BOUND_ISA::ISA;
+using Decoder = GEM5_BOUND_ISA::Decoder;
+using MMU = GEM5_BOUND_ISA::MMU;
+#else
+using ISA = BaseISA;
+using Decoder = InstDecoder;
+using MMU = BaseMMU;
+#endif
+
+} // namespace bound_isa
+
+/**
+ * Get the concrete type of an ISA object. The object has to belong to
+ * the ISA which was built, which all objects of a thread in a single ISA
+ * build do.
+ */
+inline bound_isa::ISA *
+bindIsa(BaseISA *isa)
+{
+    return static_cast<bound_isa::ISA *>(isa);
+}
+
+inline bound_isa::Decoder *
+bindIsa(InstDecoder *decoder)
+{
+    return static_cast<bound_isa::Decoder *>(decoder);
+}
+
+inline bound_isa::MMU *
+bindIsa(BaseMMU *mmu)
+{
+    return static_cast<bound_isa::MMU *>(mmu);
+}
+
+} // namespace gem5
+
+#undef GEM5_BOUND_ISA
+
+#endif // __ARCH_GENERIC_ISA_BINDING_HH__
@@ -80,6 +80,8 @@ BaseMMU::init()
 void
 BaseMMU::flushAll()
 {
+    translationsChanged();
+
     for (auto tlb : instruction) {
         tlb->flushAll();
     }
@@ -103,6 +105,7 @@ BaseMMU::reset()
 void
 BaseMMU::demapPage(Addr vaddr, uint64_t asn)
 {
+    translationsChanged();
     itb->demapPage(vaddr, asn);
     dtb->demapPage(vaddr, asn);
 }
@@ -184,6 +187,7 @@ BaseMMU::takeOverFrom(BaseMMU *old_mmu)
 
     itb->takeOverFrom(old_mmu->itb);
     dtb->takeOverFrom(old_mmu->dtb);
+    translationsChanged();
 }
 
 } // namespace gem5
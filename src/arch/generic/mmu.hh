@@ -158,6 +158,15 @@ class BaseMMU : public SimObject
 
     virtual void takeOverFrom(BaseMMU *old_mmu);
 
+    /**
+     * Get the generation of the translations.
+     *
+     * The generation changes whenever TLB entries are invalidated
+     * through the MMU, which lets CPU models keep translations of their
+     * own for as long as it stays the same.
+     */
+    uint64_t translationGeneration() const { return _translationGeneration; }
+
   public:
     BaseTLB* dtb;
     BaseTLB* itb;
@@ -186,6 +195,10 @@ class BaseMMU : public SimObject
     std::set<BaseTLB*> data;
     std::set<BaseTLB*> unified;
 
+    uint64_t _translationGeneration = 0;
+
+    void translationsChanged() { ++_translationGeneration; }
+
 };
 
 } // namespace gem5
@@ -122,6 +122,9 @@ class BaseTLB : public SimObject
 
     void memInvalidate() { flushAll(); }
 
+    /** The entries are refilled from the page tables. */
+    bool hasArchitecturalState() const override { return false; }
+
     TypeTLB type() const { return _type; }
 
     BaseTLB* nextLevel() const { return _nextLevel; }
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_TLB_SETS_HH__
+#define __ARCH_GENERIC_TLB_SETS_HH__
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Set associative index over the entries of a TLB, for TLBs that match
+ * entries against a single key the way a Trie does. The key is built by
+ * the ISA, e.g., from a page number and an address space id, and an entry
+ * matches every key that is equal to its own key except for its `shift`
+ * low bits, which depend on the size of the page it maps.
+ *
+ * The set of an entry is selected by the key bits right above its shift,
+ * so a lookup probes one set per page size that is in use. The tags of a
+ * set are packed next to each other, apart from the entries, so probing a
+ * set does not touch the entries. Replacement is LRU within a set, based
+ * on the lruSeq field of the entries.
+ *
+ * The entries themselves are owned by the TLB, and way w of set s is entry
+ * s * assoc + w.
+ */
+template <class Entry>
+class TlbSets
+{
+  private:
+    static constexpr uint8_t invalidShift = 0xff;
+
+    Entry *const entries;
+    const size_t assoc;
+    const size_t numSets;
+
+    /** Masked key of every way. */
+    std::vector<Addr> tags;
+    /** Shift of the entry in every way, invalidShift if there is none. */
+    std::vector<uint8_t> shifts;
+
+    /** Valid entries per shift, and a mask of the shifts in use. */
+    std::array<unsigned, 64> shiftCount{};
+    uint64_t shiftsInUse = 0;
+
+    size_t numValid = 0;
+
+    size_t
+    firstWay(Addr key, unsigned shift) const
+    {
+        return ((key >> shift) & (numSets - 1)) * assoc;
+    }
+
+    size_t index(const Entry *entry) const { return entry - entries; }
+
+  public:
+    /**
+     * @param entries The entries of the TLB.
+     * @param num_entries Number of entries, a power of two multiple of
+     *        the associativity.
+     * @param assoc The associativity.
+     */
+    TlbSets(Entry *entries, size_t num_entries, size_t assoc)
+        : entries(entries), assoc(assoc),
+          numSets(assoc ? num_entries / assoc : 0),
+          tags(num_entries, 0), shifts(num_entries, invalidShift)
+    {
+        fatal_if(!assoc || num_entries % assoc,
+                 "The size of a TLB must be a multiple of its "
+                 "associativity.");
+        fatal_if(!isPowerOf2(numSets),
+                 "The number of sets of a TLB must be a power of two.");
+    }
+
+    /**
+     * Find the entry that maps a key.
+     *
+     * @return The entry or nullptr if no valid entry matches.
+     */
+    Entry *
+    lookup(Addr key) const
+    {
+        for (uint64_t in_use = shiftsInUse; in_use; in_use &= in_use - 1) {
+            const unsigned shift = findLsbSet(in_use);
+            const Addr tag = key & ~mask(shift);
+            const size_t first = firstWay(key, shift);
+            for (size_t way = first; way < first + assoc; way++) {
+                if (tags[way] == tag && shifts[way] == shift)
+                    return &entries[way];
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Find the way to place a new entry in: a free way of its set if there
+     * is one, the least recently used one otherwise. The victim is not
+     * removed.
+     */
+    Entry *
+    findVictim(Addr key, unsigned shift) const
+    {
+        const size_t first = firstWay(key, shift);
+        Entry *victim = &entries[first];
+        for (size_t way = first; way < first + assoc; way++) {
+            if (shifts[way] == invalidShift)
+                return &entries[way];
+            if (entries[way].lruSeq < victim->lruSeq)
+                victim = &entries[way];
+        }
+        return victim;
+    }
+
+    bool
+    isValid(const Entry *entry) const
+    {
+        return shifts[index(entry)] != invalidShift;
+    }
+
+    /**
+     * Make an entry map a key. The entry must be free and be one of the
+     * ways of the key, e.g., as returned by findVictim.
+     */
+    void
+    insert(Entry *entry, Addr key, unsigned shift)
+    {
+        const size_t idx = index(entry);
+        assert(shift < 64);
+        assert(!isValid(entry));
+        assert(idx / assoc == firstWay(key, shift) / assoc);
+
+        tags[idx] = key & ~mask(shift);
+        shifts[idx] = shift;
+        if (shiftCount[shift]++ == 0)
+            shiftsInUse |= 1ULL << shift;
+        numValid++;
+    }
+
+    void
+    remove(Entry *entry)
+    {
+        const size_t idx = index(entry);
+        assert(isValid(entry));
+
+        const unsigned shift = shifts[idx];
+        shifts[idx] = invalidShift;
+        if (--shiftCount[shift] == 0)
+            shiftsInUse &= ~(1ULL << shift);
+        numValid--;
+    }
+
+    /** Number of valid entries. */
+    size_t size() const { return numValid; }
+};
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_TLB_SETS_HH__
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "arch/generic/tlb_sets.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+struct TestEntry
+{
+    uint64_t lruSeq = 0;
+};
+
+} // anonymous namespace
+
+TEST(TlbSets, Empty)
+{
+    std::vector<TestEntry> entries(16);
+    TlbSets<TestEntry> sets(entries.data(), entries.size(), 4);
+
+    ASSERT_EQ(0, sets.size());
+    ASSERT_EQ(nullptr, sets.lookup(0));
+    ASSERT_EQ(nullptr, sets.lookup(0x1234));
+}
+
+TEST(TlbSets, MatchesPage)
+{
+    std::vector<TestEntry> entries(16);
+    TlbSets<TestEntry> sets(entries.data(), entries.size(), 4);
+
+    TestEntry *small = sets.findVictim(0x1000, 12);
+    sets.insert(small, 0x1000, 12);
+    TestEntry *large = sets.findVictim(0x200000, 21);
+    sets.insert(large, 0x200000, 21);
+    ASSERT_EQ(2, sets.size());
+
+    ASSERT_EQ(small, sets.lookup(0x1000));
+    ASSERT_EQ(small, sets.lookup(0x1fff));
+    ASSERT_EQ(nullptr, sets.lookup(0x2000));
+    ASSERT_EQ(large, sets.lookup(0x200000));
+    ASSERT_EQ(large, sets.lookup(0x3fffff));
+    ASSERT_EQ(nullptr, sets.lookup(0x400000));
+}
+
+TEST(TlbSets, ExactKeys)
+{
+    std::vector<TestEntry> entries(8);
+    TlbSets<TestEntry> sets(entries.data(), entries.size(), 2);
+
+    for (Addr key = 0; key < 8; key++) {
+        TestEntry *entry = sets.findVictim(key, 0);
+        ASSERT_FALSE(sets.isValid(entry));
+        sets.insert(entry, key, 0);
+    }
+    ASSERT_EQ(8, sets.size());
+
+    for (Addr key = 0; key < 8; key++)
+        ASSERT_NE(nullptr, sets.lookup(key));
+    ASSERT_EQ(nullptr, sets.lookup(8));
+}
+
+TEST(TlbSets, ReplacesLRU)
+{
+    std::vector<TestEntry> entries(4);
+    TlbSets<TestEntry> sets(entries.data(), entries.size(), 2);
+
+    // Keys 0, 2 and 4 all go in the first set
+    TestEntry *first = sets.findVictim(0, 0);
+    sets.insert(first, 0, 0);
+    first->lruSeq = 2;
+    TestEntry *second = sets.findVictim(2, 0);
+    ASSERT_NE(first, second);
+    sets.insert(second, 2, 0);
+    second->lruSeq = 1;
+
+    TestEntry *victim = sets.findVictim(4, 0);
+    ASSERT_EQ(second, victim);
+    ASSERT_TRUE(sets.isValid(victim));
+
+    sets.remove(victim);
+    ASSERT_EQ(nullptr, sets.lookup(2));
+    sets.insert(victim, 4, 0);
+    ASSERT_EQ(victim, sets.lookup(4));
+    ASSERT_EQ(first, sets.lookup(0));
+}
+
+TEST(TlbSets, Remove)
+{
+    std::vector<TestEntry> entries(4);
+    TlbSets<TestEntry> sets(entries.data(), entries.size(), 4);
+
+    TestEntry *entry = sets.findVictim(0x40000000, 30);
+    sets.insert(entry, 0x40000000, 30);
+    ASSERT_EQ(entry, sets.lookup(0x7fffffff));
+
+    sets.remove(entry);
+    ASSERT_FALSE(sets.isValid(entry));
+    ASSERT_EQ(0, sets.size());
+    ASSERT_EQ(nullptr, sets.lookup(0x40000000));
+}
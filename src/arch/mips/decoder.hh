@@ -31,6 +31,7 @@
 
 #include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/mips/types.hh"
 #include "base/logging.hh"
 #include "base/types.hh"
@@ -46,7 +47,7 @@ class BaseISA;
 namespace MipsISA
 {
 
-class Decoder : public InstDecoder
+class Decoder GEM5_ISA_FINAL : public InstDecoder
 {
   protected:
     //The extended machine instruction being generated
@@ -33,6 +33,7 @@
 #include <string>
 #include <vector>
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/isa.hh"
 #include "arch/mips/pcstate.hh"
 #include "arch/mips/regs/misc.hh"
@@ -52,7 +53,7 @@ class ThreadContext;
 
 namespace MipsISA
 {
-    class ISA : public BaseISA
+    class ISA GEM5_ISA_FINAL : public BaseISA
     {
       public:
         // The MIPS name for this file is CP0 or Coprocessor 0
@@ -38,6 +38,7 @@
 #ifndef __ARCH_MIPS_MMU_HH__
 #define __ARCH_MIPS_MMU_HH__
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/mmu.hh"
 #include "arch/mips/page_size.hh"
 #include "params/MipsMMU.hh"
@@ -47,7 +48,7 @@ namespace gem5
 
 namespace MipsISA {
 
-class MMU : public BaseMMU
+class MMU GEM5_ISA_FINAL : public BaseMMU
 {
   public:
     MMU(const MipsMMUParams &p)
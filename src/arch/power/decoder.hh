@@ -32,6 +32,7 @@
 
 #include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/power/types.hh"
 #include "cpu/static_inst.hh"
 #include "debug/Decode.hh"
@@ -45,7 +46,7 @@ class BaseISA;
 namespace PowerISA
 {
 
-class Decoder : public InstDecoder
+class Decoder GEM5_ISA_FINAL : public InstDecoder
 {
   protected:
     // The extended machine instruction being generated
@@ -31,6 +31,7 @@
 #ifndef __ARCH_POWER_ISA_HH__
 #define __ARCH_POWER_ISA_HH__
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/isa.hh"
 #include "arch/power/pcstate.hh"
 #include "arch/power/regs/misc.hh"
@@ -50,7 +51,7 @@ class EventManager;
 namespace PowerISA
 {
 
-class ISA : public BaseISA
+class ISA GEM5_ISA_FINAL : public BaseISA
 {
   protected:
     RegVal miscRegs[NUM_MISCREGS];
@@ -38,6 +38,7 @@
 #ifndef __ARCH_POWER_MMU_HH__
 #define __ARCH_POWER_MMU_HH__
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/mmu.hh"
 #include "arch/power/page_size.hh"
 #include "params/PowerMMU.hh"
@@ -47,7 +48,7 @@ namespace gem5
 
 namespace PowerISA {
 
-class MMU : public BaseMMU
+class MMU GEM5_ISA_FINAL : public BaseMMU
 {
   public:
     MMU(const PowerMMUParams &p)
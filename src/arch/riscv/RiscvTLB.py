@@ -55,6 +55,9 @@ class RiscvTLB(BaseTLB):
     cxx_header = "arch/riscv/tlb.hh"
 
     size = Param.Int(64, "TLB size")
+    assoc = Param.Int(
+        Self.size, "Associativity of the TLB. Fully associative by default"
+    )
     walker = Param.RiscvPagetableWalker(
         RiscvPagetableWalker(), "page table walker"
     )
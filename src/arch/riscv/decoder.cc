@@ -28,6 +28,10 @@
  */
 
 #include "arch/riscv/decoder.hh"
+
+#include <tuple>
+#include <typeindex>
+
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/types.hh"
 #include "base/bitfield.hh"
@@ -48,6 +52,19 @@ Decoder::Decoder(const RiscvDecoderParams &p) : InstDecoder(p, &machInst)
     reset();
 }
 
+void
+Decoder::init()
+{
+    InstDecoder::init();
+
+    // Subclasses can decode differently, so the dynamic type is part of
+    // the key, which is why this can't be done in the constructor.
+    if (_shareDecodeCache) {
+        instMap = &decode_cache::sharedInstMap<ExtMachInst>(std::make_tuple(
+                std::type_index(typeid(*this)), eventQueue(), vlen, elen));
+    }
+}
+
 void Decoder::reset()
 {
     aligned = true;
@@ -96,7 +113,7 @@ Decoder::decode(ExtMachInst mach_inst, Addr addr)
     DPRINTF(Decode, "Decoding instruction 0x%08x at address %#x\n",
             mach_inst.instBits, addr);
 
-    StaticInstPtr &si = instMap[mach_inst];
+    StaticInstPtr &si = (*instMap)[mach_inst];
     if (!si)
         si = decodeInst(mach_inst);
 
@@ -32,6 +32,7 @@
 
 #include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/riscv/insts/vector.hh"
 #include "arch/riscv/types.hh"
 #include "base/logging.hh"
@@ -48,10 +49,11 @@ class BaseISA;
 namespace RiscvISA
 {
 
-class Decoder : public InstDecoder
+class Decoder GEM5_ISA_FINAL : public InstDecoder
 {
   private:
-    decode_cache::InstMap<ExtMachInst> instMap;
+    decode_cache::InstMap<ExtMachInst> localInstMap;
+    decode_cache::InstMap<ExtMachInst> *instMap = &localInstMap;
     bool aligned;
     bool mid;
 
@@ -74,6 +76,8 @@ class Decoder : public InstDecoder
   public:
     Decoder(const RiscvDecoderParams &p);
 
+    void init() override;
+
     void reset() override;
 
     inline bool compressed(ExtMachInst inst) { return inst.quadRant < 0x3; }
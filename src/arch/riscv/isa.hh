@@ -38,6 +38,7 @@
 #include <unordered_map>
 #include <vector>
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/isa.hh"
 #include "arch/riscv/pcstate.hh"
 #include "arch/riscv/regs/misc.hh"
@@ -70,7 +71,7 @@ enum FPUStatus
 
 using VPUStatus = FPUStatus;
 
-class ISA : public BaseISA
+class ISA GEM5_ISA_FINAL : public BaseISA
 {
   protected:
     RiscvType _rvType;
@@ -133,6 +134,14 @@ class ISA : public BaseISA
     void setMiscRegNoEffect(RegIndex idx, RegVal val) override;
     void setMiscReg(RegIndex idx, RegVal val) override;
 
+    // The registers past the physical ones only exist for their
+    // side effects.
+    bool
+    isValidMiscReg(RegIndex idx) const override
+    {
+        return idx < NUM_PHYS_MISCREGS;
+    }
+
     // Derived class could provide knowledge of non-standard CSRs to other
     // components by overriding the two getCSRxxxMap here and properly
     // implementing the corresponding read/set function. However, customized
@@ -38,6 +38,7 @@
 #ifndef __ARCH_RISCV_MMU_HH__
 #define __ARCH_RISCV_MMU_HH__
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/mmu.hh"
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/page_size.hh"
@@ -52,7 +53,7 @@ namespace gem5
 
 namespace RiscvISA {
 
-class MMU : public BaseMMU
+class MMU GEM5_ISA_FINAL : public BaseMMU
 {
   public:
     BasePMAChecker *pma;
@@ -37,6 +37,8 @@
 
 #include "arch/riscv/pma_checker.hh"
 
+#include <algorithm>
+
 #include "arch/riscv/faults.hh"
 #include "arch/riscv/mmu.hh"
 #include "base/addr_range.hh"
@@ -54,7 +56,8 @@ namespace RiscvISA
 
 PMAChecker::PMAChecker(const Params &params) :
 BasePMAChecker(params),
-uncacheable(params.uncacheable.begin(), params.uncacheable.end())
+uncacheable(params.uncacheable.begin(), params.uncacheable.end()),
+pageCache(PageCacheSize)
 {
     for (auto& range: params.misaligned) {
         misaligned.insert(range, true);
@@ -107,10 +110,46 @@ PMAChecker::isUncacheable(const AddrRange &range)
 bool
 PMAChecker::isUncacheable(const Addr &addr, const unsigned size)
 {
+    bool page_uncacheable;
+    if (isUncacheablePage(addr, size, page_uncacheable))
+        return page_uncacheable;
+
     AddrRange range(addr, addr + size);
     return isUncacheable(range);
 }
 
+bool
+PMAChecker::isUncacheablePage(Addr addr, unsigned size, bool &is_uncacheable)
+{
+    const Addr page = addr >> PageShift;
+    if (size == 0 || ((addr + size - 1) >> PageShift) != page)
+        return false;
+
+    PageAttrs &entry = pageCache[page % PageCacheSize];
+    if (entry.page != page) {
+        // accesses within the page are all uncacheable if the page is,
+        // and none of them are if it doesn't overlap any range
+        const AddrRange page_range(page << PageShift,
+                                   (page + 1) << PageShift);
+        bool page_uncacheable = false;
+        bool overlaps = false;
+        for (auto const &uncacheable_range: uncacheable) {
+            if (page_range.isSubset(uncacheable_range)) {
+                page_uncacheable = true;
+                break;
+            }
+            overlaps |= page_range.intersects(uncacheable_range);
+        }
+        if (!page_uncacheable && overlaps)
+            return false;
+        entry.page = page;
+        entry.uncacheable = page_uncacheable;
+    }
+
+    is_uncacheable = entry.uncacheable;
+    return true;
+}
+
 bool
 PMAChecker::isUncacheable(PacketPtr pkt)
 {
@@ -124,6 +163,7 @@ PMAChecker::takeOverFrom(BasePMAChecker *old)
     assert(derived_old != nullptr);
     uncacheable = derived_old->uncacheable;
     misaligned = derived_old->misaligned;
+    std::fill(pageCache.begin(), pageCache.end(), PageAttrs());
 }
 
 Fault
@@ -38,6 +38,8 @@
 #ifndef __ARCH_RISCV_PMA_CHECKER_HH__
 #define __ARCH_RISCV_PMA_CHECKER_HH__
 
+#include <vector>
+
 #include "arch/generic/mmu.hh"
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
@@ -133,7 +135,30 @@ class PMAChecker : public BasePMAChecker
     inline bool hasMisaligned();
 
     AddrRangeList uncacheable;
-    AddrRangeMap<bool, 3> misaligned;
+    AddrRangeMap<bool> misaligned;
+
+    /**
+     * Whether recently checked pages are uncacheable. Pages which are
+     * partly uncacheable aren't cached, as the answer depends on the
+     * access. Flushed when the uncacheable ranges change.
+     */
+    struct PageAttrs
+    {
+        Addr page = MaxAddr;
+        bool uncacheable = false;
+    };
+
+    static constexpr int PageShift = 12;
+    static constexpr size_t PageCacheSize = 256;
+    std::vector<PageAttrs> pageCache;
+
+    /**
+     * Check if an access is uncacheable from the page cache, filling it
+     * on a miss.
+     * @return whether the page is cached, in which case is_uncacheable
+     * is set as isUncacheable() would.
+     */
+    bool isUncacheablePage(Addr addr, unsigned size, bool &is_uncacheable);
 };
 
 } // namespace RiscvISA
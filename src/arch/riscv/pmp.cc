@@ -28,6 +28,9 @@
  */
 
 #include "arch/riscv/pmp.hh"
+
+#include <algorithm>
+
 #include "arch/generic/tlb.hh"
 #include "arch/riscv/faults.hh"
 #include "arch/riscv/isa.hh"
@@ -54,6 +57,67 @@ PMP::PMP(const Params &params) :
     hasLockEntry(false)
 {
     pmpTable.resize(pmpEntries);
+    pageCache.resize(PageCacheSize);
+}
+
+int
+PMP::pmpMatch(Addr paddr, unsigned size)
+{
+    // all pmp entries need to be looked from the lowest to
+    // the highest number
+    for (int i = 0; i < pmpTable.size(); i++) {
+        AddrRange pmp_range = pmpTable[i].pmpAddr;
+        // according to specs address is only matched,
+        // when (addr) and (addr + request_size - 1) are both
+        // within the pmp range
+        if (pmp_range.contains(paddr) &&
+                pmp_range.contains(paddr + size - 1) &&
+                PMP_OFF != pmpGetAField(pmpTable[i].pmpCfg)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool
+PMP::pmpMatchPage(Addr paddr, unsigned size, int &match_index)
+{
+    const Addr page = paddr >> PageShift;
+    if (size == 0 || ((paddr + size - 1) >> PageShift) != page)
+        return false;
+
+    PageMatch &entry = pageCache[page % PageCacheSize];
+    if (entry.page == page) {
+        match_index = entry.index;
+        return true;
+    }
+
+    // The first entry which overlaps the page decides all the accesses
+    // within it if it covers the whole page, and none does if no entry
+    // overlaps it.
+    const AddrRange page_range(page << PageShift, (page + 1) << PageShift);
+    int index = -1;
+    for (int i = 0; i < pmpTable.size(); i++) {
+        if (PMP_OFF == pmpGetAField(pmpTable[i].pmpCfg) ||
+                !pmpTable[i].pmpAddr.intersects(page_range)) {
+            continue;
+        }
+        if (!page_range.isSubset(pmpTable[i].pmpAddr))
+            return false;
+        index = i;
+        break;
+    }
+
+    entry.page = page;
+    entry.index = index;
+    match_index = index;
+    return true;
+}
+
+void
+PMP::flushPageCache()
+{
+    std::fill(pageCache.begin(), pageCache.end(), PageMatch());
 }
 
 Fault
@@ -76,41 +140,29 @@ PMP::pmpCheck(const RequestPtr &req, BaseMMU::Mode mode,
     // match_index will be used to identify the pmp entry
     // which matched for the given address
     int match_index = -1;
-
-    // all pmp entries need to be looked from the lowest to
-    // the highest number
-    for (int i = 0; i < pmpTable.size(); i++) {
-        AddrRange pmp_range = pmpTable[i].pmpAddr;
-        if (pmp_range.contains(req->getPaddr()) &&
-                pmp_range.contains(req->getPaddr() + req->getSize() - 1)) {
-            // according to specs address is only matched,
-            // when (addr) and (addr + request_size - 1) are both
-            // within the pmp range
-            match_index = i;
-        }
-
-        if ((match_index > -1)
-            && (PMP_OFF != pmpGetAField(pmpTable[match_index].pmpCfg))) {
-            uint8_t this_cfg = pmpTable[match_index].pmpCfg;
-
-            if ((pmode == PrivilegeMode::PRV_M) &&
-                                    (PMP_LOCK & this_cfg) == 0) {
-                return NoFault;
-            } else if ((mode == BaseMMU::Mode::Read) &&
-                                        (PMP_READ & this_cfg)) {
-                return NoFault;
-            } else if ((mode == BaseMMU::Mode::Write) &&
-                                        (PMP_WRITE & this_cfg)) {
-                return NoFault;
-            } else if ((mode == BaseMMU::Mode::Execute) &&
-                                        (PMP_EXEC & this_cfg)) {
-                return NoFault;
+    if (!pmpMatchPage(req->getPaddr(), req->getSize(), match_index))
+        match_index = pmpMatch(req->getPaddr(), req->getSize());
+
+    if (match_index > -1) {
+        uint8_t this_cfg = pmpTable[match_index].pmpCfg;
+
+        if ((pmode == PrivilegeMode::PRV_M) &&
+                                (PMP_LOCK & this_cfg) == 0) {
+            return NoFault;
+        } else if ((mode == BaseMMU::Mode::Read) &&
+                                    (PMP_READ & this_cfg)) {
+            return NoFault;
+        } else if ((mode == BaseMMU::Mode::Write) &&
+                                    (PMP_WRITE & this_cfg)) {
+            return NoFault;
+        } else if ((mode == BaseMMU::Mode::Execute) &&
+                                    (PMP_EXEC & this_cfg)) {
+            return NoFault;
+        } else {
+            if (req->hasVaddr()) {
+                return createAddrfault(req->getVaddr(), mode);
             } else {
-                if (req->hasVaddr()) {
-                    return createAddrfault(req->getVaddr(), mode);
-                } else {
-                    return createAddrfault(vaddr, mode);
-                }
+                return createAddrfault(vaddr, mode);
             }
         }
     }
@@ -223,6 +275,8 @@ PMP::pmpUpdateRule(uint32_t pmp_index)
     if (hasLockEntry) {
         DPRINTF(PMP, "Find lock entry\n");
     }
+
+    flushPageCache();
 }
 
 void
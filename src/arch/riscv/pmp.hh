@@ -115,6 +115,23 @@ class PMP : public SimObject
     /** a table of pmp entries */
     std::vector<PmpEntry> pmpTable;
 
+    /**
+     * The entry deciding the accesses to a recently checked page, or -1
+     * if no entry matches them. Pages whose accesses may match different
+     * entries, as some entry covers only part of them, aren't cached.
+     * The cache only depends on the rules, and is flushed whenever one
+     * of them changes.
+     */
+    struct PageMatch
+    {
+        Addr page = MaxAddr;
+        int index = -1;
+    };
+
+    static constexpr int PageShift = 12;
+    static constexpr size_t PageCacheSize = 256;
+    std::vector<PageMatch> pageCache;
+
   public:
     /**
      * pmpCheck checks if a particular memory access
@@ -158,6 +175,26 @@ class PMP : public SimObject
     void pmpReset();
 
   private:
+    /**
+     * Find the entry which matches an access, the first one which
+     * contains all of it.
+     * @param paddr physical address of the access.
+     * @param size size of the access.
+     * @return index of the entry, or -1 if none matches.
+     */
+    int pmpMatch(Addr paddr, unsigned size);
+
+    /**
+     * Find the entry which matches an access from the page cache,
+     * filling it on a miss.
+     * @return whether the page is cached, in which case match_index
+     * is set as pmpMatch() would.
+     */
+    bool pmpMatchPage(Addr paddr, unsigned size, int &match_index);
+
+    /** Forget the pages cached before a rule changed. */
+    void flushPageCache();
+
     /**
      * This function is called during a memory
      * access to determine if the pmp table
@@ -86,6 +86,11 @@ TLB::TLB(const Params &p) :
         freeList.push_back(&tlb[x]);
     }
 
+    if (p.assoc < size) {
+        sets.reset(new TlbSets<TlbEntry>(tlb.data(), size, p.assoc));
+        freeList.clear();
+    }
+
     walker = p.walker;
     walker->setTLB(this);
 }
@@ -114,7 +119,8 @@ TLB::evictLRU()
 TlbEntry *
 TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
 {
-    TlbEntry *entry = trie.lookup(buildKey(vpn, asid));
+    const Addr key = buildKey(vpn, asid);
+    TlbEntry *entry = sets ? sets->lookup(key) : trie.lookup(key);
 
     DPRINTF(TLBVerbose, "lookup(vpn=%#x, asid=%#x, key=%#x): "
                         "%s ppn=%#x (%#x) %s\n",
@@ -167,13 +173,19 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
         return newEntry;
     }
 
+    Addr key = buildKey(vpn, entry.asid);
+    if (sets) {
+        TlbEntry new_entry = entry;
+        new_entry.lruSeq = nextSeq();
+        return insertInSet(key, new_entry);
+    }
+
     if (freeList.empty())
         evictLRU();
 
     newEntry = freeList.front();
     freeList.pop_front();
 
-    Addr key = buildKey(vpn, entry.asid);
     *newEntry = entry;
     newEntry->lruSeq = nextSeq();
     newEntry->trieHandle = trie.insert(
@@ -182,6 +194,19 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
     return newEntry;
 }
 
+TlbEntry *
+TLB::insertInSet(Addr key, const TlbEntry &entry)
+{
+    const unsigned shift = entry.logBytes - PageShift;
+    TlbEntry *newEntry = sets->findVictim(key, shift);
+    if (sets->isValid(newEntry))
+        remove(newEntry - tlb.data());
+
+    *newEntry = entry;
+    sets->insert(newEntry, key, shift);
+    return newEntry;
+}
+
 void
 TLB::demapPage(Addr vaddr, uint64_t asid)
 {
@@ -213,7 +238,7 @@ TLB::demapPage(Addr vaddr, uint64_t asid)
         }
         else {
             for (size_t i = 0; i < size; i++) {
-                if (tlb[i].trieHandle) {
+                if (isValid(&tlb[i])) {
                     Addr mask = ~(tlb[i].size() - 1);
                     if ((vaddr == 0 || (vaddr & mask) == tlb[i].vaddr) &&
                         (asid == 0 || tlb[i].asid == asid))
@@ -229,7 +254,7 @@ TLB::flushAll()
 {
     DPRINTF(TLB, "flushAll()\n");
     for (size_t i = 0; i < size; i++) {
-        if (tlb[i].trieHandle)
+        if (isValid(&tlb[i]))
             remove(i);
     }
 }
@@ -241,7 +266,12 @@ TLB::remove(size_t idx)
         tlb[idx].vaddr, tlb[idx].asid, tlb[idx].paddr, tlb[idx].pte,
         tlb[idx].size());
 
-    assert(tlb[idx].trieHandle);
+    assert(isValid(&tlb[idx]));
+    if (sets) {
+        sets->remove(&tlb[idx]);
+        return;
+    }
+
     trie.remove(tlb[idx].trieHandle);
     tlb[idx].trieHandle = NULL;
     freeList.push_back(&tlb[idx]);
@@ -516,13 +546,13 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = sets ? sets->size() : size - freeList.size();
     SERIALIZE_SCALAR(_size);
     SERIALIZE_SCALAR(lruSeq);
 
     uint32_t _count = 0;
     for (uint32_t x = 0; x < size; x++) {
-        if (tlb[x].trieHandle != NULL)
+        if (isValid(&tlb[x]))
             tlb[x].serializeSection(cp, csprintf("Entry%d", _count++));
     }
 }
@@ -540,6 +570,15 @@ TLB::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(lruSeq);
 
     for (uint32_t x = 0; x < _size; x++) {
+        if (sets) {
+            TlbEntry entry;
+            entry.unserializeSection(cp, csprintf("Entry%d", x));
+            // TODO: When supporting other addressing modes fix this
+            Addr vpn = getVPNFromVAddr(entry.vaddr, AddrXlateMode::SV39);
+            insertInSet(buildKey(vpn, entry.asid), entry);
+            continue;
+        }
+
         TlbEntry *newEntry = freeList.front();
         freeList.pop_front();
 
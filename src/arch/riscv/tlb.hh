@@ -33,8 +33,10 @@
 #define __ARCH_RISCV_TLB_HH__
 
 #include <list>
+#include <memory>
 
 #include "arch/generic/tlb.hh"
+#include "arch/generic/tlb_sets.hh"
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/pagetable.hh"
 #include "arch/riscv/pma_checker.hh"
@@ -67,6 +69,12 @@ class TLB : public BaseTLB
     EntryList freeList;         // free entries
     uint64_t lruSeq;
 
+    /**
+     * Set associative index of the entries, which replaces the trie and
+     * the free list when the TLB is not fully associative.
+     */
+    std::unique_ptr<TlbSets<TlbEntry>> sets;
+
     Walker *walker;
 
     struct TlbStats : public statistics::Group
@@ -177,6 +185,18 @@ class TLB : public BaseTLB
     void evictLRU();
     void remove(size_t idx);
 
+    bool
+    isValid(const TlbEntry *entry) const
+    {
+        return sets ? sets->isValid(entry) : entry->trieHandle != NULL;
+    }
+
+    /**
+     * Place an entry in the set of its key, replacing the least recently
+     * used entry of the set if it is full.
+     */
+    TlbEntry *insertInSet(Addr key, const TlbEntry &entry);
+
     Fault translate(const RequestPtr &req, ThreadContext *tc,
                     BaseMMU::Translation *translation, BaseMMU::Mode mode,
                     bool &delayed);
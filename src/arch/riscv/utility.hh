@@ -52,6 +52,7 @@
 #include "arch/riscv/regs/float.hh"
 #include "arch/riscv/regs/int.hh"
 #include "arch/riscv/regs/vector.hh"
+#include "base/host_fp.hh"
 #include "base/types.hh"
 #include "cpu/reg_class.hh"
 #include "cpu/static_inst.hh"
@@ -349,13 +350,44 @@ ftype_freg(freg_t a) -> FloatType
     GEM5_UNREACHABLE;
 }
 
+// Use host floating point for the common case where it gives the same
+// result and flags as softfloat, see base/host_fp.hh.
+template<typename FloatType, typename HostType, typename IntType>
+bool
+hostFadd(IntType a, IntType b, FloatType &x)
+{
+    bool inexact;
+    if (softfloat_roundingMode != softfloat_round_near_even ||
+        !hostFpAdd<HostType>(a, b, x.v, inexact)) {
+        return false;
+    }
+    if (inexact)
+        softfloat_exceptionFlags |= softfloat_flag_inexact;
+    return true;
+}
+
+template<typename FloatType, typename HostType, typename IntType>
+bool
+hostFmul(IntType a, IntType b, FloatType &x)
+{
+    bool inexact;
+    if (softfloat_roundingMode != softfloat_round_near_even ||
+        !hostFpMul<HostType>(a, b, x.v, inexact)) {
+        return false;
+    }
+    if (inexact)
+        softfloat_exceptionFlags |= softfloat_flag_inexact;
+    return true;
+}
+
 template<typename FloatType> FloatType
 fadd(FloatType a, FloatType b)
 {
+    FloatType x;
     if constexpr(std::is_same_v<float32_t, FloatType>)
-        return f32_add(a, b);
+        return hostFadd<FloatType, float>(a.v, b.v, x) ? x : f32_add(a, b);
     else if constexpr(std::is_same_v<float64_t, FloatType>)
-        return f64_add(a, b);
+        return hostFadd<FloatType, double>(a.v, b.v, x) ? x : f64_add(a, b);
     else if constexpr(std::is_same_v<float16_t, FloatType>)
         return f16_add(a, b);
     GEM5_UNREACHABLE;
@@ -364,10 +396,16 @@ fadd(FloatType a, FloatType b)
 template<typename FloatType> FloatType
 fsub(FloatType a, FloatType b)
 {
-    if constexpr(std::is_same_v<float32_t, FloatType>)
-        return f32_sub(a, b);
-    else if constexpr(std::is_same_v<float64_t, FloatType>)
-        return f64_sub(a, b);
+    using IntType = decltype(FloatType::v);
+    constexpr IntType sign = IntType(1) << (sizeof(IntType) * 8 - 1);
+    FloatType x;
+    if constexpr(std::is_same_v<float32_t, FloatType>) {
+        return hostFadd<FloatType, float>(a.v, b.v ^ sign, x) ?
+            x : f32_sub(a, b);
+    } else if constexpr(std::is_same_v<float64_t, FloatType>) {
+        return hostFadd<FloatType, double>(a.v, b.v ^ sign, x) ?
+            x : f64_sub(a, b);
+    }
     else if constexpr(std::is_same_v<float16_t, FloatType>)
         return f16_sub(a, b);
     GEM5_UNREACHABLE;
@@ -412,10 +450,11 @@ fdiv(FloatType a, FloatType b)
 template<typename FloatType> FloatType
 fmul(FloatType a, FloatType b)
 {
+    FloatType x;
     if constexpr(std::is_same_v<float32_t, FloatType>)
-        return f32_mul(a, b);
+        return hostFmul<FloatType, float>(a.v, b.v, x) ? x : f32_mul(a, b);
     else if constexpr(std::is_same_v<float64_t, FloatType>)
-        return f64_mul(a, b);
+        return hostFmul<FloatType, double>(a.v, b.v, x) ? x : f64_mul(a, b);
     else if constexpr(std::is_same_v<float16_t, FloatType>)
         return f16_mul(a, b);
     GEM5_UNREACHABLE;
@@ -24,6 +24,8 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.objects.BaseAtomicSimpleCPU import BaseAtomicSimpleCPU
+from m5.objects.BaseFastForwardCPU import BaseFastForwardCPU
+from m5.objects.BaseIntervalSimpleCPU import BaseIntervalSimpleCPU
 from m5.objects.BaseMinorCPU import BaseMinorCPU
 from m5.objects.BaseNonCachingSimpleCPU import BaseNonCachingSimpleCPU
 from m5.objects.BaseO3CPU import BaseO3CPU
@@ -45,6 +47,14 @@ class SparcAtomicSimpleCPU(BaseAtomicSimpleCPU, SparcCPU):
     mmu = SparcMMU()
 
 
+class SparcFastForwardCPU(BaseFastForwardCPU, SparcCPU):
+    mmu = SparcMMU()
+
+
+class SparcIntervalSimpleCPU(BaseIntervalSimpleCPU, SparcCPU):
+    mmu = SparcMMU()
+
+
 class SparcNonCachingSimpleCPU(BaseNonCachingSimpleCPU, SparcCPU):
     mmu = SparcMMU()
 
@@ -31,6 +31,7 @@
 
 #include "arch/generic/decode_cache.hh"
 #include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/sparc/types.hh"
 #include "cpu/static_inst.hh"
 #include "debug/Decode.hh"
@@ -44,7 +45,7 @@ class BaseISA;
 namespace SparcISA
 {
 
-class Decoder : public InstDecoder
+class Decoder GEM5_ISA_FINAL : public InstDecoder
 {
   protected:
     // The extended machine instruction being generated
@@ -78,6 +79,8 @@ class Decoder : public InstDecoder
     void
     setContext(RegVal _asi)
     {
+        if (asi != _asi)
+            contextChanged();
         asi = _asi;
     }
 
@@ -32,6 +32,7 @@
 #include <ostream>
 #include <string>
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/isa.hh"
 #include "arch/sparc/pcstate.hh"
 #include "arch/sparc/regs/float.hh"
@@ -52,7 +53,7 @@ class ThreadContext;
 
 namespace SparcISA
 {
-class ISA : public BaseISA
+class ISA GEM5_ISA_FINAL : public BaseISA
 {
   private:
 
@@ -194,6 +195,12 @@ class ISA : public BaseISA
     void setMiscRegNoEffect(RegIndex idx, RegVal val) override;
     void setMiscReg(RegIndex idx, RegVal val) override;
 
+    bool
+    isValidMiscReg(RegIndex idx) const override
+    {
+        return idx != MISCREG_PCR && idx != MISCREG_PIC;
+    }
+
     uint64_t
     getExecutingAsid() const override
     {
@@ -79,7 +79,12 @@ namespace SparcISA
 {
 
 EmuLinux::EmuLinux(const Params &p) : SEWorkload(p, PageShift)
-{}
+{
+    // Traps advance the PC after the system call, which would move the
+    // thread switched in by the scheduler instead.
+    fatal_if(threadScheduler().enabled(),
+             "Time slicing guest threads is not supported on SPARC.");
+}
 
 void
 EmuLinux::handleTrap(ThreadContext *tc, int trapNum)
@@ -38,6 +38,7 @@
 #ifndef __ARCH_SPARC_MMU_HH__
 #define __ARCH_SPARC_MMU_HH__
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/mmu.hh"
 #include "arch/sparc/page_size.hh"
 #include "arch/sparc/tlb.hh"
@@ -49,7 +50,7 @@ namespace gem5
 
 namespace SparcISA {
 
-class MMU : public BaseMMU
+class MMU GEM5_ISA_FINAL : public BaseMMU
 {
   public:
     MMU(const SparcMMUParams &p)
@@ -57,6 +57,9 @@ class X86TLB(BaseTLB):
     cxx_header = "arch/x86/tlb.hh"
 
     size = Param.Unsigned(64, "TLB size")
+    assoc = Param.Unsigned(
+        Self.size, "Associativity of the TLB. Fully associative by default"
+    )
     system = Param.System(Parent.any, "system object")
     walker = Param.X86PagetableWalker(
         X86PagetableWalker(), "page table walker"
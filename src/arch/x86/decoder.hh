@@ -31,9 +31,11 @@
 
 #include <cassert>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "arch/generic/decoder.hh"
+#include "arch/generic/devirtualize.hh"
 #include "arch/x86/microcode_rom.hh"
 #include "arch/x86/regs/misc.hh"
 #include "arch/x86/types.hh"
@@ -54,7 +56,7 @@ class BaseISA;
 namespace X86ISA
 {
 
-class Decoder : public InstDecoder
+class Decoder GEM5_ISA_FINAL : public InstDecoder
 {
   private:
     // These are defined and documented in decoder_tables.cc
@@ -278,6 +280,7 @@ class Decoder : public InstDecoder
         altAddr = m5Reg.altAddr;
         defAddr = m5Reg.defAddr;
         stack = m5Reg.stack;
+        contextChanged();
 
         AddrCacheMap::iterator amIter = addrCacheMap.find(m5Reg);
         if (amIter != addrCacheMap.end()) {
@@ -291,7 +294,13 @@ class Decoder : public InstDecoder
         if (imIter != instCacheMap.end()) {
             instMap = imIter->second;
         } else {
-            instMap = new decode_cache::InstMap<ExtMachInst>;
+            // The ExtMachInst holds the rest of the decoding context.
+            if (_shareDecodeCache) {
+                instMap = &decode_cache::sharedInstMap<ExtMachInst>(
+                        std::make_pair(eventQueue(), (CacheKey)m5Reg));
+            } else {
+                instMap = new decode_cache::InstMap<ExtMachInst>;
+            }
             instCacheMap[m5Reg] = instMap;
         }
     }
@@ -32,6 +32,7 @@
 #include <iostream>
 #include <string>
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/isa.hh"
 #include "arch/x86/cpuid.hh"
 #include "arch/x86/pcstate.hh"
@@ -51,7 +52,7 @@ struct X86ISAParams;
 namespace X86ISA
 {
 
-class ISA : public BaseISA
+class ISA GEM5_ISA_FINAL : public BaseISA
 {
   private:
     RegVal regVal[misc_reg::NumRegs];
@@ -79,6 +80,12 @@ class ISA : public BaseISA
     void setMiscRegNoEffect(RegIndex idx, RegVal val) override;
     void setMiscReg(RegIndex idx, RegVal val) override;
 
+    bool
+    isValidMiscReg(RegIndex idx) const override
+    {
+        return misc_reg::isValid(idx);
+    }
+
     bool
     inUserMode() const override
     {
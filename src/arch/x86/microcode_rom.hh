@@ -29,6 +29,9 @@
 #ifndef __ARCH_X86_MICROCODE_ROM_HH__
 #define __ARCH_X86_MICROCODE_ROM_HH__
 
+#include <unordered_map>
+#include <utility>
+
 #include "arch/x86/insts/badmicroop.hh"
 #include "arch/x86/emulenv.hh"
 #include "cpu/static_inst.hh"
@@ -49,6 +52,21 @@ class MicrocodeRom
 
     GenFunc *genFuncs;
 
+    /**
+     * The microops generated so far for each macroop, by micro PC. ROM
+     * microops only depend on the macroop they are generated for, so
+     * they can be reused whenever that macroop enters the ROM again
+     * rather than being allocated anew. The map holds a reference to the
+     * macroop so its address can't be reused by another one.
+     */
+    typedef std::unordered_map<MicroPC, StaticInstPtr> Expansion;
+    std::unordered_map<const StaticInst *,
+        std::pair<StaticInstPtr, Expansion>> expansions;
+
+    // The expansion of the last macroop which fetched from the ROM.
+    const StaticInst *lastMacroop = nullptr;
+    Expansion *lastExpansion = nullptr;
+
   public:
     //Constructor.
     MicrocodeRom();
@@ -65,8 +83,18 @@ class MicrocodeRom
         microPC = normalMicroPC(microPC);
         if (microPC >= numMicroops)
             return X86ISA::badMicroop;
-        else
-            return genFuncs[microPC](curMacroop);
+
+        if (!lastExpansion || curMacroop.get() != lastMacroop) {
+            auto &entry = expansions[curMacroop.get()];
+            entry.first = curMacroop;
+            lastMacroop = curMacroop.get();
+            lastExpansion = &entry.second;
+        }
+
+        StaticInstPtr &microop = (*lastExpansion)[microPC];
+        if (!microop)
+            microop = genFuncs[microPC](curMacroop);
+        return microop;
     }
 };
 
@@ -38,6 +38,7 @@
 #ifndef __ARCH_X86_MMU_HH__
 #define __ARCH_X86_MMU_HH__
 
+#include "arch/generic/devirtualize.hh"
 #include "arch/generic/mmu.hh"
 #include "arch/x86/page_size.hh"
 #include "arch/x86/tlb.hh"
@@ -49,7 +50,7 @@ namespace gem5
 
 namespace X86ISA {
 
-class MMU : public BaseMMU
+class MMU GEM5_ISA_FINAL : public BaseMMU
 {
   public:
     MMU(const X86MMUParams &p)
@@ -74,6 +74,11 @@ TLB::TLB(const Params &p)
         freeList.push_back(&tlb[x]);
     }
 
+    if (p.assoc < size) {
+        sets.reset(new TlbSets<TlbEntry>(tlb.data(), size, p.assoc));
+        freeList.clear();
+    }
+
     walker = p.walker;
     walker->setTLB(this);
 }
@@ -96,6 +101,30 @@ TLB::evictLRU()
     freeList.push_back(&tlb[lru]);
 }
 
+void
+TLB::remove(TlbEntry *entry)
+{
+    if (sets) {
+        sets->remove(entry);
+    } else {
+        trie.remove(entry->trieHandle);
+        entry->trieHandle = NULL;
+        freeList.push_back(entry);
+    }
+}
+
+TlbEntry *
+TLB::insertInSet(const TlbEntry &entry)
+{
+    TlbEntry *newEntry = sets->findVictim(entry.vaddr, entry.logBytes);
+    if (sets->isValid(newEntry))
+        sets->remove(newEntry);
+
+    *newEntry = entry;
+    sets->insert(newEntry, entry.vaddr, entry.logBytes);
+    return newEntry;
+}
+
 TlbEntry *
 TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
 {
@@ -106,12 +135,21 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
     vpn = concAddrPcid(vpn, pcid);
 
     // If somebody beat us to it, just use that existing entry.
-    TlbEntry *newEntry = trie.lookup(vpn);
+    TlbEntry *newEntry = lookup(vpn, false);
     if (newEntry) {
         assert(newEntry->vaddr == vpn);
         return newEntry;
     }
 
+    if (sets) {
+        // Pages are matched by their size in both SE and FS mode, which
+        // is equivalent as SE mode only maps small pages.
+        TlbEntry new_entry = entry;
+        new_entry.lruSeq = nextSeq();
+        new_entry.vaddr = vpn;
+        return insertInSet(new_entry);
+    }
+
     if (freeList.empty())
         evictLRU();
 
@@ -135,7 +173,7 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
 TlbEntry *
 TLB::lookup(Addr va, bool update_lru)
 {
-    TlbEntry *entry = trie.lookup(va);
+    TlbEntry *entry = sets ? sets->lookup(va) : trie.lookup(va);
     if (entry && update_lru)
         entry->lruSeq = nextSeq();
     return entry;
@@ -146,11 +184,8 @@ TLB::flushAll()
 {
     DPRINTF(TLB, "Invalidating all entries.\n");
     for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
+        if (isValid(&tlb[i]))
+            remove(&tlb[i]);
     }
 }
 
@@ -165,23 +200,17 @@ TLB::flushNonGlobal()
 {
     DPRINTF(TLB, "Invalidating all non global entries.\n");
     for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle && !tlb[i].global) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
+        if (isValid(&tlb[i]) && !tlb[i].global)
+            remove(&tlb[i]);
     }
 }
 
 void
 TLB::demapPage(Addr va, uint64_t asn)
 {
-    TlbEntry *entry = trie.lookup(va);
-    if (entry) {
-        trie.remove(entry->trieHandle);
-        entry->trieHandle = NULL;
-        freeList.push_back(entry);
-    }
+    TlbEntry *entry = lookup(va, false);
+    if (entry)
+        remove(entry);
 }
 
 namespace
@@ -593,13 +622,13 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = sets ? sets->size() : size - freeList.size();
     SERIALIZE_SCALAR(_size);
     SERIALIZE_SCALAR(lruSeq);
 
     uint32_t _count = 0;
     for (uint32_t x = 0; x < size; x++) {
-        if (tlb[x].trieHandle != NULL)
+        if (isValid(&tlb[x]))
             tlb[x].serializeSection(cp, csprintf("Entry%d", _count++));
     }
 }
@@ -617,6 +646,13 @@ TLB::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(lruSeq);
 
     for (uint32_t x = 0; x < _size; x++) {
+        if (sets) {
+            TlbEntry entry;
+            entry.unserializeSection(cp, csprintf("Entry%d", x));
+            insertInSet(entry);
+            continue;
+        }
+
         TlbEntry *newEntry = freeList.front();
         freeList.pop_front();
 
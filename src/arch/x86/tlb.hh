@@ -39,9 +39,11 @@
 #define __ARCH_X86_TLB_HH__
 
 #include <list>
+#include <memory>
 #include <vector>
 
 #include "arch/generic/tlb.hh"
+#include "arch/generic/tlb_sets.hh"
 #include "arch/x86/pagetable.hh"
 #include "base/trie.hh"
 #include "mem/request.hh"
@@ -107,6 +109,27 @@ namespace X86ISA
         TlbEntryTrie trie;
         uint64_t lruSeq;
 
+        /**
+         * Set associative index of the entries, which replaces the trie
+         * and the free list when the TLB is not fully associative.
+         */
+        std::unique_ptr<TlbSets<TlbEntry>> sets;
+
+        bool
+        isValid(const TlbEntry *entry) const
+        {
+            return sets ? sets->isValid(entry) : entry->trieHandle != NULL;
+        }
+
+        /** Invalidate a valid entry. */
+        void remove(TlbEntry *entry);
+
+        /**
+         * Place an entry in its set, replacing the least recently used
+         * entry of the set if it is full.
+         */
+        TlbEntry *insertInSet(const TlbEntry &entry);
+
         AddrRange m5opRange;
 
         struct TlbStats : public statistics::Group
@@ -315,6 +315,40 @@ class AddrRange
      */
     uint32_t stripes() const { return 1ULL << masks.size(); }
 
+    /**
+     * Get the stripe of this range among the stripes() its chunk is
+     * interleaved across.
+     *
+     * @return The interleaving bits matched by this range
+     *
+     * @ingroup api_addr_range
+     */
+    uint8_t getIntlvMatch() const { return intlvMatch; }
+
+    /**
+     * Determine the stripe an address falls in, using the interleaving
+     * bits of this range, whether the address is in the range or not.
+     *
+     * @param a Address to evaluate
+     * @return The interleaving bits selected by the address
+     *
+     * @ingroup api_addr_range
+     */
+    uint8_t
+    intlvSelect(Addr a) const
+    {
+        uint8_t sel = 0;
+        for (unsigned int i = 0; i < masks.size(); i++) {
+            Addr masked = a & masks[i];
+            // The result of an xor operation is 1 if the number
+            // of bits set is odd or 0 othersize, thefore it
+            // suffices to count the number of bits set to
+            // determine the i-th bit of sel.
+            sel |= (popCount(masked) % 2) << i;
+        }
+        return sel;
+    }
+
     /**
      * Get the size of the address range. For a case where
      * interleaving is used we make the simplifying assumption that
@@ -492,19 +526,7 @@ class AddrRange
         // no interleaving, or with interleaving also if the selected
         // bits from the address match the interleaving value
         bool in_range = a >= _start && a < _end;
-        if (in_range) {
-            auto sel = 0;
-            for (unsigned int i = 0; i < masks.size(); i++) {
-                Addr masked = a & masks[i];
-                // The result of an xor operation is 1 if the number
-                // of bits set is odd or 0 othersize, thefore it
-                // suffices to count the number of bits set to
-                // determine the i-th bit of sel.
-                sel |= (popCount(masked) % 2) << i;
-            }
-            return sel == intlvMatch;
-        }
-        return false;
+        return in_range && intlvSelect(a) == intlvMatch;
     }
 
     /**
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Micro-benchmarks of the address decoding of AddrRangeMap, like the one
+ * a crossbar does for every packet: contiguous ranges of devices and
+ * memories, and memory channels interleaved at cache-line granularity.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "base/addr_range_map.hh"
+#include "base/intmath.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Random addresses, pre-generated to keep the RNG out. */
+std::vector<Addr>
+randomAddrs(Addr limit)
+{
+    std::mt19937_64 rng(0);
+    std::vector<Addr> addrs(1 << 12);
+    for (auto &addr : addrs)
+        addr = rng() % limit;
+    return addrs;
+}
+
+/**
+ * Look up addresses in contiguous ranges of 1MiB.
+ * Argument: number of ranges.
+ */
+void
+AddrRangeMapContiguous(benchmark::State &state)
+{
+    const Addr size = 1 << 20;
+    const int num_ranges = state.range(0);
+    AddrRangeMap<int> map;
+    for (int i = 0; i < num_ranges; i++)
+        map.insert(RangeSize(i * size, size), i);
+
+    const auto addrs = randomAddrs(num_ranges * size);
+    size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(addrs[next]));
+        next = (next + 1) % addrs.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AddrRangeMapContiguous)->Arg(4)->Arg(64)->Arg(1024);
+
+/**
+ * Look up addresses in memory channels interleaved every 64 bytes.
+ * Argument: number of channels, a power of two.
+ */
+void
+AddrRangeMapInterleaved(benchmark::State &state)
+{
+    const Addr size = 1ULL << 32;
+    const int num_channels = state.range(0);
+    const int intlv_bits = floorLog2(num_channels);
+    AddrRangeMap<int> map;
+    for (int i = 0; i < num_channels; i++) {
+        std::vector<Addr> masks;
+        for (int bit = 0; bit < intlv_bits; bit++)
+            masks.push_back(1ULL << (6 + bit));
+        map.insert(AddrRange(0, size, masks, i), i);
+    }
+
+    const auto addrs = randomAddrs(size);
+    size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.contains(addrs[next]));
+        next = (next + 1) % addrs.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AddrRangeMapInterleaved)->Arg(2)->Arg(16);
+
+} // anonymous namespace
@@ -41,11 +41,12 @@
 #ifndef __BASE_ADDR_RANGE_MAP_HH__
 #define __BASE_ADDR_RANGE_MAP_HH__
 
+#include <algorithm>
 #include <cstddef>
-#include <functional>
-#include <list>
+#include <iterator>
 #include <map>
 #include <utility>
+#include <vector>
 
 #include "base/addr_range.hh"
 #include "base/types.hh"
@@ -54,11 +55,18 @@ namespace gem5
 {
 
 /**
- * The AddrRangeMap uses an STL map to implement an interval tree for
- * address decoding. The value stored is a template type and can be
- * e.g. a port identifier, or a pointer.
+ * The AddrRangeMap uses an STL map to store address ranges, which are
+ * decoded through a flattened index: a sorted array with one segment per
+ * range, or per group of interleaved ranges, which finds the range of an
+ * address with a binary search and then selects the stripe of a group
+ * from the interleaving bits of the address. The value stored is a
+ * template type and can be e.g. a port identifier, or a pointer.
+ *
+ * The index is only updated when ranges are inserted or erased, so
+ * lookups do not modify the map and can run concurrently once it is
+ * populated.
  */
-template <typename V, int max_cache_size=0>
+template <typename V>
 class AddrRangeMap
 {
   private:
@@ -73,6 +81,42 @@ class AddrRangeMap
     typedef typename RangeMap::const_iterator const_iterator;
     /** @} */ // end of api_addr_range
 
+    AddrRangeMap() = default;
+
+    /**
+     * The index refers to the entries of the map, so it is rebuilt for
+     * copies rather than copied.
+     */
+    AddrRangeMap(const AddrRangeMap &other)
+        : tree(other.tree)
+    {
+        rebuildIndex();
+    }
+
+    AddrRangeMap(AddrRangeMap &&other)
+        : tree(std::move(other.tree))
+    {
+        rebuildIndex();
+        other.clear();
+    }
+
+    AddrRangeMap &
+    operator=(const AddrRangeMap &other)
+    {
+        tree = other.tree;
+        rebuildIndex();
+        return *this;
+    }
+
+    AddrRangeMap &
+    operator=(AddrRangeMap &&other)
+    {
+        tree = std::move(other.tree);
+        rebuildIndex();
+        other.clear();
+        return *this;
+    }
+
     /**
      * Find entry that contains the given address range
      *
@@ -89,12 +133,12 @@ class AddrRangeMap
     const_iterator
     contains(const AddrRange &r) const
     {
-        return find(r, [r](const AddrRange r1) { return r.isSubset(r1); });
+        return findContaining(r);
     }
     iterator
     contains(const AddrRange &r)
     {
-        return find(r, [r](const AddrRange r1) { return r.isSubset(r1); });
+        return findContaining(r);
     }
     /** @} */ // end of api_addr_range
 
@@ -139,12 +183,12 @@ class AddrRangeMap
     const_iterator
     intersects(const AddrRange &r) const
     {
-        return find(r, [r](const AddrRange r1) { return r.intersects(r1); });
+        return findIntersecting(r);
     }
     iterator
     intersects(const AddrRange &r)
     {
-        return find(r, [r](const AddrRange r1) { return r.intersects(r1); });
+        return findIntersecting(r);
     }
     /** @} */ // end of api_addr_range
 
@@ -157,7 +201,9 @@ class AddrRangeMap
         if (intersects(r) != end())
             return tree.end();
 
-        return tree.insert(std::make_pair(r, d)).first;
+        iterator it = tree.insert(std::make_pair(r, d)).first;
+        rebuildIndex();
+        return it;
     }
 
     /**
@@ -166,8 +212,8 @@ class AddrRangeMap
     void
     erase(iterator p)
     {
-        cache.remove(p);
         tree.erase(p);
+        rebuildIndex();
     }
 
     /**
@@ -176,10 +222,8 @@ class AddrRangeMap
     void
     erase(iterator p, iterator q)
     {
-        for (auto it = p; it != q; it++) {
-            cache.remove(p);
-        }
         tree.erase(p,q);
+        rebuildIndex();
     }
 
     /**
@@ -188,8 +232,8 @@ class AddrRangeMap
     void
     clear()
     {
-        cache.erase(cache.begin(), cache.end());
         tree.erase(tree.begin(), tree.end());
+        index.clear();
     }
 
     /**
@@ -248,93 +292,122 @@ class AddrRangeMap
 
   private:
     /**
-     * Add an address range map entry to the cache.
-     *
-     * @param it Iterator to the entry in the address range map
+     * A range of the map, or a group of interleaved ranges which merge
+     * with each other, and therefore share their start and end.
+     */
+    struct Segment
+    {
+        Addr start;
+        /** Entries of the segment in the map */
+        iterator first, last;
+        /**
+         * Entry of each stripe of an interleaved group, end() for the
+         * stripes which are not in the map. Empty if not interleaved.
+         */
+        std::vector<iterator> stripes;
+    };
+
+    /**
+     * Rebuild the index from the map, after it was changed. Ranges in
+     * the map do not intersect, so the segments do not either.
      */
     void
-    addNewEntryToCache(iterator it) const
+    rebuildIndex()
     {
-        if (max_cache_size != 0) {
-            // If there's a cache, add this element to it.
-            if (cache.size() >= max_cache_size) {
-                // If the cache is full, move the last element to the
-                // front and overwrite it with the new value. This
-                // avoids creating or destroying elements of the list.
-                auto last = cache.end();
-                last--;
-                *last = it;
-                if (max_cache_size > 1)
-                    cache.splice(cache.begin(), cache, last);
-            } else {
-                cache.push_front(it);
+        index.clear();
+        for (auto it = tree.begin(); it != tree.end(); ) {
+            Segment seg;
+            seg.start = it->first.start();
+            seg.first = it;
+            do {
+                ++it;
+            } while (it != tree.end() &&
+                     it->first.mergesWith(seg.first->first));
+            seg.last = it;
+
+            const AddrRange &range = seg.first->first;
+            if (range.interleaved()) {
+                seg.stripes.resize(range.stripes(), tree.end());
+                for (auto s = seg.first; s != seg.last; ++s)
+                    seg.stripes[s->first.getIntlvMatch()] = s;
             }
+            index.push_back(std::move(seg));
         }
     }
 
     /**
-     * Find entry that satisfies a condition on an address range
+     * Find the last segment which starts at or before an address, the
+     * only one which can contain it.
      *
-     * Searches through the ranges in the address map and returns an
-     * iterator to the entry that satisfies the input conidition on
-     * the input address range. Returns end() if none found.
+     * @param a An input address
+     * @return The segment, or index.end() if none found
+     */
+    typename std::vector<Segment>::const_iterator
+    findSegment(Addr a) const
+    {
+        auto seg = std::upper_bound(index.begin(), index.end(), a,
+            [](Addr a, const Segment &s) { return a < s.start; });
+        return seg == index.begin() ? index.end() : std::prev(seg);
+    }
+
+    /**
+     * Find entry that contains the given address range, which cannot
+     * be interleaved.
      *
      * @param r An input address range
-     * @param f A condition on an address range
      * @return An iterator that contains the input address range
      */
     iterator
-    find(const AddrRange &r, std::function<bool(const AddrRange)> cond)
+    findContaining(const AddrRange &r) const
     {
-        // Check the cache first
-        for (auto c = cache.begin(); c != cache.end(); c++) {
-            auto it = *c;
-            if (cond(it->first)) {
-                // If this entry matches, promote it to the front
-                // of the cache and return it.
-                cache.splice(cache.begin(), cache, c);
-                return it;
-            }
-        }
+        auto seg = findSegment(r.start());
+        if (seg == index.end())
+            return treeEnd();
 
-        iterator next = tree.upper_bound(r);
-        if (next != end() && cond(next->first)) {
-            addNewEntryToCache(next);
-            return next;
+        if (!seg->stripes.empty()) {
+            // Only one stripe can hold the start of the range
+            auto it = seg->stripes[seg->first->first.intlvSelect(
+                                       r.start())];
+            if (it != treeEnd() && r.isSubset(it->first))
+                return it;
+            return treeEnd();
         }
-        if (next == begin())
-            return end();
-        next--;
-
-        iterator i;
-        do {
-            i = next;
-            if (cond(i->first)) {
-                addNewEntryToCache(i);
-                return i;
-            }
-            // Keep looking if the next range merges with the current one.
-        } while (next != begin() &&
-                 (--next)->first.mergesWith(i->first));
 
-        return end();
+        return r.isSubset(seg->first->first) ? seg->first : treeEnd();
     }
 
-    const_iterator
-    find(const AddrRange &r, std::function<bool(const AddrRange)> cond) const
+    /**
+     * Find entry that intersects with the given address range
+     *
+     * @param r An input address range
+     * @return An iterator that intersects with the input address range
+     */
+    iterator
+    findIntersecting(const AddrRange &r) const
     {
-        return const_cast<AddrRangeMap *>(this)->find(r, cond);
+        // Only check the segment holding the start of r and the one
+        // right after it: if r does not reach the latter, it does not
+        // reach any other segment either.
+        auto seg = findSegment(r.start());
+        auto next = seg == index.end() ? index.begin() : std::next(seg);
+        for (auto s : {seg, next}) {
+            if (s == index.end())
+                continue;
+            for (auto it = s->first; it != s->last; ++it) {
+                if (r.intersects(it->first))
+                    return it;
+            }
+        }
+        return treeEnd();
     }
 
+    /** The end of the map, from a const method */
+    iterator treeEnd() const { return const_cast<RangeMap &>(tree).end(); }
+
     RangeMap tree;
 
-    /**
-     * A list of iterator that correspond to the max_cache_size most
-     * recently used entries in the address range map. This mainly
-     * used to optimize lookups. The elements in the list should
-     * always be valid iterators of the tree.
-     */
-    mutable std::list<iterator> cache;
+    /** Segments of the map, sorted by start address */
+    std::vector<Segment> index;
 };
 
 } // namespace gem5
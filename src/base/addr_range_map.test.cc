@@ -156,3 +156,96 @@ TEST(AddrRangeMapTest, InterleavedTest2)
     // intlvMatch = 2 for start = 0x80000000
     EXPECT_EQ(i->second, 2);
 }
+
+/**
+ * Interleaved groups which are only partially populated must find the
+ * stripes they have, and only them.
+ */
+TEST(AddrRangeMapTest, InterleavedMissingStripes)
+{
+    const auto masks = std::vector<Addr>{0x40, 0x80};
+    const Addr start = 0x1000;
+    const Addr end = 0x2000;
+
+    AddrRangeMap<int> r;
+    r.insert(AddrRange(start, end, masks, 1), 1);
+    r.insert(AddrRange(start, end, masks, 2), 2);
+    r.insert(RangeSize(0x2000, 0x1000), 10);
+    ASSERT_EQ(r.size(), 3);
+
+    EXPECT_EQ(r.contains(start), r.end());
+    EXPECT_EQ(r.contains(start + 0x40)->second, 1);
+    EXPECT_EQ(r.contains(start + 0x80)->second, 2);
+    EXPECT_EQ(r.contains(start + 0xc0), r.end());
+    EXPECT_EQ(r.contains(start + 0x47)->second, 1);
+    EXPECT_EQ(r.contains(RangeSize(start + 0x40, 0x40))->second, 1);
+    EXPECT_EQ(r.contains(RangeSize(start + 0x40, 0x80)), r.end());
+    EXPECT_EQ(r.contains(0x2800)->second, 10);
+    EXPECT_EQ(r.contains(0x3000), r.end());
+
+    // A stripe which is already there cannot be inserted again
+    EXPECT_EQ(r.insert(AddrRange(start, end, masks, 1), 5), r.end());
+    EXPECT_NE(r.insert(AddrRange(start, end, masks, 0), 0), r.end());
+    EXPECT_EQ(r.contains(start)->second, 0);
+}
+
+TEST(AddrRangeMapTest, IntersectsAcrossRanges)
+{
+    AddrRangeMap<int> r;
+    r.insert(RangeSize(0x1000, 0x100), 1);
+    r.insert(RangeSize(0x2000, 0x100), 2);
+    r.insert(RangeSize(0x3000, 0x100), 3);
+
+    EXPECT_EQ(r.intersects(RangeSize(0x0, 0x1000)), r.end());
+    EXPECT_EQ(r.intersects(RangeSize(0x0, 0x1001))->second, 1);
+    EXPECT_EQ(r.intersects(RangeSize(0x10f0, 0x1000))->second, 1);
+    EXPECT_EQ(r.intersects(RangeSize(0x1100, 0xf01))->second, 2);
+    EXPECT_EQ(r.intersects(RangeSize(0x1800, 0x2000))->second, 2);
+    EXPECT_EQ(r.intersects(RangeSize(0x3100, 0x1000)), r.end());
+}
+
+TEST(AddrRangeMapTest, Erase)
+{
+    AddrRangeMap<int> r;
+    r.insert(RangeSize(0x1000, 0x100), 1);
+    auto two = r.insert(RangeSize(0x2000, 0x100), 2);
+    r.insert(RangeSize(0x3000, 0x100), 3);
+
+    r.erase(two);
+    EXPECT_EQ(r.contains(0x2000), r.end());
+    EXPECT_EQ(r.contains(0x3000)->second, 3);
+
+    r.erase(r.begin(), r.contains(0x3000));
+    EXPECT_EQ(r.size(), 1);
+    EXPECT_EQ(r.contains(0x1000), r.end());
+    EXPECT_EQ(r.contains(0x3000)->second, 3);
+
+    r.clear();
+    EXPECT_TRUE(r.empty());
+    EXPECT_EQ(r.contains(0x3000), r.end());
+}
+
+TEST(AddrRangeMapTest, Copy)
+{
+    const auto masks = std::vector<Addr>{0x40};
+
+    AddrRangeMap<int> r;
+    r.insert(AddrRange(0x1000, 0x2000, masks, 0), 0);
+    r.insert(AddrRange(0x1000, 0x2000, masks, 1), 1);
+
+    // Lookups in a copy must return entries of the copy
+    AddrRangeMap<int> copy(r);
+    r.clear();
+    auto i = copy.contains(0x1040);
+    ASSERT_NE(i, copy.end());
+    EXPECT_EQ(i->second, 1);
+
+    AddrRangeMap<int> moved(std::move(copy));
+    i = moved.contains(0x1000);
+    ASSERT_NE(i, moved.end());
+    EXPECT_EQ(i->second, 0);
+
+    r = moved;
+    moved.clear();
+    EXPECT_EQ(r.contains(0x1040)->second, 1);
+}
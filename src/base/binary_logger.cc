@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/binary_logger.hh"
+
+#include <atomic>
+
+#include "base/output.hh"
+
+namespace gem5
+{
+
+namespace trace
+{
+
+namespace
+{
+
+/** Number of full buffers that can wait for the writer */
+constexpr size_t MaxPending = 16;
+
+std::atomic<uint64_t> nextSerial(1);
+
+template <typename T>
+void
+put(std::string &buf, const T &value)
+{
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void
+putString(std::string &buf, const std::string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.append(str);
+}
+
+} // anonymous namespace
+
+BinaryLogger::BinaryLogger(std::ostream &_stream, size_t buffer_size)
+    : outputStream(nullptr), stream(_stream), bufferSize(buffer_size),
+      serial(nextSerial++), textBuf(*this), text(&textBuf),
+      writing(0), stopping(false)
+{
+    rawArgs = true;
+
+    std::string header("gem5trc\0", 8);
+    put<uint32_t>(header, Version);
+    put<uint32_t>(header, 0x01020304);
+    stream.write(header.data(), header.size());
+
+    writer = std::thread([this]() { writeLoop(); });
+}
+
+BinaryLogger::BinaryLogger(OutputStream *os, size_t buffer_size)
+    : BinaryLogger(*os->stream(), buffer_size)
+{
+    outputStream = os;
+}
+
+BinaryLogger::~BinaryLogger()
+{
+    flush();
+
+    {
+        std::lock_guard<std::mutex> lock(writerLock);
+        stopping = true;
+    }
+    writerCond.notify_all();
+    writer.join();
+
+    if (outputStream)
+        simout.close(outputStream);
+}
+
+int
+BinaryLogger::TextBuf::sync()
+{
+    if (!str().empty()) {
+        logger.logMessage(MaxTick, "", "", str());
+        str("");
+    }
+    return 0;
+}
+
+BinaryLogger::ThreadBuffer &
+BinaryLogger::threadBuffer()
+{
+    thread_local uint64_t owner = 0;
+    thread_local ThreadBuffer *buffer = nullptr;
+
+    if (owner != serial) {
+        std::lock_guard<std::mutex> lock(bufferLock);
+        buffers.emplace_back(new ThreadBuffer);
+        buffer = buffers.back().get();
+        buffer->data.reserve(bufferSize);
+        owner = serial;
+    }
+    return *buffer;
+}
+
+uint32_t
+BinaryLogger::intern(ThreadBuffer &buffer, const std::string &str)
+{
+    auto it = buffer.strings.find(str);
+    if (it != buffer.strings.end())
+        return it->second;
+
+    uint32_t id;
+    bool inserted;
+    {
+        std::lock_guard<std::mutex> lock(bufferLock);
+        auto [ids_it, ids_inserted] = ids.emplace(str, ids.size());
+        id = ids_it->second;
+        inserted = ids_inserted;
+    }
+
+    // Only the first thread to see a string defines it. The decoder
+    // reads all definitions before formatting any record.
+    if (inserted) {
+        buffer.data.push_back('N');
+        put(buffer.data, id);
+        putString(buffer.data, str);
+    }
+
+    buffer.strings.emplace(str, id);
+    return id;
+}
+
+uint32_t
+BinaryLogger::internFormat(ThreadBuffer &buffer, const char *fmt)
+{
+    // Format strings are almost always literals, so look them up by
+    // address and only compare the contents to catch reused buffers.
+    auto it = buffer.formats.find(fmt);
+    if (it != buffer.formats.end() && it->second.first == fmt)
+        return it->second.second;
+
+    std::string str(fmt);
+    const uint32_t id = intern(buffer, str);
+    buffer.formats[fmt] = { std::move(str), id };
+    return id;
+}
+
+std::string &
+BinaryLogger::rawBuffer()
+{
+    return threadBuffer().args;
+}
+
+void
+BinaryLogger::logRaw(Tick when, const std::string &name,
+                     const std::string &flag, const char *fmt,
+                     const std::string &args)
+{
+    ThreadBuffer &buffer = threadBuffer();
+
+    const uint32_t name_id = intern(buffer, name);
+    const uint32_t flag_id = intern(buffer, flag);
+    const uint32_t fmt_id = internFormat(buffer, fmt);
+
+    buffer.data.push_back('R');
+    put<uint64_t>(buffer.data, when);
+    put(buffer.data, name_id);
+    put(buffer.data, flag_id);
+    put(buffer.data, fmt_id);
+    putString(buffer.data, args);
+
+    submit(buffer);
+}
+
+void
+BinaryLogger::logMessage(Tick when, const std::string &name,
+                         const std::string &flag, const std::string &message)
+{
+    if (!isEnabled(name))
+        return;
+
+    ThreadBuffer &buffer = threadBuffer();
+
+    const uint32_t name_id = intern(buffer, name);
+    const uint32_t flag_id = intern(buffer, flag);
+
+    buffer.data.push_back('M');
+    put<uint64_t>(buffer.data, when);
+    put(buffer.data, name_id);
+    put(buffer.data, flag_id);
+    putString(buffer.data, message);
+
+    submit(buffer);
+}
+
+void
+BinaryLogger::submit(ThreadBuffer &buffer, bool force)
+{
+    if (buffer.data.empty() || (!force && buffer.data.size() < bufferSize))
+        return;
+
+    std::string next;
+    {
+        std::unique_lock<std::mutex> lock(writerLock);
+        writerCond.wait(lock, [this]() {
+            return pending.size() < MaxPending;
+        });
+
+        pending.emplace_back(std::move(buffer.data));
+        if (!spare.empty()) {
+            next = std::move(spare.back());
+            spare.pop_back();
+        }
+    }
+    writerCond.notify_all();
+
+    next.clear();
+    next.reserve(bufferSize);
+    buffer.data = std::move(next);
+}
+
+void
+BinaryLogger::flush()
+{
+    text.flush();
+
+    {
+        std::lock_guard<std::mutex> lock(bufferLock);
+        for (auto &buffer : buffers)
+            submit(*buffer, true);
+    }
+
+    std::unique_lock<std::mutex> lock(writerLock);
+    writerCond.wait(lock, [this]() {
+        return pending.empty() && writing == 0;
+    });
+    stream.flush();
+}
+
+void
+BinaryLogger::writeLoop()
+{
+    std::unique_lock<std::mutex> lock(writerLock);
+    while (true) {
+        writerCond.wait(lock, [this]() {
+            return stopping || !pending.empty();
+        });
+        if (pending.empty())
+            return;
+
+        std::string data = std::move(pending.front());
+        pending.pop_front();
+        ++writing;
+
+        lock.unlock();
+        writerCond.notify_all();
+        stream.write(data.data(), data.size());
+        lock.lock();
+
+        --writing;
+        spare.emplace_back(std::move(data));
+        writerCond.notify_all();
+    }
+}
+
+} // namespace trace
+} // namespace gem5
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_BINARY_LOGGER_HH__
+#define __BASE_BINARY_LOGGER_HH__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base/trace.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+namespace trace
+{
+
+/**
+ * Debug logger that records messages in a compact binary form and
+ * leaves the formatting to util/decode_binary_trace.py.
+ *
+ * DPRINTFs only encode their tick, object name, flag, format string
+ * and raw arguments (@sa RawArg) into a buffer private to the calling
+ * thread. Names, flags and format strings are interned: the first use
+ * of a string emits a definition record and later records refer to
+ * its id. Full buffers are handed to a background thread which writes
+ * them out, so the simulation threads never wait on the file system
+ * unless the writer falls behind.
+ *
+ * The file starts with the magic "gem5trc\0", a 32 bit version and a
+ * 32 bit byte order mark (0x01020304 in host byte order), followed by
+ * records in host byte order. Each record starts with a one byte type:
+ *
+ *  - 'N': u32 id, string. Defines an interned string.
+ *  - 'R': u64 tick, u32 name id, u32 flag id, u32 format id,
+ *         u32 length, encoded arguments. A DPRINTF.
+ *  - 'M': u64 tick, u32 name id, u32 flag id, string. A message that
+ *         was already formatted, e.g., from DDUMP or output().
+ *
+ * Strings are stored as a u32 length followed by the characters.
+ * Records from different threads are not ordered by tick.
+ */
+class BinaryLogger : public Logger
+{
+  public:
+    static constexpr uint32_t Version = 1;
+
+    /**
+     * @param stream Stream to write to, which must outlive the logger.
+     * @param buffer_size Size of each per-thread buffer in bytes.
+     */
+    BinaryLogger(std::ostream &stream, size_t buffer_size = 1 << 20);
+
+    /** Write to a file in the output directory, closed on destruction. */
+    BinaryLogger(OutputStream *os, size_t buffer_size = 1 << 20);
+
+    ~BinaryLogger();
+
+    BinaryLogger(const BinaryLogger &other) = delete;
+    BinaryLogger &operator=(const BinaryLogger &other) = delete;
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    std::ostream &getOstream() override { return text; }
+
+    /**
+     * Write out the buffers of all threads and wait for the writer.
+     * No other thread may log messages while this is in progress.
+     */
+    void flush();
+
+  protected:
+    std::string &rawBuffer() override;
+
+    void logRaw(Tick when, const std::string &name, const std::string &flag,
+                const char *fmt, const std::string &args) override;
+
+  private:
+    /** Records of one thread that have not been handed out yet */
+    struct ThreadBuffer
+    {
+        std::string data;
+        /** Scratch space for the arguments of the message in flight */
+        std::string args;
+
+        /** Interned strings this thread already emitted or saw */
+        std::unordered_map<std::string, uint32_t> strings;
+        /** Format strings by address, checked on every use */
+        std::unordered_map<const char *,
+                           std::pair<std::string, uint32_t>> formats;
+    };
+
+    /** Forward the text written to getOstream() as messages */
+    class TextBuf : public std::stringbuf
+    {
+      private:
+        BinaryLogger &logger;
+
+      public:
+        TextBuf(BinaryLogger &_logger) : logger(_logger) {}
+
+      protected:
+        int sync() override;
+    };
+
+    ThreadBuffer &threadBuffer();
+
+    uint32_t intern(ThreadBuffer &buffer, const std::string &str);
+    uint32_t internFormat(ThreadBuffer &buffer, const char *fmt);
+
+    /** Hand the records of a thread to the writer if they are full */
+    void submit(ThreadBuffer &buffer, bool force = false);
+
+    /** Main loop of the writer thread */
+    void writeLoop();
+
+    OutputStream *outputStream;
+    std::ostream &stream;
+    const size_t bufferSize;
+
+    /** Identifies this logger in the thread local buffer caches */
+    const uint64_t serial;
+
+    TextBuf textBuf;
+    std::ostream text;
+
+    /** Protects buffers and ids */
+    std::mutex bufferLock;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::unordered_map<std::string, uint32_t> ids;
+
+    /** Protects the writer state below */
+    std::mutex writerLock;
+    std::condition_variable writerCond;
+    /** Full buffers waiting to be written */
+    std::deque<std::string> pending;
+    /** Written buffers that can be reused */
+    std::vector<std::string> spare;
+    /** Number of buffers being written */
+    unsigned writing;
+    bool stopping;
+
+    std::thread writer;
+};
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __BASE_BINARY_LOGGER_HH__
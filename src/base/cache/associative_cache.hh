@@ -97,6 +97,21 @@ class AssociativeCache : public Named
         }
     }
 
+    /**
+     * Get the possible entries of a key, in place when the indexing
+     * policy exposes the key's set and in storage otherwise.
+     */
+    const std::vector<ReplaceableEntry*>&
+    getCandidates(const KeyType &key,
+                  std::vector<ReplaceableEntry*> &storage) const
+    {
+        if (const auto *set = indexingPolicy->getPossibleSet(key)) {
+            return *set;
+        }
+        storage = indexingPolicy->getPossibleEntries(key);
+        return storage;
+    }
+
   public:
 
     /**
@@ -208,7 +223,8 @@ class AssociativeCache : public Named
     virtual Entry*
     findEntry(const KeyType &key) const
     {
-        auto candidates = indexingPolicy->getPossibleEntries(key);
+        std::vector<ReplaceableEntry*> storage;
+        const auto &candidates = getCandidates(key, storage);
 
         for (auto candidate : candidates) {
             Entry *entry = static_cast<Entry*>(candidate);
@@ -228,7 +244,8 @@ class AssociativeCache : public Named
     virtual Entry*
     findVictim(const KeyType &key)
     {
-        auto candidates = indexingPolicy->getPossibleEntries(key);
+        std::vector<ReplaceableEntry*> storage;
+        const auto &candidates = getCandidates(key, storage);
 
         auto victim = static_cast<Entry*>(replPolicy->getVictim(candidates));
 
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/compressed_stream.hh"
+
+#if HAVE_LZ4
+#include <lz4frame.h>
+#endif
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+CompressedOfstream::CompressedOfstream(CodecFactory make_codec)
+    : std::ostream(nullptr), makeCodec(make_codec), buffer(*this)
+{
+    rdbuf(&buffer);
+}
+
+CompressedOfstream::~CompressedOfstream()
+{
+    close();
+}
+
+void
+CompressedOfstream::open(const char *path, std::ios_base::openmode mode)
+{
+    if (opened)
+        return;
+
+    file.open(path, mode | std::ios::out | std::ios::binary);
+    if (!file.is_open())
+        return;
+
+    opened = true;
+    stopping = false;
+    clear();
+    current.resize(bufferSize);
+    buffer.reset(current);
+    worker = std::thread(&CompressedOfstream::workerMain, this, makeCodec());
+}
+
+void
+CompressedOfstream::close()
+{
+    if (!opened)
+        return;
+
+    handOver();
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+        wakeWorker.notify_one();
+    }
+    worker.join();
+    file.close();
+    opened = false;
+
+    // Writing to a closed stream fails in overflow().
+    current.clear();
+    buffer.reset(current);
+}
+
+void
+CompressedOfstream::handOver()
+{
+    size_t used = buffer.used();
+    if (used == 0)
+        return;
+    current.resize(used);
+
+    std::unique_lock<std::mutex> guard(lock);
+    compressed.wait(guard, [this]() { return pending.size() < maxPending; });
+    pending.push_back(std::move(current));
+    wakeWorker.notify_one();
+    if (!spare.empty()) {
+        current = std::move(spare.back());
+        spare.pop_back();
+    } else {
+        current = std::vector<char>();
+    }
+    guard.unlock();
+
+    current.resize(bufferSize);
+    buffer.reset(current);
+}
+
+void
+CompressedOfstream::workerMain(std::unique_ptr<Codec> codec)
+{
+    std::vector<char> out;
+    codec->begin(out);
+    file.write(out.data(), out.size());
+
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        wakeWorker.wait(guard, [this]() {
+            return !pending.empty() || stopping; });
+        if (pending.empty())
+            break;
+
+        std::vector<char> data = std::move(pending.front());
+        pending.pop_front();
+        guard.unlock();
+
+        out.clear();
+        codec->compress(data.data(), data.size(), out);
+        file.write(out.data(), out.size());
+
+        guard.lock();
+        spare.push_back(std::move(data));
+        compressed.notify_one();
+    }
+    guard.unlock();
+
+    out.clear();
+    codec->end(out);
+    file.write(out.data(), out.size());
+}
+
+void
+CompressedOfstream::Buffer::reset(std::vector<char> &data)
+{
+    setp(data.data(), data.data() + data.size());
+}
+
+CompressedOfstream::Buffer::int_type
+CompressedOfstream::Buffer::overflow(int_type c)
+{
+    if (!owner.opened)
+        return traits_type::eof();
+
+    owner.handOver();
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+namespace
+{
+
+#if HAVE_ZSTD
+class ZstdCodec : public CompressedOfstream::Codec
+{
+  private:
+    ZSTD_CCtx *const ctx;
+
+    void
+    run(ZSTD_inBuffer &in, ZSTD_EndDirective mode, std::vector<char> &out)
+    {
+        const size_t chunk = ZSTD_CStreamOutSize();
+        size_t remaining;
+        do {
+            size_t pos = out.size();
+            out.resize(pos + chunk);
+            ZSTD_outBuffer dst = { out.data() + pos, chunk, 0 };
+            remaining = ZSTD_compressStream2(ctx, &dst, &in, mode);
+            panic_if(ZSTD_isError(remaining), "zstd compression failed: %s",
+                     ZSTD_getErrorName(remaining));
+            out.resize(pos + dst.pos);
+        } while (mode == ZSTD_e_end ? remaining != 0 : in.pos < in.size);
+    }
+
+  public:
+    ZstdCodec() : ctx(ZSTD_createCCtx())
+    {
+        panic_if(!ctx, "Failed to create a zstd compression context.");
+    }
+
+    ~ZstdCodec() { ZSTD_freeCCtx(ctx); }
+
+    void begin(std::vector<char> &out) override {}
+
+    void
+    compress(const char *data, size_t size, std::vector<char> &out) override
+    {
+        ZSTD_inBuffer in = { data, size, 0 };
+        run(in, ZSTD_e_continue, out);
+    }
+
+    void
+    end(std::vector<char> &out) override
+    {
+        ZSTD_inBuffer in = { nullptr, 0, 0 };
+        run(in, ZSTD_e_end, out);
+    }
+};
+#endif
+
+#if HAVE_LZ4
+class Lz4Codec : public CompressedOfstream::Codec
+{
+  private:
+    LZ4F_cctx *ctx = nullptr;
+
+    void
+    check(size_t ret, const char *what)
+    {
+        panic_if(LZ4F_isError(ret), "LZ4 %s failed: %s", what,
+                 LZ4F_getErrorName(ret));
+    }
+
+  public:
+    Lz4Codec()
+    {
+        check(LZ4F_createCompressionContext(&ctx, LZ4F_VERSION),
+              "context creation");
+    }
+
+    ~Lz4Codec() { LZ4F_freeCompressionContext(ctx); }
+
+    void
+    begin(std::vector<char> &out) override
+    {
+        size_t pos = out.size();
+        out.resize(pos + LZ4F_HEADER_SIZE_MAX);
+        size_t n = LZ4F_compressBegin(ctx, out.data() + pos,
+                                      LZ4F_HEADER_SIZE_MAX, nullptr);
+        check(n, "compression");
+        out.resize(pos + n);
+    }
+
+    void
+    compress(const char *data, size_t size, std::vector<char> &out) override
+    {
+        size_t pos = out.size();
+        size_t bound = LZ4F_compressBound(size, nullptr);
+        out.resize(pos + bound);
+        size_t n = LZ4F_compressUpdate(ctx, out.data() + pos, bound,
+                                       data, size, nullptr);
+        check(n, "compression");
+        out.resize(pos + n);
+    }
+
+    void
+    end(std::vector<char> &out) override
+    {
+        size_t pos = out.size();
+        size_t bound = LZ4F_compressBound(0, nullptr);
+        out.resize(pos + bound);
+        size_t n = LZ4F_compressEnd(ctx, out.data() + pos, bound, nullptr);
+        check(n, "compression");
+        out.resize(pos + n);
+    }
+};
+#endif
+
+} // anonymous namespace
+
+#if HAVE_ZSTD
+ZstdOfstream::ZstdOfstream()
+    : CompressedOfstream([]() -> std::unique_ptr<Codec> {
+            return std::make_unique<ZstdCodec>(); })
+{}
+#endif
+
+#if HAVE_LZ4
+Lz4Ofstream::Lz4Ofstream()
+    : CompressedOfstream([]() -> std::unique_ptr<Codec> {
+            return std::make_unique<Lz4Codec>(); })
+{}
+#endif
+
+} // namespace gem5
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_COMPRESSED_STREAM_HH__
+#define __BASE_COMPRESSED_STREAM_HH__
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include "config/have_lz4.hh"
+#include "config/have_zstd.hh"
+
+namespace gem5
+{
+
+/**
+ * An output file stream which compresses its data on a background thread.
+ *
+ * The stream fills a buffer on the simulation thread, and hands it over to
+ * a worker thread when it is full. The worker compresses the buffers in
+ * order and writes them to the file. At most maxPending buffers wait for
+ * the worker, after which the simulation thread waits for it to catch up.
+ *
+ * Flushing the stream does not hand the buffer over, as flushing after
+ * every line would compress tiny blocks. Everything written is in the file
+ * once the stream is closed.
+ *
+ * The interface mimics the part of std::ofstream OutputFile uses.
+ * Subclasses pick the compression format.
+ */
+class CompressedOfstream : public std::ostream
+{
+  public:
+    /** A compression format, used by the worker only */
+    class Codec
+    {
+      public:
+        virtual ~Codec() = default;
+
+        /** Append the header of the compressed stream to out */
+        virtual void begin(std::vector<char> &out) = 0;
+
+        /** Append the compressed form of size bytes of data to out */
+        virtual void compress(const char *data, size_t size,
+                              std::vector<char> &out) = 0;
+
+        /** Append the end of the compressed stream to out */
+        virtual void end(std::vector<char> &out) = 0;
+    };
+
+    typedef std::unique_ptr<Codec> (*CodecFactory)();
+
+    ~CompressedOfstream();
+
+    void open(const char *path, std::ios_base::openmode mode);
+    bool is_open() const { return opened; }
+    void close();
+
+  protected:
+    CompressedOfstream(CodecFactory make_codec);
+
+  private:
+    /** Size of the buffers handed over to the worker */
+    static constexpr size_t bufferSize = 1 << 20;
+    /** Buffers which may wait for the worker before writing blocks */
+    static constexpr size_t maxPending = 4;
+
+    class Buffer : public std::streambuf
+    {
+      private:
+        CompressedOfstream &owner;
+
+      public:
+        Buffer(CompressedOfstream &_owner) : owner(_owner) {}
+
+        /** Write into data, which must not be resized meanwhile */
+        void reset(std::vector<char> &data);
+        size_t used() const { return pptr() - pbase(); }
+
+      protected:
+        int_type overflow(int_type c) override;
+    };
+
+    const CodecFactory makeCodec;
+    Buffer buffer;
+
+    /** The data the simulation thread is currently writing to */
+    std::vector<char> current;
+
+    /** Only the worker uses the file while it is open */
+    std::ofstream file;
+    bool opened = false;
+    std::thread worker;
+    std::mutex lock;
+    /** Signals a new buffer or a stop request to the worker */
+    std::condition_variable wakeWorker;
+    /** Signals the simulation thread that a buffer was compressed */
+    std::condition_variable compressed;
+    std::deque<std::vector<char>> pending;
+    /** Buffers the worker is done with, to be reused */
+    std::vector<std::vector<char>> spare;
+    bool stopping = false;
+
+    /** Hand the current buffer over to the worker and start a new one */
+    void handOver();
+    void workerMain(std::unique_ptr<Codec> codec);
+};
+
+#if HAVE_ZSTD
+/** A CompressedOfstream writing a zstd frame */
+class ZstdOfstream : public CompressedOfstream
+{
+  public:
+    ZstdOfstream();
+};
+#endif
+
+#if HAVE_LZ4
+/** A CompressedOfstream writing an LZ4 frame */
+class Lz4Ofstream : public CompressedOfstream
+{
+  public:
+    Lz4Ofstream();
+};
+#endif
+
+} // namespace gem5
+
+#endif // __BASE_COMPRESSED_STREAM_HH__
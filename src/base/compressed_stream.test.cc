@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "base/compressed_stream.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Frames the blocks it gets, to check the worker sees them in order */
+class TestCodec : public CompressedOfstream::Codec
+{
+  public:
+    void
+    begin(std::vector<char> &out) override
+    {
+        out.push_back('<');
+    }
+
+    void
+    compress(const char *data, size_t size, std::vector<char> &out) override
+    {
+        out.insert(out.end(), data, data + size);
+    }
+
+    void
+    end(std::vector<char> &out) override
+    {
+        out.push_back('>');
+    }
+};
+
+class TestOfstream : public CompressedOfstream
+{
+  public:
+    TestOfstream()
+        : CompressedOfstream([]() -> std::unique_ptr<Codec> {
+                return std::make_unique<TestCodec>(); })
+    {}
+};
+
+std::string
+tempPath()
+{
+    return "/tmp/compressed_stream.test." + std::to_string(getpid());
+}
+
+std::string
+readFile(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    return ss.str();
+}
+
+} // anonymous namespace
+
+TEST(CompressedStreamTest, WritesEverythingInOrder)
+{
+    std::string path = tempPath();
+    std::string expected;
+    {
+        TestOfstream os;
+        os.open(path.c_str(), std::ios::trunc);
+        ASSERT_TRUE(os.is_open());
+        // Enough data to go through several buffers and make the
+        // simulation thread wait for the worker.
+        for (int i = 0; i < 1000000; i++) {
+            std::string line = std::to_string(i) + "\n";
+            os << line << std::flush;
+            expected += line;
+        }
+    }
+    EXPECT_EQ(readFile(path), "<" + expected + ">");
+    std::remove(path.c_str());
+}
+
+TEST(CompressedStreamTest, Reopen)
+{
+    std::string path = tempPath();
+    TestOfstream os;
+    os.open(path.c_str(), std::ios::trunc);
+    os << "first";
+    os.close();
+    EXPECT_FALSE(os.is_open());
+    EXPECT_EQ(readFile(path), "<first>");
+
+    os.open(path.c_str(), std::ios::trunc);
+    ASSERT_TRUE(os.is_open());
+    os << "second";
+    os.close();
+    EXPECT_EQ(readFile(path), "<second>");
+    std::remove(path.c_str());
+}
+
+TEST(CompressedStreamTest, WriteAfterClose)
+{
+    std::string path = tempPath();
+    TestOfstream os;
+    os.open(path.c_str(), std::ios::trunc);
+    os.close();
+    os << "lost";
+    EXPECT_TRUE(os.bad());
+    EXPECT_EQ(readFile(path), "<>");
+    std::remove(path.c_str());
+}
@@ -195,6 +195,27 @@ class Coroutine : public Fiber
      */
     virtual ~Coroutine() {}
 
+    /**
+     * Run the task of the coroutine again from its start, reusing the
+     * stack of the coroutine rather than allocating another one. The
+     * previous run is abandoned if it had not finished, and the values
+     * it did not consume are dropped.
+     *
+     * @param run_coroutine set to false to disable running the coroutine
+     *                      immediately
+     *
+     * @ingroup api_coroutine
+     */
+    void
+    restart(bool run_coroutine = true)
+    {
+        this->reset();
+        argsChannel = ArgChannel();
+        caller.retChannel = RetChannel();
+        if (run_coroutine)
+            this->call();
+    }
+
   public:
     /** Coroutine interface */
 
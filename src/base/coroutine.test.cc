@@ -277,3 +277,37 @@ TEST(Coroutine, TwoCallers)
 
     ASSERT_TRUE(valid_return);
 }
+
+/**
+ * This test is checking that a coroutine can be restarted, both
+ * after it finished and while it is suspended, and that values
+ * yielded by the previous run are not seen by the new one.
+ */
+TEST(Coroutine, Restart)
+{
+    int runs = 0;
+    auto counting_task =
+    [&runs] (Coroutine<void, int>::CallerType& yield)
+    {
+        runs++;
+        yield(runs * 10);
+        yield(runs * 10 + 1);
+    };
+
+    Coroutine<void, int> coro(counting_task);
+    ASSERT_EQ(coro.get(), 10);
+    ASSERT_EQ(coro.get(), 11);
+    coro();
+    ASSERT_FALSE(coro);
+
+    coro.restart();
+    ASSERT_TRUE(coro);
+    ASSERT_EQ(runs, 2);
+    ASSERT_EQ(coro.get(), 20);
+
+    // Restart while suspended, the value 21 is never yielded
+    coro.restart(false);
+    ASSERT_FALSE(coro.started());
+    ASSERT_EQ(coro.get(), 30);
+    ASSERT_EQ(runs, 3);
+}
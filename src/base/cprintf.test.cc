@@ -180,3 +180,69 @@ TEST(CPrintf, SpecialFormatting)
     CPRINTF_TEST("%07.*f\n", 4, 1.234);
     CPRINTF_TEST("%#0*x\n", 9, 123412);
 }
+
+namespace
+{
+
+/**
+ * Values printed through their own operator<<, which cprintf formats
+ * with the stream's flags rather than its fast paths for built in types.
+ */
+template <typename T>
+struct Streamed
+{
+    T value;
+};
+
+template <typename T>
+std::ostream &
+operator<<(std::ostream &os, const Streamed<T> &s)
+{
+    return os << s.value;
+}
+
+template <typename T>
+void
+checkInteger(T value)
+{
+    static const char *formats[] = {
+        "%d", "%x", "%o", "%#x", "%#o", "%5d", "%-5d|", "%05d", "%#5x",
+        "%-#8x|", "%#010x", "%#018x", "%08o", "%#06o", "%30d", "%-30x|",
+        "%.3d", "%X", "%+d", "%lli",
+    };
+    for (const char *format : formats) {
+        EXPECT_EQ(csprintf(format, value),
+                  csprintf(format, Streamed<T>{value}))
+            << format << " " << +value;
+    }
+}
+
+} // anonymous namespace
+
+TEST(CPrintf, IntegersMatchStream)
+{
+    for (int64_t v : {0L, 1L, -1L, 42L, -42L, 0x7fffffffffffffffL,
+                      (int64_t)0x8000000000000000ULL}) {
+        checkInteger<int64_t>(v);
+        checkInteger<uint64_t>(v);
+        checkInteger<int>(v);
+        checkInteger<unsigned>(v);
+        checkInteger<short>(v);
+    }
+    CPRINTF_TEST("%d %x %#o %5d\n", 'A', (unsigned char)200,
+                 (signed char)-100, (short)-7);
+}
+
+TEST(CPrintf, PaddedStrings)
+{
+    std::string str = "padded";
+    const char *cstr = "padded";
+    for (const char *format : {"%s|", "%3s|", "%10s|", "%-10s|", "%40s|"}) {
+        std::string expected = csprintf(format, Streamed<std::string>{str});
+        EXPECT_EQ(csprintf(format, str), expected) << format;
+        EXPECT_EQ(csprintf(format, cstr), expected) << format;
+        EXPECT_EQ(csprintf(format, "padded"), expected) << format;
+    }
+    EXPECT_EQ(csprintf("%-*s|", 8, "ab"), "ab      |");
+    EXPECT_EQ(csprintf("%*s|", 4, str), "padded|");
+}
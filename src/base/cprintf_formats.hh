@@ -29,10 +29,14 @@
 #ifndef __BASE_CPRINTF_FORMATS_HH__
 #define __BASE_CPRINTF_FORMATS_HH__
 
+#include <algorithm>
+#include <charconv>
 #include <cstdint>
 #include <cstring>
 #include <ostream>
 #include <sstream>
+#include <string_view>
+#include <type_traits>
 
 #include "base/stl_helpers.hh"
 
@@ -103,10 +107,92 @@ _formatChar(std::ostream &out, const T &data, Format &fmt)
     out << data;
 }
 
+/**
+ * Print a built in integer with std::to_chars rather than the stream's
+ * num_put, which is most of the cost of printing it. This prints exactly
+ * what _formatInteger() would, and only handles the specifiers that don't
+ * need the stream's formatting flags.
+ *
+ * @return Whether the integer was printed.
+ */
+template <typename T>
+static inline bool
+_formatIntegerFast(std::ostream &out, T data, const Format &fmt)
+{
+    if (fmt.printSign || fmt.uppercase || out.width() != 0)
+        return false;
+
+    // room for 64 bits in octal, a prefix and the padding of most widths
+    char buf[64];
+    if (fmt.width >= (int)sizeof(buf) - 24)
+        return false;
+
+    char digits[24];
+    std::to_chars_result res;
+    const char *prefix = "";
+    switch (fmt.base) {
+      case Format::Dec:
+        res = std::to_chars(digits, digits + sizeof(digits), data);
+        break;
+      case Format::Hex:
+        // streams print signed integers in hex as their unsigned bits
+        res = std::to_chars(digits, digits + sizeof(digits),
+                            (std::make_unsigned_t<T>)data, 16);
+        prefix = "0x";
+        break;
+      case Format::Oct:
+        res = std::to_chars(digits, digits + sizeof(digits),
+                            (std::make_unsigned_t<T>)data, 8);
+        prefix = "0";
+        break;
+      default:
+        return false;
+    }
+
+    int width = fmt.width;
+    char *ptr = buf;
+    if (fmt.alternateForm && fmt.base != Format::Dec) {
+        // like std::showbase, which doesn't mark a zero, unless the
+        // number is padded with zeroes, which goes after the prefix
+        if (fmt.fillZero || data != 0) {
+            size_t len = std::strlen(prefix);
+            std::memcpy(ptr, prefix, len);
+            ptr += len;
+            if (fmt.fillZero)
+                width -= len;
+        }
+    }
+
+    int len = res.ptr - digits + (fmt.fillZero ? 0 : ptr - buf);
+    int pad = width > len ? width - len : 0;
+    if (fmt.fillZero) {
+        std::memset(ptr, '0', pad);
+        ptr += pad;
+    } else if (!fmt.flushLeft && pad) {
+        std::memmove(buf + pad, buf, ptr - buf);
+        std::memset(buf, ' ', pad);
+        ptr += pad;
+    }
+    std::memcpy(ptr, digits, res.ptr - digits);
+    ptr += res.ptr - digits;
+    if (!fmt.fillZero && fmt.flushLeft) {
+        std::memset(ptr, ' ', pad);
+        ptr += pad;
+    }
+
+    out.write(buf, ptr - buf);
+    return true;
+}
+
 template <typename T>
 static inline void
 _formatInteger(std::ostream &out, const T &data, Format &fmt)
 {
+    if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+        if (_formatIntegerFast(out, data, fmt))
+            return;
+    }
+
     std::ios::fmtflags flags(out.flags());
 
     switch (fmt.base) {
@@ -219,11 +305,49 @@ _formatFloat(std::ostream &out, const T &data, Format &fmt)
     out.flags(flags);
 }
 
+static inline void
+_writeSpaces(std::ostream &out, size_t count)
+{
+    static const char spaces[] = "                                ";
+    while (count > 0) {
+        size_t len = std::min(count, sizeof(spaces) - 1);
+        out.write(spaces, len);
+        count -= len;
+    }
+}
+
+/**
+ * Pad a string whose length is known without printing it to a temporary
+ * stream first.
+ */
+static inline void
+_formatPaddedString(std::ostream &out, std::string_view str, int width,
+                    bool flush_left)
+{
+    size_t pad = width > (int)str.size() ? width - str.size() : 0;
+    if (!flush_left)
+        _writeSpaces(out, pad);
+    out.write(str.data(), str.size());
+    if (flush_left)
+        _writeSpaces(out, pad);
+}
+
 template <typename T>
 static inline void
 _formatString(std::ostream &out, const T &data, Format &fmt)
 {
     using stl_helpers::operator<<;
+    if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+        // Arrays, such as string literals, are never null.
+        bool is_null = false;
+        if constexpr (std::is_pointer_v<T>)
+            is_null = data == nullptr;
+        if (fmt.width > 0 && out.width() == 0 && !is_null) {
+            _formatPaddedString(out, data, fmt.width, fmt.flushLeft);
+            return;
+        }
+    }
+
     if (fmt.width > 0) {
         std::stringstream foo;
         foo << data;
@@ -162,6 +162,14 @@ Fiber::start()
     link->run();
 }
 
+void
+Fiber::reset()
+{
+    panic_if(_currentFiber == this, "Cannot reset the running fiber.");
+    _started = false;
+    _finished = false;
+}
+
 void
 Fiber::run()
 {
@@ -141,6 +141,14 @@ class Fiber
 
     void setStarted() { _started = true; }
 
+    /**
+     * Make this fiber start its main() function over the next time it
+     * runs, reusing its stack. Whatever the fiber was doing, if it had
+     * not finished, is abandoned without unwinding its stack, as when a
+     * fiber is destroyed. The fiber must not be the one running.
+     */
+    void reset();
+
   private:
     static void entryTrampoline();
     void start();
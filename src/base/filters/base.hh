@@ -33,8 +33,8 @@
 #include <vector>
 
 #include "base/compiler.hh"
+#include "base/filters/packed_counters.hh"
 #include "base/intmath.hh"
-#include "base/sat_counter.hh"
 #include "base/types.hh"
 #include "params/BloomFilterBase.hh"
 #include "sim/sim_object.hh"
@@ -52,7 +52,7 @@ class Base : public SimObject
     const unsigned offsetBits;
 
     /** The filter itself. */
-    std::vector<SatCounter8> filter;
+    PackedCounters filter;
 
     /** Number of bits needed to represent the size of the filter. */
     const int sizeBits;
@@ -66,7 +66,7 @@ class Base : public SimObject
      */
     Base(const BloomFilterBaseParams &p)
         : SimObject(p), offsetBits(p.offset_bits),
-          filter(p.size, SatCounter8(p.num_bits)),
+          filter(p.size, p.num_bits),
           sizeBits(floorLog2(p.size)), setThreshold(p.threshold)
     {
         clear();
@@ -78,9 +78,7 @@ class Base : public SimObject
      */
     virtual void clear()
     {
-        for (auto& entry : filter) {
-            entry.reset();
-        }
+        filter.reset();
     }
 
     /**
@@ -93,9 +91,7 @@ class Base : public SimObject
     merge(const Base* other)
     {
         assert(filter.size() == other->filter.size());
-        for (int i = 0; i < filter.size(); ++i){
-            filter[i] += other->filter[i];
-        }
+        filter.merge(other->filter);
     }
 
     /**
@@ -115,6 +111,19 @@ class Base : public SimObject
      */
     virtual void unset(Addr addr) {};
 
+    /**
+     * Set the entries of several addresses.
+     *
+     * @param addrs The addresses being parsed.
+     */
+    virtual void
+    setBatch(const std::vector<Addr> &addrs)
+    {
+        for (const auto addr : addrs) {
+            set(addr);
+        }
+    }
+
     /**
      * Check if the corresponding filter entries of an address should be
      * considered as set.
@@ -136,6 +145,22 @@ class Base : public SimObject
      */
     virtual int getCount(Addr addr) const { return 0; }
 
+    /**
+     * Get the values stored in the filter entries of several addresses.
+     *
+     * @param addrs The addresses being parsed.
+     * @param counts Filled with the value of each address.
+     */
+    virtual void
+    getCountBatch(const std::vector<Addr> &addrs,
+                  std::vector<int> &counts) const
+    {
+        counts.resize(addrs.size());
+        for (size_t i = 0; i < addrs.size(); i++) {
+            counts[i] = getCount(addrs[i]);
+        }
+    }
+
     /**
      * Get the total value stored in the filter entries.
      *
@@ -143,11 +168,7 @@ class Base : public SimObject
      */
     virtual int getTotalCount() const
     {
-        int count = 0;
-        for (const auto& entry : filter) {
-            count += entry;
-        }
-        return count;
+        return filter.total();
     }
 };
 
@@ -65,19 +65,19 @@ Block::~Block()
 void
 Block::set(Addr addr)
 {
-    filter[hash(addr)]++;
+    filter.increment(hash(addr));
 }
 
 void
 Block::unset(Addr addr)
 {
-    filter[hash(addr)]--;
+    filter.decrement(hash(addr));
 }
 
 int
 Block::getCount(Addr addr) const
 {
-    return filter[hash(addr)];
+    return filter.get(hash(addr));
 }
 
 int
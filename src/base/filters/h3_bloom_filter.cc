@@ -363,6 +363,35 @@ static int H3Matrix[64][16] = {
       394261773,  848616745,  15446017,   517723271,  },
 };
 
+/**
+ * The H3Matrix folded into per-byte tables: the hash of an address is the
+ * XOR of one entry per byte, selected by the value of the byte, instead
+ * of one matrix row per bit set.
+ */
+struct H3ByteTables
+{
+    int table[16][8][256];
+
+    H3ByteTables()
+    {
+        for (int hash_number = 0; hash_number < 16; hash_number++) {
+            for (int byte = 0; byte < 8; byte++) {
+                for (int value = 0; value < 256; value++) {
+                    int result = 0;
+                    for (int bit = 0; bit < 8; bit++) {
+                        if (value & (1 << bit)) {
+                            result ^= H3Matrix[byte * 8 + bit][hash_number];
+                        }
+                    }
+                    table[hash_number][byte][value] = result;
+                }
+            }
+        }
+    }
+};
+
+static const H3ByteTables h3ByteTables;
+
 H3::H3(const BloomFilterH3Params &p)
     : MultiBitSel(p)
 {
@@ -378,12 +407,11 @@ H3::hash(Addr addr, int hash_number) const
 {
     uint64_t val =
         bits(addr, std::numeric_limits<Addr>::digits - 1, offsetBits);
+    const auto &table = h3ByteTables.table[hash_number];
     int result = 0;
 
-    for (int i = 0; (i < 64) && val; i++, val >>= 1) {
-        if (val & 1) {
-            result ^= H3Matrix[i][hash_number];
-        }
+    for (int byte = 0; val; byte++, val >>= 8) {
+        result ^= table[byte][val & 0xff];
     }
 
     if (isParallel) {
@@ -60,7 +60,7 @@ void
 MultiBitSel::set(Addr addr)
 {
     for (int i = 0; i < numHashes; i++) {
-        filter[hash(addr, i)]++;
+        filter.increment(hash(addr, i));
     }
 }
 
@@ -69,7 +69,7 @@ MultiBitSel::getCount(Addr addr) const
 {
     int count = 0;
     for (int i=0; i < numHashes; i++) {
-        count += filter[hash(addr, i)];
+        count += filter.get(hash(addr, i));
     }
     return count;
 }
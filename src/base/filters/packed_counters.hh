@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_FILTERS_PACKED_COUNTERS_HH__
+#define __BASE_FILTERS_PACKED_COUNTERS_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace bloom_filter
+{
+
+/**
+ * An array of saturating counters of a few bits each, packed into 64-bit
+ * words. The counters behave like SatCounter8s, but take num_bits bits
+ * instead of three bytes each, which is 24 times less for the common
+ * filters of 1-bit entries. With 1-bit counters, merges and total counts
+ * work on whole words.
+ */
+class PackedCounters
+{
+  private:
+    /** Number of counters. */
+    size_t _size;
+
+    /** Number of bits of each counter. */
+    const unsigned numBits;
+
+    /** Value at which the counters saturate. */
+    const uint8_t maxValue;
+
+    /** Number of counters per word, none of which straddle two words. */
+    const unsigned perWord;
+
+    std::vector<uint64_t> words;
+
+    unsigned
+    shift(size_t index) const
+    {
+        return (index % perWord) * numBits;
+    }
+
+    void
+    put(size_t index, uint8_t value)
+    {
+        uint64_t &word = words[index / perWord];
+        const unsigned pos = shift(index);
+        word = (word & ~((uint64_t)maxValue << pos)) |
+               ((uint64_t)value << pos);
+    }
+
+  public:
+    /**
+     * Create the counters, all set to zero.
+     *
+     * @param size Number of counters.
+     * @param num_bits Number of bits of each counter (at most 8).
+     */
+    PackedCounters(size_t size, unsigned num_bits)
+        : _size(size), numBits(num_bits), maxValue(mask(num_bits)),
+          perWord(num_bits ? 64 / num_bits : 1)
+    {
+        fatal_if(num_bits > 8, "Number of bits exceeds counter size");
+        fatal_if(num_bits == 0, "Counters need at least one bit");
+        words.resize(divCeil(size, perWord), 0);
+    }
+
+    size_t size() const { return _size; }
+
+    /** Get the value of a counter. */
+    uint8_t
+    get(size_t index) const
+    {
+        assert(index < _size);
+        return (words[index / perWord] >> shift(index)) & maxValue;
+    }
+
+    /** Increment a counter, unless it is saturated. */
+    void
+    increment(size_t index)
+    {
+        const uint8_t value = get(index);
+        if (value < maxValue)
+            put(index, value + 1);
+    }
+
+    /** Decrement a counter, unless it is zero. */
+    void
+    decrement(size_t index)
+    {
+        const uint8_t value = get(index);
+        if (value > 0)
+            put(index, value - 1);
+    }
+
+    /** Set all the counters to zero. */
+    void reset() { std::fill(words.begin(), words.end(), 0); }
+
+    /**
+     * Add the counters of another array to these, saturating.
+     *
+     * @param other Counters of the same size and number of bits.
+     */
+    void
+    merge(const PackedCounters &other)
+    {
+        assert(_size == other._size && numBits == other.numBits);
+        if (numBits == 1) {
+            for (size_t i = 0; i < words.size(); i++)
+                words[i] |= other.words[i];
+        } else {
+            for (size_t i = 0; i < _size; i++) {
+                put(i, std::min<unsigned>(get(i) + other.get(i),
+                                          maxValue));
+            }
+        }
+    }
+
+    /** Get the sum of all the counters. */
+    int
+    total() const
+    {
+        int count = 0;
+        if (numBits == 1) {
+            for (const auto word : words)
+                count += popCount(word);
+        } else {
+            for (size_t i = 0; i < _size; i++)
+                count += get(i);
+        }
+        return count;
+    }
+};
+
+} // namespace bloom_filter
+} // namespace gem5
+
+#endif // __BASE_FILTERS_PACKED_COUNTERS_HH__
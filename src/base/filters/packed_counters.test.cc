@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest-spi.h>
+#include <gtest/gtest.h>
+
+#include "base/filters/packed_counters.hh"
+#include "base/gtest/logging.hh"
+
+using namespace gem5;
+using bloom_filter::PackedCounters;
+
+/** Test that the counters saturate like SatCounters. */
+TEST(PackedCountersTest, Saturate)
+{
+    PackedCounters counters(10, 3);
+    for (int i = 0; i < 10; i++) {
+        counters.increment(4);
+    }
+    EXPECT_EQ(counters.get(4), 7);
+    EXPECT_EQ(counters.get(3), 0);
+    EXPECT_EQ(counters.get(5), 0);
+
+    counters.decrement(3);
+    EXPECT_EQ(counters.get(3), 0);
+    counters.decrement(4);
+    EXPECT_EQ(counters.get(4), 6);
+}
+
+/** Test that neighbouring counters, across words, are independent. */
+TEST(PackedCountersTest, Independent)
+{
+    // 21 3-bit counters per word
+    PackedCounters counters(100, 3);
+    for (int i = 0; i < 100; i++) {
+        for (int j = 0; j < i % 8; j++) {
+            counters.increment(i);
+        }
+    }
+
+    int total = 0;
+    for (int i = 0; i < 100; i++) {
+        EXPECT_EQ(counters.get(i), i % 8);
+        total += i % 8;
+    }
+    EXPECT_EQ(counters.total(), total);
+
+    counters.reset();
+    EXPECT_EQ(counters.total(), 0);
+}
+
+/** Test merging multi-bit counters, which saturate when added. */
+TEST(PackedCountersTest, Merge)
+{
+    PackedCounters a(30, 2);
+    PackedCounters b(30, 2);
+    a.increment(1);
+    a.increment(2);
+    a.increment(2);
+    b.increment(2);
+    b.increment(2);
+    b.increment(29);
+
+    a.merge(b);
+    EXPECT_EQ(a.get(1), 1);
+    EXPECT_EQ(a.get(2), 3);
+    EXPECT_EQ(a.get(29), 1);
+    EXPECT_EQ(a.total(), 5);
+}
+
+/** Test the word-wise operations of 1-bit counters. */
+TEST(PackedCountersTest, SingleBit)
+{
+    PackedCounters a(130, 1);
+    PackedCounters b(130, 1);
+    a.increment(0);
+    a.increment(64);
+    a.increment(64);
+    b.increment(64);
+    b.increment(129);
+
+    a.merge(b);
+    EXPECT_EQ(a.get(0), 1);
+    EXPECT_EQ(a.get(63), 0);
+    EXPECT_EQ(a.get(64), 1);
+    EXPECT_EQ(a.get(129), 1);
+    EXPECT_EQ(a.total(), 3);
+}
+
+/** Test that an error is triggered for counters that are too large. */
+TEST(PackedCountersDeathTest, BitCountExceeds)
+{
+    gtestLogOutput.str("");
+    EXPECT_ANY_THROW(PackedCounters counters(4, 9));
+    ASSERT_NE(gtestLogOutput.str().find("Number of bits exceeds counter size"),
+        std::string::npos);
+}
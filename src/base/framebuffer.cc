@@ -39,6 +39,9 @@
 
 #include <zlib.h>
 
+#include <algorithm>
+#include <cstring>
+
 #include "base/bitfield.hh"
 
 namespace gem5
@@ -129,4 +132,57 @@ FrameBuffer::getHash() const
                    area() * sizeof(Pixel));
 }
 
+FrameBuffer::Rect
+FrameBuffer::changedArea(const FrameBuffer &other) const
+{
+    assert(_width == other._width && _height == other._height);
+
+    Rect rect;
+    unsigned x_end = 0;
+    unsigned y_end = 0;
+    rect.x = _width;
+    for (unsigned y = 0; y < _height; ++y) {
+        const Pixel *line = &pixels[y * _width];
+        const Pixel *other_line = &other.pixels[y * _width];
+        // Pixels have no holes (padding is always zero), so rows can
+        // be compared as plain memory.
+        if (!std::memcmp(line, other_line, _width * sizeof(Pixel)))
+            continue;
+
+        if (!y_end)
+            rect.y = y;
+        y_end = y + 1;
+
+        unsigned first = 0;
+        while (line[first] == other_line[first])
+            ++first;
+        unsigned last = _width;
+        while (line[last - 1] == other_line[last - 1])
+            --last;
+        rect.x = std::min(rect.x, first);
+        x_end = std::max(x_end, last);
+    }
+
+    if (!y_end)
+        return Rect();
+
+    rect.width = x_end - rect.x;
+    rect.height = y_end - rect.y;
+    return rect;
+}
+
+void
+FrameBuffer::copyArea(const FrameBuffer &other, const Rect &area)
+{
+    assert(_width == other._width && _height == other._height);
+    assert(area.x + area.width <= _width);
+    assert(area.y + area.height <= _height);
+
+    for (unsigned y = area.y; y < area.y + area.height; ++y) {
+        const auto offset = y * _width + area.x;
+        std::copy_n(other.pixels.begin() + offset, area.width,
+                    pixels.begin() + offset);
+    }
+}
+
 } // namespace gem5
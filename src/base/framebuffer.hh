@@ -68,6 +68,17 @@ namespace gem5
 class FrameBuffer : public Serializable
 {
   public:
+    /** Rectangular area within a frame buffer */
+    struct Rect
+    {
+        unsigned x = 0;
+        unsigned y = 0;
+        unsigned width = 0;
+        unsigned height = 0;
+
+        bool empty() const { return width == 0 || height == 0; }
+    };
+
     /**
      * Create a frame buffer of a given size.
      *
@@ -183,6 +194,23 @@ class FrameBuffer : public Serializable
      */
     uint64_t getHash() const;
 
+    /**
+     * Find the area that changed compared to another frame buffer.
+     *
+     * @param other Frame buffer of the same size to compare with.
+     * @return Bounding rectangle of the pixels that differ, empty if
+     * the frame buffers are identical.
+     */
+    Rect changedArea(const FrameBuffer &other) const;
+
+    /**
+     * Copy an area from another frame buffer of the same size.
+     *
+     * @param other Frame buffer to copy pixels from.
+     * @param area Area to copy.
+     */
+    void copyArea(const FrameBuffer &other, const Rect &area);
+
     /**
      * Static "dummy" frame buffer.
      *
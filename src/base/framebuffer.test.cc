@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "base/framebuffer.hh"
+
+using namespace gem5;
+
+TEST(FrameBufferTest, IdenticalHasNoChangedArea)
+{
+    FrameBuffer a(16, 8);
+    FrameBuffer b(16, 8);
+    EXPECT_TRUE(a.changedArea(b).empty());
+}
+
+TEST(FrameBufferTest, ChangedAreaBoundsAllChanges)
+{
+    FrameBuffer a(16, 8);
+    FrameBuffer b(16, 8);
+    a.pixel(3, 2) = Pixel(1, 0, 0);
+    a.pixel(10, 5) = Pixel(0, 1, 0);
+
+    auto rect = a.changedArea(b);
+    EXPECT_EQ(rect.x, 3);
+    EXPECT_EQ(rect.y, 2);
+    EXPECT_EQ(rect.width, 8);
+    EXPECT_EQ(rect.height, 4);
+}
+
+TEST(FrameBufferTest, ChangedAreaLastPixel)
+{
+    FrameBuffer a(16, 8);
+    FrameBuffer b(16, 8);
+    a.pixel(15, 7) = Pixel(0, 0, 1);
+
+    auto rect = a.changedArea(b);
+    EXPECT_EQ(rect.x, 15);
+    EXPECT_EQ(rect.y, 7);
+    EXPECT_EQ(rect.width, 1);
+    EXPECT_EQ(rect.height, 1);
+}
+
+TEST(FrameBufferTest, CopyArea)
+{
+    FrameBuffer a(16, 8);
+    FrameBuffer b(16, 8);
+    a.pixel(0, 0) = Pixel(1, 2, 3);
+    a.pixel(7, 3) = Pixel(4, 5, 6);
+
+    b.copyArea(a, a.changedArea(b));
+    EXPECT_TRUE(a.changedArea(b).empty());
+    EXPECT_EQ(b.pixel(7, 3), Pixel(4, 5, 6));
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Checked host floating point arithmetic, for the software floating point
+ * implementations of the ISAs.
+ *
+ * Rounding to nearest, with normal operands and a normal result far enough
+ * from the underflow threshold, IEEE 754 arithmetic leaves nothing to the
+ * architecture: no NaN propagation, flushing to zero, or tininess
+ * detection is involved, and inexact is the only exception possible. The
+ * functions below compute such operations on the host and recover the
+ * inexact flag exactly, with no need for the host floating point
+ * environment. They return false, leaving the result alone, when the
+ * operation is not of that kind and the caller has to compute it in
+ * software.
+ *
+ * Callers must check that the simulated rounding mode is round to nearest,
+ * ties to even. The host is expected to round that way too, which is the
+ * case outside of the code that changes it temporarily through
+ * setFpRound().
+ */
+
+#ifndef __BASE_HOST_FP_HH__
+#define __BASE_HOST_FP_HH__
+
+#include <cstdint>
+#include <cstring>
+
+namespace gem5
+{
+
+namespace host_fp
+{
+
+template <typename Float>
+struct Traits;
+
+template <>
+struct Traits<float>
+{
+    using Bits = uint32_t;
+    using Product = uint64_t;
+    static constexpr int mantBits = 23;
+    static constexpr int expBits = 8;
+};
+
+template <>
+struct Traits<double>
+{
+    using Bits = uint64_t;
+    using Product = __uint128_t;
+    static constexpr int mantBits = 52;
+    static constexpr int expBits = 11;
+};
+
+template <typename Float>
+constexpr typename Traits<Float>::Bits
+exponent(typename Traits<Float>::Bits x)
+{
+    using T = Traits<Float>;
+    return x >> T::mantBits & ((typename T::Bits(1) << T::expBits) - 1);
+}
+
+template <typename Float>
+constexpr bool
+isNormal(typename Traits<Float>::Bits x)
+{
+    using T = Traits<Float>;
+    auto exp = exponent<Float>(x);
+    return exp != 0 && exp != (typename T::Bits(1) << T::expBits) - 1;
+}
+
+// Excludes the smallest binade, which can be reached by rounding a tiny
+// value up.
+template <typename Float>
+constexpr bool
+isSafeResult(typename Traits<Float>::Bits x)
+{
+    return isNormal<Float>(x) && exponent<Float>(x) > 1;
+}
+
+template <typename Float>
+inline Float
+toHost(typename Traits<Float>::Bits x)
+{
+    Float f;
+    std::memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+template <typename Float>
+inline typename Traits<Float>::Bits
+fromHost(Float f)
+{
+    typename Traits<Float>::Bits x;
+    std::memcpy(&x, &f, sizeof(x));
+    return x;
+}
+
+} // namespace host_fp
+
+/**
+ * Add two floating point numbers given as their encodings.
+ *
+ * @param a The first operand.
+ * @param b The second operand.
+ * @param result Set to the sum when the host could compute it.
+ * @param inexact Set to whether the sum was rounded.
+ * @return Whether the host could compute the sum.
+ */
+template <typename Float>
+inline bool
+hostFpAdd(typename host_fp::Traits<Float>::Bits a,
+          typename host_fp::Traits<Float>::Bits b,
+          typename host_fp::Traits<Float>::Bits &result, bool &inexact)
+{
+    using namespace host_fp;
+    if (!isNormal<Float>(a) || !isNormal<Float>(b))
+        return false;
+
+    Float fa = toHost<Float>(a);
+    Float fb = toHost<Float>(b);
+    Float fx = fa + fb;
+    auto r = fromHost<Float>(fx);
+    if (!isSafeResult<Float>(r))
+        return false;
+
+    // The rounding error of a sum is itself representable (TwoSum).
+    Float fb_part = fx - fa;
+    Float err = (fa - (fx - fb_part)) + (fb - fb_part);
+    inexact = err != 0;
+    result = r;
+    return true;
+}
+
+/**
+ * Multiply two floating point numbers given as their encodings.
+ *
+ * @param a The first operand.
+ * @param b The second operand.
+ * @param result Set to the product when the host could compute it.
+ * @param inexact Set to whether the product was rounded.
+ * @return Whether the host could compute the product.
+ */
+template <typename Float>
+inline bool
+hostFpMul(typename host_fp::Traits<Float>::Bits a,
+          typename host_fp::Traits<Float>::Bits b,
+          typename host_fp::Traits<Float>::Bits &result, bool &inexact)
+{
+    using namespace host_fp;
+    using T = Traits<Float>;
+    using Product = typename T::Product;
+    if (!isNormal<Float>(a) || !isNormal<Float>(b))
+        return false;
+
+    auto r = fromHost<Float>(toHost<Float>(a) * toHost<Float>(b));
+    if (!isSafeResult<Float>(r))
+        return false;
+
+    // The product is exact iff the product of the significands fits in
+    // mantBits + 1 bits once its trailing zeroes are dropped.
+    constexpr typename T::Bits hidden = typename T::Bits(1) << T::mantBits;
+    constexpr typename T::Bits mant_mask = hidden - 1;
+    Product p = (Product)((a & mant_mask) | hidden) *
+                ((b & mant_mask) | hidden);
+    int width = (p >> (2 * T::mantBits + 1)) ? 2 * T::mantBits + 2 :
+                                              2 * T::mantBits + 1;
+    int shift = width - (T::mantBits + 1);
+    inexact = (p & ((Product(1) << shift) - 1)) != 0;
+    result = r;
+    return true;
+}
+
+} // namespace gem5
+
+#endif // __BASE_HOST_FP_HH__
@@ -40,6 +40,7 @@
 
 #include "base/loader/symtab.hh"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -54,10 +55,41 @@ namespace loader
 
 SymbolTable debugSymbolTable;
 
+SymbolTable::SymbolTable(const SymbolTable &other)
+    : symbols(other.symbols), nameMap(other.nameMap),
+      addrIndex(other.sortedAddrIndex())
+{
+}
+
+SymbolTable &
+SymbolTable::operator=(const SymbolTable &other)
+{
+    if (this != &other) {
+        symbols = other.symbols;
+        nameMap = other.nameMap;
+        addrIndex = other.sortedAddrIndex();
+        addrIndexSorted.store(true, std::memory_order_release);
+    }
+    return *this;
+}
+
+void
+SymbolTable::sortAddrIndex() const
+{
+    // lookups may come from several threads at once
+    std::lock_guard<std::mutex> lock(addrIndexMutex);
+    if (addrIndexSorted.load(std::memory_order_relaxed))
+        return;
+
+    std::sort(addrIndex.begin(), addrIndex.end());
+    addrIndexSorted.store(true, std::memory_order_release);
+}
+
 void
 SymbolTable::clear()
 {
-    addrMap.clear();
+    addrIndex.clear();
+    addrIndexSorted.store(true, std::memory_order_release);
     nameMap.clear();
     symbols.clear();
 }
@@ -74,8 +106,10 @@ SymbolTable::insert(const Symbol &symbol)
         return false;
 
     // There can be multiple symbols for the same address, so always
-    // update the addrTable multimap when we see a new symbol name.
-    addrMap.insert({ symbol.address(), idx });
+    // update the address index when we see a new symbol name.
+    if (!addrIndex.empty() && addrIndex.back().first > symbol.address())
+        addrIndexSorted.store(false, std::memory_order_relaxed);
+    addrIndex.emplace_back(symbol.address(), idx);
 
     symbols.emplace_back(symbol);
 
@@ -86,12 +120,11 @@ bool
 SymbolTable::insert(const SymbolTable &other)
 {
     // Check if any symbol in other already exists in our table.
-    NameMap intersection;
-    std::set_intersection(other.nameMap.begin(), other.nameMap.end(),
-                          nameMap.begin(), nameMap.end(),
-                          std::inserter(intersection, intersection.begin()),
-                          nameMap.value_comp());
-    if (!intersection.empty()) {
+    bool collision = std::any_of(other.begin(), other.end(),
+        [this](const Symbol &symbol) {
+            return nameMap.count(symbol.name()) != 0;
+        });
+    if (collision) {
         warn("Cannot insert a new symbol table due to name collisions. "
              "Adding prefix to each symbol's name can resolve this issue.");
         return false;
@@ -42,11 +42,15 @@
 #ifndef __BASE_LOADER_SYMTAB_HH__
 #define __BASE_LOADER_SYMTAB_HH__
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <iosfwd>
-#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -156,15 +160,39 @@ class SymbolTable
   private:
     /** Vector containing all the symbols in the table. */
     typedef std::vector<Symbol> SymbolVector;
-    /** Map addresses to an index into the symbol vector. */
-    typedef std::multimap<Addr, int> AddrMap;
+    /**
+     * Addresses with an index into the symbol vector, sorted by address
+     * and then by index, so that symbols with the same address are in
+     * the order they were inserted in.
+     */
+    typedef std::vector<std::pair<Addr, int>> AddrIndex;
     /** Map a symbol name to an index into the symbol vector. */
-    typedef std::map<std::string, int> NameMap;
+    typedef std::unordered_map<std::string, int> NameMap;
 
     SymbolVector symbols;
-    AddrMap addrMap;
     NameMap nameMap;
 
+    /**
+     * Symbols are looked up by address far more often than they are
+     * inserted, and tables are filled all at once when loading them.
+     * Inserting a symbol out of address order only appends it to the
+     * index, which is sorted again by the first lookup which follows.
+     */
+    mutable AddrIndex addrIndex;
+    mutable std::atomic<bool> addrIndexSorted{true};
+    mutable std::mutex addrIndexMutex;
+
+    /** Sort the address index, if a symbol was inserted out of order. */
+    const AddrIndex &
+    sortedAddrIndex() const
+    {
+        if (!addrIndexSorted.load(std::memory_order_acquire))
+            sortAddrIndex();
+        return addrIndex;
+    }
+
+    void sortAddrIndex() const;
+
     /**
      * Get the first address larger than the given address, if any.
      *
@@ -173,13 +201,18 @@ class SymbolTable
      * @return True if successful; false if no larger addresses exist.
      */
     bool
-    upperBound(Addr addr, AddrMap::const_iterator &iter) const
+    upperBound(Addr addr, AddrIndex::const_iterator &iter) const
     {
+        const AddrIndex &index = sortedAddrIndex();
+
         // find first key *larger* than desired address
-        iter = addrMap.upper_bound(addr);
+        iter = std::upper_bound(index.begin(), index.end(), addr,
+            [](Addr addr, const AddrIndex::value_type &entry) {
+                return addr < entry.first;
+            });
 
         // if very first key is larger, we're out of luck
-        if (iter == addrMap.begin())
+        if (iter == index.begin())
             return false;
 
         return true;
@@ -271,6 +304,10 @@ class SymbolTable
     typedef SymbolVector::iterator iterator;
     typedef SymbolVector::const_iterator const_iterator;
 
+    SymbolTable() = default;
+    SymbolTable(const SymbolTable &other);
+    SymbolTable &operator=(const SymbolTable &other);
+
     /** @return An iterator to the beginning of the symbol vector. */
     const_iterator begin() const { return symbols.begin(); }
 
@@ -434,8 +471,12 @@ class SymbolTable
     const_iterator
     find(Addr address) const
     {
-        AddrMap::const_iterator i = addrMap.find(address);
-        if (i == addrMap.end())
+        const AddrIndex &index = sortedAddrIndex();
+        auto i = std::lower_bound(index.begin(), index.end(), address,
+            [](const AddrIndex::value_type &entry, Addr addr) {
+                return entry.first < addr;
+            });
+        if (i == index.end() || i->first != address)
             return end();
 
         // There are potentially multiple symbols that map to the same
@@ -473,13 +514,13 @@ class SymbolTable
     const_iterator
     findNearest(Addr addr, Addr &next_addr) const
     {
-        AddrMap::const_iterator i = addrMap.end();
+        AddrIndex::const_iterator i;
         if (!upperBound(addr, i))
             return end();
 
         // If there is no next address, make it 0 since 0 is not larger than
         // any other address, so it is clear that next is not valid
-        if (i == addrMap.end()) {
+        if (i == addrIndex.end()) {
             next_addr = 0;
         } else {
             next_addr = i->first;
@@ -495,7 +536,7 @@ class SymbolTable
     const_iterator
     findNearest(Addr addr) const
     {
-        AddrMap::const_iterator i = addrMap.end();
+        AddrIndex::const_iterator i;
         if (!upperBound(addr, i))
             return end();
 
@@ -765,6 +765,80 @@ TEST(LoaderSymtabTest, FindNearestNonExistent)
     ASSERT_EQ(it, symtab.end());
 }
 
+/**
+ * Test that lookups by address work when the symbols are not inserted in
+ * address order, and keep finding new symbols inserted after a lookup.
+ */
+TEST(LoaderSymtabTest, FindNearestUnordered)
+{
+    loader::SymbolTable symtab;
+
+    loader::Symbol symbols[] = {
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol", 0x30},
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol2", 0x10},
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol3", 0x20},
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol4", 0x18},
+    };
+    EXPECT_TRUE(symtab.insert(symbols[0]));
+    EXPECT_TRUE(symtab.insert(symbols[1]));
+    EXPECT_TRUE(symtab.insert(symbols[2]));
+
+    Addr next_addr;
+    auto it = symtab.findNearest(0x1c, next_addr);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[1]);
+    ASSERT_EQ(next_addr, symbols[2].address());
+
+    EXPECT_TRUE(symtab.insert(symbols[3]));
+    it = symtab.findNearest(0x1c, next_addr);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[3]);
+    ASSERT_EQ(next_addr, symbols[2].address());
+
+    it = symtab.find(symbols[1].address());
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[1]);
+
+    // A copy of a table finds the same symbols
+    loader::SymbolTable copy(symtab);
+    it = copy.findNearest(0x2f);
+    ASSERT_NE(it, copy.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[2]);
+}
+
+/**
+ * Test that the nearest symbol of an address shared by several symbols is
+ * the last one inserted, even when they are not inserted in address order.
+ */
+TEST(LoaderSymtabTest, FindNearestNonUniqueAddress)
+{
+    loader::SymbolTable symtab;
+
+    loader::Symbol symbols[] = {
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol", 0x20},
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol2", 0x40},
+        {loader::Symbol::Binding::Local, loader::Symbol::SymbolType::Other,
+            "symbol3", 0x20},
+    };
+    EXPECT_TRUE(symtab.insert(symbols[0]));
+    EXPECT_TRUE(symtab.insert(symbols[1]));
+    EXPECT_TRUE(symtab.insert(symbols[2]));
+
+    auto it = symtab.findNearest(0x30);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[2]);
+
+    it = symtab.find(0x20);
+    ASSERT_NE(it, symtab.end());
+    ASSERT_PRED_FORMAT2(checkSymbol, *it, symbols[0]);
+}
+
 /**
  * Test that the insertion of a symbol table's symbols in another table works
  * when any symbol name conflicts.
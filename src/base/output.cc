@@ -54,6 +54,7 @@
 #include <cstdlib>
 #include <fstream>
 
+#include "base/compressed_stream.hh"
 #include "base/logging.hh"
 
 namespace gem5
@@ -61,6 +62,18 @@ namespace gem5
 
 OutputDirectory simout;
 
+namespace
+{
+
+bool
+hasSuffix(const std::string &name, const std::string &suffix)
+{
+    return name.size() >= suffix.size() &&
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+} // anonymous namespace
+
 
 OutputStream::OutputStream(const std::string &name, std::ostream *stream)
     : _name(name), _stream(stream)
@@ -228,12 +241,24 @@ OutputDirectory::open(const std::string &name,
 {
     OutputStream *os;
 
-    if (!no_gz && name.find(".gz", name.length() - 3) < name.length()) {
+    if (!no_gz && hasSuffix(name, ".gz")) {
         // Although we are creating an output stream, we still need to pass the
         // correct mode for gzofstream as this used directly to set the file
         // mode.
         mode |= std::ios::out;
         os = new OutputFile<gzofstream>(*this, name, mode, recreateable);
+    } else if (!no_gz && hasSuffix(name, ".zst")) {
+#if HAVE_ZSTD
+        os = new OutputFile<ZstdOfstream>(*this, name, mode, recreateable);
+#else
+        fatal("Can't create %s, gem5 was built without zstd.\n", name);
+#endif
+    } else if (!no_gz && hasSuffix(name, ".lz4")) {
+#if HAVE_LZ4
+        os = new OutputFile<Lz4Ofstream>(*this, name, mode, recreateable);
+#else
+        fatal("Can't create %s, gem5 was built without LZ4.\n", name);
+#endif
     } else {
         os = new OutputFile<std::ofstream>(*this, name, mode, recreateable);
     }
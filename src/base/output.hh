@@ -204,8 +204,9 @@ class OutputDirectory
     /**
      * Creates a file in this directory (optionally compressed).
      *
-     * Will open a file as a compressed stream if filename ends in .gz, unless
-     * explicitly disabled.
+     * Will open a file as a compressed stream if filename ends in .gz, .zst
+     * or .lz4, unless explicitly disabled. Zstd and LZ4 streams compress on
+     * a background thread.
      *
      * Relative output paths will result in the creation of a
      * recreateable (see OutputFile) output file in the current output
@@ -215,7 +216,7 @@ class OutputDirectory
      * @param name name of file to create (without this directory's name
      *          leading it)
      * @param binary true to create a binary file; false otherwise
-     * @param no_gz true to disable opening the file as a gzip compressed output
+     * @param no_gz true to disable opening the file as a compressed output
      *     stream; false otherwise
      * @return OutputStream instance representing the created file
      */
@@ -226,14 +227,15 @@ class OutputDirectory
     /**
      * Open a file in this directory (optionally compressed).
      *
-     * Will open a file as a compressed stream if filename ends in .gz, unless
-     * explicitly disabled.
+     * Will open a file as a compressed stream if filename ends in .gz, .zst
+     * or .lz4, unless explicitly disabled. Zstd and LZ4 streams compress on
+     * a background thread.
      *
      * @param filename file to open
      * @param mode attributes to open file with
      * @param recreateable Set to true if the file can be recreated in a new
      *     location.
-     * @param no_gz true to disable opening the file as a gzip compressed output
+     * @param no_gz true to disable opening the file as a compressed output
      *     stream; false otherwise
      * @return OutputStream instance representing the opened file
      */
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/pool_alloc.hh"
+
+#include <mutex>
+#include <vector>
+
+namespace gem5
+{
+
+struct PoolAllocator::Depot
+{
+    std::mutex mutex;
+
+    //! Full batches of free blocks, as linked lists of BatchSize blocks.
+    std::vector<FreeBlock *> batches[NumClasses];
+
+    //! Unused part of the current slab of every size class.
+    char *slabCur[NumClasses] = {};
+    char *slabEnd[NumClasses] = {};
+
+    std::uint64_t allocs = 0;
+    std::uint64_t bytes = 0;
+};
+
+PoolAllocator::Depot &
+PoolAllocator::depot()
+{
+    // Never destroyed, since objects may be freed during static
+    // destruction.
+    static Depot *depot = new Depot;
+    return *depot;
+}
+
+void
+PoolAllocator::refill(std::size_t cls)
+{
+    Depot &d = depot();
+    FreeList &list = freeLists[cls];
+
+    std::lock_guard<std::mutex> lock(d.mutex);
+    d.allocs += list.allocs;
+    list.allocs = 0;
+
+    auto &batches = d.batches[cls];
+    if (!batches.empty()) {
+        list.head = batches.back();
+        list.count = BatchSize;
+        batches.pop_back();
+        return;
+    }
+
+    const std::size_t block_size = (cls + 1) * Granularity;
+    if (d.slabCur[cls] == d.slabEnd[cls]) {
+        // A slab holds a whole number of batches.
+        const std::size_t slab_size = 16 * BatchSize * block_size;
+        d.slabCur[cls] = static_cast<char *>(::operator new(slab_size));
+        d.slabEnd[cls] = d.slabCur[cls] + slab_size;
+        d.bytes += slab_size;
+    }
+
+    auto *head = reinterpret_cast<FreeBlock *>(d.slabCur[cls]);
+    for (std::uint32_t i = 0; i < BatchSize; i++) {
+        auto *block = reinterpret_cast<FreeBlock *>(d.slabCur[cls]);
+        d.slabCur[cls] += block_size;
+        block->next = i + 1 < BatchSize ?
+            reinterpret_cast<FreeBlock *>(d.slabCur[cls]) : nullptr;
+    }
+
+    list.head = head;
+    list.count = BatchSize;
+}
+
+void
+PoolAllocator::spill(std::size_t cls)
+{
+    FreeList &list = freeLists[cls];
+
+    FreeBlock *batch = list.head;
+    FreeBlock *last = batch;
+    for (std::uint32_t i = 1; i < BatchSize; i++)
+        last = last->next;
+    list.head = last->next;
+    list.count -= BatchSize;
+    last->next = nullptr;
+
+    Depot &d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    d.allocs += list.allocs;
+    list.allocs = 0;
+    d.batches[cls].push_back(batch);
+}
+
+void
+PoolAllocator::report(std::size_t cls)
+{
+    FreeList &list = freeLists[cls];
+
+    Depot &d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    d.allocs += list.allocs;
+    list.allocs = 0;
+}
+
+std::uint64_t
+PoolAllocator::allocations()
+{
+    Depot &d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    return d.allocs;
+}
+
+std::uint64_t
+PoolAllocator::reservedBytes()
+{
+    Depot &d = depot();
+    std::lock_guard<std::mutex> lock(d.mutex);
+    return d.bytes;
+}
+
+} // namespace gem5
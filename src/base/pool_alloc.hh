@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_POOL_ALLOC_HH__
+#define __BASE_POOL_ALLOC_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace gem5
+{
+
+/**
+ * Allocator for small objects that are created and destroyed at a high
+ * rate, e.g., events that delete themselves after being processed.
+ *
+ * Allocations are rounded up to a multiple of Granularity bytes, and
+ * every size class has a free list per thread, so the common case
+ * neither takes a lock nor goes through the heap. Threads refill their
+ * lists from, and hand surplus blocks back to, a shared depot in
+ * batches. The depot carves new blocks out of large slabs, which keeps
+ * objects of the same size close together. Memory held by the pools is
+ * never returned to the system.
+ *
+ * Objects larger than MaxSize are forwarded to the global heap. So is
+ * everything when building with the address sanitizer, which would
+ * otherwise not see use-after-free errors on pooled objects.
+ */
+class PoolAllocator
+{
+  public:
+    static constexpr std::size_t Granularity = 16;
+    static constexpr std::size_t MaxSize = 512;
+    static constexpr std::size_t NumClasses = MaxSize / Granularity;
+
+    //! Number of blocks moved between a thread and the depot at a time.
+    static constexpr std::uint32_t BatchSize = 64;
+    //! Number of free blocks a thread keeps per size class.
+    static constexpr std::uint32_t MaxCached = 4 * BatchSize;
+    //! Number of allocations a thread counts before reporting them.
+    static constexpr std::uint32_t ReportInterval = 4096;
+
+#if defined(__SANITIZE_ADDRESS__)
+    static constexpr bool Enabled = false;
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+    static constexpr bool Enabled = false;
+#else
+    static constexpr bool Enabled = true;
+#endif
+#else
+    static constexpr bool Enabled = true;
+#endif
+
+    static void *
+    allocate(std::size_t size)
+    {
+        if (!Enabled || size > MaxSize || size == 0)
+            return ::operator new(size);
+
+        const std::size_t cls = sizeClass(size);
+        FreeList &list = freeLists[cls];
+        if (!list.head)
+            refill(cls);
+
+        FreeBlock *block = list.head;
+        list.head = block->next;
+        list.count--;
+        if (++list.allocs == ReportInterval)
+            report(cls);
+        return block;
+    }
+
+    static void
+    deallocate(void *ptr, std::size_t size)
+    {
+        if (!ptr)
+            return;
+
+        if (!Enabled || size > MaxSize || size == 0) {
+            ::operator delete(ptr);
+            return;
+        }
+
+        const std::size_t cls = sizeClass(size);
+        FreeList &list = freeLists[cls];
+        auto *block = static_cast<FreeBlock *>(ptr);
+        block->next = list.head;
+        list.head = block;
+        if (++list.count > MaxCached)
+            spill(cls);
+    }
+
+    /**
+     * Number of pooled allocations over all threads. Threads report
+     * their allocations to the depot from time to time, so the count
+     * may lag behind by up to ReportInterval allocations per thread and
+     * size class.
+     */
+    static std::uint64_t allocations();
+
+    /** Host memory reserved by the pools, in bytes. */
+    static std::uint64_t reservedBytes();
+
+  private:
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    struct FreeList
+    {
+        FreeBlock *head;
+        std::uint32_t count;
+        //! Allocations not reported to the depot yet.
+        std::uint32_t allocs;
+    };
+
+    // Zero-initialized and trivially destructible so that accessing
+    // the lists needs no guard, even while the thread is exiting.
+    static inline thread_local FreeList freeLists[NumClasses] = {};
+
+    static constexpr std::size_t
+    sizeClass(std::size_t size)
+    {
+        return (size - 1) / Granularity;
+    }
+
+    struct Depot;
+    static Depot &depot();
+
+    static void refill(std::size_t cls);
+    static void spill(std::size_t cls);
+    static void report(std::size_t cls);
+};
+
+/**
+ * Base class for small objects that are created and destroyed at a high
+ * rate, such as per-branch predictor state. Their class-specific new and
+ * delete use the PoolAllocator. A class that is deleted through a
+ * pointer to a base class must have a virtual destructor, so that delete
+ * is given the size of the whole object.
+ */
+class PoolAllocated
+{
+  public:
+    static void *
+    operator new(std::size_t size)
+    {
+        return PoolAllocator::allocate(size);
+    }
+
+    static void
+    operator delete(void *ptr, std::size_t size)
+    {
+        PoolAllocator::deallocate(ptr, size);
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_POOL_ALLOC_HH__
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "base/pool_alloc.hh"
+
+using namespace gem5;
+
+TEST(PoolAllocTest, Alignment)
+{
+    for (std::size_t size = 1; size <= 2 * PoolAllocator::MaxSize;
+         size += 7) {
+        void *ptr = PoolAllocator::allocate(size);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) %
+                  alignof(std::max_align_t), 0);
+        std::memset(ptr, 0xa5, size);
+        PoolAllocator::deallocate(ptr, size);
+    }
+}
+
+TEST(PoolAllocTest, DistinctBlocks)
+{
+    constexpr std::size_t size = 100;
+    std::vector<void *> blocks;
+    std::set<void *> unique;
+    for (int i = 0; i < 1000; i++) {
+        void *ptr = PoolAllocator::allocate(size);
+        std::memset(ptr, i, size);
+        blocks.push_back(ptr);
+        unique.insert(ptr);
+    }
+    EXPECT_EQ(unique.size(), blocks.size());
+
+    for (int i = 0; i < 1000; i++) {
+        auto *bytes = static_cast<unsigned char *>(blocks[i]);
+        EXPECT_EQ(bytes[0], (unsigned char)i);
+        EXPECT_EQ(bytes[size - 1], (unsigned char)i);
+    }
+
+    for (auto *ptr : blocks)
+        PoolAllocator::deallocate(ptr, size);
+}
+
+TEST(PoolAllocTest, Reuse)
+{
+    if (!PoolAllocator::Enabled)
+        GTEST_SKIP() << "Pools are disabled in this build.";
+
+    void *ptr = PoolAllocator::allocate(48);
+    PoolAllocator::deallocate(ptr, 48);
+
+    // Sizes rounding up to the same class share the free list.
+    void *again = PoolAllocator::allocate(33);
+    EXPECT_EQ(ptr, again);
+    PoolAllocator::deallocate(again, 33);
+}
+
+TEST(PoolAllocTest, CrossThreadFree)
+{
+    constexpr std::size_t size = 64;
+    constexpr int num_blocks = 10 * PoolAllocator::MaxCached;
+
+    std::vector<void *> blocks(num_blocks);
+    std::thread producer([&]() {
+        for (auto &ptr : blocks)
+            ptr = PoolAllocator::allocate(size);
+    });
+    producer.join();
+
+    // Freeing everything here spills the surplus back to the depot.
+    for (auto *ptr : blocks)
+        PoolAllocator::deallocate(ptr, size);
+
+    std::set<void *> reused;
+    std::thread consumer([&]() {
+        std::vector<void *> mine;
+        for (int i = 0; i < num_blocks; i++)
+            mine.push_back(PoolAllocator::allocate(size));
+        reused.insert(mine.begin(), mine.end());
+        for (auto *ptr : mine)
+            PoolAllocator::deallocate(ptr, size);
+    });
+    consumer.join();
+
+    EXPECT_EQ(reused.size(), num_blocks);
+}
+
+TEST(PoolAllocTest, Accounting)
+{
+    if (!PoolAllocator::Enabled)
+        GTEST_SKIP() << "Pools are disabled in this build.";
+
+    const auto before = PoolAllocator::allocations();
+    for (std::uint32_t i = 0; i < 2 * PoolAllocator::ReportInterval; i++)
+        PoolAllocator::deallocate(PoolAllocator::allocate(200), 200);
+
+    EXPECT_GE(PoolAllocator::allocations(),
+              before + PoolAllocator::ReportInterval);
+    EXPECT_GT(PoolAllocator::reservedBytes(), 0);
+}
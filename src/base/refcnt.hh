@@ -141,6 +141,15 @@ class RefCountingPtr
             RefCountingPtr<T>>;
     friend NonConstT;
     /** @} */
+
+    template <class U>
+    friend class RefCountingPtr;
+
+    /** Whether a pointer to U converts to a pointer to a base T. */
+    template <class U>
+    static constexpr bool IsDerived = std::is_convertible_v<U *, T *> &&
+        !std::is_same_v<std::remove_const_t<U>, std::remove_const_t<T>>;
+
     /// The stored pointer.
     /// Arguably this should be private.
     T *data;
@@ -210,6 +219,21 @@ class RefCountingPtr
     template <bool B = TisConst>
     RefCountingPtr(const NonConstT &r) { copy(r.data); }
 
+    /// Create a reference counting pointer to a base class of the
+    /// object of another one.  Adds a reference.
+    template <class U, std::enable_if_t<IsDerived<U>, int> = 0>
+    RefCountingPtr(const RefCountingPtr<U> &r) { copy(r.data); }
+
+    /** Move-constructor from a pointer to a derived class.
+     * Does not add a reference.
+     */
+    template <class U, std::enable_if_t<IsDerived<U>, int> = 0>
+    RefCountingPtr(RefCountingPtr<U> &&r)
+    {
+        data = r.data;
+        r.data = nullptr;
+    }
+
     /// Destroy the pointer and any reference it may hold.
     ~RefCountingPtr() { del(); }
 
@@ -70,6 +70,10 @@ class TestRC : public RefCounted
 };
 typedef RefCountingPtr<TestRC> Ptr;
 
+class DerivedTestRC : public TestRC
+{
+};
+
 } // anonymous namespace
 
 TEST(RefcntTest, NullPointerCheck)
@@ -172,3 +176,20 @@ TEST(RefcntTest, EqualityOperators)
     EXPECT_TRUE(equalTestAPtr != equalTestB);
     EXPECT_TRUE(equalTestAPtr != equalTestBPtr);
 }
+
+TEST(RefcntTest, ConversionFromDerived)
+{
+    RefCountingPtr<DerivedTestRC> derived = new DerivedTestRC;
+    Ptr base = derived;
+    EXPECT_EQ(base.get(), derived.get());
+    EXPECT_EQ(liveListSize(), 1);
+
+    Ptr moved = std::move(derived);
+    EXPECT_FALSE(derived);
+    EXPECT_EQ(moved, base);
+
+    base = nullptr;
+    EXPECT_EQ(liveListSize(), 1);
+    moved = nullptr;
+    EXPECT_EQ(liveListSize(), 0);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_SPSC_QUEUE_HH__
+#define __BASE_SPSC_QUEUE_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+/**
+ * A bounded, lock free queue between one producer thread and one consumer
+ * thread.
+ *
+ * The producer only writes the tail index and the consumer only writes the
+ * head index, each on its own cache line. Both sides also keep their last
+ * view of the other side's index, so they only need to read it, and pull
+ * its cache line over, when the queue looks full or empty.
+ */
+template <typename T>
+class SPSCQueue
+{
+  private:
+    static constexpr size_t CacheLineSize = 64;
+
+    std::vector<T> items;
+    const size_t mask;
+
+    /** The index of the next item to pop, written by the consumer. */
+    alignas(CacheLineSize) std::atomic<size_t> head;
+    /** The consumer's last view of the tail index. */
+    size_t consumerTail;
+
+    /** The index of the next item to push, written by the producer. */
+    alignas(CacheLineSize) std::atomic<size_t> tail;
+    /** The producer's last view of the head index. */
+    size_t producerHead;
+
+  public:
+    /**
+     * @param capacity The minimum number of items the queue holds, rounded
+     *                 up to a power of two.
+     */
+    explicit SPSCQueue(size_t capacity) :
+        items(capacity > 1 ? size_t(1) << ceilLog2(capacity) : 1),
+        mask(items.size() - 1), head(0), consumerTail(0), tail(0),
+        producerHead(0)
+    {}
+
+    SPSCQueue(const SPSCQueue &) = delete;
+    SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+    size_t capacity() const { return items.size(); }
+
+    /**
+     * Add an item at the tail of the queue. Only the producer may call
+     * this.
+     *
+     * @return False if the queue was full.
+     */
+    bool
+    tryPush(const T &item)
+    {
+        const size_t t = tail.load(std::memory_order_relaxed);
+        if (t - producerHead == items.size()) {
+            producerHead = head.load(std::memory_order_acquire);
+            if (t - producerHead == items.size())
+                return false;
+        }
+        items[t & mask] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Take the item at the head of the queue. Only the consumer may call
+     * this.
+     *
+     * @return False if the queue was empty.
+     */
+    bool
+    tryPop(T &item)
+    {
+        const size_t h = head.load(std::memory_order_relaxed);
+        if (h == consumerTail) {
+            consumerTail = tail.load(std::memory_order_acquire);
+            if (h == consumerTail)
+                return false;
+        }
+        item = items[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Whether the queue is empty. It is exact for the consumer, and for
+     * the producer once the consumer is done popping.
+     */
+    bool
+    empty() const
+    {
+        return head.load(std::memory_order_acquire) ==
+            tail.load(std::memory_order_acquire);
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_SPSC_QUEUE_HH__
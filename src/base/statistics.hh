@@ -1521,6 +1521,29 @@ class DistProxy
  */
 class Node
 {
+  private:
+    /** The epoch results are cached in, 0 when caching is off. */
+    static inline uint64_t cacheEpoch = 0;
+    /** The last epoch handed out by beginCache(). */
+    static inline uint64_t lastCacheEpoch = 0;
+
+    mutable uint64_t resultEpoch = 0;
+    mutable const VResult *cachedResult = nullptr;
+    mutable uint64_t totalEpoch = 0;
+    mutable Result cachedTotal = 0.0;
+
+  protected:
+    /**
+     * Compute the result vector of this subtree.
+     * @return The result vector of this subtree.
+     */
+    virtual const VResult &computeResult() const = 0;
+    /**
+     * Compute the total of the result vector.
+     * @return The total of the result vector.
+     */
+    virtual Result computeTotal() const = 0;
+
   public:
     /**
      * Return the number of nodes in the subtree starting at this node.
@@ -1528,15 +1551,37 @@ class Node
      */
     virtual size_type size() const = 0;
     /**
-     * Return the result vector of this subtree.
+     * Return the result vector of this subtree, computing it only once per
+     * cache epoch.
      * @return The result vector of this subtree.
      */
-    virtual const VResult &result() const = 0;
+    const VResult &
+    result() const
+    {
+        if (!cacheEpoch)
+            return computeResult();
+        if (resultEpoch != cacheEpoch) {
+            cachedResult = &computeResult();
+            resultEpoch = cacheEpoch;
+        }
+        return *cachedResult;
+    }
     /**
-     * Return the total of the result vector.
+     * Return the total of the result vector, computing it only once per
+     * cache epoch.
      * @return The total of the result vector.
      */
-    virtual Result total() const = 0;
+    Result
+    total() const
+    {
+        if (!cacheEpoch)
+            return computeTotal();
+        if (totalEpoch != cacheEpoch) {
+            cachedTotal = computeTotal();
+            totalEpoch = cacheEpoch;
+        }
+        return cachedTotal;
+    }
 
     /**
      *
@@ -1544,6 +1589,16 @@ class Node
     virtual std::string str() const = 0;
 
     virtual ~Node() {};
+
+    /**
+     * Start a cache epoch: until endCache(), every node computes its
+     * result and total at most once, and subtrees shared between formulas
+     * are only computed for the first of them. The stats must not change
+     * during the epoch.
+     */
+    static void beginCache() { cacheEpoch = ++lastCacheEpoch; }
+    /** End the cache epoch, nodes compute their results again. */
+    static void endCache() { cacheEpoch = 0; }
 };
 
 /** Shared pointer to a function Node. */
@@ -1559,13 +1614,13 @@ class ScalarStatNode : public Node
     ScalarStatNode(const ScalarInfo *d) : data(d), vresult(1) {}
 
     const VResult &
-    result() const
+    computeResult() const override
     {
         vresult[0] = data->result();
         return vresult;
     }
 
-    Result total() const { return data->result(); };
+    Result computeTotal() const override { return data->result(); };
 
     size_type size() const { return 1; }
 
@@ -1588,14 +1643,14 @@ class ScalarProxyNode : public Node
     { }
 
     const VResult &
-    result() const
+    computeResult() const override
     {
         vresult[0] = proxy.result();
         return vresult;
     }
 
     Result
-    total() const
+    computeTotal() const override
     {
         return proxy.result();
     }
@@ -1623,8 +1678,8 @@ class VectorStatNode : public Node
 
   public:
     VectorStatNode(const VectorInfo *d) : data(d) { }
-    const VResult &result() const { return data->result(); }
-    Result total() const { return data->total(); };
+    const VResult &computeResult() const override { return data->result(); }
+    Result computeTotal() const override { return data->total(); };
 
     size_type size() const { return data->size(); }
 
@@ -1639,8 +1694,8 @@ class ConstNode : public Node
 
   public:
     ConstNode(T s) : vresult(1, (Result)s) {}
-    const VResult &result() const { return vresult; }
-    Result total() const { return vresult[0]; };
+    const VResult &computeResult() const override { return vresult; }
+    Result computeTotal() const override { return vresult[0]; };
     size_type size() const { return 1; }
     std::string str() const { return std::to_string(vresult[0]); }
 };
@@ -1653,10 +1708,10 @@ class ConstVectorNode : public Node
 
   public:
     ConstVectorNode(const T &s) : vresult(s.begin(), s.end()) {}
-    const VResult &result() const { return vresult; }
+    const VResult &computeResult() const override { return vresult; }
 
     Result
-    total() const
+    computeTotal() const override
     {
         size_type size = this->size();
         Result tmp = 0;
@@ -1728,7 +1783,7 @@ class UnaryNode : public Node
     UnaryNode(NodePtr &p) : l(p) {}
 
     const VResult &
-    result() const
+    computeResult() const override
     {
         const VResult &lvec = l->result();
         size_type size = lvec.size();
@@ -1744,11 +1799,11 @@ class UnaryNode : public Node
     }
 
     Result
-    total() const
+    computeTotal() const override
     {
         const VResult &vec = this->result();
         Result total = 0.0;
-        for (off_type i = 0; i < size(); i++)
+        for (off_type i = 0; i < vec.size(); i++)
             total += vec[i];
         return total;
     }
@@ -1774,7 +1829,7 @@ class BinaryNode : public Node
     BinaryNode(NodePtr &a, NodePtr &b) : l(a), r(b) {}
 
     const VResult &
-    result() const override
+    computeResult() const override
     {
         Op op;
         const VResult &lvec = l->result();
@@ -1806,9 +1861,8 @@ class BinaryNode : public Node
     }
 
     Result
-    total() const override
+    computeTotal() const override
     {
-        const VResult &vec = this->result();
         const VResult &lvec = l->result();
         const VResult &rvec = r->result();
         Result total = 0.0;
@@ -1822,7 +1876,7 @@ class BinaryNode : public Node
 
         /** If vectors are the same divide their sums (x0+x1)/(y0+y1) */
         if (lvec.size() == rvec.size() && lvec.size() > 1) {
-            for (off_type i = 0; i < size(); ++i) {
+            for (off_type i = 0; i < lvec.size(); ++i) {
                 lsum += lvec[i];
                 rsum += rvec[i];
             }
@@ -1830,7 +1884,8 @@ class BinaryNode : public Node
         }
 
         /** Otherwise divide each item by the divisor */
-        for (off_type i = 0; i < size(); ++i) {
+        const VResult &vec = this->result();
+        for (off_type i = 0; i < vec.size(); ++i) {
             total += vec[i];
         }
 
@@ -1870,7 +1925,7 @@ class SumNode : public Node
     SumNode(NodePtr &p) : l(p), vresult(1) {}
 
     const VResult &
-    result() const
+    computeResult() const override
     {
         const VResult &lvec = l->result();
         size_type size = lvec.size();
@@ -1886,7 +1941,7 @@ class SumNode : public Node
     }
 
     Result
-    total() const
+    computeTotal() const override
     {
         const VResult &lvec = l->result();
         size_type size = lvec.size();
@@ -2112,6 +2167,7 @@ class Distribution : public DistBase<Distribution, DistStor>
     init(Counter min, Counter max, Counter bkt)
     {
         DistStor::Params *params = new DistStor::Params(min, max, bkt);
+        params->lazy |= this->info()->flags.isSet(lazy);
         this->setParams(params);
         this->doInit();
         return this->self();
@@ -2153,6 +2209,7 @@ class Histogram : public DistBase<Histogram, HistStor>
     init(size_type size)
     {
         HistStor::Params *params = new HistStor::Params(size);
+        params->lazy |= this->info()->flags.isSet(lazy);
         this->setParams(params);
         this->doInit();
         return this->self();
@@ -2277,6 +2334,7 @@ class VectorDistribution : public VectorDistBase<VectorDistribution, DistStor>
     init(size_type size, Counter min, Counter max, Counter bkt)
     {
         DistStor::Params *params = new DistStor::Params(min, max, bkt);
+        params->lazy |= this->info()->flags.isSet(lazy);
         this->setParams(params);
         this->doInit(size);
         return this->self();
@@ -2637,10 +2695,16 @@ class FormulaNode : public Node
     FormulaNode(const Formula &f) : formula(f) {}
 
     size_type size() const { return formula.size(); }
-    const VResult &result() const { formula.result(vec); return vec; }
-    Result total() const { return formula.total(); }
-
     std::string str() const { return formula.str(); }
+
+  protected:
+    const VResult &
+    computeResult() const override
+    {
+        formula.result(vec);
+        return vec;
+    }
+    Result computeTotal() const override { return formula.total(); }
 };
 
 /**
@@ -2881,6 +2945,15 @@ sum(Temp val)
 
 /** Dump all statistics data to the registered outputs */
 void dump();
+
+/**
+ * Compute every formula node at most once until endFormulaCache(). Dumps
+ * query each formula several times, and formulas share subtrees, while no
+ * stat can change. See Node::beginCache().
+ */
+inline void beginFormulaCache() { Node::beginCache(); }
+inline void endFormulaCache() { Node::endCache(); }
+
 void reset();
 void enable();
 bool enabled();
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+
+#include "base/statistics.hh"
+
+using namespace gem5;
+using namespace gem5::statistics;
+
+namespace
+{
+
+/** A leaf node that counts how often it gets computed. */
+class CountingNode : public Node
+{
+  public:
+    VResult values;
+    mutable int numResults = 0;
+    mutable int numTotals = 0;
+
+    CountingNode(const VResult &v) : values(v) {}
+
+    size_type size() const override { return values.size(); }
+    std::string str() const override { return "counting"; }
+
+  protected:
+    const VResult &
+    computeResult() const override
+    {
+        numResults++;
+        return values;
+    }
+
+    Result
+    computeTotal() const override
+    {
+        numTotals++;
+        Result total = 0.0;
+        for (Result v : values)
+            total += v;
+        return total;
+    }
+};
+
+} // anonymous namespace
+
+TEST(StatsFormulaCacheTest, ComputesEveryTimeByDefault)
+{
+    auto leaf = std::make_shared<CountingNode>(VResult{1, 2, 3});
+    NodePtr l = leaf;
+    NodePtr r = std::make_shared<ConstNode<int>>(2);
+    BinaryNode<std::multiplies<Result>> node(l, r);
+
+    EXPECT_EQ(node.result(), (VResult{2, 4, 6}));
+    EXPECT_EQ(node.result(), (VResult{2, 4, 6}));
+    // The total needs the operands and the result, which computes them
+    // again.
+    EXPECT_EQ(node.total(), 12);
+    EXPECT_EQ(leaf->numResults, 4);
+
+    leaf->values[0] = 4;
+    EXPECT_EQ(node.result(), (VResult{8, 4, 6}));
+}
+
+TEST(StatsFormulaCacheTest, ComputesOncePerEpoch)
+{
+    auto leaf = std::make_shared<CountingNode>(VResult{1, 2, 3});
+    NodePtr l = leaf;
+    NodePtr r = std::make_shared<ConstNode<int>>(2);
+    // Two formulas sharing the same subtree
+    NodePtr shared = std::make_shared<BinaryNode<std::multiplies<Result>>>(
+        l, r);
+    NodePtr one = std::make_shared<ConstNode<int>>(1);
+    BinaryNode<std::plus<Result>> a(shared, one);
+    SumNode<std::plus<Result>> b(shared);
+
+    beginFormulaCache();
+    EXPECT_EQ(a.result(), (VResult{3, 5, 7}));
+    EXPECT_EQ(a.total(), 15);
+    EXPECT_EQ(b.result(), VResult{12});
+    EXPECT_EQ(b.total(), 12);
+    EXPECT_EQ(leaf->numResults, 1);
+    endFormulaCache();
+
+    // The next epoch sees the new values
+    leaf->values[0] = 4;
+    beginFormulaCache();
+    EXPECT_EQ(a.result(), (VResult{9, 5, 7}));
+    EXPECT_EQ(b.total(), 18);
+    EXPECT_EQ(leaf->numResults, 2);
+    endFormulaCache();
+}
+
+TEST(StatsFormulaCacheTest, VectorTotal)
+{
+    // Same sized vectors: the total of a quotient is the quotient of the
+    // totals, which does not need the element vector.
+    auto num = std::make_shared<CountingNode>(VResult{1, 2, 3});
+    auto den = std::make_shared<CountingNode>(VResult{2, 2, 2});
+    NodePtr l = num;
+    NodePtr r = den;
+    BinaryNode<std::divides<Result>> node(l, r);
+
+    EXPECT_EQ(node.total(), 1);
+    EXPECT_EQ(num->numResults, 1);
+    EXPECT_EQ(den->numResults, 1);
+}
@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/columnar.hh"
+
+#include <cstring>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "sim/byteswap.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+template <typename T>
+void
+writeValue(std::ostream &os, T val)
+{
+    val = htole(val);
+    os.write(reinterpret_cast<const char *>(&val), sizeof(val));
+}
+
+void
+writeDouble(std::ostream &os, double val)
+{
+    uint64_t bits;
+    std::memcpy(&bits, &val, sizeof(bits));
+    writeValue(os, bits);
+}
+
+std::string
+subname(const std::vector<std::string> &subnames, size_type i)
+{
+    if (i < subnames.size() && !subnames[i].empty())
+        return subnames[i];
+    return std::to_string(i);
+}
+
+} // anonymous namespace
+
+Columnar::Columnar(std::ostream &_stream)
+    : outputStream(nullptr), stream(_stream)
+{
+    stream.write("gem5col\0", 8);
+    writeValue(stream, Version);
+}
+
+Columnar::Columnar(OutputStream *os)
+    : Columnar(*os->stream())
+{
+    outputStream = os;
+}
+
+Columnar::~Columnar()
+{
+    if (outputStream)
+        simout.close(outputStream);
+}
+
+void
+Columnar::begin()
+{
+    current = written;
+}
+
+void
+Columnar::end()
+{
+    writeDump();
+    stream.flush();
+}
+
+bool
+Columnar::valid() const
+{
+    return stream.good();
+}
+
+std::string
+Columnar::statName(const std::string &name) const
+{
+    if (path.empty())
+        return name;
+    else
+        return path.top() + "." + name;
+}
+
+void
+Columnar::beginGroup(const char *name)
+{
+    path.push(statName(name));
+}
+
+void
+Columnar::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+void
+Columnar::writeString(const std::string &str)
+{
+    writeValue<uint32_t>(stream, str.size());
+    stream.write(str.data(), str.size());
+}
+
+void
+Columnar::record(const Info &info, const std::vector<std::string> &names,
+                 const std::vector<double> &values)
+{
+    assert(names.size() == values.size());
+
+    auto it = schema.find(&info);
+    if (it == schema.end()) {
+        const Columns columns{uint32_t(current.size()),
+                              uint32_t(values.size())};
+        it = schema.emplace(&info, columns).first;
+
+        stream.put('S');
+        writeValue(stream, columns.first);
+        writeString(statName(info.name));
+        writeString(info.unit->getUnitString());
+        writeString(info.desc);
+        writeValue(stream, columns.count);
+        for (const auto &name : names)
+            writeString(name);
+
+        current.resize(current.size() + values.size(), 0.0);
+        written.resize(current.size(), 0.0);
+    }
+
+    const Columns &columns = it->second;
+    panic_if(columns.count != values.size(),
+             "Stat %s changed size between dumps.\n", info.name);
+    std::copy(values.begin(), values.end(),
+              current.begin() + columns.first);
+}
+
+void
+Columnar::writeDump()
+{
+    std::vector<uint32_t> changed;
+    for (uint32_t i = 0; i < current.size(); ++i) {
+        // Compare the bits so that NaNs only count as changed once
+        if (std::memcmp(&current[i], &written[i], sizeof(double)) != 0)
+            changed.push_back(i);
+    }
+
+    // A sparse entry takes 12 bytes, a dense one 8.
+    if (changed.size() * 12 < current.size() * 8) {
+        stream.put('D');
+        writeValue<uint64_t>(stream, curTick());
+        writeValue<uint32_t>(stream, changed.size());
+        for (uint32_t i : changed) {
+            writeValue(stream, i);
+            writeDouble(stream, current[i]);
+        }
+    } else {
+        stream.put('F');
+        writeValue<uint64_t>(stream, curTick());
+        writeValue<uint32_t>(stream, current.size());
+        for (double value : current)
+            writeDouble(stream, value);
+    }
+
+    written = current;
+}
+
+void
+Columnar::distNames(const DistData &data, const std::string &prefix,
+                    std::vector<std::string> &names)
+{
+    for (const char *name : { "samples", "sum", "squares", "min_value",
+                              "max_value", "underflows", "overflows" }) {
+        names.push_back(prefix + name);
+    }
+    for (size_type i = 0; i < data.cvec.size(); ++i) {
+        names.push_back(prefix +
+            std::to_string(data.min + i * data.bucket_size));
+    }
+}
+
+void
+Columnar::distValues(const DistData &data, std::vector<double> &values)
+{
+    values.insert(values.end(), {
+        double(data.samples), double(data.sum), double(data.squares),
+        double(data.min_val), double(data.max_val),
+        double(data.underflow), double(data.overflow) });
+    values.insert(values.end(), data.cvec.begin(), data.cvec.end());
+}
+
+void
+Columnar::visit(const ScalarInfo &info)
+{
+    record(info, { "" }, { info.result() });
+}
+
+void
+Columnar::visit(const VectorInfo &info)
+{
+    const VResult &result = info.result();
+    std::vector<std::string> names;
+    if (!schema.count(&info)) {
+        for (size_type i = 0; i < result.size(); ++i)
+            names.push_back(subname(info.subnames, i));
+    } else {
+        names.resize(result.size());
+    }
+    record(info, names, std::vector<double>(result.begin(), result.end()));
+}
+
+void
+Columnar::visit(const DistInfo &info)
+{
+    std::vector<std::string> names;
+    std::vector<double> values;
+    distNames(info.data, "", names);
+    distValues(info.data, values);
+    record(info, names, values);
+}
+
+void
+Columnar::visit(const VectorDistInfo &info)
+{
+    std::vector<std::string> names;
+    std::vector<double> values;
+    for (size_type i = 0; i < info.data.size(); ++i) {
+        distNames(info.data[i],
+                  subname(info.subnames, i) + info.separatorString, names);
+        distValues(info.data[i], values);
+    }
+    record(info, names, values);
+}
+
+void
+Columnar::visit(const Vector2dInfo &info)
+{
+    std::vector<std::string> names;
+    for (size_type i = 0; i < info.x; ++i) {
+        for (size_type j = 0; j < info.y; ++j) {
+            names.push_back(subname(info.subnames, i) +
+                            info.separatorString +
+                            subname(info.y_subnames, j));
+        }
+    }
+    record(info, names,
+           std::vector<double>(info.cvec.begin(), info.cvec.end()));
+}
+
+void
+Columnar::visit(const FormulaInfo &info)
+{
+    visit(static_cast<const VectorInfo &>(info));
+}
+
+void
+Columnar::visit(const SparseHistInfo &info)
+{
+    warn_once("Sparse histograms are not supported by the columnar "
+              "stats output, skipping %s.\n", info.name);
+}
+
+std::unique_ptr<Output>
+initColumnar(const std::string &filename)
+{
+    return std::make_unique<Columnar>(simout.create(filename, true, true));
+}
+
+} // namespace statistics
+} // namespace gem5
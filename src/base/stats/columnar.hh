@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_COLUMNAR_HH__
+#define __BASE_STATS_COLUMNAR_HH__
+
+#include <iosfwd>
+#include <memory>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+namespace statistics
+{
+
+/**
+ * A compact binary stats output meant for frequent periodic dumps.
+ *
+ * Every stat is flattened into one or more columns of doubles. The
+ * schema of a stat (its name, unit, description and column names) is
+ * written once, the first time the stat is dumped. Each dump then only
+ * records the tick and the values of the columns that changed since
+ * the previous dump, or all the columns if that is smaller.
+ *
+ * The file starts with the magic "gem5col\0" and a 32-bit version,
+ * followed by records, all in little-endian byte order:
+ *  - 'S': first column (u32), name, unit, description, number of
+ *    columns (u32) and the column names, strings being a u32 length
+ *    followed by the characters;
+ *  - 'D': tick (u64), number of changed columns (u32), then a column
+ *    index (u32) and value (f64) for each of them;
+ *  - 'F': tick (u64), number of columns (u32), then every value (f64).
+ *
+ * m5.stats.columnar reads the files back. Sparse histograms are not
+ * supported since their number of buckets is not fixed.
+ */
+class Columnar : public Output
+{
+  public:
+    static constexpr uint32_t Version = 1;
+
+    /**
+     * @param stream Stream to write to, which must outlive the output.
+     */
+    Columnar(std::ostream &stream);
+
+    /**
+     * @param os Output file to write to, owned and closed by the output.
+     */
+    Columnar(OutputStream *os);
+
+    ~Columnar();
+
+    Columnar(const Columnar &other) = delete;
+    Columnar &operator=(const Columnar &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  protected:
+    /** Columns of a stat that has been added to the schema */
+    struct Columns
+    {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /**
+     * Store the values of a stat for the dump in progress, adding the
+     * stat to the schema the first time it is seen.
+     *
+     * @param info The stat.
+     * @param names Names of the columns, only used to add the stat.
+     * @param values Values of the columns.
+     */
+    void record(const Info &info,
+                const std::vector<std::string> &names,
+                const std::vector<double> &values);
+
+    /** Column names of a distribution, prefixed by prefix */
+    static void distNames(const DistData &data, const std::string &prefix,
+                          std::vector<std::string> &names);
+
+    /** Column values of a distribution */
+    static void distValues(const DistData &data,
+                           std::vector<double> &values);
+
+    std::string statName(const std::string &name) const;
+
+    void writeString(const std::string &str);
+    void writeDump();
+
+    OutputStream *outputStream;
+    std::ostream &stream;
+
+    std::stack<std::string> path;
+    std::unordered_map<const Info *, Columns> schema;
+
+    /** Value of every column in the dump in progress */
+    std::vector<double> current;
+    /** Value of every column as of the previous dump */
+    std::vector<double> written;
+};
+
+std::unique_ptr<Output> initColumnar(const std::string &filename);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COLUMNAR_HH__
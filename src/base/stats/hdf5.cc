@@ -37,10 +37,13 @@
 
 #include "base/stats/hdf5.hh"
 
+#include <unordered_set>
+
 #include "base/logging.hh"
 #include "base/stats/info.hh"
 #include "base/trace.hh"
 #include "debug/Stats.hh"
+#include "sim/sim_exit.hh"
 
 namespace gem5
 {
@@ -62,30 +65,77 @@ bool emptyStrings(const T &labels)
 namespace statistics
 {
 
+namespace
+{
+
+/** The outputs with a writer thread, stopped when the simulator exits */
+std::unordered_set<Hdf5 *> &
+threadedOutputs()
+{
+    static std::unordered_set<Hdf5 *> outputs;
+    return outputs;
+}
+
+} // anonymous namespace
+
 Hdf5::Hdf5(const std::string &file, unsigned chunking,
-           bool desc, bool formulas)
+           bool desc, bool formulas, unsigned compression, bool threaded)
     : fname(file), timeChunk(chunking),
       enableDescriptions(desc), enableFormula(formulas),
-      dumpCount(0)
+      compression(compression), dumpCount(0), fileOpen(false),
+      stopping(false)
 {
     // Tell the library not to print exceptions by default. There are
     // cases where we rely on exceptions to determine if we need to
     // create a node or if we can just open it.
     H5::Exception::dontPrint();
+
+    if (threaded) {
+        // The output belongs to Python, which may not destroy it before
+        // the process exits.
+        static bool registered = false;
+        if (!registered) {
+            registerExitCallback([]() {
+                for (Hdf5 *output : threadedOutputs())
+                    output->stopWriter();
+            });
+            registered = true;
+        }
+        threadedOutputs().insert(this);
+        writer = std::thread([this]() { writeLoop(); });
+    }
 }
 
 Hdf5::~Hdf5()
 {
+    stopWriter();
+    threadedOutputs().erase(this);
+
+    // Close the data sets before the file
+    dataSets.clear();
+}
+
+void
+Hdf5::stopWriter()
+{
+    if (!writer.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(writerLock);
+        stopping = true;
+    }
+    writerCond.notify_all();
+    writer.join();
 }
 
 
 void
 Hdf5::begin()
 {
-    h5File = H5::H5File(fname,
-                        // Truncate the file if this is the first dump
-                        dumpCount > 0 ? H5F_ACC_RDWR : H5F_ACC_TRUNC);
-    path.push(h5File.openGroup("/"));
+    current.index = dumpCount;
+    current.stats.clear();
+    path.clear();
 }
 
 void
@@ -93,6 +143,19 @@ Hdf5::end()
 {
     assert(valid());
 
+    if (writer.joinable()) {
+        std::unique_lock<std::mutex> lock(writerLock);
+        writerCond.wait(lock, [this]() {
+            return pending.size() < MaxPending;
+        });
+        pending.emplace_back(std::move(current));
+        lock.unlock();
+        writerCond.notify_all();
+        current = Dump();
+    } else {
+        writeDump(current);
+    }
+
     dumpCount++;
 }
 
@@ -106,45 +169,31 @@ Hdf5::valid() const
 void
 Hdf5::beginGroup(const char *name)
 {
-    auto base = path.top();
-
-    // Try to open an existing stat group corresponding to the
-    // name. Create it if it doesn't exist.
-    H5::Group group;
-    try {
-        group = base.openGroup(name);
-    } catch (const H5::FileIException& e) {
-        group = base.createGroup(name);
-    } catch (const H5::GroupIException& e) {
-        group = base.createGroup(name);
-    }
-
-    path.push(group);
+    path.emplace_back(name);
 }
 
 void
 Hdf5::endGroup()
 {
     assert(!path.empty());
-    path.pop();
+    path.pop_back();
 }
 
 void
 Hdf5::visit(const ScalarInfo &info)
 {
     // Since this stat is a scalar, we need 1-dimensional value in the
-    // stat file. The Hdf5::appendStat helper will populate the size
-    // of the first dimension (time).
-    hsize_t fdims[1] = { 0, };
+    // stat file. The time dimension will be added by the
+    // Hdf5::captureStat() helper.
     double data[1] = { info.result(), };
 
-    appendStat(info, 1, fdims, data);
+    captureStat(info, {}, data);
 }
 
 void
 Hdf5::visit(const VectorInfo &info)
 {
-    appendVectorInfo(info);
+    captureVectorInfo(info);
 }
 
 void
@@ -163,20 +212,23 @@ void
 Hdf5::visit(const Vector2dInfo &info)
 {
     // Request a 3-dimensional stat, the first dimension will be
-    // populated by the Hdf5::appendStat() helper. The remaining two
+    // populated by the Hdf5::captureStat() helper. The remaining two
     // dimensions correspond to the stat instance.
-    hsize_t fdims[3] = { 0, info.x, info.y };
-    H5::DataSet data_set = appendStat(info, 3, fdims, info.cvec.data());
+    StatValues &stat = captureStat(info, { info.x, info.y },
+                                   info.cvec.data());
 
-    if (dumpCount == 0) {
+    if (stat.layout) {
         if (!info.subnames.empty() && !emptyStrings(info.subnames))
-            addMetaData(data_set, "subnames", info.subnames);
+            stat.layout->stringVectors.emplace_back("subnames",
+                                                    info.subnames);
 
         if (!info.y_subnames.empty() && !emptyStrings(info.y_subnames))
-            addMetaData(data_set, "y_subnames", info.y_subnames);
+            stat.layout->stringVectors.emplace_back("y_subnames",
+                                                    info.y_subnames);
 
         if (!info.subdescs.empty() && !emptyStrings(info.subdescs))
-            addMetaData(data_set, "subdescs", info.subdescs);
+            stat.layout->stringVectors.emplace_back("subdescs",
+                                                    info.subdescs);
     }
 }
 
@@ -186,10 +238,11 @@ Hdf5::visit(const FormulaInfo &info)
     if (!enableFormula)
         return;
 
-    H5::DataSet data_set = appendVectorInfo(info);
+    captureVectorInfo(info);
 
-    if (dumpCount == 0)
-        addMetaData(data_set, "equation", info.str());
+    StatValues &stat = current.stats.back();
+    if (stat.layout)
+        stat.layout->strings.emplace_back("equation", info.str());
 }
 
 void
@@ -198,91 +251,179 @@ Hdf5::visit(const SparseHistInfo &info)
     warn_once("HDF5 stat files don't support sparse histograms.\n");
 }
 
-H5::DataSet
-Hdf5::appendVectorInfo(const VectorInfo &info)
+void
+Hdf5::captureVectorInfo(const VectorInfo &info)
 {
     const VResult &vr(info.result());
     // Request a 2-dimensional stat, the first dimension will be
-    // populated by the Hdf5::appendStat() helper. The remaining
+    // populated by the Hdf5::captureStat() helper. The remaining
     // dimension correspond to the stat instance.
-    hsize_t fdims[2] = { 0, vr.size() };
-    H5::DataSet data_set = appendStat(info, 2, fdims, vr.data());
+    StatValues &stat = captureStat(info, { vr.size() }, vr.data());
 
-    if (dumpCount == 0) {
+    if (stat.layout) {
         if (!info.subnames.empty() && !emptyStrings(info.subnames))
-            addMetaData(data_set, "subnames", info.subnames);
+            stat.layout->stringVectors.emplace_back("subnames",
+                                                    info.subnames);
 
         if (!info.subdescs.empty() && !emptyStrings(info.subdescs))
-            addMetaData(data_set, "subdescs", info.subdescs);
+            stat.layout->stringVectors.emplace_back("subdescs",
+                                                    info.subdescs);
     }
+}
 
-    return data_set;
+Hdf5::StatValues &
+Hdf5::captureStat(const Info &info, std::vector<hsize_t> dims,
+                  const double *data)
+{
+    StatValues &stat = current.stats.emplace_back();
+    stat.id = info.id;
+
+    size_t size = 1;
+    for (hsize_t dim : dims)
+        size *= dim;
+    stat.data.assign(data, data + size);
+
+    stat.dims.reserve(dims.size() + 1);
+    stat.dims.push_back(0);
+    stat.dims.insert(stat.dims.end(), dims.begin(), dims.end());
+
+    if (knownStats.insert(info.id).second) {
+        stat.layout = std::make_unique<StatLayout>();
+        stat.layout->path = path;
+        stat.layout->name = info.name;
+        if (enableDescriptions && !info.desc.empty())
+            stat.layout->strings.emplace_back("description", info.desc);
+    }
+
+    return stat;
 }
 
-H5::DataSet
-Hdf5::appendStat(const Info &info, int rank, hsize_t *dims, const double *data)
+void
+Hdf5::writeDump(const Dump &dump)
 {
-    H5::Group group = path.top();
-    H5::DataSet data_set;
-    H5::DataSpace fspace;
+    if (!fileOpen) {
+        h5File = H5::H5File(fname, H5F_ACC_TRUNC);
+        fileOpen = true;
+    }
 
-    dims[0] = dumpCount + 1;
+    for (const StatValues &stat : dump.stats)
+        writeStat(dump.index, stat);
+    h5File.flush(H5F_SCOPE_GLOBAL);
+}
 
-    if (dumpCount > 0) {
-        // Get the existing stat if we have already dumped this stat
-        // before.
-        data_set = group.openDataSet(info.name);
-        data_set.extend(dims);
-        fspace = data_set.getSpace();
+void
+Hdf5::writeStat(unsigned index, const StatValues &stat)
+{
+    const int rank = stat.dims.size();
+    std::vector<hsize_t> dims(stat.dims);
+    dims[0] = index + 1;
+
+    H5::DataSet *data_set;
+    auto it = dataSets.find(stat.id);
+    if (it == dataSets.end()) {
+        assert(stat.layout);
+        data_set = &dataSets.emplace(stat.id,
+            createDataSet(*stat.layout, dims)).first->second;
     } else {
-        // We don't have the stat already, create it.
-
-        H5::DSetCreatPropList props;
+        data_set = &it->second;
+        data_set->extend(dims.data());
+    }
+    H5::DataSpace fspace = data_set->getSpace();
 
-        // Setup max dimensions based on the requested file dimensions
-        std::vector<hsize_t> max_dims(rank);
-        std::copy(dims, dims + rank, max_dims.begin());
-        max_dims[0] = H5S_UNLIMITED;
+    // The first dimension is time which isn't included in data.
+    dims[0] = 1;
+    H5::DataSpace mspace(rank, dims.data());
+    std::vector<hsize_t> foffset(rank, 0);
+    foffset[0] = index;
 
-        // Setup chunking
-        std::vector<hsize_t> chunk_dims(rank);
-        std::copy(dims, dims + rank, chunk_dims.begin());
-        chunk_dims[0] = timeChunk;
-        props.setChunk(rank, chunk_dims.data());
+    fspace.selectHyperslab(H5S_SELECT_SET, dims.data(), foffset.data());
+    data_set->write(stat.data.data(), H5::PredType::NATIVE_DOUBLE, mspace,
+                    fspace);
+}
 
-        // Enable compression
-        props.setDeflate(1);
+H5::DataSet
+Hdf5::createDataSet(const StatLayout &layout,
+                    const std::vector<hsize_t> &dims)
+{
+    const int rank = dims.size();
 
-        fspace = H5::DataSpace(rank, dims, max_dims.data());
+    // Open the stat groups corresponding to the path, creating the
+    // ones that don't exist.
+    H5::Group group = h5File.openGroup("/");
+    for (const std::string &name : layout.path) {
         try {
-            DPRINTF(Stats, "Creating dataset %s in group %s\n",
-                info.name, group.getObjnameByIdx(group.getId()));
-            data_set = group.createDataSet(info.name,
-                H5::PredType::NATIVE_DOUBLE, fspace, props);
-        } catch (const H5::Exception &e) {
-          std::string err = "Failed creating H5::DataSet " +  info.name + "; ";
-          err += e.getDetailMsg() + " in " + e.getFuncName();
-          // Rethrow std exception so that it's passed on to the Python world
-          throw std::runtime_error(err);
-        }
-
-        if (enableDescriptions && !info.desc.empty()) {
-            addMetaData(data_set, "description", info.desc);
+            group = group.openGroup(name);
+        } catch (const H5::FileIException& e) {
+            group = group.createGroup(name);
+        } catch (const H5::GroupIException& e) {
+            group = group.createGroup(name);
         }
     }
 
-    // The first dimension is time which isn't included in data.
-    dims[0] = 1;
-    H5::DataSpace mspace(rank, dims);
-    std::vector<hsize_t> foffset(rank, 0);
-    foffset[0] = dumpCount;
+    H5::DSetCreatPropList props;
+
+    // Setup max dimensions based on the requested file dimensions
+    std::vector<hsize_t> max_dims(dims);
+    max_dims[0] = H5S_UNLIMITED;
 
-    fspace.selectHyperslab(H5S_SELECT_SET, dims, foffset.data());
-    data_set.write(data, H5::PredType::NATIVE_DOUBLE, mspace, fspace);
+    // Setup chunking
+    std::vector<hsize_t> chunk_dims(dims);
+    chunk_dims[0] = timeChunk;
+    props.setChunk(rank, chunk_dims.data());
+
+    if (compression)
+        props.setDeflate(compression);
+
+    H5::DataSpace fspace(rank, dims.data(), max_dims.data());
+    H5::DataSet data_set;
+    try {
+        DPRINTF(Stats, "Creating dataset %s in group %s\n",
+            layout.name, group.getObjnameByIdx(group.getId()));
+        data_set = group.createDataSet(layout.name,
+            H5::PredType::NATIVE_DOUBLE, fspace, props);
+    } catch (const H5::Exception &e) {
+      std::string err = "Failed creating H5::DataSet " +  layout.name + "; ";
+      err += e.getDetailMsg() + " in " + e.getFuncName();
+      // Rethrow std exception so that it's passed on to the Python world
+      throw std::runtime_error(err);
+    }
+
+    for (const auto &[name, value] : layout.strings)
+        addMetaData(data_set, name, value);
+    for (const auto &[name, values] : layout.stringVectors)
+        addMetaData(data_set, name, values);
 
     return data_set;
 }
 
+void
+Hdf5::writeLoop()
+{
+    // The library's error printing is set per thread
+    H5::Exception::dontPrint();
+
+    std::unique_lock<std::mutex> lock(writerLock);
+    while (true) {
+        writerCond.wait(lock, [this]() {
+            return stopping || !pending.empty();
+        });
+        if (pending.empty())
+            return;
+
+        Dump dump = std::move(pending.front());
+        pending.pop_front();
+
+        lock.unlock();
+        writerCond.notify_all();
+        try {
+            writeDump(dump);
+        } catch (const std::exception &e) {
+            fatal("Failed writing stats to %s: %s\n", fname, e.what());
+        }
+        lock.lock();
+    }
+}
+
 void
 Hdf5::addMetaData(H5::DataSet &loc, const char *name,
                   const std::vector<const char *> &values)
@@ -329,10 +470,11 @@ Hdf5::addMetaData(H5::DataSet &loc, const char *name, double value)
 
 std::unique_ptr<Output>
 initHDF5(const std::string &filename, unsigned chunking,
-         bool desc, bool formulas)
+         bool desc, bool formulas, unsigned compression, bool threaded)
 {
     return  std::unique_ptr<Output>(
-        new Hdf5(simout.resolve(filename), chunking, desc, formulas));
+        new Hdf5(simout.resolve(filename), chunking, desc, formulas,
+                 compression, threaded));
 }
 
 }; // namespace statistics
@@ -40,9 +40,15 @@
 
 #include <H5Cpp.h>
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
-#include <stack>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -56,16 +62,42 @@ namespace gem5
 namespace statistics
 {
 
+/**
+ * Output stats to an HDF5 file, with one data set per stat growing by one
+ * row per dump.
+ *
+ * The visitors only capture the values of the stats, the file is written
+ * and flushed when the dump ends. With threaded writes, a separate thread
+ * writes the captured dumps so that the simulation does not wait for the
+ * file. The thread is stopped when the simulator exits, after writing the
+ * pending dumps.
+ */
 class Hdf5 : public Output
 {
   public:
-    Hdf5(const std::string &file, unsigned chunking, bool desc, bool formulas);
+    /**
+     * @param file Name of the file to write.
+     * @param chunking Number of dumps per chunk of the data sets.
+     * @param desc Whether to store the descriptions of the stats.
+     * @param formulas Whether to store formulas.
+     * @param compression Deflate level of the data sets, 0 disables
+     *                    compression.
+     * @param threaded Whether to write the file on a separate thread.
+     */
+    Hdf5(const std::string &file, unsigned chunking, bool desc, bool formulas,
+         unsigned compression, bool threaded);
 
     ~Hdf5();
 
     Hdf5() = delete;
     Hdf5(const Hdf5 &other) = delete;
 
+    /**
+     * Write the pending dumps and stop the writer thread, if any. The
+     * dumps after that are written by end().
+     */
+    void stopWriter();
+
   public: // Output interface
     void begin() override;
     void end() override;
@@ -84,23 +116,77 @@ class Hdf5 : public Output
 
   protected:
     /**
-     * Helper function to append vector stats and set their metadata.
+     * Where and how to create the data set of a stat, captured the first
+     * time the stat is dumped.
+     */
+    struct StatLayout
+    {
+        /** Names of the groups containing the stat */
+        std::vector<std::string> path;
+        std::string name;
+        /** String attributes of the data set */
+        std::vector<std::pair<const char *, std::string>> strings;
+        /** String vector attributes of the data set */
+        std::vector<std::pair<const char *, std::vector<std::string>>>
+            stringVectors;
+    };
+
+    /** The values of one stat in one dump */
+    struct StatValues
+    {
+        /** Info::id of the stat */
+        int id;
+        /** Size of each of the dimensions, starting with time */
+        std::vector<hsize_t> dims;
+        std::vector<double> data;
+        /** Only set the first time the stat is dumped */
+        std::unique_ptr<StatLayout> layout;
+    };
+
+    /** All the stats captured by one dump */
+    struct Dump
+    {
+        /** Number of dumps before this one */
+        unsigned index;
+        std::vector<StatValues> stats;
+    };
+
+    /**
+     * Helper function to capture vector stats and their metadata.
      */
-    H5::DataSet appendVectorInfo(const VectorInfo &info);
+    void captureVectorInfo(const VectorInfo &info);
 
     /**
-     * Helper function to append an n-dimensional double stat to the
-     * file.
+     * Helper function to capture an n-dimensional double stat in the
+     * current dump.
      *
      * This helper function assumes that all stats include a time
      * component. I.e., a Stat::Scalar is a 1-dimensional stat.
      *
      * @param info Stat info structure.
-     * @param rank Stat dimensionality (including time).
-     * @param dims Size of each of the dimensions.
+     * @param dims Size of each of the dimensions, excluding time.
+     * @param data The values of the stat.
+     * @return The captured stat, with a layout if this is the first time
+     *         it is dumped.
      */
-    H5::DataSet appendStat(const Info &info, int rank, hsize_t *dims,
-                           const double *data);
+    StatValues &captureStat(const Info &info, std::vector<hsize_t> dims,
+                            const double *data);
+
+    /** Write a captured dump to the file. */
+    void writeDump(const Dump &dump);
+
+    /**
+     * Append the values of a stat to its data set, creating the data set
+     * the first time.
+     */
+    void writeStat(unsigned index, const StatValues &stat);
+
+    /** Create the data set of a stat. */
+    H5::DataSet createDataSet(const StatLayout &layout,
+                              const std::vector<hsize_t> &dims);
+
+    /** Main loop of the writer thread */
+    void writeLoop();
 
     /**
      * Helper function to add a string vector attribute to a stat.
@@ -142,20 +228,45 @@ class Hdf5 : public Output
     void addMetaData(H5::DataSet &loc, const char *name, double value);
 
   protected:
+    /** Maximum number of dumps waiting for the writer */
+    static constexpr size_t MaxPending = 2;
+
     const std::string fname;
     const hsize_t timeChunk;
     const bool enableDescriptions;
     const bool enableFormula;
+    const unsigned compression;
 
-    std::stack<H5::Group> path;
+    /** Names of the groups the visited stats are in */
+    std::vector<std::string> path;
+    /** Info::id of the stats that were dumped before */
+    std::unordered_set<int> knownStats;
+    /** The dump in progress */
+    Dump current;
 
     unsigned dumpCount;
+
+    /** The state below is only used by the writer */
     H5::H5File h5File;
+    bool fileOpen;
+    /** Data sets by Info::id of their stat */
+    std::unordered_map<int, H5::DataSet> dataSets;
+
+    /** Protects the writer state below */
+    std::mutex writerLock;
+    std::condition_variable writerCond;
+    /** Dumps waiting to be written */
+    std::deque<Dump> pending;
+    bool stopping;
+
+    /** Only runs with threaded writes */
+    std::thread writer;
 };
 
 std::unique_ptr<Output> initHDF5(
     const std::string &filename,unsigned chunking = 10,
-    bool desc = true, bool formulas = true);
+    bool desc = true, bool formulas = true, unsigned compression = 1,
+    bool threaded = false);
 
 } // namespace statistics
 } // namespace gem5
@@ -69,6 +69,11 @@ const FlagsType nozero =        0x0100;
 const FlagsType nonan =         0x0200;
 /** Print all values on a single line. Useful only for histograms. */
 const FlagsType oneline =       0x0400;
+/**
+ * Allocate the buckets of a distribution on its first sample. Must be
+ * set before the stat is initialized, @sa DistParams::lazy.
+ */
+const FlagsType lazy =          0x0800;
 
 /** Mask of flags that can't be set directly */
 const FlagsType __reserved =    init | display;
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/snapshot.hh"
+
+#include <cstring>
+
+#include "base/logging.hh"
+#include "base/stats/group.hh"
+#include "base/stats/info.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+std::string
+subname(const std::vector<std::string> &subnames, size_type i)
+{
+    if (i < subnames.size() && !subnames[i].empty())
+        return subnames[i];
+    return std::to_string(i);
+}
+
+} // anonymous namespace
+
+Snapshot::Snapshot(const Group &root,
+                   const std::vector<std::string> &patterns)
+    : _version(0)
+{
+    std::vector<std::regex> regexes(patterns.begin(), patterns.end());
+    select(root, "", regexes);
+    _values.resize(_names.size(), 0.0);
+    _changed.reserve(_names.size());
+}
+
+void
+Snapshot::select(const Group &group, const std::string &prefix,
+                 const std::vector<std::regex> &patterns)
+{
+    for (Info *info : group.getStats()) {
+        const std::string name = prefix + info->name;
+
+        bool match = patterns.empty();
+        for (auto it = patterns.begin(); !match && it != patterns.end();
+             ++it) {
+            match = std::regex_match(name, *it);
+        }
+        if (!match)
+            continue;
+
+        if (dynamic_cast<ScalarInfo *>(info)) {
+            _names.push_back(name);
+        } else if (auto *vector = dynamic_cast<VectorInfo *>(info)) {
+            for (size_type i = 0; i < vector->size(); ++i)
+                _names.push_back(name + "::" + subname(vector->subnames, i));
+        } else if (auto *vector2d = dynamic_cast<Vector2dInfo *>(info)) {
+            for (size_type i = 0; i < vector2d->x; ++i) {
+                for (size_type j = 0; j < vector2d->y; ++j) {
+                    _names.push_back(name + "::" +
+                                     subname(vector2d->subnames, i) + "_" +
+                                     subname(vector2d->y_subnames, j));
+                }
+            }
+        } else {
+            continue;
+        }
+
+        stats.push_back(info);
+    }
+
+    for (const auto &[name, child] : group.getStatGroups())
+        select(*child, prefix + name + ".", patterns);
+}
+
+void
+Snapshot::store(uint32_t &column, double value)
+{
+    // Compare the bits so that a NaN is not reported on every update
+    if (std::memcmp(&_values[column], &value, sizeof(value)) != 0) {
+        _values[column] = value;
+        _changed.push_back(column);
+    }
+    ++column;
+}
+
+void
+Snapshot::update()
+{
+    _changed.clear();
+
+    uint32_t column = 0;
+    for (Info *info : stats) {
+        info->prepare();
+
+        if (auto *scalar = dynamic_cast<ScalarInfo *>(info)) {
+            store(column, scalar->result());
+        } else if (auto *vector = dynamic_cast<VectorInfo *>(info)) {
+            const VResult &result = vector->result();
+            panic_if(result.size() != vector->size(),
+                     "Stat %s changed size after being captured.\n",
+                     info->name);
+            for (Result value : result)
+                store(column, value);
+        } else if (auto *vector2d = dynamic_cast<Vector2dInfo *>(info)) {
+            for (Counter value : vector2d->cvec)
+                store(column, value);
+        }
+    }
+    assert(column == _values.size());
+
+    ++_version;
+}
+
+} // namespace statistics
+} // namespace gem5
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_SNAPSHOT_HH__
+#define __BASE_STATS_SNAPSHOT_HH__
+
+#include <cstdint>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+class Group;
+class Info;
+
+/**
+ * A flat, contiguous copy of a selection of stats.
+ *
+ * The stats to capture are selected once, when the snapshot is
+ * created, by matching their full names (e.g., "system.cpu.ipc")
+ * against a list of regular expressions. Every call to update() then
+ * refreshes the values in place, without walking the stats tree or
+ * allocating, and bumps the version. The value array never moves once
+ * the snapshot is created, which allows consumers (e.g., NumPy through
+ * the buffer protocol) to map it directly.
+ *
+ * Scalars, vectors, formulas and 2d vectors are supported. Vectors use
+ * one column per element, named name::subname. Other stat types are
+ * silently ignored.
+ */
+class Snapshot
+{
+  public:
+    /**
+     * @param root Group to look for stats in.
+     * @param patterns Regular expressions matching the full name of the
+     *                 stats to capture. An empty list captures every
+     *                 supported stat.
+     */
+    Snapshot(const Group &root, const std::vector<std::string> &patterns);
+
+    Snapshot(const Snapshot &other) = delete;
+    Snapshot &operator=(const Snapshot &other) = delete;
+
+    /**
+     * Refresh the values of the captured stats and record the columns
+     * that changed since the previous update.
+     */
+    void update();
+
+    /** Value of every column as of the last update */
+    const std::vector<double> &values() const { return _values; }
+    /** Name of every column */
+    const std::vector<std::string> &names() const { return _names; }
+    /** Columns that changed in the last update */
+    const std::vector<uint32_t> &changed() const { return _changed; }
+    /** Number of updates so far */
+    uint64_t version() const { return _version; }
+
+  protected:
+    void select(const Group &group, const std::string &prefix,
+                const std::vector<std::regex> &patterns);
+
+    void store(uint32_t &column, double value);
+
+    /** Captured stats in column order */
+    std::vector<Info *> stats;
+
+    std::vector<double> _values;
+    std::vector<std::string> _names;
+    std::vector<uint32_t> _changed;
+    uint64_t _version;
+};
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_SNAPSHOT_HH__
@@ -49,6 +49,25 @@ namespace gem5
 namespace statistics
 {
 
+namespace
+{
+
+bool lazyDefault = false;
+
+} // anonymous namespace
+
+void
+setLazyStorage(bool lazy)
+{
+    lazyDefault = lazy;
+}
+
+bool
+lazyStorage()
+{
+    return lazyDefault;
+}
+
 void
 DistStor::sample(Counter val, int number)
 {
@@ -58,6 +77,8 @@ DistStor::sample(Counter val, int number)
     else if (val > max_track)
         overflow += number;
     else {
+        if (cvec.empty())
+            cvec.resize(buckets);
         cvec[std::floor((val - min_track) / bucket_size)] += number;
     }
 
@@ -176,6 +197,9 @@ void
 HistStor::sample(Counter val, int number)
 {
     assert(min_bucket < max_bucket);
+    if (cvec.empty())
+        cvec.resize(buckets);
+
     if (val < min_bucket) {
         if (min_bucket == 0)
             growDown();
@@ -217,6 +241,12 @@ HistStor::add(HistStor *hs)
     squares += hs->squares;
     samples += hs->samples;
 
+    // Buckets that were never allocated are all zero
+    if (hs->cvec.empty())
+        return;
+    if (cvec.empty())
+        cvec.resize(buckets);
+
     while (bucket_size > hs->bucket_size)
         hs->growUp();
     while (bucket_size < hs->bucket_size)
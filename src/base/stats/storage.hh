@@ -30,6 +30,7 @@
 #ifndef __BASE_STATS_STORAGE_HH__
 #define __BASE_STATS_STORAGE_HH__
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -50,6 +51,16 @@ struct StorageParams
     virtual ~StorageParams() = default;
 };
 
+/**
+ * Select whether distributions allocate their buckets lazily by
+ * default, see DistParams::lazy. This only affects stats initialized
+ * after the call.
+ */
+void setLazyStorage(bool lazy);
+
+/** @return True if distributions allocate their buckets lazily. */
+bool lazyStorage();
+
 /**
  * Templatized storage and interface for a simple scalar stat.
  */
@@ -219,7 +230,13 @@ class AvgStor
 struct DistParams : public StorageParams
 {
     const DistType type;
-    DistParams(DistType t) : type(t) {}
+    /**
+     * Allocate the buckets on the first sample rather than when the
+     * stat is initialized. This saves memory for the (typically many)
+     * distributions that never get sampled.
+     */
+    bool lazy;
+    DistParams(DistType t) : type(t), lazy(lazyStorage()) {}
 };
 
 /**
@@ -253,7 +270,9 @@ class DistStor
     Counter squares;
     /** The number of samples. */
     Counter samples;
-    /** Counter for each bucket. */
+    /** The number of buckets. */
+    size_type buckets;
+    /** Counter for each bucket, empty until the first sample if lazy. */
     VCounter cvec;
 
   public:
@@ -285,7 +304,8 @@ class DistStor
     };
 
     DistStor(const StorageParams* const storage_params)
-        : cvec(safe_cast<const Params *>(storage_params)->buckets)
+        : buckets(safe_cast<const Params *>(storage_params)->buckets),
+          cvec(safe_cast<const Params *>(storage_params)->lazy ? 0 : buckets)
     {
         reset(storage_params);
     }
@@ -301,7 +321,7 @@ class DistStor
      * Return the number of buckets in this distribution.
      * @return the number of buckets.
      */
-    size_type size() const { return cvec.size(); }
+    size_type size() const { return buckets; }
 
     /**
      * Returns true if any calls to sample have been made.
@@ -329,9 +349,8 @@ class DistStor
         data.underflow = underflow;
         data.overflow = overflow;
 
-        data.cvec.resize(params->buckets);
-        for (off_type i = 0; i < params->buckets; ++i)
-            data.cvec[i] = cvec[i];
+        data.cvec.assign(params->buckets, Counter());
+        std::copy(cvec.begin(), cvec.end(), data.cvec.begin());
 
         data.sum = sum;
         data.squares = squares;
@@ -413,7 +432,9 @@ class HistStor
     Counter squares;
     /** The number of samples. */
     Counter samples;
-    /** Counter for each bucket. */
+    /** The number of buckets. */
+    size_type buckets;
+    /** Counter for each bucket, empty until the first sample if lazy. */
     VCounter cvec;
 
     /**
@@ -471,7 +492,8 @@ class HistStor
     };
 
     HistStor(const StorageParams* const storage_params)
-        : cvec(safe_cast<const Params *>(storage_params)->buckets)
+        : buckets(safe_cast<const Params *>(storage_params)->buckets),
+          cvec(safe_cast<const Params *>(storage_params)->lazy ? 0 : buckets)
     {
         reset(storage_params);
     }
@@ -493,7 +515,7 @@ class HistStor
      * Return the number of buckets in this distribution.
      * @return the number of buckets.
      */
-    size_type size() const { return cvec.size(); }
+    size_type size() const { return buckets; }
 
     /**
      * Returns true if any calls to sample have been made.
@@ -519,10 +541,8 @@ class HistStor
         data.min_val = min_bucket;
         data.max_val = max_bucket;
 
-        int buckets = params->buckets;
-        data.cvec.resize(buckets);
-        for (off_type i = 0; i < buckets; ++i)
-            data.cvec[i] = cvec[i];
+        data.cvec.assign(params->buckets, Counter());
+        std::copy(cvec.begin(), cvec.end(), data.cvec.begin());
 
         data.sum = sum;
         data.logs = logs;
@@ -471,6 +471,31 @@ TEST(StatsDistStorTest, Reset)
     checkExpectedDistData(data, expected_data, true);
 }
 
+/** Test that lazy storage only allocates its buckets when sampled. */
+TEST(StatsDistStorTest, LazySamplePrepare)
+{
+    statistics::DistStor::Params params(0, 99, 5);
+    params.lazy = true;
+    statistics::DistStor stor(&params);
+    ASSERT_EQ(stor.size(), params.buckets);
+
+    // Without any sample, all buckets are reported as zero
+    statistics::DistData data;
+    stor.prepare(&params, data);
+    ASSERT_EQ(data.cvec.size(), params.buckets);
+    for (auto bucket : data.cvec)
+        ASSERT_EQ(bucket, 0);
+
+    // An underflow does not need the buckets
+    stor.sample(-10, 4);
+    stor.sample(52, 63);
+    stor.prepare(&params, data);
+    ASSERT_EQ(data.underflow, 4);
+    ASSERT_EQ(data.cvec.size(), params.buckets);
+    for (int i = 0; i < params.buckets; i++)
+        ASSERT_EQ(data.cvec[i], (i == 10) ? 63 : 0);
+}
+
 #if TRACING_ON
 /** Test that an assertion is thrown when not enough buckets are provided. */
 TEST(StatsHistStorDeathTest, NotEnoughBuckets0)
@@ -970,6 +995,31 @@ TEST(StatsHistStorTest, Add)
     checkExpectedDistData(merge_data, expected_data, false);
 }
 
+/** Test merging lazy storages that have not been sampled. */
+TEST(StatsHistStorTest, LazyAdd)
+{
+    statistics::HistStor::Params params(4);
+    params.lazy = true;
+
+    statistics::HistStor stor(&params);
+    statistics::HistStor stor2(&params);
+    stor2.sample(80, 4);
+
+    // Merging a non-sampled storage leaves the other one untouched
+    statistics::DistData data;
+    stor2.add(&stor);
+    stor2.prepare(&params, data);
+    ASSERT_EQ(data.samples, 4);
+    ASSERT_EQ(data.bucket_size, 32);
+    ASSERT_EQ(data.cvec[2], 4);
+
+    // Merging into a non-sampled storage allocates its buckets
+    stor.add(&stor2);
+    statistics::DistData merge_data;
+    stor.prepare(&params, merge_data);
+    checkExpectedDistData(merge_data, data, false);
+}
+
 /**
  * Test whether zero is correctly set as the reset value. The test order is
  * to check if it is initially zero on creation, then it is made non zero,
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Micro-benchmarks of the statistics: sampling a histogram and dumping a
+ * hierarchy of groups, like the ones of a many-core system, as text.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/statistics.hh"
+#include "base/stats/text.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** The typical statistics of a cache-like component. */
+struct ComponentStats : public statistics::Group
+{
+    ComponentStats(statistics::Group *parent, const std::string &_name)
+        : statistics::Group(parent, _name.c_str()),
+          ADD_STAT(hits, statistics::units::Count::get(),
+                   "Number of hits per requestor"),
+          ADD_STAT(misses, statistics::units::Count::get(),
+                   "Number of misses per requestor"),
+          ADD_STAT(missRate, statistics::units::Ratio::get(),
+                   "Miss rate per requestor", misses / (hits + misses)),
+          ADD_STAT(latency, statistics::units::Tick::get(),
+                   "Distribution of the access latency")
+    {
+        hits.init(8).flags(statistics::total);
+        misses.init(8).flags(statistics::total);
+        latency.init(0, 1000, 10);
+    }
+
+    statistics::Vector hits;
+    statistics::Vector misses;
+    statistics::Formula missRate;
+    statistics::Distribution latency;
+};
+
+struct SystemStats : public statistics::Group
+{
+    explicit SystemStats(int num_components)
+        : statistics::Group(nullptr)
+    {
+        for (int i = 0; i < num_components; i++) {
+            components.emplace_back(
+                new ComponentStats(this, csprintf("component%d", i)));
+        }
+    }
+
+    std::vector<std::unique_ptr<ComponentStats>> components;
+};
+
+void
+dumpGroup(statistics::Output &output, statistics::Group &group)
+{
+    for (auto *info : group.getStats()) {
+        info->prepare();
+        info->visit(output);
+    }
+    for (auto &child : group.getStatGroups()) {
+        output.beginGroup(child.first.c_str());
+        dumpGroup(output, *child.second);
+        output.endGroup();
+    }
+}
+
+/**
+ * Sample the latency histogram of a component.
+ */
+void
+StatsDistributionSample(benchmark::State &state)
+{
+    SystemStats stats(1);
+    auto &latency = stats.components[0]->latency;
+    unsigned value = 0;
+
+    for (auto _ : state) {
+        latency.sample(value);
+        value = (value + 37) % 1200;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(StatsDistributionSample);
+
+/**
+ * Dump the statistics of a system as text.
+ * Argument: number of components.
+ */
+void
+StatsDumpText(benchmark::State &state)
+{
+    SystemStats stats(state.range(0));
+    for (auto &component : stats.components) {
+        for (int i = 0; i < 8; i++) {
+            component->hits[i] = 100 + i;
+            component->misses[i] = 10 + i;
+        }
+        for (unsigned value = 0; value < 1000; value += 7)
+            component->latency.sample(value);
+    }
+
+    std::ostringstream stream;
+    statistics::Text text(stream);
+    for (auto _ : state) {
+        stream.str("");
+        text.begin();
+        dumpGroup(text, stats);
+        text.end();
+        benchmark::DoNotOptimize(stream.tellp());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * stream.tellp());
+}
+BENCHMARK(StatsDumpText)->Arg(1)->Arg(64);
+
+} // anonymous namespace
@@ -145,12 +145,9 @@ Logger::dump(Tick when, const std::string &name,
 }
 
 void
-OstreamLogger::logMessage(Tick when, const std::string &name,
+formatMessage(std::ostream &stream, Tick when, const std::string &name,
         const std::string &flag, const std::string &message)
 {
-    if (!isEnabled(name))
-        return;
-
     if (!debug::FmtTicksOff && (when != MaxTick))
         ccprintf(stream, "%7d: ", when);
 
@@ -161,6 +158,16 @@ OstreamLogger::logMessage(Tick when, const std::string &name,
         stream << name << ": ";
 
     stream << message;
+}
+
+void
+OstreamLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!isEnabled(name))
+        return;
+
+    formatMessage(stream, when, name, flag, message);
     stream.flush();
 
     if (debug::FmtStackTrace) {
@@ -32,15 +32,19 @@
 #ifndef __BASE_TRACE_HH__
 #define __BASE_TRACE_HH__
 
+#include <cstdint>
+#include <cstring>
 #include <ostream>
-#include <string>
 #include <sstream>
+#include <string>
+#include <type_traits>
 
 #include "base/compiler.hh"
 #include "base/cprintf.hh"
 #include "base/debug.hh"
 #include "base/logging.hh"
 #include "base/match.hh"
+#include "base/stl_helpers.hh"
 #include "base/types.hh"
 #include "sim/cur_tick.hh"
 
@@ -54,6 +58,73 @@ namespace gem5
 
 namespace trace {
 
+/**
+ * Type tags of the DPRINTF arguments recorded by loggers that defer
+ * formatting. Each argument is stored as its tag followed by its
+ * value in host byte order: one byte for the chars, eight bytes for the
+ * numeric types, and a 32 bit length followed by the characters for a
+ * String. Arguments of any other type are formatted with operator<<
+ * and recorded as a String.
+ */
+enum class RawArg : uint8_t
+{
+    Signed = 'i',
+    Unsigned = 'u',
+    Char = 'c',
+    UnsignedChar = 'C',
+    Float = 'f',
+    String = 's',
+    Pointer = 'p',
+};
+
+template <typename T>
+void
+encodeRawValue(std::string &buf, RawArg tag, const T &value)
+{
+    buf.push_back(static_cast<char>(tag));
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+inline void
+encodeRawString(std::string &buf, const char *str, uint32_t len)
+{
+    encodeRawValue(buf, RawArg::String, len);
+    buf.append(str, len);
+}
+
+/** Append a DPRINTF argument to buf, @sa RawArg */
+template <typename T>
+void
+encodeRawArg(std::string &buf, const T &arg)
+{
+    if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char>) {
+        encodeRawValue(buf, RawArg::Char, arg);
+    } else if constexpr (std::is_same_v<T, unsigned char>) {
+        encodeRawValue(buf, RawArg::UnsignedChar, arg);
+    } else if constexpr (std::is_same_v<T, bool>) {
+        encodeRawValue(buf, RawArg::Unsigned, uint64_t(arg));
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        encodeRawValue(buf, RawArg::Signed, int64_t(arg));
+    } else if constexpr (std::is_integral_v<T>) {
+        encodeRawValue(buf, RawArg::Unsigned, uint64_t(arg));
+    } else if constexpr (std::is_floating_point_v<T>) {
+        encodeRawValue(buf, RawArg::Float, double(arg));
+    } else if constexpr (std::is_same_v<std::decay_t<T>, char *> ||
+                         std::is_same_v<std::decay_t<T>, const char *>) {
+        encodeRawString(buf, arg, std::strlen(arg));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        encodeRawString(buf, arg.data(), arg.size());
+    } else if constexpr (std::is_pointer_v<T>) {
+        encodeRawValue(buf, RawArg::Pointer, uint64_t(uintptr_t(arg)));
+    } else {
+        using stl_helpers::operator<<;
+        std::ostringstream str;
+        str << arg;
+        const std::string &formatted = str.str();
+        encodeRawString(buf, formatted.data(), formatted.size());
+    }
+}
+
 /** Debug logging base class.  Handles formatting and outputting
  *  time/name/message messages */
 class Logger
@@ -64,6 +135,12 @@ class Logger
     /** Name match for objects to activate log */
     ObjectMatch activate;
 
+    /**
+     * Pass the unformatted arguments of DPRINTFs to logRaw() rather
+     * than formatting them at the call site.
+     */
+    bool rawArgs = false;
+
     bool isEnabled(const std::string &name) const
     {
         if (name.empty()) // Enable the logger with a empty name.
@@ -96,6 +173,13 @@ class Logger
     {
         if (!isEnabled(name))
             return;
+        if (rawArgs) {
+            std::string &buf = rawBuffer();
+            buf.clear();
+            (encodeRawArg(buf, args), ...);
+            logRaw(when, name, flag, fmt, buf);
+            return;
+        }
         std::ostringstream line;
         ccprintf(line, fmt, args...);
         logMessage(when, name, flag, line.str());
@@ -109,6 +193,29 @@ class Logger
     virtual void logMessage(Tick when, const std::string &name,
             const std::string &flag, const std::string &message) = 0;
 
+    /**
+     * Scratch buffer the raw arguments of a message are encoded into
+     * before calling logRaw(). Only used if rawArgs is set.
+     */
+    virtual std::string &
+    rawBuffer()
+    {
+        panic("Logger does not support raw arguments.\n");
+    }
+
+    /**
+     * Log a message without formatting it. Only used if rawArgs is set.
+     *
+     * @param fmt The format string.
+     * @param args The arguments, encoded as described in RawArg.
+     */
+    virtual void
+    logRaw(Tick when, const std::string &name, const std::string &flag,
+           const char *fmt, const std::string &args)
+    {
+        panic("Logger does not support raw arguments.\n");
+    }
+
     /** Return an ostream that can be used to send messages to
      *  the 'same place' as formatted logMessage messages.  This
      *  can be implemented to use a logger's underlying ostream,
@@ -131,6 +238,10 @@ class Logger
     virtual ~Logger() { }
 };
 
+/** Write a message to stream with the format used by OstreamLogger */
+void formatMessage(std::ostream &stream, Tick when, const std::string &name,
+        const std::string &flag, const std::string &message);
+
 /** Logging wrapper for ostreams with the format:
  *  <when>: <name>: <message-body> */
 class OstreamLogger : public Logger
@@ -205,6 +205,12 @@ class VncInput : public SimObject
      */
     virtual void setDirty();
 
+    /** Does anything consume the frames sent with setDirty()?
+     * Display controllers may skip rendering frames nobody looks at.
+     * @return true if frames are shown to a client or captured
+     */
+    virtual bool wantsFrames() const { return captureEnabled; }
+
   protected:
     virtual void frameBufferResized() {};
 
@@ -59,6 +59,7 @@
 #include <cerrno>
 #include <cstddef>
 #include <cstdio>
+#include <cstring>
 
 #include "base/atomicio.hh"
 #include "base/logging.hh"
@@ -118,7 +119,8 @@ VncServer::DataEvent::process(int revent)
 VncServer::VncServer(const Params &p)
     : VncInput(p), listenEvent(NULL), dataEvent(NULL), number(p.number),
       dataFd(-1), listener(p.port.build(p.name)),
-      sendUpdate(false), supportsRawEnc(false), supportsResizeEnc(false)
+      sendUpdate(false), supportsRawEnc(false), supportsResizeEnc(false),
+      supportsZlibEnc(false), sendFullFrame(true), zstreamInit(false)
 {
     if (p.port)
         listen();
@@ -152,6 +154,9 @@ VncServer::~VncServer()
 
     if (dataEvent)
         delete dataEvent;
+
+    if (zstreamInit)
+        deflateEnd(&zstream);
 }
 
 
@@ -197,6 +202,13 @@ VncServer::accept()
 
     dataFd = fd;
 
+    // The new client doesn't know anything about the frame buffer and
+    // starts a new zlib stream
+    sendFullFrame = true;
+    supportsZlibEnc = false;
+    if (zstreamInit)
+        deflateReset(&zstream);
+
     // Send our version number to the client
     write((uint8_t *)vncVersion(), strlen(vncVersion()));
 
@@ -515,7 +527,7 @@ VncServer::setEncodings()
     pem.num_encodings = betoh(pem.num_encodings);
 
     DPRINTF(VNC, " -- %d encoding present\n", pem.num_encodings);
-    supportsRawEnc = supportsResizeEnc = false;
+    supportsRawEnc = supportsResizeEnc = supportsZlibEnc = false;
 
     for (int x = 0; x < pem.num_encodings; x++) {
         int32_t encoding;
@@ -530,6 +542,9 @@ VncServer::setEncodings()
           case EncodingDesktopSize:
             supportsResizeEnc = true;
             break;
+          case EncodingZlib:
+            supportsZlibEnc = true;
+            break;
         }
     }
 
@@ -556,6 +571,13 @@ VncServer::requestFbUpdate()
     DPRINTF(VNC, " -- x = %d y = %d w = %d h = %d\n", fbr.x, fbr.y, fbr.width,
             fbr.height);
 
+    // The client lost its copy of the frame, e.g. after redrawing its
+    // window, and wants all of it once more
+    if (!fbr.incremental) {
+        sendFullFrame = true;
+        sendUpdate = true;
+    }
+
     sendFrameBufferUpdate();
 }
 
@@ -629,18 +651,37 @@ VncServer::sendFrameBufferUpdate()
     // The client will request data constantly, unless we throttle it
     sendUpdate = false;
 
-    DPRINTF(VNC, "Sending framebuffer update\n");
+    assert(fb);
+
+    FrameBuffer::Rect rect;
+    if (sendFullFrame || clientFb.width() != fb->width() ||
+        clientFb.height() != fb->height()) {
+        clientFb = *fb;
+        rect.width = fb->width();
+        rect.height = fb->height();
+        sendFullFrame = false;
+    } else {
+        rect = fb->changedArea(clientFb);
+        if (rect.empty()) {
+            DPRINTF(VNC, "Frame buffer unchanged, no update sent\n");
+            return;
+        }
+        clientFb.copyArea(*fb, rect);
+    }
+
+    DPRINTF(VNC, "Sending framebuffer update %dx%d at (%d, %d)\n",
+            rect.width, rect.height, rect.x, rect.y);
 
     FrameBufferUpdate fbu;
     FrameBufferRect fbr;
 
     fbu.type = ServerFrameBufferUpdate;
     fbu.num_rects = 1;
-    fbr.x = 0;
-    fbr.y = 0;
-    fbr.width = videoWidth();
-    fbr.height = videoHeight();
-    fbr.encoding = EncodingRaw;
+    fbr.x = rect.x;
+    fbr.y = rect.y;
+    fbr.width = rect.width;
+    fbr.height = rect.height;
+    fbr.encoding = encodeRect(rect);
 
     // fix up endian
     fbu.num_rects = htobe(fbu.num_rects);
@@ -654,20 +695,67 @@ VncServer::sendFrameBufferUpdate()
     if (!write(&fbu) || !write(&fbr))
         return;
 
-    assert(fb);
+    write(encodeBuffer.data(), encodeBuffer.size());
+}
 
-    std::vector<uint8_t> line_buffer(pixelConverter.length * fb->width());
-    for (int y = 0; y < fb->height(); ++y) {
-        // Convert and send a line at a time
-        uint8_t *raw_pixel(line_buffer.data());
-        for (unsigned x = 0; x < fb->width(); ++x) {
+int32_t
+VncServer::encodeRect(const FrameBuffer::Rect &rect)
+{
+    const size_t line_size = pixelConverter.length * rect.width;
+    std::vector<uint8_t> pixels(line_size * rect.height);
+    uint8_t *raw_pixel = pixels.data();
+    for (unsigned y = rect.y; y < rect.y + rect.height; ++y) {
+        for (unsigned x = rect.x; x < rect.x + rect.width; ++x) {
             pixelConverter.fromPixel(raw_pixel, fb->pixel(x, y));
             raw_pixel += pixelConverter.length;
         }
+    }
 
-        if (!write(line_buffer.data(), line_buffer.size()))
-            return;
+    if (!supportsZlibEnc) {
+        encodeBuffer = std::move(pixels);
+        return EncodingRaw;
+    }
+
+    if (!zstreamInit) {
+        zstream.zalloc = Z_NULL;
+        zstream.zfree = Z_NULL;
+        zstream.opaque = Z_NULL;
+        // Favour speed, screens are mostly flat colours which compress
+        // well even at the lowest level
+        if (deflateInit(&zstream, Z_BEST_SPEED) != Z_OK)
+            panic("%s: Failed to initialize zlib\n", name());
+        zstreamInit = true;
+    }
+
+    // A zlib rectangle is its compressed length followed by the data.
+    // The stream is flushed but not finished at the end of every
+    // rectangle; the client inflates all of them with one stream.
+    const size_t header_size = sizeof(uint32_t);
+    encodeBuffer.resize(
+        header_size + deflateBound(&zstream, pixels.size()) + 16);
+    zstream.next_in = pixels.data();
+    zstream.avail_in = pixels.size();
+    zstream.next_out = encodeBuffer.data() + header_size;
+    zstream.avail_out = encodeBuffer.size() - header_size;
+    while (true) {
+        [[maybe_unused]] int ret = deflate(&zstream, Z_SYNC_FLUSH);
+        assert(ret == Z_OK || ret == Z_BUF_ERROR);
+        if (zstream.avail_out)
+            break;
+        // Grow the buffer if the bound was too optimistic
+        const size_t used = encodeBuffer.size();
+        encodeBuffer.resize(used * 2);
+        zstream.next_out = encodeBuffer.data() + used;
+        zstream.avail_out = encodeBuffer.size() - used;
     }
+
+    const size_t data_size =
+        encodeBuffer.size() - header_size - zstream.avail_out;
+    encodeBuffer.resize(header_size + data_size);
+    const uint32_t length = htobe((uint32_t)data_size);
+    std::memcpy(encodeBuffer.data(), &length, header_size);
+
+    return EncodingZlib;
 }
 
 void
@@ -712,9 +800,16 @@ VncServer::setDirty()
     sendFrameBufferUpdate();
 }
 
+bool
+VncServer::wantsFrames() const
+{
+    return dataFd > 0 || VncInput::wantsFrames();
+}
+
 void
 VncServer::frameBufferResized()
 {
+    sendFullFrame = true;
     if (dataFd > 0 && curState == NormalPhase) {
         if (supportsResizeEnc)
             sendFrameBufferResized();
@@ -42,10 +42,14 @@
 #ifndef __BASE_VNC_VNC_SERVER_HH__
 #define __BASE_VNC_VNC_SERVER_HH__
 
+#include <zlib.h>
+
 #include <iostream>
+#include <vector>
 
 #include "base/circlebuf.hh"
 #include "base/compiler.hh"
+#include "base/framebuffer.hh"
 #include "base/pollevent.hh"
 #include "base/socket.hh"
 #include "base/vnc/vncinput.hh"
@@ -89,6 +93,7 @@ class VncServer : public VncInput
         EncodingRaw         = 0,
         EncodingCopyRect    = 1,
         EncodingHextile     = 5,
+        EncodingZlib        = 6,
         EncodingDesktopSize = -223
     };
 
@@ -211,6 +216,24 @@ class VncServer : public VncInput
     /** If the vnc client supports the desktop resize command */
     bool supportsResizeEnc;
 
+    /** If the vnc client supports zlib compressed rectangles */
+    bool supportsZlibEnc;
+
+    /** Copy of the frame buffer as last sent to the client */
+    FrameBuffer clientFb;
+
+    /** The whole frame must be sent with the next update */
+    bool sendFullFrame;
+
+    /** Compressor of the zlib encoding, shared by all its rectangles */
+    z_stream zstream;
+
+    /** Has zstream been initialized? */
+    bool zstreamInit;
+
+    /** Encoded pixels of the rectangle being sent */
+    std::vector<uint8_t> encodeBuffer;
+
   protected:
     /**
      * vnc client Interface
@@ -281,11 +304,18 @@ class VncServer : public VncInput
      */
     void sendError(std::string error_msg);
 
-    /** Send a updated frame buffer to the client.
-     * @todo this doesn't do anything smart and just sends the entire image
+    /** Send the area of the frame buffer that changed since the last
+     * update to the client. Nothing is sent if the frame didn't change.
      */
     void sendFrameBufferUpdate();
 
+    /** Encode an area of the frame buffer in the client pixel format.
+     * The pixels are compressed if the client supports zlib.
+     * @param rect area to encode into encodeBuffer
+     * @return the encoding used, or EncodingRaw for plain pixels
+     */
+    int32_t encodeRect(const FrameBuffer::Rect &rect);
+
     /** Receive pixel foramt message from client and process it. */
     void setPixelFormat();
 
@@ -316,6 +346,7 @@ class VncServer : public VncInput
 
   public:
     void setDirty() override;
+    bool wantsFrames() const override;
     void frameBufferResized() override;
 };
 
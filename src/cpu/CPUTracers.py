@@ -35,6 +35,21 @@ class ExeTracer(InstTracer):
     cxx_header = "cpu/exetrace.hh"
 
 
+class CompactInstTrace(InstTracer):
+    type = "CompactInstTrace"
+    cxx_class = "gem5::trace::CompactInstTrace"
+    cxx_header = "cpu/compact_inst_trace.hh"
+
+    file_name = Param.String("Instruction trace output file")
+    compress = Param.Bool(True, "Deflate the blocks of the trace")
+    block_size = Param.MemorySize(
+        "1MiB", "Size of the blocks of records before compression"
+    )
+    record_ticks = Param.Bool(
+        False, "Record the tick every instruction committed at"
+    )
+
+
 class IntelTrace(InstTracer):
     type = "IntelTrace"
     cxx_class = "gem5::trace::IntelTrace"
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/compact_inst_trace.hh"
+
+#include <zlib.h>
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/reg_class.hh"
+#include "cpu/static_inst.hh"
+#include "cpu/thread_context.hh"
+#include "params/CompactInstTrace.hh"
+#include "sim/byteswap.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace trace {
+
+namespace
+{
+
+/** Number of full blocks that can wait for the writer */
+constexpr size_t MaxFullBlocks = 4;
+
+void
+putVarint(std::string &buf, uint64_t value)
+{
+    while (value >= 0x80) {
+        buf.push_back(char(value | 0x80));
+        value >>= 7;
+    }
+    buf.push_back(char(value));
+}
+
+void
+putZigzag(std::string &buf, Addr delta)
+{
+    const int64_t value = int64_t(delta);
+    putVarint(buf, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void
+putString(std::string &buf, const std::string &str)
+{
+    putVarint(buf, str.size());
+    buf.append(str);
+}
+
+template <typename T>
+void
+putLE(std::string &buf, T value)
+{
+    value = htole(value);
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+} // anonymous namespace
+
+void
+CompactInstTraceRecord::dump()
+{
+    // Record macroops once, like InstPBTrace, but gather the registers
+    // and memory accesses of all of their microops.
+    if ((macroStaticInst && staticInst->isFirstMicroop()) ||
+            !staticInst->isMicroop()) {
+        tracer.traceInst(thread, staticInst, *pc);
+    }
+
+    tracer.traceRegs(thread, staticInst);
+
+    if (getMemValid())
+        tracer.traceMem(getAddr(), getSize());
+}
+
+CompactInstTrace::CompactInstTrace(const CompactInstTraceParams &p)
+    : InstTracer(p), outputStream(simout.create(p.file_name, true)),
+      recordTicks(p.record_ticks), codec(p.compress ? Deflate : Raw),
+      blockSize(p.block_size), blockRecords(0), lastPC(0), lastPCDelta(0),
+      lastAddr(0), lastTick(0), lastTid(0), stopping(false)
+{
+    fatal_if(blockSize == 0, "%s: The block size must not be zero.",
+             name());
+
+    std::string header("gem5cit\0", 8);
+    putLE<uint32_t>(header, Version);
+    putLE<uint32_t>(header, recordTicks ? 1 : 0);
+
+    putVarint(header, Num_OpClasses);
+    for (int i = 0; i < Num_OpClasses; ++i)
+        putString(header, enums::OpClassStrings[i]);
+
+    // Indexed by RegClassType
+    const char *reg_classes[] = {
+        IntRegClassName, FloatRegClassName, VecRegClassName,
+        VecElemClassName, VecPredRegClassName, MatRegClassName,
+        CCRegClassName, MiscRegClassName,
+    };
+    static_assert(sizeof(reg_classes) / sizeof(reg_classes[0]) ==
+                  MiscRegClass + 1);
+    putVarint(header, MiscRegClass + 1);
+    for (const char *reg_class : reg_classes)
+        putString(header, reg_class);
+
+    outputStream->stream()->write(header.data(), header.size());
+
+    block.reserve(blockSize);
+    writer = std::thread([this]() { writeLoop(); });
+
+    registerExitCallback([this]() { close(); });
+}
+
+CompactInstTrace::~CompactInstTrace()
+{
+    close();
+}
+
+CompactInstTraceRecord *
+CompactInstTrace::getInstRecord(Tick when, ThreadContext *tc,
+        const StaticInstPtr si, const PCStateBase &pc,
+        const StaticInstPtr mi)
+{
+    return new CompactInstTraceRecord(*this, when, tc, si, pc, mi);
+}
+
+void
+CompactInstTrace::traceInst(ThreadContext *tc, const StaticInstPtr &si,
+        const PCStateBase &pc)
+{
+    encodePending();
+
+    pending.valid = true;
+    pending.pc = pc.instAddr();
+    pending.opClass = si->opClass();
+    pending.tid = tc->threadId();
+    pending.tick = curTick();
+    pending.regs.clear();
+    pending.mem.clear();
+}
+
+void
+CompactInstTrace::traceRegs(ThreadContext *tc, const StaticInstPtr &si)
+{
+    if (!pending.valid)
+        return;
+
+    for (int i = 0; i < si->numDestRegs(); ++i) {
+        const RegId reg = si->destRegIdx(i).flatten(*tc->getIsaPtr());
+        if (reg.classValue() == InvalidRegClass)
+            continue;
+
+        const uint32_t reg_class = reg.classValue();
+        const uint32_t word = reg.index() / 64;
+        const uint64_t bit = 1ULL << (reg.index() % 64);
+
+        auto it = std::find_if(pending.regs.begin(), pending.regs.end(),
+            [&](const RegGroup &group) {
+                return group.regClass == reg_class && group.word == word;
+            });
+        if (it == pending.regs.end())
+            pending.regs.push_back({ reg_class, word, bit });
+        else
+            it->mask |= bit;
+    }
+}
+
+void
+CompactInstTrace::traceMem(Addr addr, Addr size)
+{
+    if (pending.valid)
+        pending.mem.push_back({ addr, size });
+}
+
+void
+CompactInstTrace::encodePending()
+{
+    if (!pending.valid)
+        return;
+    pending.valid = false;
+
+    const Addr pc_delta = pending.pc - lastPC;
+    uint8_t flags = 0;
+    if (pc_delta == lastPCDelta)
+        flags |= SamePCDelta;
+    if (!pending.regs.empty())
+        flags |= HasRegs;
+    if (!pending.mem.empty())
+        flags |= HasMem;
+    if (pending.tid != lastTid)
+        flags |= NewThread;
+
+    putVarint(block, flags);
+    putVarint(block, pending.opClass);
+    if (!(flags & SamePCDelta))
+        putZigzag(block, pc_delta);
+    if (flags & NewThread)
+        putVarint(block, pending.tid);
+    if (recordTicks)
+        putVarint(block, pending.tick - lastTick);
+    if (flags & HasRegs) {
+        putVarint(block, pending.regs.size());
+        for (const auto &group : pending.regs) {
+            putVarint(block, group.regClass);
+            putVarint(block, group.word);
+            putVarint(block, group.mask);
+        }
+    }
+    if (flags & HasMem) {
+        putVarint(block, pending.mem.size());
+        for (const auto &access : pending.mem) {
+            putZigzag(block, access.addr - lastAddr);
+            putVarint(block, access.size);
+            lastAddr = access.addr;
+        }
+    }
+
+    lastPC = pending.pc;
+    lastPCDelta = pc_delta;
+    lastTick = pending.tick;
+    lastTid = pending.tid;
+    ++blockRecords;
+
+    if (block.size() >= blockSize)
+        submitBlock();
+}
+
+void
+CompactInstTrace::submitBlock()
+{
+    if (blockRecords == 0)
+        return;
+
+    {
+        std::unique_lock<std::mutex> lock(writerLock);
+        writerCond.wait(lock, [this]() {
+            return full.size() < MaxFullBlocks;
+        });
+        full.emplace_back(std::move(block), blockRecords);
+    }
+    writerCond.notify_all();
+
+    block = std::string();
+    block.reserve(blockSize);
+    blockRecords = 0;
+
+    lastPC = 0;
+    lastPCDelta = 0;
+    lastAddr = 0;
+    lastTick = 0;
+    lastTid = 0;
+}
+
+void
+CompactInstTrace::writeLoop()
+{
+    std::vector<Bytef> compressed;
+    std::unique_lock<std::mutex> lock(writerLock);
+    while (true) {
+        writerCond.wait(lock, [this]() {
+            return stopping || !full.empty();
+        });
+        if (full.empty())
+            return;
+
+        auto [data, records] = std::move(full.front());
+        full.pop_front();
+        lock.unlock();
+        writerCond.notify_all();
+
+        Codec block_codec = Raw;
+        const char *payload = data.data();
+        size_t payload_size = data.size();
+        if (codec == Deflate) {
+            uLongf size = compressBound(data.size());
+            compressed.resize(size);
+            if (compress2(compressed.data(), &size,
+                          reinterpret_cast<const Bytef *>(data.data()),
+                          data.size(), Z_BEST_SPEED) == Z_OK &&
+                    size < data.size()) {
+                block_codec = Deflate;
+                payload = reinterpret_cast<const char *>(compressed.data());
+                payload_size = size;
+            }
+        }
+
+        std::string header;
+        putLE<uint32_t>(header, records);
+        putLE<uint32_t>(header, data.size());
+        putLE<uint32_t>(header, payload_size);
+        header.push_back(block_codec);
+
+        std::ostream &os = *outputStream->stream();
+        os.write(header.data(), header.size());
+        os.write(payload, payload_size);
+
+        lock.lock();
+    }
+}
+
+void
+CompactInstTrace::close()
+{
+    if (!outputStream)
+        return;
+
+    encodePending();
+    submitBlock();
+
+    {
+        std::lock_guard<std::mutex> lock(writerLock);
+        stopping = true;
+    }
+    writerCond.notify_all();
+    writer.join();
+
+    simout.close(outputStream);
+    outputStream = nullptr;
+}
+
+} // namespace trace
+} // namespace gem5
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_COMPACT_INST_TRACE_HH__
+#define __CPU_COMPACT_INST_TRACE_HH__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/op_class.hh"
+#include "cpu/static_inst_fwd.hh"
+#include "params/CompactInstTrace.hh"
+#include "sim/insttracer.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+class ThreadContext;
+
+namespace trace {
+
+class CompactInstTrace;
+
+class CompactInstTraceRecord : public InstRecord
+{
+  public:
+    CompactInstTraceRecord(CompactInstTrace &_tracer, Tick when,
+                           ThreadContext *tc, const StaticInstPtr si,
+                           const PCStateBase &pc,
+                           const StaticInstPtr mi=nullptr)
+        : InstRecord(when, tc, si, pc, mi), tracer(_tracer)
+    {}
+
+    void dump() override;
+
+  protected:
+    CompactInstTrace &tracer;
+};
+
+/**
+ * An ISA agnostic instruction tracer that writes a compact, delta
+ * encoded binary trace, meant for traces of billions of instructions.
+ * util/decode_compact_inst_trace.py reads it back.
+ *
+ * Each committed instruction (macroops are recorded once) stores its
+ * PC as a delta from the previous one, its op class, the registers it
+ * wrote as bitmaps and the addresses and sizes of its memory accesses.
+ * Records are gathered in blocks that are deflated and written by a
+ * background thread. The delta state is reset at the start of every
+ * block, so blocks can be decoded independently.
+ *
+ * The file starts with the magic "gem5cit\0", a u32 version, a u32
+ * set of flags (1: ticks recorded) and the names of the op classes
+ * and register classes, each table being a varint count followed by
+ * strings. Every block then holds a u32 record count, a u32 raw size,
+ * a u32 stored size and a u8 codec (0: raw, 1: deflate), all little
+ * endian, followed by the records.
+ *
+ * A record is a set of flags (see Flags) and the op class as varints,
+ * then the optional fields selected by the flags in this order:
+ *  - PC: zigzag varint delta from the previous PC;
+ *  - thread: varint thread ID;
+ *  - tick: varint delta from the previous tick, if ticks are recorded;
+ *  - registers: varint group count, then for each group the register
+ *    class, the index of a 64 register wide word and the bitmap of the
+ *    written registers in that word, all varints;
+ *  - memory: varint access count, then for each access the zigzag
+ *    varint delta from the previous address and the varint size.
+ */
+class CompactInstTrace : public InstTracer
+{
+  public:
+    static constexpr uint32_t Version = 1;
+
+    enum Flags : uint8_t
+    {
+        /** The PC advanced by the same delta as the previous record */
+        SamePCDelta = 0x1,
+        /** The record lists the registers the instruction wrote */
+        HasRegs = 0x2,
+        /** The record lists memory accesses */
+        HasMem = 0x4,
+        /** The instruction does not belong to the previous thread */
+        NewThread = 0x8,
+    };
+
+    enum Codec : uint8_t
+    {
+        Raw = 0,
+        Deflate = 1,
+    };
+
+    CompactInstTrace(const CompactInstTraceParams &p);
+    ~CompactInstTrace();
+
+    CompactInstTraceRecord *getInstRecord(Tick when, ThreadContext *tc,
+            const StaticInstPtr si, const PCStateBase &pc,
+            const StaticInstPtr mi=nullptr) override;
+
+  protected:
+    /** A register write bitmap, @sa CompactInstTrace */
+    struct RegGroup
+    {
+        uint32_t regClass;
+        uint32_t word;
+        uint64_t mask;
+    };
+
+    struct MemAccess
+    {
+        Addr addr;
+        Addr size;
+    };
+
+    /** The instruction waiting for its memory accesses and registers */
+    struct Pending
+    {
+        bool valid = false;
+        Addr pc = 0;
+        OpClass opClass = No_OpClass;
+        ThreadID tid = 0;
+        Tick tick = 0;
+        std::vector<RegGroup> regs;
+        std::vector<MemAccess> mem;
+    };
+
+    /** Start a new instruction, encoding the previous one */
+    void traceInst(ThreadContext *tc, const StaticInstPtr &si,
+                   const PCStateBase &pc);
+
+    /** Add the destination registers of a (micro)op to the instruction */
+    void traceRegs(ThreadContext *tc, const StaticInstPtr &si);
+
+    /** Add a memory access to the instruction */
+    void traceMem(Addr addr, Addr size);
+
+    void encodePending();
+
+    /** Hand the current block to the writer */
+    void submitBlock();
+
+    /** Compress and write blocks until stopped */
+    void writeLoop();
+
+    void close();
+
+    OutputStream *outputStream;
+    const bool recordTicks;
+    const Codec codec;
+    const size_t blockSize;
+
+    Pending pending;
+
+    /** Records of the current block */
+    std::string block;
+    uint32_t blockRecords;
+
+    /** Delta encoding state, reset with every block */
+    Addr lastPC;
+    Addr lastPCDelta;
+    Addr lastAddr;
+    Tick lastTick;
+    ThreadID lastTid;
+
+    /** Protects the writer state below */
+    std::mutex writerLock;
+    std::condition_variable writerCond;
+    /** Blocks waiting to be written with their record count */
+    std::deque<std::pair<std::string, uint32_t>> full;
+    bool stopping;
+
+    std::thread writer;
+
+    friend class CompactInstTraceRecord;
+};
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __CPU_COMPACT_INST_TRACE_HH__
@@ -29,6 +29,8 @@
 #ifndef __CPU_DECODE_CACHE_HH__
 #define __CPU_DECODE_CACHE_HH__
 
+#include <map>
+#include <mutex>
 #include <unordered_map>
 
 #include "base/bitfield.hh"
@@ -45,6 +47,29 @@ namespace decode_cache
 template <typename EMI>
 using InstMap = std::unordered_map<EMI, StaticInstPtr>;
 
+/**
+ * Get the instruction map shared by all the decoders which ask for the
+ * same key. The key has to capture everything besides the machine
+ * instruction that decoding depends on, like decoder parameters.
+ *
+ * Getting a map is thread safe, but using it is not: the decoders sharing
+ * a map, and the CPUs using the StaticInsts in it, have to run on the same
+ * thread. Including the decoder's event queue in the key ensures that.
+ *
+ * @param key The key identifying the map.
+ * @return The map, which lives until the end of the simulation.
+ */
+template <typename EMI, typename Key>
+InstMap<EMI> &
+sharedInstMap(const Key &key)
+{
+    static std::mutex mapsLock;
+    static std::map<Key, InstMap<EMI>> maps;
+
+    std::lock_guard<std::mutex> guard(mapsLock);
+    return maps[key];
+}
+
 /// A sparse map from an Addr to a Value, stored in page chunks.
 template<class Value, Addr CacheChunkShift = 12>
 class AddrMap
@@ -46,5 +46,13 @@ class KvmVM(SimObject):
     coalescedMMIO = VectorParam.AddrRange(
         [], "memory ranges for coalesced MMIO"
     )
+    ioEventFDs = VectorParam.Addr(
+        [],
+        "guest physical addresses of 32-bit doorbell registers (e.g., "
+        "virtio queue notify) to service through ioeventfds",
+    )
+    ioEventFDValues = Param.Unsigned(
+        8, "number of doorbell values (e.g., virtio queues) to match"
+    )
 
     system = Param.System(Parent.any, "system this VM belongs to")
@@ -290,6 +290,8 @@ BaseKvmCPU::StatGroup::StatGroup(statistics::Group *parent)
              "number of VM exits due to memory mapped IO"),
     ADD_STAT(numCoalescedMMIO, statistics::units::Count::get(),
              "number of coalesced memory mapped IO requests"),
+    ADD_STAT(numIOEventFD, statistics::units::Count::get(),
+             "number of doorbell writes serviced through ioeventfds"),
     ADD_STAT(numIO, statistics::units::Count::get(),
              "number of VM exits due to legacy IO"),
     ADD_STAT(numHalt, statistics::units::Count::get(),
@@ -819,7 +821,7 @@ BaseKvmCPU::kvmRun(Tick ticks)
 
     ++stats.numVMExits;
 
-    return ticksExecuted + flushCoalescedMMIO();
+    return ticksExecuted + flushCoalescedMMIO() + flushIOEventFDs();
 }
 
 void
@@ -1220,6 +1222,29 @@ BaseKvmCPU::flushCoalescedMMIO()
     return ticks;
 }
 
+Tick
+BaseKvmCPU::flushIOEventFDs()
+{
+    Tick ticks(0);
+    for (const auto &efd : vm->ioEventFDs()) {
+        // The eventfd counts the writes since it was last read. Doorbell
+        // writes of the same value are idempotent, so a single replay
+        // covers all of them.
+        uint64_t count;
+        if (read(efd.fd, &count, sizeof(count)) != sizeof(count))
+            continue;
+
+        DPRINTF(KvmIO, "KVM: Handling %u ioeventfd writes "
+                "(addr: 0x%x, value: %u)\n", count, efd.addr, efd.value);
+
+        ++stats.numIOEventFD;
+        uint32_t value = efd.value;
+        ticks += doMMIOAccess(efd.addr, &value, sizeof(value), true);
+    }
+
+    return ticks;
+}
+
 /**
  * Dummy handler for KVM kick signals.
  *
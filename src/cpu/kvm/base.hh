@@ -672,6 +672,14 @@ class BaseKvmCPU : public BaseCPU
      */
     Tick flushCoalescedMMIO();
 
+    /**
+     * Replay the doorbell writes the guest made to registers serviced
+     * through ioeventfds since the last exit.
+     *
+     * @return Number of ticks spent servicing the doorbell writes
+     */
+    Tick flushIOEventFDs();
+
     /**
      * Setup a signal handler to catch the timer signal used to
      * switch back to the monitor.
@@ -812,6 +820,7 @@ class BaseKvmCPU : public BaseCPU
         statistics::Scalar numExitSignal;
         statistics::Scalar numMMIO;
         statistics::Scalar numCoalescedMMIO;
+        statistics::Scalar numIOEventFD;
         statistics::Scalar numIO;
         statistics::Scalar numHalt;
         statistics::Scalar numInterrupts;
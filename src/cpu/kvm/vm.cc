@@ -40,6 +40,7 @@
 
 #include <fcntl.h>
 #include <linux/kvm.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -138,6 +139,12 @@ Kvm::capCoalescedMMIO() const
     return checkExtension(KVM_CAP_COALESCED_MMIO);
 }
 
+bool
+Kvm::capIOEventFD() const
+{
+    return checkExtension(KVM_CAP_IOEVENTFD) != 0;
+}
+
 int
 Kvm::capNumMemSlots() const
 {
@@ -329,10 +336,24 @@ KvmVM::KvmVM(const KvmVMParams &params)
     /* Setup the coalesced MMIO regions */
     for (int i = 0; i < params.coalescedMMIO.size(); ++i)
         coalesceMMIO(params.coalescedMMIO[i]);
+
+    /* Setup the doorbells serviced through ioeventfds */
+    if (!params.ioEventFDs.empty() && !kvm->capIOEventFD()) {
+        warn("KVM: ioeventfds not supported by host OS, doorbells will "
+             "exit to gem5\n");
+    } else {
+        for (Addr addr : params.ioEventFDs) {
+            for (uint32_t value = 0; value < params.ioEventFDValues; ++value)
+                registerIOEventFD(addr, value);
+        }
+    }
 }
 
 KvmVM::~KvmVM()
 {
+    for (const auto &efd : _ioEventFDs)
+        close(efd.fd);
+
     if (vmFD != -1)
         close(vmFD);
 
@@ -367,6 +388,10 @@ KvmVM::cpuStartup()
 void
 KvmVM::delayedStartup()
 {
+    // the guest accesses the backing store without going through the
+    // memories, so nothing can be left to restore on demand
+    system->getPhysMem().completeRestore();
+
     const std::vector<memory::BackingStoreEntry> &memories(
         system->getPhysMem().getBackingStore());
 
@@ -499,6 +524,29 @@ KvmVM::coalesceMMIO(Addr start, int size)
               errno);
 }
 
+void
+KvmVM::registerIOEventFD(Addr addr, uint32_t value)
+{
+    const int fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd == -1)
+        panic("KVM: Failed to create eventfd (%i)\n", errno);
+
+    struct kvm_ioeventfd ioeventfd;
+    memset(&ioeventfd, 0, sizeof(ioeventfd));
+    ioeventfd.datamatch = value;
+    ioeventfd.addr = addr;
+    ioeventfd.len = sizeof(value);
+    ioeventfd.fd = fd;
+    ioeventfd.flags = KVM_IOEVENTFD_FLAG_DATAMATCH;
+
+    DPRINTF(Kvm, "KVM: Registering ioeventfd for 0x%x (value: %u)\n",
+            addr, value);
+    if (ioctl(KVM_IOEVENTFD, (void *)&ioeventfd) == -1)
+        panic("KVM: Failed to register ioeventfd (%i)\n", errno);
+
+    _ioEventFDs.push_back({addr, value, fd});
+}
+
 void
 KvmVM::setTSSAddress(Addr tss_address)
 {
@@ -114,6 +114,9 @@ class Kvm
      */
     int capCoalescedMMIO() const;
 
+    /** Support for KvmVM::registerIOEventFD() */
+    bool capIOEventFD() const;
+
     /**
      * Attempt to determine how many memory slots are available. If it can't
      * be determined, this function returns 0.
@@ -333,6 +336,32 @@ class KvmVM : public SimObject
     void coalesceMMIO(const AddrRange &range);
     /** @} */
 
+    /**
+     * A doorbell write serviced through an ioeventfd. KVM signals the
+     * eventfd instead of exiting to gem5 when the guest writes value
+     * to addr, and the write is replayed the next time a vCPU exits.
+     */
+    struct IOEventFD
+    {
+        Addr addr;
+        uint32_t value;
+        int fd;
+    };
+
+    /**
+     * Service 32-bit writes of a value to a guest physical address
+     * through an ioeventfd.
+     *
+     * @note This functionality depends on Kvm::capIOEventFD().
+     *
+     * @param addr Physical address of the doorbell register in guest
+     * @param value Value the written data has to match
+     */
+    void registerIOEventFD(Addr addr, uint32_t value);
+
+    /** Doorbells serviced through ioeventfds */
+    const std::vector<IOEventFD> &ioEventFDs() const { return _ioEventFDs; }
+
     /**
      * @addtogroup KvmInterrupts
      * @{
@@ -557,6 +586,8 @@ class KvmVM : public SimObject
     };
     std::vector<MemorySlot> memorySlots;
     uint32_t maxMemorySlot;
+
+    std::vector<IOEventFD> _ioEventFDs;
 };
 
 } // namespace gem5
@@ -44,10 +44,14 @@
 #ifndef __CPU_MINOR_BUFFERS_HH__
 #define __CPU_MINOR_BUFFERS_HH__
 
+#include <algorithm>
+#include <cassert>
 #include <iostream>
-#include <queue>
+#include <memory>
+#include <new>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/named.hh"
@@ -403,7 +407,16 @@ template <typename ElemType,
 class Queue : public Named, public Reservable
 {
   private:
-      std::deque<ElemType> queue;
+    /** Ring of preallocated elements.  The elements never move, so a
+     *  reference to an element stays valid until it is popped, even
+     *  when the ring grows. */
+    std::vector<std::unique_ptr<ElemType>> ring;
+
+    /** Index in ring of the head element */
+    unsigned int head;
+
+    /** Number of elements in the queue */
+    unsigned int numElems;
 
     /** Number of slots currently reserved for future (reservation
      *  respecting) pushes */
@@ -419,10 +432,32 @@ class Queue : public Named, public Reservable
     Queue(const std::string &name, const std::string &data_name,
         unsigned int capacity_) :
         Named(name),
+        head(0), numElems(0),
         numReservedSlots(0),
         capacity(capacity_),
         dataName(data_name)
-    { }
+    {
+        grow(capacity == 0 ? 1 : capacity);
+    }
+
+  private:
+    /** Index in ring of the n-th element from the head */
+    unsigned int
+    slot(unsigned int n) const
+    {
+        unsigned int index = head + n;
+        return (index >= ring.size() ? index - ring.size() : index);
+    }
+
+    /** Add num_elems slots after the tail of the queue */
+    void
+    grow(unsigned int num_elems)
+    {
+        std::rotate(ring.begin(), ring.begin() + head, ring.end());
+        head = 0;
+        for (unsigned int i = 0; i < num_elems; i++)
+            ring.emplace_back(new ElemType());
+    }
 
   public:
     /** Push an element into the buffer if it isn't a bubble.  Bubbles are
@@ -433,9 +468,12 @@ class Queue : public Named, public Reservable
     {
         if (!BubbleTraits::isBubble(data)) {
             freeReservation();
-            queue.push_back(data);
+            if (numElems == ring.size())
+                grow(ring.size());
+            *ring[slot(numElems)] = data;
+            numElems++;
 
-            if (queue.size() > capacity) {
+            if (numElems > capacity) {
                 warn("%s: No space to push data into queue of capacity"
                     " %u, pushing anyway\n", name(), capacity);
             }
@@ -472,7 +510,7 @@ class Queue : public Named, public Reservable
     unsigned int totalSpace() const { return capacity; }
 
     /** Number of slots already occupied in this buffer */
-    unsigned int occupiedSpace() const { return queue.size(); }
+    unsigned int occupiedSpace() const { return numElems; }
 
     /** Number of slots which are reserved. */
     unsigned int reservedSpace() const { return numReservedSlots; }
@@ -482,7 +520,7 @@ class Queue : public Named, public Reservable
     unsigned int
     remainingSpace() const
     {
-        int ret = capacity - queue.size();
+        int ret = capacity - numElems;
 
         return (ret < 0 ? 0 : ret);
     }
@@ -491,21 +529,31 @@ class Queue : public Named, public Reservable
     unsigned int
     unreservedRemainingSpace() const
     {
-        int ret = capacity - (queue.size() + numReservedSlots);
+        int ret = capacity - (numElems + numReservedSlots);
 
         return (ret < 0 ? 0 : ret);
     }
 
     /** Head value.  Like std::queue::front */
-    ElemType &front() { return queue.front(); }
+    ElemType &front() { return *ring[head]; }
 
-    const ElemType &front() const { return queue.front(); }
+    const ElemType &front() const { return *ring[head]; }
 
-    /** Pop the head item.  Like std::queue::pop */
-    void pop() { queue.pop_front(); }
+    /** Pop the head item.  Like std::queue::pop.  The element is reset
+     *  in place so that it doesn't hold on to what it referenced */
+    void
+    pop()
+    {
+        assert(numElems != 0);
+        ElemType *elem = ring[head].get();
+        elem->~ElemType();
+        new (elem) ElemType();
+        head = slot(1);
+        numElems--;
+    }
 
     /** Is the queue empty? */
-    bool empty() const { return queue.empty(); }
+    bool empty() const { return numElems == 0; }
 
     void
     minorTrace() const
@@ -522,7 +570,7 @@ class Queue : public Named, public Reservable
         int num_printed = 1;
         /* Bodge to rotate queue to report elements */
         while (num_printed <= num_occupied) {
-            ReportTraits::reportData(data, queue[num_printed - 1]);
+            ReportTraits::reportData(data, *ring[slot(num_printed - 1)]);
             num_printed++;
 
             if (num_printed <= num_total)
@@ -50,6 +50,7 @@
 
 #include "arch/generic/isa.hh"
 #include "base/named.hh"
+#include "base/pool_alloc.hh"
 #include "base/refcnt.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -282,6 +283,23 @@ class MinorDynInst : public RefCounted
     void setMemAccPredicate(bool val) { memAccPredicate = val; }
 
     ~MinorDynInst();
+
+    /**
+     * Instructions are created for every fetched microop and live for
+     * only a few cycles, so they are allocated from per-thread pools
+     * rather than from the global heap.
+     */
+    static void *
+    operator new(std::size_t size)
+    {
+        return PoolAllocator::allocate(size);
+    }
+
+    static void
+    operator delete(void *ptr, std::size_t size)
+    {
+        PoolAllocator::deallocate(ptr, size);
+    }
 };
 
 /** Print a summary of the instruction */
@@ -45,6 +45,7 @@
 #ifndef __CPU_MINOR_NEW_LSQ_HH__
 #define __CPU_MINOR_NEW_LSQ_HH__
 
+#include <deque>
 #include <string>
 #include <vector>
 
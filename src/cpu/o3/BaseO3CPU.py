@@ -42,6 +42,7 @@ from m5.objects.BaseCPU import BaseCPU
 # from m5.objects.O3Checker import O3Checker
 from m5.objects.BranchPredictor import *
 from m5.objects.FUPool import *
+from m5.objects.ValuePredictor import *
 from m5.params import *
 from m5.proxy import *
 
@@ -58,6 +59,10 @@ class CommitPolicy(ScopedEnum):
     vals = ["RoundRobin", "OldestReady"]
 
 
+class MemDepPolicy(ScopedEnum):
+    vals = ["StoreSet", "StoreDistance", "StoreVector"]
+
+
 class BaseO3CPU(BaseCPU):
     type = "BaseO3CPU"
     cxx_class = "gem5::o3::CPU"
@@ -91,6 +96,21 @@ class BaseO3CPU(BaseCPU):
     fetchQueueSize = Param.Unsigned(
         32, "Fetch queue size in micro-ops per-thread"
     )
+    fetchTargetQueueSize = Param.Unsigned(
+        0,
+        "Number of fetch blocks the BTB may predict ahead of fetch per "
+        "thread, 0 disables the fetch target queue",
+    )
+    fetchTargetPrefetch = Param.Bool(
+        True,
+        "Prefetch the blocks of the fetch target queue into the "
+        "instruction cache",
+    )
+    fetchTargetInstAlign = Param.Unsigned(
+        0,
+        "Alignment in bytes of the branches looked up in the BTB when "
+        "predicting fetch blocks, 0 uses the decoder fetch size",
+    )
 
     renameToDecodeDelay = Param.Cycles(1, "Rename to decode delay")
     iewToDecodeDelay = Param.Cycles(
@@ -106,6 +126,14 @@ class BaseO3CPU(BaseCPU):
     commitToRenameDelay = Param.Cycles(1, "Commit to rename delay")
     decodeToRenameDelay = Param.Cycles(1, "Decode to rename delay")
     renameWidth = Param.Unsigned(8, "Rename width")
+    renameCheckpointInterval = Param.Unsigned(
+        0,
+        "Minimum number of register renames between copies of the rename "
+        "map taken at branches to speed up squashes, 0 disables them",
+    )
+    numRenameCheckpoints = Param.Unsigned(
+        8, "Maximum number of rename map copies per thread"
+    )
 
     commitToIEWDelay = Param.Cycles(
         1, "Commit to Issue/Execute/Writeback delay"
@@ -154,6 +182,18 @@ class BaseO3CPU(BaseCPU):
     )
     LFSTSize = Param.Unsigned(1024, "Last fetched store table size")
     SSITSize = Param.Unsigned(1024, "Store set ID table size")
+    memDepPolicy = Param.MemDepPolicy(
+        "StoreSet", "Memory dependence predictor"
+    )
+    storeDistTableSize = Param.Unsigned(
+        1024, "Store distance and store vector predictor table size"
+    )
+    storeDistCounterBits = Param.Unsigned(
+        2, "Confidence counter bits of the store distance predictor"
+    )
+    storeVectorSize = Param.Unsigned(
+        16, "Number of store distances tracked by a store vector"
+    )
 
     numRobs = Param.Unsigned(1, "Number of Reorder Buffers")
 
@@ -190,4 +230,7 @@ class BaseO3CPU(BaseCPU):
     branchPred = Param.BranchPredictor(
         TournamentBP(numThreads=Parent.numThreads), "Branch Predictor"
     )
+    valuePred = Param.ValuePredictor(
+        NULL, "Predictor of the values of loads, none if unset"
+    )
     needsTSO = Param.Bool(False, "Enable TSO Memory model")
@@ -96,6 +96,7 @@ Commit::Commit(CPU *_cpu, const BaseO3CPUParams &params)
       trapLatency(params.trapLatency),
       canHandleInterrupts(true),
       avoidQuiesceLiveLock(false),
+      valuePred(params.valuePred),
       stats(_cpu, this)
 {
     if (commitWidth > MaxWidth)
@@ -1269,6 +1270,13 @@ Commit::commitHead(const DynInstPtr &head_inst, unsigned inst_num)
                                  head_inst->renamedDestIdx(i));
     }
 
+    // Train the value predictor with the value the load produced.
+    if (head_inst->valuePredRecorded()) {
+        RegVal value = head_inst->isLoad() ?
+            cpu->getReg(head_inst->renamedDestIdx(0), tid) : 0;
+        valuePred->commit(tid, head_inst->seqNum, value);
+    }
+
     // hardware transactional memory
     // the HTM UID is purely for correctness and debugging purposes
     if (head_inst->isHtmStart())
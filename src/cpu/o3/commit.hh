@@ -52,6 +52,7 @@
 #include "cpu/o3/limits.hh"
 #include "cpu/o3/rename_map.hh"
 #include "cpu/o3/rob.hh"
+#include "cpu/pred/value_pred.hh"
 #include "cpu/timebuf.hh"
 #include "enums/CommitPolicy.hh"
 #include "sim/probe/probe.hh"
@@ -445,6 +446,9 @@ class Commit
     /** Rename map interface. */
     UnifiedRenameMap *renameMap[MaxThreads];
 
+    /** Value predictor trained with the committed loads, if any. */
+    value_prediction::ValuePredictor *valuePred;
+
     /** True if last committed microop can be followed by an interrupt */
     bool canHandleInterrupts;
 
@@ -123,6 +123,11 @@ CPU::CPU(const BaseO3CPUParams &params)
             "More workload items (%d) than threads (%d) on CPU %s.",
             params.workload.size(), params.numThreads, name());
 
+    DynInst::reservePool(params.numROBEntries + params.fetchQueueSize +
+            params.decodeWidth * params.fetchToDecodeDelay +
+            params.renameWidth * params.decodeToRenameDelay +
+            params.dispatchWidth * params.renameToIEWDelay);
+
     if (!params.switched_out) {
         _status = Running;
     } else {
@@ -329,8 +334,11 @@ CPU::regProbePoints()
     ppDataAccessComplete = new ProbePointArg<
         std::pair<DynInstPtr, PacketPtr>>(
                 getProbeManager(), "DataAccessComplete");
+    ppDataAccessLatency = new probing::AccessLatency(
+            getProbeManager(), "DataAccessLatency");
 
     fetch.regProbePoints();
+    decode.regProbePoints();
     rename.regProbePoints();
     iew.regProbePoints();
     commit.regProbePoints();
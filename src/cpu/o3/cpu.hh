@@ -68,6 +68,7 @@
 #include "cpu/simple_thread.hh"
 #include "cpu/timebuf.hh"
 #include "params/BaseO3CPU.hh"
+#include "sim/probe/mem.hh"
 #include "sim/process.hh"
 
 namespace gem5
@@ -175,6 +176,8 @@ class CPU : public BaseCPU
 
     ProbePointArg<PacketPtr> *ppInstAccessComplete;
     ProbePointArg<std::pair<DynInstPtr, PacketPtr> > *ppDataAccessComplete;
+    /** Data accesses, with the ticks since their request was created */
+    probing::AccessLatency *ppDataAccessLatency;
 
     /** Register probe points. */
     void regProbePoints() override;
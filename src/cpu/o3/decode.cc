@@ -119,6 +119,13 @@ Decode::name() const
     return cpu->name() + ".decode";
 }
 
+void
+Decode::regProbePoints()
+{
+    ppDecode = new ProbePointArg<DynInstPtr>(
+            cpu->getProbeManager(), "Decode");
+}
+
 Decode::DecodeStats::DecodeStats(CPU *cpu)
     : statistics::Group(cpu, "decode"),
       ADD_STAT(idleCycles, statistics::units::Cycle::get(),
@@ -685,6 +692,7 @@ Decode::decodeInsts(ThreadID tid)
         ++toRenameIndex;
         ++stats.decodedInsts;
         --insts_available;
+        ppDecode->notify(inst);
 
 #if TRACING_ON
         if (debug::O3PipeView) {
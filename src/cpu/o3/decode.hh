@@ -48,6 +48,7 @@
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/limits.hh"
 #include "cpu/timebuf.hh"
+#include "sim/probe/probe.hh"
 
 namespace gem5
 {
@@ -93,6 +94,9 @@ class Decode
     /** Decode status. */
     DecodeStatus _status;
 
+    /** To probe when an instruction is decoded. */
+    ProbePointArg<DynInstPtr> *ppDecode;
+
     /** Per-thread status. */
     ThreadStatus decodeStatus[MaxThreads];
 
@@ -110,6 +114,9 @@ class Decode
     /** Returns the name of decode. */
     std::string name() const;
 
+    /** Registers probes. */
+    void regProbePoints();
+
     /** Sets the main backwards communication time buffer pointer. */
     void setTimeBuffer(TimeBuffer<TimeStruct> *tb_ptr);
 
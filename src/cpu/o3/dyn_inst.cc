@@ -41,8 +41,11 @@
 #include "cpu/o3/dyn_inst.hh"
 
 #include <algorithm>
+#include <atomic>
+#include <cstddef>
 
 #include "base/intmath.hh"
+#include "base/pool_alloc.hh"
 #include "debug/DynInst.hh"
 #include "debug/IQ.hh"
 #include "debug/O3PipeView.hh"
@@ -53,6 +56,101 @@ namespace gem5
 namespace o3
 {
 
+namespace
+{
+
+/*
+ * DynInst buffers are recycled through free lists instead of going to the
+ * heap for every instruction. Buffers are grouped in size classes, since
+ * the number of register indices they hold depends on the instruction, and
+ * every class has its own list in each host thread so that CPUs simulated
+ * in parallel never share one. An empty list is refilled with a slab large
+ * enough for the instruction window of the largest CPU (see
+ * DynInst::reservePool()), so a CPU running at full occupancy only goes to
+ * the heap once per size class. Slabs are never handed back to the heap.
+ *
+ * Every buffer is preceded by a header recording its size class, as the
+ * delete operator is not told how large the buffer is.
+ */
+struct InstPool
+{
+    static constexpr size_t Granularity = 64;
+    static constexpr size_t NumClasses = 64;
+    static constexpr size_t HeaderSize = alignof(std::max_align_t);
+    //! Size class of buffers that are allocated from the heap.
+    static constexpr size_t HeapClass = NumClasses;
+
+    struct FreeBuf
+    {
+        FreeBuf *next;
+    };
+
+    FreeBuf *heads[NumClasses];
+};
+
+// Trivially destructible, as instructions may be freed during exit.
+thread_local InstPool instPool = {};
+
+std::atomic<size_t> slabInsts{256};
+
+void *
+allocateBuffer(size_t size)
+{
+    const size_t total = size + InstPool::HeaderSize;
+    const size_t cls = (total - 1) / InstPool::Granularity;
+
+    uint8_t *buf;
+    if (!PoolAllocator::Enabled || cls >= InstPool::NumClasses) {
+        buf = (uint8_t *)::operator new(total);
+        *(size_t *)buf = InstPool::HeapClass;
+        return buf + InstPool::HeaderSize;
+    }
+
+    InstPool::FreeBuf *&head = instPool.heads[cls];
+    if (!head) {
+        const size_t buf_size = (cls + 1) * InstPool::Granularity;
+        const size_t count = slabInsts.load(std::memory_order_relaxed);
+        uint8_t *slab = (uint8_t *)::operator new(buf_size * count);
+        for (size_t i = 0; i < count; i++) {
+            auto *free_buf = (InstPool::FreeBuf *)(slab + i * buf_size);
+            free_buf->next = head;
+            head = free_buf;
+        }
+    }
+
+    buf = (uint8_t *)head;
+    head = head->next;
+    *(size_t *)buf = cls;
+    return buf + InstPool::HeaderSize;
+}
+
+void
+freeBuffer(void *ptr)
+{
+    uint8_t *buf = (uint8_t *)ptr - InstPool::HeaderSize;
+    const size_t cls = *(size_t *)buf;
+    if (cls == InstPool::HeapClass) {
+        ::operator delete(buf);
+        return;
+    }
+
+    auto *free_buf = (InstPool::FreeBuf *)buf;
+    free_buf->next = instPool.heads[cls];
+    instPool.heads[cls] = free_buf;
+}
+
+} // anonymous namespace
+
+void
+DynInst::reservePool(size_t insts)
+{
+    size_t cur = slabInsts.load(std::memory_order_relaxed);
+    while (insts > cur &&
+            !slabInsts.compare_exchange_weak(cur, insts,
+                std::memory_order_relaxed)) {
+    }
+}
+
 DynInst::DynInst(const Arrays &arrays, const StaticInstPtr &static_inst,
         const StaticInstPtr &_macroop, InstSeqNum seq_num, CPU *_cpu)
     : seqNum(seq_num), staticInst(static_inst), cpu(_cpu),
@@ -107,15 +205,15 @@ DynInst::DynInst(const Arrays &arrays, const StaticInstPtr &_staticInst,
 {}
 
 /*
- * This custom "new" operator uses the default "new" operator to allocate space
- * for a DynInst, but also pads out the number of bytes to make room for some
+ * This custom "new" operator takes a buffer from the instruction pool to hold
+ * a DynInst, but also pads out the number of bytes to make room for some
  * extra structures the DynInst needs. We save time and improve performance by
- * only going to the heap once to get space for all these structures.
+ * only getting a single buffer for all these structures.
  *
  * When a DynInst is allocated with new, the compiler will call this "new"
  * operator with "count" set to the number of bytes it needs to store the
- * DynInst. We ultimately call into the default new operator to get those
- * bytes, but before we do, we pad out "count" so that there will be extra
+ * DynInst. We ultimately get those bytes from the pool, but before we do, we
+ * pad out "count" so that there will be extra
  * space for some structures the DynInst needs. We take into account both the
  * absolute size of these structures, and also what alignment they need.
  *
@@ -168,7 +266,7 @@ DynInst::operator new(size_t count, Arrays &arrays)
     size_t total_size = ready_src_idx + ready_src_idx_size;
 
     // Actually allocate it.
-    uint8_t *buf = (uint8_t *)::operator new(total_size);
+    uint8_t *buf = (uint8_t *)allocateBuffer(total_size);
 
     // Fill in "arrays" with pointers to all the arrays.
     arrays.flatDestIdx = (RegId *)(buf + flat_dest_idx);
@@ -193,7 +291,7 @@ DynInst::operator new(size_t count, Arrays &arrays)
 void
 DynInst::operator delete(void *ptr)
 {
-    ::operator delete(ptr);
+    freeBuffer(ptr);
 }
 
 DynInst::~DynInst()
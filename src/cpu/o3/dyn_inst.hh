@@ -97,6 +97,13 @@ class DynInst : public ExecContext, public RefCounted
     static void *operator new(size_t count, Arrays &arrays);
     static void  operator delete(void* ptr);
 
+    /**
+     * Make sure the buffers DynInsts are allocated from are refilled
+     * with room for at least this many instructions at a time. CPUs
+     * call this with the number of instructions they can have in flight.
+     */
+    static void reservePool(size_t insts);
+
     /** BaseDynInst constructor given a binary instruction. */
     DynInst(const Arrays &arrays, const StaticInstPtr &staticInst,
             const StaticInstPtr &macroop, InstSeqNum seq_num, CPU *cpu);
@@ -189,6 +196,8 @@ class DynInst : public ExecContext, public RefCounted
         HtmFromTransaction,
         NoCapableFU,           /// Processor does not have capability to
                                /// execute the instruction
+        ValuePredRecorded,
+        ValuePredicted,
         MaxFlags
     };
 
@@ -325,6 +334,9 @@ class DynInst : public ExecContext, public RefCounted
     /** Predicted PC state after this instruction. */
     std::unique_ptr<PCStateBase> predPC;
 
+    /** Predicted value of the destination, for value predicted loads. */
+    RegVal predValue = 0;
+
     /** The Macroop if one exists */
     const StaticInstPtr macroop;
 
@@ -526,6 +538,23 @@ class DynInst : public ExecContext, public RefCounted
         instFlags[PredTaken] = predicted_taken;
     }
 
+    /** Whether the value predictor has to be told when this commits. */
+    bool valuePredRecorded() const { return instFlags[ValuePredRecorded]; }
+    void valuePredRecorded(bool f) { instFlags[ValuePredRecorded] = f; }
+
+    /** Whether the destination was given a predicted value at rename. */
+    bool valuePredicted() const { return instFlags[ValuePredicted]; }
+
+    /** The value given to the destination at rename. */
+    RegVal readPredValue() const { return predValue; }
+
+    void
+    setPredValue(RegVal value)
+    {
+        predValue = value;
+        instFlags[ValuePredicted] = true;
+    }
+
     /** Returns whether the instruction mispredicted. */
     bool
     mispredicted()
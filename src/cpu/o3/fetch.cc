@@ -98,7 +98,12 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
       numThreads(params.numThreads),
       numFetchingThreads(params.smtNumFetchingThreads),
       icachePort(this, _cpu),
-      finishTranslationEvent(this), fetchStats(_cpu, this)
+      finishTranslationEvent(this),
+      fetchTargetQueueSize(params.fetchTargetQueueSize),
+      fetchTargetPrefetch(params.fetchTargetPrefetch),
+      fetchTargetInstAlign(params.fetchTargetInstAlign),
+      outstandingPrefetches(0),
+      fetchStats(_cpu, this)
 {
     if (numThreads > MaxThreads)
         fatal("numThreads (%d) is larger than compiled limit (%d),\n"
@@ -129,6 +134,9 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
         fetchBufferValid[i] = false;
         lastIcacheStall[i] = 0;
         issuePipelinedIfetch[i] = false;
+        fetchTargetPC[i] = 0;
+        fetchTargetActive[i] = false;
+        lastPrefetchAddr[i] = MaxAddr;
     }
 
     branchPred = params.branchPred;
@@ -142,6 +150,10 @@ Fetch::Fetch(CPU *_cpu, const BaseO3CPUParams &params)
 
     // Get the size of an instruction.
     instSize = decoder[0]->moreBytesSize();
+
+    if (fetchTargetInstAlign == 0)
+        fetchTargetInstAlign = instSize;
+    fetchTargetLookupPC.reset(params.isa[0]->newPCState());
 }
 
 std::string Fetch::name() const { return cpu->name() + ".fetch"; }
@@ -193,7 +205,14 @@ Fetch::FetchStatGroup::FetchStatGroup(CPU *cpu, Fetch *fetch)
              "Number of instructions fetched each cycle (Total)"),
     ADD_STAT(idleRate, statistics::units::Ratio::get(),
              "Ratio of cycles fetch was idle",
-             idleCycles / cpu->baseStats.numCycles)
+             idleCycles / cpu->baseStats.numCycles),
+    ADD_STAT(fetchTargets, statistics::units::Count::get(),
+             "Number of fetch blocks predicted ahead of fetch"),
+    ADD_STAT(fetchTargetMisses, statistics::units::Count::get(),
+             "Number of times fetch left the predicted fetch blocks"),
+    ADD_STAT(fetchTargetPrefetches, statistics::units::Count::get(),
+             "Number of instruction prefetches sent for predicted fetch "
+             "blocks")
 {
         predictedBranches
             .prereq(predictedBranches);
@@ -232,6 +251,12 @@ Fetch::FetchStatGroup::FetchStatGroup(CPU *cpu, Fetch *fetch)
             .flags(statistics::pdf);
         idleRate
             .prereq(idleRate);
+        fetchTargets
+            .prereq(fetchTargets);
+        fetchTargetMisses
+            .prereq(fetchTargetMisses);
+        fetchTargetPrefetches
+            .prereq(fetchTargetPrefetches);
 }
 void
 Fetch::setTimeBuffer(TimeBuffer<TimeStruct> *time_buffer)
@@ -283,6 +308,7 @@ Fetch::clearStates(ThreadID tid)
     fetchBufferPC[tid] = 0;
     fetchBufferValid[tid] = false;
     fetchQueue[tid].clear();
+    flushFetchTargets(tid);
 
     // TODO not sure what to do with priorityList for now
     // priorityList.push_back(tid);
@@ -314,6 +340,7 @@ Fetch::resetStage()
         fetchBufferValid[tid] = false;
 
         fetchQueue[tid].clear();
+        flushFetchTargets(tid);
 
         priorityList.push_back(tid);
     }
@@ -325,6 +352,12 @@ Fetch::resetStage()
 void
 Fetch::processCacheCompletion(PacketPtr pkt)
 {
+    if (pkt->cmd == MemCmd::SoftPFResp) {
+        delete pkt;
+        prefetchDone();
+        return;
+    }
+
     ThreadID tid = cpu->contextToThread(pkt->req->contextId());
 
     DPRINTF(Fetch, "[tid:%i] Waking up from cache miss.\n", tid);
@@ -418,7 +451,7 @@ Fetch::isDrained() const
      * cycle if the finish translation event is scheduled, so make
      * sure that's not the case.
      */
-    return !finishTranslationEvent.scheduled();
+    return !finishTranslationEvent.scheduled() && !outstandingPrefetches;
 }
 
 void
@@ -548,6 +581,8 @@ Fetch::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
         return false;
     }
 
+    syncFetchTargets(tid, vaddr);
+
     // Align the fetch address to the start of a fetch buffer segment.
     Addr fetchBufferBlockPC = fetchBufferAlignPC(vaddr);
 
@@ -681,6 +716,165 @@ Fetch::finishTranslation(const Fault &fault, const RequestPtr &mem_req)
     _status = updateFetchStatus();
 }
 
+void
+Fetch::syncFetchTargets(ThreadID tid, Addr addr)
+{
+    if (!fetchTargetQueueSize)
+        return;
+
+    auto &targets = fetchTargets[tid];
+    auto it = std::find_if(targets.begin(), targets.end(),
+            [addr](const FetchTarget &target) {
+                return target.start <= addr && addr < target.end;
+            });
+
+    if (it == targets.end()) {
+        if (!targets.empty()) {
+            DPRINTF(Fetch, "[tid:%i] Fetch address %#x was not predicted, "
+                    "restarting the fetch target queue.\n", tid, addr);
+            ++fetchStats.fetchTargetMisses;
+        }
+        targets.clear();
+        fetchTargetPC[tid] = addr;
+        fetchTargetActive[tid] = true;
+        return;
+    }
+
+    targets.erase(targets.begin(), it);
+}
+
+void
+Fetch::flushFetchTargets(ThreadID tid)
+{
+    fetchTargets[tid].clear();
+    fetchTargetActive[tid] = false;
+    lastPrefetchAddr[tid] = MaxAddr;
+}
+
+void
+Fetch::predictFetchTarget(ThreadID tid)
+{
+    if (!fetchTargetActive[tid] || stalls[tid].drain ||
+        fetchTargets[tid].size() >= fetchTargetQueueSize) {
+        return;
+    }
+
+    Addr start = fetchTargetPC[tid];
+    Addr block_end = fetchBufferAlignPC(start) + fetchBufferSize;
+    FetchTarget target{start, block_end, start & ~(cacheBlkSize - 1)};
+    Addr next_pc = block_end;
+
+    for (Addr addr = start; addr < block_end;
+         addr += fetchTargetInstAlign) {
+        if (!branchPred->BTBValid(tid, addr))
+            continue;
+
+        // The targets of returns and indirect branches are not in the
+        // BTB. Leave them to fetch and its predictors.
+        StaticInstPtr inst = branchPred->BTBGetInst(tid, addr);
+        if (inst && (inst->isReturn() || inst->isIndirectCtrl())) {
+            target.end = addr + fetchTargetInstAlign;
+            fetchTargetActive[tid] = false;
+            break;
+        }
+
+        fetchTargetLookupPC->set(addr);
+        const PCStateBase *dest =
+            branchPred->BTBLookup(tid, *fetchTargetLookupPC);
+        if (!dest)
+            continue;
+
+        // Only the BTB is consulted, so conditional branches are
+        // predicted taken when they go backwards.
+        if (!inst || inst->isUncondCtrl() || dest->instAddr() <= addr) {
+            target.end = addr + fetchTargetInstAlign;
+            next_pc = dest->instAddr();
+            break;
+        }
+    }
+
+    DPRINTF(Fetch, "[tid:%i] Predicted fetch block %#x-%#x.\n",
+            tid, target.start, target.end);
+
+    fetchTargets[tid].push_back(target);
+    fetchTargetPC[tid] = next_pc;
+    ++fetchStats.fetchTargets;
+}
+
+void
+Fetch::prefetchFetchTarget(ThreadID tid)
+{
+    if (cacheBlocked || stalls[tid].drain)
+        return;
+
+    // The block at the front is the one fetch is reading already.
+    auto &targets = fetchTargets[tid];
+    if (targets.size() < 2)
+        return;
+
+    for (auto it = std::next(targets.begin()); it != targets.end(); ++it) {
+        if (it->prefetchAddr >= it->end)
+            continue;
+
+        Addr blk_addr = it->prefetchAddr;
+        it->prefetchAddr += cacheBlkSize;
+        if (blk_addr == lastPrefetchAddr[tid])
+            continue;
+        lastPrefetchAddr[tid] = blk_addr;
+
+        DPRINTF(Fetch, "[tid:%i] Prefetching instruction block %#x.\n",
+                tid, blk_addr);
+
+        RequestPtr req = std::make_shared<Request>(
+            blk_addr, cacheBlkSize, Request::INST_FETCH | Request::PREFETCH,
+            cpu->instRequestorId(), blk_addr,
+            cpu->thread[tid]->contextId());
+        req->taskId(cpu->taskId());
+
+        ++outstandingPrefetches;
+        cpu->mmu->translateTiming(req, cpu->thread[tid]->getTC(),
+                                  new PrefetchTranslation(this),
+                                  BaseMMU::Execute);
+        return;
+    }
+}
+
+void
+Fetch::finishPrefetchTranslation(const Fault &fault, const RequestPtr &req)
+{
+    // Prefetches are only hints, so drop the ones that can't be sent
+    // right away rather than taking the port over from fetch.
+    if (fault != NoFault || req->getFlags().isSet(Request::NO_ACCESS) ||
+        req->isUncacheable() || cacheBlocked ||
+        !cpu->system->isMemAddr(req->getPaddr())) {
+        prefetchDone();
+        return;
+    }
+
+    PacketPtr pkt = new Packet(req, MemCmd::SoftPFReq);
+    pkt->allocate();
+    if (!icachePort.sendTimingReq(pkt)) {
+        // The cache will send a retry, which unblocks fetch.
+        delete pkt;
+        cacheBlocked = true;
+        prefetchDone();
+        return;
+    }
+
+    ++fetchStats.fetchTargetPrefetches;
+}
+
+void
+Fetch::prefetchDone()
+{
+    assert(outstandingPrefetches);
+    --outstandingPrefetches;
+
+    // Let a drain complete once the last prefetch is done.
+    if (!outstandingPrefetches && cpu->isDraining())
+        cpu->wakeCPU();
+}
+
 void
 Fetch::doSquash(const PCStateBase &new_pc, const DynInstPtr squashInst,
         ThreadID tid)
@@ -723,6 +917,9 @@ Fetch::doSquash(const PCStateBase &new_pc, const DynInstPtr squashInst,
     // Empty fetch queue
     fetchQueue[tid].clear();
 
+    // The predicted fetch blocks follow the squashed path.
+    flushFetchTargets(tid);
+
     // microops are being squashed, it is not known wheather the
     // youngest non-squashed microop was  marked delayed commit
     // or not. Setting the flag to true ensures that the
@@ -866,6 +1063,15 @@ Fetch::tick()
         }
     }
 
+    // Run the BTB ahead of fetch and prefetch the blocks it predicts.
+    if (fetchTargetQueueSize) {
+        for (auto tid : *activeThreads) {
+            predictFetchTarget(tid);
+            if (fetchTargetPrefetch)
+                prefetchFetchTarget(tid);
+        }
+    }
+
     // Send instructions enqueued into the fetch queue to decode.
     // Limit rate by fetchWidth.  Stall if decode is stalled.
     unsigned insts_to_decode = 0;
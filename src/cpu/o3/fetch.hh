@@ -122,6 +122,26 @@ class Fetch
         }
     };
 
+    class PrefetchTranslation : public BaseMMU::Translation
+    {
+      protected:
+        Fetch *fetch;
+
+      public:
+        PrefetchTranslation(Fetch *_fetch) : fetch(_fetch) {}
+
+        void markDelayed() {}
+
+        void
+        finish(const Fault &fault, const RequestPtr &req,
+            gem5::ThreadContext *tc, BaseMMU::Mode mode)
+        {
+            assert(mode == BaseMMU::Execute);
+            fetch->finishPrefetchTranslation(fault, req);
+            delete this;
+        }
+    };
+
   private:
     /* Event to delay delivery of a fetch translation result in case of
      * a fault and the nop to carry the fault cannot be generated
@@ -302,6 +322,39 @@ class Fetch
     bool fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc);
     void finishTranslation(const Fault &fault, const RequestPtr &mem_req);
 
+    /**
+     * Drops the fetch target queue entries fetch has moved past. If fetch
+     * went somewhere the queue did not predict, the queue is flushed and
+     * the prediction restarts from the fetch address.
+     * @param tid Thread id.
+     * @param addr The address fetch is reading instructions from.
+     */
+    void syncFetchTargets(ThreadID tid, Addr addr);
+
+    /** Empties the fetch target queue of a thread. */
+    void flushFetchTargets(ThreadID tid);
+
+    /**
+     * Predicts the next fetch block of a thread with the BTB and appends
+     * it to the fetch target queue. Taken branches end the block; returns
+     * and indirect branches stop the prediction until fetch gets there.
+     * @param tid Thread id.
+     */
+    void predictFetchTarget(ThreadID tid);
+
+    /**
+     * Starts translating the next cache block of the fetch target queue,
+     * which is prefetched into the instruction cache once translated.
+     * @param tid Thread id.
+     */
+    void prefetchFetchTarget(ThreadID tid);
+
+    /** Sends the prefetch of a fetch target block once translated. */
+    void finishPrefetchTranslation(const Fault &fault, const RequestPtr &req);
+
+    /** Accounts for a prefetch that completed or got dropped. */
+    void prefetchDone();
+
 
     /** Check if an interrupt is pending and that we need to handle
      */
@@ -530,6 +583,44 @@ class Fetch
     /** Event used to delay fault generation of translation faults */
     FinishTranslationEvent finishTranslationEvent;
 
+    /** A block of instructions the BTB predicts fetch to read. */
+    struct FetchTarget
+    {
+        /** Address of the first instruction of the block. */
+        Addr start;
+        /** Address past the last instruction of the block. */
+        Addr end;
+        /** Next cache block of the block to prefetch. */
+        Addr prefetchAddr;
+    };
+
+    /** Number of fetch blocks the BTB may predict ahead, 0 if disabled. */
+    const unsigned fetchTargetQueueSize;
+
+    /** Whether the fetch target queue blocks are prefetched. */
+    const bool fetchTargetPrefetch;
+
+    /** Alignment of the branches looked up in the BTB. */
+    unsigned fetchTargetInstAlign;
+
+    /** Fetch target queue, with the block fetch is in at the front. */
+    std::deque<FetchTarget> fetchTargets[MaxThreads];
+
+    /** Start of the next fetch block to predict. */
+    Addr fetchTargetPC[MaxThreads];
+
+    /** Whether the next fetch block can be predicted. */
+    bool fetchTargetActive[MaxThreads];
+
+    /** Last cache block prefetched from the fetch target queue. */
+    Addr lastPrefetchAddr[MaxThreads];
+
+    /** PC state used to look branches up in the BTB. */
+    std::unique_ptr<PCStateBase> fetchTargetLookupPC;
+
+    /** Number of prefetches being translated or sent to the cache. */
+    unsigned outstandingPrefetches;
+
   protected:
     struct FetchStatGroup : public statistics::Group
     {
@@ -578,6 +669,12 @@ class Fetch
         statistics::Distribution nisnDist;
         /** Rate of how often fetch was idle. */
         statistics::Formula idleRate;
+        /** Number of fetch blocks predicted ahead of fetch. */
+        statistics::Scalar fetchTargets;
+        /** Number of times fetch left the predicted fetch blocks. */
+        statistics::Scalar fetchTargetMisses;
+        /** Number of instruction prefetches sent for fetch blocks. */
+        statistics::Scalar fetchTargetPrefetches;
     } fetchStats;
 };
 
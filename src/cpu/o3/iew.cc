@@ -139,6 +139,8 @@ IEW::regProbePoints()
      */
     ppToCommit = new ProbePointArg<DynInstPtr>(
             cpu->getProbeManager(), "ToCommit");
+
+    instQueue.regProbePoints();
 }
 
 IEW::IEWStats::IEWStats(CPU *cpu)
@@ -167,6 +169,8 @@ IEW::IEWStats::IEWStats(CPU *cpu)
              "Number of times the LSQ has become full, causing a stall"),
     ADD_STAT(memOrderViolationEvents, statistics::units::Count::get(),
              "Number of memory order violations"),
+    ADD_STAT(valueMispredicts, statistics::units::Count::get(),
+             "Number of loads whose value was mispredicted"),
     ADD_STAT(predictedTakenIncorrect, statistics::units::Count::get(),
              "Number of branches that were predicted taken incorrectly"),
     ADD_STAT(predictedNotTakenIncorrect, statistics::units::Count::get(),
@@ -461,6 +465,30 @@ IEW::squashDueToMemOrder(const DynInstPtr& inst, ThreadID tid)
     }
 }
 
+void
+IEW::squashDueToValueMispredict(const DynInstPtr& inst, ThreadID tid)
+{
+    DPRINTF(IEW, "[tid:%i] [sn:%llu] Value mispredicted, squashing younger "
+            "insts, PC: %s.\n", tid, inst->seqNum, inst->pcState());
+
+    // The load itself wrote the right value, only the instructions after
+    // it may have consumed the predicted one.
+    if (!toCommit->squash[tid] ||
+            inst->seqNum < toCommit->squashedSeqNum[tid]) {
+        toCommit->squash[tid] = true;
+        toCommit->squashedSeqNum[tid] = inst->seqNum;
+        toCommit->branchTaken[tid] = false;
+
+        set(toCommit->pc[tid], inst->pcState());
+        inst->staticInst->advancePC(*toCommit->pc[tid]);
+
+        toCommit->mispredictInst[tid] = NULL;
+        toCommit->includeSquashInst[tid] = false;
+
+        wroteToTimeBuffer = true;
+    }
+}
+
 void
 IEW::block(ThreadID tid)
 {
@@ -1385,6 +1413,14 @@ IEW::writebackInsts()
                 iewStats.consumerInst[tid]+= dependents;
             }
             iewStats.writebackCount[tid]++;
+
+            if (inst->valuePredicted() &&
+                    cpu->getReg(inst->renamedDestIdx(0), tid) !=
+                    inst->readPredValue()) {
+                fetchRedirect[tid] = true;
+                ++iewStats.valueMispredicts;
+                squashDueToValueMispredict(inst, tid);
+            }
         }
     }
 }
@@ -44,6 +44,7 @@
 #include <limits>
 #include <vector>
 
+#include "base/bitfield.hh"
 #include "base/logging.hh"
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/o3/fu_pool.hh"
@@ -177,6 +178,13 @@ InstructionQueue::name() const
     return cpu->name() + ".iq";
 }
 
+void
+InstructionQueue::regProbePoints()
+{
+    ppIssue = new ProbePointArg<DynInstPtr>(
+            cpu->getProbeManager(), "Issue");
+}
+
 InstructionQueue::IQStats::IQStats(CPU *cpu, const unsigned &total_width)
     : statistics::Group(cpu),
     ADD_STAT(instsAdded, statistics::units::Count::get(),
@@ -418,11 +426,9 @@ InstructionQueue::resetState()
     for (int i = 0; i < Num_OpClasses; ++i) {
         while (!readyInsts[i].empty())
             readyInsts[i].pop();
-        queueOnList[i] = false;
-        readyIt[i] = listOrder.end();
     }
+    readyOpClasses.fill(0);
     nonSpecInsts.clear();
-    listOrder.clear();
     deferredMemInsts.clear();
     blockedMemInsts.clear();
     retryMemInsts.clear();
@@ -546,12 +552,8 @@ InstructionQueue::isFull(ThreadID tid)
 bool
 InstructionQueue::hasReadyInsts()
 {
-    if (!listOrder.empty()) {
-        return true;
-    }
-
-    for (int i = 0; i < Num_OpClasses; ++i) {
-        if (!readyInsts[i].empty()) {
+    for (auto word : readyOpClasses) {
+        if (word) {
             return true;
         }
     }
@@ -675,54 +677,44 @@ InstructionQueue::getInstToExecute()
 }
 
 void
-InstructionQueue::addToOrderList(OpClass op_class)
+InstructionQueue::addToReadyMask(OpClass op_class)
 {
     assert(!readyInsts[op_class].empty());
 
-    ListOrderEntry queue_entry;
-
-    queue_entry.queueType = op_class;
-
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    ListOrderIt list_it = listOrder.begin();
-    ListOrderIt list_end_it = listOrder.end();
-
-    while (list_it != list_end_it) {
-        if ((*list_it).oldestInst > queue_entry.oldestInst) {
-            break;
-        }
+    // The new instruction may be older than the previous oldest one.
+    oldestReady[op_class] = readyInsts[op_class].top()->seqNum;
+    readyOpClasses[op_class / 64] |= 1ULL << (op_class % 64);
+}
 
-        list_it++;
+void
+InstructionQueue::moveToYoungerInst(OpClass op_class)
+{
+    if (readyInsts[op_class].empty()) {
+        readyOpClasses[op_class / 64] &= ~(1ULL << (op_class % 64));
+    } else {
+        oldestReady[op_class] = readyInsts[op_class].top()->seqNum;
     }
-
-    readyIt[op_class] = listOrder.insert(list_it, queue_entry);
-    queueOnList[op_class] = true;
 }
 
-void
-InstructionQueue::moveToYoungerInst(ListOrderIt list_order_it)
+OpClass
+InstructionQueue::selectOldestReady(const OpClassMask &skip) const
 {
-    // Get iterator of next item on the list
-    // Delete the original iterator
-    // Determine if the next item is either the end of the list or younger
-    // than the new instruction.  If so, then add in a new iterator right here.
-    // If not, then move along.
-    ListOrderEntry queue_entry;
-    OpClass op_class = (*list_order_it).queueType;
-    ListOrderIt next_it = list_order_it;
-
-    ++next_it;
-
-    queue_entry.queueType = op_class;
-    queue_entry.oldestInst = readyInsts[op_class].top()->seqNum;
-
-    while (next_it != listOrder.end() &&
-           (*next_it).oldestInst < queue_entry.oldestInst) {
-        ++next_it;
+    OpClass oldest_class = Num_OpClasses;
+    InstSeqNum oldest = std::numeric_limits<InstSeqNum>::max();
+
+    for (int i = 0; i < OpClassMaskWords; ++i) {
+        uint64_t word = readyOpClasses[i] & ~skip[i];
+        while (word) {
+            const int op_class = i * 64 + findLsbSet(word);
+            word &= word - 1;
+            if (oldestReady[op_class] < oldest) {
+                oldest = oldestReady[op_class];
+                oldest_class = (OpClass)op_class;
+            }
+        }
     }
 
-    readyIt[op_class] = listOrder.insert(next_it, queue_entry);
+    return oldest_class;
 }
 
 void
@@ -766,20 +758,21 @@ InstructionQueue::scheduleReadyInsts()
         addReadyMemInst(mem_inst);
     }
 
-    // Have iterator to head of the list
-    // While I haven't exceeded bandwidth or reached the end of the list,
+    // Repeatedly select the op class with the oldest ready instruction.
+    // While I haven't exceeded bandwidth or run out of op classes,
     // Try to get a FU that can do what this op needs.
-    // If successful, change the oldestInst to the new top of the list, put
-    // the queue in the proper place in the list.
-    // Increment the iterator.
+    // If successful, remove the instruction from its ready queue, which
+    // makes the next oldest instruction of that queue eligible.
+    // If not, skip the op class for the rest of the cycle.
     // This will avoid trying to schedule a certain op class if there are no
     // FUs that handle it.
     int total_issued = 0;
-    ListOrderIt order_it = listOrder.begin();
-    ListOrderIt order_end_it = listOrder.end();
+    OpClassMask busy_classes{};
 
-    while (total_issued < totalWidth && order_it != order_end_it) {
-        OpClass op_class = (*order_it).queueType;
+    while (total_issued < totalWidth) {
+        OpClass op_class = selectOldestReady(busy_classes);
+        if (op_class == Num_OpClasses)
+            break;
 
         assert(!readyInsts[op_class].empty());
 
@@ -793,19 +786,11 @@ InstructionQueue::scheduleReadyInsts()
             iqIOStats.intInstQueueReads++;
         }
 
-        assert(issuing_inst->seqNum == (*order_it).oldestInst);
+        assert(issuing_inst->seqNum == oldestReady[op_class]);
 
         if (issuing_inst->isSquashed()) {
             readyInsts[op_class].pop();
-
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
-
-            listOrder.erase(order_it++);
+            moveToYoungerInst(op_class);
 
             ++iqStats.squashedInstsIssued;
 
@@ -878,16 +863,11 @@ InstructionQueue::scheduleReadyInsts()
                     issuing_inst->seqNum);
 
             readyInsts[op_class].pop();
-
-            if (!readyInsts[op_class].empty()) {
-                moveToYoungerInst(order_it);
-            } else {
-                readyIt[op_class] = listOrder.end();
-                queueOnList[op_class] = false;
-            }
+            moveToYoungerInst(op_class);
 
             issuing_inst->setIssued();
             ++total_issued;
+            ppIssue->notify(issuing_inst);
 
 #if TRACING_ON
             issuing_inst->issueTick = curTick() - issuing_inst->fetchTick;
@@ -906,13 +886,12 @@ InstructionQueue::scheduleReadyInsts()
                 memDepUnit[tid].issue(issuing_inst);
             }
 
-            listOrder.erase(order_it++);
             iqStats.statIssuedInstType[tid][op_class]++;
         } else {
             assert(idx == FUPool::NoFreeFU);
             iqStats.statFuBusy[op_class]++;
             iqStats.fuBusy[tid]++;
-            ++order_it;
+            busy_classes[op_class / 64] |= 1ULL << (op_class % 64);
         }
     }
 
@@ -920,10 +899,17 @@ InstructionQueue::scheduleReadyInsts()
     iqStats.instsIssued+= total_issued;
 
     // If we issued any instructions, tell the CPU we had activity.
-    // @todo If the way deferred memory instructions are handeled due to
-    // translation changes then the deferredMemInsts condition should be
-    // removed from the code below.
-    if (total_issued || !retryMemInsts.empty() || !deferredMemInsts.empty()) {
+    // Deferred memory instructions only keep the CPU active once they can
+    // be rescheduled. A translation that completes later wakes the CPU.
+    bool deferred_ready = false;
+    for (const auto &inst : deferredMemInsts) {
+        if (inst->translationCompleted() || inst->isSquashed()) {
+            deferred_ready = true;
+            break;
+        }
+    }
+
+    if (total_issued || !retryMemInsts.empty() || deferred_ready) {
         cpu->activityThisCycle();
     } else {
         DPRINTF(IQ, "Not able to schedule any instructions.\n");
@@ -1082,15 +1068,7 @@ InstructionQueue::addReadyMemInst(const DynInstPtr &ready_inst)
 
     readyInsts[op_class].push(ready_inst);
 
-    // Will need to reorder the list if either a queue is not on the list,
-    // or it has an older instruction than last time.
-    if (!queueOnList[op_class]) {
-        addToOrderList(op_class);
-    } else if (readyInsts[op_class].top()->seqNum  <
-               (*readyIt[op_class]).oldestInst) {
-        listOrder.erase(readyIt[op_class]);
-        addToOrderList(op_class);
-    }
+    addToReadyMask(op_class);
 
     DPRINTF(IQ, "Instruction is ready to issue, putting it onto "
             "the ready list, PC %s opclass:%i [sn:%llu].\n",
@@ -1451,15 +1429,7 @@ InstructionQueue::addIfReady(const DynInstPtr &inst)
 
         readyInsts[op_class].push(inst);
 
-        // Will need to reorder the list if either a queue is not on the list,
-        // or it has an older instruction than last time.
-        if (!queueOnList[op_class]) {
-            addToOrderList(op_class);
-        } else if (readyInsts[op_class].top()->seqNum  <
-                   (*readyIt[op_class]).oldestInst) {
-            listOrder.erase(readyIt[op_class]);
-            addToOrderList(op_class);
-        }
+        addToReadyMask(op_class);
     }
 }
 
@@ -1493,18 +1463,12 @@ InstructionQueue::dumpLists()
 
     cprintf("\n");
 
-    ListOrderIt list_order_it = listOrder.begin();
-    ListOrderIt list_order_end_it = listOrder.end();
-    int i = 1;
+    cprintf("Ready op classes: ");
 
-    cprintf("List order: ");
-
-    while (list_order_it != list_order_end_it) {
-        cprintf("%i OpClass:%i [sn:%llu] ", i, (*list_order_it).queueType,
-                (*list_order_it).oldestInst);
-
-        ++list_order_it;
-        ++i;
+    for (int i = 0; i < Num_OpClasses; ++i) {
+        if (readyOpClasses[i / 64] & (1ULL << (i % 64))) {
+            cprintf("OpClass:%i [sn:%llu] ", i, oldestReady[i]);
+        }
     }
 
     cprintf("\n");
@@ -1557,7 +1521,7 @@ InstructionQueue::dumpInsts()
 
     int num = 0;
     int valid_num = 0;
-    ListIt inst_list_it = instsToExecute.begin();
+    auto inst_list_it = instsToExecute.begin();
 
     while (inst_list_it != instsToExecute.end())
     {
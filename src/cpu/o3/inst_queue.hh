@@ -42,6 +42,8 @@
 #ifndef __CPU_O3_INST_QUEUE_HH__
 #define __CPU_O3_INST_QUEUE_HH__
 
+#include <array>
+#include <deque>
 #include <list>
 #include <map>
 #include <queue>
@@ -60,6 +62,7 @@
 #include "cpu/timebuf.hh"
 #include "enums/SMTQueuePolicy.hh"
 #include "sim/eventq.hh"
+#include "sim/probe/probe.hh"
 
 namespace gem5
 {
@@ -139,6 +142,9 @@ class InstructionQueue
     /** Returns the name of the IQ. */
     std::string name() const;
 
+    /** Registers probes. */
+    void regProbePoints();
+
     /** Resets all instruction queue state. */
     void resetState();
 
@@ -288,6 +294,9 @@ class InstructionQueue
     /** Pointer to the CPU. */
     CPU *cpu;
 
+    /** To probe when an instruction is issued. */
+    ProbePointArg<DynInstPtr> *ppIssue;
+
     /** Cache interface. */
     memory::MemInterface *dcacheInterface;
 
@@ -321,7 +330,7 @@ class InstructionQueue
     std::list<DynInstPtr> instList[MaxThreads];
 
     /** List of instructions that are ready to be executed. */
-    std::list<DynInstPtr> instsToExecute;
+    std::deque<DynInstPtr> instsToExecute;
 
     /** List of instructions waiting for their DTB translation to
      *  complete (hw page table walk in progress).
@@ -367,40 +376,40 @@ class InstructionQueue
 
     typedef std::map<InstSeqNum, DynInstPtr>::iterator NonSpecMapIt;
 
-    /** Entry for the list age ordering by op class. */
-    struct ListOrderEntry
-    {
-        OpClass queueType;
-        InstSeqNum oldestInst;
-    };
+    /** Number of 64-bit words in a mask with a bit per op class. */
+    static constexpr int OpClassMaskWords = (Num_OpClasses + 63) / 64;
 
-    /** List that contains the age order of the oldest instruction of each
-     *  ready queue.  Used to select the oldest instruction available
-     *  among op classes.
-     *  @todo: Might be better to just move these entries around instead
-     *  of creating new ones every time the position changes due to an
-     *  instruction issuing.  Not sure std::list supports this.
-     */
-    std::list<ListOrderEntry> listOrder;
+    typedef std::array<uint64_t, OpClassMaskWords> OpClassMask;
 
-    typedef typename std::list<ListOrderEntry>::iterator ListOrderIt;
+    /** Mask of the op classes whose ready queue is not empty. Selecting
+     *  the oldest ready instruction only looks at these op classes. */
+    OpClassMask readyOpClasses;
 
-    /** Tracks if each ready queue is on the age order list. */
-    bool queueOnList[Num_OpClasses];
+    /** Sequence number of the oldest instruction of each ready queue.
+     *  Only valid if the op class is set in readyOpClasses. Kept apart
+     *  from the queues so that selection does not touch the
+     *  instructions. */
+    InstSeqNum oldestReady[Num_OpClasses];
 
-    /** Iterators of each ready queue.  Points to their spot in the age order
-     *  list.
-     */
-    ListOrderIt readyIt[Num_OpClasses];
+    /** Marks an op class as ready after an instruction was added to its
+     *  ready queue. */
+    void addToReadyMask(OpClass op_class);
 
-    /** Add an op class to the age order list. */
-    void addToOrderList(OpClass op_class);
+    /**
+     * Called when the oldest instruction has been removed from a ready
+     * queue; updates the oldest instruction of the queue, or clears it
+     * from the ready mask if it is empty.
+     */
+    void moveToYoungerInst(OpClass op_class);
 
     /**
-     * Called when the oldest instruction has been removed from a ready queue;
-     * this places that ready queue into the proper spot in the age order list.
+     * Selects the op class whose oldest ready instruction is the oldest
+     * among the ready op classes not set in a mask.
+     *
+     * @param skip Op classes that can't be issued from.
+     * @return The op class, or Num_OpClasses if there is none.
      */
-    void moveToYoungerInst(ListOrderIt age_order_it);
+    OpClass selectOldestReady(const OpClassMask &skip) const;
 
     DependencyGraph<DynInstPtr> dependGraph;
 
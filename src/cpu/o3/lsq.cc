@@ -896,6 +896,10 @@ LSQ::SingleDataRequest::finish(const Fault &fault, const RequestPtr &request,
 
         LSQRequest::_inst->fault = fault;
         LSQRequest::_inst->translationCompleted(true);
+        // The instruction was deferred while a delayed translation was in
+        // progress, and the CPU may have gone idle since.
+        if (isDelayed())
+            LSQRequest::_inst->cpu->wakeCPU();
     }
 }
 
@@ -921,6 +925,8 @@ LSQ::SplitDataRequest::finish(const Fault &fault, const RequestPtr &req,
             _inst->strictlyOrdered(_mainReq->isStrictlyOrdered());
             flags.set(Flag::TranslationFinished);
             _inst->translationCompleted(true);
+            if (isDelayed())
+                _inst->cpu->wakeCPU();
 
             for (i = 0; i < _fault.size() && _fault[i] == NoFault; i++);
             if (i > 0) {
@@ -160,7 +160,16 @@ LSQUnit::completeDataAccess(PacketPtr pkt)
         }
     }
 
-    cpu->ppDataAccessComplete->notify(std::make_pair(inst, pkt));
+    cpu->ppDataAccessComplete->notifyWith([&]() {
+        return std::make_pair(inst, pkt);
+    });
+    cpu->ppDataAccessLatency->notifyWith([&]() {
+        const RequestPtr &req = pkt->req;
+        return probing::AccessLatencyInfo{
+            pkt->getAddr(), pkt->getSize(), pkt->isRead(),
+            req->requestorId(), req->hasPC() ? req->getPC() : 0,
+            curTick() - req->time() };
+    });
 
     assert(!cpu->switchedOut());
     if (!inst->isSquashed()) {
@@ -238,9 +247,38 @@ LSQUnit::resetState()
 
     stalled = false;
 
+    loadFilter.clear();
+    storeFilter.clear();
+
     cacheBlockMask = ~(cpu->cacheLineSize() - 1);
 }
 
+void
+LSQUnit::addToFilter(AddrFilter &filter, LSQEntry &entry, Addr addr,
+        unsigned size)
+{
+    // Use the same block range as checkViolations(). A zero sized
+    // access at the start of a block covers no blocks.
+    Addr start = addr >> depCheckShift;
+    Addr end = (addr + size - 1) >> depCheckShift;
+    if (entry.inFilter() || end < start)
+        return;
+
+    filter.add(start, end);
+    entry.filterStart() = start;
+    entry.filterEnd() = end;
+    entry.inFilter() = true;
+}
+
+void
+LSQUnit::removeFromFilter(AddrFilter &filter, LSQEntry &entry)
+{
+    if (entry.inFilter()) {
+        filter.remove(entry.filterStart(), entry.filterEnd());
+        entry.inFilter() = false;
+    }
+}
+
 std::string
 LSQUnit::name() const
 {
@@ -513,13 +551,20 @@ LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
     Addr inst_eff_addr1 = inst->effAddr >> depCheckShift;
     Addr inst_eff_addr2 = (inst->effAddr + inst->effSize - 1) >> depCheckShift;
 
+    // Every load with a valid address is in the filter, so if none of
+    // them can overlap there is no violation to look for.
+    if (inst_eff_addr2 >= inst_eff_addr1 &&
+            !loadFilter.mayContain(inst_eff_addr1, inst_eff_addr2)) {
+        return NoFault;
+    }
+
     /** @todo in theory you only need to check an instruction that has executed
      * however, there isn't a good way in the pipeline at the moment to check
      * all instructions that will execute before the store writes back. Thus,
      * like the implementation that came before it, we're overly conservative.
      */
     while (loadIt != loadQueue.end()) {
-        DynInstPtr ld_inst = loadIt->instruction();
+        const DynInstPtr &ld_inst = loadIt->instruction();
         if (!ld_inst->effAddrValid() || ld_inst->strictlyOrdered()) {
             ++loadIt;
             continue;
@@ -734,6 +779,7 @@ LSQUnit::commitLoad()
                     inst->lastWakeDependents - inst->firstIssue));
     }
 
+    removeFromFilter(loadFilter, loadQueue.front());
     loadQueue.front().clear();
     loadQueue.pop_front();
 }
@@ -954,6 +1000,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         }
         // Clear the smart pointer to make sure it is decremented.
         loadQueue.back().instruction()->setSquashed();
+        removeFromFilter(loadFilter, loadQueue.back());
         loadQueue.back().clear();
 
         loadQueue.pop_back();
@@ -1025,6 +1072,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         // Must delete request now that it wasn't handed off to
         // memory.  This is quite ugly.  @todo: Figure out the proper
         // place to really handle request deletes.
+        removeFromFilter(storeFilter, storeQueue.back());
         storeQueue.back().clear();
 
         storeQueue.pop_back();
@@ -1149,6 +1197,7 @@ LSQUnit::completeStore(typename StoreQueue::iterator store_idx)
     DynInstPtr store_inst = store_idx->instruction();
     if (store_idx == storeQueue.begin()) {
         do {
+            removeFromFilter(storeFilter, storeQueue.front());
             storeQueue.front().clear();
             storeQueue.pop_front();
         } while (storeQueue.front().completed() &&
@@ -1322,6 +1371,11 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
     load_entry.setRequest(request);
     assert(load_inst);
 
+    // The load's address was just set, make it visible to stores checking
+    // for violations.
+    addToFilter(loadFilter, load_entry, load_inst->effAddr,
+            load_inst->effSize);
+
     assert(!load_inst->isExecuted());
 
     // Make sure this isn't a strictly ordered load
@@ -1382,9 +1436,18 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
         return NoFault;
     }
 
-    // Check the SQ for any previous stores that might lead to forwarding
+    // Check the SQ for any previous stores that might lead to forwarding.
+    // Forwarding needs the accesses to overlap, so the search can be
+    // skipped if no store with data can overlap the load.
     auto store_it = load_inst->sqIt;
     assert (store_it >= storeWBIt);
+    const Addr load_addr = request->mainReq()->getVaddr();
+    const unsigned load_size = request->mainReq()->getSize();
+    if (load_size != 0 &&
+            !storeFilter.mayContain(load_addr >> depCheckShift,
+                (load_addr + load_size - 1) >> depCheckShift)) {
+        store_it = storeWBIt;
+    }
     // End once we've reached the top of the LSQ
     while (store_it != storeWBIt && !load_inst->isDataPrefetch()) {
         // Move the index to one younger
@@ -1613,6 +1676,8 @@ LSQUnit::write(LSQRequest *request, uint8_t *data, ssize_t store_idx)
     storeQueue[store_idx].setRequest(request);
     unsigned size = request->_size;
     storeQueue[store_idx].size() = size;
+    addToFilter(storeFilter, storeQueue[store_idx],
+            storeQueue[store_idx].instruction()->effAddr, size);
     bool store_no_data =
         request->mainReq()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
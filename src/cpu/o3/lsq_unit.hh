@@ -43,6 +43,7 @@
 #define __CPU_O3_LSQ_UNIT_HH__
 
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <map>
 #include <memory>
@@ -103,6 +104,11 @@ class LSQUnit
         uint32_t _size = 0;
         /** Valid entry. */
         bool _valid = false;
+        /** Whether the entry's address is in the LSQ unit's filter. */
+        bool _inFilter = false;
+        /** First and last address block registered with the filter. */
+        Addr _filterStart = 0;
+        Addr _filterEnd = 0;
 
       public:
         ~LSQEntry()
@@ -123,6 +129,7 @@ class LSQUnit
             _request = nullptr;
             _valid = false;
             _size = 0;
+            _inFilter = false;
         }
 
         void
@@ -140,6 +147,9 @@ class LSQUnit
         /** Member accessors. */
         /** @{ */
         bool valid() const { return _valid; }
+        bool& inFilter() { return _inFilter; }
+        Addr& filterStart() { return _filterStart; }
+        Addr& filterEnd() { return _filterEnd; }
         uint32_t& size() { return _size; }
         const uint32_t& size() const { return _size; }
         const DynInstPtr& instruction() const { return _inst; }
@@ -196,6 +206,68 @@ class LSQUnit
     };
     using LQEntry = LSQEntry;
 
+    /**
+     * Counting filter over the addresses of the entries in a load or
+     * store queue, in the address blocks used for dependence checks.
+     * Blocks alias modulo the number of counters, so a hit still
+     * requires searching the queue, but a miss proves that no entry
+     * overlaps the address range and lets the search be skipped.
+     */
+    class AddrFilter
+    {
+      public:
+        static constexpr Addr NumCounters = 256;
+
+        void
+        add(Addr start, Addr end)
+        {
+            if (end - start >= NumCounters) {
+                ++wide;
+                return;
+            }
+            for (Addr block = start; block <= end; ++block)
+                ++counters[block % NumCounters];
+        }
+
+        void
+        remove(Addr start, Addr end)
+        {
+            if (end - start >= NumCounters) {
+                assert(wide);
+                --wide;
+                return;
+            }
+            for (Addr block = start; block <= end; ++block) {
+                assert(counters[block % NumCounters]);
+                --counters[block % NumCounters];
+            }
+        }
+
+        bool
+        mayContain(Addr start, Addr end) const
+        {
+            if (wide || end - start >= NumCounters)
+                return true;
+            for (Addr block = start; block <= end; ++block) {
+                if (counters[block % NumCounters])
+                    return true;
+            }
+            return false;
+        }
+
+        void
+        clear()
+        {
+            counters.fill(0);
+            wide = 0;
+        }
+
+      private:
+        std::array<uint32_t, NumCounters> counters{};
+        /** Entries spanning more blocks than there are counters. */
+        uint32_t wide = 0;
+    };
+
     /** Coverage of one address range with another */
     enum class AddrRangeCoverage
     {
@@ -460,6 +532,22 @@ class LSQUnit
     /** Should loads be checked for dependency issues */
     bool checkLoads;
 
+    /** Addresses of the loads in the LQ that have one. */
+    AddrFilter loadFilter;
+
+    /** Addresses of the stores in the SQ that have data. */
+    AddrFilter storeFilter;
+
+    /**
+     * Registers the address range of a queue entry with a filter, unless
+     * it is already registered or the range has no blocks.
+     */
+    void addToFilter(AddrFilter &filter, LSQEntry &entry, Addr addr,
+                     unsigned size);
+
+    /** Unregisters a queue entry from a filter before it is removed. */
+    void removeFromFilter(AddrFilter &filter, LSQEntry &entry);
+
     /** The number of store instructions in the SQ waiting to writeback. */
     int storesToWB;
 
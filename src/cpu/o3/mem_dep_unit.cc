@@ -37,7 +37,10 @@
 #include "cpu/o3/dyn_inst.hh"
 #include "cpu/o3/inst_queue.hh"
 #include "cpu/o3/limits.hh"
+#include "cpu/o3/store_distance.hh"
+#include "cpu/o3/store_set.hh"
 #include "debug/MemDepUnit.hh"
+#include "enums/MemDepPolicy.hh"
 #include "params/BaseO3CPU.hh"
 
 namespace gem5
@@ -56,8 +59,7 @@ MemDepUnit::MemDepUnit() : iqPtr(NULL), stats(nullptr) {}
 
 MemDepUnit::MemDepUnit(const BaseO3CPUParams &params)
     : _name(params.name + ".memdepunit"),
-      depPred(params.store_set_clear_period, params.SSITSize,
-              params.LFSTSize),
+      depPred(createPredictor(params)),
       iqPtr(NULL),
       stats(nullptr)
 {
@@ -96,13 +98,32 @@ MemDepUnit::init(const BaseO3CPUParams &params, ThreadID tid, CPU *cpu)
     _name = csprintf("%s.memDep%d", params.name, tid);
     id = tid;
 
-    depPred.init(params.store_set_clear_period, params.SSITSize,
-            params.LFSTSize);
+    depPred = createPredictor(params);
 
     std::string stats_group_name = csprintf("MemDepUnit__%i", tid);
     cpu->addStatGroup(stats_group_name.c_str(), &stats);
 }
 
+std::unique_ptr<MemDepPredictor>
+MemDepUnit::createPredictor(const BaseO3CPUParams &params)
+{
+    switch (params.memDepPolicy) {
+      case MemDepPolicy::StoreSet:
+        return std::make_unique<StoreSet>(params.store_set_clear_period,
+                params.SSITSize, params.LFSTSize, params.SQEntries);
+      case MemDepPolicy::StoreDistance:
+        return std::make_unique<StoreDistance>(params.store_set_clear_period,
+                params.storeDistTableSize, params.SQEntries,
+                params.storeDistCounterBits);
+      case MemDepPolicy::StoreVector:
+        return std::make_unique<StoreVector>(params.store_set_clear_period,
+                params.storeDistTableSize, params.SQEntries,
+                params.storeVectorSize);
+      default:
+        panic("Unknown memory dependence policy.");
+    }
+}
+
 MemDepUnit::MemDepUnitStats::MemDepUnitStats(statistics::Group *parent)
     : statistics::Group(parent),
       ADD_STAT(insertedLoads, statistics::units::Count::get(),
@@ -145,7 +166,7 @@ MemDepUnit::takeOverFrom()
     // Be sure to reset all state.
     loadBarrierSNs.clear();
     storeBarrierSNs.clear();
-    depPred.clear();
+    depPred->clear();
 }
 
 void
@@ -220,9 +241,8 @@ MemDepUnit::insert(const DynInstPtr &inst)
                                 std::begin(storeBarrierSNs),
                                 std::end(storeBarrierSNs));
     } else {
-        InstSeqNum dep = depPred.checkInst(inst->pcState().instAddr());
-        if (dep != 0)
-            producing_stores.push_back(dep);
+        depPred->checkInst(inst->pcState().instAddr(), inst->seqNum,
+                           producing_stores);
     }
 
     std::vector<MemDepEntryPtr> store_entries;
@@ -286,7 +306,7 @@ MemDepUnit::insert(const DynInstPtr &inst)
         DPRINTF(MemDepUnit, "Inserting store/atomic PC %s [sn:%lli].\n",
                 inst->pcState(), inst->seqNum);
 
-        depPred.insertStore(inst->pcState().instAddr(), inst->seqNum,
+        depPred->insertStore(inst->pcState().instAddr(), inst->seqNum,
                 inst->threadNumber);
 
         ++stats.insertedStores;
@@ -308,7 +328,7 @@ MemDepUnit::insertNonSpec(const DynInstPtr &inst)
         DPRINTF(MemDepUnit, "Inserting store/atomic PC %s [sn:%lli].\n",
                 inst->pcState(), inst->seqNum);
 
-        depPred.insertStore(inst->pcState().instAddr(), inst->seqNum,
+        depPred->insertStore(inst->pcState().instAddr(), inst->seqNum,
                 inst->threadNumber);
 
         ++stats.insertedStores;
@@ -564,7 +584,7 @@ MemDepUnit::squash(const InstSeqNum &squashed_num, ThreadID tid)
     }
 
     // Tell the dependency predictor to squash as well.
-    depPred.squash(squashed_num, tid);
+    depPred->squash(squashed_num, tid);
 }
 
 void
@@ -575,8 +595,8 @@ MemDepUnit::violation(const DynInstPtr &store_inst,
             " load: %#x, store: %#x\n", violating_load->pcState().instAddr(),
             store_inst->pcState().instAddr());
     // Tell the memory dependence unit of the violation.
-    depPred.violation(store_inst->pcState().instAddr(),
-            violating_load->pcState().instAddr());
+    depPred->violation(store_inst->pcState().instAddr(), store_inst->seqNum,
+            violating_load->pcState().instAddr(), violating_load->seqNum);
 }
 
 void
@@ -585,7 +605,8 @@ MemDepUnit::issue(const DynInstPtr &inst)
     DPRINTF(MemDepUnit, "Issuing instruction PC %#x [sn:%lli].\n",
             inst->pcState().instAddr(), inst->seqNum);
 
-    depPred.issued(inst->pcState().instAddr(), inst->seqNum, inst->isStore());
+    depPred->issued(inst->pcState().instAddr(), inst->seqNum,
+                    inst->isStore());
 }
 
 MemDepUnit::MemDepEntryPtr &
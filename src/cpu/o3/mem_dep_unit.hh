@@ -51,7 +51,7 @@
 #include "cpu/inst_seq.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/limits.hh"
-#include "cpu/o3/store_set.hh"
+#include "cpu/o3/mem_dep_pred.hh"
 #include "debug/MemDepUnit.hh"
 
 namespace gem5
@@ -81,11 +81,8 @@ class InstructionQueue;
  * As memory operations are issued to the IQ, they are also issued to this
  * unit, which then looks up the prediction as to what they are dependent
  * upon.  This unit must be checked prior to a memory operation being able
- * to issue.  Although this is templated, it's somewhat hard to make a generic
- * memory dependence unit.  This one is mostly for store sets; it will be
- * quite limited in what other memory dependence predictions it can also
- * utilize.  Thus this class should be most likely be rewritten for other
- * dependence prediction schemes.
+ * to issue.  The predictor is chosen with the memDepPolicy parameter, from
+ * store sets and the store distance based predictors.
  */
 class MemDepUnit
 {
@@ -241,7 +238,11 @@ class MemDepUnit
      *  this unit what instruction the newly added instruction is dependent
      *  upon.
      */
-    StoreSet depPred;
+    std::unique_ptr<MemDepPredictor> depPred;
+
+    /** Creates the memory dependence predictor the parameters ask for. */
+    static std::unique_ptr<MemDepPredictor>
+    createPredictor(const BaseO3CPUParams &params);
 
     /** Sequence numbers of outstanding load barriers. */
     std::unordered_set<InstSeqNum> loadBarrierSNs;
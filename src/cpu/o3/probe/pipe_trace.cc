@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/probe/pipe_trace.hh"
+
+#include <algorithm>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "cpu/o3/dyn_inst.hh"
+#include "sim/byteswap.hh"
+#include "sim/clocked_object.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+namespace
+{
+
+/** Size of the records buffered before they are written out */
+constexpr size_t BufferSize = 64 * 1024;
+
+const char *const stageNames[PipeTrace::NumStages] = {
+    "fetch", "decode", "rename", "dispatch", "issue", "complete", "retire"
+};
+
+void
+putVarint(std::string &buf, uint64_t value)
+{
+    while (value >= 0x80) {
+        buf.push_back(char(value | 0x80));
+        value >>= 7;
+    }
+    buf.push_back(char(value));
+}
+
+void
+putZigzag(std::string &buf, uint64_t delta)
+{
+    const int64_t value = int64_t(delta);
+    putVarint(buf, (uint64_t(value) << 1) ^ uint64_t(value >> 63));
+}
+
+void
+putString(std::string &buf, const std::string &str)
+{
+    putVarint(buf, str.size());
+    buf.append(str);
+}
+
+template <typename T>
+void
+putLE(std::string &buf, T value)
+{
+    value = htole(value);
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+} // anonymous namespace
+
+PipeTrace::PipeTrace(const PipeTraceParams &params)
+    : ProbeListenerObject(params),
+      outputStream(simout.create(params.file_name, true))
+{
+    auto *clocked = dynamic_cast<ClockedObject *>(params.manager);
+    fatal_if(!clocked, "%s: The probe manager must be a clocked object.",
+             name());
+
+    buffer.append("gem5pip\0", 8);
+    putLE<uint32_t>(buffer, Version);
+    putLE<uint64_t>(buffer, clocked->clockPeriod());
+    putVarint(buffer, NumStages);
+    for (const char *stage_name : stageNames)
+        putString(buffer, stage_name);
+
+    registerExitCallback([this]() { close(); });
+}
+
+PipeTrace::~PipeTrace()
+{
+    close();
+}
+
+void
+PipeTrace::regProbeListeners()
+{
+    typedef ProbeListenerArg<PipeTrace, DynInstConstPtr> DynInstListener;
+    typedef ProbeListenerArgFunc<DynInstConstPtr> DynInstFuncListener;
+
+    listeners.push_back(new DynInstListener(this, "Fetch",
+                &PipeTrace::fetch));
+
+    const std::pair<const char *, Stage> stages[] = {
+        { "Decode", Decode },
+        { "Rename", Rename },
+        { "Dispatch", Dispatch },
+        { "Issue", Issue },
+        { "ToCommit", Complete },
+    };
+    for (const auto &[point, stage_id] : stages) {
+        listeners.push_back(new DynInstFuncListener(getProbeManager(), point,
+                    [this, stage_id=stage_id](const DynInstConstPtr &inst) {
+                        stage(inst, stage_id);
+                    }));
+    }
+
+    listeners.push_back(new DynInstFuncListener(getProbeManager(), "Commit",
+                [this](const DynInstConstPtr &inst) {
+                    retire(inst, false);
+                }));
+    listeners.push_back(new DynInstFuncListener(getProbeManager(), "Squash",
+                [this](const DynInstConstPtr &inst) {
+                    retire(inst, true);
+                }));
+}
+
+void
+PipeTrace::fetch(const DynInstConstPtr &inst)
+{
+    const ThreadID tid = inst->threadNumber;
+    if (inflight.size() <= size_t(tid))
+        inflight.resize(tid + 1);
+
+    Inflight &entry = inflight[tid][inst->seqNum];
+    entry.pc = inst->pcState().instAddr();
+    entry.upc = inst->pcState().microPC();
+    entry.staticInst = inst->staticInst;
+    std::fill(std::begin(entry.ticks), std::end(entry.ticks), MaxTick);
+    entry.ticks[Fetch] = curTick();
+}
+
+void
+PipeTrace::stage(const DynInstConstPtr &inst, Stage stage)
+{
+    const ThreadID tid = inst->threadNumber;
+    if (inflight.size() <= size_t(tid))
+        return;
+
+    // Instructions fetched before the trace started are not recorded.
+    auto it = inflight[tid].find(inst->seqNum);
+    if (it != inflight[tid].end() && it->second.ticks[stage] == MaxTick)
+        it->second.ticks[stage] = curTick();
+}
+
+void
+PipeTrace::retire(const DynInstConstPtr &inst, bool squashed)
+{
+    const ThreadID tid = inst->threadNumber;
+    if (inflight.size() <= size_t(tid))
+        return;
+
+    auto &insts = inflight[tid];
+    auto end = insts.upper_bound(inst->seqNum);
+    for (auto it = insts.begin(); it != end; ++it) {
+        const bool self = it->first == inst->seqNum;
+        if (self)
+            it->second.ticks[Retire] = curTick();
+        // Older instructions still in flight were squashed before they
+        // reached the ROB.
+        write(it->first, tid, it->second, !self || squashed);
+    }
+    insts.erase(insts.begin(), end);
+
+    if (buffer.size() >= BufferSize)
+        flushBuffer();
+}
+
+void
+PipeTrace::write(InstSeqNum seq_num, ThreadID tid, const Inflight &inst,
+                 bool squashed)
+{
+    uint8_t flags = squashed ? Squashed : 0;
+
+    auto [it, inserted] = disasmIds.emplace(
+            std::make_pair(inst.staticInst.get(), inst.pc),
+            disasmIds.size());
+    if (inserted) {
+        flags |= NewDisasm;
+        disasmInsts.push_back(inst.staticInst);
+    }
+    if (tid != lastTid)
+        flags |= NewThread;
+
+    putVarint(buffer, flags);
+    putVarint(buffer, it->second);
+    if (inserted)
+        putString(buffer, inst.staticInst->disassemble(inst.pc));
+
+    putZigzag(buffer, seq_num - lastSeqNum);
+    putZigzag(buffer, inst.pc - lastPC);
+    putZigzag(buffer, inst.ticks[Fetch] - lastFetch);
+    putVarint(buffer, inst.upc);
+    if (flags & NewThread)
+        putVarint(buffer, tid);
+    lastSeqNum = seq_num;
+    lastPC = inst.pc;
+    lastFetch = inst.ticks[Fetch];
+    lastTid = tid;
+
+    uint64_t stages = 0;
+    for (int i = Fetch + 1; i < NumStages; ++i) {
+        if (inst.ticks[i] != MaxTick)
+            stages |= 1 << i;
+    }
+    putVarint(buffer, stages);
+    for (int i = Fetch + 1; i < NumStages; ++i) {
+        if (inst.ticks[i] != MaxTick)
+            putVarint(buffer, inst.ticks[i] - inst.ticks[Fetch]);
+    }
+}
+
+void
+PipeTrace::flushBuffer()
+{
+    outputStream->stream()->write(buffer.data(), buffer.size());
+    buffer.clear();
+}
+
+void
+PipeTrace::close()
+{
+    if (!outputStream)
+        return;
+
+    // Whatever is left was still in flight.
+    for (ThreadID tid = 0; size_t(tid) < inflight.size(); ++tid) {
+        for (const auto &[seq_num, inst] : inflight[tid])
+            write(seq_num, tid, inst, true);
+        inflight[tid].clear();
+    }
+
+    flushBuffer();
+    simout.close(outputStream);
+    outputStream = nullptr;
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file A probe listener which writes a binary pipeline trace of the O3
+ * CPU, meant to replace the O3PipeView debug flag for long traces.
+ */
+
+#ifndef __CPU_O3_PROBE_PIPE_TRACE_HH__
+#define __CPU_O3_PROBE_PIPE_TRACE_HH__
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "cpu/o3/dyn_inst_ptr.hh"
+#include "cpu/static_inst_fwd.hh"
+#include "params/PipeTrace.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+namespace o3
+{
+
+/**
+ * Record when every instruction goes through the stages of the O3
+ * pipeline, listening to its probe points. util/o3-pipetrace.py converts
+ * the trace for the Konata pipeline viewer.
+ *
+ * An instruction is written out when it commits or when it is squashed.
+ * Instructions squashed before they reach the ROB are not reported by a
+ * probe; they are written out as squashed once a younger instruction of
+ * the same thread leaves the pipeline. Disassembly is written the first
+ * time an instruction is seen at a PC, and referenced by ID afterwards.
+ * Name the file with .zst or .lz4 to compress it on a background thread.
+ *
+ * The file starts with the magic "gem5pip\0", a u32 version and the u64
+ * clock period of the CPU in ticks, little endian, followed by the
+ * number of stages and their names as varint counted strings. Records
+ * follow, each made of varints:
+ *  - flags (see Flags) and the disassembly ID, followed by the
+ *    disassembly as a counted string if it is new;
+ *  - the zigzag delta of the sequence number, the PC and the fetch tick
+ *    from the previous record, and the micro PC;
+ *  - the thread ID, if it changed;
+ *  - a bitmap of the stages the instruction went through and, for each
+ *    of them after fetch, the ticks since fetch.
+ */
+class PipeTrace : public ProbeListenerObject
+{
+  public:
+    static constexpr uint32_t Version = 1;
+
+    enum Stage
+    {
+        Fetch,
+        Decode,
+        Rename,
+        Dispatch,
+        Issue,
+        Complete,
+        Retire,
+        NumStages
+    };
+
+    enum Flags : uint8_t
+    {
+        /** The instruction was squashed instead of committed */
+        Squashed = 0x1,
+        /** The disassembly follows the ID */
+        NewDisasm = 0x2,
+        /** The thread ID follows the micro PC */
+        NewThread = 0x4,
+    };
+
+    PipeTrace(const PipeTraceParams &params);
+    ~PipeTrace();
+
+    void regProbeListeners() override;
+
+  private:
+    /** An instruction in the pipeline */
+    struct Inflight
+    {
+        Addr pc;
+        MicroPC upc;
+        StaticInstPtr staticInst;
+        Tick ticks[NumStages];
+    };
+
+    /** Instructions in flight by sequence number, for each thread */
+    std::vector<std::map<InstSeqNum, Inflight>> inflight;
+
+    /** Disassembly IDs by static instruction and PC */
+    std::map<std::pair<const StaticInst *, Addr>, uint64_t> disasmIds;
+    /** Pins the static instructions of disasmIds */
+    std::vector<StaticInstPtr> disasmInsts;
+
+    OutputStream *outputStream;
+    std::string buffer;
+
+    /** Delta encoding state */
+    InstSeqNum lastSeqNum = 0;
+    Addr lastPC = 0;
+    Tick lastFetch = 0;
+    ThreadID lastTid = 0;
+
+    void fetch(const DynInstConstPtr &inst);
+    void stage(const DynInstConstPtr &inst, Stage stage);
+    /** An instruction left the pipeline */
+    void retire(const DynInstConstPtr &inst, bool squashed);
+
+    void write(InstSeqNum seq_num, ThreadID tid, const Inflight &inst,
+               bool squashed);
+    void flushBuffer();
+    void close();
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_PROBE_PIPE_TRACE_HH__
@@ -41,6 +41,7 @@
 
 #include "cpu/o3/rename.hh"
 
+#include <limits>
 #include <list>
 
 #include "cpu/o3/cpu.hh"
@@ -65,6 +66,9 @@ Rename::Rename(CPU *_cpu, const BaseO3CPUParams &params)
       commitToRenameDelay(params.commitToRenameDelay),
       renameWidth(params.renameWidth),
       numThreads(params.numThreads),
+      checkpointInterval(params.renameCheckpointInterval),
+      maxCheckpoints(params.numRenameCheckpoints),
+      valuePred(params.valuePred),
       stats(_cpu)
 {
     if (renameWidth > MaxWidth)
@@ -85,6 +89,7 @@ Rename::Rename(CPU *_cpu, const BaseO3CPUParams &params)
         stalls[tid] = {false, false};
         serializeInst[tid] = nullptr;
         serializeOnNextInst[tid] = false;
+        renamesSinceCheckpoint[tid] = 0;
     }
 }
 
@@ -140,6 +145,8 @@ Rename::RenameStats::RenameStats(statistics::Group *parent)
                "Number of HB maps that are committed"),
       ADD_STAT(undoneMaps, statistics::units::Count::get(),
                "Number of HB maps that are undone due to squashing"),
+      ADD_STAT(checkpointRestores, statistics::units::Count::get(),
+               "Number of squashes that restored a rename map checkpoint"),
       ADD_STAT(serializing, statistics::units::Count::get(),
                "count of serializing insts renamed"),
       ADD_STAT(tempSerializing, statistics::units::Count::get(),
@@ -173,6 +180,7 @@ Rename::RenameStats::RenameStats(statistics::Group *parent)
 
     committedMaps.prereq(committedMaps);
     undoneMaps.prereq(undoneMaps);
+    checkpointRestores.prereq(checkpointRestores);
     serializing.flags(statistics::total);
     tempSerializing.flags(statistics::total);
     skidInsts.flags(statistics::total);
@@ -245,6 +253,9 @@ Rename::clearStates(ThreadID tid)
     storesInProgress[tid] = 0;
 
     serializeOnNextInst[tid] = false;
+
+    releaseYoungerCheckpoints(0, tid);
+    renamesSinceCheckpoint[tid] = 0;
 }
 
 void
@@ -275,6 +286,9 @@ Rename::resetStage()
         storesInProgress[tid] = 0;
 
         serializeOnNextInst[tid] = false;
+
+        releaseYoungerCheckpoints(0, tid);
+        renamesSinceCheckpoint[tid] = 0;
     }
 }
 
@@ -714,6 +728,14 @@ Rename::renameInsts(ThreadID tid)
 
         renameDestRegs(inst, inst->threadNumber);
 
+        if (valuePred)
+            predictValue(inst, tid);
+
+        if (checkpointInterval && inst->isControl() &&
+            renamesSinceCheckpoint[tid] >= checkpointInterval) {
+            takeCheckpoint(inst->seqNum, tid);
+        }
+
         if (inst->isAtomic() || inst->isStore()) {
             storesInProgress[tid]++;
         } else if (inst->isLoad()) {
@@ -911,11 +933,116 @@ Rename::unblock(ThreadID tid)
     return false;
 }
 
+void
+Rename::predictValue(const DynInstPtr &inst, ThreadID tid)
+{
+    if (inst->isControl()) {
+        valuePred->recordBranch(tid, inst->seqNum, inst->readPredTaken());
+        inst->valuePredRecorded(true);
+        return;
+    }
+
+    // Only loads of a single renamed integer register are predicted.
+    if (!inst->isLoad() || inst->isAtomic() || inst->isNonSpeculative() ||
+        inst->numDestRegs() != 1 ||
+        inst->destRegIdx(0).classValue() != IntRegClass ||
+        inst->renamedDestIdx(0) == inst->prevDestIdx(0)) {
+        return;
+    }
+
+    // Tell apart the microops of a macroop.
+    const PCStateBase &pc = inst->pcState();
+    Addr key = pc.instAddr() ^ ((Addr)pc.microPC() << 48);
+
+    RegVal value;
+    bool confident = valuePred->predict(tid, inst->seqNum, key, value);
+    inst->valuePredRecorded(true);
+    if (!confident)
+        return;
+
+    PhysRegIdPtr dest = inst->renamedDestIdx(0);
+    cpu->setReg(dest, value, tid);
+    scoreboard->setReg(dest);
+    inst->setPredValue(value);
+
+    DPRINTF(Rename, "[tid:%i] [sn:%llu] Predicted value %#x for phys "
+            "reg %i.\n", tid, inst->seqNum, value, dest->index());
+}
+
+void
+Rename::takeCheckpoint(InstSeqNum seq_num, ThreadID tid)
+{
+    if (checkpoints[tid].size() >= maxCheckpoints)
+        return;
+
+    if (spareCheckpoints.empty()) {
+        checkpoints[tid].push_back({seq_num, *renameMap[tid]});
+    } else {
+        checkpoints[tid].push_back(std::move(spareCheckpoints.back()));
+        spareCheckpoints.pop_back();
+        checkpoints[tid].back().instSeqNum = seq_num;
+        checkpoints[tid].back().map = *renameMap[tid];
+    }
+    renamesSinceCheckpoint[tid] = 0;
+
+    DPRINTF(Rename, "[tid:%i] [sn:%llu] Checkpointed the rename map "
+            "(%i checkpoints).\n", tid, seq_num, checkpoints[tid].size());
+}
+
+void
+Rename::releaseYoungerCheckpoints(InstSeqNum seq_num, ThreadID tid)
+{
+    auto &cps = checkpoints[tid];
+    while (!cps.empty() && cps.back().instSeqNum > seq_num) {
+        spareCheckpoints.push_back(std::move(cps.back()));
+        cps.pop_back();
+    }
+}
+
+void
+Rename::releaseOlderCheckpoints(InstSeqNum seq_num, ThreadID tid)
+{
+    auto &cps = checkpoints[tid];
+    while (!cps.empty() && cps.front().instSeqNum <= seq_num) {
+        spareCheckpoints.push_back(std::move(cps.front()));
+        cps.pop_front();
+    }
+}
+
 void
 Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
 {
     auto hb_it = historyBuffer[tid].begin();
 
+    if (valuePred) {
+        // A mispredicted branch stays in the pipeline, but its direction
+        // in the history of the value predictor was the predicted one.
+        const auto &commit_info = fromCommit->commitInfo[tid];
+        if (commit_info.mispredictInst &&
+            commit_info.mispredictInst->seqNum == squashed_seq_num) {
+            valuePred->squash(tid, squashed_seq_num,
+                              commit_info.branchTaken);
+        } else {
+            valuePred->squash(tid, squashed_seq_num);
+        }
+    }
+
+    // Restore the oldest checkpoint which is not older than the squashing
+    // instruction. Only the renames done up to that checkpoint have to be
+    // undone then.
+    InstSeqNum restored_seq_num = std::numeric_limits<InstSeqNum>::max();
+    for (auto &cp : checkpoints[tid]) {
+        if (cp.instSeqNum >= squashed_seq_num) {
+            DPRINTF(Rename, "[tid:%i] Restoring the rename map checkpoint "
+                    "of [sn:%llu].\n", tid, cp.instSeqNum);
+            *renameMap[tid] = cp.map;
+            restored_seq_num = cp.instSeqNum;
+            ++stats.checkpointRestores;
+            break;
+        }
+    }
+    releaseYoungerCheckpoints(squashed_seq_num, tid);
+
     // After a syscall squashes everything, the history buffer may be empty
     // but the ROB may still be squashing instructions.
     // Go through the most recent instructions, undoing the mappings
@@ -937,8 +1064,12 @@ Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
         // don't want to put these on the free list.
         if (hb_it->newPhysReg != hb_it->prevPhysReg) {
             // Tell the rename map to set the architected register to the
-            // previous physical register that it was renamed to.
-            renameMap[tid]->setEntry(hb_it->archReg, hb_it->prevPhysReg);
+            // previous physical register that it was renamed to, unless
+            // the restored checkpoint predates the rename already.
+            if (hb_it->instSeqNum <= restored_seq_num) {
+                renameMap[tid]->setEntry(hb_it->archReg,
+                                         hb_it->prevPhysReg);
+            }
 
             // The phys regs can still be owned by squashing but
             // executing instructions in IEW at this moment. To avoid
@@ -950,8 +1081,9 @@ Rename::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
         // Notify potential listeners that the register mapping needs to be
         // removed because the instruction it was mapped to got squashed. Note
         // that this is done before hb_it is incremented.
-        ppSquashInRename->notify(std::make_pair(hb_it->instSeqNum,
-                                                hb_it->newPhysReg));
+        ppSquashInRename->notifyWith([&]() {
+            return std::make_pair(hb_it->instSeqNum, hb_it->newPhysReg);
+        });
 
         historyBuffer[tid].erase(hb_it++);
 
@@ -1006,6 +1138,9 @@ Rename::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
 
         historyBuffer[tid].erase(hb_it--);
     }
+
+    // A squash can't go back past a committed instruction.
+    releaseOlderCheckpoints(inst_seq_num, tid);
 }
 
 void
@@ -1116,6 +1251,7 @@ Rename::renameDestRegs(const DynInstPtr &inst, ThreadID tid)
                                rename_result.second);
 
         historyBuffer[tid].push_front(hb_entry);
+        ++renamesSinceCheckpoint[tid];
 
         DPRINTF(Rename, "[tid:%i] [sn:%llu] "
                 "Adding instruction to history buffer (size=%i).\n",
@@ -42,8 +42,10 @@
 #ifndef __CPU_O3_RENAME_HH__
 #define __CPU_O3_RENAME_HH__
 
+#include <deque>
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "cpu/o3/comm.hh"
@@ -52,6 +54,8 @@
 #include "cpu/o3/free_list.hh"
 #include "cpu/o3/iew.hh"
 #include "cpu/o3/limits.hh"
+#include "cpu/o3/rename_map.hh"
+#include "cpu/pred/value_pred.hh"
 #include "cpu/timebuf.hh"
 #include "sim/probe/probe.hh"
 
@@ -254,6 +258,13 @@ class Rename
     /** Renames the destination registers of an instruction. */
     void renameDestRegs(const DynInstPtr &inst, ThreadID tid);
 
+    /**
+     * Passes a renamed instruction to the value predictor, and writes
+     * the predicted value of a load to its destination register when the
+     * predictor is confident, which readies the dependents right away.
+     */
+    void predictValue(const DynInstPtr &inst, ThreadID tid);
+
     /** Calculates the number of free ROB entries for a specific thread. */
     int calcFreeROBEntries(ThreadID tid);
 
@@ -320,6 +331,46 @@ class Rename
      */
     std::list<RenameHistory> historyBuffer[MaxThreads];
 
+    /**
+     * Copy of the rename map taken after renaming a branch. A squash
+     * back to the branch or an older instruction restores it, and only
+     * undoes the history up to the branch.
+     */
+    struct RenameCheckpoint
+    {
+        /** The sequence number of the branch. */
+        InstSeqNum instSeqNum;
+        /** The rename map once the branch was renamed. */
+        UnifiedRenameMap map;
+    };
+
+    /** Per-thread rename map checkpoints, oldest first. */
+    std::deque<RenameCheckpoint> checkpoints[MaxThreads];
+
+    /** Released checkpoints, kept to reuse their storage. */
+    std::vector<RenameCheckpoint> spareCheckpoints;
+
+    /** Number of renames since the last checkpoint of each thread. */
+    unsigned renamesSinceCheckpoint[MaxThreads];
+
+    /** Minimum number of renames between checkpoints, 0 if disabled. */
+    const unsigned checkpointInterval;
+
+    /** Maximum number of checkpoints per thread. */
+    const unsigned maxCheckpoints;
+
+    /** Value predictor, or nullptr if there is none. */
+    value_prediction::ValuePredictor *valuePred;
+
+    /** Checkpoint the rename map after renaming a branch. */
+    void takeCheckpoint(InstSeqNum seq_num, ThreadID tid);
+
+    /** Release the checkpoints of a thread younger than an instruction. */
+    void releaseYoungerCheckpoints(InstSeqNum seq_num, ThreadID tid);
+
+    /** Release the checkpoints of a thread up to an instruction. */
+    void releaseOlderCheckpoints(InstSeqNum seq_num, ThreadID tid);
+
     /** Pointer to CPU. */
     CPU *cpu;
 
@@ -530,6 +581,8 @@ class Rename
         /** Stat for total number of mappings that were undone due to a
          *  squash. */
         statistics::Scalar undoneMaps;
+        /** Number of squashes which restored a rename map checkpoint. */
+        statistics::Scalar checkpointRestores;
         /** Number of serialize instructions handled. */
         statistics::Scalar serializing;
         /** Number of instructions marked as temporarily serializing. */
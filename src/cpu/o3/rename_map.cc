@@ -117,7 +117,7 @@ UnifiedRenameMap::init(const BaseISA::RegClasses &regClasses,
 }
 
 bool
-UnifiedRenameMap::canRename(DynInstPtr inst) const
+UnifiedRenameMap::canRename(const DynInstPtr &inst) const
 {
     for (int i = 0; i < renameMaps.size(); i++) {
         if (inst->numDestRegs((RegClassType)i) >
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/store_distance.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/StoreSet.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+StoreDistanceBase::StoreDistanceBase(uint64_t clear_period, int table_size,
+                                     int history_size)
+    : tableSize(table_size), stores(history_size),
+      clearPeriod(clear_period)
+{
+    if (!isPowerOf2(tableSize)) {
+        fatal("Invalid store distance table size!\n");
+    }
+}
+
+void
+StoreDistanceBase::checkClear()
+{
+    memOpsPred++;
+    if (memOpsPred > clearPeriod) {
+        DPRINTF(StoreSet, "Aging predictor state because %d ld/st executed\n",
+                clearPeriod);
+        memOpsPred = 0;
+        age();
+    }
+}
+
+void
+StoreDistanceBase::violation(Addr store_PC, InstSeqNum store_seq_num,
+                             Addr load_PC, InstSeqNum load_seq_num)
+{
+    auto seq_less = [](InstSeqNum entry, InstSeqNum seq_num)
+    { return entry < seq_num; };
+
+    auto store_it = std::lower_bound(stores.begin(), stores.end(),
+                                     store_seq_num, seq_less);
+    if (store_it == stores.end() || *store_it != store_seq_num) {
+        DPRINTF(StoreSet, "Store [sn:%lli] %#x is too old to record the "
+                "violation of load %#x\n", store_seq_num, store_PC, load_PC);
+        return;
+    }
+
+    auto load_it = std::lower_bound(store_it, stores.end(), load_seq_num,
+                                    seq_less);
+    unsigned distance = load_it - store_it;
+    assert(distance > 0);
+
+    DPRINTF(StoreSet, "Load %#x depends on store %#x at distance %u\n",
+            load_PC, store_PC, distance);
+
+    if (distance <= maxDistance)
+        train(calcIndex(load_PC), distance);
+}
+
+void
+StoreDistanceBase::insertStore(Addr store_PC, InstSeqNum store_seq_num,
+                               ThreadID tid)
+{
+    checkClear();
+
+    assert(stores.empty() || stores.back() < store_seq_num);
+    if (stores.full())
+        stores.pop_front();
+    stores.push_back(store_seq_num);
+}
+
+void
+StoreDistanceBase::checkInst(Addr PC, InstSeqNum seq_num,
+                             std::vector<InstSeqNum> &producers)
+{
+    checkClear();
+
+    // The instruction is the youngest one, so the store at distance d is
+    // the d-th one from the back of the ring.
+    uint64_t distances = predict(calcIndex(PC));
+    for (unsigned distance = 1; distances && distance <= stores.size();
+            distance++, distances >>= 1) {
+        if (distances & 1) {
+            InstSeqNum producer = stores[stores.tail() + 1 - distance];
+            DPRINTF(StoreSet, "Inst %#x depends on [sn:%lli] at distance "
+                    "%u\n", PC, producer, distance);
+            producers.push_back(producer);
+        }
+    }
+}
+
+void
+StoreDistanceBase::squash(InstSeqNum squashed_num, ThreadID tid)
+{
+    DPRINTF(StoreSet, "StoreDistance: Squashing until inum %i\n",
+            squashed_num);
+
+    while (!stores.empty() && stores.back() > squashed_num)
+        stores.pop_back();
+}
+
+void
+StoreDistanceBase::clear()
+{
+    stores.flush();
+    clearTable();
+}
+
+void
+StoreDistanceBase::dump()
+{
+    cprintf("stores.size(): %i\n", stores.size());
+    int num = 0;
+    for (auto seq_num : stores) {
+        cprintf("%i: [sn:%lli]\n", num, seq_num);
+        num++;
+    }
+}
+
+StoreDistance::StoreDistance(uint64_t clear_period, int table_size,
+                             int history_size, unsigned counter_bits)
+    : StoreDistanceBase(clear_period, table_size, history_size),
+      table(table_size), counterMax((1 << counter_bits) - 1)
+{
+    if (counter_bits < 1 || counter_bits > 8) {
+        fatal("Invalid store distance counter size!\n");
+    }
+}
+
+void
+StoreDistance::train(int index, unsigned distance)
+{
+    Entry &entry = table[index];
+    if (!entry.counter || distance < entry.distance)
+        entry.distance = distance;
+    entry.counter = counterMax;
+}
+
+uint64_t
+StoreDistance::predict(int index) const
+{
+    const Entry &entry = table[index];
+    return entry.counter ? 1ULL << (entry.distance - 1) : 0;
+}
+
+void
+StoreDistance::age()
+{
+    for (auto &entry : table) {
+        if (entry.counter)
+            entry.counter--;
+    }
+}
+
+void
+StoreDistance::clearTable()
+{
+    std::fill(table.begin(), table.end(), Entry());
+}
+
+StoreVector::StoreVector(uint64_t clear_period, int table_size,
+                         int history_size, unsigned vector_size)
+    : StoreDistanceBase(clear_period, table_size, history_size),
+      table(table_size, 0), vectorSize(vector_size)
+{
+    if (vectorSize < 1 || vectorSize > maxDistance) {
+        fatal("Invalid store vector size!\n");
+    }
+}
+
+void
+StoreVector::train(int index, unsigned distance)
+{
+    if (distance <= vectorSize)
+        table[index] |= 1ULL << (distance - 1);
+}
+
+uint64_t
+StoreVector::predict(int index) const
+{
+    return table[index];
+}
+
+void
+StoreVector::age()
+{
+    clearTable();
+}
+
+void
+StoreVector::clearTable()
+{
+    std::fill(table.begin(), table.end(), 0);
+}
+
+} // namespace o3
+} // namespace gem5
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_STORE_DISTANCE_HH__
+#define __CPU_O3_STORE_DISTANCE_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/circular_queue.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "cpu/o3/mem_dep_pred.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Base of the memory dependence predictors that name the stores a load
+ * depends upon by their store distance, the number of stores between them
+ * plus one: the youngest store older than the load is at distance 1.  The
+ * recent stores are kept in a ring in program order, which turns a
+ * distance into a sequence number with a single index.  The predictions
+ * are kept in a table indexed by the load PC, as bit masks with bit d - 1
+ * standing for distance d.
+ */
+class StoreDistanceBase : public MemDepPredictor
+{
+  public:
+    /** The largest distance that can be predicted. */
+    static constexpr unsigned maxDistance = 64;
+
+    /**
+     * @param clear_period Number of loads and stores between two agings
+     *        of the table.
+     * @param table_size Number of entries of the table, a power of 2.
+     * @param history_size Number of recent stores remembered.
+     */
+    StoreDistanceBase(uint64_t clear_period, int table_size,
+                      int history_size);
+
+    void violation(Addr store_PC, InstSeqNum store_seq_num,
+                   Addr load_PC, InstSeqNum load_seq_num) override;
+
+    void insertStore(Addr store_PC, InstSeqNum store_seq_num,
+                     ThreadID tid) override;
+
+    void checkInst(Addr PC, InstSeqNum seq_num,
+                   std::vector<InstSeqNum> &producers) override;
+
+    void squash(InstSeqNum squashed_num, ThreadID tid) override;
+
+    void clear() override;
+
+    void dump() override;
+
+  protected:
+    /** Records that the load with the given table index depended on the
+     * store at the given distance. */
+    virtual void train(int index, unsigned distance) = 0;
+
+    /** @return The mask of the distances predicted for a table index. */
+    virtual uint64_t predict(int index) const = 0;
+
+    /** Ages the whole table, so old dependences don't live forever. */
+    virtual void age() = 0;
+
+    /** Forgets everything in the table. */
+    virtual void clearTable() = 0;
+
+    /** Number of entries of the table. */
+    const int tableSize;
+
+  private:
+    /** Calculates the index into the table based on the PC. */
+    int calcIndex(Addr PC) const { return (PC >> 2) & (tableSize - 1); }
+
+    /** Ages the table once every clearPeriod memory instructions. */
+    void checkClear();
+
+    /** Sequence numbers of the recent stores, in program order. */
+    CircularQueue<InstSeqNum> stores;
+
+    /** Number of memory operations between two agings of the table. */
+    const uint64_t clearPeriod;
+
+    /** Number of memory operations seen since the table was aged. */
+    uint64_t memOpsPred = 0;
+};
+
+/**
+ * Predicts a single store distance per load, in the spirit of the NoSQ
+ * store-load pairs of Sha, Martin and Roth, with a saturating confidence
+ * counter per entry.  A violation sets the distance and saturates the
+ * counter, and the counters are decremented every clear period, so a
+ * dependence is predicted until it has not been seen for a while.  When
+ * a load violates with several stores, the nearest one is kept.
+ */
+class StoreDistance : public StoreDistanceBase
+{
+  public:
+    StoreDistance(uint64_t clear_period, int table_size, int history_size,
+                  unsigned counter_bits);
+
+  protected:
+    void train(int index, unsigned distance) override;
+    uint64_t predict(int index) const override;
+    void age() override;
+    void clearTable() override;
+
+  private:
+    struct Entry
+    {
+        uint8_t distance = 0;
+        uint8_t counter = 0;
+    };
+
+    std::vector<Entry> table;
+
+    /** The saturated value of the counters. */
+    const uint8_t counterMax;
+};
+
+/**
+ * The Store Vectors predictor of Subramaniam and Loh, which makes a load
+ * wait for every store at one of the distances it was seen to depend on.
+ * Only the distances up to the vector size are tracked, and the table is
+ * cleared every clear period.
+ */
+class StoreVector : public StoreDistanceBase
+{
+  public:
+    StoreVector(uint64_t clear_period, int table_size, int history_size,
+                unsigned vector_size);
+
+  protected:
+    void train(int index, unsigned distance) override;
+    uint64_t predict(int index) const override;
+    void age() override;
+    void clearTable() override;
+
+  private:
+    std::vector<uint64_t> table;
+
+    /** Number of distances a vector tracks. */
+    const unsigned vectorSize;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_STORE_DISTANCE_HH__
@@ -28,6 +28,8 @@
 
 #include "cpu/o3/store_set.hh"
 
+#include <algorithm>
+
 #include "base/intmath.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -39,8 +41,10 @@ namespace gem5
 namespace o3
 {
 
-StoreSet::StoreSet(uint64_t clear_period, int _SSIT_size, int _LFST_size)
-    : clearPeriod(clear_period), SSITSize(_SSIT_size), LFSTSize(_LFST_size)
+StoreSet::StoreSet(uint64_t clear_period, int _SSIT_size, int _LFST_size,
+                   int store_list_size)
+    : storeList(store_list_size), clearPeriod(clear_period),
+      SSITSize(_SSIT_size), LFSTSize(_LFST_size)
 {
     DPRINTF(StoreSet, "StoreSet: Creating store set object.\n");
     DPRINTF(StoreSet, "StoreSet: SSIT size: %i, LFST size: %i.\n",
@@ -81,40 +85,6 @@ StoreSet::~StoreSet()
 {
 }
 
-void
-StoreSet::init(uint64_t clear_period, int _SSIT_size, int _LFST_size)
-{
-    SSITSize = _SSIT_size;
-    LFSTSize = _LFST_size;
-    clearPeriod = clear_period;
-
-    DPRINTF(StoreSet, "StoreSet: Creating store set object.\n");
-    DPRINTF(StoreSet, "StoreSet: SSIT size: %i, LFST size: %i.\n",
-            SSITSize, LFSTSize);
-
-    SSIT.resize(SSITSize);
-
-    validSSIT.resize(SSITSize);
-
-    for (int i = 0; i < SSITSize; ++i)
-        validSSIT[i] = false;
-
-    LFST.resize(LFSTSize);
-
-    validLFST.resize(LFSTSize);
-
-    for (int i = 0; i < LFSTSize; ++i) {
-        validLFST[i] = false;
-        LFST[i] = 0;
-    }
-
-    indexMask = SSITSize - 1;
-
-    offsetBits = 2;
-
-    memOpsPred = 0;
-}
-
 
 void
 StoreSet::violation(Addr store_PC, Addr load_PC)
@@ -232,7 +202,12 @@ StoreSet::insertStore(Addr store_PC, InstSeqNum store_seq_num, ThreadID tid)
 
         validLFST[store_SSID] = 1;
 
-        storeList[store_seq_num] = store_SSID;
+        assert(storeList.empty() || storeList.back().seqNum < store_seq_num);
+        // Forgetting the oldest store only leaves a stale LFST entry,
+        // which the MemDepUnit ignores once that store is gone.
+        if (storeList.full())
+            storeList.pop_front();
+        storeList.push_back({store_seq_num, (SSID)store_SSID, false});
 
         DPRINTF(StoreSet, "Store %#x updated the LFST, SSID: %i\n",
                 store_PC, store_SSID);
@@ -288,10 +263,16 @@ StoreSet::issued(Addr issued_PC, InstSeqNum issued_seq_num, bool is_store)
 
     assert(index < SSITSize);
 
-    SeqNumMapIt store_list_it = storeList.find(issued_seq_num);
+    StoreListIt store_list_it = std::lower_bound(
+        storeList.begin(), storeList.end(), issued_seq_num,
+        [](const StoreListEntry &entry, InstSeqNum seq_num)
+        { return entry.seqNum < seq_num; });
 
-    if (store_list_it != storeList.end()) {
-        storeList.erase(store_list_it);
+    if (store_list_it != storeList.end() &&
+            store_list_it->seqNum == issued_seq_num) {
+        store_list_it->issued = true;
+        while (!storeList.empty() && storeList.front().issued)
+            storeList.pop_front();
     }
 
     // Make sure the SSIT still has a valid entry for the issued store.
@@ -317,27 +298,16 @@ StoreSet::squash(InstSeqNum squashed_num, ThreadID tid)
     DPRINTF(StoreSet, "StoreSet: Squashing until inum %i\n",
             squashed_num);
 
-    int idx;
-    SeqNumMapIt store_list_it = storeList.begin();
-
     //@todo:Fix to only delete from correct thread
-    while (!storeList.empty()) {
-        idx = (*store_list_it).second;
-
-        if ((*store_list_it).first <= squashed_num) {
-            break;
-        }
+    while (!storeList.empty() && storeList.back().seqNum > squashed_num) {
+        SSID idx = storeList.back().ssid;
 
-        bool younger = LFST[idx] > squashed_num;
-
-        if (validLFST[idx] && younger) {
+        if (validLFST[idx] && LFST[idx] > squashed_num) {
             DPRINTF(StoreSet, "Squashed [sn:%lli]\n", LFST[idx]);
             validLFST[idx] = false;
-
-            storeList.erase(store_list_it++);
-        } else if (!validLFST[idx] && younger) {
-            storeList.erase(store_list_it++);
         }
+
+        storeList.pop_back();
     }
 }
 
@@ -352,22 +322,19 @@ StoreSet::clear()
         validLFST[i] = false;
     }
 
-    storeList.clear();
+    storeList.flush();
 }
 
 void
 StoreSet::dump()
 {
     cprintf("storeList.size(): %i\n", storeList.size());
-    SeqNumMapIt store_list_it = storeList.begin();
-
     int num = 0;
 
-    while (store_list_it != storeList.end()) {
-        cprintf("%i: [sn:%lli] SSID:%i\n",
-                num, (*store_list_it).first, (*store_list_it).second);
+    for (const auto &entry : storeList) {
+        cprintf("%i: [sn:%lli] SSID:%i%s\n", num, entry.seqNum, entry.ssid,
+                entry.issued ? " issued" : "");
         num++;
-        store_list_it++;
     }
 }
 
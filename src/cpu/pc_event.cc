@@ -64,6 +64,9 @@ PCEventQueue::remove(PCEvent *event)
         }
     }
 
+    if (removed > 0)
+        rebuildFilter();
+
     return removed > 0;
 }
 
@@ -72,6 +75,7 @@ PCEventQueue::schedule(PCEvent *event)
 {
     pcMap.push_back(event);
     std::sort(pcMap.begin(), pcMap.end(), MapCompare());
+    pageFilter.set(filterIndex(event->pc()));
 
     DPRINTF(PCEvent, "PC based event scheduled for %#x: %s\n",
             event->pc(), event->descr());
@@ -79,6 +83,14 @@ PCEventQueue::schedule(PCEvent *event)
     return true;
 }
 
+void
+PCEventQueue::rebuildFilter()
+{
+    pageFilter.reset();
+    for (const auto *event : pcMap)
+        pageFilter.set(filterIndex(event->pc()));
+}
+
 bool
 PCEventQueue::doService(Addr pc, ThreadContext *tc)
 {
@@ -29,6 +29,7 @@
 #ifndef __PC_EVENT_HH__
 #define __PC_EVENT_HH__
 
+#include <bitset>
 #include <vector>
 
 #include "base/logging.hh"
@@ -106,6 +107,24 @@ class PCEventQueue : public PCEventScope
   protected:
     Map pcMap;
 
+    /**
+     * The pages which may hold an event, hashed into a fixed number of
+     * bits. Most instructions are on pages without events, which this
+     * tells with a single bit test instead of a search of pcMap.
+     */
+    static constexpr int FilterPageShift = 12;
+    static constexpr size_t FilterBits = 4096;
+    std::bitset<FilterBits> pageFilter;
+
+    static size_t
+    filterIndex(Addr pc)
+    {
+        return (pc >> FilterPageShift) % FilterBits;
+    }
+
+    /** Recompute pageFilter from the events left after removing some. */
+    void rebuildFilter();
+
     bool doService(Addr pc, ThreadContext *tc);
 
   public:
@@ -116,7 +135,7 @@ class PCEventQueue : public PCEventScope
     bool schedule(PCEvent *event) override;
     bool service(Addr pc, ThreadContext *tc)
     {
-        if (pcMap.empty())
+        if (!pageFilter.test(filterIndex(pc)))
             return false;
 
         return doService(pc, tc);
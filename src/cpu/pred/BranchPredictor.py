@@ -39,6 +39,7 @@
 
 from m5.objects.ClockedObject import ClockedObject
 from m5.objects.IndexingPolicies import *
+from m5.objects.Probe import ProbeListenerObject
 from m5.objects.ReplacementPolicies import *
 from m5.params import *
 from m5.proxy import *
@@ -204,6 +205,45 @@ class BranchPredictor(SimObject):
     )
 
 
+class BranchTraceRecorder(ProbeListenerObject):
+    """
+    Records the branches committed by the core it is attached to, so that
+    they can be replayed through other branch predictors by a
+    BranchTraceEvaluator.
+    """
+
+    type = "BranchTraceRecorder"
+    cxx_class = "gem5::branch_prediction::BranchTraceRecorder"
+    cxx_header = "cpu/pred/branch_trace_recorder.hh"
+
+    bpred = Param.BranchPredictor(
+        Parent.any, "Branch predictor of the traced core"
+    )
+    trace_file = Param.String(
+        "",
+        "Trace file in the output directory, defaults to the name of the "
+        "recorder with a .btrace suffix",
+    )
+
+
+class BranchTraceEvaluator(SimObject):
+    """
+    Replays a branch trace through a branch predictor and reports its
+    accuracy without simulating a core. Evaluators can be placed on
+    separate event queues to replay several traces in parallel.
+    """
+
+    type = "BranchTraceEvaluator"
+    cxx_class = "gem5::branch_prediction::BranchTraceEvaluator"
+    cxx_header = "cpu/pred/branch_trace_evaluator.hh"
+
+    bpred = Param.BranchPredictor("Branch predictor to evaluate")
+    trace_file = Param.String("Branch trace to replay")
+    max_branches = Param.UInt64(
+        0, "Number of branches to replay, 0 to replay the whole trace"
+    )
+
+
 class LocalBP(BranchPredictor):
     type = "LocalBP"
     cxx_class = "gem5::branch_prediction::LocalBP"
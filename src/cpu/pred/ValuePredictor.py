@@ -0,0 +1,91 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+
+
+class ValuePredictor(SimObject):
+    type = "ValuePredictor"
+    cxx_class = "gem5::value_prediction::ValuePredictor"
+    cxx_header = "cpu/pred/value_pred.hh"
+    abstract = True
+
+    numThreads = Param.Unsigned(Parent.numThreads, "Number of threads")
+    instShiftAmt = Param.Unsigned(2, "Number of bits to shift instructions by")
+    confidenceBits = Param.Unsigned(
+        3,
+        "Number of bits of the confidence counters, predictions are used "
+        "once they saturate",
+    )
+
+
+class LastValuePredictor(ValuePredictor):
+    type = "LastValuePredictor"
+    cxx_class = "gem5::value_prediction::LastValuePredictor"
+    cxx_header = "cpu/pred/last_value.hh"
+
+    tableSize = Param.Unsigned(4096, "Number of entries of the table")
+
+
+class StrideValuePredictor(ValuePredictor):
+    type = "StrideValuePredictor"
+    cxx_class = "gem5::value_prediction::StrideValuePredictor"
+    cxx_header = "cpu/pred/stride_value.hh"
+
+    tableSize = Param.Unsigned(4096, "Number of entries of the table")
+
+
+class VTAGEValuePredictor(ValuePredictor):
+    type = "VTAGEValuePredictor"
+    cxx_class = "gem5::value_prediction::VTAGEValuePredictor"
+    cxx_header = "cpu/pred/vtage.hh"
+
+    baseTableSize = Param.Unsigned(
+        4096, "Number of entries of the untagged last value table"
+    )
+    numTables = Param.Unsigned(6, "Number of tagged tables")
+    logTableSize = Param.Unsigned(
+        10, "Log2 of the number of entries of the tagged tables"
+    )
+    tagBits = Param.Unsigned(12, "Number of tag bits of the tagged tables")
+    minHist = Param.Unsigned(2, "Global history length of the first table")
+    maxHist = Param.Unsigned(64, "Global history length of the last table")
+
+
+class EVESValuePredictor(ValuePredictor):
+    type = "EVESValuePredictor"
+    cxx_class = "gem5::value_prediction::EVESValuePredictor"
+    cxx_header = "cpu/pred/eves.hh"
+
+    vtage = Param.VTAGEValuePredictor(
+        VTAGEValuePredictor(), "Context based component"
+    )
+    stride = Param.StrideValuePredictor(
+        StrideValuePredictor(), "Computational component"
+    )
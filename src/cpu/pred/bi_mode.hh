@@ -45,6 +45,7 @@
 #ifndef __CPU_PRED_BI_MODE_PRED_HH__
 #define __CPU_PRED_BI_MODE_PRED_HH__
 
+#include "base/pool_alloc.hh"
 #include "base/sat_counter.hh"
 #include "cpu/pred/bpred_unit.hh"
 #include "params/BiModeBP.hh"
@@ -85,7 +86,7 @@ class BiModeBP : public BPredUnit
     void updateGlobalHistReg(ThreadID tid, bool taken);
     void uncondBranch(ThreadID tid, Addr pc, void * &bp_history);
 
-    struct BPHistory
+    struct BPHistory : public PoolAllocated
     {
         unsigned globalHistoryReg;
         // was the taken array's prediction used?
@@ -83,6 +83,8 @@ BPredUnit::regProbePoints()
 {
     ppBranches = pmuProbePoint("Branches");
     ppMisses = pmuProbePoint("Misses");
+    ppCommittedBranches.reset(new ProbePointArg<BranchTraceRecord>(
+        getProbeManager(), "CommittedBranches"));
 }
 
 void
@@ -132,6 +134,12 @@ BPredUnit::predict(const StaticInstPtr &inst, const InstSeqNum &seqNum,
     BranchType brType = getBranchType(inst);
     hist = new PredictorHistory(tid, seqNum, pc.instAddr(), inst);
 
+    if (ppCommittedBranches->hasListeners()) {
+        std::unique_ptr<PCStateBase> fall_through(pc.clone());
+        inst->advancePC(*fall_through);
+        hist->fallThrough = fall_through->instAddr();
+    }
+
     stats.lookups[tid][brType]++;
     ppBranches->notify(1);
 
@@ -367,6 +375,16 @@ BPredUnit::commitBranch(ThreadID tid, PredictorHistory* &hist)
                 hist->predTaken, hist->actuallyTaken,
                 hist->target->instAddr());
 
+    if (ppCommittedBranches->hasListeners()) {
+        BranchTraceRecord rec;
+        rec.pc = hist->pc;
+        rec.target = hist->target->instAddr();
+        rec.fallThrough = hist->fallThrough;
+        rec.type = hist->type;
+        rec.taken = hist->actuallyTaken;
+        ppCommittedBranches->notify(rec);
+    }
+
     // Update the branch predictor with the correct results.
     update(tid, hist->pc,
                 hist->actuallyTaken,
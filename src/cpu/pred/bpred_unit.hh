@@ -44,9 +44,11 @@
 
 #include <deque>
 
+#include "base/pool_alloc.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/pred/branch_trace.hh"
 #include "cpu/pred/branch_type.hh"
 #include "cpu/pred/btb.hh"
 #include "cpu/pred/indirect.hh"
@@ -187,7 +189,7 @@ class BPredUnit : public SimObject
                    void * &bp_history, bool squashed,
                    const StaticInstPtr &inst, Addr target) = 0;
 
-
+  public:
     /**
      * Looks up a given PC in the BTB to see if a matching entry exists.
      * @param tid The thread id.
@@ -241,11 +243,11 @@ class BPredUnit : public SimObject
         return btb->update(tid, instPC, target);
     }
 
-
+  protected:
     void dump();
 
   private:
-    struct PredictorHistory
+    struct PredictorHistory : public PoolAllocated
     {
         /**
          * Makes a predictor history struct that contains any
@@ -324,6 +326,12 @@ class BPredUnit : public SimObject
         /** The predicted target */
         std::unique_ptr<PCStateBase> target;
 
+        /**
+         * The address the branch falls through to. Only tracked while
+         * something listens to committed branches.
+         */
+        Addr fallThrough = 0;
+
         /**
          * Pointer to the history objects passed back from the branch
          * predictor subcomponents.
@@ -462,6 +470,9 @@ class BPredUnit : public SimObject
     /** Miss-predicted branches */
     probing::PMUUPtr ppMisses;
 
+    /** Committed branches and their outcome, e.g., to record a trace. */
+    std::unique_ptr<ProbePointArg<BranchTraceRecord>> ppCommittedBranches;
+
     /** @} */
 };
 
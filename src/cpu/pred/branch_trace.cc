@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/branch_trace.hh"
+
+#include <cstring>
+
+#include "base/logging.hh"
+#include "sim/byteswap.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+namespace
+{
+
+const char traceMagic[8] = {'g', 'e', 'm', '5', 'b', 't', 'r', '\0'};
+const uint32_t traceVersion = 1;
+
+/**
+ * Size of an encoded record: pc, target, instruction delta, the size of
+ * the branch (i.e., fallThrough - pc) and the type with the direction in
+ * its top bit.
+ */
+const size_t recordSize = 8 + 8 + 4 + 1 + 1;
+
+const uint8_t takenBit = 0x80;
+
+template <typename T>
+void
+put(uint8_t *&buf, T val)
+{
+    val = htole(val);
+    std::memcpy(buf, &val, sizeof(T));
+    buf += sizeof(T);
+}
+
+template <typename T>
+T
+get(const uint8_t *&buf)
+{
+    T val;
+    std::memcpy(&val, buf, sizeof(T));
+    buf += sizeof(T);
+    return letoh(val);
+}
+
+} // anonymous namespace
+
+BranchTraceWriter::BranchTraceWriter(std::ostream &os)
+    : os(os)
+{
+    uint8_t header[sizeof(traceMagic) + sizeof(uint32_t)];
+    uint8_t *buf = header + sizeof(traceMagic);
+    std::memcpy(header, traceMagic, sizeof(traceMagic));
+    put<uint32_t>(buf, traceVersion);
+    os.write(reinterpret_cast<const char *>(header), sizeof(header));
+}
+
+void
+BranchTraceWriter::write(const BranchTraceRecord &rec)
+{
+    const Addr size = rec.fallThrough - rec.pc;
+    panic_if(size > 0xff, "Branch at %#x is too large to trace.", rec.pc);
+
+    uint8_t record[recordSize];
+    uint8_t *buf = record;
+    put<uint64_t>(buf, rec.pc);
+    put<uint64_t>(buf, rec.target);
+    put<uint32_t>(buf, rec.instDelta);
+    put<uint8_t>(buf, size);
+    put<uint8_t>(buf, static_cast<uint8_t>(rec.type) |
+                      (rec.taken ? takenBit : 0));
+    os.write(reinterpret_cast<const char *>(record), recordSize);
+}
+
+BranchTraceReader::BranchTraceReader(const std::string &filename)
+    : filename(filename), is(filename, std::ios::in | std::ios::binary)
+{
+    fatal_if(!is, "Could not open branch trace %s.", filename);
+
+    uint8_t header[sizeof(traceMagic) + sizeof(uint32_t)];
+    is.read(reinterpret_cast<char *>(header), sizeof(header));
+    fatal_if(!is || std::memcmp(header, traceMagic, sizeof(traceMagic)),
+             "%s is not a branch trace.", filename);
+
+    const uint8_t *buf = header + sizeof(traceMagic);
+    const uint32_t version = get<uint32_t>(buf);
+    fatal_if(version != traceVersion,
+             "Branch trace %s has version %d, expected %d.",
+             filename, version, traceVersion);
+}
+
+bool
+BranchTraceReader::read(BranchTraceRecord &rec)
+{
+    uint8_t record[recordSize];
+    is.read(reinterpret_cast<char *>(record), recordSize);
+    if (is.gcount() == 0)
+        return false;
+    fatal_if(is.gcount() != recordSize,
+             "Branch trace %s ends with a truncated record.", filename);
+
+    const uint8_t *buf = record;
+    rec.pc = get<uint64_t>(buf);
+    rec.target = get<uint64_t>(buf);
+    rec.instDelta = get<uint32_t>(buf);
+    rec.fallThrough = rec.pc + get<uint8_t>(buf);
+    const uint8_t type = get<uint8_t>(buf);
+    rec.type = static_cast<BranchType>(type & ~takenBit);
+    rec.taken = type & takenBit;
+    fatal_if(rec.type >= enums::Num_BranchType,
+             "Branch trace %s has a record with a bad branch type.",
+             filename);
+    return true;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
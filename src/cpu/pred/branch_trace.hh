@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * On-disk format of branch traces. A branch trace is the stream of
+ * committed branches of one thread, as seen by the branch predictor, and
+ * is enough to replay that thread through any branch predictor without
+ * simulating the rest of the core.
+ *
+ * A trace starts with an 8 byte magic string and a 32 bit version,
+ * followed by fixed size little endian records.
+ */
+
+#ifndef __CPU_PRED_BRANCH_TRACE_HH__
+#define __CPU_PRED_BRANCH_TRACE_HH__
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+#include "base/types.hh"
+#include "cpu/pred/branch_type.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+/** A committed branch. */
+struct BranchTraceRecord
+{
+    /** Address of the branch. */
+    Addr pc = 0;
+
+    /** Address of the instruction that followed the branch. */
+    Addr target = 0;
+
+    /** Address the branch falls through to when it is not taken. */
+    Addr fallThrough = 0;
+
+    /** Instructions committed since the previous branch, inclusive. */
+    uint32_t instDelta = 0;
+
+    BranchType type = BranchType::NoBranch;
+
+    bool taken = false;
+};
+
+/** Appends branch records to an already opened binary stream. */
+class BranchTraceWriter
+{
+  public:
+    /** Writes the trace header to the stream. */
+    BranchTraceWriter(std::ostream &os);
+
+    void write(const BranchTraceRecord &rec);
+
+  private:
+    std::ostream &os;
+};
+
+/** Reads branch records from a trace file. */
+class BranchTraceReader
+{
+  public:
+    /** Opens the trace and checks its header, fatal on a bad trace. */
+    BranchTraceReader(const std::string &filename);
+
+    /**
+     * Read the next record.
+     *
+     * @return false once the end of the trace is reached.
+     */
+    bool read(BranchTraceRecord &rec);
+
+  private:
+    const std::string filename;
+    std::ifstream is;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_BRANCH_TRACE_HH__
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/branch_trace_evaluator.hh"
+
+#include "arch/generic/pcstate.hh"
+#include "base/trace.hh"
+#include "cpu/pred/bpred_unit.hh"
+#include "cpu/pred/branch_trace.hh"
+#include "debug/Branch.hh"
+#include "params/BranchTraceEvaluator.hh"
+#include "sim/sim_exit.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+namespace
+{
+
+/**
+ * A branch of a given type as far as the branch predictor can tell. The
+ * size of the instruction is set for every traced branch, so advancing
+ * the PC past it yields the traced fall-through address.
+ */
+class TraceBranchInst : public StaticInst
+{
+  public:
+    TraceBranchInst(BranchType type)
+        : StaticInst("trace branch", No_OpClass)
+    {
+        flags[IsControl] = true;
+        flags[IsCall] = type == BranchType::CallDirect ||
+                        type == BranchType::CallIndirect;
+        flags[IsReturn] = type == BranchType::Return;
+
+        const bool direct = type == BranchType::CallDirect ||
+                            type == BranchType::DirectCond ||
+                            type == BranchType::DirectUncond;
+        flags[IsDirectControl] = direct;
+        flags[IsIndirectControl] = !direct;
+
+        const bool cond = type == BranchType::DirectCond ||
+                          type == BranchType::IndirectCond;
+        flags[IsCondControl] = cond;
+        flags[IsUncondControl] = !cond;
+    }
+
+    Fault
+    execute(ExecContext *xc, trace::InstRecord *traceData) const override
+    {
+        panic("Trace branches can not be executed.");
+    }
+
+    void
+    advancePC(PCStateBase &pc) const override
+    {
+        pc.set(pc.instAddr() + size());
+    }
+
+    std::unique_ptr<PCStateBase>
+    buildRetPC(const PCStateBase &cur_pc,
+               const PCStateBase &call_pc) const override
+    {
+        std::unique_ptr<PCStateBase> ret_pc(call_pc.clone());
+        advancePC(*ret_pc);
+        return ret_pc;
+    }
+
+    std::string
+    generateDisassembly(Addr pc,
+            const loader::SymbolTable *symtab) const override
+    {
+        return mnemonic;
+    }
+};
+
+/** Traces do not record the instruction width, any PC type will do. */
+typedef GenericISA::SimplePCState<4> TracePCState;
+
+} // anonymous namespace
+
+std::atomic<unsigned> BranchTraceEvaluator::numRunning(0);
+
+BranchTraceEvaluator::BranchTraceEvaluator(
+        const BranchTraceEvaluatorParams &p)
+    : SimObject(p),
+      bpred(p.bpred),
+      traceFile(p.trace_file),
+      maxBranches(p.max_branches),
+      evaluateEvent([this]{ evaluate(); }, name()),
+      stats(this)
+{
+    for (int type = 0; type < enums::Num_BranchType; type++) {
+        if (type != BranchType::NoBranch)
+            branchInsts[type] = new TraceBranchInst(BranchType(type));
+    }
+    numRunning++;
+}
+
+void
+BranchTraceEvaluator::startup()
+{
+    schedule(evaluateEvent, curTick());
+}
+
+void
+BranchTraceEvaluator::evaluate()
+{
+    const ThreadID tid = 0;
+    BranchTraceReader reader(traceFile);
+    BranchTraceRecord rec;
+    InstSeqNum seq_num = 0;
+    TracePCState pc;
+
+    while ((maxBranches == 0 || seq_num < maxBranches) &&
+           reader.read(rec)) {
+        stats.insts += rec.instDelta;
+        if (rec.type == BranchType::NoBranch)
+            continue;
+
+        const StaticInstPtr &inst = branchInsts[rec.type];
+        inst->size(rec.fallThrough - rec.pc);
+        const bool cond = inst->isCondCtrl();
+
+        ++seq_num;
+        ++stats.branches;
+        if (cond)
+            ++stats.condBranches;
+
+        pc.set(rec.pc);
+        bpred->predict(inst, seq_num, pc, tid);
+        if (pc.instAddr() != rec.target) {
+            ++stats.mispredicted;
+            if (cond)
+                ++stats.condMispredicted;
+            bpred->squash(seq_num, TracePCState(rec.target), rec.taken,
+                          tid);
+        }
+        bpred->update(seq_num, tid);
+    }
+
+    DPRINTF(Branch, "Replayed %llu branches from %s.\n", seq_num,
+            traceFile);
+
+    if (--numRunning == 0)
+        exitSimLoop("branch trace evaluation done");
+}
+
+BranchTraceEvaluator::EvaluatorStats::EvaluatorStats(
+        statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(insts, statistics::units::Count::get(),
+               "Number of instructions in the replayed trace"),
+      ADD_STAT(branches, statistics::units::Count::get(),
+               "Number of replayed branches"),
+      ADD_STAT(condBranches, statistics::units::Count::get(),
+               "Number of replayed conditional branches"),
+      ADD_STAT(mispredicted, statistics::units::Count::get(),
+               "Number of mispredicted branches"),
+      ADD_STAT(condMispredicted, statistics::units::Count::get(),
+               "Number of mispredicted conditional branches"),
+      ADD_STAT(mpki, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Count>::get(),
+               "Mispredicted branches per thousand instructions"),
+      ADD_STAT(condMpki, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Count>::get(),
+               "Mispredicted conditional branches per thousand "
+               "instructions")
+{
+    mpki.precision(4);
+    mpki = mispredicted * 1000 / insts;
+    condMpki.precision(4);
+    condMpki = condMispredicted * 1000 / insts;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_BRANCH_TRACE_EVALUATOR_HH__
+#define __CPU_PRED_BRANCH_TRACE_EVALUATOR_HH__
+
+#include <atomic>
+#include <string>
+
+#include "base/statistics.hh"
+#include "cpu/pred/branch_type.hh"
+#include "cpu/static_inst.hh"
+#include "sim/eventq.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+struct BranchTraceEvaluatorParams;
+
+namespace branch_prediction
+{
+
+class BPredUnit;
+
+/**
+ * Replays a branch trace recorded by a BranchTraceRecorder through a
+ * branch predictor, without simulating a core around it. Every branch is
+ * predicted, corrected if it was mispredicted and committed right away,
+ * i.e., the predictor never sees wrong path branches.
+ *
+ * Evaluators do not interact with each other, so several of them can be
+ * placed on their own event queues to evaluate different traces or
+ * predictors in parallel. The simulation exits once all of them are done.
+ */
+class BranchTraceEvaluator : public SimObject
+{
+  public:
+    BranchTraceEvaluator(const BranchTraceEvaluatorParams &params);
+
+    void startup() override;
+
+  private:
+    /** Replay the whole trace. */
+    void evaluate();
+
+    BPredUnit *const bpred;
+
+    const std::string traceFile;
+
+    const uint64_t maxBranches;
+
+    /** One synthetic branch instruction per branch type. */
+    StaticInstPtr branchInsts[enums::Num_BranchType];
+
+    EventFunctionWrapper evaluateEvent;
+
+    /** Evaluators that are not done yet, across all event queues. */
+    static std::atomic<unsigned> numRunning;
+
+    struct EvaluatorStats : public statistics::Group
+    {
+        EvaluatorStats(statistics::Group *parent);
+
+        statistics::Scalar insts;
+        statistics::Scalar branches;
+        statistics::Scalar condBranches;
+        statistics::Scalar mispredicted;
+        statistics::Scalar condMispredicted;
+        statistics::Formula mpki;
+        statistics::Formula condMpki;
+    } stats;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_BRANCH_TRACE_EVALUATOR_HH__
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/branch_trace_recorder.hh"
+
+#include <algorithm>
+#include <limits>
+
+#include "cpu/pred/bpred_unit.hh"
+#include "params/BranchTraceRecorder.hh"
+#include "sim/core.hh"
+
+namespace gem5
+{
+
+namespace branch_prediction
+{
+
+BranchTraceRecorder::BranchTraceRecorder(
+        const BranchTraceRecorderParams &p)
+    : ProbeListenerObject(p),
+      bpred(p.bpred),
+      traceStream(simout.create(
+            p.trace_file != "" ? p.trace_file : name() + ".btrace",
+            true, true)),
+      writer(new BranchTraceWriter(*traceStream->stream()))
+{
+    registerExitCallback([this]() { closeStream(); });
+}
+
+void
+BranchTraceRecorder::regProbeListeners()
+{
+    listeners.push_back(
+        new ProbeListenerArg<BranchTraceRecorder, uint64_t>(
+            this, "RetiredInsts", &BranchTraceRecorder::retiredInsts));
+    listeners.push_back(
+        new ProbeListenerArgFunc<BranchTraceRecord>(
+            bpred->getProbeManager(), "CommittedBranches",
+            [this](const BranchTraceRecord &rec)
+            { committedBranch(rec); }));
+}
+
+void
+BranchTraceRecorder::retiredInsts(const uint64_t &count)
+{
+    instsSinceBranch += count;
+}
+
+void
+BranchTraceRecorder::committedBranch(const BranchTraceRecord &rec)
+{
+    // Branches that were predicted before the recorder started listening
+    // do not know their fall-through address.
+    if (!writer || rec.fallThrough == 0)
+        return;
+
+    BranchTraceRecord out = rec;
+    out.instDelta = std::min<uint64_t>(
+        instsSinceBranch, std::numeric_limits<uint32_t>::max());
+    instsSinceBranch -= out.instDelta;
+    writer->write(out);
+}
+
+void
+BranchTraceRecorder::closeStream()
+{
+    if (!writer)
+        return;
+    writer.reset();
+    simout.close(traceStream);
+    traceStream = nullptr;
+}
+
+} // namespace branch_prediction
+} // namespace gem5
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_BRANCH_TRACE_RECORDER_HH__
+#define __CPU_PRED_BRANCH_TRACE_RECORDER_HH__
+
+#include <memory>
+
+#include "base/output.hh"
+#include "cpu/pred/branch_trace.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+struct BranchTraceRecorderParams;
+
+namespace branch_prediction
+{
+
+class BPredUnit;
+
+/**
+ * Records the branches a core commits to a branch trace, which a
+ * BranchTraceEvaluator can replay later through any branch predictor.
+ *
+ * The recorder listens to the core it is attached to for the number of
+ * retired instructions and to the core's branch predictor for the
+ * committed branches. On pipelined cores the branch predictor only learns
+ * about committed branches some cycles after they retired, so the
+ * instruction count of a single record may be off by a few instructions.
+ * The total over the trace is exact.
+ */
+class BranchTraceRecorder : public ProbeListenerObject
+{
+  public:
+    BranchTraceRecorder(const BranchTraceRecorderParams &params);
+
+    void regProbeListeners() override;
+
+  private:
+    void retiredInsts(const uint64_t &count);
+
+    void committedBranch(const BranchTraceRecord &rec);
+
+    /** Flush and close the trace, as the destructor is never called. */
+    void closeStream();
+
+    BPredUnit *const bpred;
+
+    OutputStream *traceStream;
+
+    std::unique_ptr<BranchTraceWriter> writer;
+
+    /** Instructions retired since the last recorded branch. */
+    uint64_t instsSinceBranch = 0;
+};
+
+} // namespace branch_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_BRANCH_TRACE_RECORDER_HH__
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/eves.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+namespace
+{
+
+/** The states of the two components. */
+struct EVESHistory
+{
+    void *vtage = nullptr;
+    void *stride = nullptr;
+};
+
+} // anonymous namespace
+
+EVESValuePredictor::EVESValuePredictor(
+        const EVESValuePredictorParams &params)
+    : ValuePredictor(params),
+      vtage(params.vtage),
+      stride(params.stride)
+{
+}
+
+bool
+EVESValuePredictor::lookup(ThreadID tid, Addr pc, uint64_t ghist,
+                           RegVal &value, void * &vp_history)
+{
+    auto *history = new EVESHistory;
+    vp_history = history;
+
+    RegVal vtage_value = 0;
+    RegVal stride_value = 0;
+    bool vtage_confident =
+        vtage->lookup(tid, pc, ghist, vtage_value, history->vtage);
+    bool stride_confident =
+        stride->lookup(tid, pc, ghist, stride_value, history->stride);
+
+    if (vtage_confident || !stride_confident) {
+        value = vtage_value;
+        return vtage_confident;
+    }
+    value = stride_value;
+    return true;
+}
+
+void
+EVESValuePredictor::update(ThreadID tid, Addr pc, uint64_t ghist,
+                           RegVal value, void * &vp_history)
+{
+    auto *history = static_cast<EVESHistory *>(vp_history);
+    vtage->update(tid, pc, ghist, value, history->vtage);
+    stride->update(tid, pc, ghist, value, history->stride);
+    delete history;
+    vp_history = nullptr;
+}
+
+void
+EVESValuePredictor::squash(ThreadID tid, void * &vp_history)
+{
+    auto *history = static_cast<EVESHistory *>(vp_history);
+    vtage->squash(tid, history->vtage);
+    stride->squash(tid, history->stride);
+    delete history;
+    vp_history = nullptr;
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_EVES_HH__
+#define __CPU_PRED_EVES_HH__
+
+#include "base/types.hh"
+#include "cpu/pred/stride_value.hh"
+#include "cpu/pred/value_pred.hh"
+#include "cpu/pred/vtage.hh"
+#include "params/EVESValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+/**
+ * EVES value predictor, after "Exploring value prediction with the EVES
+ * predictor" by Seznec. It combines a context based VTAGE component with
+ * a computational stride component, and uses the VTAGE prediction when
+ * it is confident and the stride one otherwise. Both components are
+ * trained with every load.
+ */
+class EVESValuePredictor : public ValuePredictor
+{
+  public:
+    EVESValuePredictor(const EVESValuePredictorParams &params);
+
+    bool lookup(ThreadID tid, Addr pc, uint64_t ghist, RegVal &value,
+                void * &vp_history) override;
+
+    void update(ThreadID tid, Addr pc, uint64_t ghist, RegVal value,
+                void * &vp_history) override;
+
+    void squash(ThreadID tid, void * &vp_history) override;
+
+  private:
+    /** The context based component. */
+    VTAGEValuePredictor *vtage;
+
+    /** The computational component. */
+    StrideValuePredictor *stride;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_EVES_HH__
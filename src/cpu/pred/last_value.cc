@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/last_value.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+LastValuePredictor::LastValuePredictor(
+        const LastValuePredictorParams &params)
+    : ValuePredictor(params),
+      table(params.tableSize, Entry(confidenceBits)),
+      indexMask(params.tableSize - 1)
+{
+    fatal_if(!isPowerOf2(params.tableSize),
+             "The last value table size must be a power of 2.\n");
+}
+
+LastValuePredictor::Entry &
+LastValuePredictor::entry(ThreadID tid, Addr pc)
+{
+    return table[((pc >> instShiftAmt) ^ tid) & indexMask];
+}
+
+bool
+LastValuePredictor::lookup(ThreadID tid, Addr pc, uint64_t ghist,
+                           RegVal &value, void * &vp_history)
+{
+    vp_history = nullptr;
+
+    Entry &e = entry(tid, pc);
+    if (e.tag != pc)
+        return false;
+
+    value = e.value;
+    return e.confidence.isSaturated();
+}
+
+void
+LastValuePredictor::update(ThreadID tid, Addr pc, uint64_t ghist,
+                           RegVal value, void * &vp_history)
+{
+    assert(vp_history == nullptr);
+
+    Entry &e = entry(tid, pc);
+    if (e.tag == pc && e.value == value) {
+        e.confidence++;
+    } else {
+        e.tag = pc;
+        e.value = value;
+        e.confidence.reset();
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -44,6 +44,7 @@
 #ifndef __CPU_PRED_LOOP_PREDICTOR_HH__
 #define __CPU_PRED_LOOP_PREDICTOR_HH__
 
+#include "base/pool_alloc.hh"
 #include "base/random.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
@@ -140,7 +141,7 @@ class LoopPredictor : public SimObject
     }
   public:
     // Primary branch history entry
-    struct BranchInfo
+    struct BranchInfo : public PoolAllocated
     {
         uint16_t loopTag;
         uint16_t currentIter;
@@ -50,6 +50,8 @@
 
 #include "cpu/pred/multiperspective_perceptron.hh"
 
+#include <algorithm>
+
 #include "debug/Branch.hh"
 
 namespace gem5
@@ -115,6 +117,8 @@ MultiperspectivePerceptron::ThreadData::ThreadData(int num_filters,
         modpath_histories[modpath_indices[i]].resize(modpath_lengths[i]);
     }
 
+    best_preds.resize(table_sizes.size());
+    best_pairs.resize(table_sizes.size());
     for (int i = 0; i < table_sizes.size(); i += 1) {
         mpreds.push_back(0);
         tables.push_back(std::vector<short int>(table_sizes[i]));
@@ -266,16 +270,8 @@ MultiperspectivePerceptron::findBest(ThreadID tid,
     if (threshold < 0) {
         return;
     }
-    struct BestPair
-    {
-        int index;
-        int mpreds;
-        bool operator<(BestPair const &bp) const
-        {
-            return mpreds < bp.mpreds;
-        }
-    };
-    std::vector<BestPair> pairs(best_preds.size());
+    std::vector<BestPair> &pairs = threadData[tid]->best_pairs;
+    assert(pairs.size() == best_preds.size());
     for (int i = 0; i < best_preds.size(); i += 1) {
         pairs[i].index = i;
         pairs[i].mpreds = threadData[tid]->mpreds[i];
@@ -321,7 +317,8 @@ int
 MultiperspectivePerceptron::computeOutput(ThreadID tid, MPPBranchInfo &bi)
 {
     // list of best predictors
-    std::vector<int> best_preds(specs.size(), -1);
+    std::vector<int> &best_preds = threadData[tid]->best_preds;
+    std::fill(best_preds.begin(), best_preds.end(), -1);
 
     // initialize sum
     bi.yout = 0;
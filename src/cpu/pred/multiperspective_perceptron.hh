@@ -54,6 +54,7 @@
 #include <array>
 #include <vector>
 
+#include "base/pool_alloc.hh"
 #include "base/random.hh"
 #include "cpu/pred/bpred_unit.hh"
 #include "params/MultiperspectivePerceptron.hh"
@@ -70,7 +71,7 @@ class MultiperspectivePerceptron : public BPredUnit
     /**
      * Branch information data
      */
-    class MPPBranchInfo
+    class MPPBranchInfo : public PoolAllocated
     {
         /** pc of the branch */
         const unsigned int pc;
@@ -309,6 +310,17 @@ class MultiperspectivePerceptron : public BPredUnit
 
     Random::RandomPtr rng = Random::genRandom();
 
+    /** A feature and its number of mispredictions, to rank features */
+    struct BestPair
+    {
+        int index;
+        int mpreds;
+        bool operator<(BestPair const &bp) const
+        {
+            return mpreds < bp.mpreds;
+        }
+    };
+
     /** History data is kept for each thread */
     struct ThreadData
     {
@@ -370,6 +382,11 @@ class MultiperspectivePerceptron : public BPredUnit
         std::vector<int> mpreds;
         std::vector<std::vector<short int>> tables;
         std::vector<std::vector<std::array<bool, 2>>> sign_bits;
+
+        /** Scratch space of computeOutput and findBest, kept here so
+         *  that predictions don't allocate */
+        std::vector<int> best_preds;
+        std::vector<BestPair> best_pairs;
     };
     std::vector<ThreadData *> threadData;
 
@@ -41,6 +41,7 @@
 
 #include <deque>
 
+#include "base/pool_alloc.hh"
 #include "base/statistics.hh"
 #include "cpu/inst_seq.hh"
 #include "cpu/pred/indirect.hh"
@@ -109,7 +110,7 @@ class SimpleIndirectPredictor : public IndirectPredictor
     /** Indirect branch history information
      * Used for prediction, update and recovery
      */
-    struct IndirectHistory
+    struct IndirectHistory : public PoolAllocated
     {
         /* data */
         Addr pcAddr;
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/stride_value.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+namespace
+{
+
+/** The load an in flight instance was counted for. */
+struct StrideHistory
+{
+    Addr pc;
+};
+
+} // anonymous namespace
+
+StrideValuePredictor::StrideValuePredictor(
+        const StrideValuePredictorParams &params)
+    : ValuePredictor(params),
+      table(params.tableSize, Entry(confidenceBits)),
+      indexMask(params.tableSize - 1)
+{
+    fatal_if(!isPowerOf2(params.tableSize),
+             "The stride table size must be a power of 2.\n");
+}
+
+StrideValuePredictor::Entry &
+StrideValuePredictor::entry(ThreadID tid, Addr pc)
+{
+    return table[((pc >> instShiftAmt) ^ tid) & indexMask];
+}
+
+bool
+StrideValuePredictor::lookup(ThreadID tid, Addr pc, uint64_t ghist,
+                             RegVal &value, void * &vp_history)
+{
+    Entry &e = entry(tid, pc);
+    if (e.tag != pc) {
+        vp_history = nullptr;
+        return false;
+    }
+
+    value = e.last + e.stride * (e.inflight + 1);
+    e.inflight++;
+    vp_history = new StrideHistory{pc};
+    return e.confidence.isSaturated();
+}
+
+void
+StrideValuePredictor::retire(ThreadID tid, Addr pc, void * &vp_history)
+{
+    if (!vp_history)
+        return;
+
+    // The entry may have been taken over while the load was in flight.
+    Entry &e = entry(tid, pc);
+    auto *history = static_cast<StrideHistory *>(vp_history);
+    if (e.tag == history->pc && e.inflight)
+        e.inflight--;
+
+    delete history;
+    vp_history = nullptr;
+}
+
+void
+StrideValuePredictor::update(ThreadID tid, Addr pc, uint64_t ghist,
+                             RegVal value, void * &vp_history)
+{
+    retire(tid, pc, vp_history);
+
+    Entry &e = entry(tid, pc);
+    if (e.tag != pc) {
+        e.tag = pc;
+        e.last = value;
+        e.stride = 0;
+        e.confidence.reset();
+        e.inflight = 0;
+        return;
+    }
+
+    RegVal stride = value - e.last;
+    if (stride == e.stride) {
+        e.confidence++;
+    } else {
+        e.stride = stride;
+        e.confidence.reset();
+    }
+    e.last = value;
+}
+
+void
+StrideValuePredictor::squash(ThreadID tid, void * &vp_history)
+{
+    if (vp_history) {
+        retire(tid, static_cast<StrideHistory *>(vp_history)->pc,
+               vp_history);
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_STRIDE_VALUE_HH__
+#define __CPU_PRED_STRIDE_VALUE_HH__
+
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/types.hh"
+#include "cpu/pred/value_pred.hh"
+#include "params/StrideValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+/**
+ * Predicts that the values of a load follow a constant stride. The
+ * instances of the load still in flight are counted, so that each one
+ * is predicted from the last committed value the right number of
+ * strides ahead.
+ */
+class StrideValuePredictor : public ValuePredictor
+{
+  public:
+    StrideValuePredictor(const StrideValuePredictorParams &params);
+
+    bool lookup(ThreadID tid, Addr pc, uint64_t ghist, RegVal &value,
+                void * &vp_history) override;
+
+    void update(ThreadID tid, Addr pc, uint64_t ghist, RegVal value,
+                void * &vp_history) override;
+
+    void squash(ThreadID tid, void * &vp_history) override;
+
+  private:
+    struct Entry
+    {
+        Entry(unsigned bits) : confidence(bits) {}
+
+        Addr tag = MaxAddr;
+        /** Value of the last committed instance. */
+        RegVal last = 0;
+        RegVal stride = 0;
+        SatCounter8 confidence;
+        /** Number of instances looked up and not committed yet. */
+        unsigned inflight = 0;
+    };
+
+    /** Returns the entry of a load. */
+    Entry &entry(ThreadID tid, Addr pc);
+
+    /** Stops counting a load as in flight. */
+    void retire(ThreadID tid, Addr pc, void * &vp_history);
+
+    /** The stride table. */
+    std::vector<Entry> table;
+
+    /** Mask to get the index bits. */
+    const Addr indexMask;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_STRIDE_VALUE_HH__
@@ -62,6 +62,7 @@
 
 #include <vector>
 
+#include "base/pool_alloc.hh"
 #include "base/random.hh"
 #include "base/types.hh"
 #include "cpu/pred/bpred_unit.hh"
@@ -81,7 +82,7 @@ class TAGE: public BPredUnit
 
     Random::RandomPtr rng = Random::genRandom();
 
-    struct TageBranchInfo
+    struct TageBranchInfo : public PoolAllocated
     {
         TAGEBase::BranchInfo *tageBranchInfo;
 
@@ -50,6 +50,7 @@
 
 #include <vector>
 
+#include "base/pool_alloc.hh"
 #include "base/statistics.hh"
 #include "cpu/null_static_inst.hh"
 #include "cpu/static_inst.hh"
@@ -72,13 +73,16 @@ class TAGEBase : public SimObject
     // Prediction Structures
 
     // Tage Entry
+    // The tag comes first so that the entry packs into 4 bytes and
+    // more of the tables fit in the host caches.
     struct TageEntry
     {
-        int8_t ctr;
         uint16_t tag;
+        int8_t ctr;
         uint8_t u;
-        TageEntry() : ctr(0), tag(0), u(0) { }
+        TageEntry() : tag(0), ctr(0), u(0) { }
     };
+    static_assert(sizeof(TageEntry) == 4, "TageEntry is not packed");
 
     // Folded History Table - compressed history
     // to mix with instruction PC to index partially
@@ -125,7 +129,7 @@ class TAGEBase : public SimObject
     };
 
     // Primary branch history entry
-    struct BranchInfo
+    struct BranchInfo : public PoolAllocated
     {
         int pathHist;
         int ptGhist;
@@ -146,6 +150,7 @@ class TAGEBase : public SimObject
         // to save table indices and folded histories.
         // To do one call to new instead of five.
         int *storage;
+        const size_t storageSize;
 
         // Pointers to actual saved array within the dynamically
         // allocated storage.
@@ -166,10 +171,12 @@ class TAGEBase : public SimObject
               tagePred(false), altTaken(false),
               condBranch(false), longestMatchPred(false),
               pseudoNewAlloc(false), branchPC(0),
+              storageSize((tage.nHistoryTables + 1) * 5 * sizeof(int)),
               provider(-1)
         {
             int sz = tage.nHistoryTables + 1;
-            storage = new int [sz * 5];
+            storage = static_cast<int *>(
+                PoolAllocator::allocate(storageSize));
             tableIndices = storage;
             tableTags = storage + sz;
             ci = tableTags + sz;
@@ -179,7 +186,7 @@ class TAGEBase : public SimObject
 
         virtual ~BranchInfo()
         {
-            delete[] storage;
+            PoolAllocator::deallocate(storage, storageSize);
         }
     };
 
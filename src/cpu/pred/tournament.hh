@@ -44,6 +44,7 @@
 
 #include <vector>
 
+#include "base/pool_alloc.hh"
 #include "base/sat_counter.hh"
 #include "base/types.hh"
 #include "cpu/pred/bpred_unit.hh"
@@ -113,7 +114,7 @@ class TournamentBP : public BPredUnit
      * when the BP can use this information to update/restore its
      * state properly.
      */
-    struct BPHistory
+    struct BPHistory : public PoolAllocated
     {
 #ifdef GEM5_DEBUG
         BPHistory()
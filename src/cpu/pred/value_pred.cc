@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/value_pred.hh"
+
+#include "base/trace.hh"
+#include "debug/ValuePred.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+ValuePredictor::ValuePredictor(const ValuePredictorParams &params)
+    : SimObject(params),
+      instShiftAmt(params.instShiftAmt),
+      confidenceBits(params.confidenceBits),
+      history(params.numThreads),
+      globalHistory(params.numThreads, 0),
+      stats(this)
+{
+}
+
+ValuePredictor::ValuePredictorStats::ValuePredictorStats(
+        statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(lookups, statistics::units::Count::get(),
+               "Number of loads looked up"),
+      ADD_STAT(confident, statistics::units::Count::get(),
+               "Number of loads given a predicted value"),
+      ADD_STAT(correct, statistics::units::Count::get(),
+               "Number of committed loads given the right value"),
+      ADD_STAT(incorrect, statistics::units::Count::get(),
+               "Number of committed loads given a wrong value"),
+      ADD_STAT(accuracy, statistics::units::Ratio::get(),
+               "Fraction of the used predictions that were right",
+               correct / (correct + incorrect)),
+      ADD_STAT(coverage, statistics::units::Ratio::get(),
+               "Fraction of the loads given a predicted value",
+               confident / lookups)
+{
+    accuracy.precision(6);
+    coverage.precision(6);
+}
+
+bool
+ValuePredictor::predict(ThreadID tid, InstSeqNum seq_num, Addr pc,
+                        RegVal &value)
+{
+    History entry{seq_num, pc, globalHistory[tid], false, false, 0,
+                  nullptr};
+    entry.confident = lookup(tid, pc, entry.ghist, entry.value,
+                             entry.vpHistory);
+    history[tid].push_back(entry);
+
+    ++stats.lookups;
+    if (entry.confident) {
+        ++stats.confident;
+        DPRINTF(ValuePred, "[tid:%i] [sn:%llu] Predicted value %#x for "
+                "PC %#x.\n", tid, seq_num, entry.value, pc);
+    }
+
+    value = entry.value;
+    return entry.confident;
+}
+
+void
+ValuePredictor::recordBranch(ThreadID tid, InstSeqNum seq_num, bool taken)
+{
+    history[tid].push_back({seq_num, 0, globalHistory[tid], true, false, 0,
+                            nullptr});
+    globalHistory[tid] = globalHistory[tid] << 1 | taken;
+}
+
+void
+ValuePredictor::commit(ThreadID tid, InstSeqNum seq_num, RegVal value)
+{
+    auto &hist = history[tid];
+
+    // Instructions commit in order, anything older never will.
+    while (!hist.empty() && hist.front().seqNum < seq_num) {
+        if (!hist.front().isBranch)
+            squash(tid, hist.front().vpHistory);
+        hist.pop_front();
+    }
+
+    if (hist.empty() || hist.front().seqNum != seq_num)
+        return;
+
+    History &entry = hist.front();
+    if (!entry.isBranch) {
+        if (entry.confident) {
+            if (entry.value == value)
+                ++stats.correct;
+            else
+                ++stats.incorrect;
+        }
+        update(tid, entry.pc, entry.ghist, value, entry.vpHistory);
+    }
+    hist.pop_front();
+}
+
+void
+ValuePredictor::squash(ThreadID tid, InstSeqNum seq_num)
+{
+    auto &hist = history[tid];
+    while (!hist.empty() && hist.back().seqNum > seq_num) {
+        if (!hist.back().isBranch)
+            squash(tid, hist.back().vpHistory);
+        globalHistory[tid] = hist.back().ghist;
+        hist.pop_back();
+    }
+}
+
+void
+ValuePredictor::squash(ThreadID tid, InstSeqNum seq_num, bool taken)
+{
+    squash(tid, seq_num);
+
+    auto &hist = history[tid];
+    if (!hist.empty() && hist.back().isBranch &&
+        hist.back().seqNum == seq_num) {
+        globalHistory[tid] = hist.back().ghist << 1 | taken;
+    }
+}
+
+} // namespace value_prediction
+} // namespace gem5
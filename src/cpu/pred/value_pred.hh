@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_VALUE_PRED_HH__
+#define __CPU_PRED_VALUE_PRED_HH__
+
+#include <deque>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "params/ValuePredictor.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+/**
+ * Base class of the value predictors. The CPU looks the loads up as they
+ * are renamed, and gives their destination the predicted value when the
+ * predictor is confident about it. The predicted directions of control
+ * instructions are recorded as well, to build a global branch history.
+ * Every instruction passed in is then either committed, which trains the
+ * predictor with the value the instruction produced, or squashed.
+ */
+class ValuePredictor : public SimObject
+{
+  public:
+    ValuePredictor(const ValuePredictorParams &params);
+
+    /**
+     * Predicts the value a load produces.
+     * @param tid The thread id.
+     * @param seq_num The sequence number of the load.
+     * @param pc The address of the load.
+     * @param value Set to the predicted value.
+     * @return Whether the prediction is confident enough to be used.
+     */
+    bool predict(ThreadID tid, InstSeqNum seq_num, Addr pc, RegVal &value);
+
+    /**
+     * Records the predicted direction of a control instruction.
+     * @param tid The thread id.
+     * @param seq_num The sequence number of the instruction.
+     * @param taken Whether the instruction is predicted taken.
+     */
+    void recordBranch(ThreadID tid, InstSeqNum seq_num, bool taken);
+
+    /**
+     * Commits an instruction passed to predict() or recordBranch(), and
+     * trains the predictor with the value it produced.
+     * @param tid The thread id.
+     * @param seq_num The sequence number of the instruction.
+     * @param value The value the instruction produced, if a load.
+     */
+    void commit(ThreadID tid, InstSeqNum seq_num, RegVal value);
+
+    /**
+     * Squashes the instructions younger than a sequence number.
+     * @param tid The thread id.
+     * @param seq_num The sequence number of the youngest instruction left.
+     */
+    void squash(ThreadID tid, InstSeqNum seq_num);
+
+    /**
+     * Squashes the instructions younger than a mispredicted branch,
+     * and corrects the direction of the branch in the global history.
+     * @param tid The thread id.
+     * @param seq_num The sequence number of the branch.
+     * @param taken The actual direction of the branch.
+     */
+    void squash(ThreadID tid, InstSeqNum seq_num, bool taken);
+
+    /**
+     * Looks a load up in the predictor tables.
+     * @param tid The thread id.
+     * @param pc The address of the load.
+     * @param ghist The global branch history, youngest branch in bit 0.
+     * @param value Set to the predicted value.
+     * @param vp_history Set to any state needed to update or squash the
+     * prediction.
+     * @return Whether the predictor is confident.
+     */
+    virtual bool lookup(ThreadID tid, Addr pc, uint64_t ghist,
+                        RegVal &value, void * &vp_history) = 0;
+
+    /**
+     * Trains the predictor tables with the value of a committed load.
+     * @param tid The thread id.
+     * @param pc The address of the load.
+     * @param ghist The global branch history the load was looked up with.
+     * @param value The value the load produced.
+     * @param vp_history The state from lookup(), freed by this function.
+     */
+    virtual void update(ThreadID tid, Addr pc, uint64_t ghist,
+                        RegVal value, void * &vp_history) = 0;
+
+    /**
+     * Undoes the speculative state of a squashed load.
+     * @param tid The thread id.
+     * @param vp_history The state from lookup(), freed by this function.
+     */
+    virtual void squash(ThreadID tid, void * &vp_history) = 0;
+
+  protected:
+    /** Number of bits to shift the instruction addresses by. */
+    const unsigned instShiftAmt;
+
+    /** Number of bits of the confidence counters. */
+    const unsigned confidenceBits;
+
+  private:
+    /** An instruction the predictor has seen and not committed yet. */
+    struct History
+    {
+        InstSeqNum seqNum;
+        Addr pc;
+        /** Global history before the instruction. */
+        uint64_t ghist;
+        /** Whether this is a control instruction rather than a load. */
+        bool isBranch;
+        /** Whether the prediction was confident. */
+        bool confident;
+        /** The predicted value. */
+        RegVal value;
+        /** The predictor state from lookup(). */
+        void *vpHistory;
+    };
+
+    /** Per-thread instructions in flight, oldest first. */
+    std::vector<std::deque<History>> history;
+
+    /** Per-thread speculative global branch history. */
+    std::vector<uint64_t> globalHistory;
+
+    struct ValuePredictorStats : public statistics::Group
+    {
+        ValuePredictorStats(statistics::Group *parent);
+
+        statistics::Scalar lookups;
+        statistics::Scalar confident;
+        statistics::Scalar correct;
+        statistics::Scalar incorrect;
+        statistics::Formula accuracy;
+        statistics::Formula coverage;
+    } stats;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_VALUE_PRED_HH__
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/pred/vtage.hh"
+
+#include <cmath>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+VTAGEValuePredictor::VTAGEValuePredictor(
+        const VTAGEValuePredictorParams &params)
+    : ValuePredictor(params),
+      baseTable(params.baseTableSize, Entry(confidenceBits)),
+      baseIndexMask(params.baseTableSize - 1),
+      tables(params.numTables,
+             std::vector<Entry>(1ULL << params.logTableSize,
+                                Entry(confidenceBits))),
+      logTableSize(params.logTableSize),
+      tagBits(params.tagBits)
+{
+    fatal_if(!isPowerOf2(params.baseTableSize),
+             "The last value table size must be a power of 2.\n");
+    fatal_if(params.numTables == 0, "VTAGE needs tagged tables.\n");
+    fatal_if(params.minHist == 0 || params.minHist > params.maxHist ||
+             params.maxHist > 64,
+             "VTAGE history lengths must be between 1 and 64.\n");
+
+    // Geometric series of history lengths.
+    for (unsigned i = 0; i < params.numTables; i++) {
+        double ratio = params.numTables > 1 ?
+            (double)i / (params.numTables - 1) : 0;
+        histLengths.push_back((unsigned)std::lround(params.minHist *
+            std::pow((double)params.maxHist / params.minHist, ratio)));
+    }
+}
+
+Addr
+VTAGEValuePredictor::fold(uint64_t ghist, unsigned hist_len, unsigned bits)
+{
+    if (hist_len < 64)
+        ghist &= mask(hist_len);
+
+    Addr folded = 0;
+    for (unsigned i = 0; i < hist_len; i += bits)
+        folded ^= ghist >> i;
+    return folded & mask(bits);
+}
+
+VTAGEValuePredictor::Entry &
+VTAGEValuePredictor::baseEntry(ThreadID tid, Addr pc)
+{
+    return baseTable[((pc >> instShiftAmt) ^ tid) & baseIndexMask];
+}
+
+Addr
+VTAGEValuePredictor::index(unsigned table, Addr pc, uint64_t ghist) const
+{
+    Addr shifted_pc = pc >> instShiftAmt;
+    return (shifted_pc ^ (shifted_pc >> (logTableSize + table)) ^
+            fold(ghist, histLengths[table], logTableSize)) &
+        mask(logTableSize);
+}
+
+Addr
+VTAGEValuePredictor::tag(unsigned table, Addr pc, uint64_t ghist) const
+{
+    return ((pc >> instShiftAmt) ^
+            fold(ghist, histLengths[table], tagBits) ^
+            (fold(ghist, histLengths[table], tagBits - 1) << 1)) &
+        mask(tagBits);
+}
+
+int
+VTAGEValuePredictor::provider(Addr pc, uint64_t ghist, int below) const
+{
+    for (int i = below - 1; i >= 0; i--) {
+        if (tables[i][index(i, pc, ghist)].tag == tag(i, pc, ghist))
+            return i;
+    }
+    return -1;
+}
+
+bool
+VTAGEValuePredictor::lookup(ThreadID tid, Addr pc, uint64_t ghist,
+                            RegVal &value, void * &vp_history)
+{
+    vp_history = nullptr;
+
+    int table = provider(pc, ghist, tables.size());
+    if (table >= 0) {
+        const Entry &e = tables[table][index(table, pc, ghist)];
+        value = e.value;
+        return e.confidence.isSaturated();
+    }
+
+    Entry &e = baseEntry(tid, pc);
+    value = e.value;
+    return e.tag == pc && e.confidence.isSaturated();
+}
+
+void
+VTAGEValuePredictor::update(ThreadID tid, Addr pc, uint64_t ghist,
+                            RegVal value, void * &vp_history)
+{
+    assert(vp_history == nullptr);
+
+    int table = provider(pc, ghist, tables.size());
+    Entry &base = baseEntry(tid, pc);
+    bool correct;
+
+    if (table >= 0) {
+        Entry &e = tables[table][index(table, pc, ghist)];
+        correct = e.value == value;
+        if (correct) {
+            e.confidence++;
+            // The entry is useful if the shorter histories get it wrong.
+            int alt = provider(pc, ghist, table);
+            RegVal alt_value = alt >= 0 ?
+                tables[alt][index(alt, pc, ghist)].value : base.value;
+            if (alt_value != value)
+                e.useful = true;
+        } else {
+            // Replace the value only once the confidence is gone.
+            if (e.confidence) {
+                e.confidence.reset();
+            } else {
+                e.value = value;
+            }
+            e.useful = false;
+        }
+    } else {
+        correct = base.tag == pc && base.value == value;
+        if (correct) {
+            base.confidence++;
+        } else {
+            base.tag = pc;
+            base.value = value;
+            base.confidence.reset();
+        }
+    }
+
+    if (correct)
+        return;
+
+    // Allocate an entry in a table with a longer history, or age the
+    // entries in the way if they are all useful.
+    for (int i = table + 1; i < (int)tables.size(); i++) {
+        Entry &e = tables[i][index(i, pc, ghist)];
+        if (!e.useful) {
+            e.tag = tag(i, pc, ghist);
+            e.value = value;
+            e.confidence.reset();
+            return;
+        }
+    }
+    for (int i = table + 1; i < (int)tables.size(); i++)
+        tables[i][index(i, pc, ghist)].useful = false;
+}
+
+} // namespace value_prediction
+} // namespace gem5
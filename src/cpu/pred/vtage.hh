@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_PRED_VTAGE_HH__
+#define __CPU_PRED_VTAGE_HH__
+
+#include <vector>
+
+#include "base/sat_counter.hh"
+#include "base/types.hh"
+#include "cpu/pred/value_pred.hh"
+#include "params/VTAGEValuePredictor.hh"
+
+namespace gem5
+{
+
+namespace value_prediction
+{
+
+/**
+ * VTAGE value predictor, as described in "Practical Data Value
+ * Speculation for Future High-end Processors" by Perais and Seznec. An
+ * untagged last value table is backed by tagged tables indexed with
+ * geometrically longer global branch histories, and the hitting table
+ * with the longest history provides the prediction. A wrong prediction
+ * allocates an entry in a table with a longer history.
+ */
+class VTAGEValuePredictor : public ValuePredictor
+{
+  public:
+    VTAGEValuePredictor(const VTAGEValuePredictorParams &params);
+
+    bool lookup(ThreadID tid, Addr pc, uint64_t ghist, RegVal &value,
+                void * &vp_history) override;
+
+    void update(ThreadID tid, Addr pc, uint64_t ghist, RegVal value,
+                void * &vp_history) override;
+
+    void squash(ThreadID tid, void * &vp_history) override
+    { assert(vp_history == nullptr); }
+
+  private:
+    struct Entry
+    {
+        Entry(unsigned bits) : confidence(bits) {}
+
+        Addr tag = MaxAddr;
+        RegVal value = 0;
+        SatCounter8 confidence;
+        bool useful = false;
+    };
+
+    /** Returns the entry of a load in the last value table. */
+    Entry &baseEntry(ThreadID tid, Addr pc);
+
+    /** Index of a load in a tagged table. */
+    Addr index(unsigned table, Addr pc, uint64_t ghist) const;
+
+    /** Tag of a load in a tagged table. */
+    Addr tag(unsigned table, Addr pc, uint64_t ghist) const;
+
+    /**
+     * Finds the tagged table with the longest history a load hits in.
+     * @return The table, or -1 if the load hits in none of them.
+     */
+    int provider(Addr pc, uint64_t ghist, int below) const;
+
+    /** Folds the youngest bits of a history into a number of bits. */
+    static Addr fold(uint64_t ghist, unsigned hist_len, unsigned bits);
+
+    /** The untagged last value table. */
+    std::vector<Entry> baseTable;
+
+    /** Mask to get the index bits of the last value table. */
+    const Addr baseIndexMask;
+
+    /** The tagged tables, from the shortest history up. */
+    std::vector<std::vector<Entry>> tables;
+
+    /** Global history length of each tagged table. */
+    std::vector<unsigned> histLengths;
+
+    /** Log2 of the number of entries of a tagged table. */
+    const unsigned logTableSize;
+
+    /** Number of tag bits. */
+    const unsigned tagBits;
+};
+
+} // namespace value_prediction
+} // namespace gem5
+
+#endif // __CPU_PRED_VTAGE_HH__
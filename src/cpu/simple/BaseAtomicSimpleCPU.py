@@ -61,6 +61,32 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    fetch_line_buffer = Param.Bool(
+        False,
+        "Serve instruction fetches that fall in the last fetched cache "
+        "line from a per-CPU copy of that line instead of the icache. "
+        "Intended for functional cache warming before switching to a "
+        "detailed CPU",
+    )
+    decoded_block_cache = Param.Bool(
+        False,
+        "Keep decoded instructions in blocks of consecutively executed "
+        "instructions keyed by physical PC, and execute them again without "
+        "fetching or decoding. Intended for fast-forwarding, as the icache "
+        "is not accessed for cached instructions",
+    )
+    decoded_block_cache_blocks = Param.Unsigned(
+        16384, "Number of decoded blocks kept before the cache is flushed"
+    )
+    decoded_block_insts = Param.Unsigned(
+        64, "Maximum number of instructions in a decoded block"
+    )
+    translation_cache_entries = Param.Unsigned(
+        0,
+        "Number of recent translations every thread reuses without going "
+        "through the MMU in syscall emulation mode, 0 to disable. The TLB "
+        "statistics then only count the accesses that miss in this cache",
+    )
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
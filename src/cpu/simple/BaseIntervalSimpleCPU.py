@@ -0,0 +1,56 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+from m5.objects.BaseAtomicSimpleCPU import BaseAtomicSimpleCPU
+from m5.objects.BranchPredictor import *
+from m5.params import *
+from m5.proxy import *
+
+
+class BaseIntervalSimpleCPU(BaseAtomicSimpleCPU):
+    """Atomic simple CPU which estimates the timing of an out-of-order
+    core with an interval model. Instructions dispatch width at a time,
+    and the CPU only stalls for instruction fetch and load misses seen in
+    the memory system and for branch mispredictions of its branch
+    predictor. Load misses within one reorder buffer of each other
+    overlap. This is meant for design space exploration where the
+    detailed CPUs are too slow, and it uses the 'atomic' memory mode."""
+
+    type = "BaseIntervalSimpleCPU"
+    cxx_header = "cpu/simple/interval.hh"
+    cxx_class = "gem5::IntervalSimpleCPU"
+
+    width = 4
+    branchPred = TournamentBP(numThreads=Parent.numThreads)
+
+    rob_size = Param.Unsigned(192, "Reorder buffer entries")
+    hidden_latency = Param.Cycles(
+        4, "Memory access latency the pipeline hides, e.g., the L1 latency"
+    )
+    branch_penalty = Param.Cycles(
+        12, "Front end refill and resolution time of a misprediction"
+    )
@@ -42,6 +42,7 @@
 #include "cpu/simple/atomic.hh"
 
 #include "arch/generic/decoder.hh"
+#include "arch/generic/isa_binding.hh"
 #include "base/output.hh"
 #include "cpu/exetrace.hh"
 #include "cpu/utils.hh"
@@ -78,16 +79,43 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      fetchLineBuffer(p.fetch_line_buffer), fetchBufferValid(false),
+      fetchBufferAddr(0), fetchBufferSecure(false),
+      decoderBypassed(p.numThreads, false), fillValid(false),
+      fillThread(0), fillPaddr(0), fillVaddr(0),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
-      ppCommit(nullptr)
+      ppCommit(nullptr), ppDataAccess(nullptr)
 {
     _status = Idle;
     ifetch_req = std::make_shared<Request>();
     data_read_req = std::make_shared<Request>();
     data_write_req = std::make_shared<Request>();
     data_amo_req = std::make_shared<Request>();
+
+    if (fetchLineBuffer)
+        fetchBufferData.resize(cacheLineSize());
+
+    if (p.translation_cache_entries) {
+        for (ThreadID tid = 0; tid < p.numThreads; ++tid) {
+            translationCaches.emplace_back(new TranslationCache(
+                        p.translation_cache_entries,
+                        p.system->getPageBytes()));
+        }
+    }
+
+    if (p.decoded_block_cache) {
+        fatal_if(p.decoded_block_cache_blocks == 0 ||
+                 p.decoded_block_insts == 0,
+                 "%s: the decoded block cache needs a non-zero size\n",
+                 name());
+        for (ThreadID tid = 0; tid < p.numThreads; ++tid) {
+            blockCaches.emplace_back(new DecodedBlockCache(
+                        p.decoded_block_cache_blocks,
+                        p.decoded_block_insts));
+        }
+    }
 }
 
 
@@ -148,6 +176,10 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    // Memory may have been modified behind our back while drained
+    invalidateFetchBuffer();
+    flushDecodedBlocks();
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -204,6 +236,9 @@ AtomicSimpleCPU::takeOverFrom(BaseCPU *old_cpu)
 {
     BaseSimpleCPU::takeOverFrom(old_cpu);
 
+    invalidateFetchBuffer();
+    flushDecodedBlocks();
+
     // The tick event should have been descheduled by drain()
     assert(!tickEvent.scheduled());
 }
@@ -298,6 +333,8 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
             t_info->thread->getIsaPtr()->handleLockedSnoop(pkt,
                     cacheBlockMask);
         }
+        cpu->snoopFetchBuffer(pkt);
+        cpu->snoopDecodedBlocks(pkt);
     }
 
     return 0;
@@ -325,6 +362,11 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
                     cacheBlockMask);
         }
     }
+
+    if (pkt->isInvalidate() || pkt->isWrite()) {
+        cpu->snoopFetchBuffer(pkt);
+        cpu->snoopDecodedBlocks(pkt);
+    }
 }
 
 bool
@@ -355,6 +397,26 @@ AtomicSimpleCPU::genMemFragmentRequest(const RequestPtr &req, Addr frag_addr,
     return predicate;
 }
 
+Fault
+AtomicSimpleCPU::translateAtomic(const RequestPtr &req, BaseMMU::Mode mode)
+{
+    SimpleThread *thread = threadInfo[curThread]->thread;
+    if (translationCaches.empty())
+        return bindIsa(thread->mmu)->translateAtomic(req, thread->getTC(),
+                                                    mode);
+
+    TranslationCache &cache = *translationCaches[curThread];
+    if (cache.translate(req, thread->getTC(), mode))
+        return NoFault;
+
+    const Request::Flags flags = req->getFlags();
+    Fault fault =
+        bindIsa(thread->mmu)->translateAtomic(req, thread->getTC(), mode);
+    if (fault == NoFault)
+        cache.insert(req, mode, flags);
+    return fault;
+}
+
 Fault
 AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
                          Request::Flags flags,
@@ -385,8 +447,7 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
 
         // translate to physical address
         if (predicate) {
-            fault = thread->mmu->translateAtomic(req, thread->getTC(),
-                                                 BaseMMU::Read);
+            fault = translateAtomic(req, BaseMMU::Read);
         }
 
         // Now do the access.
@@ -401,6 +462,9 @@ AtomicSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
                 dcache_latency += sendPacket(dcachePort, &pkt);
             }
             dcache_access = true;
+            ppDataAccess->notifyWith([&]() {
+                return std::make_pair(req->getPaddr(), false);
+            });
 
             panic_if(pkt.isError(), "Data fetch (%s) failed: %s",
                     pkt.getAddrRange().to_string(), pkt.print());
@@ -472,8 +536,7 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
         // translate to physical address
         if (predicate)
-            fault = thread->mmu->translateAtomic(req, thread->getTC(),
-                                                 BaseMMU::Write);
+            fault = translateAtomic(req, BaseMMU::Write);
 
         // Now do the access.
         if (predicate && fault == NoFault) {
@@ -503,8 +566,13 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
 
                     // Notify other threads on this CPU of write
                     threadSnoop(&pkt, curThread);
+                    snoopFetchBuffer(&pkt);
+                    snoopDecodedBlocks(&pkt);
                 }
                 dcache_access = true;
+                ppDataAccess->notifyWith([&]() {
+                    return std::make_pair(req->getPaddr(), true);
+                });
                 panic_if(pkt.isError(), "Data write (%s) failed: %s",
                         pkt.getAddrRange().to_string(), pkt.print());
                 if (req->isSwap()) {
@@ -576,8 +644,7 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
                  thread->pcState().instAddr(), std::move(amo_op));
 
     // translate to physical address
-    Fault fault = thread->mmu->translateAtomic(
-        req, thread->getTC(), BaseMMU::Write);
+    Fault fault = translateAtomic(req, BaseMMU::Write);
 
     // Now do the access.
     if (fault == NoFault && !req->getFlags().isSet(Request::NO_ACCESS)) {
@@ -590,9 +657,14 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
             dcache_latency += req->localAccessor(thread->getTC(), &pkt);
         } else {
             dcache_latency += sendPacket(dcachePort, &pkt);
+            snoopFetchBuffer(&pkt);
+            snoopDecodedBlocks(&pkt);
         }
 
         dcache_access = true;
+        ppDataAccess->notifyWith([&]() {
+            return std::make_pair(req->getPaddr(), true);
+        });
 
         panic_if(pkt.isError(), "Atomic access (%s) failed: %s",
                 pkt.getAddrRange().to_string(), pkt.print());
@@ -655,8 +727,7 @@ AtomicSimpleCPU::tick()
         if (needToFetch) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
-            fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
-                                                 BaseMMU::Execute);
+            fault = translateAtomic(ifetch_req, BaseMMU::Execute);
         }
 
         if (fault == NoFault) {
@@ -664,7 +735,13 @@ AtomicSimpleCPU::tick()
             bool icache_access = false;
             dcache_access = false; // assume no dcache access
 
-            if (needToFetch) {
+            // Instructions found in the decoded block cache are
+            // neither fetched nor decoded
+            const DecodedBlockCache::Inst *decoded = nullptr;
+            if (needToFetch && !blockCaches.empty())
+                decoded = lookupDecodedInst();
+
+            if (needToFetch && !decoded) {
                 // This is commented out because the decoder would act like
                 // a tiny cache otherwise. It wouldn't be flushed when needed
                 // like the I cache. It should be flushed, and when that works
@@ -677,7 +754,13 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            if (decoded) {
+                preExecute(decoded->staticInst, *decoded->decodedPC);
+            } else {
+                preExecute();
+                if (needToFetch && !blockCaches.empty())
+                    recordDecodedInst();
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
@@ -686,7 +769,9 @@ AtomicSimpleCPU::tick()
                 // keep an instruction count
                 if (fault == NoFault) {
                     countInst();
-                    ppCommit->notify(std::make_pair(thread, curStaticInst));
+                    ppCommit->notifyWith([&]() {
+                        return std::make_pair(thread, curStaticInst);
+                    });
                 } else if (traceData) {
                     traceFault();
                 }
@@ -708,11 +793,7 @@ AtomicSimpleCPU::tick()
                 instCnt++;
             }
 
-            if (simulate_inst_stalls && icache_access)
-                stall_ticks += icache_latency;
-
-            if (simulate_data_stalls && dcache_access)
-                stall_ticks += dcache_latency;
+            stall_ticks += instStallTicks(icache_access, icache_latency);
 
             if (stall_ticks) {
                 // the atomic cpu does its accounting in ticks, so
@@ -723,6 +804,18 @@ AtomicSimpleCPU::tick()
             }
 
         }
+
+        // Serializing instructions, system calls and faults are where
+        // modified code becomes architecturally visible
+        if (fault != NoFault || (curStaticInst &&
+                    (curStaticInst->isSerializing() ||
+                     curStaticInst->isSquashAfter() ||
+                     curStaticInst->isSyscall()))) {
+            invalidateFetchBuffer();
+            if (fault == NoFault)
+                flushDecodedBlocks();
+        }
+
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
@@ -738,9 +831,27 @@ AtomicSimpleCPU::tick()
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+Tick
+AtomicSimpleCPU::instStallTicks(bool icache_access, Tick icache_latency)
+{
+    Tick stall_ticks = 0;
+
+    if (simulate_inst_stalls && icache_access)
+        stall_ticks += icache_latency;
+
+    if (simulate_data_stalls && dcache_access)
+        stall_ticks += dcache_latency;
+
+    return stall_ticks;
+}
+
 Tick
 AtomicSimpleCPU::fetchInstMem()
 {
+    Tick latency = 0;
+    if (fetchLineBuffer && fetchFromLineBuffer(latency))
+        return latency;
+
     auto &decoder = threadInfo[curThread]->thread->decoder;
 
     Packet pkt = Packet(ifetch_req, MemCmd::ReadReq);
@@ -749,13 +860,176 @@ AtomicSimpleCPU::fetchInstMem()
     // directly into the CPU object's inst field.
     pkt.dataStatic(decoder->moreBytesPtr());
 
-    Tick latency = sendPacket(icachePort, &pkt);
+    latency = sendPacket(icachePort, &pkt);
     panic_if(pkt.isError(), "Instruction fetch (%s) failed: %s",
             pkt.getAddrRange().to_string(), pkt.print());
 
     return latency;
 }
 
+bool
+AtomicSimpleCPU::fetchFromLineBuffer(Tick &latency)
+{
+    // Only plain cacheable memory can be buffered
+    if (ifetch_req->isUncacheable() || ifetch_req->isStrictlyOrdered() ||
+            ifetch_req->isLocalAccess()) {
+        return false;
+    }
+
+    const Addr paddr = ifetch_req->getPaddr();
+    const unsigned size = ifetch_req->getSize();
+    const Addr line_addr = paddr & ~Addr(cacheLineSize() - 1);
+    if (paddr + size > line_addr + cacheLineSize())
+        return false;
+
+    if (!fetchBufferValid || fetchBufferAddr != line_addr ||
+            fetchBufferSecure != ifetch_req->isSecure()) {
+        auto req = std::make_shared<Request>(line_addr, cacheLineSize(),
+            ifetch_req->getFlags(), ifetch_req->requestorId());
+        req->setContext(ifetch_req->contextId());
+        req->taskId(ifetch_req->taskId());
+
+        Packet pkt(req, MemCmd::ReadReq);
+        pkt.dataStatic(fetchBufferData.data());
+
+        DPRINTF(SimpleCPU, "Refilling fetch line buffer with %#x\n",
+                line_addr);
+
+        latency = sendPacket(icachePort, &pkt);
+        if (pkt.isError()) {
+            // Let the regular fetch path access (and report) the
+            // narrower range on its own
+            invalidateFetchBuffer();
+            return false;
+        }
+
+        fetchBufferValid = true;
+        fetchBufferAddr = line_addr;
+        fetchBufferSecure = req->isSecure();
+    }
+
+    auto &decoder = threadInfo[curThread]->thread->decoder;
+    memcpy(decoder->moreBytesPtr(), &fetchBufferData[paddr - line_addr],
+           size);
+
+    return true;
+}
+
+void
+AtomicSimpleCPU::snoopFetchBuffer(const PacketPtr pkt)
+{
+    // Functional writes may cover more than one line
+    if (fetchBufferValid && pkt->isSecure() == fetchBufferSecure &&
+            pkt->getAddr() < fetchBufferAddr + cacheLineSize() &&
+            pkt->getAddr() + pkt->getSize() > fetchBufferAddr) {
+        DPRINTF(SimpleCPU, "Invalidating fetch line buffer at %#x\n",
+                fetchBufferAddr);
+        invalidateFetchBuffer();
+    }
+}
+
+const DecodedBlockCache::Inst *
+AtomicSimpleCPU::lookupDecodedInst()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread *thread = t_info.thread;
+
+    // The rest of an instruction that spans several fetch chunks
+    if (t_info.fetchOffset != 0)
+        return nullptr;
+
+    fillValid = false;
+
+    // Only plain cacheable memory holds code that can be reused
+    if (ifetch_req->isUncacheable() || ifetch_req->isStrictlyOrdered() ||
+            ifetch_req->isLocalAccess()) {
+        return nullptr;
+    }
+
+    const PCStateBase &pc = thread->pcState();
+    const Addr paddr =
+        ifetch_req->getPaddr() + (pc.instAddr() - ifetch_req->getVaddr());
+
+    const DecodedBlockCache::Inst *inst = blockCaches[curThread]->lookup(
+            paddr, pc, thread->decoder->contextGeneration());
+    if (inst) {
+        decoderBypassed[curThread] = true;
+        return inst;
+    }
+
+    // The decoder has not seen the cached instructions, so restart it
+    // at this instruction like after a fault
+    if (decoderBypassed[curThread]) {
+        thread->decoder->reset();
+        decoderBypassed[curThread] = false;
+    }
+
+    fillValid = true;
+    fillThread = curThread;
+    fillPaddr = ifetch_req->getPaddr();
+    fillVaddr = ifetch_req->getVaddr();
+    set(fillPC, pc);
+
+    return nullptr;
+}
+
+void
+AtomicSimpleCPU::recordDecodedInst()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread *thread = t_info.thread;
+
+    if (!fillValid || fillThread != curThread)
+        return;
+
+    // All chunks of an instruction have to be contiguous cacheable
+    // memory, as the block is invalidated by physical address
+    if (ifetch_req->getPaddr() - fillPaddr !=
+            ifetch_req->getVaddr() - fillVaddr ||
+            ifetch_req->isUncacheable() || ifetch_req->isStrictlyOrdered() ||
+            ifetch_req->isLocalAccess()) {
+        fillValid = false;
+        return;
+    }
+
+    // The decoder is waiting for the next chunk
+    if (t_info.stayAtPC)
+        return;
+
+    fillValid = false;
+
+    const StaticInstPtr &inst =
+        curMacroStaticInst ? curMacroStaticInst : curStaticInst;
+    if (!inst)
+        return;
+
+    const bool ends_block = inst->isControl() || inst->isSerializing() ||
+        inst->isSquashAfter() || inst->isSyscall();
+
+    blockCaches[curThread]->insert(
+            fillPaddr + (fillPC->instAddr() - fillVaddr),
+            ifetch_req->getPaddr() + ifetch_req->getSize(), *fillPC,
+            thread->pcState(), inst, ends_block);
+}
+
+void
+AtomicSimpleCPU::snoopDecodedBlocks(const PacketPtr pkt)
+{
+    for (auto &cache : blockCaches)
+        cache->invalidate(pkt->getAddr(), pkt->getAddr() + pkt->getSize());
+}
+
+void
+AtomicSimpleCPU::flushDecodedBlocks()
+{
+    for (auto &cache : blockCaches) {
+        if (!cache->empty())
+            DPRINTF(SimpleCPU, "Flushing decoded block cache\n");
+        cache->flush();
+    }
+    fillValid = false;
+}
+
 void
 AtomicSimpleCPU::regProbePoints()
 {
@@ -763,6 +1037,8 @@ AtomicSimpleCPU::regProbePoints()
 
     ppCommit = new ProbePointArg<std::pair<SimpleThread*, const StaticInstPtr>>
                                 (getProbeManager(), "Commit");
+    ppDataAccess = new ProbePointArg<std::pair<Addr, bool>>(
+            getProbeManager(), "DataAccess");
 }
 
 void
@@ -41,8 +41,13 @@
 #ifndef __CPU_SIMPLE_ATOMIC_HH__
 #define __CPU_SIMPLE_ATOMIC_HH__
 
+#include <memory>
+#include <vector>
+
 #include "cpu/simple/base.hh"
+#include "cpu/simple/decoded_block_cache.hh"
 #include "cpu/simple/exec_context.hh"
+#include "cpu/translation_cache.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
 #include "sim/probe/probe.hh"
@@ -67,6 +72,52 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     const bool simulate_data_stalls;
     const bool simulate_inst_stalls;
 
+    /**
+     * Keep a copy of the cache line instructions were last fetched from
+     * and serve the following fetches to that line from it. The icache
+     * then only sees the first fetch to each line, which leaves its tags
+     * and replacement state as they would otherwise be (the line was
+     * already the most recently used one in its set) while avoiding a
+     * trip through the memory system for every instruction. Hits in the
+     * buffer do not contribute icache stall cycles.
+     */
+    const bool fetchLineBuffer;
+
+    /** Whether fetchBufferData holds a valid line. */
+    bool fetchBufferValid;
+
+    /** Physical address of the buffered line. */
+    Addr fetchBufferAddr;
+
+    /** Security state of the buffered line. */
+    bool fetchBufferSecure;
+
+    /** Contents of the buffered line. */
+    std::vector<uint8_t> fetchBufferData;
+
+    /** Translation cache of every thread, empty when disabled. */
+    std::vector<std::unique_ptr<TranslationCache>> translationCaches;
+
+    /** Translate a request of the current thread. */
+    Fault translateAtomic(const RequestPtr &req, BaseMMU::Mode mode);
+
+    /** Decoded block cache of every thread, empty when disabled. */
+    std::vector<std::unique_ptr<DecodedBlockCache>> blockCaches;
+
+    /** Whether a thread executed cached instructions since it decoded. */
+    std::vector<bool> decoderBypassed;
+
+    /**
+     * The instruction that is being decoded after a decoded block cache
+     * miss, so that it can be added once decoded. The fetch addresses
+     * are those of its first chunk.
+     */
+    bool fillValid;
+    ThreadID fillThread;
+    Addr fillPaddr;
+    Addr fillVaddr;
+    std::unique_ptr<PCStateBase> fillPC;
+
     // main simulation loop (one cycle)
     void tick();
 
@@ -106,6 +157,68 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     virtual Tick sendPacket(RequestPort &port, const PacketPtr &pkt);
     virtual Tick fetchInstMem();
 
+    /**
+     * The ticks the CPU stalls for after the instruction it just
+     * executed, on top of the cycle it takes.
+     *
+     * @param icache_access Whether the instruction was fetched from the
+     *                      icache.
+     * @param icache_latency The latency of that fetch.
+     */
+    virtual Tick instStallTicks(bool icache_access, Tick icache_latency);
+
+    /**
+     * Try to serve the current instruction fetch from the fetch line
+     * buffer, refilling the buffer from the icache if the fetch falls in
+     * another line.
+     *
+     * @param latency Set to the latency of the refill, if any.
+     * @return Whether the fetch was served.
+     */
+    bool fetchFromLineBuffer(Tick &latency);
+
+    /** Drop the contents of the fetch line buffer. */
+    void invalidateFetchBuffer() { fetchBufferValid = false; }
+
+    /**
+     * Drop the contents of the fetch line buffer if a packet that may
+     * modify memory touches the buffered line. Instruction fetches do not
+     * observe snoops, so stores by this CPU and snoops seen by the data
+     * port are the only way writes to the line become visible; any other
+     * modification is picked up when a serializing instruction or a fault
+     * flushes the buffer, as the architectures require before modified
+     * code is executed.
+     *
+     * @param pkt Packet writing to or invalidating memory.
+     */
+    void snoopFetchBuffer(const PacketPtr pkt);
+
+    /**
+     * Look up the instruction about to be fetched in the decoded block
+     * cache of the current thread. On a miss, remember the instruction
+     * so that recordDecodedInst() can add it once it is decoded.
+     *
+     * @return The cached instruction, or nullptr if it has to be
+     * fetched and decoded.
+     */
+    const DecodedBlockCache::Inst *lookupDecodedInst();
+
+    /** Add the instruction that was just decoded to the block cache. */
+    void recordDecodedInst();
+
+    /**
+     * Drop the decoded blocks of all threads that overlap memory which a
+     * packet writes to or invalidates. Like the fetch line buffer, the
+     * decoded blocks rely on this and on the flushes at serializing
+     * instructions to see modified code.
+     *
+     * @param pkt Packet writing to or invalidating memory.
+     */
+    void snoopDecodedBlocks(const PacketPtr pkt);
+
+    /** Drop the decoded blocks of all threads. */
+    void flushDecodedBlocks();
+
     /**
      * An AtomicCPUPort overrides the default behaviour of the
      * recvAtomicSnoop and ignores the packet instead of panicking. It
@@ -141,7 +254,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     {
 
       public:
-        AtomicCPUDPort(const std::string &_name, BaseSimpleCPU *_cpu)
+        AtomicCPUDPort(const std::string &_name, AtomicSimpleCPU *_cpu)
             : AtomicCPUPort(_name), cpu(_cpu)
         {
             cacheBlockMask = ~(cpu->cacheLineSize() - 1);
@@ -151,7 +264,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
         Addr cacheBlockMask;
       protected:
-        BaseSimpleCPU *cpu;
+        AtomicSimpleCPU *cpu;
 
         virtual Tick recvAtomicSnoop(PacketPtr pkt);
         virtual void recvFunctionalSnoop(PacketPtr pkt);
@@ -173,6 +286,12 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     /** Probe Points. */
     ProbePointArg<std::pair<SimpleThread *, const StaticInstPtr>> *ppCommit;
 
+    /**
+     * Notified with the physical address of each data access, and whether
+     * it is a write, before the instruction making it commits.
+     */
+    ProbePointArg<std::pair<Addr, bool>> *ppDataAccess;
+
   protected:
 
     /** Return a reference to the data port. */
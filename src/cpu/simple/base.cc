@@ -42,6 +42,7 @@
 #include "cpu/simple/base.hh"
 
 #include "arch/generic/decoder.hh"
+#include "arch/generic/isa_binding.hh"
 #include "base/cprintf.hh"
 #include "base/inifile.hh"
 #include "base/loader/symtab.hh"
@@ -338,7 +339,7 @@ BaseSimpleCPU::preExecute()
     set(preExecuteTempPC, thread->pcState());
     auto &pc_state = *preExecuteTempPC;
 
-    auto &decoder = thread->decoder;
+    auto *decoder = bindIsa(thread->decoder);
 
     if (isRomMicroPC(pc_state.microPC())) {
         t_info.stayAtPC = false;
@@ -380,6 +381,38 @@ BaseSimpleCPU::preExecute()
         curStaticInst = curMacroStaticInst->fetchMicroop(pc_state.microPC());
     }
 
+    preExecuteDecoded();
+}
+
+void
+BaseSimpleCPU::preExecute(const StaticInstPtr &inst,
+                          const PCStateBase &decoded_pc)
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
+    t_info.setPredicate(true);
+    t_info.setMemAccPredicate(true);
+
+    t_info.stayAtPC = false;
+    thread->pcState(decoded_pc);
+
+    if (inst->isMacroop()) {
+        curMacroStaticInst = inst;
+        curStaticInst = inst->fetchMicroop(decoded_pc.microPC());
+    } else {
+        curStaticInst = inst;
+    }
+
+    preExecuteDecoded();
+}
+
+void
+BaseSimpleCPU::preExecuteDecoded()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread* thread = t_info.thread;
+
     //If we decoded an instruction this "tick", record information about it.
     if (curStaticInst) {
 #if TRACING_ON
@@ -524,6 +557,7 @@ BaseSimpleCPU::advancePC(const Fault &fault)
             branchPred->squash(cur_sn, thread->pcState(), branching,
                     curThread);
             ++t_info.execContextStats.numBranchMispred;
+            branchMispredicted = true;
         }
     }
 }
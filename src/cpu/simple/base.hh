@@ -86,6 +86,12 @@ class BaseSimpleCPU : public BaseCPU
     ThreadID curThread;
     branch_prediction::BPredUnit *branchPred;
 
+    /**
+     * Set when branchPred mispredicts a branch, for CPU models that
+     * account for mispredictions to clear.
+     */
+    bool branchMispredicted = false;
+
     void checkPcEventQueue();
     void swapActiveThread();
 
@@ -132,11 +138,28 @@ class BaseSimpleCPU : public BaseCPU
 
     std::unique_ptr<PCStateBase> preExecuteTempPC;
 
+    /**
+     * Trace, predict and count the instruction that was just put in
+     * curStaticInst.
+     */
+    void preExecuteDecoded();
+
   public:
     void checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
     void serviceInstCountEvents();
     void preExecute();
+
+    /**
+     * Prepare the execution of an instruction that was decoded
+     * earlier, which skips the decoder.
+     *
+     * @param inst The decoded instruction, possibly a macroop.
+     * @param decoded_pc The PC state the decoder produced with it.
+     */
+    void preExecute(const StaticInstPtr &inst,
+                    const PCStateBase &decoded_pc);
+
     void postExecute();
     void advancePC(const Fault &fault);
 
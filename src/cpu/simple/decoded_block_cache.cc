@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/decoded_block_cache.hh"
+
+#include <algorithm>
+
+#include "cpu/static_inst.hh"
+
+namespace gem5
+{
+
+DecodedBlockCache::DecodedBlockCache(size_t max_blocks,
+                                     size_t max_block_insts)
+    : maxBlocks(max_blocks), maxBlockInsts(max_block_insts)
+{
+}
+
+const DecodedBlockCache::Inst *
+DecodedBlockCache::lookup(Addr paddr, const PCStateBase &pc,
+                          uint64_t context_generation)
+{
+    if (context_generation != contextGeneration) {
+        flush();
+        contextGeneration = context_generation;
+        return nullptr;
+    }
+
+    if (!cur) {
+        auto it = blocks.find(paddr);
+        if (it == blocks.end())
+            return nullptr;
+        cur = &it->second;
+        pos = 0;
+    }
+
+    // Most of the time it is the next instruction in the block
+    if (pos < cur->insts.size()) {
+        const Inst &inst = cur->insts[pos];
+        if (inst.paddr == paddr && inst.prePC->equals(pc)) {
+            ++pos;
+            return &inst;
+        }
+    }
+
+    // Otherwise it may start the block that followed last time, or
+    // any other block
+    const bool at_end = pos == cur->insts.size();
+    Block *block = nullptr;
+    if (at_end && cur->next && cur->next->insts.front().paddr == paddr) {
+        block = cur->next;
+    } else {
+        auto it = blocks.find(paddr);
+        if (it != blocks.end())
+            block = &it->second;
+    }
+
+    if (!block || !block->insts.front().prePC->equals(pc))
+        return nullptr;
+
+    if (at_end && cur->closed)
+        cur->next = block;
+    cur = block;
+    pos = 1;
+    return &block->insts.front();
+}
+
+void
+DecodedBlockCache::insert(Addr paddr, Addr end, const PCStateBase &pre_pc,
+                          const PCStateBase &decoded_pc,
+                          const StaticInstPtr &inst, bool ends_block)
+{
+    Block *prev = cur && pos == cur->insts.size() ? cur : nullptr;
+
+    if (!prev || prev->closed) {
+        if (blocks.size() >= maxBlocks)
+            flush();
+        // A block that starts here with a different PC state is
+        // replaced
+        erase(paddr);
+        if (cur != prev)
+            prev = nullptr;
+
+        Block &block = blocks[paddr];
+        if (prev)
+            prev->next = &block;
+        cur = &block;
+    }
+
+    cur->insts.push_back(Inst{paddr, std::unique_ptr<PCStateBase>(
+                pre_pc.clone()), std::unique_ptr<PCStateBase>(
+                decoded_pc.clone()), inst});
+    registerPages(cur->insts.front().paddr, *cur, paddr, end);
+    cur->start = std::min(cur->start, paddr);
+    cur->end = std::max(cur->end, end);
+    pos = cur->insts.size();
+
+    if (ends_block || cur->insts.size() >= maxBlockInsts)
+        cur->closed = true;
+}
+
+void
+DecodedBlockCache::registerPages(Addr key, Block &block, Addr from, Addr to)
+{
+    for (Addr page = from >> PageShift; page <= (to - 1) >> PageShift;
+            ++page) {
+        if (std::find(block.pages.begin(), block.pages.end(), page) !=
+                block.pages.end()) {
+            continue;
+        }
+        block.pages.push_back(page);
+        pages[page].push_back(key);
+    }
+}
+
+void
+DecodedBlockCache::erase(Addr key)
+{
+    auto it = blocks.find(key);
+    if (it == blocks.end())
+        return;
+
+    Block &block = it->second;
+    for (Addr page : block.pages) {
+        auto page_it = pages.find(page);
+        auto &keys = page_it->second;
+        keys.erase(std::find(keys.begin(), keys.end(), key));
+        if (keys.empty())
+            pages.erase(page_it);
+    }
+
+    if (cur == &block)
+        cur = nullptr;
+    blocks.erase(it);
+
+    // Blocks are rarely dropped, so simply forget every link rather
+    // than track which ones pointed to the block
+    for (auto &other : blocks)
+        other.second.next = nullptr;
+}
+
+void
+DecodedBlockCache::invalidate(Addr start, Addr end)
+{
+    if (pages.empty() || end <= start)
+        return;
+
+    std::vector<Addr> victims;
+    for (Addr page = start >> PageShift; page <= (end - 1) >> PageShift;
+            ++page) {
+        auto page_it = pages.find(page);
+        if (page_it == pages.end())
+            continue;
+        for (Addr key : page_it->second) {
+            const Block &block = blocks.at(key);
+            if (block.start < end && block.end > start)
+                victims.push_back(key);
+        }
+    }
+
+    for (Addr key : victims)
+        erase(key);
+}
+
+void
+DecodedBlockCache::flush()
+{
+    blocks.clear();
+    pages.clear();
+    cur = nullptr;
+    pos = 0;
+}
+
+} // namespace gem5
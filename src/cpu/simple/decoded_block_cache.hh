@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_DECODED_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_DECODED_BLOCK_CACHE_HH__
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "arch/generic/pcstate.hh"
+#include "base/types.hh"
+#include "cpu/static_inst_fwd.hh"
+
+namespace gem5
+{
+
+/**
+ * A cache of decoded instructions for a simple CPU thread. The
+ * instructions are grouped in blocks of consecutively executed
+ * instructions that start at a physical address, and each block
+ * remembers the block that was executed after it, so straight-line
+ * code and loops are found without searching.
+ *
+ * An instruction is only reused if it is fetched from the same
+ * physical address with the same PC state, which accounts for page
+ * remapping and for ISA modes kept in the PC state. The owner flushes
+ * the cache when the decoding context of the decoder changes, and
+ * invalidates the physical ranges that are written to, which catches
+ * self-modifying code.
+ */
+class DecodedBlockCache
+{
+  public:
+    struct Inst
+    {
+        /** Physical address the instruction is fetched from. */
+        Addr paddr;
+        /** PC state before decoding, which must match for a hit. */
+        std::unique_ptr<PCStateBase> prePC;
+        /** PC state as updated by the decoder. */
+        std::unique_ptr<PCStateBase> decodedPC;
+        /** The decoded instruction, possibly a macroop. */
+        StaticInstPtr staticInst;
+    };
+
+  private:
+    struct Block
+    {
+        std::vector<Inst> insts;
+        /** Physical range the instructions were read from. */
+        Addr start = MaxAddr;
+        Addr end = 0;
+        /** Pages the block is registered in. */
+        std::vector<Addr> pages;
+        /** No more instructions are added once a block is closed. */
+        bool closed = false;
+        /** The block executed after this one the last time. */
+        Block *next = nullptr;
+    };
+
+    static constexpr unsigned PageShift = 12;
+
+    const size_t maxBlocks;
+    const size_t maxBlockInsts;
+
+    std::unordered_map<Addr, Block> blocks;
+
+    /** Start addresses of the blocks that use each physical page. */
+    std::unordered_map<Addr, std::vector<Addr>> pages;
+
+    /** The block the thread is executing or filling, if any. */
+    Block *cur = nullptr;
+
+    /** Position of the next expected instruction in the block. */
+    size_t pos = 0;
+
+    /** Generation of the decoding context of the instructions. */
+    uint64_t contextGeneration = 0;
+
+    void registerPages(Addr key, Block &block, Addr from, Addr to);
+
+    /** Drop the block with the given key and any links to it. */
+    void erase(Addr key);
+
+  public:
+    DecodedBlockCache(size_t max_blocks, size_t max_block_insts);
+
+    /**
+     * Look up the instruction at the given physical address. A hit
+     * also advances the position in the current block.
+     *
+     * @param paddr Physical address of the instruction.
+     * @param pc The PC state the instruction is fetched with.
+     * @param context_generation Generation of the decoding context.
+     * @return The cached instruction, or nullptr on a miss.
+     */
+    const Inst *lookup(Addr paddr, const PCStateBase &pc,
+                       uint64_t context_generation);
+
+    /**
+     * Add an instruction that was decoded after a miss. It extends
+     * the current block if it follows the last instruction of that
+     * block, and starts a new one otherwise.
+     *
+     * @param paddr Physical address of the instruction.
+     * @param end End of the physical range the instruction read.
+     * @param pre_pc PC state before decoding.
+     * @param decoded_pc PC state after decoding.
+     * @param inst The decoded instruction.
+     * @param ends_block Close the block after this instruction.
+     */
+    void insert(Addr paddr, Addr end, const PCStateBase &pre_pc,
+                const PCStateBase &decoded_pc, const StaticInstPtr &inst,
+                bool ends_block);
+
+    /** Drop the blocks that overlap a physical range. */
+    void invalidate(Addr start, Addr end);
+
+    /** Drop all blocks. */
+    void flush();
+
+    bool empty() const { return blocks.empty(); }
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_DECODED_BLOCK_CACHE_HH__
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/interval.hh"
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+IntervalSimpleCPU::IntervalSimpleCPU(const BaseIntervalSimpleCPUParams &p)
+    : AtomicSimpleCPU(p), robSize(p.rob_size),
+      hiddenLatency(p.hidden_latency), branchPenalty(p.branch_penalty),
+      robLeft(0), intervalStats(this)
+{
+    fatal_if(!branchPred, "%s: The interval CPU needs a branch predictor.",
+             name());
+}
+
+Tick
+IntervalSimpleCPU::instStallTicks(bool icache_access, Tick icache_latency)
+{
+    const Tick hidden = cyclesToTicks(hiddenLatency);
+    Cycles stall(0);
+
+    if (robLeft)
+        robLeft--;
+
+    // The misprediction was found when the previous instruction advanced
+    // the PC.
+    if (branchMispredicted) {
+        branchMispredicted = false;
+        stall += branchPenalty;
+        intervalStats.branchStallCycles += branchPenalty;
+    }
+
+    if (icache_access && icache_latency > hidden) {
+        Cycles cycles = ticksToCycles(icache_latency - hidden);
+        stall += cycles;
+        intervalStats.icacheStallCycles += cycles;
+    }
+
+    if (dcache_access && dcache_latency > hidden && curStaticInst &&
+            (curStaticInst->isLoad() || curStaticInst->isAtomic())) {
+        intervalStats.loadMisses++;
+        if (robLeft) {
+            intervalStats.overlappedLoadMisses++;
+        } else {
+            // Dispatch goes on until the reorder buffer is full, which
+            // hides part of the miss.
+            Cycles cycles = ticksToCycles(dcache_latency - hidden);
+            Cycles hidden_by_rob(divCeil(robSize, width));
+            if (cycles > hidden_by_rob) {
+                cycles = cycles - hidden_by_rob;
+                stall += cycles;
+                intervalStats.loadStallCycles += cycles;
+            }
+            robLeft = robSize;
+        }
+    }
+
+    return cyclesToTicks(stall);
+}
+
+IntervalSimpleCPU::IntervalStats::IntervalStats(statistics::Group *parent)
+    : statistics::Group(parent, "interval"),
+      ADD_STAT(icacheStallCycles, statistics::units::Cycle::get(),
+               "Cycles stalled on instruction fetch misses"),
+      ADD_STAT(branchStallCycles, statistics::units::Cycle::get(),
+               "Cycles stalled on branch mispredictions"),
+      ADD_STAT(loadStallCycles, statistics::units::Cycle::get(),
+               "Cycles stalled on load misses"),
+      ADD_STAT(loadMisses, statistics::units::Count::get(),
+               "Loads with a latency above the hidden latency"),
+      ADD_STAT(overlappedLoadMisses, statistics::units::Count::get(),
+               "Load misses overlapping with an earlier one")
+{
+}
+
+} // namespace gem5
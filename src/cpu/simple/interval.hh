@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_INTERVAL_HH__
+#define __CPU_SIMPLE_INTERVAL_HH__
+
+#include <cstdint>
+
+#include "base/statistics.hh"
+#include "cpu/simple/atomic.hh"
+#include "params/BaseIntervalSimpleCPU.hh"
+
+namespace gem5
+{
+
+/**
+ * An atomic CPU with an interval model of an out-of-order core's timing.
+ *
+ * Instructions dispatch width at a time, and the core only stalls on miss
+ * events, which are taken from the simulated memory system and branch
+ * predictor:
+ *
+ * - an instruction fetch latency above the hidden latency stalls fetch;
+ * - a branch misprediction costs the front end refill and the branch
+ *   resolution time, as a fixed penalty;
+ * - a load latency above the hidden latency stalls dispatch once the
+ *   reorder buffer fills behind the load. Load misses within one
+ *   reorder buffer of a miss that stalled dispatch overlap with it and
+ *   cost nothing on their own.
+ *
+ * Stores retire into a store buffer and never stall dispatch.
+ */
+class IntervalSimpleCPU : public AtomicSimpleCPU
+{
+  public:
+    IntervalSimpleCPU(const BaseIntervalSimpleCPUParams &p);
+
+  protected:
+    Tick instStallTicks(bool icache_access, Tick icache_latency) override;
+
+  private:
+    const uint64_t robSize;
+    const Cycles hiddenLatency;
+    const Cycles branchPenalty;
+
+    /** Instructions until the reorder buffer fills behind the last miss. */
+    uint64_t robLeft;
+
+    struct IntervalStats : public statistics::Group
+    {
+        IntervalStats(statistics::Group *parent);
+
+        statistics::Scalar icacheStallCycles;
+        statistics::Scalar branchStallCycles;
+        statistics::Scalar loadStallCycles;
+        statistics::Scalar loadMisses;
+        statistics::Scalar overlappedLoadMisses;
+    } intervalStats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_INTERVAL_HH__
@@ -0,0 +1,64 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+from m5.objects.Probe import ProbeListenerObject
+from m5.params import *
+
+
+class FunctionalFirstTiming(ProbeListenerObject):
+    """Estimates the timing of the instructions an atomic CPU commits with
+    a first order interval model, which runs on a separate host thread.
+    The manager has to be an AtomicSimpleCPU."""
+
+    type = "FunctionalFirstTiming"
+    cxx_header = "cpu/simple/probes/functional_first.hh"
+    cxx_class = "gem5::FunctionalFirstTiming"
+
+    queue_size = Param.Unsigned(
+        65536, "Instructions the model can fall behind the CPU by"
+    )
+
+    width = Param.Unsigned(4, "Instructions dispatched per cycle")
+    rob_size = Param.Unsigned(
+        192, "Instructions within which data misses overlap"
+    )
+    branch_penalty = Param.Cycles(14, "Branch misprediction penalty")
+    predictor_size = Param.Unsigned(
+        4096, "Number of gshare predictor counters (power of two)"
+    )
+
+    line_size = Param.Unsigned(64, "Cache line size in bytes")
+    icache_size = Param.MemorySize("32KiB", "Instruction cache size")
+    icache_assoc = Param.Unsigned(8, "Instruction cache associativity")
+    icache_miss_latency = Param.Cycles(
+        20, "Fetch stall of an instruction cache miss"
+    )
+    dcache_size = Param.MemorySize("32KiB", "Data cache size")
+    dcache_assoc = Param.Unsigned(8, "Data cache associativity")
+    dcache_miss_latency = Param.Cycles(
+        100, "Dispatch stall of a data cache load miss"
+    )
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/probes/functional_first.hh"
+
+#include <algorithm>
+#include <chrono>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+FunctionalFirstTiming::TagArray::TagArray(
+        uint64_t size, unsigned assoc, unsigned line_size) :
+    lineShift(floorLog2(line_size)), assoc(assoc),
+    setMask(size / line_size / assoc - 1),
+    lines(size / line_size, MaxAddr)
+{
+    fatal_if(!isPowerOf2(line_size) || !isPowerOf2(setMask + 1) ||
+             size % (line_size * assoc),
+             "Cache geometry must have a power of two number of sets and "
+             "line size.");
+}
+
+bool
+FunctionalFirstTiming::TagArray::access(Addr addr)
+{
+    const Addr line = addr >> lineShift;
+    auto set = lines.begin() + (line & setMask) * assoc;
+    auto found = std::find(set, set + assoc, line);
+    bool hit = found != set + assoc;
+    if (!hit)
+        found = set + assoc - 1;
+
+    // Move the line to the most recently used position.
+    std::rotate(set, found, found + 1);
+    *set = line;
+    return hit;
+}
+
+FunctionalFirstTiming::FunctionalFirstTiming(
+        const FunctionalFirstTimingParams &p) :
+    ProbeListenerObject(p),
+    width(p.width), robSize(p.rob_size), branchPenalty(p.branch_penalty),
+    icacheMissLatency(p.icache_miss_latency),
+    dcacheMissLatency(p.dcache_miss_latency),
+    lineShift(floorLog2(p.line_size)),
+    queue(p.queue_size), stopping(false), pushed(0), consumed(0),
+    pending{0, 0, 0},
+    icache(p.icache_size, p.icache_assoc, p.line_size),
+    dcache(p.dcache_size, p.dcache_assoc, p.line_size),
+    predictor(p.predictor_size, 1), history(0),
+    historyBits(ceilLog2(p.predictor_size)), lastFetchLine(MaxAddr),
+    slots(0), lastMissInst(0), missSeen(false),
+    stats(this)
+{
+    fatal_if(width == 0, "The dispatch width must not be zero.");
+    fatal_if(!isPowerOf2(p.predictor_size),
+             "The predictor size must be a power of two.");
+}
+
+FunctionalFirstTiming::~FunctionalFirstTiming()
+{
+    if (modelThread.joinable()) {
+        stopping.store(true, std::memory_order_release);
+        modelThread.join();
+    }
+}
+
+void
+FunctionalFirstTiming::init()
+{
+    ProbeListenerObject::init();
+    modelThread = std::thread(&FunctionalFirstTiming::modelMain, this);
+}
+
+void
+FunctionalFirstTiming::regProbeListeners()
+{
+    typedef ProbeListenerArg<FunctionalFirstTiming,
+            std::pair<SimpleThread *, const StaticInstPtr>> CommitListener;
+    typedef ProbeListenerArg<FunctionalFirstTiming, std::pair<Addr, bool>>
+        DataAccessListener;
+    listeners.push_back(new CommitListener(this, "Commit",
+                                           &FunctionalFirstTiming::commit));
+    listeners.push_back(new DataAccessListener(this, "DataAccess",
+            &FunctionalFirstTiming::dataAccess));
+}
+
+void
+FunctionalFirstTiming::commit(
+        const std::pair<SimpleThread *, const StaticInstPtr> &info)
+{
+    SimpleThread *thread = info.first;
+    const StaticInstPtr &inst = info.second;
+
+    pending.pc = thread->pcState().instAddr();
+    if (inst->isLoad())
+        pending.flags |= Load;
+    if (inst->isStore() || inst->isAtomic())
+        pending.flags |= Store;
+
+    // Branches are only looked at at the end of the macroop, where the
+    // PC state holds the next instruction. Microops branching within a
+    // macroop, like the ones of x86 string instructions, are not branches
+    // of the program.
+    if (!inst->isMicroop() || inst->isLastMicroop()) {
+        pending.flags |= InstEnd;
+        if (inst->isControl()) {
+            pending.flags |= Control;
+            if (inst->isCondCtrl())
+                pending.flags |= CondControl;
+            if (thread->pcState().branching())
+                pending.flags |= Taken;
+        }
+    }
+
+    push(pending);
+    pending = {0, 0, 0};
+}
+
+void
+FunctionalFirstTiming::dataAccess(const std::pair<Addr, bool> &access)
+{
+    // Accesses split across lines only count once.
+    if (!(pending.flags & DataAccess)) {
+        pending.dataAddr = access.first;
+        pending.flags |= DataAccess;
+    }
+}
+
+void
+FunctionalFirstTiming::push(const Entry &entry)
+{
+    while (!queue.tryPush(entry))
+        std::this_thread::yield();
+    pushed++;
+}
+
+void
+FunctionalFirstTiming::sync()
+{
+    while (consumed.load(std::memory_order_acquire) != pushed)
+        std::this_thread::yield();
+}
+
+void
+FunctionalFirstTiming::modelMain()
+{
+    unsigned idle = 0;
+    for (;;) {
+        // Everything pushed before stopping was set is in the queue once
+        // stopping is seen, so drain it before checking.
+        bool stop = stopping.load(std::memory_order_acquire);
+
+        Entry entry;
+        uint64_t count = consumed.load(std::memory_order_relaxed);
+        bool any = false;
+        while (queue.tryPop(entry)) {
+            model(entry);
+            consumed.store(++count, std::memory_order_release);
+            any = true;
+        }
+
+        if (stop)
+            return;
+
+        if (any) {
+            idle = 0;
+        } else if (++idle < 1000) {
+            std::this_thread::yield();
+        } else {
+            // The simulation is busy elsewhere, stop spinning.
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+}
+
+void
+FunctionalFirstTiming::model(const Entry &entry)
+{
+    if (entry.flags & InstEnd) {
+        totals.insts++;
+        if (++slots == width) {
+            slots = 0;
+            totals.cycles++;
+        }
+
+        Addr line = entry.pc >> lineShift;
+        if (line != lastFetchLine) {
+            lastFetchLine = line;
+            if (!icache.access(entry.pc)) {
+                totals.icacheMisses++;
+                totals.cycles += icacheMissLatency;
+            }
+        }
+
+        // Unconditional branches are assumed to hit in the BTB.
+        if (entry.flags & CondControl) {
+            totals.condBranches++;
+            const bool taken = entry.flags & Taken;
+            uint8_t &counter = predictor[
+                ((entry.pc >> 1) ^ history) & (predictor.size() - 1)];
+            if ((counter >= 2) != taken) {
+                totals.mispredicts++;
+                totals.cycles += branchPenalty;
+            }
+            if (taken && counter < 3)
+                counter++;
+            else if (!taken && counter > 0)
+                counter--;
+            history = ((history << 1) | taken) & mask(historyBits);
+        }
+    }
+
+    if (entry.flags & DataAccess) {
+        // Stores retire into a store buffer and don't stall dispatch.
+        if (!dcache.access(entry.dataAddr) && (entry.flags & Load)) {
+            totals.dcacheMisses++;
+            if (missSeen && totals.insts - lastMissInst < robSize) {
+                totals.overlappedMisses++;
+            } else {
+                totals.cycles += dcacheMissLatency;
+                lastMissInst = totals.insts;
+                missSeen = true;
+            }
+        }
+    }
+}
+
+DrainState
+FunctionalFirstTiming::drain()
+{
+    sync();
+    return DrainState::Drained;
+}
+
+void
+FunctionalFirstTiming::preDumpStats()
+{
+    ProbeListenerObject::preDumpStats();
+
+    sync();
+    stats.insts = totals.insts - base.insts;
+    stats.cycles = totals.cycles - base.cycles;
+    stats.condBranches = totals.condBranches - base.condBranches;
+    stats.mispredicts = totals.mispredicts - base.mispredicts;
+    stats.icacheMisses = totals.icacheMisses - base.icacheMisses;
+    stats.dcacheMisses = totals.dcacheMisses - base.dcacheMisses;
+    stats.overlappedMisses = totals.overlappedMisses - base.overlappedMisses;
+}
+
+void
+FunctionalFirstTiming::resetStats()
+{
+    ProbeListenerObject::resetStats();
+
+    sync();
+    base = totals;
+}
+
+FunctionalFirstTiming::FunctionalFirstStats::FunctionalFirstStats(
+        statistics::Group *parent) :
+    statistics::Group(parent),
+    ADD_STAT(insts, statistics::units::Count::get(),
+             "Number of instructions modeled"),
+    ADD_STAT(cycles, statistics::units::Cycle::get(),
+             "Estimated number of cycles"),
+    ADD_STAT(condBranches, statistics::units::Count::get(),
+             "Number of conditional branches"),
+    ADD_STAT(mispredicts, statistics::units::Count::get(),
+             "Number of mispredicted conditional branches"),
+    ADD_STAT(icacheMisses, statistics::units::Count::get(),
+             "Number of instruction cache misses"),
+    ADD_STAT(dcacheMisses, statistics::units::Count::get(),
+             "Number of data cache load misses"),
+    ADD_STAT(overlappedMisses, statistics::units::Count::get(),
+             "Number of load misses overlapping with an earlier one"),
+    ADD_STAT(cpi, statistics::units::Rate<
+                statistics::units::Cycle, statistics::units::Count>::get(),
+             "Estimated cycles per instruction", cycles / insts),
+    ADD_STAT(mpki, statistics::units::Rate<
+                statistics::units::Count, statistics::units::Count>::get(),
+             "Mispredictions per thousand instructions",
+             mispredicts * 1000 / insts)
+{
+    cpi.precision(6);
+}
+
+} // namespace gem5
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_PROBES_FUNCTIONAL_FIRST_HH__
+#define __CPU_SIMPLE_PROBES_FUNCTIONAL_FIRST_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "base/spsc_queue.hh"
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/simple_thread.hh"
+#include "cpu/static_inst.hh"
+#include "params/FunctionalFirstTiming.hh"
+#include "sim/probe/probe.hh"
+
+namespace gem5
+{
+
+/**
+ * Functional first timing estimation for an atomic CPU.
+ *
+ * The CPU executes the program functionally, and this listener turns the
+ * instructions it commits into a stream of records with resolved branch
+ * outcomes and data addresses. A separate host thread consumes the stream
+ * through a lock free queue and runs a first order interval model over
+ * it: instructions dispatch at a fixed width, and the dispatch stalls for
+ * branch mispredictions and cache misses, with data misses overlapping
+ * when they are within one reorder buffer of each other.
+ *
+ * The functional simulation only waits for the model when the queue is
+ * full, and the statistics are brought up to date whenever they are
+ * dumped or reset.
+ */
+class FunctionalFirstTiming : public ProbeListenerObject
+{
+  public:
+    FunctionalFirstTiming(const FunctionalFirstTimingParams &params);
+    ~FunctionalFirstTiming();
+
+    void init() override;
+    void regProbeListeners() override;
+
+    DrainState drain() override;
+    void preDumpStats() override;
+    void resetStats() override;
+
+  private:
+    enum EntryFlags : uint8_t
+    {
+        InstEnd = 1 << 0,
+        Load = 1 << 1,
+        Store = 1 << 2,
+        Control = 1 << 3,
+        CondControl = 1 << 4,
+        Taken = 1 << 5,
+        DataAccess = 1 << 6,
+    };
+
+    /** A committed instruction, or microop, in the stream. */
+    struct Entry
+    {
+        Addr pc;
+        Addr dataAddr;
+        uint8_t flags;
+    };
+
+    /** Record a committed instruction, on the simulation thread. */
+    void commit(const std::pair<SimpleThread *, const StaticInstPtr> &info);
+    /** Record a data access of the instruction being executed. */
+    void dataAccess(const std::pair<Addr, bool> &access);
+
+    void push(const Entry &entry);
+    /** Wait until the model has consumed every entry pushed so far. */
+    void sync();
+    /** The model, on its own thread. */
+    void modelMain();
+    void model(const Entry &entry);
+
+    /** A set associative cache with LRU replacement, tags only. */
+    class TagArray
+    {
+      private:
+        const unsigned lineShift;
+        const unsigned assoc;
+        const Addr setMask;
+        /** The line addresses of each set, most recently used first. */
+        std::vector<Addr> lines;
+
+      public:
+        TagArray(uint64_t size, unsigned assoc, unsigned line_size);
+
+        /** Access a line, returning whether it hit. */
+        bool access(Addr addr);
+    };
+
+    /** The results of the model, across all of the simulation. */
+    struct Totals
+    {
+        uint64_t insts = 0;
+        uint64_t cycles = 0;
+        uint64_t condBranches = 0;
+        uint64_t mispredicts = 0;
+        uint64_t icacheMisses = 0;
+        uint64_t dcacheMisses = 0;
+        uint64_t overlappedMisses = 0;
+    };
+
+    const unsigned width;
+    const unsigned robSize;
+    const Cycles branchPenalty;
+    const Cycles icacheMissLatency;
+    const Cycles dcacheMissLatency;
+    const unsigned lineShift;
+
+    SPSCQueue<Entry> queue;
+    std::thread modelThread;
+    std::atomic<bool> stopping;
+    /** Entries pushed, only updated by the simulation thread. */
+    uint64_t pushed;
+    /** Entries consumed by the model. */
+    std::atomic<uint64_t> consumed;
+
+    /** The entry of the instruction being executed. */
+    Entry pending;
+
+    /** Model state, only touched by the model thread. */
+    TagArray icache;
+    TagArray dcache;
+    std::vector<uint8_t> predictor;
+    uint64_t history;
+    const unsigned historyBits;
+    Addr lastFetchLine;
+    /** Dispatch slots used in the current cycle. */
+    unsigned slots;
+    /** The instruction count of the last data miss that was paid for. */
+    uint64_t lastMissInst;
+    bool missSeen;
+    Totals totals;
+
+    /** The totals when the statistics were last reset. */
+    Totals base;
+
+    struct FunctionalFirstStats : public statistics::Group
+    {
+        FunctionalFirstStats(statistics::Group *parent);
+
+        statistics::Scalar insts;
+        statistics::Scalar cycles;
+        statistics::Scalar condBranches;
+        statistics::Scalar mispredicts;
+        statistics::Scalar icacheMisses;
+        statistics::Scalar dcacheMisses;
+        statistics::Scalar overlappedMisses;
+        statistics::Formula cpi;
+        statistics::Formula mpki;
+    } stats;
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_PROBES_FUNCTIONAL_FIRST_HH__
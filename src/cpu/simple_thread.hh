@@ -46,6 +46,7 @@
 #include <vector>
 
 #include "arch/generic/htm.hh"
+#include "arch/generic/isa_binding.hh"
 #include "arch/generic/mmu.hh"
 #include "arch/generic/pcstate.hh"
 #include "arch/generic/tlb.hh"
@@ -90,7 +91,7 @@ class CheckerCPU;
  * examples.
  */
 
-class SimpleThread : public ThreadState, public ThreadContext
+class SimpleThread final : public ThreadState, public ThreadContext
 {
   public:
     typedef ThreadContext::Status Status;
@@ -268,25 +269,25 @@ class SimpleThread : public ThreadState, public ThreadContext
     RegVal
     readMiscRegNoEffect(RegIndex misc_reg) const override
     {
-        return isa->readMiscRegNoEffect(misc_reg);
+        return bindIsa(isa)->readMiscRegNoEffect(misc_reg);
     }
 
     RegVal
     readMiscReg(RegIndex misc_reg) override
     {
-        return isa->readMiscReg(misc_reg);
+        return bindIsa(isa)->readMiscReg(misc_reg);
     }
 
     void
     setMiscRegNoEffect(RegIndex misc_reg, RegVal val) override
     {
-        return isa->setMiscRegNoEffect(misc_reg, val);
+        return bindIsa(isa)->setMiscRegNoEffect(misc_reg, val);
     }
 
     void
     setMiscReg(RegIndex misc_reg, RegVal val) override
     {
-        return isa->setMiscReg(misc_reg, val);
+        return bindIsa(isa)->setMiscReg(misc_reg, val);
     }
 
     unsigned readStCondFailures() const override { return storeCondFailures; }
@@ -36,6 +36,7 @@
 from m5.objects.ClockedObject import ClockedObject
 from m5.params import *
 from m5.proxy import *
+from m5.SimObject import *
 
 
 # Types of Stream Generators.
@@ -60,9 +61,20 @@ class BaseTrafficGen(ClockedObject):
     cxx_header = "cpu/testers/traffic_gen/traffic_gen.hh"
     cxx_class = "gem5::BaseTrafficGen"
 
+    cxx_exports = [
+        PyBindMethod("takeOverFrom"),
+    ]
+
     # Port used for sending requests and receiving responses
     port = RequestPort("This port sends requests and receives responses")
 
+    # A switched out generator leaves its port unconnected, and takes
+    # over the data port of a CPU when m5.switchCpusToGenerators switches
+    # the CPU out
+    switched_out = Param.Bool(
+        False, "Leave the port unconnected until taking over from a CPU"
+    )
+
     # System used to determine the mode of the memory system
     system = Param.System(Parent.any, "System this generator is part of")
 
@@ -79,6 +91,20 @@ class BaseTrafficGen(ClockedObject):
         0, "Maximum number of outstanding requests"
     )
 
+    # Closed-loop trace replay. Each request of a trace waits for the
+    # response to the request trace_window requests before it, and is then
+    # issued after the think time it had in the trace. The think times
+    # exclude the time the recorded requests are assumed to have waited
+    # for the recorded memory system, whose latency is
+    # trace_recorded_latency. Set trace_window to 0 to replay traces at
+    # their recorded ticks.
+    trace_window = Param.Unsigned(
+        0, "Outstanding requests of a closed-loop trace replay"
+    )
+    trace_recorded_latency = Param.Latency(
+        "0ns", "Memory latency of the system the traces were recorded on"
+    )
+
     # Let the user know if we have waited for a retry and not made any
     # progress for a long period of time. The default value is
     # somewhat arbitrary and may well have to be tuned.
@@ -76,6 +76,9 @@ BaseTrafficGen::BaseTrafficGen(const BaseTrafficGenParams &p)
       nextTransitionTick(0),
       nextPacketTick(0),
       maxOutstandingReqs(p.max_outstanding_reqs),
+      traceWindow(p.trace_window),
+      traceRecordedLatency(p.trace_recorded_latency),
+      switchedOut(p.switched_out),
       port(name() + ".port", *this),
       retryPkt(NULL),
       retryPktTick(0), blockedWaitingResp(false),
@@ -105,10 +108,22 @@ BaseTrafficGen::init()
 {
     ClockedObject::init();
 
-    if (!port.isConnected())
+    if (!switchedOut && !port.isConnected())
         fatal("The port of %s is not connected!\n", name());
 }
 
+void
+BaseTrafficGen::takeOverFrom(BaseCPU *cpu)
+{
+    fatal_if(!switchedOut, "%s is not switched out and cannot take over "
+             "from %s.\n", name(), cpu->name());
+    fatal_if(!cpu->switchedOut(), "%s must be switched out before %s "
+             "takes over from it.\n", cpu->name(), name());
+
+    port.takeOverFrom(&cpu->getDataPort());
+    switchedOut = false;
+}
+
 DrainState
 BaseTrafficGen::drain()
 {
@@ -212,6 +227,7 @@ BaseTrafficGen::update()
                 warn("%s suppressed %d packets with non-memory addresses\n",
                      name(), stats.numSuppressed.value());
 
+            activeGenerator->packetDone(pkt);
             delete pkt;
             pkt = nullptr;
         }
@@ -260,13 +276,18 @@ BaseTrafficGen::scheduleUpdate()
     // Has the generator run out of work? In that case, force a
     // transition if a transition period hasn't been configured.
     while (activeGenerator &&
-           nextPacketTick == MaxTick && nextTransitionTick == MaxTick) {
+           nextPacketTick == MaxTick && nextTransitionTick == MaxTick &&
+           !activeGenerator->waitingForResponse()) {
         transition();
     }
 
     if (!activeGenerator)
         return;
 
+    // A generator waiting for a response is woken up when it arrives
+    if (nextPacketTick == MaxTick && nextTransitionTick == MaxTick)
+        return;
+
     // schedule next update event based on either the next execute
     // tick or the next transition, which ever comes first
     const Tick nextEventTick = std::min(nextPacketTick, nextTransitionTick);
@@ -549,7 +570,8 @@ BaseTrafficGen::createTrace(Tick duration,
 {
 #if HAVE_PROTOBUF
     return std::shared_ptr<BaseGen>(
-        new TraceGen(*this, requestorId, duration, trace_file, addr_offset));
+        new TraceGen(*this, requestorId, duration, trace_file, addr_offset,
+                     traceWindow, traceRecordedLatency));
 #else
     panic("Can't instantiate trace generation without Protobuf support!\n");
 #endif
@@ -578,6 +600,9 @@ BaseTrafficGen::recvTimingResp(PacketPtr pkt)
 
     waitingResp.erase(iter);
 
+    if (activeGenerator)
+        activeGenerator->packetDone(pkt);
+
     delete pkt;
 
     // Sends up the request if we were blocked
@@ -586,6 +611,18 @@ BaseTrafficGen::recvTimingResp(PacketPtr pkt)
         retryReq();
     }
 
+    // The generator may have been waiting for this response to know
+    // when its next packet is due
+    if (activeGenerator && retryPkt == NULL && nextPacketTick == MaxTick &&
+        drainState() == DrainState::Running) {
+        nextPacketTick = activeGenerator->nextPacketTick(elasticReq, 0);
+        if (nextPacketTick != MaxTick) {
+            if (updateEvent.scheduled())
+                deschedule(updateEvent);
+            scheduleUpdate();
+        }
+    }
+
     return true;
 }
 
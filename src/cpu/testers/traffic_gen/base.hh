@@ -43,6 +43,7 @@
 #include <unordered_map>
 
 #include "base/statistics.hh"
+#include "cpu/base.hh"
 #include "enums/AddrMap.hh"
 #include "mem/qport.hh"
 #include "sim/clocked_object.hh"
@@ -125,6 +126,18 @@ class BaseTrafficGen : public ClockedObject
 
     const int maxOutstandingReqs;
 
+    /**
+     * Closed-loop replay of traces: the number of outstanding requests
+     * the trace generators model, or 0 for an open-loop replay.
+     */
+    const unsigned traceWindow;
+
+    /** Latency of the memory system the traces were recorded with */
+    const Tick traceRecordedLatency;
+
+    /** Set while the port waits to take over the one of a CPU */
+    bool switchedOut;
+
 
     /** Request port specialisation for the traffic generator */
     class TrafficGenPort : public RequestPort
@@ -253,6 +266,15 @@ class BaseTrafficGen : public ClockedObject
 
     DrainState drain() override;
 
+    /**
+     * Take over the data port of a switched out CPU, to replay traffic
+     * into the memory system the CPU was connected to. The generator
+     * must have been created with switched_out set.
+     *
+     * @param cpu CPU whose data port to take over
+     */
+    void takeOverFrom(BaseCPU *cpu);
+
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
 
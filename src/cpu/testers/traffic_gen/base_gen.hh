@@ -137,6 +137,25 @@ class BaseGen
      */
     virtual Tick nextPacketTick(bool elastic, Tick delay) const = 0;
 
+    /**
+     * Called when the traffic generator is done with a packet of this
+     * generator, either because its response was received, or because
+     * the packet was suppressed. By default do nothing.
+     *
+     * @param pkt The packet, which is deleted after the call
+     */
+    virtual void packetDone(const Packet *pkt) { }
+
+    /**
+     * Check if the generator waits for the response to an earlier
+     * packet before it can tell when its next packet is due. The
+     * generator then returns MaxTick from nextPacketTick, without
+     * being out of work.
+     *
+     * @return true if the next packet depends on a response
+     */
+    virtual bool waitingForResponse() const { return false; }
+
 };
 
 class StochasticGen : public BaseGen
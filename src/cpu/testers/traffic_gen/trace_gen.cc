@@ -37,29 +37,129 @@
 
 #include "cpu/testers/traffic_gen/trace_gen.hh"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
 
 #include "base/trace.hh"
 #include "debug/TrafficGen.hh"
 #include "proto/packet.pb.h"
+#include "sim/byteswap.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
 
 namespace gem5
 {
 
+namespace
+{
+
+/** Number of records of a binary trace to read ahead of the replay */
+constexpr size_t PrefetchRecords = 1 << 18;
+
+// util/packet_trace_to_binary.py writes these layouts
+static_assert(sizeof(TraceGen::BinaryHeader) == 32);
+static_assert(sizeof(TraceGen::BinaryRecord) == 32);
+
+} // anonymous namespace
+
 TraceGen::InputStream::InputStream(const std::string& filename)
-    : trace(filename)
+    : mapped(nullptr), mappedSize(0), records(nullptr), numRecords(0),
+      recordSize(0), nextRecord(0), prefetched(0)
 {
-    init();
+    // Binary traces start with their own magic number, anything else
+    // is parsed as a, possibly compressed, protobuf trace
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    fatal_if(fd < 0, "Failed to open trace %s: %s\n", filename,
+             strerror(errno));
+    char magic[sizeof(BinaryMagic)];
+    bool binary = ::read(fd, magic, sizeof(magic)) == sizeof(magic) &&
+        std::equal(magic, magic + sizeof(magic), BinaryMagic);
+
+    if (binary) {
+        mapBinary(filename, fd);
+    } else {
+        trace = std::make_unique<ProtoInputStream>(filename);
+        init();
+    }
+    ::close(fd);
+}
+
+TraceGen::InputStream::~InputStream()
+{
+    if (mapped)
+        munmap(mapped, mappedSize);
+}
+
+void
+TraceGen::InputStream::mapBinary(const std::string& filename, int fd)
+{
+    struct stat file_stat;
+    fatal_if(fstat(fd, &file_stat) != 0, "Cannot stat trace %s: %s\n",
+             filename, strerror(errno));
+    mappedSize = file_stat.st_size;
+    fatal_if(mappedSize < sizeof(BinaryHeader),
+             "Binary trace %s is truncated\n", filename);
+
+    mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    fatal_if(mapped == MAP_FAILED, "Failed to map trace %s: %s\n",
+             filename, strerror(errno));
+    // The records are read once, in order
+    madvise(mapped, mappedSize, MADV_SEQUENTIAL);
+
+    BinaryHeader header;
+    std::memcpy(&header, mapped, sizeof(header));
+    fatal_if(letoh(header.version) != BinaryVersion,
+             "Binary trace %s has version %d, expected %d\n", filename,
+             letoh(header.version), BinaryVersion);
+    fatal_if(letoh(header.tickFreq) != sim_clock::Frequency,
+             "Trace was recorded with a different tick frequency %d\n",
+             letoh(header.tickFreq));
+
+    recordSize = letoh(header.recordSize);
+    numRecords = letoh(header.numRecords);
+    fatal_if(recordSize < sizeof(BinaryRecord),
+             "Binary trace %s has records of %d bytes, expected at least "
+             "%d\n", filename, recordSize, sizeof(BinaryRecord));
+    fatal_if((mappedSize - sizeof(header)) / recordSize < numRecords,
+             "Binary trace %s is truncated\n", filename);
+
+    records = (const uint8_t *)mapped + sizeof(header);
+    prefetch();
+}
+
+void
+TraceGen::InputStream::prefetch()
+{
+    // Keep at least half of the read ahead window in front of the
+    // replay, so that the replay does not wait on page faults
+    if (prefetched >= numRecords ||
+        prefetched > nextRecord + PrefetchRecords / 2)
+        return;
+
+    const size_t page_size = sysconf(_SC_PAGESIZE);
+    const size_t end = std::min(numRecords, nextRecord + PrefetchRecords);
+    const uintptr_t start_addr = (uintptr_t)(records +
+        std::max(prefetched, nextRecord) * recordSize) & ~(page_size - 1);
+    const uintptr_t end_addr = (uintptr_t)(records + end * recordSize);
+    madvise((void *)start_addr, end_addr - start_addr, MADV_WILLNEED);
+    prefetched = end;
 }
 
 void
 TraceGen::InputStream::init()
 {
+    if (!trace)
+        return;
+
     // Create a protobuf message for the header and read it from the stream
     ProtoMessage::PacketHeader header_msg;
-    if (!trace.read(header_msg)) {
+    if (!trace->read(header_msg)) {
         panic("Failed to read packet header from trace\n");
     } else if (header_msg.tick_freq() != sim_clock::Frequency) {
         panic("Trace was recorded with a different tick frequency %d\n",
@@ -70,15 +170,39 @@ TraceGen::InputStream::init()
 void
 TraceGen::InputStream::reset()
 {
-    trace.reset();
+    if (!trace) {
+        nextRecord = 0;
+        prefetched = 0;
+        prefetch();
+        return;
+    }
+
+    trace->reset();
     init();
 }
 
 bool
 TraceGen::InputStream::read(TraceElement& element)
 {
+    if (!trace) {
+        if (nextRecord == numRecords)
+            return false;
+
+        BinaryRecord rec;
+        std::memcpy(&rec, records + nextRecord * recordSize, sizeof(rec));
+        ++nextRecord;
+        prefetch();
+
+        element.cmd = letoh(rec.cmd);
+        element.addr = letoh(rec.addr);
+        element.blocksize = letoh(rec.size);
+        element.tick = letoh(rec.tick);
+        element.flags = letoh(rec.flags);
+        return true;
+    }
+
     ProtoMessage::Packet pkt_msg;
-    if (trace.read(pkt_msg)) {
+    if (trace->read(pkt_msg)) {
         element.cmd = pkt_msg.cmd();
         element.addr = pkt_msg.addr();
         element.blocksize = pkt_msg.size();
@@ -104,6 +228,26 @@ TraceGen::nextPacketTick(bool elastic, Tick delay) const
 
     assert(nextElement.isValid());
 
+    if (window && numIssued) {
+        // the stalls of an elastic replay are already part of when the
+        // last request was issued
+        Tick ready = lastIssue;
+        if (numIssued >= window) {
+            const Tick done = doneTicks[numIssued % window];
+            if (done == MaxTick) {
+                DPRINTF(TrafficGen, "Next packet waits for request %d\n",
+                        numIssued - window);
+                return MaxTick;
+            }
+            ready = std::max(ready, done);
+        }
+
+        DPRINTF(TrafficGen, "Next packet tick is %d\n",
+                ready + nextElement.think);
+
+        return std::max(ready + nextElement.think, curTick());
+    }
+
     DPRINTF(TrafficGen, "Next packet tick is %d\n", tickOffset +
             nextElement.tick);
 
@@ -122,9 +266,31 @@ TraceGen::enter()
 
     // clear everything
     currElement.clear();
+    numRead = 0;
+    numIssued = 0;
+    outstanding.clear();
 
     // read the first element in the file and set the complete flag
+    readNext();
+}
+
+void
+TraceGen::readNext()
+{
     traceComplete = !trace.read(nextElement);
+    if (traceComplete || !window)
+        return;
+
+    const uint64_t i = numRead++;
+    Tick ready = i ? lastRecordedTick : nextElement.tick;
+    if (i >= window)
+        ready = std::max(ready, recordedTicks[i % window] + recordedLatency);
+
+    nextElement.think = nextElement.tick > ready ?
+        nextElement.tick - ready : 0;
+
+    recordedTicks[i % window] = nextElement.tick;
+    lastRecordedTick = nextElement.tick;
 }
 
 PacketPtr
@@ -135,7 +301,7 @@ TraceGen::getNextPacket()
     nextElement.clear();
 
     // read the next element and set the complete flag
-    traceComplete = !trace.read(nextElement);
+    readNext();
 
     // it is the responsibility of the traceComplete flag to ensure we
     // always have a valid element here
@@ -152,6 +318,17 @@ TraceGen::getNextPacket()
                               currElement.blocksize,
                               currElement.cmd, currElement.flags);
 
+    if (window) {
+        const uint64_t i = numIssued++;
+        lastIssue = curTick();
+        if (pkt->needsResponse()) {
+            doneTicks[i % window] = MaxTick;
+            outstanding[pkt->req.get()] = i;
+        } else {
+            doneTicks[i % window] = curTick();
+        }
+    }
+
     if (!traceComplete)
         DPRINTF(TrafficGen, "nextElement: %c addr %d size %d tick %d (%d)\n",
                 nextElement.cmd.isRead() ? 'r' : 'w',
@@ -177,6 +354,25 @@ TraceGen::exit()
     // Clear any flags and start over again from the beginning of the
     // file
     trace.reset();
+    outstanding.clear();
+}
+
+void
+TraceGen::packetDone(const Packet *pkt)
+{
+    auto it = outstanding.find(pkt->req.get());
+    if (it == outstanding.end())
+        return;
+
+    doneTicks[it->second % window] = curTick();
+    outstanding.erase(it);
+}
+
+bool
+TraceGen::waitingForResponse() const
+{
+    return window && !traceComplete && numIssued >= window &&
+        doneTicks[numIssued % window] == MaxTick;
 }
 
 } // namespace gem5
@@ -44,6 +44,12 @@
 #ifndef __CPU_TRAFFIC_GEN_TRACE_GEN_HH__
 #define __CPU_TRAFFIC_GEN_TRACE_GEN_HH__
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "base/bitfield.hh"
 #include "base/intmath.hh"
 #include "base_gen.hh"
@@ -84,6 +90,12 @@ class TraceGen : public BaseGen
         /** Potential request flags to use */
         Request::FlagsType flags;
 
+        /**
+         * Time the request spent in the trace after the requests it
+         * depends on completed, for a closed-loop replay
+         */
+        Tick think;
+
         /**
          * Check validity of this element.
          *
@@ -101,18 +113,82 @@ class TraceGen : public BaseGen
         }
     };
 
+  public:
+
+    /**
+     * Header of a binary packet trace. Binary traces are an
+     * uncompressed alternative to the protobuf traces, with fixed size
+     * records that are memory mapped rather than parsed. All the fields
+     * are little endian. util/packet_trace_to_binary.py converts
+     * protobuf packet traces, such as the ones of a MemTraceProbe, to
+     * this format.
+     */
+    struct BinaryHeader
+    {
+        /** Always BinaryMagic */
+        char magic[8];
+        /** Always BinaryVersion */
+        uint32_t version;
+        /** Size of a record, to skip any fields added later */
+        uint32_t recordSize;
+        /** Tick frequency the trace was recorded with */
+        uint64_t tickFreq;
+        /** Number of records following the header */
+        uint64_t numRecords;
+    };
+
+    /** A packet of a binary trace */
+    struct BinaryRecord
+    {
+        uint64_t tick;
+        uint64_t addr;
+        /** Request flags */
+        uint64_t flags;
+        uint32_t size;
+        /** The MemCmd of the packet */
+        uint32_t cmd;
+    };
+
+    static constexpr char BinaryMagic[8] = {'g', 'e', 'm', '5',
+                                            'p', 'k', 't', 'b'};
+    static constexpr uint32_t BinaryVersion = 1;
+
+  private:
+
     /**
      * The InputStream encapsulates a trace file and the
      * internal buffers and populates TraceElements based on
-     * the input.
+     * the input. A binary trace is mapped in memory, and the kernel
+     * is asked to read ahead of the replay.
      */
     class InputStream
     {
 
       private:
 
-        /// Input file stream for the protobuf trace
-        ProtoInputStream trace;
+        /// Input file stream for the protobuf trace, if it is not binary
+        std::unique_ptr<ProtoInputStream> trace;
+
+        /// Mapping of the whole binary trace
+        void *mapped;
+        size_t mappedSize;
+
+        /// Records of the binary trace
+        const uint8_t *records;
+        size_t numRecords;
+        size_t recordSize;
+
+        /// Next record to read
+        size_t nextRecord;
+
+        /// Records up to which the kernel was asked to read ahead
+        size_t prefetched;
+
+        /** Map a binary trace, opened by fd, in memory. */
+        void mapBinary(const std::string& filename, int fd);
+
+        /** Ask the kernel to read the records ahead of nextRecord. */
+        void prefetch();
 
       public:
 
@@ -123,6 +199,8 @@ class TraceGen : public BaseGen
          */
         InputStream(const std::string& filename);
 
+        ~InputStream();
+
         /**
          * Reset the stream such that it can be played once
          * again.
@@ -156,14 +234,26 @@ class TraceGen : public BaseGen
      * @param _duration duration of this state before transitioning
      * @param trace_file File to read the transactions from
      * @param addr_offset Positive offset to add to trace address
+     * @param _window Outstanding requests of a closed-loop replay, or
+     *                0 to replay the trace at its recorded ticks
+     * @param recorded_latency Memory latency the trace was recorded with
      */
     TraceGen(SimObject &obj, RequestorID requestor_id, Tick _duration,
-             const std::string& trace_file, Addr addr_offset)
+             const std::string& trace_file, Addr addr_offset,
+             unsigned _window = 0, Tick recorded_latency = 0)
         : BaseGen(obj, requestor_id, _duration),
           trace(trace_file),
           tickOffset(0),
           addrOffset(addr_offset),
-          traceComplete(false)
+          traceComplete(false),
+          window(_window),
+          recordedLatency(recorded_latency),
+          numRead(0),
+          lastRecordedTick(0),
+          recordedTicks(_window),
+          numIssued(0),
+          lastIssue(0),
+          doneTicks(_window)
     {
     }
 
@@ -180,8 +270,18 @@ class TraceGen : public BaseGen
      */
     Tick nextPacketTick(bool elastic, Tick delay) const;
 
+    void packetDone(const Packet *pkt) override;
+
+    bool waitingForResponse() const override;
+
   private:
 
+    /**
+     * Read the next element of the trace, and work out its think time
+     * for a closed-loop replay.
+     */
+    void readNext();
+
     /** Input stream used for reading the input trace file */
     InputStream trace;
 
@@ -207,6 +307,40 @@ class TraceGen : public BaseGen
      * state is complete.
      */
     bool traceComplete;
+
+    /**
+     * In a closed-loop replay, request i is issued think_i after both
+     * request i - 1 was issued and request i - window completed. The
+     * think times assume the same dependencies held when the trace was
+     * recorded, with requests completing recordedLatency after their
+     * recorded tick.
+     */
+    const unsigned window;
+    const Tick recordedLatency;
+
+    /** Number of elements read from the trace */
+    uint64_t numRead;
+
+    /** Recorded tick of the last element read */
+    Tick lastRecordedTick;
+
+    /** Recorded ticks of the last window elements read, by index */
+    std::vector<Tick> recordedTicks;
+
+    /** Number of requests issued, which is the index of nextElement */
+    uint64_t numIssued;
+
+    /** Tick the last request was issued at */
+    Tick lastIssue;
+
+    /**
+     * Tick each of the last window requests completed at, by index,
+     * or MaxTick while it is outstanding
+     */
+    std::vector<Tick> doneTicks;
+
+    /** Index of the outstanding requests */
+    std::unordered_map<const Request *, uint64_t> outstanding;
 };
 
 } // namespace gem5
@@ -51,6 +51,7 @@
 #include "base/types.hh"
 #include "cpu/pc_event.hh"
 #include "cpu/reg_class.hh"
+#include "mem/backdoor.hh"
 
 namespace gem5
 {
@@ -144,6 +145,14 @@ class ThreadContext : public PCEventScope
 
     virtual void sendFunctional(PacketPtr pkt);
 
+    /**
+     * Get a backdoor to the memory behind the data port of the CPU,
+     * if the system bypasses caches so that the memory has the latest
+     * data.
+     */
+    virtual void sendMemBackdoorReq(const MemBackdoorReq &req,
+                                    MemBackdoorPtr &backdoor);
+
     virtual Process *getProcessPtr() = 0;
 
     virtual void setProcessPtr(Process *p) = 0;
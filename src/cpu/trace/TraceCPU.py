@@ -75,6 +75,12 @@ class TraceCPU(ClockedObject):
         1.0, "Multiplier scale the Trace CPU frequency up or down"
     )
 
+    # Decoding the protobuf trace is the bulk of the work of the replay, so
+    # it can be done on a helper thread, ahead of the replay
+    decodeAhead = Param.Bool(
+        False, "Decode the data dependency trace on a helper thread"
+    )
+
     # Enable exiting when any one Trace CPU completes execution which is set to
     # false by default
     enableEarlyExit = Param.Bool(
@@ -44,6 +44,17 @@
 namespace gem5
 {
 
+namespace
+{
+
+/** Number of records the trace decoder parses at a time */
+constexpr size_t ChunkRecords = 4096;
+
+/** Number of decoded chunks that can wait for the replay */
+constexpr size_t MaxDecodedChunks = 4;
+
+} // anonymous namespace
+
 // Declare and initialize the static counter for number of trace CPUs.
 int TraceCPU::numTraceCPUs = 0;
 
@@ -281,12 +292,39 @@ TraceCPU::ElasticDataGen::adjustInitTraceOffset(Tick& offset)
     }
 }
 
+TraceCPU::ElasticDataGen::~ElasticDataGen()
+{
+    for (auto &entry : depGraph)
+        delete entry.second;
+    for (auto node : freeNodes)
+        delete node;
+}
+
 void
 TraceCPU::ElasticDataGen::exit()
 {
     trace.reset();
 }
 
+TraceCPU::ElasticDataGen::GraphNode *
+TraceCPU::ElasticDataGen::allocNode()
+{
+    if (freeNodes.empty())
+        return new GraphNode;
+    GraphNode *node = freeNodes.back();
+    freeNodes.pop_back();
+    return node;
+}
+
+void
+TraceCPU::ElasticDataGen::freeNode(GraphNode *node)
+{
+    // clear the set of dependents, but keep its storage for the next
+    // node
+    node->dependents.clear();
+    freeNodes.push_back(node);
+}
+
 bool
 TraceCPU::ElasticDataGen::readNextWindow()
 {
@@ -306,7 +344,7 @@ TraceCPU::ElasticDataGen::readNextWindow()
     while (num_read != windowSize) {
 
         // Create a new graph node
-        GraphNode* new_node = new GraphNode;
+        GraphNode* new_node = allocNode();
 
         // Read the next line to get the next record. If that fails then end of
         // trace has been reached and traceComplete needs to be set in addition
@@ -314,6 +352,7 @@ TraceCPU::ElasticDataGen::readNextWindow()
         if (!trace.read(new_node)) {
             DPRINTF(TraceCPUData, "\tTrace complete!\n");
             traceComplete = true;
+            freeNode(new_node);
             return false;
         }
 
@@ -499,12 +538,10 @@ TraceCPU::ElasticDataGen::execute()
         if (!node_ptr->isLoad() || node_ptr->isStrictlyOrdered()) {
             // Release all resources occupied by the completed node
             hwResource.release(node_ptr);
-            // clear the dynamically allocated set of dependents
-            (node_ptr->dependents).clear();
             // Update the stat for numOps simulated
             owner.updateNumOps(node_ptr->robNum);
-            // delete node
-            delete node_ptr;
+            // return the node to the pool
+            freeNode(node_ptr);
             // remove from graph
             depGraph.erase(graph_itr);
         }
@@ -707,12 +744,10 @@ TraceCPU::ElasticDataGen::completeMemAccess(PacketPtr pkt)
             }
         }
 
-        // clear the dynamically allocated set of dependents
-        (node_ptr->dependents).clear();
         // Update the stat for numOps completed
         owner.updateNumOps(node_ptr->robNum);
-        // delete node
-        delete node_ptr;
+        // return the node to the pool
+        freeNode(node_ptr);
         // remove from graph
         depGraph.erase(graph_itr);
     }
@@ -1203,8 +1238,13 @@ TraceCPU::DcachePort::recvReqRetry()
 }
 
 TraceCPU::ElasticDataGen::InputStream::InputStream(
-        const std::string& filename, const double time_multiplier) :
+        const std::string& filename, const double time_multiplier,
+        bool decode_ahead) :
     trace(filename),
+    decodeAhead(decode_ahead),
+    chunkPos(0),
+    decodeDone(false),
+    stopping(false),
     timeMultiplier(time_multiplier),
     microOpCount(0)
 {
@@ -1227,77 +1267,174 @@ TraceCPU::ElasticDataGen::InputStream::InputStream(
 void
 TraceCPU::ElasticDataGen::InputStream::reset()
 {
+    stopDecoder();
     trace.reset();
 }
 
+TraceCPU::ElasticDataGen::InputStream::~InputStream()
+{
+    stopDecoder();
+}
+
+void
+TraceCPU::ElasticDataGen::InputStream::startDecoder()
+{
+    decodeDone = false;
+    stopping = false;
+    decoder = std::thread([this]() { decodeLoop(); });
+}
+
+void
+TraceCPU::ElasticDataGen::InputStream::stopDecoder()
+{
+    if (!decoder.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(decodeLock);
+        stopping = true;
+    }
+    decodeCond.notify_all();
+    decoder.join();
+
+    // drop what was decoded ahead, the stream is either destroyed or
+    // reset
+    chunk.clear();
+    chunkPos = 0;
+    decoded.clear();
+}
+
 bool
-TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
+TraceCPU::ElasticDataGen::InputStream::decode(DecodedRecord &rec)
 {
-    ProtoMessage::InstDepRecord pkt_msg;
-    if (trace.read(pkt_msg)) {
-        // Required fields
-        element->seqNum = pkt_msg.seq_num();
-        element->type = pkt_msg.type();
-        // Scale the compute delay to effectively scale the Trace CPU frequency
-        element->compDelay = pkt_msg.comp_delay() * timeMultiplier;
-
-        // Repeated field robDepList
-        element->robDep.clear();
-        for (int i = 0; i < (pkt_msg.rob_dep()).size(); i++) {
-            element->robDep.push_back(pkt_msg.rob_dep(i));
+    if (!trace.read(traceMsg)) {
+        // We have reached the end of the file
+        return false;
+    }
+
+    // Required fields
+    rec.seqNum = traceMsg.seq_num();
+    rec.type = traceMsg.type();
+    rec.compDelay = traceMsg.comp_delay();
+
+    // Repeated field robDepList
+    rec.robDep.assign(traceMsg.rob_dep().begin(), traceMsg.rob_dep().end());
+
+    // Repeated field
+    rec.regDep.clear();
+    for (auto reg_dep : traceMsg.reg_dep()) {
+        // There is a possibility that an instruction has both, a register
+        // and order dependency on an instruction. In such a case, the
+        // register dependency is omitted
+        bool duplicate = false;
+        for (auto &dep: rec.robDep) {
+            duplicate |= (reg_dep == dep);
         }
+        if (!duplicate)
+            rec.regDep.push_back(reg_dep);
+    }
+
+    // Optional fields
+    rec.physAddr = traceMsg.has_p_addr() ? traceMsg.p_addr() : 0;
+    rec.virtAddr = traceMsg.has_v_addr() ? traceMsg.v_addr() : 0;
+    rec.size = traceMsg.has_size() ? traceMsg.size() : 0;
+    rec.flags = traceMsg.has_flags() ? traceMsg.flags() : 0;
+    rec.pc = traceMsg.has_pc() ? traceMsg.pc() : 0;
+    rec.weight = traceMsg.has_weight() ? traceMsg.weight() : 0;
+    return true;
+}
 
-        // Repeated field
-        element->regDep.clear();
-        for (int i = 0; i < (pkt_msg.reg_dep()).size(); i++) {
-            // There is a possibility that an instruction has both, a register
-            // and order dependency on an instruction. In such a case, the
-            // register dependency is omitted
-            bool duplicate = false;
-            for (auto &dep: element->robDep) {
-                duplicate |= (pkt_msg.reg_dep(i) == dep);
+void
+TraceCPU::ElasticDataGen::InputStream::decodeLoop()
+{
+    while (true) {
+        DecodedChunk next;
+        {
+            std::unique_lock<std::mutex> lock(decodeLock);
+            decodeCond.wait(lock, [this]() {
+                return stopping || decoded.size() < MaxDecodedChunks;
+            });
+            if (stopping)
+                return;
+            if (!spare.empty()) {
+                next = std::move(spare.back());
+                spare.pop_back();
             }
-            if (!duplicate)
-                element->regDep.push_back(pkt_msg.reg_dep(i));
         }
 
-        // Optional fields
-        if (pkt_msg.has_p_addr())
-            element->physAddr = pkt_msg.p_addr();
-        else
-            element->physAddr = 0;
-
-        if (pkt_msg.has_v_addr())
-            element->virtAddr = pkt_msg.v_addr();
-        else
-            element->virtAddr = 0;
-
-        if (pkt_msg.has_size())
-            element->size = pkt_msg.size();
-        else
-            element->size = 0;
-
-        if (pkt_msg.has_flags())
-            element->flags = pkt_msg.flags();
-        else
-            element->flags = 0;
-
-        if (pkt_msg.has_pc())
-            element->pc = pkt_msg.pc();
-        else
-            element->pc = 0;
-
-        // ROB occupancy number
-        ++microOpCount;
-        if (pkt_msg.has_weight()) {
-            microOpCount += pkt_msg.weight();
+        // Decode outside of the lock, reusing the records of a
+        // replayed chunk so that their lists keep their storage
+        next.resize(ChunkRecords);
+        size_t num_decoded = 0;
+        while (num_decoded < ChunkRecords && decode(next[num_decoded]))
+            num_decoded++;
+        next.resize(num_decoded);
+
+        {
+            std::lock_guard<std::mutex> lock(decodeLock);
+            if (num_decoded)
+                decoded.push_back(std::move(next));
+            decodeDone = num_decoded < ChunkRecords;
         }
-        element->robNum = microOpCount;
-        return true;
+        decodeCond.notify_all();
+        if (num_decoded < ChunkRecords)
+            return;
     }
+}
 
-    // We have reached the end of the file
-    return false;
+const TraceCPU::ElasticDataGen::InputStream::DecodedRecord *
+TraceCPU::ElasticDataGen::InputStream::nextRecord()
+{
+    if (!decodeAhead) {
+        chunk.resize(1);
+        return decode(chunk[0]) ? &chunk[0] : nullptr;
+    }
+
+    if (!decoder.joinable())
+        startDecoder();
+
+    if (chunkPos == chunk.size()) {
+        std::unique_lock<std::mutex> lock(decodeLock);
+        decodeCond.wait(lock, [this]() {
+            return decodeDone || !decoded.empty();
+        });
+        if (decoded.empty())
+            return nullptr;
+        spare.push_back(std::move(chunk));
+        chunk = std::move(decoded.front());
+        decoded.pop_front();
+        chunkPos = 0;
+        lock.unlock();
+        decodeCond.notify_all();
+    }
+    return &chunk[chunkPos++];
+}
+
+bool
+TraceCPU::ElasticDataGen::InputStream::read(GraphNode* element)
+{
+    const DecodedRecord *rec = nextRecord();
+    if (!rec) {
+        // We have reached the end of the file
+        return false;
+    }
+
+    element->seqNum = rec->seqNum;
+    element->type = rec->type;
+    // Scale the compute delay to effectively scale the Trace CPU frequency
+    element->compDelay = rec->compDelay * timeMultiplier;
+    element->robDep = rec->robDep;
+    element->regDep = rec->regDep;
+    element->physAddr = rec->physAddr;
+    element->virtAddr = rec->virtAddr;
+    element->size = rec->size;
+    element->flags = rec->flags;
+    element->pc = rec->pc;
+
+    // ROB occupancy number
+    ++microOpCount;
+    microOpCount += rec->weight;
+    element->robNum = microOpCount;
+    return true;
 }
 
 bool
@@ -38,11 +38,16 @@
 #ifndef __CPU_TRACE_TRACE_CPU_HH__
 #define __CPU_TRACE_TRACE_CPU_HH__
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <list>
+#include <mutex>
 #include <queue>
 #include <set>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "debug/TraceCPUData.hh"
@@ -542,11 +547,15 @@ class TraceCPU : public ClockedObject
         class GraphNode
         {
           public:
-            /** Typedef for the list containing the ROB dependencies */
-            typedef std::list<NodeSeqNum> RobDepList;
+            /**
+             * Typedef for the list containing the ROB dependencies. Nodes
+             * are pooled, so a vector keeps its storage from one node to
+             * the next.
+             */
+            typedef std::vector<NodeSeqNum> RobDepList;
 
             /** Typedef for the list containing the register dependencies */
-            typedef std::list<NodeSeqNum> RegDepList;
+            typedef std::vector<NodeSeqNum> RegDepList;
 
             /** Instruction sequence number */
             NodeSeqNum seqNum;
@@ -746,9 +755,77 @@ class TraceCPU : public ClockedObject
         class InputStream
         {
           private:
+            /** A record of the trace, decoded from its protobuf message */
+            struct DecodedRecord
+            {
+                NodeSeqNum seqNum;
+                RecordType type;
+                uint64_t compDelay;
+                GraphNode::RobDepList robDep;
+                GraphNode::RegDepList regDep;
+                Addr physAddr;
+                Addr virtAddr;
+                uint32_t size;
+                Request::FlagsType flags;
+                Addr pc;
+                uint32_t weight;
+            };
+
+            typedef std::vector<DecodedRecord> DecodedChunk;
+
             /** Input file stream for the protobuf trace */
             ProtoInputStream trace;
 
+            /** Message reused to parse every record of the trace */
+            Record traceMsg;
+
+            /**
+             * Decode the trace on a helper thread, in chunks of records,
+             * ahead of the replay.
+             */
+            const bool decodeAhead;
+
+            /** Chunk the records are replayed from */
+            DecodedChunk chunk;
+            /** Number of records of the chunk used so far */
+            size_t chunkPos;
+
+            /** Protects the decoder state below */
+            std::mutex decodeLock;
+            std::condition_variable decodeCond;
+            /** Chunks decoded but not replayed yet */
+            std::deque<DecodedChunk> decoded;
+            /** Replayed chunks for the decoder to reuse */
+            std::vector<DecodedChunk> spare;
+            /** The decoder reached the end of the trace */
+            bool decodeDone;
+            /** The decoder has to stop */
+            bool stopping;
+
+            std::thread decoder;
+
+            /**
+             * Parse the next message of the trace.
+             *
+             * @param rec Record to decode the message into
+             * @return True unless the end of the trace was reached
+             */
+            bool decode(DecodedRecord &rec);
+
+            /** Decode chunks, on the helper thread, until stopped. */
+            void decodeLoop();
+
+            void startDecoder();
+            void stopDecoder();
+
+            /**
+             * Get the next decoded record, waiting for the helper thread
+             * if needed.
+             *
+             * @return The record, or nullptr at the end of the trace
+             */
+            const DecodedRecord *nextRecord();
+
             /**
              * A multiplier for the compute delays in the trace to modulate
              * the Trace CPU frequency either up or down. The Trace CPU's
@@ -772,9 +849,13 @@ class TraceCPU : public ClockedObject
              *
              * @param filename Path to the file to read from
              * @param time_multiplier used to scale the compute delays
+             * @param decode_ahead decode the trace on a helper thread
              */
             InputStream(const std::string& filename,
-                        const double time_multiplier);
+                        const double time_multiplier,
+                        bool decode_ahead = false);
+
+            ~InputStream();
 
             /**
              * Reset the stream such that it can be played once
@@ -809,7 +890,8 @@ class TraceCPU : public ClockedObject
             owner(_owner),
             port(_port),
             requestorId(requestor_id),
-            trace(trace_file, 1.0 / params.freqMultiplier),
+            trace(trace_file, 1.0 / params.freqMultiplier,
+                  params.decodeAhead),
             genName(owner.name() + ".elastic." + _name),
             retryPkt(nullptr),
             traceComplete(false),
@@ -823,6 +905,8 @@ class TraceCPU : public ClockedObject
                     windowSize);
         }
 
+        ~ElasticDataGen();
+
         /**
          * Called from TraceCPU init(). Reads the first message from the
          * input trace file and returns the send tick.
@@ -978,6 +1062,15 @@ class TraceCPU : public ClockedObject
         /** Store the depGraph of GraphNodes */
         std::unordered_map<NodeSeqNum, GraphNode*> depGraph;
 
+        /** Completed nodes, reused for the nodes read next */
+        std::vector<GraphNode*> freeNodes;
+
+        /** Get a node from the pool, or a new one if it is empty. */
+        GraphNode *allocNode();
+
+        /** Return a completed node to the pool. */
+        void freeNode(GraphNode *node);
+
         /**
          * Queue of dependency-free nodes that are pending issue because
          * resources are not available. This is chosen to be FIFO so that
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/translation_cache.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "cpu/thread_context.hh"
+#include "sim/full_system.hh"
+
+namespace gem5
+{
+
+TranslationCache::TranslationCache(size_t num_entries, Addr page_bytes)
+    : entries(num_entries), pageMask(~(page_bytes - 1))
+{
+    fatal_if(num_entries == 0, "A translation cache needs entries.");
+    fatal_if(!isPowerOf2(page_bytes), "Pages must be a power of two.");
+}
+
+bool
+TranslationCache::cacheable(const RequestPtr &req) const
+{
+    const Addr vaddr = req->getVaddr();
+    const Addr last_byte = vaddr + req->getSize() - 1;
+    return !FullSystem && req->getArchFlags() == 0 &&
+        !req->isLocalAccess() && req->getSize() != 0 &&
+        (vaddr & pageMask) == (last_byte & pageMask);
+}
+
+void
+TranslationCache::validate(ThreadContext *tc)
+{
+    const uint64_t cur_generation =
+        tc->getMMUPtr()->translationGeneration();
+    const void *cur_process = tc->getProcessPtr();
+    if (cur_generation != generation || cur_process != process) {
+        flush();
+        generation = cur_generation;
+        process = cur_process;
+    }
+}
+
+bool
+TranslationCache::translate(const RequestPtr &req, ThreadContext *tc,
+                            BaseMMU::Mode mode)
+{
+    validate(tc);
+    if (!cacheable(req))
+        return false;
+
+    const Addr vaddr = req->getVaddr();
+    const Addr vpage = vaddr & pageMask;
+    const Request::Flags flags = req->getFlags();
+
+    auto matches = [&](const Entry &entry) {
+        return entry.vpage == vpage && entry.mode == mode &&
+            entry.inFlags == flags;
+    };
+
+    if (!matches(entries[last])) {
+        size_t idx = 0;
+        while (idx < entries.size() && !matches(entries[idx]))
+            idx++;
+        if (idx == entries.size())
+            return false;
+        last = idx;
+    }
+
+    const Entry &entry = entries[last];
+    req->setPaddr(entry.ppage | (vaddr & ~pageMask));
+    req->setFlags(entry.outFlags);
+    return true;
+}
+
+void
+TranslationCache::insert(const RequestPtr &req, BaseMMU::Mode mode,
+                         Request::Flags flags)
+{
+    if (!cacheable(req))
+        return;
+
+    Entry &entry = entries[victim];
+    entry.vpage = req->getVaddr() & pageMask;
+    entry.ppage = req->getPaddr() & pageMask;
+    entry.mode = mode;
+    entry.inFlags = flags;
+    entry.outFlags = req->getFlags();
+
+    last = victim;
+    victim = (victim + 1) % entries.size();
+}
+
+void
+TranslationCache::flush()
+{
+    for (auto &entry : entries)
+        entry.vpage = MaxAddr;
+}
+
+} // namespace gem5
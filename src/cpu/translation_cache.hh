@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_TRANSLATION_CACHE_HH__
+#define __CPU_TRANSLATION_CACHE_HH__
+
+#include <vector>
+
+#include "arch/generic/mmu.hh"
+#include "base/types.hh"
+#include "mem/request.hh"
+
+namespace gem5
+{
+
+class ThreadContext;
+
+/**
+ * A small cache of the translations a thread did last, which lets a CPU
+ * model translate repeated accesses to the same page without going
+ * through the MMU. This is a simulator optimisation rather than a model
+ * of a micro TLB: the simulated TLBs do not see the accesses that hit,
+ * so their statistics only count the accesses that miss in here.
+ *
+ * A translation is reused for accesses to the same virtual page with the
+ * same mode and request flags. Everything else a translation may depend
+ * on is either excluded or tracked:
+ * - The cache is flushed whenever the translation generation of the MMU
+ *   or the process of the thread changes.
+ * - Only syscall emulation mode translations are cached, as privilege
+ *   levels and address space registers do not change there.
+ * - Requests with ISA specific flags (e.g., x86 segments) are not
+ *   cached, and neither are local accesses.
+ */
+class TranslationCache
+{
+  public:
+    /**
+     * @param num_entries Number of translations kept.
+     * @param page_bytes Granularity of the translations.
+     */
+    TranslationCache(size_t num_entries, Addr page_bytes);
+
+    /**
+     * Translate a request from the cache.
+     *
+     * @return Whether the translation was cached, in which case the
+     *         physical address and the flags of the request are set.
+     */
+    bool translate(const RequestPtr &req, ThreadContext *tc,
+                   BaseMMU::Mode mode);
+
+    /**
+     * Remember the translation the MMU did for a request.
+     *
+     * @param flags The flags of the request before the translation.
+     */
+    void insert(const RequestPtr &req, BaseMMU::Mode mode,
+                Request::Flags flags);
+
+    /** Whether a request can be translated from the cache. */
+    bool cacheable(const RequestPtr &req) const;
+
+    void flush();
+
+  private:
+    struct Entry
+    {
+        Addr vpage = MaxAddr;
+        Addr ppage = 0;
+        BaseMMU::Mode mode = BaseMMU::Read;
+        /** Flags of the request before and after the translation. */
+        Request::Flags inFlags = 0;
+        Request::Flags outFlags = 0;
+    };
+
+    std::vector<Entry> entries;
+
+    /** The entry that hit or was inserted last. */
+    size_t last = 0;
+
+    /** Round robin replacement. */
+    size_t victim = 0;
+
+    const Addr pageMask;
+
+    /** What the cached translations were done for. */
+    uint64_t generation = 0;
+    const void *process = nullptr;
+
+    void validate(ThreadContext *tc);
+};
+
+} // namespace gem5
+
+#endif // __CPU_TRANSLATION_CACHE_HH__
@@ -110,6 +110,11 @@ class DmaDevice(PioDevice):
         "Substream identifier used by an IOMMU to distinguish amongst "
         "several devices attached to it",
     )
+    atomic_dma_bandwidth = Param.MemoryBandwidth(
+        "0GiB/s",
+        "Bandwidth used to time the DMA transfers which bypass the memory "
+        "through backdoors in atomic_noncaching mode (0 for no latency)",
+    )
 
     def addIommuProperty(self, state, node):
         """
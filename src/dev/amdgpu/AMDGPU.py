@@ -110,6 +110,19 @@ class SDMAEngine(DmaVirtDevice):
     gpu_device = Param.AMDGPUDevice(NULL, "GPU Controller")
     walker = Param.VegaPagetableWalker("Page table walker")
 
+    functional_copy_threshold = Param.MemorySize(
+        "0",
+        "Copies and fills of at least this size access memory through its "
+        "backdoor instead of DMA requests (0 disables). Cached data is not "
+        "observed, so memories must be kept up to date, e.g., by Ruby's "
+        "access_backing_store.",
+    )
+    functional_copy_bandwidth = Param.MemoryBandwidth(
+        "0GiB/s",
+        "Bandwidth used to time functional copies (0 completes them "
+        "immediately)",
+    )
+
 
 class PM4PacketProcessor(DmaVirtDevice):
     type = "PM4PacketProcessor"
@@ -33,6 +33,7 @@
 
 #include "arch/amdgpu/vega/pagetable_walker.hh"
 #include "arch/generic/mmu.hh"
+#include "base/chunk_generator.hh"
 #include "debug/SDMAData.hh"
 #include "debug/SDMAEngine.hh"
 #include "dev/amdgpu/interrupt_handler.hh"
@@ -51,7 +52,9 @@ SDMAEngine::SDMAEngine(const SDMAEngineParams &p)
       gfxDoorbell(0), gfxDoorbellOffset(0), gfxWptr(0), pageBase(0),
       pageRptr(0), pageDoorbell(0), pageDoorbellOffset(0),
       pageWptr(0), gpuDevice(nullptr), walker(p.walker),
-      mmioBase(p.mmio_base), mmioSize(p.mmio_size)
+      mmioBase(p.mmio_base), mmioSize(p.mmio_size),
+      functionalCopyThreshold(p.functional_copy_threshold),
+      functionalCopyTicksPerByte(p.functional_copy_bandwidth)
 {
     gfx.ib(&gfxIb);
     gfxIb.parent(&gfx);
@@ -149,6 +152,52 @@ SDMAEngine::getDeviceAddress(Addr raw_addr)
     return device_addr;
 }
 
+/**
+ * Backdoor access for the functional copy path. Device addresses are split
+ * into MMHUB pages like the DMA path and go to the device memory, host
+ * addresses are translated and go to the system physical memory. Neither
+ * looks into caches, so this is only coherent when the memories are kept
+ * up to date, e.g., by Ruby with access_backing_store.
+ */
+void
+SDMAEngine::functionalCopyAccess(Addr addr, uint8_t *data, Addr size,
+                                 bool write)
+{
+    auto system_ptr = gpuDevice->CP()->system();
+    MemCmd cmd = write ? MemCmd::WriteReq : MemCmd::ReadReq;
+
+    if (getDeviceAddress(addr)) {
+        ChunkGenerator gen(addr, size, AMDGPU_MMHUB_PAGE_SIZE);
+        for (; !gen.done(); gen.next()) {
+            Addr chunk_addr = getDeviceAddress(gen.addr());
+            assert(chunk_addr);
+
+            RequestPtr req = std::make_shared<Request>(chunk_addr,
+                gen.size(), 0, gpuDevice->vramRequestorId());
+            Packet pkt(req, cmd);
+            pkt.dataStatic(data + gen.complete());
+
+            auto devmem = system_ptr->getDeviceMemory(&pkt);
+            panic_if(!devmem, "No device memory for SDMA address %#lx\n",
+                     chunk_addr);
+            devmem->functionalAccess(&pkt);
+        }
+    } else {
+        TranslationGenPtr gen = translate(addr, size);
+        for (const auto &range : *gen) {
+            fatal_if(range.fault, "Failed translation: vaddr 0x%x",
+                     range.vaddr);
+
+            RequestPtr req = std::make_shared<Request>(range.paddr,
+                range.size, 0, Request::funcRequestorId);
+            Packet pkt(req, cmd);
+            pkt.dataStatic(data + (range.vaddr - addr));
+
+            system_ptr->getPhysMem().functionalAccess(&pkt);
+        }
+    }
+}
+
 /**
  * GPUController will perform DMA operations on VAs, and because
  * page faults are not currently supported for GPUController, we
@@ -710,6 +759,14 @@ SDMAEngine::copy(SDMAQueue *q, sdmaCopy *pkt)
 
     // Read data from the source first, then call the copyReadData method
     uint8_t *dmaBuffer = new uint8_t[pkt->count];
+    if (useFunctionalCopy(pkt->count)) {
+        DPRINTF(SDMAEngine, "Functionally copying %d bytes from %#lx\n",
+                pkt->count, pkt->source);
+        functionalCopyAccess(pkt->source, dmaBuffer, pkt->count, false);
+        copyReadData(q, pkt, dmaBuffer);
+        return;
+    }
+
     Addr device_addr = getDeviceAddress(pkt->source);
     if (device_addr) {
         DPRINTF(SDMAEngine, "Copying from device address %#lx\n", device_addr);
@@ -757,7 +814,15 @@ SDMAEngine::copyReadData(SDMAQueue *q, sdmaCopy *pkt, uint8_t *dmaBuffer)
 
     Addr device_addr = getDeviceAddress(pkt->dest);
     // Write read data to the destination address then call the copyDone method
-    if (device_addr) {
+    if (useFunctionalCopy(pkt->count)) {
+        DPRINTF(SDMAEngine, "Functionally copying %d bytes to %#lx\n",
+                pkt->count, pkt->dest);
+        functionalCopyAccess(pkt->dest, dmaBuffer, pkt->count, true);
+
+        auto cb = new EventFunctionWrapper(
+            [ = ]{ copyDone(q, pkt, dmaBuffer); }, name(), true);
+        schedule(cb, curTick() + functionalCopyDelay(pkt->count));
+    } else if (device_addr) {
         DPRINTF(SDMAEngine, "Copying to device address %#lx\n", device_addr);
         auto cb = new EventFunctionWrapper(
             [ = ]{ copyDone(q, pkt, dmaBuffer); }, name());
@@ -1169,7 +1234,15 @@ SDMAEngine::constFill(SDMAQueue *q, sdmaConstFill *pkt, uint32_t header)
     memset(fill_data, pkt->srcData, fill_bytes);
 
     Addr device_addr = getDeviceAddress(pkt->addr);
-    if (device_addr) {
+    if (useFunctionalCopy(fill_bytes)) {
+        DPRINTF(SDMAEngine, "Functionally filling %d bytes of %x at %lx\n",
+                fill_bytes, pkt->srcData, pkt->addr);
+        functionalCopyAccess(pkt->addr, fill_data, fill_bytes, true);
+
+        auto cb = new EventFunctionWrapper(
+            [ = ]{ constFillDone(q, pkt, fill_data); }, name(), true);
+        schedule(cb, curTick() + functionalCopyDelay(fill_bytes));
+    } else if (device_addr) {
         DPRINTF(SDMAEngine, "ConstFill %d bytes of %x to device at %lx\n",
                 fill_bytes, pkt->srcData, pkt->addr);
 
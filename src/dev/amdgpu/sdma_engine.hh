@@ -165,6 +165,31 @@ class SDMAEngine : public DmaVirtDevice
     Addr mmioBase = 0;
     Addr mmioSize = 0;
 
+    /**
+     * Copies and constant fills of at least functionalCopyThreshold bytes
+     * skip the DMA requests and access the host and device memories
+     * through their backdoor. The packet completes after
+     * functionalCopyTicksPerByte ticks per byte, which is 0 unless a
+     * bandwidth is configured. A threshold of 0 disables the fast path.
+     */
+    uint64_t functionalCopyThreshold;
+    float functionalCopyTicksPerByte;
+
+    bool
+    useFunctionalCopy(Addr bytes) const
+    {
+        return functionalCopyThreshold && bytes >= functionalCopyThreshold;
+    }
+
+    Tick
+    functionalCopyDelay(Addr bytes) const
+    {
+        return static_cast<Tick>(bytes * functionalCopyTicksPerByte);
+    }
+
+    void functionalCopyAccess(Addr addr, uint8_t *data, Addr size,
+                              bool write);
+
   public:
     SDMAEngine(const SDMAEngineParams &p);
 
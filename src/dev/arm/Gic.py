@@ -273,6 +273,10 @@ class Gicv3Its(BasicPioDevice):
     # ID_bits [12:8] = 0b11111: ITS supports 31 EventID bits
     gits_typer = Param.UInt64(0x30023F01, "GITS_TYPER RO value")
 
+    translation_cache_entries = Param.Unsigned(
+        256, "Number of cached MSI translations, 0 to disable the cache"
+    )
+
     def generateDeviceTree(self, state):
         node = self.generateBasicPioDeviceNode(
             state, "gic-its", self.pio_addr, self.pio_size
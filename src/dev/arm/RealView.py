@@ -667,6 +667,11 @@ class HDLcd(AmbaDmaDevice):
     frame_format = Param.ImageFormat(
         "Auto", "image format of the captured frame"
     )
+    skip_unused_frames = Param.Bool(
+        False,
+        "Don't fetch frames from memory while there is no VNC client "
+        "and frame capture is disabled",
+    )
 
     pixel_buffer_size = Param.MemorySize32("2KiB", "Size of address range")
 
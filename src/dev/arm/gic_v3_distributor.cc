@@ -616,7 +616,7 @@ Gicv3Distributor::write(Addr addr, uint64_t data, size_t size,
             if (pending) {
                 DPRINTF(GIC, "Gicv3Distributor::write() (GICD_ISPENDR): "
                         "int_id %d (SPI) pending bit set\n", int_id);
-                irqPending[int_id] = true;
+                setPending(int_id, true);
                 irqPendingIspendr[int_id] = true;
             }
         }
@@ -645,7 +645,7 @@ Gicv3Distributor::write(Addr addr, uint64_t data, size_t size,
             bool clear = data & (1 << i) ? 1 : 0;
 
             if (clear && treatAsEdgeTriggered(int_id)) {
-                irqPending[int_id] = false;
+                setPending(int_id, false);
                 clearIrqCpuInterface(int_id);
             }
         }
@@ -1004,12 +1004,22 @@ Gicv3Distributor::write(Addr addr, uint64_t data, size_t size,
     }
 }
 
+void
+Gicv3Distributor::setPending(uint32_t int_id, bool pending)
+{
+    irqPending[int_id] = pending;
+    if (pending)
+        pendingSPIs.insert(int_id);
+    else
+        pendingSPIs.erase(int_id);
+}
+
 void
 Gicv3Distributor::sendInt(uint32_t int_id)
 {
     panic_if(int_id < Gicv3::SGI_MAX + Gicv3::PPI_MAX, "Invalid SPI!");
     panic_if(int_id > itLines, "Invalid SPI!");
-    irqPending[int_id] = true;
+    setPending(int_id, true);
     irqPendingIspendr[int_id] = false;
     DPRINTF(GIC, "Gicv3Distributor::sendInt(): "
             "int_id %d (SPI) pending bit set\n", int_id);
@@ -1031,7 +1041,7 @@ Gicv3Distributor::deassertSPI(uint32_t int_id)
 {
     panic_if(int_id < Gicv3::SGI_MAX + Gicv3::PPI_MAX, "Invalid SPI!");
     panic_if(int_id > itLines, "Invalid SPI!");
-    irqPending[int_id] = false;
+    setPending(int_id, false);
     clearIrqCpuInterface(int_id);
 
     update();
@@ -1088,14 +1098,13 @@ Gicv3Distributor::update()
     if (gic->blockIntUpdate())
         return;
 
-    // Find the highest priority pending SPI
-    for (int int_id = Gicv3::SGI_MAX + Gicv3::PPI_MAX; int_id < itLines;
-         int_id++) {
+    // Find the highest priority pending SPI. Only the pending ones need
+    // to be looked at, in increasing order to keep the lower id on ties.
+    for (uint32_t int_id : pendingSPIs) {
         Gicv3::GroupId int_group = getIntGroup(int_id);
         bool group_enabled = groupEnabled(int_group);
 
-        if (irqPending[int_id] && irqEnabled[int_id] &&
-            !irqActive[int_id] && group_enabled) {
+        if (irqEnabled[int_id] && !irqActive[int_id] && group_enabled) {
 
             // Find the cpu interface where to route the interrupt
             Gicv3CPUInterface *target_cpu_interface = route(int_id);
@@ -1170,7 +1179,7 @@ void
 Gicv3Distributor::activateIRQ(uint32_t int_id)
 {
     if (treatAsEdgeTriggered(int_id)) {
-        irqPending[int_id] = false;
+        setPending(int_id, false);
     }
     irqActive[int_id] = true;
 }
@@ -1235,6 +1244,11 @@ Gicv3Distributor::unserialize(CheckpointIn & cp)
     UNSERIALIZE_CONTAINER(irqGroup);
     UNSERIALIZE_CONTAINER(irqEnabled);
     UNSERIALIZE_CONTAINER(irqPending);
+    pendingSPIs.clear();
+    for (uint32_t int_id = 0; int_id < irqPending.size(); int_id++) {
+        if (irqPending[int_id])
+            pendingSPIs.insert(int_id);
+    }
     UNSERIALIZE_CONTAINER(irqPendingIspendr);
     UNSERIALIZE_CONTAINER(irqActive);
     UNSERIALIZE_CONTAINER(irqPriority);
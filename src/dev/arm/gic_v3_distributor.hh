@@ -41,6 +41,8 @@
 #ifndef __DEV_ARM_GICV3_DISTRIBUTOR_H__
 #define __DEV_ARM_GICV3_DISTRIBUTOR_H__
 
+#include <set>
+
 #include "base/addr_range.hh"
 #include "dev/arm/gic_v3.hh"
 #include "sim/serialize.hh"
@@ -157,6 +159,8 @@ class Gicv3Distributor : public Serializable
     std::vector <uint8_t> irqGroup;
     std::vector <bool> irqEnabled;
     std::vector <bool> irqPending;
+    /** SPIs set in irqPending, so that update() only looks at those */
+    std::set<uint32_t> pendingSPIs;
     std::vector <bool> irqPendingIspendr;
     std::vector <bool> irqActive;
     std::vector <uint8_t> irqPriority;
@@ -258,6 +262,7 @@ class Gicv3Distributor : public Serializable
     void serialize(CheckpointOut & cp) const override;
     void unserialize(CheckpointIn & cp) override;
     Gicv3CPUInterface* route(uint32_t int_id);
+    void setPending(uint32_t int_id, bool pending);
 
   public:
 
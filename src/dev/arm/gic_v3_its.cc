@@ -157,6 +157,8 @@ ItsProcess::writeDeviceTable(Yield &yield, uint32_t device_id, DTE dte)
     DPRINTF(ITS, "Writing DTE at address %#x: %#x\n", address, dte);
 
     doWrite(yield, address, &dte, sizeof(dte));
+
+    its.invalidateTranslationCache();
 }
 
 void
@@ -168,6 +170,8 @@ ItsProcess::writeIrqTranslationTable(
     doWrite(yield, address, &itte, sizeof(itte));
 
     DPRINTF(ITS, "Writing ITTE at address %#x: %#x\n", address, itte);
+
+    its.invalidateTranslationCache();
 }
 
 void
@@ -180,6 +184,8 @@ ItsProcess::writeIrqCollectionTable(
     doWrite(yield, address, &cte, sizeof(cte));
 
     DPRINTF(ITS, "Writing CTE at address %#x: %#x\n", address, cte);
+
+    its.invalidateTranslationCache();
 }
 
 uint64_t
@@ -269,6 +275,13 @@ ItsTranslation::translateLPI(Yield &yield, uint32_t device_id,
         terminate(yield);
     }
 
+    const uint64_t key = Gicv3Its::translationKey(device_id, event_id);
+    auto cached = its.translationCache.find(key);
+    if (cached != its.translationCache.end())
+        return cached->second;
+
+    const uint64_t generation = its.translationCacheGeneration;
+
     DTE dte = readDeviceTable(yield, device_id);
 
     if (!dte.valid || its.idOutOfRange(event_id, dte.ittRange)) {
@@ -289,7 +302,16 @@ ItsTranslation::translateLPI(Yield &yield, uint32_t device_id,
     }
 
     // Returning the INTID and the target Redistributor
-    return std::make_pair(itte.intNum, its.getRedistributor(cte));
+    Gicv3Its::Translation result(itte.intNum, its.getRedistributor(cte));
+
+    if (its.translationCacheEntries &&
+        generation == its.translationCacheGeneration) {
+        if (its.translationCache.size() >= its.translationCacheEntries)
+            its.translationCache.clear();
+        its.translationCache.emplace(key, result);
+    }
+
+    return result;
 }
 
 ItsCommand::DispatchTable ItsCommand::cmdDispatcher =
@@ -790,6 +812,8 @@ Gicv3Its::Gicv3Its(const Gicv3ItsParams &params)
    requestorId(params.system->getRequestorId(this)),
    gic(nullptr),
    commandEvent([this] { checkCommandQueue(); }, name()),
+   translationCacheEntries(params.translation_cache_entries),
+   translationCacheGeneration(0),
    pendingCommands(false),
    pendingTranslations(0)
 {
@@ -906,10 +930,9 @@ Gicv3Its::write(PacketPtr pkt)
       case GITS_CTLR:
         assert(pkt->getSize() == sizeof(uint32_t));
         gitsControl = (pkt->getLE<uint32_t>() & ~CTLR_QUIESCENT);
-        // We should check here if the ITS has been disabled, and if
-        // that's the case, flush GICv3 caches to external memory.
-        // This is not happening now, since LPI caching is not
-        // currently implemented in gem5.
+        // The translation cache never holds dirty data, flushing it
+        // is enough when the ITS gets disabled.
+        invalidateTranslationCache();
         break;
 
       case GITS_IIDR:
@@ -978,6 +1001,7 @@ Gicv3Its::write(PacketPtr pkt)
             const uint64_t val = pkt->getLE<uint64_t>() & w_mask;
 
             tableBases[baser_index] = table_base | val;
+            invalidateTranslationCache();
             break;
         } else {
             panic("Unrecognized register access\n");
@@ -1271,6 +1295,13 @@ Gicv3Its::pageAddress(Gicv3Its::ItsTables table)
     }
 }
 
+void
+Gicv3Its::invalidateTranslationCache()
+{
+    translationCache.clear();
+    translationCacheGeneration++;
+}
+
 void
 Gicv3Its::moveAllPendingState(
     Gicv3Redistributor *rd1, Gicv3Redistributor *rd2)
@@ -1292,6 +1323,9 @@ Gicv3Its::moveAllPendingState(
         rd1->lpiPendingTablePtr,
         0, sizeof(lpi_pending_table));
 
+    rd1->pendingLPIsValid = false;
+    rd2->pendingLPIsValid = false;
+
     rd2->updateDistributor();
 }
 
@@ -41,6 +41,7 @@
 #include <cstdint>
 #include <memory>
 #include <queue>
+#include <unordered_map>
 #include <vector>
 
 #include "base/addr_range.hh"
@@ -327,6 +328,36 @@ class Gicv3Its : public BasicPioDevice
     void moveAllPendingState(
         Gicv3Redistributor *rd1, Gicv3Redistributor *rd2);
 
+    /** Result of the translation of a DeviceID/EventID pair */
+    using Translation = std::pair<uint32_t, Gicv3Redistributor *>;
+
+    static uint64_t
+    translationKey(uint32_t device_id, uint32_t event_id)
+    {
+        return (uint64_t)device_id << 32 | event_id;
+    }
+
+    /**
+     * Flushes the translation cache. To be called once the ITS tables
+     * have been modified, or could be looked up elsewhere.
+     */
+    void invalidateTranslationCache();
+
+    /**
+     * Translations of the recently signalled DeviceID/EventID pairs, which
+     * saves MSIs the walk of the device, interrupt translation and
+     * collection tables.
+     */
+    std::unordered_map<uint64_t, Translation> translationCache;
+    const unsigned translationCacheEntries;
+
+    /**
+     * Incremented each time the cache is flushed, so that a translation
+     * which walked the tables before an update does not insert stale
+     * results in the cache.
+     */
+    uint64_t translationCacheGeneration;
+
   private:
     std::queue<ItsAction> packetsToRetry;
     uint32_t requestorId;
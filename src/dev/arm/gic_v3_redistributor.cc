@@ -41,6 +41,7 @@
 #include "dev/arm/gic_v3_redistributor.hh"
 
 #include "arch/arm/utility.hh"
+#include "base/bitfield.hh"
 #include "base/compiler.hh"
 #include "debug/GIC.hh"
 #include "dev/arm/gic_v3_cpu_interface.hh"
@@ -77,6 +78,7 @@ Gicv3Redistributor::Gicv3Redistributor(Gicv3 * gic, uint32_t cpu_id)
       lpiConfigurationTablePtr(0),
       lpiIDBits(0),
       lpiPendingTablePtr(0),
+      pendingLPIsValid(false),
       addrRangeSize(gic->params().gicv4 ? 0x40000 : 0x20000)
 {
 }
@@ -414,6 +416,7 @@ Gicv3Redistributor::write(Addr addr, uint64_t data, size_t size,
       case GICR_CTLR: {
           // GICR_TYPER.LPIS is 0 so EnableLPIs is RES0
           EnableLPIs = data & GICR_CTLR_ENABLE_LPIS;
+          pendingLPIsValid = false;
           DPG1S = data & GICR_CTLR_DPG1S;
           DPG1NS = data & GICR_CTLR_DPG1NS;
           DPG0 = data & GICR_CTLR_DPG0;
@@ -674,6 +677,8 @@ Gicv3Redistributor::write(Addr addr, uint64_t data, size_t size,
               lpiIDBits = 0xf;
           }
 
+          pendingLPIsValid = false;
+
           break;
       }
 
@@ -691,6 +696,7 @@ Gicv3Redistributor::write(Addr addr, uint64_t data, size_t size,
         // InnerCache, bits [9:7]
         //   000 Device-nGnRnE
         lpiPendingTablePtr = data & 0xFFFFFFFFF0000;
+        pendingLPIsValid = false;
         break;
 
       case GICR_INVLPIR: { // Redistributor Invalidate LPI Register
@@ -827,40 +833,30 @@ Gicv3Redistributor::update()
 
     // Check LPIs
     if (EnableLPIs) {
+        if (!pendingLPIsValid)
+            loadPendingLPIs();
 
         const uint32_t largest_lpi_id = 1 << (lpiIDBits + 1);
-        const uint32_t number_lpis = largest_lpi_id - SMALLEST_LPI_ID + 1;
-
-        uint8_t lpi_pending_table[largest_lpi_id / 8];
-        uint8_t lpi_config_table[number_lpis];
-
-        memProxy->readBlob(lpiPendingTablePtr,
-                           lpi_pending_table,
-                           sizeof(lpi_pending_table));
-
-        memProxy->readBlob(lpiConfigurationTablePtr,
-                           lpi_config_table,
-                           sizeof(lpi_config_table));
-
-        for (int lpi_id = SMALLEST_LPI_ID; lpi_id < largest_lpi_id;
-             lpi_id++) {
-            uint32_t lpi_pending_entry_byte = lpi_id / 8;
-            uint8_t lpi_pending_entry_bit_position = lpi_id % 8;
-            bool lpi_is_pending = lpi_pending_table[lpi_pending_entry_byte] &
-                                  1 << lpi_pending_entry_bit_position;
-            uint32_t lpi_configuration_entry_index = lpi_id - SMALLEST_LPI_ID;
 
-            LPIConfigurationTableEntry config_entry =
-                lpi_config_table[lpi_configuration_entry_index];
-
-            bool lpi_is_enable = config_entry.enable;
-
-            // LPIs are always Non-secure Group 1 interrupts,
-            // in a system where two Security states are enabled.
-            Gicv3::GroupId lpi_group = Gicv3::G1NS;
-            bool group_enabled = distributor->groupEnabled(lpi_group);
-
-            if (lpi_is_pending && lpi_is_enable && group_enabled) {
+        // LPIs are always Non-secure Group 1 interrupts,
+        // in a system where two Security states are enabled.
+        Gicv3::GroupId lpi_group = Gicv3::G1NS;
+        bool group_enabled = distributor->groupEnabled(lpi_group);
+
+        // Only the configuration of pending LPIs is fetched from memory
+        for (auto it = pendingLPIs.lower_bound(SMALLEST_LPI_ID);
+             group_enabled && it != pendingLPIs.end() &&
+                 *it < largest_lpi_id;
+             ++it) {
+            const uint32_t lpi_id = *it;
+
+            uint8_t lpi_config;
+            memProxy->readBlob(lpiConfigurationTablePtr +
+                               (lpi_id - SMALLEST_LPI_ID),
+                               &lpi_config, sizeof(lpi_config));
+            LPIConfigurationTableEntry config_entry = lpi_config;
+
+            if (config_entry.enable) {
                 uint8_t lpi_priority = config_entry.priority << 2;
 
                 if ((lpi_priority < cpuInterface->hppi.prio) ||
@@ -884,6 +880,25 @@ Gicv3Redistributor::update()
     }
 }
 
+void
+Gicv3Redistributor::loadPendingLPIs()
+{
+    const uint32_t largest_lpi_id = 1 << (lpiIDBits + 1);
+    std::vector<uint8_t> lpi_pending_table(largest_lpi_id / 8);
+
+    memProxy->readBlob(lpiPendingTablePtr, lpi_pending_table.data(),
+                       lpi_pending_table.size());
+
+    pendingLPIs.clear();
+    for (uint32_t byte = 0; byte < lpi_pending_table.size(); byte++) {
+        for (uint8_t entry = lpi_pending_table[byte]; entry;
+             entry &= entry - 1) {
+            pendingLPIs.insert(byte * 8 + findLsbSet(entry));
+        }
+    }
+    pendingLPIsValid = true;
+}
+
 uint8_t
 Gicv3Redistributor::readEntryLPI(uint32_t lpi_id)
 {
@@ -910,6 +925,9 @@ Gicv3Redistributor::writeEntryLPI(uint32_t lpi_id, uint8_t lpi_pending_entry)
 bool
 Gicv3Redistributor::isPendingLPI(uint32_t lpi_id)
 {
+    if (pendingLPIsValid)
+        return pendingLPIs.count(lpi_id);
+
     // Fetch the LPI pending entry from memory
     uint8_t lpi_pending_entry = readEntryLPI(lpi_id);
 
@@ -966,6 +984,13 @@ Gicv3Redistributor::setClrLPI(uint64_t data, bool set)
 
     writeEntryLPI(lpi_id, lpi_pending_entry);
 
+    if (pendingLPIsValid) {
+        if (set)
+            pendingLPIs.insert(lpi_id);
+        else
+            pendingLPIs.erase(lpi_id);
+    }
+
     updateDistributor();
 }
 
@@ -1113,6 +1138,7 @@ Gicv3Redistributor::unserialize(CheckpointIn & cp)
     UNSERIALIZE_SCALAR(lpiConfigurationTablePtr);
     UNSERIALIZE_SCALAR(lpiIDBits);
     UNSERIALIZE_SCALAR(lpiPendingTablePtr);
+    pendingLPIsValid = false;
 }
 
 } // namespace gem5
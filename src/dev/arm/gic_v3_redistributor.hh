@@ -41,6 +41,8 @@
 #ifndef __DEV_ARM_GICV3_REDISTRIBUTOR_H__
 #define __DEV_ARM_GICV3_REDISTRIBUTOR_H__
 
+#include <set>
+
 #include "base/addr_range.hh"
 #include "dev/arm/gic_v3.hh"
 #include "sim/serialize.hh"
@@ -175,6 +177,15 @@ class Gicv3Redistributor : public Serializable
     uint8_t lpiIDBits;
     Addr lpiPendingTablePtr;
 
+    /**
+     * Pending LPIs, mirroring the pending table in memory so that update()
+     * does not have to scan it. It is rebuilt from memory when the table
+     * changes location or could have been written by software, namely
+     * while LPIs are disabled.
+     */
+    std::set<uint32_t> pendingLPIs;
+    bool pendingLPIsValid;
+
     BitUnion8(LPIConfigurationTableEntry)
         Bitfield<7, 2> priority;
         Bitfield<1> res1;
@@ -218,6 +229,7 @@ class Gicv3Redistributor : public Serializable
 
     Gicv3::GroupId getIntGroup(int int_id) const;
     Gicv3::IntStatus intStatus(uint32_t int_id) const;
+    void loadPendingLPIs();
     uint8_t readEntryLPI(uint32_t intid);
     void writeEntryLPI(uint32_t intid, uint8_t lpi_entry);
     bool isPendingLPI(uint32_t intid);
@@ -65,6 +65,7 @@ HDLcd::HDLcd(const HDLcdParams &p)
       workaroundDmaLineCount(p.workaround_dma_line_count),
       addrRanges{RangeSize(pioAddr, pioSize)},
       enableCapture(p.enable_capture),
+      skipUnusedFrames(p.skip_unused_frames),
       pixelBufferSize(p.pixel_buffer_size),
       virtRefreshRate(p.virt_refresh_rate),
 
@@ -537,6 +538,11 @@ HDLcd::pxlVSyncBegin()
 void
 HDLcd::pxlVSyncEnd()
 {
+    if (pixelPump.skippingFrame()) {
+        DPRINTF(HDLcd, "End of VSYNC, skipping unused frame\n");
+        return;
+    }
+
     DPRINTF(HDLcd, "End of VSYNC, starting DMA engine\n");
     if (sys->bypassCaches()) {
         bypassLineAddress = fb_base;
@@ -584,6 +590,12 @@ HDLcd::pxlFrameDone()
     }
 }
 
+bool
+HDLcd::pxlWantFrame()
+{
+    return !skipUnusedFrames || enableCapture || (vnc && vnc->wantsFrames());
+}
+
 void
 HDLcd::setInterrupts(uint32_t ints, uint32_t mask)
 {
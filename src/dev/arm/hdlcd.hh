@@ -113,6 +113,7 @@ class HDLcd: public AmbaDmaDevice
     const bool workaroundDmaLineCount;
     const AddrRangeList addrRanges;
     const bool enableCapture;
+    const bool skipUnusedFrames;
     const Addr pixelBufferSize;
     const Tick virtRefreshRate;
 
@@ -279,6 +280,7 @@ class HDLcd: public AmbaDmaDevice
     void pxlVSyncEnd();
     void pxlUnderrun();
     void pxlFrameDone();
+    bool pxlWantFrame();
 
   protected: // Interrupt handling
     /**
@@ -358,6 +360,7 @@ class HDLcd: public AmbaDmaDevice
         }
 
         void onFrameDone() override { parent.pxlFrameDone(); }
+        bool wantFrame() override { return parent.pxlWantFrame(); }
 
       protected:
         HDLcd &parent;
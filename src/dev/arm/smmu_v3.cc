@@ -339,7 +339,7 @@ SMMUv3::runProcessTiming(SMMUProcess *proc, PacketPtr pkt)
             assert(action.ifc);
             action.ifc->schedTimingResp(action.pkt);
 
-            delete proc;
+            proc->retire();
             break;
 
         case ACTION_SEND_RESP_ATS:
@@ -352,7 +352,7 @@ SMMUv3::runProcessTiming(SMMUProcess *proc, PacketPtr pkt)
             assert(action.ifc);
             action.ifc->schedAtsTimingResp(action.pkt);
 
-            delete proc;
+            proc->retire();
             break;
 
         case ACTION_DELAY:
@@ -360,7 +360,7 @@ SMMUv3::runProcessTiming(SMMUProcess *proc, PacketPtr pkt)
             break;
 
         case ACTION_TERMINATE:
-            delete proc;
+            proc->retire();
             break;
 
         default:
@@ -176,8 +176,7 @@ SMMUTLB::SMMUTLB(unsigned numEntries, unsigned _associativity,
     Entry e;
     e.valid = false;
 
-    Set set(associativity, e);
-    sets.resize(num_sets, set);
+    sets.resize(num_sets, associativity, e);
 }
 
 const SMMUTLB::Entry*
@@ -186,7 +185,7 @@ SMMUTLB::lookup(uint32_t sid, uint32_t ssid,
 {
     const Entry *result = NULL;
 
-    Set &set = sets[pickSetIdx(va)];
+    Set set = sets[pickSetIdx(va)];
 
     for (size_t i = 0; i < set.size(); i++) {
         const Entry &e = set[i];
@@ -220,7 +219,7 @@ SMMUTLB::lookupAnyVA(uint32_t sid, uint32_t ssid, bool updStats)
     const Entry *result = NULL;
 
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             const Entry &e = set[i];
@@ -255,7 +254,7 @@ SMMUTLB::store(const Entry &incoming, AllocPolicy alloc)
     if (existing) {
         *const_cast<Entry *> (existing) = incoming;
     } else {
-        Set &set = sets[pickSetIdx(incoming.va)];
+        Set set = sets[pickSetIdx(incoming.va)];
         set[pickEntryIdxToReplace(set, alloc)] = incoming;
     }
 
@@ -265,7 +264,7 @@ SMMUTLB::store(const Entry &incoming, AllocPolicy alloc)
 void
 SMMUTLB::invalidateSSID(uint32_t sid, uint32_t ssid)
 {
-    Set &set = sets[pickSetIdx(sid, ssid)];
+    Set set = sets[pickSetIdx(sid, ssid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         Entry &e = set[i];
@@ -279,7 +278,7 @@ void
 SMMUTLB::invalidateSID(uint32_t sid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -293,7 +292,7 @@ SMMUTLB::invalidateSID(uint32_t sid)
 void
 SMMUTLB::invalidateVA(Addr va, uint16_t asid, uint16_t vmid)
 {
-    Set &set = sets[pickSetIdx(va)];
+    Set set = sets[pickSetIdx(va)];
 
     for (size_t i = 0; i < set.size(); i++) {
         Entry &e = set[i];
@@ -309,7 +308,7 @@ SMMUTLB::invalidateVA(Addr va, uint16_t asid, uint16_t vmid)
 void
 SMMUTLB::invalidateVAA(Addr va, uint16_t vmid)
 {
-    Set &set = sets[pickSetIdx(va)];
+    Set set = sets[pickSetIdx(va)];
 
     for (size_t i = 0; i < set.size(); i++) {
         Entry &e = set[i];
@@ -323,7 +322,7 @@ void
 SMMUTLB::invalidateASID(uint16_t asid, uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -338,7 +337,7 @@ void
 SMMUTLB::invalidateVMID(uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -353,7 +352,7 @@ void
 SMMUTLB::invalidateAll()
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++)
             set[i].valid = false;
@@ -456,8 +455,7 @@ ARMArchTLB::ARMArchTLB(unsigned numEntries, unsigned _associativity,
     Entry e;
     e.valid = false;
 
-    Set set(associativity, e);
-    sets.resize(num_sets, set);
+    sets.resize(num_sets, associativity, e);
 }
 
 const ARMArchTLB::Entry *
@@ -465,7 +463,7 @@ ARMArchTLB::lookup(Addr va, uint16_t asid, uint16_t vmid, bool updStats)
 {
     const Entry *result = NULL;
 
-    Set &set = sets[pickSetIdx(va, asid, vmid)];
+    Set set = sets[pickSetIdx(va, asid, vmid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         const Entry &e = set[i];
@@ -507,7 +505,7 @@ ARMArchTLB::store(const Entry &incoming)
     if (existing) {
         *const_cast<Entry *> (existing) = incoming;
     } else {
-        Set &set = sets[pickSetIdx(incoming.va, incoming.asid, incoming.vmid)];
+        Set set = sets[pickSetIdx(incoming.va, incoming.asid, incoming.vmid)];
         set[pickEntryIdxToReplace(set)] = incoming;
     }
 
@@ -517,7 +515,7 @@ ARMArchTLB::store(const Entry &incoming)
 void
 ARMArchTLB::invalidateVA(Addr va, uint16_t asid, uint16_t vmid)
 {
-    Set &set = sets[pickSetIdx(va, asid, vmid)];
+    Set set = sets[pickSetIdx(va, asid, vmid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         Entry &e = set[i];
@@ -534,7 +532,7 @@ void
 ARMArchTLB::invalidateVAA(Addr va, uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -549,7 +547,7 @@ void
 ARMArchTLB::invalidateASID(uint16_t asid, uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -564,7 +562,7 @@ void
 ARMArchTLB::invalidateVMID(uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -579,7 +577,7 @@ void
 ARMArchTLB::invalidateAll()
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++)
             set[i].valid = false;
@@ -655,8 +653,7 @@ IPACache::IPACache(unsigned numEntries, unsigned _associativity,
     Entry e;
     e.valid = false;
 
-    Set set(associativity, e);
-    sets.resize(num_sets, set);
+    sets.resize(num_sets, associativity, e);
 }
 
 const IPACache::Entry*
@@ -664,7 +661,7 @@ IPACache::lookup(Addr ipa, uint16_t vmid, bool updStats)
 {
     const Entry *result = NULL;
 
-    Set &set = sets[pickSetIdx(ipa, vmid)];
+    Set set = sets[pickSetIdx(ipa, vmid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         const Entry &e = set[i];
@@ -705,7 +702,7 @@ IPACache::store(const Entry &incoming)
     if (existing) {
         *const_cast<Entry *> (existing) = incoming;
     } else {
-        Set &set = sets[pickSetIdx(incoming.ipa, incoming.vmid)];
+        Set set = sets[pickSetIdx(incoming.ipa, incoming.vmid)];
         set[pickEntryIdxToReplace(set)] = incoming;
     }
 
@@ -715,7 +712,7 @@ IPACache::store(const Entry &incoming)
 void
 IPACache::invalidateIPA(Addr ipa, uint16_t vmid)
 {
-    Set &set = sets[pickSetIdx(ipa, vmid)];
+    Set set = sets[pickSetIdx(ipa, vmid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         Entry &e = set[i];
@@ -729,7 +726,7 @@ void
 IPACache::invalidateIPAA(Addr ipa)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -744,7 +741,7 @@ void
 IPACache::invalidateVMID(uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -759,7 +756,7 @@ void
 IPACache::invalidateAll()
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++)
             set[i].valid = false;
@@ -835,8 +832,7 @@ ConfigCache::ConfigCache(unsigned numEntries, unsigned _associativity,
     Entry e;
     e.valid = false;
 
-    Set set(associativity, e);
-    sets.resize(num_sets, set);
+    sets.resize(num_sets, associativity, e);
 }
 
 const ConfigCache::Entry *
@@ -844,7 +840,7 @@ ConfigCache::lookup(uint32_t sid, uint32_t ssid, bool updStats)
 {
     const Entry *result = NULL;
 
-    Set &set = sets[pickSetIdx(sid, ssid)];
+    Set set = sets[pickSetIdx(sid, ssid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         const Entry &e = set[i];
@@ -884,7 +880,7 @@ ConfigCache::store(const Entry &incoming)
     if (existing) {
         *const_cast<Entry *> (existing) = incoming;
     } else {
-        Set &set = sets[pickSetIdx(incoming.sid, incoming.ssid)];
+        Set set = sets[pickSetIdx(incoming.sid, incoming.ssid)];
         set[pickEntryIdxToReplace(set)] = incoming;
     }
 
@@ -894,7 +890,7 @@ ConfigCache::store(const Entry &incoming)
 void
 ConfigCache::invalidateSSID(uint32_t sid, uint32_t ssid)
 {
-    Set &set = sets[pickSetIdx(sid, ssid)];
+    Set set = sets[pickSetIdx(sid, ssid)];
 
     for (size_t i = 0; i < set.size(); i++) {
         Entry &e = set[i];
@@ -908,7 +904,7 @@ void
 ConfigCache::invalidateSID(uint32_t sid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -923,7 +919,7 @@ void
 ConfigCache::invalidateAll()
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++)
             set[i].valid = false;
@@ -1013,8 +1009,7 @@ WalkCache::WalkCache(const std::array<unsigned, 2*WALK_CACHE_LEVELS> &_sizes,
     Entry e;
     e.valid = false;
 
-    Set set(associativity, e);
-    sets.resize(num_sets, set);
+    sets.resize(num_sets, associativity, e);
 }
 
 const WalkCache::Entry*
@@ -1025,7 +1020,7 @@ WalkCache::lookup(Addr va, Addr vaMask,
 {
     const Entry *result = NULL;
 
-    Set &set = sets[pickSetIdx(va, vaMask, stage, level)];
+    Set set = sets[pickSetIdx(va, vaMask, stage, level)];
 
     for (size_t i = 0; i < set.size(); i++) {
         const Entry &e = set[i];
@@ -1076,7 +1071,7 @@ WalkCache::store(const Entry &incoming)
     if (existing) {
         *const_cast<Entry *> (existing) = incoming;
     } else {
-        Set &set = sets[pickSetIdx(incoming.va, incoming.vaMask,
+        Set set = sets[pickSetIdx(incoming.va, incoming.vaMask,
                                    incoming.stage, incoming.level)];
         set[pickEntryIdxToReplace(set, incoming.stage, incoming.level)] =
             incoming;
@@ -1092,7 +1087,7 @@ WalkCache::invalidateVA(Addr va, uint16_t asid, uint16_t vmid,
                         const bool leaf_only)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -1110,7 +1105,7 @@ void
 WalkCache::invalidateVAA(Addr va, uint16_t vmid, const bool leaf_only)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -1128,7 +1123,7 @@ void
 WalkCache::invalidateASID(uint16_t asid, uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -1143,7 +1138,7 @@ void
 WalkCache::invalidateVMID(uint16_t vmid)
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++) {
             Entry &e = set[i];
@@ -1158,7 +1153,7 @@ void
 WalkCache::invalidateAll()
 {
     for (size_t s = 0; s < sets.size(); s++) {
-        Set &set = sets[s];
+        Set set = sets[s];
 
         for (size_t i = 0; i < set.size(); i++)
             set[i].valid = false;
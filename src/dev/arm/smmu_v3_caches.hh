@@ -61,6 +61,46 @@ enum
     SMMU_CACHE_REPL_LRU,
 };
 
+/**
+ * Storage of a set associative cache, with all its entries packed in a
+ * single array, set after set, rather than one allocation per set.
+ */
+template <typename Entry>
+class SMMUCacheSets
+{
+  public:
+    /** A set of the cache, made of consecutive entries of the array */
+    class Set
+    {
+      public:
+        Set(Entry *_entries, size_t _ways) : entries(_entries), ways(_ways)
+        {}
+
+        Entry &operator[](size_t i) const { return entries[i]; }
+        size_t size() const { return ways; }
+
+      private:
+        Entry *entries;
+        size_t ways;
+    };
+
+    void
+    resize(size_t num_sets, size_t _ways, const Entry &e)
+    {
+        numSets = num_sets;
+        ways = _ways;
+        entries.assign(num_sets * ways, e);
+    }
+
+    Set operator[](size_t i) { return Set(&entries[i * ways], ways); }
+    size_t size() const { return numSets; }
+
+  private:
+    std::vector<Entry> entries;
+    size_t numSets = 0;
+    size_t ways = 0;
+};
+
 class SMMUv3BaseCache
 {
   protected:
@@ -148,8 +188,8 @@ class SMMUTLB : public SMMUv3BaseCache
     void invalidateAll();
 
   private:
-    typedef std::vector<Entry> Set;
-    std::vector<Set> sets;
+    typedef SMMUCacheSets<Entry>::Set Set;
+    SMMUCacheSets<Entry> sets;
 
     size_t associativity;
 
@@ -193,8 +233,8 @@ class ARMArchTLB : public SMMUv3BaseCache
     void invalidateAll();
 
   private:
-    typedef std::vector<Entry> Set;
-    std::vector<Set> sets;
+    typedef SMMUCacheSets<Entry>::Set Set;
+    SMMUCacheSets<Entry> sets;
 
     size_t associativity;
 
@@ -233,8 +273,8 @@ class IPACache : public SMMUv3BaseCache
     void invalidateAll();
 
   private:
-    typedef std::vector<Entry> Set;
-    std::vector<Set> sets;
+    typedef SMMUCacheSets<Entry>::Set Set;
+    SMMUCacheSets<Entry> sets;
 
     size_t associativity;
 
@@ -280,8 +320,8 @@ class ConfigCache : public SMMUv3BaseCache
     void invalidateAll();
 
   private:
-    typedef std::vector<Entry> Set;
-    std::vector<Set> sets;
+    typedef SMMUCacheSets<Entry>::Set Set;
+    SMMUCacheSets<Entry> sets;
 
     size_t associativity;
 
@@ -347,8 +387,8 @@ class WalkCache : public SMMUv3BaseCache
         statistics::Vector2d insertionsByStageLevel;
     } walkCacheStats;
   private:
-    typedef std::vector<Entry> Set;
-    std::vector<Set> sets;
+    typedef SMMUCacheSets<Entry>::Set Set;
+    SMMUCacheSets<Entry> sets;
 
     size_t associativity;
     std::array<unsigned, 2*WALK_CACHE_LEVELS> sizes;
@@ -81,6 +81,14 @@ SMMUv3DeviceInterface::SMMUv3DeviceInterface(
     atsSendDeviceRetryEvent(*this)
 {}
 
+SMMUv3DeviceInterface::~SMMUv3DeviceInterface()
+{
+    for (auto proc : retiredProcs)
+        delete proc;
+    delete microTLB;
+    delete mainTLB;
+}
+
 void
 SMMUv3DeviceInterface::sendRange()
 {
@@ -164,7 +172,7 @@ SMMUv3DeviceInterface::recvTimingReq(PacketPtr pkt)
 
     std::string proc_name = csprintf("%s.port", name());
     SMMUTranslationProcess *proc =
-        new SMMUTranslationProcess(proc_name, *smmu, *this);
+        SMMUTranslationProcess::create(proc_name, *smmu, *this);
     proc->beginTransaction(SMMUTranslRequest::fromPacket(pkt));
 
     smmu->runProcessTiming(proc, pkt);
@@ -207,7 +215,7 @@ SMMUv3DeviceInterface::atsRecvTimingReq(PacketPtr pkt)
     std::string proc_name = csprintf("%s.atsport", name());
     const bool ats_request = true;
     SMMUTranslationProcess *proc =
-        new SMMUTranslationProcess(proc_name, *smmu, *this);
+        SMMUTranslationProcess::create(proc_name, *smmu, *this);
     proc->beginTransaction(SMMUTranslRequest::fromPacket(pkt, ats_request));
 
     smmu->runProcessTiming(proc, pkt);
@@ -39,6 +39,7 @@
 #define __DEV_ARM_SMMU_V3_DEVICEIFC_HH__
 
 #include <list>
+#include <vector>
 
 #include "dev/arm/smmu_v3_caches.hh"
 #include "dev/arm/smmu_v3_defs.hh"
@@ -96,6 +97,12 @@ class SMMUv3DeviceInterface : public ClockedObject
     std::list<SMMUTranslationProcess *> dependentWrites[SMMU_MAX_TRANS_ID];
     SMMUSignal dependentReqRemoved;
 
+    /**
+     * Translation processes done with their transaction, kept to spare
+     * allocating a process, and its coroutine stack, per transaction.
+     */
+    std::vector<SMMUTranslationProcess *> retiredProcs;
+
     // Receiving translation requests from the requestor device
     Tick recvAtomic(PacketPtr pkt);
     bool recvTimingReq(PacketPtr pkt);
@@ -122,11 +129,7 @@ class SMMUv3DeviceInterface : public ClockedObject
     PARAMS(SMMUv3DeviceInterface);
     SMMUv3DeviceInterface(const Params &p);
 
-    ~SMMUv3DeviceInterface()
-    {
-        delete microTLB;
-        delete mainTLB;
-    }
+    ~SMMUv3DeviceInterface();
 
     DrainState drain() override;
 
@@ -66,9 +66,12 @@ SMMUProcess::wakeup()
 void
 SMMUProcess::reinit()
 {
-    delete coroutine;
-    coroutine = new Coroutine(
-        std::bind(&SMMUProcess::main, this, std::placeholders::_1));
+    if (coroutine) {
+        coroutine->restart();
+    } else {
+        coroutine = new Coroutine(
+            std::bind(&SMMUProcess::main, this, std::placeholders::_1));
+    }
 }
 
 void
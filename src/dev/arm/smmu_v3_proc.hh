@@ -109,8 +109,14 @@ class SMMUProcess : public Packet::SenderState
 
     SMMUv3 &smmu;
 
+    /**
+     * Run main() from its start, reusing the coroutine stack of any
+     * previous run.
+     */
     void reinit();
 
+    void setName(const std::string &name) { myName = name; }
+
     virtual void main(Yield &yield) = 0;
 
     void doRead(Yield &yield, Addr addr, void *ptr, size_t size);
@@ -132,6 +138,12 @@ class SMMUProcess : public Packet::SenderState
 
     SMMUAction run(PacketPtr pkt);
 
+    /**
+     * Called once the process is done with, which deletes it unless it
+     * can be reused.
+     */
+    virtual void retire() { delete this; }
+
     const std::string name() const { return myName; };
 };
 
@@ -87,21 +87,59 @@ SMMUTranslationProcess::SMMUTranslationProcess(const std::string &name,
     SMMUv3 &_smmu, SMMUv3DeviceInterface &_ifc)
   :
     SMMUProcess(name, _smmu),
-    ifc(_ifc)
+    ifc(_ifc),
+    acquired(false)
+{
+    // The coroutine is created by beginTransaction()
+    acquire();
+}
+
+SMMUTranslationProcess::~SMMUTranslationProcess()
+{
+    if (acquired)
+        release();
+}
+
+SMMUTranslationProcess *
+SMMUTranslationProcess::create(const std::string &name, SMMUv3 &smmu,
+                               SMMUv3DeviceInterface &ifc)
+{
+    if (ifc.retiredProcs.empty())
+        return new SMMUTranslationProcess(name, smmu, ifc);
+
+    SMMUTranslationProcess *proc = ifc.retiredProcs.back();
+    ifc.retiredProcs.pop_back();
+    assert(&proc->smmu == &smmu);
+    proc->setName(name);
+    proc->acquire();
+    return proc;
+}
+
+void
+SMMUTranslationProcess::retire()
+{
+    release();
+    ifc.retiredProcs.push_back(this);
+}
+
+void
+SMMUTranslationProcess::acquire()
 {
     // Decrease number of pending translation slots on the device interface
     assert(ifc.xlateSlotsRemaining > 0);
     ifc.xlateSlotsRemaining--;
 
     ifc.pendingMemAccesses++;
-    reinit();
+    acquired = true;
 }
 
-SMMUTranslationProcess::~SMMUTranslationProcess()
+void
+SMMUTranslationProcess::release()
 {
     // Increase number of pending translation slots on the device interface
     assert(ifc.pendingMemAccesses > 0);
     ifc.pendingMemAccesses--;
+    acquired = false;
 
     // If no more SMMU memory accesses are pending,
     // signal SMMU Device Interface as drained
@@ -1224,7 +1262,7 @@ SMMUTranslationProcess::issuePrefetch(Addr addr)
 
     std::string proc_name = csprintf("%sprf", name());
     SMMUTranslationProcess *proc =
-        new SMMUTranslationProcess(proc_name, smmu, ifc);
+        SMMUTranslationProcess::create(proc_name, smmu, ifc);
 
     proc->beginTransaction(
             SMMUTranslRequest::prefetch(addr, request.sid, request.ssid));
@@ -237,12 +237,28 @@ class SMMUTranslationProcess : public SMMUProcess
     void doReadPTE(Yield &yield, Addr va, Addr addr, void *ptr,
                    unsigned stage, unsigned level);
 
+    /** Whether the process holds a translation slot of ifc */
+    bool acquired;
+
+    void acquire();
+    void release();
+
   public:
     SMMUTranslationProcess(const std::string &name, SMMUv3 &_smmu,
         SMMUv3DeviceInterface &_ifc);
 
     virtual ~SMMUTranslationProcess();
 
+    /**
+     * Get a process for a new transaction of a device interface, which
+     * is one of its retired processes if it has any.
+     */
+    static SMMUTranslationProcess *create(const std::string &name,
+        SMMUv3 &smmu, SMMUv3DeviceInterface &ifc);
+
+    /** Give the process back to its device interface for reuse */
+    void retire() override;
+
     void beginTransaction(const SMMUTranslRequest &req);
     void resumeTransaction();
 };
@@ -56,11 +56,13 @@ namespace gem5
 {
 
 DmaPort::DmaPort(ClockedObject *dev, System *s,
-                 uint32_t sid, uint32_t ssid)
+                 uint32_t sid, uint32_t ssid,
+                 double backdoor_ticks_per_byte)
     : RequestPort(dev->name() + ".dma"),
       device(dev), sys(s), requestorId(s->getRequestorId(dev)),
       sendEvent([this]{ sendDma(); }, dev->name()),
-      defaultSid(sid), defaultSSid(ssid), cacheLineSize(s->cacheLineSize())
+      defaultSid(sid), defaultSSid(ssid), cacheLineSize(s->cacheLineSize()),
+      backdoorTicksPerByte(backdoor_ticks_per_byte)
 { }
 
 void
@@ -155,7 +157,8 @@ DmaPort::recvTimingResp(PacketPtr pkt)
 }
 
 DmaDevice::DmaDevice(const Params &p)
-    : PioDevice(p), dmaPort(this, sys, p.sid, p.ssid)
+    : PioDevice(p),
+      dmaPort(this, sys, p.sid, p.ssid, p.atomic_dma_bandwidth)
 { }
 
 void
@@ -350,6 +353,7 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
                 state->gen.addr(), state->gen.size());
 
         const auto *bd = bd_it->second;
+        const Addr addr = state->gen.addr();
         // Offset of this access into the backdoor.
         const Addr offset = state->gen.addr() - bd->range().start();
         // How many bytes we still need.
@@ -371,11 +375,16 @@ DmaPort::sendAtomicBdReq(DmaReqState *state)
         }
 
         // Advance the chunk generator past this region of memory.
-        state->gen.setNext(state->gen.addr() + handled);
+        state->gen.setNext(addr + handled);
+
+        // The memory was bypassed, so account for the transfer with the
+        // configured bandwidth. The completion is delayed by the time
+        // taken by all the backdoor transfers of the request.
+        state->backdoorDelay += handled * backdoorTicksPerByte;
 
         // Check if we're done now, since handleResp may delete state.
         done = !state->gen.next();
-        handleResp(state, state->gen.addr(), handled);
+        handleResp(state, addr, handled, state->backdoorDelay);
     }
 
     return done;
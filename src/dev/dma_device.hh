@@ -61,7 +61,7 @@ class ClockedObject;
 class DmaPort : public RequestPort, public Drainable
 {
   private:
-    AddrRangeMap<MemBackdoorPtr, 1> memBackdoors;
+    AddrRangeMap<MemBackdoorPtr> memBackdoors;
 
     /**
      * Take the first request on the transmit list and attempt to send a timing
@@ -100,6 +100,9 @@ class DmaPort : public RequestPort, public Drainable
         /** Amount to delay completion of dma by */
         const Tick delay;
 
+        /** Time taken by the bytes transferred through backdoors. */
+        Tick backdoorDelay = 0;
+
         /** Object to track what chunks of bytes to send at a time. */
         ChunkGenerator gen;
 
@@ -189,6 +192,13 @@ class DmaPort : public RequestPort, public Drainable
 
     const Addr cacheLineSize;
 
+    /**
+     * Ticks per byte for the transfers done through memory backdoors,
+     * which don't see the latency of the memory they bypass. Zero means
+     * they take no time.
+     */
+    const double backdoorTicksPerByte;
+
   protected:
 
     bool recvTimingResp(PacketPtr pkt) override;
@@ -196,7 +206,8 @@ class DmaPort : public RequestPort, public Drainable
 
   public:
 
-    DmaPort(ClockedObject *dev, System *s, uint32_t sid=0, uint32_t ssid=0);
+    DmaPort(ClockedObject *dev, System *s, uint32_t sid=0, uint32_t ssid=0,
+            double backdoor_ticks_per_byte=0);
 
     void
     dmaAction(Packet::Command cmd, Addr addr, int size, Event *event,
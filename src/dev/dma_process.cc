@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/dma_process.hh"
+
+#include "base/logging.hh"
+#include "debug/DMA.hh"
+#include "dev/dma_device.hh"
+
+namespace gem5
+{
+
+DmaProcess::DmaProcess(DmaDevice &dev, const std::string &name)
+    : device(dev), _name(name),
+      resumeEvent([this]{ resume(); }, name + ".resume")
+{ }
+
+DmaProcess::~DmaProcess()
+{
+    panic_if(pendingDmas, "%s: destroyed with DMA transfers in flight.",
+             name());
+    if (resumeEvent.scheduled())
+        device.deschedule(resumeEvent);
+}
+
+void
+DmaProcess::start()
+{
+    if (_running)
+        return;
+
+    DPRINTF(DMA, "%s: starting\n", name());
+    _running = true;
+    if (coroutine) {
+        coroutine->restart(false);
+    } else {
+        coroutine = std::make_unique<Coroutine>(
+            [this](Yield &yield) {
+                main(yield);
+                _running = false;
+            }, false);
+    }
+    resume();
+}
+
+void
+DmaProcess::notify()
+{
+    if (waitingCond && !resumeEvent.scheduled())
+        device.schedule(resumeEvent, curTick());
+}
+
+void
+DmaProcess::suspend(Yield &yield)
+{
+    suspended = true;
+    yield();
+    assert(!suspended);
+}
+
+void
+DmaProcess::resume()
+{
+    assert(coroutine && *coroutine);
+    suspended = false;
+    (*coroutine)();
+}
+
+Event *
+DmaProcess::dmaEvent()
+{
+    if (freeDmaEvents.empty()) {
+        size_t idx = dmaEvents.size();
+        dmaEvents.emplace_back(std::make_unique<EventFunctionWrapper>(
+            [this, idx]{ dmaDone(dmaEvents[idx].get()); }, name() + ".dma"));
+        freeDmaEvents.push_back(dmaEvents.back().get());
+    }
+
+    auto *event = freeDmaEvents.back();
+    freeDmaEvents.pop_back();
+    pendingDmas++;
+    return event;
+}
+
+void
+DmaProcess::dmaDone(EventFunctionWrapper *event)
+{
+    assert(pendingDmas > 0);
+    freeDmaEvents.push_back(event);
+    if (--pendingDmas == 0 && waitingDma)
+        resume();
+}
+
+void
+DmaProcess::dmaReadAsync(Addr addr, int size, uint8_t *data, Tick delay)
+{
+    device.dmaRead(addr, size, dmaEvent(), data, delay);
+}
+
+void
+DmaProcess::dmaWriteAsync(Addr addr, int size, uint8_t *data, Tick delay)
+{
+    device.dmaWrite(addr, size, dmaEvent(), data, delay);
+}
+
+void
+DmaProcess::waitDma(Yield &yield)
+{
+    if (pendingDmas == 0)
+        return;
+
+    waitingDma = true;
+    suspend(yield);
+    waitingDma = false;
+}
+
+void
+DmaProcess::dmaRead(Yield &yield, Addr addr, int size, uint8_t *data,
+                    Tick delay)
+{
+    dmaReadAsync(addr, size, data, delay);
+    waitDma(yield);
+}
+
+void
+DmaProcess::dmaWrite(Yield &yield, Addr addr, int size, uint8_t *data,
+                     Tick delay)
+{
+    dmaWriteAsync(addr, size, data, delay);
+    waitDma(yield);
+}
+
+void
+DmaProcess::delay(Yield &yield, Tick ticks)
+{
+    assert(!resumeEvent.scheduled());
+    device.schedule(resumeEvent, curTick() + ticks);
+    suspend(yield);
+}
+
+void
+DmaProcess::delayCycles(Yield &yield, Cycles cycles)
+{
+    assert(!resumeEvent.scheduled());
+    device.schedule(resumeEvent, device.clockEdge(cycles));
+    suspend(yield);
+}
+
+void
+DmaProcess::waitUntil(Yield &yield, const std::function<bool()> &cond)
+{
+    waitingCond = true;
+    while (!cond())
+        suspend(yield);
+    waitingCond = false;
+
+    // A notification may have come after the condition was last checked.
+    if (resumeEvent.scheduled())
+        device.deschedule(resumeEvent);
+}
+
+} // namespace gem5
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Coroutines for device models, which express the multi step operations
+ * of a device (descriptor fetches, data transfers, waits for registers)
+ * as straight line code rather than as chains of events.
+ */
+
+#ifndef __DEV_DMA_PROCESS_HH__
+#define __DEV_DMA_PROCESS_HH__
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/coroutine.hh"
+#include "base/types.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+class DmaDevice;
+
+/**
+ * A process of a DMA device, run as a coroutine by main(). The process
+ * suspends itself in the helpers below until what it waits for is done,
+ * and it is resumed from an event of the device. The events are owned
+ * by the process and reused, so a transaction doesn't allocate any.
+ *
+ * The state of a process lives on its stack and can't be checkpointed,
+ * so devices shouldn't drain while one of their processes is running.
+ */
+class DmaProcess
+{
+  public:
+    typedef gem5::Coroutine<void, void> Coroutine;
+    typedef Coroutine::CallerType Yield;
+
+    DmaProcess(DmaDevice &dev, const std::string &name);
+    virtual ~DmaProcess();
+
+    DmaProcess(const DmaProcess &) = delete;
+    DmaProcess &operator=(const DmaProcess &) = delete;
+
+    const std::string &name() const { return _name; }
+
+    /** Start main() from its beginning, if the process isn't running. */
+    void start();
+
+    /** Whether main() was started and hasn't returned yet. */
+    bool running() const { return _running; }
+
+    /**
+     * Have a process waiting in waitUntil() check its condition again,
+     * e.g. after a register it polls was written.
+     */
+    void notify();
+
+  protected:
+    /** The body of the process. */
+    virtual void main(Yield &yield) = 0;
+
+    /**
+     * Read from memory through the DMA port of the device and wait for
+     * the data.
+     */
+    void dmaRead(Yield &yield, Addr addr, int size, uint8_t *data,
+                 Tick delay=0);
+
+    /** Write to memory through the DMA port and wait for completion. */
+    void dmaWrite(Yield &yield, Addr addr, int size, uint8_t *data,
+                  Tick delay=0);
+
+    /**
+     * Start a DMA read or write without waiting for it, so that several
+     * transfers are in flight together. waitDma() waits for them.
+     */
+    void dmaReadAsync(Addr addr, int size, uint8_t *data, Tick delay=0);
+    void dmaWriteAsync(Addr addr, int size, uint8_t *data, Tick delay=0);
+
+    /** Wait for all the DMA transfers this process started. */
+    void waitDma(Yield &yield);
+
+    /** The number of DMA transfers of this process in flight. */
+    int dmaPending() const { return pendingDmas; }
+
+    /** Let the given number of ticks pass. */
+    void delay(Yield &yield, Tick ticks);
+
+    /** Let the given number of cycles of the device pass. */
+    void delayCycles(Yield &yield, Cycles cycles);
+
+    /**
+     * Wait until the condition holds. It is checked right away, and
+     * then each time notify() is called.
+     */
+    void waitUntil(Yield &yield, const std::function<bool()> &cond);
+
+    DmaDevice &device;
+
+  private:
+    /** Switch to the event loop until resumed. */
+    void suspend(Yield &yield);
+
+    /** Run the coroutine until it suspends itself again. */
+    void resume();
+
+    /** Get a DMA completion event, reusing a free one if there is any. */
+    Event *dmaEvent();
+
+    void dmaDone(EventFunctionWrapper *event);
+
+    const std::string _name;
+
+    std::unique_ptr<Coroutine> coroutine;
+
+    bool _running = false;
+
+    /** Set while the coroutine is suspended waiting for an event. */
+    bool suspended = false;
+
+    /** Set while suspended in waitDma(). */
+    bool waitingDma = false;
+
+    /** Set while suspended in waitUntil(). */
+    bool waitingCond = false;
+
+    int pendingDmas = 0;
+
+    /** The event of delay() and notify(). */
+    EventFunctionWrapper resumeEvent;
+
+    std::vector<std::unique_ptr<EventFunctionWrapper>> dmaEvents;
+    std::vector<EventFunctionWrapper *> freeDmaEvents;
+};
+
+} // namespace gem5
+
+#endif // __DEV_DMA_PROCESS_HH__
@@ -72,6 +72,17 @@ class EtherLink(SimObject):
     speed = Param.NetworkBandwidth("1Gbps", "link speed")
     dump = Param.EtherDump(NULL, "dump object")
 
+    # The two ends of the link can be simulated on different event
+    # queues, e.g. when each end belongs to a different System running
+    # on its own thread. The delay is then the lookahead between the two
+    # queues, and must not be less than the simulation quantum.
+    int0_eventq_index = Param.UInt32(
+        Self.eventq_index, "Event queue of the interface 0 side"
+    )
+    int1_eventq_index = Param.UInt32(
+        Self.eventq_index, "Event queue of the interface 1 side"
+    )
+
 
 class DistEtherLink(SimObject):
     type = "DistEtherLink"
@@ -92,6 +103,12 @@ class DistEtherLink(SimObject):
     is_switch = Param.Bool(False, "true if this a link in etherswitch")
     dist_sync_on_pseudo_op = Param.Bool(False, "Start sync with pseudo_op")
     num_nodes = Param.UInt32("2", "Number of simulate nodes")
+    shared_memory = Param.Bool(
+        True, "Use shared memory instead of TCP with peers on the same host"
+    )
+    shm_ring_size = Param.MemorySize(
+        "4MiB", "Size of each shared memory ring (switch side)"
+    )
 
 
 class EtherBus(SimObject):
@@ -161,6 +178,9 @@ class EtherDump(SimObject):
 
     file = Param.String("dump file")
     maxlen = Param.Int(96, "max portion of packet data to dump")
+    asynchronous = Param.Bool(
+        True, "Write packets from a separate thread instead of in line"
+    )
 
 
 class EtherDevice(PciDevice):
@@ -93,7 +93,7 @@ DistEtherLink::DistEtherLink(const Params &p)
                              p.dist_rank, p.dist_size,
                              p.sync_start, sync_repeat, this,
                              p.dist_sync_on_pseudo_op, p.is_switch,
-                             p.num_nodes);
+                             p.num_nodes, p.shared_memory, p.shm_ring_size);
 
     localIface = new LocalIface(name() + ".int0", txLink, rxLink, distIface);
 }
@@ -40,6 +40,7 @@
 #include "base/output.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
+#include "sim/sim_exit.hh"
 
 using std::string;
 
@@ -48,8 +49,15 @@ namespace gem5
 
 EtherDump::EtherDump(const Params &p)
     : SimObject(p), stream(simout.create(p.file, true)->stream()),
-      maxlen(p.maxlen)
+      maxlen(p.maxlen), async(p.asynchronous)
 {
+    if (async)
+        registerExitCallback([this]() { stopWriter(); });
+}
+
+EtherDump::~EtherDump()
+{
+    stopWriter();
 }
 
 #define DLT_EN10MB              1               // Ethernet (10Mb)
@@ -92,19 +100,99 @@ EtherDump::init()
     stream->write(reinterpret_cast<char *>(&hdr), sizeof(hdr));
 
     stream->flush();
+
+    if (async)
+        writer = std::thread(&EtherDump::writerMain, this);
 }
 
 void
 EtherDump::dumpPacket(EthPacketPtr &packet)
+{
+    if (!async) {
+        // The links between event queues dump from several threads
+        std::lock_guard<std::mutex> guard(lock);
+        writePacket(curTick(), packet);
+        stream->flush();
+        return;
+    }
+
+    std::lock_guard<std::mutex> guard(lock);
+    queue.push_back({curTick(), packet});
+    if (queue.size() == 1)
+        wakeWriter.notify_one();
+}
+
+void
+EtherDump::writePacket(Tick when, const EthPacketPtr &packet)
 {
     pcap_pkthdr pkthdr;
-    pkthdr.seconds = curTick() / sim_clock::as_int::s;
-    pkthdr.microseconds = (curTick() / sim_clock::as_int::us) % 1000000ULL;
+    pkthdr.seconds = when / sim_clock::as_int::s;
+    pkthdr.microseconds = (when / sim_clock::as_int::us) % 1000000ULL;
     pkthdr.caplen = std::min(packet->length, maxlen);
     pkthdr.len = packet->length;
     stream->write(reinterpret_cast<char *>(&pkthdr), sizeof(pkthdr));
     stream->write(reinterpret_cast<char *>(packet->data), pkthdr.caplen);
-    stream->flush();
+}
+
+void
+EtherDump::writerMain()
+{
+    std::deque<Record> records;
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        wakeWriter.wait(guard, [this]() {
+            return !queue.empty() || stopping; });
+        if (queue.empty())
+            return;
+
+        // Write out everything queued so far in one go, while the
+        // simulation keeps adding packets.
+        records.swap(queue);
+        writing = true;
+        guard.unlock();
+
+        for (const auto &record : records)
+            writePacket(record.when, record.packet);
+        stream->flush();
+        records.clear();
+
+        guard.lock();
+        writing = false;
+        written.notify_all();
+    }
+}
+
+void
+EtherDump::flushQueue()
+{
+    if (!writer.joinable())
+        return;
+
+    std::unique_lock<std::mutex> guard(lock);
+    written.wait(guard, [this]() { return queue.empty() && !writing; });
+}
+
+void
+EtherDump::stopWriter()
+{
+    if (!writer.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+        wakeWriter.notify_one();
+    }
+    writer.join();
+}
+
+DrainState
+EtherDump::drain()
+{
+    // Make sure the trace is complete whenever the simulation stops,
+    // e.g. to take a checkpoint or to inspect the trace.
+    flushQueue();
+    return DrainState::Drained;
 }
 
 } // namespace gem5
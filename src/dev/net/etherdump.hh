@@ -33,7 +33,11 @@
 #ifndef __DEV_NET_ETHERDUMP_HH__
 #define __DEV_NET_ETHERDUMP_HH__
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <mutex>
+#include <thread>
 
 #include "dev/net/etherpkt.hh"
 #include "params/EtherDump.hh"
@@ -44,18 +48,53 @@ namespace gem5
 
 /*
  * Simple object for creating a simple pcap style packet trace
+ *
+ * Unless disabled, packets are written by a separate thread so that
+ * the simulation does not wait for the file system. The queue holds
+ * references to the packets rather than copies of them, which relies
+ * on packets not being modified once they are on the wire.
  */
 class EtherDump : public SimObject
 {
   private:
     std::ostream *stream;
     const unsigned maxlen;
+    const bool async;
+
+    /** A packet waiting for the writer thread */
+    struct Record
+    {
+        Tick when;
+        EthPacketPtr packet;
+    };
+
+    std::thread writer;
+    /** Protects the queue, and the stream when writing synchronously */
+    std::mutex lock;
+    /** Signals new records or a stop request to the writer */
+    std::condition_variable wakeWriter;
+    /** Signals the simulation thread that the queue was written */
+    std::condition_variable written;
+    std::deque<Record> queue;
+    /** Whether the writer is currently writing out records */
+    bool writing = false;
+    bool stopping = false;
+
     void dumpPacket(EthPacketPtr &packet);
-    void init();
+    void writePacket(Tick when, const EthPacketPtr &packet);
+    void writerMain();
+    /** Wait until all queued packets are in the file */
+    void flushQueue();
+    /** Write out all queued packets and stop the writer thread */
+    void stopWriter();
+    void init() override;
 
   public:
     typedef EtherDumpParams Params;
     EtherDump(const Params &p);
+    ~EtherDump();
+
+    DrainState drain() override;
 
     inline void dump(EthPacketPtr &pkt) { dumpPacket(pkt); }
 };
@@ -44,6 +44,7 @@
 
 #include "dev/net/etherlink.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <deque>
@@ -68,10 +69,15 @@ namespace gem5
 EtherLink::EtherLink(const Params &p)
     : SimObject(p)
 {
+    EventQueue *int0_eventq = getEventQueue(p.int0_eventq_index);
+    EventQueue *int1_eventq = getEventQueue(p.int1_eventq_index);
+
     link[0] = new Link(name() + ".link0", this, 0, p.speed,
-                       p.delay, p.delay_var, p.dump);
+                       p.delay, p.delay_var, p.dump,
+                       int0_eventq, int1_eventq);
     link[1] = new Link(name() + ".link1", this, 1, p.speed,
-                       p.delay, p.delay_var, p.dump);
+                       p.delay, p.delay_var, p.dump,
+                       int1_eventq, int0_eventq);
 
     interface[0] = new Interface(name() + ".int0", link[0], link[1]);
     interface[1] = new Interface(name() + ".int1", link[1], link[0]);
@@ -97,6 +103,26 @@ EtherLink::getPort(const std::string &if_name, PortID idx)
     return SimObject::getPort(if_name, idx);
 }
 
+void
+EtherLink::init()
+{
+    SimObject::init();
+
+    if (!link[0]->crossesQueues())
+        return;
+
+    // The link delay is the lookahead between the two sides, which
+    // must cover the longest period the queues run without
+    // synchronizing.
+    const Tick quantum = std::max(simQuantum, simMaxQuantum);
+    fatal_if(quantum == 0, "%s connects different event queues, which "
+             "requires sim_quantum or sim_lookahead to be set.", name());
+    fatal_if(link[0]->delay() < quantum, "The delay of %s (%d ticks) must "
+             "not be less than the simulation quantum (%d ticks), as it "
+             "connects different event queues.", name(), link[0]->delay(),
+             quantum);
+}
+
 
 EtherLink::Interface::Interface(const std::string &name, Link *tx, Link *rx)
     : EtherInt(name), txlink(tx)
@@ -106,9 +132,11 @@ EtherLink::Interface::Interface(const std::string &name, Link *tx, Link *rx)
 }
 
 EtherLink::Link::Link(const std::string &name, EtherLink *p, int num,
-                      double rate, Tick delay, Tick delay_var, EtherDump *d)
+                      double rate, Tick delay, Tick delay_var, EtherDump *d,
+                      EventQueue *tx_eventq, EventQueue *rx_eventq)
     : objName(name), parent(p), number(num), txint(NULL), rxint(NULL),
-      ticksPerByte(rate), linkDelay(delay), delayVar(delay_var), dump(d),
+      txEventq(tx_eventq), rxEventq(rx_eventq), ticksPerByte(rate),
+      linkDelay(delay), delayVar(delay_var), dump(d),
       doneEvent([this]{ txDone(); }, name),
       txQueueEvent([this]{ processTxQueue(); }, name)
 { }
@@ -141,11 +169,19 @@ EtherLink::Link::txDone()
     if (dump)
         dump->dump(packet);
 
-    if (linkDelay > 0) {
+    if (crossesQueues()) {
+        DPRINTF(Ethernet, "packet delayed: delay=%d\n", linkDelay);
+        {
+            std::lock_guard<std::mutex> lock(txQueueMutex);
+            txQueue.emplace_back(std::make_pair(curTick() + linkDelay,
+                                                packet));
+        }
+        scheduleDelivery(curTick() + linkDelay);
+    } else if (linkDelay > 0) {
         DPRINTF(Ethernet, "packet delayed: delay=%d\n", linkDelay);
         txQueue.emplace_back(std::make_pair(curTick() + linkDelay, packet));
         if (!txQueueEvent.scheduled())
-            parent->schedule(txQueueEvent, txQueue.front().first);
+            rxEventq->schedule(&txQueueEvent, txQueue.front().first);
     } else {
         assert(txQueue.empty());
         txComplete(packet);
@@ -167,13 +203,38 @@ EtherLink::Link::processTxQueue()
     if (!txQueue.empty()) {
         auto next(txQueue.front());
         assert(next.first > curTick());
-        parent->schedule(txQueueEvent, next.first);
+        rxEventq->schedule(&txQueueEvent, next.first);
     }
 
     assert(cur.first == curTick());
     txComplete(cur.second);
 }
 
+void
+EtherLink::Link::scheduleDelivery(Tick when)
+{
+    // Scheduling on the receiving queue is an asynchronous insertion,
+    // which is safe since the delay is at least the quantum. The
+    // packets are delivered in order as they all have the same delay.
+    rxEventq->schedule(new EventFunctionWrapper(
+                           [this]{ deliverCrossQueue(); }, name(), true),
+                       when);
+}
+
+void
+EtherLink::Link::deliverCrossQueue()
+{
+    EthPacketPtr pkt;
+    {
+        std::lock_guard<std::mutex> lock(txQueueMutex);
+        assert(!txQueue.empty() && txQueue.front().first == curTick());
+        pkt = txQueue.front().second;
+        txQueue.pop_front();
+    }
+
+    txComplete(pkt);
+}
+
 bool
 EtherLink::Link::transmit(EthPacketPtr pkt)
 {
@@ -192,7 +253,7 @@ EtherLink::Link::transmit(EthPacketPtr pkt)
 
     DPRINTF(Ethernet, "scheduling packet: delay=%d, (rate=%f)\n",
             delay, ticksPerByte);
-    parent->schedule(doneEvent, curTick() + delay);
+    txEventq->schedule(&doneEvent, curTick() + delay);
 
     return true;
 }
@@ -238,7 +299,7 @@ EtherLink::Link::unserialize(const std::string &base, CheckpointIn &cp)
     if (event_scheduled) {
         Tick event_time;
         paramIn(cp, base + ".event_time", event_time);
-        parent->schedule(doneEvent, event_time);
+        txEventq->schedule(&doneEvent, event_time);
     }
 
     size_t tx_queue_size = 0;
@@ -256,8 +317,12 @@ EtherLink::Link::unserialize(const std::string &base, CheckpointIn &cp)
             txQueue.emplace_back(std::make_pair(tick, delayed_packet));
         }
 
-        if (!txQueue.empty())
-            parent->schedule(txQueueEvent, txQueue.front().first);
+        if (crossesQueues()) {
+            for (const auto &pe : txQueue)
+                scheduleDelivery(pe.first);
+        } else if (!txQueue.empty()) {
+            rxEventq->schedule(&txQueueEvent, txQueue.front().first);
+        }
     } else {
         // We can't reliably convert in-flight packets from old
         // checkpoints. In fact, gem5 hasn't been able to load these
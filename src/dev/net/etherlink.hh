@@ -45,6 +45,7 @@
 #ifndef __DEV_NET_ETHERLINK_HH__
 #define __DEV_NET_ETHERLINK_HH__
 
+#include <mutex>
 #include <queue>
 #include <utility>
 
@@ -83,6 +84,14 @@ class EtherLink : public SimObject
         Interface *txint;
         Interface *rxint;
 
+        /**
+         * Event queues of the interfaces at both ends. Transmissions
+         * are simulated on the queue of the transmitting side and
+         * deliveries on the queue of the receiving side.
+         */
+        EventQueue *const txEventq;
+        EventQueue *const rxEventq;
+
         const double ticksPerByte;
         const Tick linkDelay;
         const Tick delayVar;
@@ -108,14 +117,27 @@ class EtherLink : public SimObject
         void processTxQueue();
         EventFunctionWrapper txQueueEvent;
 
+        /**
+         * When the two sides run on different threads, the queue of
+         * in-flight packets is shared by them and each packet gets its
+         * own delivery event on the receiving queue.
+         */
+        std::mutex txQueueMutex;
+
+        void scheduleDelivery(Tick when);
+        void deliverCrossQueue();
+
         void txComplete(EthPacketPtr packet);
 
       public:
         Link(const std::string &name, EtherLink *p, int num,
-             double rate, Tick delay, Tick delay_var, EtherDump *dump);
+             double rate, Tick delay, Tick delay_var, EtherDump *dump,
+             EventQueue *tx_eventq, EventQueue *rx_eventq);
         ~Link() {}
 
         const std::string name() const { return objName; }
+        Tick delay() const { return linkDelay; }
+        bool crossesQueues() const { return txEventq != rxEventq; }
 
         bool busy() const { return (bool)packet; }
         bool transmit(EthPacketPtr packet);
@@ -153,6 +175,8 @@ class EtherLink : public SimObject
     Port &getPort(const std::string &if_name,
                   PortID idx=InvalidPortID) override;
 
+    void init() override;
+
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
 
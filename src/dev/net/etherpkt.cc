@@ -28,15 +28,118 @@
 
 #include "dev/net/etherpkt.hh"
 
+#include <array>
 #include <iostream>
+#include <vector>
 
 #include "base/inet.hh"
+#include "base/intmath.hh"
 #include "base/logging.hh"
 #include "sim/serialize.hh"
 
 namespace gem5
 {
 
+namespace
+{
+
+/** Smallest pooled buffer, as a power of two */
+constexpr unsigned MinPoolShift = 6;
+/** Largest pooled buffer, as a power of two */
+constexpr unsigned MaxPoolShift = 16;
+/** Buffers kept per size class and thread */
+constexpr size_t MaxPoolDepth = 256;
+
+/** Set once the pool of a thread is gone, e.g. while the thread exits */
+thread_local bool poolDestroyed = false;
+
+class BufferPool
+{
+  public:
+    ~BufferPool()
+    {
+        for (auto &list : free) {
+            for (auto *buf : list)
+                delete [] buf;
+        }
+        poolDestroyed = true;
+    }
+
+    static unsigned
+    sizeClass(unsigned size)
+    {
+        return size <= (1U << MinPoolShift) ?
+            0 : ceilLog2(size) - MinPoolShift;
+    }
+
+    /** Allocate a buffer that can be recycled for its size class */
+    static uint8_t *
+    allocNew(unsigned size)
+    {
+        if (size > (1U << MaxPoolShift))
+            return new uint8_t[size];
+        return new uint8_t[1U << (sizeClass(size) + MinPoolShift)];
+    }
+
+    uint8_t *
+    alloc(unsigned size)
+    {
+        if (size > (1U << MaxPoolShift))
+            return allocNew(size);
+
+        auto &list = free[sizeClass(size)];
+        if (list.empty())
+            return allocNew(size);
+
+        uint8_t *buf = list.back();
+        list.pop_back();
+        return buf;
+    }
+
+    void
+    release(uint8_t *buf, unsigned size)
+    {
+        if (size > (1U << MaxPoolShift)) {
+            delete [] buf;
+            return;
+        }
+
+        auto &list = free[sizeClass(size)];
+        if (list.size() >= MaxPoolDepth)
+            delete [] buf;
+        else
+            list.push_back(buf);
+    }
+
+  private:
+    std::array<std::vector<uint8_t *>,
+               MaxPoolShift - MinPoolShift + 1> free;
+};
+
+// Packets may be freed by a different thread than the one that
+// allocated them (e.g. dist-gem5 receiver threads), which simply moves
+// the buffer to the other thread's pool.
+thread_local BufferPool bufferPool;
+
+} // anonymous namespace
+
+uint8_t *
+EthPacketData::allocData(unsigned size)
+{
+    if (poolDestroyed)
+        return BufferPool::allocNew(size);
+    return bufferPool.alloc(size);
+}
+
+void
+EthPacketData::freeData(uint8_t *buf, unsigned size)
+{
+    if (poolDestroyed)
+        delete [] buf;
+    else
+        bufferPool.release(buf, size);
+}
+
 void
 EthPacketData::serialize(const std::string &base, CheckpointOut &cp) const
 {
@@ -65,7 +168,7 @@ EthPacketData::unserialize(const std::string &base, CheckpointIn &cp)
     }
     assert(length <= bufLength);
     if (!data)
-        data = new uint8_t[bufLength];
+        data = allocData(bufLength);
     arrayParamIn(cp, base + ".data", data, length);
     if (!optParamIn(cp, base + ".simLength", simLength))
         simLength = length;
@@ -78,13 +78,30 @@ class EthPacketData
     { }
 
     explicit EthPacketData(unsigned size)
-        : data(new uint8_t[size]), bufLength(size), length(0), simLength(0)
+        : data(allocData(size)), bufLength(size), length(0), simLength(0)
     { }
 
-    ~EthPacketData() { if (data) delete [] data; }
+    ~EthPacketData() { if (data) freeData(data, bufLength); }
+
+    EthPacketData(const EthPacketData &) = delete;
+    EthPacketData &operator=(const EthPacketData &) = delete;
 
     void serialize(const std::string &base, CheckpointOut &cp) const;
     void unserialize(const std::string &base, CheckpointIn &cp);
+
+  private:
+    /**
+     * Get a data buffer from the per-thread pool of recently freed
+     * buffers, falling back to the heap. Frames are allocated and
+     * freed at the packet rate of the simulated network, and for
+     * most of them the size is one of a few values (the MTU or a
+     * device's maximum buffer size), so they are recycled by
+     * power-of-two size classes.
+     */
+    static uint8_t *allocData(unsigned size);
+
+    /** Return a data buffer from allocData() to the pool */
+    static void freeData(uint8_t *buf, unsigned size);
 };
 
 typedef std::shared_ptr<EthPacketData> EthPacketPtr;
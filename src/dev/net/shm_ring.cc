@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/net/shm_ring.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/DistEthernet.hh"
+
+namespace gem5
+{
+
+ShmRing::ShmRing(const std::string &seg_name, size_t size, bool create)
+    : _name(seg_name), mapSize(sizeof(Control) + size), ctrl(nullptr),
+      data(nullptr), size(size)
+{
+    int flags = O_RDWR;
+    if (create) {
+        // Remove a stale segment left behind by a crashed run.
+        shm_unlink(_name.c_str());
+        flags |= O_CREAT | O_EXCL;
+    }
+
+    int fd = shm_open(_name.c_str(), flags, 0600);
+    if (fd < 0) {
+        warn("shm_open(%s) failed: %s", _name, strerror(errno));
+        return;
+    }
+
+    if (create && ftruncate(fd, mapSize) != 0) {
+        warn("ftruncate(%s) failed: %s", _name, strerror(errno));
+        ::close(fd);
+        shm_unlink(_name.c_str());
+        return;
+    }
+
+    void *addr = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        warn("mmap(%s) failed: %s", _name, strerror(errno));
+        if (create)
+            shm_unlink(_name.c_str());
+        return;
+    }
+
+    ctrl = static_cast<Control *>(addr);
+    data = static_cast<uint8_t *>(addr) + sizeof(Control);
+    if (create) {
+        new (ctrl) Control();
+        ctrl->size = size;
+    }
+    panic_if(ctrl->size != size, "Shared memory ring %s has size %d, "
+             "expected %d", _name, ctrl->size, size);
+
+    DPRINTF(DistEthernet, "ShmRing: %s %s (%d bytes)\n",
+            create ? "created" : "attached to", _name, size);
+}
+
+ShmRing::~ShmRing()
+{
+    if (!ctrl)
+        return;
+
+    close();
+    munmap(ctrl, mapSize);
+}
+
+void
+ShmRing::unlink()
+{
+    shm_unlink(_name.c_str());
+}
+
+void
+ShmRing::close()
+{
+    ctrl->closed.store(1);
+    notify();
+}
+
+void
+ShmRing::notify()
+{
+    ctrl->seq.fetch_add(1);
+    if (ctrl->waiters.load() == 0)
+        return;
+
+#if defined(__linux__)
+    syscall(SYS_futex, &ctrl->seq, FUTEX_WAKE, INT32_MAX, nullptr,
+            nullptr, 0);
+#endif
+}
+
+bool
+ShmRing::waitFor(const std::function<bool()> &ready)
+{
+    for (unsigned i = 0; i < SpinCount; ++i) {
+        if (ready())
+            return true;
+    }
+
+    for (;;) {
+        const uint32_t seq = ctrl->seq.load();
+        if (ready())
+            return true;
+        if (ctrl->closed.load())
+            return false;
+
+        // Sleep until the other end moves its position. The timeout
+        // lets us notice peers that disappeared without closing the
+        // ring.
+        ctrl->waiters.fetch_add(1);
+#if defined(__linux__)
+        struct timespec timeout = { 0, 1000000 };
+        syscall(SYS_futex, &ctrl->seq, FUTEX_WAIT, seq, &timeout,
+                nullptr, 0);
+#else
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+#endif
+        ctrl->waiters.fetch_sub(1);
+
+        if (ctrl->seq.load() == seq && alive && !alive())
+            return false;
+    }
+}
+
+bool
+ShmRing::write(const void *buf, size_t length)
+{
+    const uint8_t *src = static_cast<const uint8_t *>(buf);
+    auto room = [this]() {
+        return ctrl->head.load(std::memory_order_relaxed) -
+            ctrl->tail.load(std::memory_order_acquire) < size;
+    };
+
+    while (length) {
+        if (!room() && !waitFor([&]() {
+                return room() || ctrl->closed.load(); })) {
+            return false;
+        }
+        if (ctrl->closed.load())
+            return false;
+
+        const uint64_t head = ctrl->head.load(std::memory_order_relaxed);
+        const uint64_t tail = ctrl->tail.load(std::memory_order_acquire);
+        const uint64_t offset = head % size;
+        const size_t chunk = std::min<uint64_t>(
+            std::min<uint64_t>(length, size - (head - tail)),
+            size - offset);
+
+        memcpy(data + offset, src, chunk);
+        ctrl->head.store(head + chunk, std::memory_order_release);
+        notify();
+
+        src += chunk;
+        length -= chunk;
+    }
+
+    return true;
+}
+
+bool
+ShmRing::read(void *buf, size_t length)
+{
+    uint8_t *dst = static_cast<uint8_t *>(buf);
+    auto avail = [this]() {
+        return ctrl->head.load(std::memory_order_acquire) !=
+            ctrl->tail.load(std::memory_order_relaxed);
+    };
+
+    while (length) {
+        if (!avail() && !waitFor(avail))
+            return false;
+
+        const uint64_t head = ctrl->head.load(std::memory_order_acquire);
+        const uint64_t tail = ctrl->tail.load(std::memory_order_relaxed);
+        const uint64_t offset = tail % size;
+        const size_t chunk = std::min<uint64_t>(
+            std::min<uint64_t>(length, head - tail), size - offset);
+
+        memcpy(dst, data + offset, chunk);
+        ctrl->tail.store(tail + chunk, std::memory_order_release);
+        notify();
+
+        dst += chunk;
+        length -= chunk;
+    }
+
+    return true;
+}
+
+} // namespace gem5
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Byte stream between two gem5 processes through shared memory.
+ *
+ * dist-gem5 peers that run on the same host can bypass the socket
+ * layer and exchange their messages through a pair of rings in a
+ * POSIX shared memory segment. Each ring has exactly one producer and
+ * one consumer process. Both ends spin for a short while before they
+ * block, which keeps the latency of the frequent synchronisation
+ * messages low without burning a core when a peer is idle.
+ */
+
+#ifndef __DEV_NET_SHM_RING_HH__
+#define __DEV_NET_SHM_RING_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace gem5
+{
+
+class ShmRing
+{
+  public:
+    /**
+     * Callback used while blocked to find out if the other end of the
+     * ring is still around. Peers that crash or exit cannot mark the
+     * ring closed.
+     */
+    typedef std::function<bool()> AliveFunc;
+
+    /**
+     * Create a new shared memory segment or attach to an existing one.
+     *
+     * @param seg_name POSIX shared memory object name.
+     * @param size Size of the ring buffer in bytes.
+     * @param create Create the segment (true) or open it (false).
+     */
+    ShmRing(const std::string &seg_name, size_t size, bool create);
+    ~ShmRing();
+
+    ShmRing(const ShmRing &) = delete;
+    ShmRing &operator=(const ShmRing &) = delete;
+
+    /** Shared memory object name */
+    const std::string &name() const { return _name; }
+
+    /** Whether the segment could be created or opened */
+    bool valid() const { return ctrl != nullptr; }
+
+    /** Remove the segment name, the mappings stay valid */
+    void unlink();
+
+    /** Set the callback checking the other end of the ring */
+    void setAliveFunc(AliveFunc func) { alive = func; }
+
+    /**
+     * Append a message to the ring, blocking while it is full.
+     *
+     * @return false if the other end went away.
+     */
+    bool write(const void *buf, size_t length);
+
+    /**
+     * Remove the next length bytes from the ring, blocking while it
+     * does not hold enough data.
+     *
+     * @return false if the other end went away.
+     */
+    bool read(void *buf, size_t length);
+
+    /** Tell the other end that no more data will be read or written */
+    void close();
+
+  private:
+    /**
+     * Control block at the start of the segment. The producer and
+     * consumer positions are kept in separate cache lines.
+     */
+    struct Control
+    {
+        alignas(64) std::atomic<uint64_t> head;
+        alignas(64) std::atomic<uint64_t> tail;
+        alignas(64) std::atomic<uint32_t> seq;
+        std::atomic<uint32_t> waiters;
+        std::atomic<uint32_t> closed;
+        uint64_t size;
+    };
+
+    /** Iterations to poll before blocking */
+    static const unsigned SpinCount = 4096;
+
+    /**
+     * Wait until ready() returns true.
+     *
+     * @return false if the ring was closed or the other end went away.
+     */
+    bool waitFor(const std::function<bool()> &ready);
+
+    /** Wake up the other end if it is blocked on the ring */
+    void notify();
+
+    const std::string _name;
+    size_t mapSize;
+    Control *ctrl;
+    uint8_t *data;
+    uint64_t size;
+    AliveFunc alive;
+};
+
+} // namespace gem5
+
+#endif // __DEV_NET_SHM_RING_HH__
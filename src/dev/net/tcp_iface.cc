@@ -53,6 +53,7 @@
 #include <vector>
 
 #include "base/compiler.hh"
+#include "base/cprintf.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
 #include "debug/DistEthernet.hh"
@@ -75,7 +76,7 @@ namespace gem5
 {
 
 std::vector<std::pair<TCPIface::NodeInfo, int> > TCPIface::nodes;
-std::vector<int> TCPIface::sockRegistry;
+std::vector<TCPIface *> TCPIface::registry;
 int TCPIface::fdStatic = -1;
 bool TCPIface::anyListening = false;
 
@@ -83,10 +84,11 @@ TCPIface::TCPIface(std::string server_name, unsigned server_port,
                    unsigned dist_rank, unsigned dist_size,
                    Tick sync_start, Tick sync_repeat,
                    EventManager *em, bool use_pseudo_op, bool is_switch,
-                   int num_nodes) :
+                   int num_nodes, bool use_shm, size_t shm_size) :
     DistIface(dist_rank, dist_size, sync_start, sync_repeat, em, use_pseudo_op,
               is_switch, num_nodes), serverName(server_name),
-    serverPort(server_port), isSwitch(is_switch), listening(false)
+    serverPort(server_port), isSwitch(is_switch), listening(false),
+    useShm(use_shm), shmSize(shm_size)
 {
     if (is_switch && isPrimary) {
         while (!listen(serverPort)) {
@@ -176,6 +178,13 @@ TCPIface::establishConnection()
         }
         inform("Link okay  (iface:%d -> (node:%d, iface:%d))",
                distIfaceId, ni.rank, ni.distIfaceId);
+        // Peers on the same host talk through shared memory rings
+        // instead of the socket.
+        char host[sizeof(ni.host)];
+        hostName(host, sizeof(host));
+        const bool shm = useShm && ni.shm &&
+            strncmp(host, ni.host, sizeof(host)) == 0 &&
+            openShm(ni.rank, ni.distIfaceId, shmSize, true);
         if (ni.distIfaceId < ni.distIfaceNum - 1) {
             cur_id++;
         } else {
@@ -185,23 +194,90 @@ TCPIface::establishConnection()
         // send ack
         ni.distIfaceId = distIfaceId;
         ni.distIfaceNum = distIfaceNum;
+        ni.shm = shm;
+        ni.shmSize = shmSize;
         sendTCP(sock, &ni, sizeof(ni));
+        if (shm) {
+            // Wait for the node to attach to the rings, then remove
+            // their names so that nothing is left behind at exit.
+            if (!recvTCP(sock, &ni, sizeof(ni)))
+                panic("Failed to receive shared memory confirmation");
+            shmTx->unlink();
+            shmRx->unlink();
+            if (ni.shm) {
+                inform("Link uses shared memory (iface:%d)", distIfaceId);
+            } else {
+                shmTx.reset();
+                shmRx.reset();
+            }
+        }
     } else { // this is not a switch
         connect();
         // send link info
         ni.rank = rank;
         ni.distIfaceId = distIfaceId;
         ni.distIfaceNum = distIfaceNum;
+        hostName(ni.host, sizeof(ni.host));
+        ni.shm = useShm;
+        ni.shmSize = 0;
         sendTCP(sock, &ni, sizeof(ni));
         DPRINTF(DistEthernet, "Connected, waiting for ack (distIfaceId:%d\n",
                 distIfaceId);
         if (!recvTCP(sock, &ni, sizeof(ni)))
             panic("Failed to receive ack");
         assert(ni.rank == rank);
-        inform("Link okay  (iface:%d -> switch iface:%d)", distIfaceId,
-               ni.distIfaceId);
+        if (ni.shm) {
+            ni.shm = openShm(rank, distIfaceId, ni.shmSize, false);
+            sendTCP(sock, &ni, sizeof(ni));
+        }
+        inform("Link okay  (iface:%d -> switch iface:%d)%s", distIfaceId,
+               ni.distIfaceId, ni.shm ? " using shared memory" : "");
     }
-    sockRegistry.push_back(sock);
+    registry.push_back(this);
+}
+
+bool
+TCPIface::openShm(unsigned rank, unsigned id, uint64_t size, bool create)
+{
+    const std::string base =
+        csprintf("/gem5-dist-%d-%d-%d", serverPort, rank, id);
+
+    // Messages from the node go up to the switch and the rest goes down.
+    auto up = std::make_unique<ShmRing>(base + "-up", size, create);
+    auto down = std::make_unique<ShmRing>(base + "-down", size, create);
+    if (!up->valid() || !down->valid()) {
+        if (create) {
+            up->unlink();
+            down->unlink();
+        }
+        return false;
+    }
+
+    shmTx = std::move(isSwitch ? down : up);
+    shmRx = std::move(isSwitch ? up : down);
+
+    auto alive = [this]() { return peerAlive(); };
+    shmTx->setAliveFunc(alive);
+    shmRx->setAliveFunc(alive);
+    return true;
+}
+
+void
+TCPIface::hostName(char *name, size_t size)
+{
+    memset(name, 0, size);
+    if (gethostname(name, size - 1) != 0)
+        name[0] = '\0';
+}
+
+bool
+TCPIface::peerAlive() const
+{
+    // Nothing but the closing of the connection arrives on the socket
+    // once shared memory is in use.
+    char c;
+    ssize_t ret = ::recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT);
+    return ret > 0 || (ret < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
 }
 
 void
@@ -256,6 +332,9 @@ TCPIface::~TCPIface()
 {
     [[maybe_unused]] int ret;
 
+    shmTx.reset();
+    shmRx.reset();
+
     ret = close(sock);
     assert(ret == 0);
 }
@@ -277,6 +356,31 @@ TCPIface::sendTCP(int sock, const void *buf, unsigned length)
     panic_if(ret != length, "send() failed");
 }
 
+void
+TCPIface::send(const void *buf, unsigned length)
+{
+    if (!shmTx) {
+        sendTCP(sock, buf, length);
+        return;
+    }
+
+    if (!shmTx->write(buf, length))
+        exitSimLoop("Message server closed connection, simulation "
+                    "is exiting");
+}
+
+bool
+TCPIface::recv(void *buf, unsigned length)
+{
+    if (!shmRx)
+        return recvTCP(sock, buf, length);
+
+    bool ret = shmRx->read(buf, length);
+    if (!ret)
+        inform("recv(): Shared memory connection closed");
+    return ret;
+}
+
 bool
 TCPIface::recvTCP(int sock, void *buf, unsigned length)
 {
@@ -299,8 +403,8 @@ TCPIface::recvTCP(int sock, void *buf, unsigned length)
 void
 TCPIface::sendPacket(const Header &header, const EthPacketPtr &packet)
 {
-    sendTCP(sock, &header, sizeof(header));
-    sendTCP(sock, packet->data, packet->length);
+    send(&header, sizeof(header));
+    send(packet->data, packet->length);
 }
 
 void
@@ -311,14 +415,14 @@ TCPIface::sendCmd(const Header &header)
     // Global commands (i.e. sync request) are always sent by the primary
     // DistIface. The transfer method is simply implemented as point-to-point
     // messages for now
-    for (auto s: sockRegistry)
-        sendTCP(s, (void*)&header, sizeof(header));
+    for (auto iface: registry)
+        iface->send(&header, sizeof(header));
 }
 
 bool
 TCPIface::recvHeader(Header &header)
 {
-    bool ret = recvTCP(sock, &header, sizeof(header));
+    bool ret = recv(&header, sizeof(header));
     DPRINTF(DistEthernetCmd, "TCPIface::recvHeader() type: %d ret: %d\n",
             static_cast<int>(header.msgType), ret);
     return ret;
@@ -328,7 +432,7 @@ void
 TCPIface::recvPacket(const Header &header, EthPacketPtr &packet)
 {
     packet = std::make_shared<EthPacketData>(header.dataPacketLength);
-    bool ret = recvTCP(sock, packet->data, header.dataPacketLength);
+    bool ret = recv(packet->data, header.dataPacketLength);
     panic_if(!ret, "Error while reading socket");
     packet->simLength = header.simLength;
     packet->length = header.dataPacketLength;
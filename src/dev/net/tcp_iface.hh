@@ -45,14 +45,20 @@
  * simulates a switch box) via a stream socket. The server process
  * transfers messages and co-ordinates the synchronisation among the gem5
  * peers.
+ *
+ * Peers that turn out to run on the same host as the server switch to a
+ * pair of shared memory rings once the connection is set up. The socket
+ * is then only kept open to notice when the peer goes away.
  */
 #ifndef __DEV_NET_TCP_IFACE_HH__
 #define __DEV_NET_TCP_IFACE_HH__
 
 
+#include <memory>
 #include <string>
 
 #include "dev/net/dist_iface.hh"
+#include "dev/net/shm_ring.hh"
 
 namespace gem5
 {
@@ -74,6 +80,16 @@ class TCPIface : public DistIface
 
     bool listening;
     static bool anyListening;
+
+    /** Whether shared memory may be used with peers on this host */
+    bool useShm;
+    /** Size of each shared memory ring */
+    size_t shmSize;
+    /** @{ */
+    /** Shared memory rings replacing the socket, if in use */
+    std::unique_ptr<ShmRing> shmTx;
+    std::unique_ptr<ShmRing> shmRx;
+    /** @} */
     static int fdStatic;
 
     /**
@@ -85,12 +101,18 @@ class TCPIface : public DistIface
         unsigned rank;
         unsigned distIfaceId;
         unsigned distIfaceNum;
+        /** Host the peer runs on */
+        char host[64];
+        /** Request (node) or grant (switch) of shared memory rings */
+        bool shm;
+        /** Size of each shared memory ring (switch) */
+        uint64_t shmSize;
     };
     static std::vector<std::pair<NodeInfo, int> > nodes;
     /**
-     * Storage for all opened sockets
+     * Storage for all connected interfaces
      */
-    static std::vector<int> sockRegistry;
+    static std::vector<TCPIface *> registry;
 
   private:
 
@@ -112,6 +134,35 @@ class TCPIface : public DistIface
      * @param length Exact size of the expected message in bytes.
      */
     bool recvTCP(int sock, void *buf, unsigned length);
+
+    /**
+     * Send out a message to the peer through the shared memory ring if
+     * there is one, or through the socket otherwise.
+     */
+    void send(const void *buf, unsigned length);
+
+    /**
+     * Receive the next incoming message from the peer through the
+     * shared memory ring if there is one, or the socket otherwise.
+     */
+    bool recv(void *buf, unsigned length);
+
+    /**
+     * Set up the shared memory rings to a peer.
+     *
+     * @param rank Rank of the compute node.
+     * @param id Id of the dist interface in the compute node.
+     * @param size Size of each ring.
+     * @param create Create the rings (server) or attach to them.
+     * @return true if both rings are ready.
+     */
+    bool openShm(unsigned rank, unsigned id, uint64_t size, bool create);
+
+    /** Fill in the name of the host we run on */
+    static void hostName(char *name, size_t size);
+
+    /** Check if the peer still holds the socket open */
+    bool peerAlive() const;
     bool listen(int port);
     void accept();
     void connect();
@@ -144,11 +195,14 @@ class TCPIface : public DistIface
      * @param sync_repeat The frequency of dist synchronisation.
      * @param em The EventManager object associated with the simulated
      * Ethernet link.
+     * @param use_shm Use shared memory with peers on the same host.
+     * @param shm_size Size of each shared memory ring.
      */
     TCPIface(std::string server_name, unsigned server_port,
              unsigned dist_rank, unsigned dist_size,
              Tick sync_start, Tick sync_repeat, EventManager *em,
-             bool use_pseudo_op, bool is_switch, int num_nodes);
+             bool use_pseudo_op, bool is_switch, int num_nodes,
+             bool use_shm, size_t shm_size);
 
     ~TCPIface() override;
 };
@@ -100,7 +100,7 @@ BasePixelPump::BasePixelPump(EventManager &em, ClockDomain &pxl_clk,
       evBeginLine("evBeginLine", this, &BasePixelPump::beginLine),
       evRenderPixels("evRenderPixels", this, &BasePixelPump::renderPixels),
       _timings(DisplayTimings::vga),
-      line(0), _posX(0), _underrun(false)
+      line(0), _posX(0), _underrun(false), _skipFrame(false)
 {
 }
 
@@ -114,6 +114,7 @@ BasePixelPump::serialize(CheckpointOut &cp) const
     SERIALIZE_SCALAR(line);
     SERIALIZE_SCALAR(_posX);
     SERIALIZE_SCALAR(_underrun);
+    SERIALIZE_SCALAR(_skipFrame);
 
     SERIALIZE_OBJ(_timings);
     SERIALIZE_OBJ(fb);
@@ -128,6 +129,7 @@ BasePixelPump::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(line);
     UNSERIALIZE_SCALAR(_posX);
     UNSERIALIZE_SCALAR(_underrun);
+    UNSERIALIZE_OPT_SCALAR(_skipFrame);
 
     UNSERIALIZE_OBJ(_timings);
     UNSERIALIZE_OBJ(fb);
@@ -188,6 +190,7 @@ BasePixelPump::beginLine()
     line++;
     if (line >= _timings.linesPerFrame()) {
         _underrun = false;
+        _skipFrame = !wantFrame();
         line = 0;
     }
 
@@ -204,7 +207,7 @@ BasePixelPump::beginLine()
     schedule(evHSyncEnd, clockEdge(h_sync_end));
 
     // Visible area
-    if (line >= _timings.lineFirstVisible() &&
+    if (!_skipFrame && line >= _timings.lineFirstVisible() &&
         line < _timings.lineFrontPorchStart()) {
 
         const Cycles h_first_visible(h_sync_end + _timings.hBackPorch);
@@ -255,12 +258,19 @@ void
 BasePixelPump::renderFrame()
 {
     _underrun = false;
+    _skipFrame = !wantFrame();
     line = 0;
 
     // Signal vsync end and render the frame
     line = _timings.lineVBackPorchStart();
     onVSyncEnd();
 
+    if (_skipFrame) {
+        line = _timings.lineVSyncStart();
+        onVSyncBegin();
+        return;
+    }
+
     // We only care about the visible screen area when rendering the
     // frame
     for (line = _timings.lineFirstVisible();
@@ -194,6 +194,9 @@ class BasePixelPump
     /** Did a buffer underrun occur within this refresh interval? */
     bool underrun() const { return _underrun; }
 
+    /** Are the pixels of the current frame being skipped? */
+    bool skippingFrame() const { return _skipFrame; }
+
     /** Is the current line within the visible range? */
     bool
     visibleLine() const
@@ -286,6 +289,16 @@ class BasePixelPump
     /** Finished displaying the visible region of a frame */
     virtual void onFrameDone() {};
 
+    /**
+     * Should the pixels of the next frame be rendered?
+     *
+     * This is checked at the start of every frame. The sync callbacks
+     * of a skipped frame are still called at the same points in time,
+     * but no pixel is requested, the output frame buffer keeps the
+     * previous frame and onFrameDone() is not called.
+     */
+    virtual bool wantFrame() { return true; }
+
   private: // Params
     /** Maximum number of pixels to handle per render callback */
     const unsigned pixelChunk;
@@ -363,6 +376,9 @@ class BasePixelPump
 
     /** Did a buffer underrun occur within this refresh interval? */
     bool _underrun;
+
+    /** Are the pixels of the current frame being skipped? */
+    bool _skipFrame;
 };
 
 } // namespace gem5
@@ -41,6 +41,9 @@ class RawDiskImage(DiskImage):
     type = "RawDiskImage"
     cxx_header = "dev/storage/disk_image.hh"
     cxx_class = "gem5::RawDiskImage"
+    use_mmap = Param.Bool(
+        True, "Map the image in memory rather than using file I/O"
+    )
 
 
 class CowDiskImage(DiskImage):
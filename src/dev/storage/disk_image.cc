@@ -36,11 +36,19 @@
 #include <sys/uio.h>
 #include <unistd.h>
 
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
 #include <fstream>
 #include <string>
 
+#include "base/bitfield.hh"
 #include "base/callback.hh"
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -53,12 +61,39 @@
 namespace gem5
 {
 
+uint64_t
+DiskImage::readSectors(uint8_t *data, uint64_t offset, uint64_t count) const
+{
+    uint64_t bytes = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        const uint64_t done = read(data + bytes, offset + i);
+        bytes += done;
+        if (done != SectorSize)
+            break;
+    }
+    return bytes;
+}
+
+uint64_t
+DiskImage::writeSectors(const uint8_t *data, uint64_t offset, uint64_t count)
+{
+    uint64_t bytes = 0;
+    for (uint64_t i = 0; i < count; ++i) {
+        const uint64_t done = write(data + bytes, offset + i);
+        bytes += done;
+        if (done != SectorSize)
+            break;
+    }
+    return bytes;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Raw Disk image
 //
 RawDiskImage::RawDiskImage(const Params &p)
-    : DiskImage(p), disk_size(0)
+    : DiskImage(p), disk_size(0), useMmap(p.use_mmap), mapped(nullptr),
+      mappedSize(0)
 {
     open(p.image_file, p.read_only);
 }
@@ -93,18 +128,53 @@ RawDiskImage::open(const std::string &filename, bool rd_only)
         stream.open(file.c_str(), mode);
         if (!stream.is_open())
             panic("Error opening %s", filename);
+
+        if (useMmap)
+            map();
+    }
+}
+
+void
+RawDiskImage::map()
+{
+    int fd = ::open(file.c_str(), readonly ? O_RDONLY : O_RDWR);
+    if (fd < 0)
+        return;
+
+    // Devices and empty files keep using the stream
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        void *ptr = mmap(nullptr, st.st_size,
+                         PROT_READ | (readonly ? 0 : PROT_WRITE),
+                         MAP_SHARED, fd, 0);
+        if (ptr != MAP_FAILED) {
+            mapped = static_cast<uint8_t *>(ptr);
+            mappedSize = st.st_size;
+        } else {
+            warn("Could not map %s, using file I/O: %s\n", file,
+                 std::strerror(errno));
+        }
     }
+    ::close(fd);
 }
 
 void
 RawDiskImage::close()
 {
+    if (mapped) {
+        munmap(mapped, mappedSize);
+        mapped = nullptr;
+        mappedSize = 0;
+    }
     stream.close();
 }
 
 std::streampos
 RawDiskImage::size() const
 {
+    if (mapped)
+        return mappedSize / SectorSize;
+
     if (disk_size == 0) {
         if (!stream.is_open())
             panic("file not open!\n");
@@ -121,6 +191,9 @@ RawDiskImage::read(uint8_t *data, std::streampos offset) const
     if (!initialized)
         panic("RawDiskImage not initialized");
 
+    if (mapped)
+        return readSectors(data, offset, 1);
+
     if (!stream.is_open())
         panic("file not open!\n");
 
@@ -146,6 +219,9 @@ RawDiskImage::write(const uint8_t *data, std::streampos offset)
     if (readonly)
         panic("Cannot write to a read only disk image");
 
+    if (mapped)
+        return writeSectors(data, offset, 1);
+
     if (!stream.is_open())
         panic("file not open!\n");
 
@@ -161,6 +237,45 @@ RawDiskImage::write(const uint8_t *data, std::streampos offset)
     return stream.tellp() - pos;
 }
 
+uint64_t
+RawDiskImage::readSectors(uint8_t *data, uint64_t offset,
+                          uint64_t count) const
+{
+    if (!mapped)
+        return DiskImage::readSectors(data, offset, count);
+
+    const uint64_t start = offset * SectorSize;
+    const uint64_t bytes = start < mappedSize ?
+        std::min(count * SectorSize, mappedSize - start) : 0;
+    std::memcpy(data, mapped + start, bytes);
+
+    DPRINTF(DiskImageRead, "read: offset=%d count=%d\n", offset, count);
+    DDUMP(DiskImageRead, data, bytes);
+
+    return bytes;
+}
+
+uint64_t
+RawDiskImage::writeSectors(const uint8_t *data, uint64_t offset,
+                           uint64_t count)
+{
+    if (!mapped)
+        return DiskImage::writeSectors(data, offset, count);
+
+    if (readonly)
+        panic("Cannot write to a read only disk image");
+
+    const uint64_t start = offset * SectorSize;
+    const uint64_t bytes = start < mappedSize ?
+        std::min(count * SectorSize, mappedSize - start) : 0;
+
+    DPRINTF(DiskImageWrite, "write: offset=%d count=%d\n", offset, count);
+    DDUMP(DiskImageWrite, data, bytes);
+
+    std::memcpy(mapped + start, data, bytes);
+    return bytes;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Copy on Write Disk image
@@ -187,13 +302,7 @@ CowDiskImage::CowDiskImage(const Params &p)
 
 CowDiskImage::~CowDiskImage()
 {
-    SectorTable::iterator i = table->begin();
-    SectorTable::iterator end = table->end();
-
-    while (i != end) {
-        delete (*i).second;
-        ++i;
-    }
+    delete table;
 }
 
 void
@@ -261,18 +370,21 @@ CowDiskImage::open(const std::string &file)
 
     uint64_t sector_count;
     SafeReadSwap(stream, sector_count);
-    table = new SectorTable(sector_count);
-
+    delete table;
+    table = new SectorTable(sector_count / PageSectors + 1);
 
     for (uint64_t i = 0; i < sector_count; i++) {
         uint64_t offset;
         SafeReadSwap(stream, offset);
 
-        Sector *sector = new Sector;
-        SafeRead(stream, sector, sizeof(Sector));
+        auto &page = (*table)[offset / PageSectors];
+        if (!page)
+            page = std::make_unique<Page>();
 
-        assert(table->find(offset) == table->end());
-        (*table)[offset] = sector;
+        const uint64_t s = offset % PageSectors;
+        assert(!bits(page->valid, s));
+        SafeRead(stream, page->sector(s), SectorSize);
+        page->valid |= 1 << s;
     }
 
     stream.close();
@@ -284,7 +396,7 @@ CowDiskImage::open(const std::string &file)
 void
 CowDiskImage::initSectorTable(int hash_size)
 {
-    table = new SectorTable(hash_size);
+    table = new SectorTable(hash_size / PageSectors + 1);
 
     initialized = true;
 }
@@ -343,19 +455,15 @@ CowDiskImage::save(const std::string &file) const
 
     SafeWriteSwap(stream, (uint32_t)VersionMajor);
     SafeWriteSwap(stream, (uint32_t)VersionMinor);
-    SafeWriteSwap(stream, (uint64_t)table->size());
-
-    uint64_t size = table->size();
-    SectorTable::iterator iter = table->begin();
-    SectorTable::iterator end = table->end();
-
-    for (uint64_t i = 0; i < size; i++) {
-        if (iter == end)
-            panic("Incorrect Table Size during save of COW disk image");
-
-        SafeWriteSwap(stream, (uint64_t)(*iter).first);
-        SafeWrite(stream, (*iter).second->data, sizeof(Sector));
-        ++iter;
+    SafeWriteSwap(stream, numSectors());
+
+    for (const auto &[index, page] : *table) {
+        for (uint64_t s = 0; s < PageSectors; s++) {
+            if (bits(page->valid, s)) {
+                SafeWriteSwap(stream, index * PageSectors + s);
+                SafeWrite(stream, page->sector(s), SectorSize);
+            }
+        }
     }
 
     stream.close();
@@ -364,61 +472,111 @@ CowDiskImage::save(const std::string &file) const
 void
 CowDiskImage::writeback()
 {
-    SectorTable::iterator i = table->begin();
-    SectorTable::iterator end = table->end();
-
-    while (i != end) {
-        child->write((*i).second->data, (*i).first);
-        ++i;
+    for (const auto &[index, page] : *table) {
+        for (uint64_t s = 0; s < PageSectors; s++) {
+            if (bits(page->valid, s))
+                child->write(page->sector(s), index * PageSectors + s);
+        }
     }
 }
 
+const uint8_t *
+CowDiskImage::findSector(uint64_t offset) const
+{
+    auto i = table->find(offset / PageSectors);
+    if (i == table->end())
+        return nullptr;
+
+    const uint64_t s = offset % PageSectors;
+    return bits(i->second->valid, s) ? i->second->sector(s) : nullptr;
+}
+
+uint64_t
+CowDiskImage::numSectors() const
+{
+    uint64_t sectors = 0;
+    for (const auto &entry : *table)
+        sectors += popCount(entry.second->valid);
+    return sectors;
+}
+
 std::streampos
 CowDiskImage::size() const
 { return child->size(); }
 
 std::streampos
 CowDiskImage::read(uint8_t *data, std::streampos offset) const
+{
+    return readSectors(data, offset, 1);
+}
+
+std::streampos
+CowDiskImage::write(const uint8_t *data, std::streampos offset)
+{
+    return writeSectors(data, offset, 1);
+}
+
+uint64_t
+CowDiskImage::readSectors(uint8_t *data, uint64_t offset,
+                          uint64_t count) const
 {
     if (!initialized)
         panic("CowDiskImage not initialized");
 
-    if (offset > size())
+    if (offset > uint64_t(std::streamoff(size())))
         panic("access out of bounds");
 
-    SectorTable::const_iterator i = table->find(offset);
-    if (i == table->end())
-        return child->read(data, offset);
-    else {
-        memcpy(data, (*i).second->data, SectorSize);
-        DPRINTF(DiskImageRead, "read: offset=%d\n", (uint64_t)offset);
-        DDUMP(DiskImageRead, data, SectorSize);
-        return SectorSize;
+    uint64_t bytes = 0;
+    for (uint64_t i = 0; i < count;) {
+        if (const uint8_t *sector = findSector(offset + i)) {
+            memcpy(data + i * SectorSize, sector, SectorSize);
+            DPRINTF(DiskImageRead, "read: offset=%d\n", offset + i);
+            DDUMP(DiskImageRead, data + i * SectorSize, SectorSize);
+            bytes += SectorSize;
+            ++i;
+            continue;
+        }
+
+        // Read the sectors that were not written from the child at once
+        uint64_t run = 1;
+        while (i + run < count && !findSector(offset + i + run))
+            ++run;
+
+        const uint64_t done = child->readSectors(data + i * SectorSize,
+                                                 offset + i, run);
+        bytes += done;
+        if (done != run * SectorSize)
+            break;
+        i += run;
     }
+
+    return bytes;
 }
 
-std::streampos
-CowDiskImage::write(const uint8_t *data, std::streampos offset)
+uint64_t
+CowDiskImage::writeSectors(const uint8_t *data, uint64_t offset,
+                           uint64_t count)
 {
     if (!initialized)
         panic("RawDiskImage not initialized");
 
-    if (offset > size())
+    if (offset > uint64_t(std::streamoff(size())))
         panic("access out of bounds");
 
-    SectorTable::iterator i = table->find(offset);
-    if (i == table->end()) {
-        Sector *sector = new Sector;
-        memcpy(sector, data, SectorSize);
-        table->insert(make_pair(offset, sector));
-    } else {
-        memcpy((*i).second->data, data, SectorSize);
+    for (uint64_t i = 0; i < count; ++i) {
+        auto &page = (*table)[(offset + i) / PageSectors];
+        if (!page)
+            page = std::make_unique<Page>();
+
+        const uint64_t s = (offset + i) % PageSectors;
+        memcpy(page->sector(s), data + i * SectorSize, SectorSize);
+        page->valid |= 1 << s;
     }
 
-    DPRINTF(DiskImageWrite, "write: offset=%d\n", (uint64_t)offset);
-    DDUMP(DiskImageWrite, data, SectorSize);
+    DPRINTF(DiskImageWrite, "write: offset=%d count=%d\n", offset, count);
+    DDUMP(DiskImageWrite, data, count * SectorSize);
 
-    return SectorSize;
+    return count * SectorSize;
 }
 
 void
@@ -426,7 +584,8 @@ CowDiskImage::serialize(CheckpointOut &cp) const
 {
     std::string cowFilename = name() + ".cow";
     SERIALIZE_SCALAR(cowFilename);
-    save(CheckpointIn::dir() + "/" + cowFilename);
+    std::string path = CheckpointIn::dir() + "/" + cowFilename;
+    writeAsync([this, path]() { save(path); });
 }
 
 void
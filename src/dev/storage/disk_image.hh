@@ -34,6 +34,7 @@
 #define __DEV_STORAGE_DISK_IMAGE_HH__
 
 #include <fstream>
+#include <memory>
 #include <unordered_map>
 
 #include "params/CowDiskImage.hh"
@@ -65,6 +66,30 @@ class DiskImage : public SimObject
                                 std::streampos offset) const = 0;
     virtual std::streampos write(const uint8_t *data,
                                  std::streampos offset) = 0;
+
+    /**
+     * Read consecutive sectors. By default, this reads one sector at a
+     * time.
+     *
+     * @param data Buffer of count sectors
+     * @param offset First sector to read
+     * @param count Number of sectors to read
+     * @return Number of bytes read
+     */
+    virtual uint64_t readSectors(uint8_t *data, uint64_t offset,
+                                 uint64_t count) const;
+
+    /**
+     * Write consecutive sectors. By default, this writes one sector at
+     * a time.
+     *
+     * @param data Buffer of count sectors
+     * @param offset First sector to write
+     * @param count Number of sectors to write
+     * @return Number of bytes written
+     */
+    virtual uint64_t writeSectors(const uint8_t *data, uint64_t offset,
+                                  uint64_t count);
 };
 
 /**
@@ -78,6 +103,19 @@ class RawDiskImage : public DiskImage
     bool readonly;
     mutable std::streampos disk_size;
 
+    /** Whether to map the image in memory */
+    const bool useMmap;
+
+    /**
+     * Mapping of the whole image, used instead of the stream when the
+     * image could be mapped
+     */
+    uint8_t *mapped;
+    uint64_t mappedSize;
+
+    /** Map the opened image in memory if it is a regular file. */
+    void map();
+
   public:
     typedef RawDiskImageParams Params;
     RawDiskImage(const Params &p);
@@ -92,6 +130,11 @@ class RawDiskImage : public DiskImage
 
     std::streampos read(uint8_t *data, std::streampos offset) const override;
     std::streampos write(const uint8_t *data, std::streampos offset) override;
+
+    uint64_t readSectors(uint8_t *data, uint64_t offset,
+                         uint64_t count) const override;
+    uint64_t writeSectors(const uint8_t *data, uint64_t offset,
+                          uint64_t count) override;
 };
 
 /**
@@ -111,11 +154,36 @@ class CowDiskImage : public DiskImage
     static const uint32_t VersionMinor;
 
   protected:
-    struct Sector
+    /** Number of sectors kept together in one table entry */
+    static constexpr uint64_t PageSectors = 8;
+
+    /**
+     * The written sectors of a page of consecutive sectors, which
+     * amortizes allocations and lookups over write streams.
+     */
+    struct Page
     {
-        uint8_t data[SectorSize];
+        uint8_t data[PageSectors * SectorSize];
+        /** Bit i is set if sector i of the page was written */
+        uint8_t valid = 0;
+
+        uint8_t *sector(uint64_t i) { return data + i * SectorSize; }
+        const uint8_t *
+        sector(uint64_t i) const
+        {
+            return data + i * SectorSize;
+        }
     };
-    typedef std::unordered_map<uint64_t, Sector *> SectorTable;
+    static_assert(PageSectors <= 8, "Page::valid holds a bit per sector");
+
+    /** Pages by index, i.e. by sector / PageSectors */
+    typedef std::unordered_map<uint64_t, std::unique_ptr<Page>> SectorTable;
+
+    /** Get the written copy of a sector, or nullptr */
+    const uint8_t *findSector(uint64_t offset) const;
+
+    /** Number of written sectors */
+    uint64_t numSectors() const;
 
   protected:
     std::string filename;
@@ -142,6 +210,11 @@ class CowDiskImage : public DiskImage
 
     std::streampos read(uint8_t *data, std::streampos offset) const override;
     std::streampos write(const uint8_t *data, std::streampos offset) override;
+
+    uint64_t readSectors(uint8_t *data, uint64_t offset,
+                         uint64_t count) const override;
+    uint64_t writeSectors(const uint8_t *data, uint64_t offset,
+                          uint64_t count) override;
 };
 
 void SafeRead(std::ifstream &stream, void *data, int count);
@@ -53,6 +53,7 @@
 #include "base/chunk_generator.hh"
 #include "base/compiler.hh"
 #include "base/cprintf.hh" // csprintf
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/IdeDisk.hh"
 #include "dev/storage/disk_image.hh"
@@ -449,15 +450,11 @@ IdeDisk::doDmaRead()
 void
 IdeDisk::dmaReadDone()
 {
-    uint32_t bytesWritten = 0;
-
     // write the data to the disk image
-    for (bytesWritten = 0; bytesWritten < curPrd.getByteCount();
-         bytesWritten += SectorSize) {
-
-        cmdBytesLeft -= SectorSize;
-        writeDisk(curSector++, (uint8_t *)(dataBuffer + bytesWritten));
-    }
+    const uint32_t sectors = divCeil(curPrd.getByteCount(), SectorSize);
+    writeDisk(curSector, (uint8_t *)dataBuffer, sectors);
+    curSector += sectors;
+    cmdBytesLeft -= sectors * SectorSize;
 
     // check for the EOT
     if (curPrd.getEOT()) {
@@ -474,20 +471,18 @@ IdeDisk::doDmaDataWrite()
 {
     /** @todo we need to figure out what the delay actually will be */
     Tick totalDiskDelay = diskDelay + (curPrd.getByteCount() / SectorSize);
-    uint32_t bytesRead = 0;
 
     DPRINTF(IdeDisk, "doDmaWrite, diskDelay: %d totalDiskDelay: %d\n",
             diskDelay, totalDiskDelay);
 
     memset(dataBuffer, 0, MAX_DMA_SIZE);
     assert(cmdBytesLeft <= MAX_DMA_SIZE);
-    while (bytesRead < curPrd.getByteCount()) {
-        readDisk(curSector++, (uint8_t *)(dataBuffer + bytesRead));
-        bytesRead += SectorSize;
-        cmdBytesLeft -= SectorSize;
-    }
+    const uint32_t sectors = divCeil(curPrd.getByteCount(), SectorSize);
+    readDisk(curSector, (uint8_t *)dataBuffer, sectors);
+    curSector += sectors;
+    cmdBytesLeft -= sectors * SectorSize;
     DPRINTF(IdeDisk, "doDmaWrite, bytesRead: %d cmdBytesLeft: %d\n",
-            bytesRead, cmdBytesLeft);
+            sectors * SectorSize, cmdBytesLeft);
 
     schedule(dmaWriteWaitEvent, curTick() + totalDiskDelay);
 }
@@ -554,23 +549,23 @@ IdeDisk::dmaWriteDone()
 ///
 
 void
-IdeDisk::readDisk(uint32_t sector, uint8_t *data)
+IdeDisk::readDisk(uint32_t sector, uint8_t *data, uint32_t count)
 {
-    uint32_t bytesRead = image->read(data, sector);
+    uint64_t bytesRead = image->readSectors(data, sector, count);
 
-    panic_if(bytesRead != SectorSize,
+    panic_if(bytesRead != count * SectorSize,
             "Can't read from %s. Only %d of %d read. errno=%d",
-            name(), bytesRead, SectorSize, errno);
+            name(), bytesRead, count * SectorSize, errno);
 }
 
 void
-IdeDisk::writeDisk(uint32_t sector, uint8_t *data)
+IdeDisk::writeDisk(uint32_t sector, uint8_t *data, uint32_t count)
 {
-    uint32_t bytesWritten = image->write(data, sector);
+    uint64_t bytesWritten = image->writeSectors(data, sector, count);
 
-    panic_if(bytesWritten != SectorSize,
+    panic_if(bytesWritten != count * SectorSize,
             "Can't write to %s. Only %d of %d written. errno=%d",
-            name(), bytesWritten, SectorSize, errno);
+            name(), bytesWritten, count * SectorSize, errno);
 }
 
 ////
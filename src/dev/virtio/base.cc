@@ -231,7 +231,8 @@ VirtDescriptor::chainSize() const
 VirtQueue::VirtQueue(PortProxy &proxy, ByteOrder bo, uint16_t size)
     : byteOrder(bo), _size(size), _address(0), memProxy(proxy),
       avail(proxy, bo, size), used(proxy, bo, size),
-      _last_avail(0)
+      _last_avail(0), availRead(0), eventIdx(false), signalledUsed(0),
+      signalledUsedValid(false)
 {
     descriptors.reserve(_size);
     for (int i = 0; i < _size; ++i)
@@ -252,6 +253,9 @@ VirtQueue::unserialize(CheckpointIn &cp)
 
     paramIn(cp, "_address", addr_in);
     UNSERIALIZE_SCALAR(_last_avail);
+    availRead = _last_avail;
+    // The guest may be waiting for an interrupt
+    signalledUsedValid = false;
 
     // Use the address setter to ensure that the ring buffer addresses
     // are updated as well.
@@ -263,6 +267,9 @@ VirtQueue::reset()
 {
     _address = 0;
     _last_avail = 0;
+    availRead = 0;
+    eventIdx = false;
+    signalledUsedValid = false;
 
     avail.reset();
     used.reset();
@@ -284,11 +291,26 @@ VirtQueue::setAddress(Addr address)
 VirtDescriptor *
 VirtQueue::consumeDescriptor()
 {
-    avail.read();
+    // Only go to the guest once the descriptors read in the last
+    // burst are consumed, and then read the new ones at once.
+    if (_last_avail == availRead) {
+        avail.readHeader();
+        const uint16_t count = std::min<uint16_t>(
+            avail.header.index - availRead, _size);
+        if (count) {
+            avail.readElements(availRead, count);
+            availRead += count;
+        }
+
+        // Ask to be notified of the descriptors after the ones read
+        if (eventIdx)
+            used.writeEvent(availRead);
+    }
+
     DPRINTF(VIO, "consumeDescriptor: _last_avail: %i, avail.idx: %i (->%i)\n",
-            _last_avail, avail.header.index,
+            _last_avail, availRead,
             avail.ring[_last_avail % used.ring.size()]);
-    if (_last_avail == avail.header.index)
+    if (_last_avail == availRead)
         return NULL;
 
     VirtDescriptor::Index index(avail.ring[_last_avail % used.ring.size()]);
@@ -310,8 +332,27 @@ VirtQueue::produceDescriptor(VirtDescriptor *desc, uint32_t len)
     struct vring_used_elem &e(used.ring[used.header.index % used.ring.size()]);
     e.id = desc->index();
     e.len = len;
+    // The element must be visible before the index is
+    used.writeElement(used.header.index);
     used.header.index += 1;
-    used.write();
+    used.writeHeader();
+}
+
+bool
+VirtQueue::needsKick()
+{
+    const uint16_t used_idx = used.header.index;
+
+    if (eventIdx) {
+        const uint16_t old = signalledUsed;
+        const bool valid = signalledUsedValid;
+        signalledUsed = used_idx;
+        signalledUsedValid = true;
+        return !valid || vring_need_event(avail.readEvent(), used_idx, old);
+    }
+
+    avail.readHeader();
+    return !(avail.header.flags & VRING_AVAIL_F_NO_INTERRUPT);
 }
 
 void
@@ -341,7 +382,8 @@ VirtIODeviceBase::VirtIODeviceBase(const Params &params, DeviceId id,
     : SimObject(params),
       guestFeatures(0),
       byteOrder(params.byte_order),
-      deviceId(id), configSize(config_size), deviceFeatures(features),
+      deviceId(id), configSize(config_size),
+      deviceFeatures(features | (1 << VIRTIO_RING_F_EVENT_IDX)),
       _deviceStatus(0), _queueSelect(0)
 {
 }
@@ -367,8 +409,11 @@ VirtIODeviceBase::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(guestFeatures);
     UNSERIALIZE_SCALAR(_deviceStatus);
     UNSERIALIZE_SCALAR(_queueSelect);
-    for (QueueID i = 0; i < _queues.size(); ++i)
+    for (QueueID i = 0; i < _queues.size(); ++i) {
         _queues[i]->unserializeSection(cp, csprintf("_queues.%i", i));
+        _queues[i]->setEventIdx(
+            guestFeatures & (1 << VIRTIO_RING_F_EVENT_IDX));
+    }
 }
 
 void
@@ -405,6 +450,9 @@ VirtIODeviceBase::setGuestFeatures(FeatureBits features)
               deviceFeatures, features);
     }
     guestFeatures = features;
+
+    for (QueueID i = 0; i < _queues.size(); ++i)
+        _queues[i]->setEventIdx(features & (1 << VIRTIO_RING_F_EVENT_IDX));
 }
 
 
@@ -38,6 +38,7 @@
 #ifndef __DEV_VIRTIO_BASE_HH__
 #define __DEV_VIRTIO_BASE_HH__
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <vector>
@@ -353,6 +354,12 @@ class VirtQueue : public Serializable
     VirtDescriptor *getDescriptor(VirtDescriptor::Index index) {
         return &descriptors[index];
     }
+
+    /**
+     * Enable or disable the use of the used_event and avail_event
+     * fields of the rings, as negotiated with VIRTIO_RING_F_EVENT_IDX.
+     */
+    void setEventIdx(bool enable) { eventIdx = enable; }
     /** @} */
 
     /** @{
@@ -384,6 +391,20 @@ class VirtQueue : public Serializable
      * @param len Length of the produced data.
      */
     void produceDescriptor(VirtDescriptor *desc, uint32_t len);
+
+    /**
+     * Check if the guest wants to be kicked about the descriptors
+     * produced since the last kick.
+     *
+     * The guest can suppress interrupts with the NO_INTERRUPT flag of
+     * the available ring, or, if VIRTIO_RING_F_EVENT_IDX was
+     * negotiated, by publishing the used index it wants to be
+     * interrupted at. Device models call this after producing
+     * descriptors and only kick the guest if it returns true.
+     *
+     * @return true if the guest should be kicked.
+     */
+    bool needsKick();
     /** @} */
 
     /** @{
@@ -529,6 +550,65 @@ class VirtQueue : public Serializable
                 ring[i] = gtoh(temp[i], byteOrder);
         }
 
+        /**
+         * Read count elements of the ring, starting with the one at
+         * index first, in at most two accesses.
+         */
+        void
+        readElements(Index first, Index count)
+        {
+            assert(_base != 0);
+            assert(count <= ring.size());
+            while (count) {
+                const Index pos = first % ring.size();
+                const Index n = std::min<Index>(count, ring.size() - pos);
+                T temp[n];
+                _proxy.readBlob(_base + sizeof(header) + pos * sizeof(T),
+                                temp, sizeof(T) * n);
+                for (Index i = 0; i < n; ++i)
+                    ring[pos + i] = gtoh(temp[i], byteOrder);
+                first += n;
+                count -= n;
+            }
+        }
+
+        /** Write the element of the ring at index i to the guest. */
+        void
+        writeElement(Index i)
+        {
+            assert(_base != 0);
+            const Index pos = i % ring.size();
+            const T out = htog(ring[pos], byteOrder);
+            _proxy.writeBlob(_base + sizeof(header) + pos * sizeof(T),
+                             &out, sizeof(out));
+        }
+
+        /**
+         * Read the event index following the ring, i.e., the
+         * used_event of the available ring.
+         */
+        uint16_t
+        readEvent() const
+        {
+            assert(_base != 0);
+            return gtoh(_proxy.read<uint16_t>(
+                        _base + sizeof(header) + ring.size() * sizeof(T)),
+                    byteOrder);
+        }
+
+        /**
+         * Write the event index following the ring, i.e., the
+         * avail_event of the used ring.
+         */
+        void
+        writeEvent(uint16_t event)
+        {
+            assert(_base != 0);
+            _proxy.write<uint16_t>(
+                _base + sizeof(header) + ring.size() * sizeof(T),
+                htog(event, byteOrder));
+        }
+
         void
         write()
         {
@@ -569,6 +649,20 @@ class VirtQueue : public Serializable
      * ring */
     uint16_t _last_avail;
 
+    /**
+     * Index up to which the elements of VirtQueue::avail have been
+     * read from the guest. All of them are consumed when it is equal
+     * to _last_avail.
+     */
+    uint16_t availRead;
+
+    /** Whether VIRTIO_RING_F_EVENT_IDX is in use */
+    bool eventIdx;
+
+    /** Used index at the last kick, if signalledUsedValid is set */
+    uint16_t signalledUsed;
+    bool signalledUsedValid;
+
     /** Vector of pre-created descriptors indexed by their index into
      * the queue. */
     std::vector<VirtDescriptor> descriptors;
@@ -82,12 +82,11 @@ VirtIOBlock::read(const BlkRequest &req, VirtDescriptor *desc_chain,
     if (size % SectorSize != 0)
         panic("Unexpected request/sector size relationship\n");
 
-    for (Addr offset = 0; offset < size; offset += SectorSize) {
-        if (image.read(&data[offset], sector) != SectorSize) {
-            warn("Failed to read sector %i\n", sector);
-            return S_IOERR;
-        }
-        ++sector;
+    const uint64_t done = image.readSectors(data.data(), sector,
+                                            size / SectorSize);
+    if (done != size) {
+        warn("Failed to read sector %i\n", sector + done / SectorSize);
+        return S_IOERR;
     }
 
     desc_chain->chainWrite(off_data, &data[0], size);
@@ -111,12 +110,11 @@ VirtIOBlock::write(const BlkRequest &req, VirtDescriptor *desc_chain,
 
     desc_chain->chainRead(off_data, &data[0], size);
 
-    for (Addr offset = 0; offset < size; offset += SectorSize) {
-        if (image.write(&data[offset], sector) != SectorSize) {
-            warn("Failed to write sector %i\n", sector);
-            return S_IOERR;
-        }
-        ++sector;
+    const uint64_t done = image.writeSectors(data.data(), sector,
+                                             size / SectorSize);
+    if (done != size) {
+        warn("Failed to write sector %i\n", sector + done / SectorSize);
+        return S_IOERR;
     }
 
     return S_OK;
@@ -165,7 +163,8 @@ VirtIOBlock::RequestQueue::onNotifyDescriptor(VirtDescriptor *desc)
 
     // Tell the guest that we are done with this descriptor.
     produceDescriptor(desc, sizeof(BlkRequest) + data_size + sizeof(Status));
-    parent.kick();
+    if (needsKick())
+        parent.kick();
 }
 
 } // namespace gem5
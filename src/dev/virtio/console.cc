@@ -93,7 +93,8 @@ VirtIOConsole::TermRecvQueue::trySend()
 
         // Tell the guest that we are done with this descriptor.
         produceDescriptor(d, len);
-        parent.kick();
+        if (needsKick())
+            parent.kick();
     }
 }
 
@@ -113,7 +114,8 @@ VirtIOConsole::TermTransQueue::onNotifyDescriptor(VirtDescriptor *desc)
 
     // Tell the guest that we are done with this descriptor.
     produceDescriptor(desc, 0);
-    parent.kick();
+    if (needsKick())
+        parent.kick();
 }
 
 } // namespace gem5
@@ -191,7 +191,8 @@ VirtIO9PBase::sendRMsg(const P9MsgHeader &header, const uint8_t *data, size_t si
     out_desc->chainWrite(sizeof(header_out), data, size);
 
     queue.produceDescriptor(main_desc, sizeof(P9MsgHeader) + size);
-    kick();
+    if (queue.needsKick())
+        kick();
 }
 
 void
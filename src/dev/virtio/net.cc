@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dev/virtio/net.hh"
+
+#include <cstring>
+
+#include "base/inet.hh"
+#include "base/trace.hh"
+#include "debug/VIONet.hh"
+#include "params/VirtIONet.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+using namespace networking;
+
+VirtIONet::VirtIONet(const Params &params)
+    : VirtIODeviceBase(params, ID_NET, sizeof(Config),
+                       F_MTU | F_MAC | F_STATUS |
+                       (params.num_queue_pairs > 1 ? F_CTRL_VQ | F_MQ : 0)),
+      rxFifos(params.num_queue_pairs, PacketFifo(params.rx_fifo_size)),
+      txFifo(params.tx_fifo_size), activePairs(1),
+      interface(new VirtIONetInt(name() + ".int0", this)),
+      stats(this)
+{
+    fatal_if(params.num_queue_pairs < 1,
+             "%s: At least one queue pair is required.\n", name());
+    fatal_if(params.tx_fifo_size < maxFrameSize() ||
+             params.rx_fifo_size < maxFrameSize(),
+             "%s: FIFOs must hold at least one %i byte frame.\n",
+             name(), maxFrameSize());
+
+    memcpy(config.mac, params.hardware_address.bytes(), ETH_ADDR_LEN);
+    config.status = S_LINK_UP;
+    config.max_virtqueue_pairs = params.num_queue_pairs;
+    config.mtu = params.mtu;
+
+    PortProxy &proxy = params.system->physProxy;
+    for (unsigned i = 0; i < params.num_queue_pairs; ++i) {
+        rxQueues.emplace_back(
+            new RxQueue(proxy, byteOrder, params.qSize, *this, i));
+        txQueues.emplace_back(
+            new TxQueue(proxy, byteOrder, params.qSize, *this, i));
+        registerQueue(*rxQueues.back());
+        registerQueue(*txQueues.back());
+    }
+
+    if (params.num_queue_pairs > 1) {
+        ctrlQueue.reset(new CtrlQueue(proxy, byteOrder, 64, *this));
+        registerQueue(*ctrlQueue);
+    }
+}
+
+VirtIONet::~VirtIONet()
+{
+    delete interface;
+}
+
+VirtIONet::RxQueue::RxQueue(PortProxy &proxy, ByteOrder bo, uint16_t size,
+                            VirtIONet &_parent, unsigned _pair)
+    : VirtQueue(proxy, bo, size), parent(_parent), pair(_pair)
+{
+}
+
+VirtIONet::TxQueue::TxQueue(PortProxy &proxy, ByteOrder bo, uint16_t size,
+                            VirtIONet &_parent, unsigned _pair)
+    : VirtQueue(proxy, bo, size), parent(_parent), pair(_pair)
+{
+}
+
+VirtIONet::CtrlQueue::CtrlQueue(PortProxy &proxy, ByteOrder bo,
+                                uint16_t size, VirtIONet &_parent)
+    : VirtQueue(proxy, bo, size), parent(_parent)
+{
+}
+
+void
+VirtIONet::CtrlQueue::onNotifyDescriptor(VirtDescriptor *desc)
+{
+    parent.ctrlCommand(desc);
+}
+
+Port &
+VirtIONet::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "interface")
+        return *interface;
+    return VirtIODeviceBase::getPort(if_name, idx);
+}
+
+void
+VirtIONet::readConfig(PacketPtr pkt, Addr cfgOffset)
+{
+    Config cfg_out;
+    memcpy(cfg_out.mac, config.mac, sizeof(cfg_out.mac));
+    cfg_out.status = htog(config.status, byteOrder);
+    cfg_out.max_virtqueue_pairs =
+        htog(config.max_virtqueue_pairs, byteOrder);
+    cfg_out.mtu = htog(config.mtu, byteOrder);
+
+    readConfigBlob(pkt, cfgOffset, (uint8_t *)&cfg_out);
+}
+
+void
+VirtIONet::reset()
+{
+    VirtIODeviceBase::reset();
+
+    for (auto &fifo : rxFifos)
+        fifo.clear();
+    txFifo.clear();
+    activePairs = 1;
+}
+
+void
+VirtIONet::startup()
+{
+    // Resume sending frames that were pending when the checkpoint
+    // was taken.
+    txSend();
+}
+
+unsigned
+VirtIONet::maxFrameSize() const
+{
+    // Ethernet header with an optional VLAN tag
+    return config.mtu + ETH_HDR_LEN + 4;
+}
+
+unsigned
+VirtIONet::rxPair(const EthPacketPtr &pkt) const
+{
+    if (activePairs == 1)
+        return 0;
+
+    IpPtr ip(pkt);
+    if (!ip)
+        return 0;
+
+    uint32_t hash = ip->src() ^ ip->dst();
+    TcpPtr tcp(ip);
+    UdpPtr udp(ip);
+    if (tcp)
+        hash ^= tcp->sport() ^ tcp->dport();
+    else if (udp)
+        hash ^= udp->sport() ^ udp->dport();
+
+    hash ^= hash >> 16;
+    hash ^= hash >> 8;
+    return hash % activePairs;
+}
+
+bool
+VirtIONet::recvPacket(EthPacketPtr pkt)
+{
+    const unsigned pair = rxPair(pkt);
+    RxQueue &q = *rxQueues[pair];
+
+    if (!q.getAddress() || pkt->length > maxFrameSize()) {
+        DPRINTF(VIONet, "Dropping frame (len: %i), rx%i not ready\n",
+                pkt->length, pair);
+        ++stats.rxDrops;
+        return true;
+    }
+
+    PacketFifo &fifo = rxFifos[pair];
+    if (fifo.empty() && rxDeliver(pair, pkt)) {
+        if (q.needsKick())
+            kick();
+        return true;
+    }
+
+    if (!fifo.push(pkt)) {
+        DPRINTF(VIONet, "rx%i FIFO full, dropping frame (len: %i)\n",
+                pair, pkt->length);
+        ++stats.rxDrops;
+        return false;
+    }
+
+    DPRINTF(VIONet, "Queued frame (len: %i) for rx%i\n", pkt->length, pair);
+    return true;
+}
+
+bool
+VirtIONet::rxDeliver(unsigned pair, const EthPacketPtr &pkt)
+{
+    RxQueue &q = *rxQueues[pair];
+    VirtDescriptor *d = q.consumeDescriptor();
+    if (!d)
+        return false;
+
+    const size_t size = sizeof(NetHdr) + pkt->length;
+    if (d->chainSize() < size) {
+        warn_once("%s: Receive buffer too small for a %i byte frame.\n",
+                  name(), pkt->length);
+        ++stats.rxDrops;
+        q.produceDescriptor(d, 0);
+        return true;
+    }
+
+    NetHdr hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    d->chainWrite(0, (uint8_t *)&hdr, sizeof(hdr));
+    d->chainWrite(sizeof(hdr), pkt->data, pkt->length);
+    q.produceDescriptor(d, size);
+
+    DPRINTF(VIONet, "Delivered frame (len: %i) to rx%i\n",
+            pkt->length, pair);
+    ++stats.rxPackets;
+    stats.rxBytes += pkt->length;
+    return true;
+}
+
+void
+VirtIONet::rxDrain(unsigned pair)
+{
+    PacketFifo &fifo = rxFifos[pair];
+    bool produced = false;
+    while (!fifo.empty() && rxDeliver(pair, fifo.front())) {
+        fifo.pop();
+        produced = true;
+    }
+
+    if (produced && rxQueues[pair]->needsKick())
+        kick();
+}
+
+void
+VirtIONet::txKick()
+{
+    for (auto &q : txQueues) {
+        if (!q->getAddress())
+            continue;
+
+        bool produced = false;
+        VirtDescriptor *d;
+        while (txFifo.avail() >= maxFrameSize() &&
+               (d = q->consumeDescriptor())) {
+            const size_t size = d->chainSize();
+            if (size <= sizeof(NetHdr) ||
+                size - sizeof(NetHdr) > maxFrameSize()) {
+                warn_once("%s: Guest sent a malformed frame (size: %i).\n",
+                          name(), size);
+                ++stats.txDrops;
+            } else {
+                const unsigned len = size - sizeof(NetHdr);
+                EthPacketPtr pkt = std::make_shared<EthPacketData>(len);
+                d->chainRead(sizeof(NetHdr), pkt->data, len);
+                pkt->length = len;
+                pkt->simLength = len;
+                txFifo.push(pkt);
+            }
+
+            // The frame has been copied out of guest memory, so the
+            // buffer can be returned right away.
+            q->produceDescriptor(d, 0);
+            produced = true;
+        }
+
+        if (produced && q->needsKick())
+            kick();
+    }
+
+    txSend();
+}
+
+void
+VirtIONet::txSend()
+{
+    while (!txFifo.empty()) {
+        EthPacketPtr pkt = txFifo.front();
+        if (!interface->sendPacket(pkt))
+            return;
+
+        DPRINTF(VIONet, "Sent frame (len: %i)\n", pkt->length);
+        ++stats.txPackets;
+        stats.txBytes += pkt->length;
+        txFifo.pop();
+    }
+}
+
+void
+VirtIONet::transferDone()
+{
+    txSend();
+
+    // Room was freed in the FIFO, pull in frames the guest queued in
+    // the meantime.
+    if (txFifo.avail() >= maxFrameSize())
+        txKick();
+}
+
+void
+VirtIONet::ctrlCommand(VirtDescriptor *desc)
+{
+    CtrlHdr hdr;
+    desc->chainRead(0, (uint8_t *)&hdr, sizeof(hdr));
+
+    // The acknowledgement follows the device-readable part of the
+    // chain.
+    size_t ack_offset = 0;
+    for (VirtDescriptor *d = desc; d && d->isIncoming(); d = d->next())
+        ack_offset += d->size();
+
+    CtrlAck ack = CTRL_ERR;
+    if (hdr.cls == CTRL_MQ && hdr.cmd == CTRL_MQ_VQ_PAIRS_SET) {
+        uint16_t pairs;
+        desc->chainRead(sizeof(hdr), (uint8_t *)&pairs, sizeof(pairs));
+        pairs = gtoh(pairs, byteOrder);
+        if (pairs >= 1 && pairs <= rxQueues.size()) {
+            DPRINTF(VIONet, "Using %i queue pairs\n", pairs);
+            activePairs = pairs;
+            ack = CTRL_OK;
+        }
+    } else {
+        DPRINTF(VIONet, "Unsupported control command %i:%i\n",
+                hdr.cls, hdr.cmd);
+    }
+
+    desc->chainWrite(ack_offset, &ack, sizeof(ack));
+    ctrlQueue->produceDescriptor(desc, sizeof(ack));
+    if (ctrlQueue->needsKick())
+        kick();
+}
+
+void
+VirtIONet::serialize(CheckpointOut &cp) const
+{
+    VirtIODeviceBase::serialize(cp);
+
+    SERIALIZE_SCALAR(activePairs);
+    for (unsigned i = 0; i < rxFifos.size(); ++i)
+        rxFifos[i].serialize(csprintf("rxFifo%i", i), cp);
+    txFifo.serialize("txFifo", cp);
+}
+
+void
+VirtIONet::unserialize(CheckpointIn &cp)
+{
+    VirtIODeviceBase::unserialize(cp);
+
+    UNSERIALIZE_SCALAR(activePairs);
+    for (unsigned i = 0; i < rxFifos.size(); ++i)
+        rxFifos[i].unserialize(csprintf("rxFifo%i", i), cp);
+    txFifo.unserialize("txFifo", cp);
+}
+
+VirtIONet::NetStats::NetStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(txPackets, statistics::units::Count::get(),
+               "Number of frames sent"),
+      ADD_STAT(txBytes, statistics::units::Byte::get(),
+               "Number of bytes sent"),
+      ADD_STAT(rxPackets, statistics::units::Count::get(),
+               "Number of frames delivered to the guest"),
+      ADD_STAT(rxBytes, statistics::units::Byte::get(),
+               "Number of bytes delivered to the guest"),
+      ADD_STAT(rxDrops, statistics::units::Count::get(),
+               "Number of received frames dropped"),
+      ADD_STAT(txDrops, statistics::units::Count::get(),
+               "Number of malformed frames dropped")
+{
+}
+
+} // namespace gem5
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __DEV_VIRTIO_NET_HH__
+#define __DEV_VIRTIO_NET_HH__
+
+#include <memory>
+#include <vector>
+
+#include "base/compiler.hh"
+#include "base/statistics.hh"
+#include "dev/net/etherint.hh"
+#include "dev/net/etherpkt.hh"
+#include "dev/net/pktfifo.hh"
+#include "dev/virtio/base.hh"
+
+namespace gem5
+{
+
+struct VirtIONetParams;
+class VirtIONetInt;
+
+/**
+ * VirtIO network device
+ *
+ * The network device exposes one or more pairs of receive and
+ * transmit queues to the guest and connects to the simulated network
+ * through an Ethernet interface, just like the other NIC models. The
+ * queues are registered in the order mandated by the specification:
+ * rx0, tx0, rx1, tx1, ..., followed by the control queue if more than
+ * one queue pair is supported.
+ *
+ * Frames are moved in bursts: a transmit notification drains every
+ * buffer the guest has made available (as long as there is room in
+ * the transmit FIFO) and a received frame is copied straight into a
+ * guest buffer when one is available. With event indices negotiated,
+ * the guest is only interrupted once per burst. Incoming frames are
+ * steered to a queue pair by hashing their IPv4 addresses and TCP/UDP
+ * ports. Checksum and segmentation offloads are not supported, so the
+ * guest produces and consumes complete Ethernet frames.
+ *
+ * @see https://github.com/rustyrussell/virtio-spec
+ * @see http://docs.oasis-open.org/virtio/virtio/v1.0/virtio-v1.0.html
+ */
+class VirtIONet : public VirtIODeviceBase
+{
+  public:
+    typedef VirtIONetParams Params;
+    VirtIONet(const Params &params);
+    virtual ~VirtIONet();
+
+    void readConfig(PacketPtr pkt, Addr cfgOffset) override;
+    void reset() override;
+    void startup() override;
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+
+    void serialize(CheckpointOut &cp) const override;
+    void unserialize(CheckpointIn &cp) override;
+
+    /**
+     * Receive a frame from the network.
+     *
+     * @param pkt Incoming frame.
+     * @return false if the frame was dropped, true otherwise.
+     */
+    bool recvPacket(EthPacketPtr pkt);
+
+    /** The network finished sending the frame at the head of the FIFO */
+    void transferDone();
+
+  protected:
+    /** VirtIO device ID */
+    static const DeviceId ID_NET = 0x01;
+
+    /** @{
+     * @name Feature bits
+     */
+    static const FeatureBits F_MTU = (1 << 3);
+    static const FeatureBits F_MAC = (1 << 5);
+    static const FeatureBits F_STATUS = (1 << 16);
+    static const FeatureBits F_CTRL_VQ = (1 << 17);
+    static const FeatureBits F_MQ = (1 << 22);
+    /** @} */
+
+    /** Link status bit in the configuration space */
+    static const uint16_t S_LINK_UP = 1;
+
+    /**
+     * Network device configuration structure
+     *
+     * @note This needs to be changed if the supported feature set
+     * changes!
+     */
+    struct GEM5_PACKED Config
+    {
+        uint8_t mac[6];
+        uint16_t status;
+        uint16_t max_virtqueue_pairs;
+        uint16_t mtu;
+    };
+    Config config;
+
+    /**
+     * Header preceding every frame in both directions. The fields are
+     * only meaningful with offloads, which this device does not
+     * offer, so it is ignored on transmit and zero on receive.
+     */
+    struct GEM5_PACKED NetHdr
+    {
+        uint8_t flags;
+        uint8_t gso_type;
+        uint16_t hdr_len;
+        uint16_t gso_size;
+        uint16_t csum_start;
+        uint16_t csum_offset;
+    };
+
+    /** @{
+     * @name Control queue commands
+     */
+    struct GEM5_PACKED CtrlHdr
+    {
+        uint8_t cls;
+        uint8_t cmd;
+    };
+
+    typedef uint8_t CtrlAck;
+    static const CtrlAck CTRL_OK = 0;
+    static const CtrlAck CTRL_ERR = 1;
+
+    /** Multiqueue command class */
+    static const uint8_t CTRL_MQ = 4;
+    /** Set the number of active queue pairs */
+    static const uint8_t CTRL_MQ_VQ_PAIRS_SET = 0;
+    /** @} */
+
+  protected:
+    /** Virtqueue holding guest buffers for incoming frames */
+    class RxQueue : public VirtQueue
+    {
+      public:
+        RxQueue(PortProxy &proxy, ByteOrder bo, uint16_t size,
+                VirtIONet &_parent, unsigned _pair);
+        virtual ~RxQueue() {}
+
+        void onNotify() override { parent.rxDrain(pair); }
+
+      protected:
+        VirtIONet &parent;
+        const unsigned pair;
+    };
+
+    /** Virtqueue holding frames the guest wants to send */
+    class TxQueue : public VirtQueue
+    {
+      public:
+        TxQueue(PortProxy &proxy, ByteOrder bo, uint16_t size,
+                VirtIONet &_parent, unsigned _pair);
+        virtual ~TxQueue() {}
+
+        void onNotify() override { parent.txKick(); }
+
+      protected:
+        VirtIONet &parent;
+        const unsigned pair;
+    };
+
+    /** Virtqueue carrying control commands from the guest */
+    class CtrlQueue : public VirtQueue
+    {
+      public:
+        CtrlQueue(PortProxy &proxy, ByteOrder bo, uint16_t size,
+                  VirtIONet &_parent);
+        virtual ~CtrlQueue() {}
+
+        void onNotifyDescriptor(VirtDescriptor *desc) override;
+
+      protected:
+        VirtIONet &parent;
+    };
+
+    /**
+     * Pick the queue pair that receives a frame.
+     *
+     * Frames of the same flow always end up in the same pair. The
+     * hash is symmetric, so both directions of a connection are
+     * handled by the same queue pair in a multi-core guest.
+     */
+    unsigned rxPair(const EthPacketPtr &pkt) const;
+
+    /**
+     * Copy a frame into the next guest receive buffer of a pair.
+     *
+     * @return false if the guest has not posted any buffer.
+     */
+    bool rxDeliver(unsigned pair, const EthPacketPtr &pkt);
+
+    /** Deliver frames waiting for guest buffers in a pair's FIFO */
+    void rxDrain(unsigned pair);
+
+    /** Pull frames from the transmit queues and send them */
+    void txKick();
+
+    /** Send frames from the transmit FIFO until the link is busy */
+    void txSend();
+
+    /** Execute a control command from the guest */
+    void ctrlCommand(VirtDescriptor *desc);
+
+    /** Largest frame the guest may send or receive */
+    unsigned maxFrameSize() const;
+
+    std::vector<std::unique_ptr<RxQueue>> rxQueues;
+    std::vector<std::unique_ptr<TxQueue>> txQueues;
+    std::unique_ptr<CtrlQueue> ctrlQueue;
+
+    /** Frames waiting for receive buffers, one FIFO per queue pair */
+    std::vector<PacketFifo> rxFifos;
+    /** Frames taken from the guest that have not been sent yet */
+    PacketFifo txFifo;
+
+    /** Number of queue pairs the guest currently uses */
+    unsigned activePairs;
+
+    VirtIONetInt *interface;
+
+    struct NetStats : public statistics::Group
+    {
+        NetStats(statistics::Group *parent);
+
+        statistics::Scalar txPackets;
+        statistics::Scalar txBytes;
+        statistics::Scalar rxPackets;
+        statistics::Scalar rxBytes;
+        statistics::Scalar rxDrops;
+        statistics::Scalar txDrops;
+    } stats;
+};
+
+class VirtIONetInt : public EtherInt
+{
+  private:
+    VirtIONet *dev;
+
+  public:
+    VirtIONetInt(const std::string &name, VirtIONet *d)
+        : EtherInt(name), dev(d)
+    { }
+
+    bool recvPacket(EthPacketPtr pkt) override
+    {
+        return dev->recvPacket(pkt);
+    }
+    void sendDone() override { dev->transferDone(); }
+};
+
+} // namespace gem5
+
+#endif // __DEV_VIRTIO_NET_HH__
@@ -86,7 +86,8 @@ VirtIORng::RngQueue::trySend()
 
         // Tell the guest that we are done with this descriptor.
         produceDescriptor(d, len);
-        parent.kick();
+        if (needsKick())
+            parent.kick();
     }
 }
 
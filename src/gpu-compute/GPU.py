@@ -288,6 +288,11 @@ class ComputeUnit(ClockedObject):
     fetch_depth = Param.Int(
         2, "number of i-cache lines that may be buffered in the fetch unit."
     )
+    skip_idle_cycles = Param.Bool(
+        False,
+        "stop ticking while all waves wait on memory or a barrier, "
+        "accounting for the skipped cycles in the stats",
+    )
 
 
 class Shader(ClockedObject):
@@ -354,6 +359,20 @@ class GPUDispatcher(SimObject):
         False, "Enable exiting sim loop after a kernel"
     )
 
+    # Kernels which are fast-forwarded fetch and access memory functionally,
+    # without going through the TLBs and the caches.
+    fast_forward_kernels = VectorParam.String(
+        [], "Names of the kernels to fast-forward"
+    )
+    fast_forward_kernel_ids = VectorParam.Int(
+        [], "Dispatch IDs, i.e., launch indices, of kernels to fast-forward"
+    )
+    detailed_launches_per_kernel = Param.Int(
+        0,
+        "Number of launches of each kernel code to simulate in detail "
+        "before its other launches are fast-forwarded (0: no sampling)",
+    )
+
 
 class GPUCommandProcessor(DmaVirtDevice):
     type = "GPUCommandProcessor"
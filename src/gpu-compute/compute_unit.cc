@@ -31,6 +31,7 @@
 
 #include "gpu-compute/compute_unit.hh"
 
+#include <algorithm>
 #include <limits>
 
 #include "arch/amdgpu/common/gpu_translation_state.hh"
@@ -81,6 +82,10 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
     scalarMemoryPipe(p, *this),
     tickEvent([this]{ exec(); }, "Compute unit tick event",
           false, Event::CPU_Tick_Pri),
+    scheduledAddsEvent([this]{ execScheduledAdds(); },
+          "Compute unit scheduled adds event", false, Event::CPU_Tick_Pri),
+    skipIdleCycles(p.skip_idle_cycles), idleSkipping(false),
+    idleSkipTick(0),
     cu_id(p.cu_id),
     vrf(p.vector_register_file), srf(p.scalar_register_file),
     rfc(p.register_file_cache),
@@ -98,7 +103,7 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
     prefetchStride(p.prefetch_stride), prefetchType(p.prefetch_prev_type),
     debugSegFault(p.debugSegFault),
     functionalTLB(p.functionalTLB), localMemBarrier(p.localMemBarrier),
-    countPages(p.countPages),
+    countPages(p.countPages), reportingThread(std::thread::id()),
     req_tick_latency(p.mem_req_latency * p.clk_domain->clockPeriod()),
     resp_tick_latency(p.mem_resp_latency * p.clk_domain->clockPeriod()),
     scalar_req_tick_latency(
@@ -338,6 +343,7 @@ ComputeUnit::startWavefront(Wavefront *w, int waveId, LdsChunk *ldsChunk,
     w->execMask() = init_mask;
 
     w->kernId = task->dispatchId();
+    w->fastForward = task->fastForward();
     w->wfId = waveId;
     w->initMask = init_mask.to_ullong();
 
@@ -458,6 +464,9 @@ ComputeUnit::resetRegisterPool()
 void
 ComputeUnit::dispWorkgroup(HSAQueueEntry *task, int num_wfs_in_wg)
 {
+    // A CU which is skipping idle cycles resumes in this cycle
+    wakeFromIdle();
+
     // If we aren't ticking, start it up!
     if (!tickEvent.scheduled()) {
         DPRINTF(GPUDisp, "CU%d: Scheduling wakeup next cycle\n", cu_id);
@@ -780,10 +789,139 @@ ComputeUnit::exec()
 
     // Put this CU to sleep if there is no more work to be done.
     if (!isDone()) {
-        schedule(tickEvent, nextCycle());
+        if (skipIdleCycles && isQuiescent()) {
+            DPRINTF(GPUExec, "CU%d: All waves blocked, skipping cycles\n",
+                    cu_id);
+            idleSkipping = true;
+            idleSkipTick = curTick();
+        } else {
+            schedule(tickEvent, nextCycle());
+        }
     } else {
-        shader->notifyCuSleep();
         DPRINTF(GPUDisp, "CU%d: Going to sleep\n", cu_id);
+        Shader::ScopedReport report(this);
+        shader->notifyCuSleep();
+    }
+}
+
+/**
+ * The CU is quiescent when no stage would change any state in the
+ * coming cycles: every wave slot is empty, waiting on a waitcnt or a
+ * barrier, or waiting on an instruction fetch, and no pipeline holds
+ * an instruction that could make progress. Only a memory response or
+ * a workgroup dispatch can then unblock a wave, and those call
+ * wakeFromIdle(). Anything timed, like scheduled counter updates or
+ * s_sleep, keeps the CU ticking.
+ */
+bool
+ComputeUnit::isQuiescent() const
+{
+    return scheduledAdds.empty() &&
+        scoreboardCheckStage.quiescent() &&
+        scheduleStage.quiescent() &&
+        fetchStage.quiescent() &&
+        globalMemoryPipe.quiescent() &&
+        localMemoryPipe.quiescent() &&
+        scalarMemoryPipe.quiescent();
+}
+
+void
+ComputeUnit::catchUpIdleCycles(Tick until)
+{
+    assert(idleSkipping);
+
+    if (until <= idleSkipTick) {
+        return;
+    }
+
+    // count the clock edges in (idleSkipTick, until)
+    Cycles cycles((until - idleSkipTick - 1) / clockPeriod());
+    if (!cycles) {
+        return;
+    }
+
+    stats.totalCycles += cycles;
+    stats.idleCyclesSkipped += cycles;
+    scoreboardCheckStage.skipIdleCycles(cycles);
+    scheduleStage.skipIdleCycles(cycles);
+    execStage.skipIdleCycles(cycles);
+
+    idleSkipTick += cycles * clockPeriod();
+}
+
+void
+ComputeUnit::wakeFromIdle()
+{
+    if (!idleSkipping) {
+        return;
+    }
+
+    // Memory responses are handled before the tick event of the same
+    // tick, so the tick at the current edge, if any, would have seen
+    // their effects. Resume there, but never in a cycle that already ran.
+    Tick when = std::max(clockEdge(), idleSkipTick + clockPeriod());
+
+    catchUpIdleCycles(when);
+    idleSkipping = false;
+
+    DPRINTF(GPUExec, "CU%d: Resuming at tick %lu\n", cu_id, when);
+    schedule(tickEvent, when);
+}
+
+void
+ComputeUnit::preDumpStats()
+{
+    if (idleSkipping) {
+        catchUpIdleCycles(curTick() + 1);
+    }
+
+    ClockedObject::preDumpStats();
+}
+
+void
+ComputeUnit::resetStats()
+{
+    if (idleSkipping) {
+        catchUpIdleCycles(curTick() + 1);
+    }
+
+    ClockedObject::resetStats();
+}
+
+void
+ComputeUnit::execScheduledAdds()
+{
+    assert(!scheduledAdds.empty());
+
+    // apply any scheduled adds
+    for (auto it = scheduledAdds.begin(); it != scheduledAdds.end();) {
+        if (it->when <= curTick()) {
+            *it->val += it->x;
+            panic_if(*it->val < 0, "Negative counter value\n");
+            it = scheduledAdds.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    if (!scheduledAdds.empty()) {
+        Tick wakeup = std::max_element(scheduledAdds.begin(),
+            scheduledAdds.end(), [](const auto &a, const auto &b)
+            { return a.when < b.when; })->when;
+        DPRINTF(GPUDisp, "CU%d: Scheduling scheduled adds at %lu\n",
+                cu_id, wakeup);
+        schedule(scheduledAddsEvent, wakeup);
+    }
+}
+
+void
+ComputeUnit::scheduleAdd(int *val, Tick when, int x)
+{
+    when += curTick();
+    scheduledAdds.push_back({val, when, x});
+    if (!scheduledAddsEvent.scheduled() ||
+        when < scheduledAddsEvent.when()) {
+        DPRINTF(GPUDisp, "CU%d: New scheduled add at %lu\n", cu_id, when);
+        reschedule(scheduledAddsEvent, when, true);
     }
 }
 
@@ -868,6 +1006,7 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
             assert(cu != nullptr);
 
             if (pkt->req->isInvL2()) {
+                Shader::ScopedReport report(cu);
                 cu->shader->decNumOutstandingInvL2s();
                 assert(cu->shader->getNumOutstandingInvL2s() >= 0);
             } else {
@@ -890,7 +1029,10 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
             assert(pkt->req->isInvL1());
 
             // one D-Cache inv is done, decrement counter
-            dispatcher.updateInvCounter(gpuDynInst->kern_id);
+            {
+                Shader::ScopedReport report(computeUnit);
+                dispatcher.updateInvCounter(gpuDynInst->kern_id);
+            }
 
             delete pkt->senderState;
             delete pkt;
@@ -913,7 +1055,11 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
 
             // once flush done, decrement counter, and return whether all
             // dirty writeback operations are done for the kernel
-            bool isWbDone = dispatcher.updateWbCounter(gpuDynInst->kern_id);
+            bool isWbDone;
+            {
+                Shader::ScopedReport report(computeUnit);
+                isWbDone = dispatcher.updateWbCounter(gpuDynInst->kern_id);
+            }
 
             // not all wbs are done for the kernel, just release pkt
             // resources
@@ -929,7 +1075,10 @@ ComputeUnit::DataPort::handleResponse(PacketPtr pkt)
                     computeUnit->cu_id, w->simdId, w->wfSlotId,
                     w->wfDynId, w->wgId);
 
-            dispatcher.notifyWgCompl(w);
+            {
+                Shader::ScopedReport report(computeUnit);
+                dispatcher.notifyWgCompl(w);
+            }
             w->setStatus(Wavefront::S_STOPPED);
         }
 
@@ -1006,6 +1155,7 @@ ComputeUnit::ScalarDataPort::handleResponse(PacketPtr pkt)
                 computeUnit->scalarMemoryPipe.getGMStRespFIFO().push(
                                 gpuDynInst);
         }
+        computeUnit->wakeFromIdle();
     }
 
     delete pkt->senderState;
@@ -1174,14 +1324,18 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
         fatal("pkt is not a read nor a write\n");
     }
 
-    if (!functionalTLB) {
+    // Fast-forwarded kernels access memory functionally like a simulation
+    // which is not timing
+    bool timing = shader->timingSim && !gpuDynInst->wavefront()->fastForward;
+
+    if (!functionalTLB && timing) {
         stats.tlbCycles -= curTick();
     }
     ++stats.tlbRequests;
 
     PortID tlbPort_index = perLaneTLB ? index : 0;
 
-    if (shader->timingSim) {
+    if (timing) {
         if (!FullSystem && debugSegFault) {
             Process *p = shader->gpuTc->getProcessPtr();
             Addr vaddr = pkt->req->getVaddr();
@@ -1313,8 +1467,16 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
         PacketPtr new_pkt = new Packet(pkt->req, pkt->cmd);
         new_pkt->dataStatic(pkt->getPtr<uint8_t>());
 
+        if (!new_pkt->req->systemReq()) {
+            new_pkt->req->requestorId(vramRequestorId());
+        }
+
         // Translation is done. It is safe to send the packet to memory.
-        memPort[0].sendFunctional(new_pkt);
+        if (new_pkt->isAtomicOp()) {
+            sendFunctionalAtomic(new_pkt);
+        } else {
+            memPort[0].sendFunctional(new_pkt);
+        }
 
         DPRINTF(GPUMem, "Functional sendRequest\n");
         DPRINTF(GPUMem, "CU%d: WF[%d][%d]: index %d: addr %#x\n", cu_id,
@@ -1332,6 +1494,28 @@ ComputeUnit::sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt)
     }
 }
 
+void
+ComputeUnit::sendFunctionalAtomic(PacketPtr pkt)
+{
+    // Functional accesses only read or write, so perform the atomic as a
+    // read followed by a write. The packet returns the old value, as it
+    // does from the memory system.
+    std::vector<uint8_t> data(pkt->getSize());
+
+    Packet read_pkt(pkt->req, MemCmd::ReadReq);
+    read_pkt.dataStatic(data.data());
+    memPort[0].sendFunctional(&read_pkt);
+
+    pkt->setData(data.data());
+    (*pkt->getAtomicOp())(data.data());
+
+    Packet write_pkt(pkt->req, MemCmd::WriteReq);
+    write_pkt.dataStatic(data.data());
+    memPort[0].sendFunctional(&write_pkt);
+
+    pkt->makeResponse();
+}
+
 void
 ComputeUnit::sendScalarRequest(GPUDynInstPtr gpuDynInst, PacketPtr pkt)
 {
@@ -1339,6 +1523,35 @@ ComputeUnit::sendScalarRequest(GPUDynInstPtr gpuDynInst, PacketPtr pkt)
 
     BaseMMU::Mode tlb_mode = pkt->isRead() ? BaseMMU::Read : BaseMMU::Write;
 
+    if (!shader->timingSim || gpuDynInst->wavefront()->fastForward) {
+        // Translate and access memory functionally, then complete the
+        // request as if its response had returned
+        pkt->senderState = new GpuTranslationState(tlb_mode, shader->gpuTc);
+        scalarDTLBPort.sendFunctional(pkt);
+
+        GpuTranslationState *translation_state =
+            safe_cast<GpuTranslationState*>(pkt->senderState);
+        fatal_if(!translation_state->tlbEntry,
+                 "Translation of vaddr %#x failed\n", pkt->req->getVaddr());
+        delete translation_state->tlbEntry;
+        delete translation_state;
+
+        PacketPtr req_pkt = new Packet(pkt->req, pkt->isRead() ?
+                                       MemCmd::ReadReq : MemCmd::WriteReq);
+        req_pkt->dataStatic(pkt->getPtr<uint8_t>());
+        delete pkt;
+
+        if (!req_pkt->req->systemReq()) {
+            req_pkt->req->requestorId(vramRequestorId());
+        }
+
+        req_pkt->senderState =
+            new ComputeUnit::ScalarDataPort::SenderState(gpuDynInst);
+        scalarDataPort.sendFunctional(req_pkt);
+        scalarDataPort.handleResponse(req_pkt);
+        return;
+    }
+
     pkt->senderState =
         new ComputeUnit::ScalarDTLBPort::SenderState(gpuDynInst);
 
@@ -2011,8 +2224,7 @@ ComputeUnit::updateInstStats(GPUDynInstPtr gpuDynInst)
         }
     } else {
         if (gpuDynInst->isALU()) {
-            shader->total_valu_insts++;
-            if (shader->total_valu_insts == shader->max_valu_insts) {
+            if (++shader->total_valu_insts == shader->max_valu_insts) {
                 exitSimLoop("max vALU insts");
             }
             stats.vALUInsts++;
@@ -2234,6 +2446,7 @@ ComputeUnit::LDSPort::recvTimingResp(PacketPtr packet)
     delete packet;
 
     computeUnit->localMemoryPipe.getLMRespFIFO().push(gpuDynInst);
+    computeUnit->wakeFromIdle();
     return true;
 }
 
@@ -2472,6 +2685,8 @@ ComputeUnit::ComputeUnitStats::ComputeUnitStats(statistics::Group *parent,
       ADD_STAT(numVecOpsExecutedTwoOpFP,
                "number of two op FP vec ops executed (e.g. WF size/inst)"),
       ADD_STAT(totalCycles, "number of cycles the CU ran for"),
+      ADD_STAT(idleCyclesSkipped, "number of cycles in which all waves "
+               "were blocked and the CU was not simulated"),
       ADD_STAT(vpc, "Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f16, "F16 Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f32, "F32 Vector Operations per cycle (this CU only)"),
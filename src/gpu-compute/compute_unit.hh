@@ -32,8 +32,10 @@
 #ifndef __COMPUTE_UNIT_HH__
 #define __COMPUTE_UNIT_HH__
 
+#include <atomic>
 #include <deque>
 #include <map>
+#include <thread>
 #include <unordered_set>
 #include <vector>
 
@@ -288,6 +290,29 @@ class ComputeUnit : public ClockedObject
 
     EventFunctionWrapper tickEvent;
 
+    // Updates of wavefront counters which are scheduled for later by
+    // the memory pipelines. They are kept by the CU rather than the
+    // shader so that they run on the event queue of the CU.
+    struct ScheduledAdd
+    {
+        int *val;
+        Tick when;
+        int x;
+    };
+    std::vector<ScheduledAdd> scheduledAdds;
+    EventFunctionWrapper scheduledAddsEvent;
+
+    // When set, the CU stops ticking while every wave is blocked on an
+    // event from outside the pipeline (see isQuiescent()) and resumes
+    // from wakeFromIdle(). The skipped cycles are accounted for in the
+    // per-cycle stats as if they had been simulated.
+    bool skipIdleCycles;
+    // True while the tick event is descheduled because the CU is
+    // quiescent, as opposed to being asleep because it has no waves.
+    bool idleSkipping;
+    // The last cycle whose stats have been accounted for while skipping
+    Tick idleSkipTick;
+
     typedef ComputeUnitParams Params;
     std::vector<std::vector<Wavefront*>> wfList;
     int cu_id;
@@ -356,6 +381,9 @@ class ComputeUnit : public ClockedObject
     bool countPages;
 
     Shader *shader;
+    // The thread which reports to the shader for this CU, if any. See
+    // Shader::ScopedReport.
+    std::atomic<std::thread::id> reportingThread;
 
     Tick req_tick_latency;
     Tick resp_tick_latency;
@@ -404,6 +432,25 @@ class ComputeUnit : public ClockedObject
     int wfSize() const { return wavefrontSize; }
 
     void exec();
+
+    // Check whether simulating the next cycle would only update stats
+    bool isQuiescent() const;
+    // Restart ticking after an event that may unblock a wave
+    void wakeFromIdle();
+    // Account for the cycles skipped before tick until
+    void catchUpIdleCycles(Tick until);
+    // Whether the CU is running waves, including while skipping cycles
+    bool isActive() const { return tickEvent.scheduled() || idleSkipping; }
+
+    void preDumpStats() override;
+    void resetStats() override;
+
+    // Run the scheduled adds which are due
+    void execScheduledAdds();
+
+    // Schedule a 32-bit value to be incremented some time in the future
+    void scheduleAdd(int *val, Tick when, int x);
+
     void initiateFetch(Wavefront *wavefront);
     void fetch(PacketPtr pkt, Wavefront *wavefront);
     void fillKernelState(Wavefront *w, HSAQueueEntry *task);
@@ -459,6 +506,8 @@ class ComputeUnit : public ClockedObject
 
     virtual void init() override;
     void sendRequest(GPUDynInstPtr gpuDynInst, PortID index, PacketPtr pkt);
+    // Perform an atomic on memory with functional accesses
+    void sendFunctionalAtomic(PacketPtr pkt);
     void sendScalarRequest(GPUDynInstPtr gpuDynInst, PacketPtr pkt);
     void injectGlobalMemFence(GPUDynInstPtr gpuDynInst,
                               bool kernelMemSync,
@@ -1158,6 +1207,8 @@ class ComputeUnit : public ClockedObject
         statistics::Scalar numVecOpsExecutedTwoOpFP;
         // Total cycles that something is running on the GPU
         statistics::Scalar totalCycles;
+        // Cycles accounted for in totalCycles that were not simulated
+        statistics::Scalar idleCyclesSkipped;
         statistics::Formula vpc; // vector ops per cycle
         statistics::Formula vpc_f16; // vector ops per cycle
         statistics::Formula vpc_f32; // vector ops per cycle
@@ -52,6 +52,11 @@ GPUDispatcher::GPUDispatcher(const Params &p)
       tickEvent([this]{ exec(); },
           "GPU Dispatcher tick", false, Event::CPU_Tick_Pri),
       dispatchActive(false), kernelExitEvents(p.kernel_exit_events),
+      ffKernelNames(p.fast_forward_kernels.begin(),
+                    p.fast_forward_kernels.end()),
+      ffKernelIds(p.fast_forward_kernel_ids.begin(),
+                  p.fast_forward_kernel_ids.end()),
+      detailedLaunches(p.detailed_launches_per_kernel),
       stats(this)
 {
     schedule(&tickEvent, 0);
@@ -122,6 +127,13 @@ GPUDispatcher::dispatch(HSAQueueEntry *task)
     DPRINTF(GPUAgentDisp, "launching kernel: %s, dispatch ID: %d\n",
             task->kernelName(), task->dispatchId());
 
+    task->fastForward(isFastForwarded(task));
+    task->launchTick(curTick());
+
+    DPRINTF(GPUKernelInfo, "Kernel %s, dispatch ID: %d, runs %s\n",
+            task->kernelName(), task->dispatchId(),
+            task->fastForward() ? "fast-forwarded" : "in detail");
+
     execIds.push(task->dispatchId());
     dispatchActive = true;
     hsaQueueEntries.emplace(task->dispatchId(), task);
@@ -324,6 +336,8 @@ GPUDispatcher::notifyWgCompl(Wavefront *wf)
                 curTick(), kern_id);
         DPRINTF(GPUKernelInfo, "Completed kernel %d\n", kern_id);
 
+        recordKernelTime(task);
+
         if (kernelExitEvents) {
             shader->requestKernelExitEvent(task->completionSignal());
         }
@@ -334,6 +348,46 @@ GPUDispatcher::notifyWgCompl(Wavefront *wf)
     }
 }
 
+bool
+GPUDispatcher::isFastForwarded(HSAQueueEntry *task)
+{
+    int launches = kernelSamples[task->codeAddr()].launches++;
+
+    if (ffKernelNames.count(task->kernelName()) ||
+        ffKernelIds.count(task->dispatchId())) {
+        return true;
+    }
+
+    return detailedLaunches > 0 && launches >= detailedLaunches;
+}
+
+void
+GPUDispatcher::recordKernelTime(HSAQueueEntry *task)
+{
+    Tick ticks = curTick() - task->launchTick();
+    KernelSamples &samples = kernelSamples[task->codeAddr()];
+
+    if (!task->fastForward()) {
+        ++stats.detailedKernels;
+        stats.detailedKernelTicks += ticks;
+        ++samples.samples;
+        samples.ticks += ticks;
+        return;
+    }
+
+    ++stats.fastForwardedKernels;
+    stats.fastForwardedKernelTicks += ticks;
+
+    // Without a detailed sample, the time the kernel took when it was
+    // fast-forwarded is the best estimate there is.
+    if (samples.samples) {
+        stats.scaledKernelTicks += samples.ticks / samples.samples;
+    } else {
+        ++stats.unsampledKernels;
+        stats.scaledKernelTicks += ticks;
+    }
+}
+
 void
 GPUDispatcher::scheduleDispatch()
 {
@@ -347,8 +401,22 @@ GPUDispatcher::GPUDispatcherStats::GPUDispatcherStats(
     : statistics::Group(parent),
       ADD_STAT(numKernelLaunched, "number of kernel launched"),
       ADD_STAT(cyclesWaitingForDispatch, "number of cycles with outstanding "
-               "wavefronts that are waiting to be dispatched")
+               "wavefronts that are waiting to be dispatched"),
+      ADD_STAT(detailedKernels, "number of kernels simulated in detail"),
+      ADD_STAT(fastForwardedKernels, "number of kernels fast-forwarded"),
+      ADD_STAT(unsampledKernels, "number of kernels fast-forwarded without "
+               "a detailed sample of the same code"),
+      ADD_STAT(detailedKernelTicks, statistics::units::Tick::get(),
+               "run time of the kernels simulated in detail"),
+      ADD_STAT(fastForwardedKernelTicks, statistics::units::Tick::get(),
+               "run time of the fast-forwarded kernels"),
+      ADD_STAT(scaledKernelTicks, statistics::units::Tick::get(),
+               "estimated detailed run time of the fast-forwarded kernels, "
+               "from the mean of the detailed samples of the same code"),
+      ADD_STAT(estimatedKernelTicks, statistics::units::Tick::get(),
+               "estimated detailed run time of all the kernels")
 {
+    estimatedKernelTicks = detailedKernelTicks + scaledKernelTicks;
 }
 
 } // namespace gem5
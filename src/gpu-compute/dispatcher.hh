@@ -42,7 +42,9 @@
 #define __GPU_COMPUTE_DISPATCHER_HH__
 
 #include <queue>
+#include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "base/statistics.hh"
@@ -82,6 +84,20 @@ class GPUDispatcher : public SimObject
     HSAQueueEntry* hsaTask(int disp_id);
 
   private:
+    /**
+     * Whether a kernel which is launched should be fast-forwarded, i.e.,
+     * have its memory accesses done functionally, instead of being
+     * simulated in detail. This counts the launch of the kernel.
+     */
+    bool isFastForwarded(HSAQueueEntry *task);
+
+    /**
+     * Account the run time of a completed kernel. The time of a kernel
+     * which was fast-forwarded is estimated from the launches of the same
+     * code which were simulated in detail.
+     */
+    void recordKernelTime(HSAQueueEntry *task);
+
     Shader *shader;
     GPUCommandProcessor *gpuCmdProc;
     EventFunctionWrapper tickEvent;
@@ -95,6 +111,25 @@ class GPUDispatcher : public SimObject
     // Enable exiting sim loop after each kernel completion
     bool kernelExitEvents;
 
+    // kernels to fast-forward, by name and by dispatch ID
+    std::unordered_set<std::string> ffKernelNames;
+    std::unordered_set<int> ffKernelIds;
+    // launches of each kernel simulated in detail before the others are
+    // fast-forwarded, 0 if the kernels are not sampled. Kernels are told
+    // apart by their code, since SE mode only names them by type.
+    int detailedLaunches;
+
+    struct KernelSamples
+    {
+        // launches of the kernel so far
+        int launches = 0;
+        // launches which were simulated in detail and have completed
+        int samples = 0;
+        // total run time of the samples
+        Tick ticks = 0;
+    };
+    std::unordered_map<Addr, KernelSamples> kernelSamples;
+
   protected:
     struct GPUDispatcherStats : public statistics::Group
     {
@@ -102,6 +137,14 @@ class GPUDispatcher : public SimObject
 
         statistics::Scalar numKernelLaunched;
         statistics::Scalar cyclesWaitingForDispatch;
+
+        statistics::Scalar detailedKernels;
+        statistics::Scalar fastForwardedKernels;
+        statistics::Scalar unsampledKernels;
+        statistics::Scalar detailedKernelTicks;
+        statistics::Scalar fastForwardedKernelTicks;
+        statistics::Scalar scaledKernelTicks;
+        statistics::Formula estimatedKernelTicks;
     } stats;
 };
 
@@ -99,6 +99,23 @@ ExecStage::collectStatistics(enum STAT_STATUS stage, int unitId) {
     }
 }
 
+void
+ExecStage::skipIdleCycles(Cycles cycles)
+{
+    for (int unitId = 0; unitId < computeUnit.numExeUnits(); ++unitId) {
+        stats.numCyclesWithNoInstrTypeIssued[unitId] += cycles;
+    }
+
+    // same as collectStatistics(PostExec, 0) for each idle cycle
+    if (lastTimeInstExecuted) {
+        ++stats.numTransActiveIdle;
+    }
+    idle_dur += cycles;
+    lastTimeInstExecuted = false;
+    stats.numCyclesWithNoIssue += cycles;
+    stats.spc.sample(0, cycles);
+}
+
 void
 ExecStage::initStatistics()
 {
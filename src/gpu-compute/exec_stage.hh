@@ -39,6 +39,7 @@
 
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
+#include "base/types.hh"
 
 namespace gem5
 {
@@ -78,6 +79,9 @@ class ExecStage
     ~ExecStage() { }
     void init();
     void exec();
+    // Collect the stats of cycles skipped by the CU, in which no
+    // instruction was dispatched
+    void skipIdleCycles(Cycles cycles);
 
     std::string dispStatusToStr(int j);
     void dumpDispList();
@@ -69,6 +69,18 @@ FetchStage::exec()
     }
 }
 
+bool
+FetchStage::quiescent() const
+{
+    for (int j = 0; j < numVectorALUs; ++j) {
+        if (!_fetchUnit[j].quiescent()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 FetchStage::processFetchReturn(PacketPtr pkt)
 {
@@ -58,6 +58,8 @@ class FetchStage
     ~FetchStage();
     void init();
     void exec();
+    // Check whether no fetch unit has work to do
+    bool quiescent() const;
     void processFetchReturn(PacketPtr pkt);
     void fetch(PacketPtr pkt, Wavefront *wave);
 
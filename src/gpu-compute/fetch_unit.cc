@@ -132,6 +132,32 @@ FetchUnit::exec()
     }
 }
 
+bool
+FetchUnit::quiescent() const
+{
+    if (!fetchQueue.empty()) {
+        return false;
+    }
+
+    for (int j = 0; j < computeUnit.shader->n_wf; ++j) {
+        if (!fetchBuf[j].quiescent()) {
+            return false;
+        }
+
+        // same condition as in exec() for a wave to be fetched for
+        Wavefront *curWave = fetchStatusQueue[j].first;
+        if (!fetchStatusQueue[j].second &&
+            (curWave->getStatus() == Wavefront::S_RUNNING ||
+             curWave->getStatus() == Wavefront::S_WAITCNT) &&
+            fetchBuf[j].hasFreeSpace() && !curWave->stopFetch() &&
+            !curWave->pendingFetch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 FetchUnit::initiateFetch(Wavefront *wavefront)
 {
@@ -168,7 +194,7 @@ FetchUnit::initiateFetch(Wavefront *wavefront)
 
     PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
 
-    if (timingSim) {
+    if (timingSim && !wavefront->fastForward) {
         // SenderState needed on Return
         pkt->senderState = new ComputeUnit::ITLBPort::SenderState(wavefront);
 
@@ -278,7 +304,7 @@ FetchUnit::fetch(PacketPtr pkt, Wavefront *wavefront)
     // New SenderState for the memory access
     pkt->senderState = new ComputeUnit::SQCPort::SenderState(wavefront);
 
-    if (timingSim) {
+    if (timingSim && !wavefront->fastForward) {
         // translation is done. Send the appropriate timing memory request.
 
         if (pkt->req->systemReq()) {
@@ -324,6 +350,7 @@ FetchUnit::processFetchReturn(PacketPtr pkt)
     }
 
     wavefront->pendingFetch = false;
+    computeUnit.wakeFromIdle();
 
     delete pkt->senderState;
     delete pkt;
@@ -514,6 +541,26 @@ FetchUnit::FetchBufDesc::hasFetchDataToProcess() const
     return fetchBytesRemaining() >= sizeof(TheGpuISA::RawMachInst);
 }
 
+bool
+FetchUnit::FetchBufDesc::quiescent() const
+{
+    if (hasFetchDataToProcess() &&
+        (splitDecode() || wavefront->instructionBuffer.size() < maxIbSize)) {
+        return false;
+    }
+
+    if (!hasFreeSpace()) {
+        Addr cur_wave_pc = roundDown(wavefront->pc(),
+                                     wavefront->computeUnit->cacheLineSize());
+        if (reservedPCs.find(cur_wave_pc) == reservedPCs.end() &&
+            bufferedPCs.find(cur_wave_pc) != bufferedPCs.begin()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 FetchUnit::FetchBufDesc::checkWaveReleaseBuf()
 {
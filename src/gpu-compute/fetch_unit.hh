@@ -59,6 +59,8 @@ class FetchUnit
     ~FetchUnit();
     void init();
     void exec();
+    // Check whether exec() would neither decode nor fetch anything
+    bool quiescent() const;
     void bindWaveList(std::vector<Wavefront*> *list);
     void initiateFetch(Wavefront *wavefront);
     void fetch(PacketPtr pkt, Wavefront *wavefront);
@@ -164,6 +166,13 @@ class FetchUnit
          */
         void checkWaveReleaseBuf();
 
+        /**
+         * checks if neither decodeInsts() nor checkWaveReleaseBuf()
+         * can change the state of this buffer while its WF is not
+         * executing.
+         */
+        bool quiescent() const;
+
         void
         decoder(TheGpuISA::Decoder *dec)
         {
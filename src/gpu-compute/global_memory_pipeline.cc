@@ -150,17 +150,17 @@ GlobalMemPipeline::exec()
         Tick accessTime = curTick() - m->getAccessTime();
 
         // Decrement outstanding requests count
-        computeUnit.shader->ScheduleAdd(&w->outstandingReqs, m->time, -1);
+        computeUnit.scheduleAdd(&w->outstandingReqs, m->time, -1);
         if (m->isStore() || m->isAtomic() || m->isMemSync()) {
             computeUnit.shader->sampleStore(accessTime);
-            computeUnit.shader->ScheduleAdd(&w->outstandingReqsWrGm,
-                                             m->time, -1);
+            computeUnit.scheduleAdd(&w->outstandingReqsWrGm,
+                                    m->time, -1);
         }
 
         if (m->isLoad() || m->isAtomic() || m->isMemSync()) {
             computeUnit.shader->sampleLoad(accessTime);
-            computeUnit.shader->ScheduleAdd(&w->outstandingReqsRdGm,
-                                             m->time, -1);
+            computeUnit.scheduleAdd(&w->outstandingReqsRdGm,
+                                    m->time, -1);
         }
 
         w->validateRequestCounters();
@@ -301,6 +301,13 @@ GlobalMemPipeline::issueRequest(GPUDynInstPtr gpuDynInst)
     gmIssuedRequests.push(gpuDynInst);
 }
 
+bool
+GlobalMemPipeline::quiescent() const
+{
+    return gmIssuedRequests.empty() && (gmOrderedRespBuffer.empty() ||
+        !gmOrderedRespBuffer.begin()->second.second);
+}
+
 void
 GlobalMemPipeline::handleResponse(GPUDynInstPtr gpuDynInst)
 {
@@ -310,6 +317,7 @@ GlobalMemPipeline::handleResponse(GPUDynInstPtr gpuDynInst)
     // buffer
     assert(mem_req != gmOrderedRespBuffer.end());
     mem_req->second.second = true;
+    computeUnit.wakeFromIdle();
 }
 
 GlobalMemPipeline::
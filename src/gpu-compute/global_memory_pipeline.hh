@@ -63,6 +63,9 @@ class GlobalMemPipeline
     void init();
     void exec();
 
+    // Check whether exec() has nothing to issue or complete
+    bool quiescent() const;
+
     /**
      * Find the next ready response to service. In order to ensure
      * that no waitcnts are violated, we pop the oldest (in program order)
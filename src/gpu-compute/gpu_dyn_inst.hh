@@ -468,6 +468,23 @@ class GPUDynInst : public GPUExecContext
     // of outstanding reqs here
     int numScalarReqs;
 
+    /**
+     * Result of the last scoreboard check of this instruction against a
+     * register file: the file's scoreboard epoch at the time and the busy
+     * registers behind the RAW and WAX stalls (-1 if none). The verdict
+     * is reused while the epoch is unchanged instead of rescanning every
+     * operand, which matters for waves stalled on long latency loads.
+     */
+    struct ScoreboardStall
+    {
+        uint64_t epoch = 0;
+        int rawReg = -1;
+        int waxReg = -1;
+    };
+
+    ScoreboardStall vrfStall;
+    ScoreboardStall srfStall;
+
     Tick getAccessTime() const { return accessTime; }
 
     void setAccessTime(Tick currentTime) { accessTime = currentTime; }
@@ -83,7 +83,8 @@ class HSAQueueEntry
                          private_segment_size),
           _contextId(0), _wgId{{ 0, 0, 0 }},
           _numWgTotal(1), numWgArrivedAtBarrier(0), _numWgCompleted(0),
-          _globalWgId(0), dispatchComplete(false)
+          _globalWgId(0), dispatchComplete(false), _fastForward(false),
+          _launchTick(0)
 
     {
         // Use the resource descriptors to determine number of GPRs. This will
@@ -407,6 +408,35 @@ class HSAQueueEntry
         return _accumOffset;
     }
 
+    /**
+     * Whether the kernel is fast-forwarded, i.e., its wavefronts fetch
+     * and access memory functionally instead of through the TLBs and the
+     * caches.
+     */
+    bool
+    fastForward() const
+    {
+        return _fastForward;
+    }
+
+    void
+    fastForward(bool ff)
+    {
+        _fastForward = ff;
+    }
+
+    Tick
+    launchTick() const
+    {
+        return _launchTick;
+    }
+
+    void
+    launchTick(Tick when)
+    {
+        _launchTick = when;
+    }
+
   private:
     void
     parseKernelCode(AMDKernelCode *akc)
@@ -504,6 +534,10 @@ class HSAQueueEntry
     std::bitset<NumScalarInitFields> initialSgprState;
 
     unsigned _accumOffset;
+
+    bool _fastForward;
+    // time at which the dispatcher received the kernel
+    Tick _launchTick;
 };
 
 } // namespace gem5
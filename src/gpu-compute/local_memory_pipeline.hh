@@ -61,6 +61,13 @@ class LocalMemPipeline
     void exec();
     std::queue<GPUDynInstPtr> &getLMRespFIFO() { return lmReturnedRequests; }
 
+    // Check whether exec() has nothing to issue or complete
+    bool
+    quiescent() const
+    {
+        return lmIssuedRequests.empty() && lmReturnedRequests.empty();
+    }
+
     void issueRequest(GPUDynInstPtr gpuDynInst);
 
 
@@ -97,6 +97,8 @@ RegisterFile::markReg(int regIdx, bool value)
 {
     DPRINTF(GPURF, "SIMD[%d] markReg(): physReg[%d] = %d\n",
             simdId, regIdx, (int)value);
+    if (busy.at(regIdx) != value)
+        ++busyEpoch;
     busy.at(regIdx) = value;
 }
 
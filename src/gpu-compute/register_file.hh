@@ -68,6 +68,9 @@ class RegisterFile : public SimObject
     virtual bool regBusy(int idx) const;
     virtual void markReg(int regIdx, bool value);
 
+    // Advances whenever a register changes state, see busyEpoch
+    uint64_t scoreboardEpoch() const { return busyEpoch; }
+
     // Abstract Register Event
     class RegisterEvent : public Event
     {
@@ -149,6 +152,11 @@ class RegisterFile : public SimObject
     // flag indicating if a register is busy
     std::vector<bool> busy;
 
+    // Number of changes to the busy vector, starting at 1 so that a
+    // zero epoch never matches. Operand readiness is a function of the
+    // busy vector, so checks within one epoch give the same answer.
+    uint64_t busyEpoch = 1;
+
     // numer of registers in this register file
     int _numRegs;
 
@@ -92,6 +92,7 @@ RegisterFileCache::markRFC(int regIdx)
         return;
     }
     if (lruHash.find(regIdx) == lruHash.end()) {
+        ++_cacheEpoch;
         if (lruHead == nullptr) {
             DPRINTF(GPURFC, "RFC SIMD[%d] cache miss inserting physReg[%d]\n",
                 simdId, regIdx);
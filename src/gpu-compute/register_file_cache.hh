@@ -87,9 +87,14 @@ class RegisterFileCache : public SimObject
 
     virtual bool inRFC(int regIdx);
 
+    // Advances whenever the set of cached registers changes, as that
+    // changes which busy registers of the VRF can be read
+    uint64_t cacheEpoch() const { return _cacheEpoch; }
+
   protected:
     ComputeUnit* computeUnit;
     int simdId, _capacity;
+    uint64_t _cacheEpoch = 0;
 
     class OrderedRegs
     {
@@ -62,6 +62,14 @@ class ScalarMemPipeline
     ScalarMemPipeline(const ComputeUnitParams &p, ComputeUnit &cu);
     void exec();
 
+    // Check whether exec() has nothing to issue or complete
+    bool
+    quiescent() const
+    {
+        return issuedRequests.empty() && returnedLoads.empty() &&
+            returnedStores.empty();
+    }
+
     std::queue<GPUDynInstPtr> &getGMReqFIFO() { return issuedRequests; }
     std::queue<GPUDynInstPtr> &getGMStRespFIFO() { return returnedStores; }
     std::queue<GPUDynInstPtr> &getGMLdRespFIFO() { return returnedLoads; }
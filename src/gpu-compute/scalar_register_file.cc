@@ -51,28 +51,50 @@ ScalarRegisterFile::ScalarRegisterFile(const ScalarRegisterFileParams &p)
 bool
 ScalarRegisterFile::operandsReady(Wavefront *w, GPUDynInstPtr ii) const
 {
-    for (const auto& srcScalarOp : ii->srcScalarRegOperands()) {
-        for (const auto& physIdx : srcScalarOp.physIndices()) {
-            if (regBusy(physIdx)) {
-                DPRINTF(GPUSRF, "RAW stall: WV[%d]: %s: physReg[%d]\n",
-                        w->wfDynId, ii->disassemble(), physIdx);
-                w->stats.numTimesBlockedDueRAWDependencies++;
-                return false;
+    auto &stall = ii->srfStall;
+
+    if (stall.epoch != scoreboardEpoch()) {
+        stall = {scoreboardEpoch(), -1, -1};
+        for (const auto& srcScalarOp : ii->srcScalarRegOperands()) {
+            for (const auto& physIdx : srcScalarOp.physIndices()) {
+                if (regBusy(physIdx)) {
+                    stall.rawReg = physIdx;
+                    break;
+                }
+            }
+            if (stall.rawReg >= 0) {
+                break;
             }
         }
-    }
 
-    for (const auto& dstScalarOp : ii->dstScalarRegOperands()) {
-        for (const auto& physIdx : dstScalarOp.physIndices()) {
-            if (regBusy(physIdx)) {
-                DPRINTF(GPUSRF, "WAX stall: WV[%d]: %s: physReg[%d]\n",
-                        w->wfDynId, ii->disassemble(), physIdx);
-                w->stats.numTimesBlockedDueWAXDependencies++;
-                return false;
+        // Only look for WAX hazards if there is no RAW hazard
+        for (const auto& dstScalarOp : ii->dstScalarRegOperands()) {
+            if (stall.rawReg >= 0 || stall.waxReg >= 0) {
+                break;
+            }
+            for (const auto& physIdx : dstScalarOp.physIndices()) {
+                if (regBusy(physIdx)) {
+                    stall.waxReg = physIdx;
+                    break;
+                }
             }
         }
     }
 
+    if (stall.rawReg >= 0) {
+        DPRINTF(GPUSRF, "RAW stall: WV[%d]: %s: physReg[%d]\n",
+                w->wfDynId, ii->disassemble(), stall.rawReg);
+        w->stats.numTimesBlockedDueRAWDependencies++;
+        return false;
+    }
+
+    if (stall.waxReg >= 0) {
+        DPRINTF(GPUSRF, "WAX stall: WV[%d]: %s: physReg[%d]\n",
+                w->wfDynId, ii->disassemble(), stall.waxReg);
+        w->stats.numTimesBlockedDueWAXDependencies++;
+        return false;
+    }
+
     return true;
 }
 
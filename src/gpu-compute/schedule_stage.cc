@@ -553,6 +553,33 @@ ScheduleStage::dispatchReady(const GPUDynInstPtr &gpu_dyn_inst)
     return true;
 }
 
+bool
+ScheduleStage::quiescent() const
+{
+    if (!wavesInSch.empty()) {
+        return false;
+    }
+
+    for (int j = 0; j < computeUnit.numExeUnits(); ++j) {
+        if (!schList.at(j).empty() || toExecute.dispatchStatus(j) != EMPTY) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void
+ScheduleStage::skipIdleCycles(Cycles cycles)
+{
+    // With empty ready lists and schLists, exec() only counts the cycle
+    // as one in which no wave was scheduled for each execution resource
+    for (int j = 0; j < computeUnit.numExeUnits(); ++j) {
+        stats.rdyListEmpty[j] += cycles;
+        stats.schListToDispListStalls[j] += cycles;
+    }
+}
+
 void
 ScheduleStage::fillDispatchList()
 {
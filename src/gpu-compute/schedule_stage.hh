@@ -40,6 +40,7 @@
 
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
+#include "base/types.hh"
 #include "gpu-compute/exec_stage.hh"
 #include "gpu-compute/misc.hh"
 #include "gpu-compute/scheduler.hh"
@@ -69,6 +70,11 @@ class ScheduleStage
     void init();
     void exec();
 
+    // Check whether the stage holds no wave that could make progress
+    bool quiescent() const;
+    // Collect the stats of cycles skipped by the CU
+    void skipIdleCycles(Cycles cycles);
+
     // Stats related variables and methods
     const std::string& name() const { return _name; }
     enum SchNonRdyType
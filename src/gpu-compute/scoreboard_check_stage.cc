@@ -50,6 +50,8 @@ ScoreboardCheckStage::ScoreboardCheckStage(const ComputeUnitParams &p,
                                            ScoreboardCheckToSchedule
                                            &to_schedule)
     : computeUnit(cu), toSchedule(to_schedule),
+      lastRdyStatus(p.num_SIMDs,
+                    std::vector<nonrdytype_e>(p.n_wf, NRDY_ILLEGAL)),
       _name(cu.name() + ".ScoreboardCheckStage"), stats(&cu)
 {
 }
@@ -274,6 +276,54 @@ ScoreboardCheckStage::exec()
                 toSchedule.markWFReady(curWave, exeResType);
             }
             collectStatistics(rdyStatus);
+            lastRdyStatus[simdId][wfSlot] = rdyStatus;
+        }
+    }
+}
+
+bool
+ScoreboardCheckStage::quiescent() const
+{
+    for (int simdId = 0; simdId < computeUnit.numVectorALUs; ++simdId) {
+        for (int wfSlot = 0; wfSlot < computeUnit.shader->n_wf; ++wfSlot) {
+            Wavefront *w = computeUnit.wfList[simdId][wfSlot];
+            // Only the conditions which are cleared by a memory response,
+            // a workgroup dispatch or another wave of this CU are stable.
+            // The fetch stage runs after this one in a cycle, so recheck
+            // the ones it may have changed.
+            switch (lastRdyStatus[simdId][wfSlot]) {
+              case NRDY_WF_STOP:
+                if (w->getStatus() != Wavefront::S_STOPPED) {
+                    return false;
+                }
+                break;
+              case NRDY_WAIT_CNT:
+                if (w->getStatus() != Wavefront::S_WAITCNT) {
+                    return false;
+                }
+                break;
+              case NRDY_BARRIER_WAIT:
+                break;
+              case NRDY_IB_EMPTY:
+                if (!w->instructionBuffer.empty()) {
+                    return false;
+                }
+                break;
+              default:
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void
+ScoreboardCheckStage::skipIdleCycles(Cycles cycles)
+{
+    for (const auto &simd_status : lastRdyStatus) {
+        for (nonrdytype_e rdy_status : simd_status) {
+            stats.stallCycles[rdy_status] += cycles;
         }
     }
 }
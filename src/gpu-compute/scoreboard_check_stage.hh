@@ -40,6 +40,7 @@
 
 #include "base/statistics.hh"
 #include "base/stats/group.hh"
+#include "base/types.hh"
 
 namespace gem5
 {
@@ -80,6 +81,11 @@ class ScoreboardCheckStage
     ~ScoreboardCheckStage();
     void exec();
 
+    // Check whether the statuses found by the last exec() are stable
+    bool quiescent() const;
+    // Collect the stats of cycles skipped by the CU
+    void skipIdleCycles(Cycles cycles);
+
     // Stats related variables and methods
     const std::string& name() const { return _name; }
 
@@ -97,6 +103,10 @@ class ScoreboardCheckStage
      */
     ScoreboardCheckToSchedule &toSchedule;
 
+    // Ready status of each wave slot, indexed by SIMD and slot, in the
+    // last cycle
+    std::vector<std::vector<nonrdytype_e>> lastRdyStatus;
+
     const std::string _name;
 
   protected:
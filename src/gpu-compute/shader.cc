@@ -32,6 +32,7 @@
 #include "gpu-compute/shader.hh"
 
 #include <limits>
+#include <thread>
 
 #include "arch/amdgpu/common/gpu_translation_state.hh"
 #include "arch/amdgpu/common/tlb.hh"
@@ -54,11 +55,18 @@
 namespace gem5
 {
 
+namespace
+{
+
+// Set while a thread accesses a CU from the shader. It holds the queue of
+// the shader then, so the CU can report to the shader directly.
+thread_local bool inCuAccess = false;
+
+} // anonymous namespace
+
 Shader::Shader(const Params &p) : ClockedObject(p),
     _activeCus(0), _lastInactiveTick(0), cpuThread(nullptr),
     gpuTc(nullptr), cpuPointer(p.cpu_pointer),
-    tickEvent([this]{ execScheduledAdds(); }, "Shader scheduled adds event",
-          false, Event::CPU_Tick_Pri),
     timingSim(p.timing), hsail_mode(SIMT),
     impl_kern_launch_acq(p.impl_kern_launch_acq),
     impl_kern_end_rel(p.impl_kern_end_rel),
@@ -66,7 +74,7 @@ Shader::Shader(const Params &p) : ClockedObject(p),
     trace_vgpr_all(1), n_cu((p.CUs).size()), n_wf(p.n_wf),
     n_cu_per_sqc(p.cu_per_sqc),
     globalMemSize(p.globalmem),
-    nextSchedCu(0), sa_n(0), gpuCmdProc(*p.gpu_cmd_proc),
+    nextSchedCu(0), gpuCmdProc(*p.gpu_cmd_proc),
     _dispatcher(*p.dispatcher), systemHub(p.system_hub),
     max_valu_insts(p.max_valu_insts), total_valu_insts(0),
     stats(this, p.CUs[0]->wfSize())
@@ -153,6 +161,23 @@ Shader::init()
     assert(cpuPointer);
     gpuTc = cpuPointer->getContext(0);
     assert(gpuTc);
+
+    // The CUs may be spread over several event queues, and so threads.
+    // They report to the dispatcher and the command processor through
+    // the shader's queue, and the command processor fetches kernels and
+    // accesses memory through the first CU.
+    for (auto cu : cuList)
+        partitioned |= cu->eventQueue() != eventQueue();
+
+    if (partitioned) {
+        fatal_if(_dispatcher.eventQueue() != eventQueue() ||
+                 gpuCmdProc.eventQueue() != eventQueue(),
+                 "The dispatcher and command processor of %s must be on "
+                 "the event queue of the shader.", name());
+        fatal_if(cuList[0]->eventQueue() != eventQueue(),
+                 "The first CU of %s must be on the event queue of the "
+                 "shader.", name());
+    }
 }
 
 Shader::~Shader()
@@ -169,33 +194,6 @@ Shader::updateContext(int cid) {
     assert(gpuTc);
 }
 
-void
-Shader::execScheduledAdds()
-{
-    assert(!sa_when.empty());
-
-    // apply any scheduled adds
-    for (int i = 0; i < sa_n; ++i) {
-        if (sa_when[i] <= curTick()) {
-            *sa_val[i] += sa_x[i];
-            panic_if(*sa_val[i] < 0, "Negative counter value\n");
-            sa_val.erase(sa_val.begin() + i);
-            sa_x.erase(sa_x.begin() + i);
-            sa_when.erase(sa_when.begin() + i);
-            --sa_n;
-            --i;
-        }
-    }
-    if (!sa_when.empty()) {
-        Tick shader_wakeup = *std::max_element(sa_when.begin(),
-                 sa_when.end());
-        DPRINTF(GPUDisp, "Scheduling shader wakeup at %lu\n", shader_wakeup);
-        schedule(tickEvent, shader_wakeup);
-    } else {
-        DPRINTF(GPUDisp, "sa_when empty, shader going to sleep!\n");
-    }
-}
-
 /*
  * dispatcher/shader arranges invalidate requests to the CUs
  */
@@ -207,18 +205,22 @@ Shader::prepareInvalidate(HSAQueueEntry *task) {
     // invalidate has never started; it can only perform once at kernel launch
     assert(task->outstandingInvs() == -1);
     int kernId = task->dispatchId();
-    // counter value is 0 now, indicating the inv is about to start
-    _dispatcher.updateInvCounter(kernId, +1);
+    // counter value is 0 now, indicating the inv is about to start. Every
+    // cu adds one invalidate, and they are all counted up front since the
+    // cus on other event queues may be done before the last one starts.
+    for (int i_cu = 0; i_cu <= n_cu; ++i_cu)
+        _dispatcher.updateInvCounter(kernId, +1);
 
     // iterate all cus managed by the shader, to perform invalidate.
     for (int i_cu = 0; i_cu < n_cu; ++i_cu) {
+        ScopedCuAccess access(cuList[i_cu]);
+
         // create a request to hold INV info; the request's fields will
         // be updated in cu before use
         auto tcc_req = std::make_shared<Request>(0, 0, 0,
                                                  cuList[i_cu]->requestorId(),
                                                  0, -1);
 
-        _dispatcher.updateInvCounter(kernId, +1);
         // all necessary INV flags are all set now, call cu to execute
         cuList[i_cu]->doInvalidate(tcc_req, task->dispatchId());
 
@@ -248,10 +250,14 @@ Shader::prepareFlush(GPUDynInstPtr gpuDynInst){
     assert(_dispatcher.getOutstandingWbs(kernId) == 0);
 
     // the first cu, managed by the shader, performs flush operation,
-    // assuming that L2 cache is shared by all cus in the shader
-    int i_cu = 0;
+    // assuming that L2 cache is shared by all cus in the shader. The
+    // response goes to the wavefront, so the cus on other event queues
+    // do their own.
+    ComputeUnit *cu = partitioned ? gpuDynInst->computeUnit() : cuList[0];
     _dispatcher.updateWbCounter(kernId, +1);
-    cuList[i_cu]->doFlush(gpuDynInst);
+
+    ScopedCuAccess access(cu);
+    cu->doFlush(gpuDynInst);
 }
 
 bool
@@ -262,10 +268,16 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
     int curCu = nextSchedCu;
     int disp_count(0);
 
+    // The time of the shader, which the cus on other event queues may be
+    // ahead of or behind
+    Tick now = curTick();
+
     while (cuCount < n_cu) {
         //Every time we try a CU, update nextSchedCu
         nextSchedCu = (nextSchedCu + 1) % n_cu;
 
+        ScopedCuAccess access(cuList[curCu]);
+
         // dispatch workgroup iff the following two conditions are met:
         // (a) wg_rem is true - there are unassigned workgroups in the grid
         // (b) there are enough free slots in cu cuList[i] for this wg
@@ -280,9 +292,9 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
             DPRINTF(GPUWgLatency, "WG Begin cycle:%d wg:%d cu:%d\n",
                     curTick(), task->globalWgId(), curCu);
 
-            if (!cuList[curCu]->tickEvent.scheduled()) {
+            if (!cuList[curCu]->isActive()) {
                 if (!_activeCus)
-                    _lastInactiveTick = curTick();
+                    _lastInactiveTick = now;
                 _activeCus++;
             }
 
@@ -376,25 +388,6 @@ Shader::doFunctionalAccess(const RequestPtr &req, MemCmd cmd, void *data,
     }
 }
 
-void
-Shader::ScheduleAdd(int *val,Tick when,int x)
-{
-    sa_val.push_back(val);
-    when += curTick();
-    sa_when.push_back(when);
-    sa_x.push_back(x);
-    ++sa_n;
-    if (!tickEvent.scheduled() || (when < tickEvent.when())) {
-        DPRINTF(GPUDisp, "New scheduled add; scheduling shader wakeup at "
-                "%lu\n", when);
-        reschedule(tickEvent, when, true);
-    } else {
-        assert(tickEvent.scheduled());
-        DPRINTF(GPUDisp, "New scheduled add; wakeup already scheduled at "
-                "%lu\n", when);
-    }
-}
-
 void
 Shader::AccessMem(uint64_t address, void *ptr, uint32_t size, int cu_id,
                   MemCmd cmd, bool suppress_func_errors)
@@ -457,7 +450,10 @@ Shader::functionalTLBAccess(PacketPtr pkt, int cu_id, BaseMMU::Mode mode)
     // it's ok tp send all accesses through lane 0
     // since the lane # is not known here,
     // This isn't important since these are functional accesses.
-    cuList[cu_id]->tlbPort[0].sendFunctional(pkt);
+    {
+        ScopedCuAccess access(cuList[cu_id]);
+        cuList[cu_id]->tlbPort[0].sendFunctional(pkt);
+    }
 
     /* safe_cast the senderState */
     GpuTranslationState *sender_state =
@@ -473,6 +469,7 @@ Shader::functionalTLBAccess(PacketPtr pkt, int cu_id, BaseMMU::Mode mode)
 void
 Shader::sampleStore(const Tick accessTime)
 {
+    auto lock = statsLock();
     stats.storeLatencyDist.sample(accessTime);
     stats.allLatencyDist.sample(accessTime);
 }
@@ -483,6 +480,7 @@ Shader::sampleStore(const Tick accessTime)
 void
 Shader::sampleLoad(const Tick accessTime)
 {
+    auto lock = statsLock();
     stats.loadLatencyDist.sample(accessTime);
     stats.allLatencyDist.sample(accessTime);
 }
@@ -501,6 +499,7 @@ Shader::sampleInstRoundTrip(std::vector<Tick> roundTripTime)
     Tick t4 = roundTripTime[3];
     Tick t5 = roundTripTime[4];
 
+    auto lock = statsLock();
     stats.initToCoalesceLatency.sample(t2-t1);
     stats.rubyNetworkLatency.sample(t3-t2);
     stats.gmEnqueueLatency.sample(t4-t3);
@@ -510,7 +509,6 @@ Shader::sampleInstRoundTrip(std::vector<Tick> roundTripTime)
 void
 Shader::sampleLineRoundTrip(const std::map<Addr, std::vector<Tick>>& lineMap)
 {
-    stats.coalsrLineAddresses.sample(lineMap.size());
     std::vector<Tick> netTimes;
 
     // For each cache block address generated by a vmem inst, calculate
@@ -527,6 +525,9 @@ Shader::sampleLineRoundTrip(const std::map<Addr, std::vector<Tick>>& lineMap)
     // distrubtion is always measuring the slowest cache block.
     std::sort(netTimes.begin(), netTimes.end());
 
+    auto lock = statsLock();
+    stats.coalsrLineAddresses.sample(lineMap.size());
+
     // Sample the round trip time for each N cache blocks into the
     // Nth distribution.
     int idx = 0;
@@ -579,6 +580,73 @@ Shader::addDeferredDispatch(void *raw_pkt, uint32_t queue_id,
             std::make_tuple(raw_pkt, queue_id, host_pkt_addr));
 }
 
+Shader::ScopedReport::ScopedReport(ComputeUnit *_cu)
+    : cu(_cu), cuEventq(_cu->eventQueue()),
+      shaderEventq(_cu->shader->eventQueue()),
+      doMigrate(cuEventq != shaderEventq && !inCuAccess)
+{
+    if (!doMigrate)
+        return;
+
+    assert(curEventQueue() == cuEventq);
+    numCrossQueueAccesses.fetch_add(1, std::memory_order_relaxed);
+
+    cu->reportingThread = std::this_thread::get_id();
+    cuEventq->unlock();
+    shaderEventq->lock();
+    curEventQueue(shaderEventq);
+}
+
+Shader::ScopedReport::~ScopedReport()
+{
+    if (!doMigrate)
+        return;
+
+    shaderEventq->unlock();
+    cuEventq->lock();
+    curEventQueue(cuEventq);
+    cu->reportingThread = std::thread::id();
+}
+
+Shader::ScopedCuAccess::ScopedCuAccess(ComputeUnit *cu)
+    : cuEventq(cu->eventQueue()), shaderEventq(curEventQueue()),
+      doLock(cuEventq != shaderEventq), wasInCuAccess(inCuAccess)
+{
+    if (!doLock)
+        return;
+
+    assert(shaderEventq == cu->shader->eventQueue());
+    numCrossQueueAccesses.fetch_add(1, std::memory_order_relaxed);
+
+    cuEventq->lock();
+
+    // A CU which reports to the shader waits for the queue of the shader
+    // in the middle of one of its events. Let it finish the report, unless
+    // it is this thread which reports.
+    while (cu->reportingThread != std::thread::id() &&
+           cu->reportingThread != std::this_thread::get_id()) {
+        cuEventq->unlock();
+        {
+            EventQueue::ScopedRelease release(shaderEventq);
+            std::this_thread::yield();
+        }
+        cuEventq->lock();
+    }
+
+    curEventQueue(cuEventq);
+    inCuAccess = true;
+}
+
+Shader::ScopedCuAccess::~ScopedCuAccess()
+{
+    if (!doLock)
+        return;
+
+    inCuAccess = wasInCuAccess;
+    curEventQueue(shaderEventq);
+    cuEventq->unlock();
+}
+
 /**
  * Forward the VRAM requestor ID needed for device memory from CP.
  */
@@ -32,7 +32,9 @@
 #ifndef __SHADER_HH__
 #define __SHADER_HH__
 
+#include <atomic>
 #include <functional>
+#include <mutex>
 #include <string>
 
 #include "arch/gpu_isa.hh"
@@ -109,6 +111,19 @@ class Shader : public ClockedObject
     int num_outstanding_invl2s = 0;
     std::vector<std::tuple<void *, uint32_t, Addr>> deferred_dispatches;
 
+    // Set if some CUs run on other event queues than the shader
+    bool partitioned = false;
+
+    // Serializes the stats updates of CUs on different event queues
+    std::mutex statsMutex;
+
+    std::unique_lock<std::mutex>
+    statsLock()
+    {
+        return partitioned ? std::unique_lock<std::mutex>(statsMutex)
+                           : std::unique_lock<std::mutex>();
+    }
+
   public:
     typedef ShaderParams Params;
     enum hsail_mode_e {SIMT,VECTOR_SCALAR};
@@ -227,8 +242,6 @@ class Shader : public ClockedObject
 
     RequestorID vramRequestorId();
 
-    EventFunctionWrapper tickEvent;
-
     // is this simulation going to be timing mode in the memory?
     bool timingSim;
     hsail_mode_e hsail_mode;
@@ -254,16 +267,6 @@ class Shader : public ClockedObject
     // Tracks CU that rr dispatcher should attempt scheduling
     int nextSchedCu;
 
-    // Size of scheduled add queue
-    uint32_t sa_n;
-
-    // Pointer to value to be increments
-    std::vector<int*> sa_val;
-    // When to do the increment
-    std::vector<uint64_t> sa_when;
-    // Amount to increment by
-    std::vector<int32_t> sa_x;
-
     // List of Compute Units (CU's)
     std::vector<ComputeUnit*> cuList;
 
@@ -272,17 +275,13 @@ class Shader : public ClockedObject
     AMDGPUSystemHub *systemHub;
 
     int64_t max_valu_insts;
-    int64_t total_valu_insts;
+    // Counted by all the CUs, which may run on different threads
+    std::atomic<int64_t> total_valu_insts;
 
     Shader(const Params &p);
     ~Shader();
     virtual void init();
 
-    // Run shader scheduled adds
-    void execScheduledAdds();
-
-    // Schedule a 32-bit value to be incremented some time in the future
-    void ScheduleAdd(int *val, Tick when, int x);
     bool processTimingPacket(PacketPtr pkt);
 
     void AccessMem(uint64_t address, void *ptr, uint32_t size, int cu_id,
@@ -319,12 +318,14 @@ class Shader : public ClockedObject
     void
     incVectorInstSrcOperand(int num_operands)
     {
+        auto lock = statsLock();
         stats.vectorInstSrcOperand[num_operands]++;
     }
 
     void
     incVectorInstDstOperand(int num_operands)
     {
+        auto lock = statsLock();
         stats.vectorInstDstOperand[num_operands]++;
     }
 
@@ -342,6 +343,48 @@ class Shader : public ClockedObject
     void addDeferredDispatch(void *raw_pkt, uint32_t queue_id,
                              Addr host_pkt_addr);
 
+    /**
+     * Report to the shader from a CU. The CUs may run on other event
+     * queues than the shader, its dispatcher and its command processor,
+     * and have to use this for as long as they access those.
+     *
+     * This migrates to the event queue of the shader. The queue of the
+     * CU is released in the meantime, but the shader does not access the
+     * CU until the report ends, see ScopedCuAccess.
+     */
+    class ScopedReport
+    {
+      public:
+        ScopedReport(ComputeUnit *_cu);
+        ~ScopedReport();
+
+      private:
+        ComputeUnit *cu;
+        EventQueue *cuEventq;
+        EventQueue *shaderEventq;
+        bool doMigrate;
+    };
+
+    /**
+     * Access a CU from the shader. This locks the event queue of the CU
+     * and keeps that of the shader, so that the state of the shader stays
+     * the same while it runs on the CU. The two locks are always taken in
+     * this order, since a CU that reports to the shader releases its own
+     * queue first.
+     */
+    class ScopedCuAccess
+    {
+      public:
+        ScopedCuAccess(ComputeUnit *cu);
+        ~ScopedCuAccess();
+
+      private:
+        EventQueue *cuEventq;
+        EventQueue *shaderEventq;
+        bool doLock;
+        bool wasInCuAccess;
+    };
+
   protected:
     struct ShaderStats : public statistics::Group
     {
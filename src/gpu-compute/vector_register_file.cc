@@ -59,40 +59,53 @@ VectorRegisterFile::VectorRegisterFile(const VectorRegisterFileParams &p)
 bool
 VectorRegisterFile::operandsReady(Wavefront *w, GPUDynInstPtr ii) const
 {
-    bool src_ready = true, dst_ready=true;
-    for (const auto& srcVecOp : ii->srcVecRegOperands()) {
-        for (const auto& physIdx : srcVecOp.physIndices()) {
-            if (regBusy(physIdx) &&
-                    !computeUnit->rfc[simdId]->inRFC(physIdx)) {
-                DPRINTF(GPUVRF, "RAW stall: WV[%d]: %s: physReg[%d]\n",
-                        w->wfDynId, ii->disassemble(), physIdx);
-                w->stats.numTimesBlockedDueRAWDependencies++;
-                src_ready = false;
+    // Readiness depends on both the busy vector and the RFC contents
+    uint64_t epoch = scoreboardEpoch() +
+        computeUnit->rfc[simdId]->cacheEpoch();
+    auto &stall = ii->vrfStall;
+
+    if (stall.epoch != epoch) {
+        stall = {epoch, -1, -1};
+        for (const auto& srcVecOp : ii->srcVecRegOperands()) {
+            for (const auto& physIdx : srcVecOp.physIndices()) {
+                if (regBusy(physIdx) &&
+                        !computeUnit->rfc[simdId]->inRFC(physIdx)) {
+                    stall.rawReg = physIdx;
+                    break;
+                }
+            }
+            if (stall.rawReg >= 0) {
                 break;
             }
         }
-        if (!src_ready) {
-            break;
-        }
-    }
 
-    for (const auto& dstVecOp : ii->dstVecRegOperands()) {
-        for (const auto& physIdx : dstVecOp.physIndices()) {
-            if (regBusy(physIdx) &&
-                    !computeUnit->rfc[simdId]->inRFC(physIdx)) {
-                DPRINTF(GPUVRF, "WAX stall: WV[%d]: %s: physReg[%d]\n",
-                        w->wfDynId, ii->disassemble(), physIdx);
-                w->stats.numTimesBlockedDueWAXDependencies++;
-                dst_ready = false;
+        for (const auto& dstVecOp : ii->dstVecRegOperands()) {
+            for (const auto& physIdx : dstVecOp.physIndices()) {
+                if (regBusy(physIdx) &&
+                        !computeUnit->rfc[simdId]->inRFC(physIdx)) {
+                    stall.waxReg = physIdx;
+                    break;
+                }
+            }
+            if (stall.waxReg >= 0) {
                 break;
             }
         }
-        if (!dst_ready) {
-            break;
-        }
     }
 
-    return src_ready && dst_ready;
+    if (stall.rawReg >= 0) {
+        DPRINTF(GPUVRF, "RAW stall: WV[%d]: %s: physReg[%d]\n",
+                w->wfDynId, ii->disassemble(), stall.rawReg);
+        w->stats.numTimesBlockedDueRAWDependencies++;
+    }
+
+    if (stall.waxReg >= 0) {
+        DPRINTF(GPUVRF, "WAX stall: WV[%d]: %s: physReg[%d]\n",
+                w->wfDynId, ii->disassemble(), stall.waxReg);
+        w->stats.numTimesBlockedDueWAXDependencies++;
+    }
+
+    return stall.rawReg < 0 && stall.waxReg < 0;
 }
 
 void
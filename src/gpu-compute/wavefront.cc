@@ -54,6 +54,7 @@ Wavefront::Wavefront(const Params &p)
     sleepCnt(0), barId(WFBarrier::InvalidID), stats(this)
 {
     lastTrace = 0;
+    fastForward = false;
     execUnitId = -1;
     status = S_STOPPED;
     reservedVectorRegs = 0;
@@ -97,6 +97,9 @@ class Wavefront : public SimObject
     // HW slot id where the WF is mapped to inside a SIMD unit
     const int wfSlotId;
     int kernId;
+    // whether the kernel of the WF is fast-forwarded, in which case it
+    // fetches and accesses memory functionally
+    bool fastForward;
     // SIMD unit where the WV has been scheduled
     const int simdId;
     // id of the execution unit (or pipeline) where the oldest instruction
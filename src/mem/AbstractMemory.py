@@ -77,6 +77,14 @@ class AbstractMemory(ClockedObject):
 
     writeable = Param.Bool(True, "Allow writes to this memory")
 
+    # On hosts with several NUMA nodes, the backing store is best placed
+    # on the node of the host CPUs running the event queue that simulates
+    # this memory (see Root.sim_thread_affinity). By default the kernel
+    # places each page on the node that touches it first.
+    host_numa_node = Param.Int(
+        -1, "Host NUMA node to bind the backing store to (-1: any)"
+    )
+
     collect_stats = Param.Bool(
         True,
         "Collect statistics per requestor for "
@@ -70,6 +70,13 @@ class DRAMInterface(MemInterface):
     # performance being lower when enabled
     enable_dram_powerdown = Param.Bool(False, "Enable powerdown states")
 
+    # Enable the powerdown states only while all the threads of the system
+    # are idle, which lets idle ranks sit in self-refresh without an event
+    # per refresh, while keeping the performance of the active periods
+    powerdown_when_idle = Param.Bool(
+        False, "Enable powerdown states while the system is idle"
+    )
+
     # For power modelling we need to know if the DRAM has a DLL or not
     dll = Param.Bool(True, "DRAM has DLL or not")
 
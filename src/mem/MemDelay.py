@@ -67,3 +67,18 @@ class SimpleMemDelay(MemDelay):
 
     write_req = Param.Latency("0t", "Write request delay")
     write_resp = Param.Latency("0t", "Write response delay")
+
+
+# A CXL link, which put in front of a memory controller models a CXL
+# memory expander.
+class CXLLink(MemDelay):
+    type = "CXLLink"
+    cxx_header = "mem/mem_delay.hh"
+    cxx_class = "gem5::CXLLink"
+
+    latency = Param.Latency("35ns", "Latency of each direction of the link")
+    bandwidth = Param.MemoryBandwidth(
+        "32GiB/s", "Bandwidth of each direction of the link"
+    )
+    flit_size = Param.Unsigned(68, "Size of a flit in bytes")
+    flit_payload = Param.Unsigned(64, "Data carried by a flit in bytes")
@@ -0,0 +1,82 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.SimpleMemory import *
+from m5.params import *
+
+
+class RowBufferMemory(SimpleMemory):
+    type = "RowBufferMemory"
+    cxx_header = "mem/row_buffer_mem.hh"
+    cxx_class = "gem5::memory::RowBufferMemory"
+
+    # The latency inherited from the simple memory is the latency of a
+    # row hit, the parameters below are added on top of it depending
+    # on the state of the bank. The defaults correspond to a single
+    # rank of DDR4-2400 with 8 x8 devices.
+    banks = Param.Unsigned(16, "Number of banks per channel")
+    row_buffer_size = Param.MemorySize("8KiB", "Row buffer size per bank")
+    row_activate_latency = Param.Latency(
+        "14.16ns", "Latency to open a row in a precharged bank"
+    )
+    row_precharge_latency = Param.Latency(
+        "14.16ns", "Latency to close the open row of a bank"
+    )
+
+    @classmethod
+    def from_dram(cls, dram, static_latency="20ns", **kwargs):
+        """Create a row buffer memory with the timing derived from a
+        DRAM interface. The static latency accounts for the frontend and
+        backend pipeline of the DRAM controller. Any additional keyword
+        arguments are passed on to the memory.
+        """
+
+        def seconds(latency):
+            return Latency(latency).value
+
+        burst_bytes = (
+            dram.devices_per_rank.value
+            * dram.device_bus_width.value
+            * dram.burst_length.value
+            // 8
+        )
+        hit_latency = (
+            seconds(static_latency) + seconds(dram.tCL) + seconds(dram.tBURST)
+        )
+
+        params = {
+            "latency": f"{hit_latency * 1e9:.3f}ns",
+            "latency_var": "0ns",
+            "bandwidth": f"{burst_bytes / seconds(dram.tBURST):.0f}B/s",
+            "banks": dram.banks_per_rank.value * dram.ranks_per_channel.value,
+            "row_buffer_size": dram.devices_per_rank.value
+            * dram.device_rowbuffer_size.value,
+            "row_activate_latency": f"{seconds(dram.tRCD) * 1e9:.3f}ns",
+            "row_precharge_latency": f"{seconds(dram.tRP) * 1e9:.3f}ns",
+            "range": dram.range,
+        }
+        params.update(kwargs)
+        return cls(**params)
@@ -24,6 +24,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.params import *
+from m5.proxy import *
 from m5.SimObject import SimObject
 
 
@@ -39,8 +40,12 @@ class ThreadBridge(SimObject):
     the issue. The receiver side is expected to use the same EventQueue that
     the ThreadBridge is using.
 
-    Given that this is only used for simulation speed accelerating, only the
-    atomic and functional access are supported.
+    Timing accesses cross the bridge after a fixed delay. Requests are
+    delivered on the event queue of the bridge, and responses on the event
+    queue given by in_eventq_index, which must be the one of the requestor
+    side. When the two queues differ, the delay is the lookahead between
+    them and must not be less than sim_quantum or sim_lookahead. The bridge
+    buffers any number of packets and never refuses an access.
 
     Example:
 
@@ -58,3 +63,8 @@ class ThreadBridge(SimObject):
 
     in_port = ResponsePort("Incoming port")
     out_port = RequestPort("Outgoing port")
+
+    in_eventq_index = Param.UInt32(
+        Parent.eventq_index, "Event queue of the requestor side"
+    )
+    delay = Param.Latency("0ns", "Latency of timing accesses")
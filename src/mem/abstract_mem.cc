@@ -62,9 +62,10 @@ AbstractMemory::AbstractMemory(const Params &p) :
              (MemBackdoor::Flags)(p.writeable ?
                  MemBackdoor::Readable | MemBackdoor::Writeable :
                  MemBackdoor::Readable)),
+    deltaImage(nullptr),
     confTableReported(p.conf_table_reported), inAddrMap(p.in_addr_map),
     kvmMap(p.kvm_map), writeable(p.writeable), collectStats(p.collect_stats),
-    _system(NULL), stats(*this)
+    hostNumaNode(p.host_numa_node), _system(NULL), stats(*this)
 {
     panic_if(!range.valid() || !range.size(),
              "Memory range %s must be valid with non-zero size.",
@@ -394,6 +395,8 @@ AbstractMemory::access(PacketPtr pkt)
     assert(pkt->getAddrRange().isSubset(range));
 
     uint8_t *host_addr = toHostAddr(pkt->getAddr());
+    if (deltaImage)
+        deltaImage->fetch(host_addr, pkt->getSize());
 
     if (pkt->cmd == MemCmd::SwapReq) {
         if (pkt->isAtomicOp()) {
@@ -464,7 +467,7 @@ AbstractMemory::access(PacketPtr pkt)
         // no need to do anything
     } else if (pkt->isWrite()) {
         if (writeOK(pkt)) {
-            if (pmemAddr) {
+            if (pmemAddr && !pkt->dataInMemory()) {
                 pkt->writeData(host_addr);
                 DPRINTF(MemoryAccess, "%s write due to %s\n",
                         __func__, pkt->print());
@@ -491,6 +494,8 @@ AbstractMemory::functionalAccess(PacketPtr pkt)
     assert(pkt->getAddrRange().isSubset(range));
 
     uint8_t *host_addr = toHostAddr(pkt->getAddr());
+    if (deltaImage)
+        deltaImage->fetch(host_addr, pkt->getSize());
 
     if (pkt->isRead()) {
         if (pmemAddr) {
@@ -47,6 +47,7 @@
 #define __MEM_ABSTRACT_MEMORY_HH__
 
 #include "mem/backdoor.hh"
+#include "mem/delta_image.hh"
 #include "mem/port.hh"
 #include "params/AbstractMemory.hh"
 #include "sim/clocked_object.hh"
@@ -120,6 +121,9 @@ class AbstractMemory : public ClockedObject
     // Backdoor to access this memory.
     MemBackdoor backdoor;
 
+    // Pages of the backing store restored on demand, if any
+    DeltaImage *deltaImage;
+
     // Enable specific memories to be reported to the configuration table
     const bool confTableReported;
 
@@ -135,6 +139,9 @@ class AbstractMemory : public ClockedObject
     // Should collect traffic statistics
     const bool collectStats;
 
+    // Host NUMA node to place the backing store on, -1 for any
+    const int hostNumaNode;
+
     std::list<LockedAddr> lockedAddrList;
 
     // helper function for checkLockedAddrs(): we really want to
@@ -244,11 +251,24 @@ class AbstractMemory : public ClockedObject
      */
     void setBackingStore(uint8_t* pmem_addr);
 
+    /**
+     * Set the pages of the backing store that are restored from a
+     * checkpoint when they are first accessed.
+     *
+     * @param image Pages that are not read yet
+     */
+    void setDeltaImage(DeltaImage *image) { deltaImage = image; }
+
     void
     getBackdoor(MemBackdoorPtr &bd_ptr)
     {
-        if (lockedAddrList.empty() && backdoor.ptr())
+        if (lockedAddrList.empty() && backdoor.ptr()) {
+            // whoever uses the back door bypasses the check for
+            // pending pages
+            if (deltaImage)
+                deltaImage->fetchAll();
             bd_ptr = &backdoor;
+        }
     }
 
     /**
@@ -341,6 +361,14 @@ class AbstractMemory : public ClockedObject
      */
     bool isKvmMap() const { return kvmMap; }
 
+    /**
+     * The host NUMA node the backing store of this memory should be
+     * allocated on.
+     *
+     * @return the host NUMA node, or -1 if the host kernel decides
+     */
+    int getHostNumaNode() const { return hostNumaNode; }
+
     /**
      * Perform an untimed memory access and update all the state
      * (e.g. locked addresses) and statistics accordingly. The packet
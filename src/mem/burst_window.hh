@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * BurstWindowCounts declaration
+ */
+
+#ifndef __MEM_BURST_WINDOW_HH__
+#define __MEM_BURST_WINDOW_HH__
+
+#include <cassert>
+#include <deque>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * Holds the number of commands issued in each burst window of a memory
+ * controller, the windows being identified by their aligned start Tick.
+ * The counts are kept for consecutive windows, starting at the oldest one
+ * still tracked, so that looking up, adding and pruning a window only
+ * takes an index computation instead of hashing every command.
+ */
+class BurstWindowCounts
+{
+  private:
+    /** Length of a burst window, in ticks. */
+    const Tick window;
+
+    /** Start of the window counted at the front of counts. */
+    Tick base = 0;
+
+    /** Number of commands in each window, starting at base. */
+    std::deque<unsigned> counts;
+
+  public:
+    BurstWindowCounts(Tick command_window) : window(command_window) {}
+
+    /**
+     * Get the number of commands in a burst window.
+     *
+     * @param burst_tick Start of the window
+     * @return Number of commands issued in the window
+     */
+    unsigned
+    count(Tick burst_tick) const
+    {
+        assert(burst_tick % window == 0);
+        if (counts.empty() || burst_tick < base)
+            return 0;
+        Tick idx = (burst_tick - base) / window;
+        return idx < counts.size() ? counts[idx] : 0;
+    }
+
+    /**
+     * Add a command to a burst window.
+     *
+     * @param burst_tick Start of the window
+     */
+    void
+    insert(Tick burst_tick)
+    {
+        assert(burst_tick % window == 0);
+        if (counts.empty()) {
+            base = burst_tick;
+        } else {
+            for (; burst_tick < base; base -= window)
+                counts.push_front(0);
+        }
+        Tick idx = (burst_tick - base) / window;
+        if (idx >= counts.size())
+            counts.resize(idx + 1, 0);
+        counts[idx]++;
+    }
+
+    /**
+     * Forget the windows that start before a given Tick.
+     *
+     * @param tick Oldest Tick a window still tracked may start at
+     */
+    void
+    prune(Tick tick)
+    {
+        while (!counts.empty() && base < tick) {
+            counts.pop_front();
+            base += window;
+        }
+    }
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_BURST_WINDOW_HH__
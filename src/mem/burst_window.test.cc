@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <unordered_set>
+
+#include "mem/burst_window.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+TEST(BurstWindowCountsTest, CountInsert)
+{
+    BurstWindowCounts counts(10);
+    EXPECT_EQ(counts.count(100), 0u);
+
+    counts.insert(100);
+    counts.insert(100);
+    counts.insert(130);
+    EXPECT_EQ(counts.count(100), 2u);
+    EXPECT_EQ(counts.count(110), 0u);
+    EXPECT_EQ(counts.count(130), 1u);
+    EXPECT_EQ(counts.count(140), 0u);
+
+    // Windows older than the first one can still be added
+    counts.insert(70);
+    EXPECT_EQ(counts.count(70), 1u);
+    EXPECT_EQ(counts.count(100), 2u);
+}
+
+TEST(BurstWindowCountsTest, Prune)
+{
+    BurstWindowCounts counts(10);
+    counts.insert(100);
+    counts.insert(110);
+    counts.insert(120);
+
+    counts.prune(115);
+    EXPECT_EQ(counts.count(100), 0u);
+    EXPECT_EQ(counts.count(110), 0u);
+    EXPECT_EQ(counts.count(120), 1u);
+
+    counts.prune(1000);
+    EXPECT_EQ(counts.count(120), 0u);
+    counts.insert(2000);
+    EXPECT_EQ(counts.count(2000), 1u);
+}
+
+/** Check against the multiset the counts replace */
+TEST(BurstWindowCountsTest, MatchesMultiset)
+{
+    constexpr Tick window = 5;
+    BurstWindowCounts counts(window);
+    std::unordered_multiset<Tick> ref;
+
+    std::mt19937 rng(1);
+    Tick now = 1000;
+    for (int i = 0; i < 100000; i++) {
+        now += rng() % 7;
+        Tick tick = (now + rng() % 200 - 60) / window * window;
+        switch (rng() % 3) {
+          case 0:
+            counts.insert(tick);
+            ref.insert(tick);
+            break;
+          case 1:
+            ASSERT_EQ(counts.count(tick), ref.count(tick));
+            break;
+          default:
+            Tick oldest = now - now % window;
+            counts.prune(oldest);
+            for (auto it = ref.begin(); it != ref.end(); ) {
+                if (*it < oldest)
+                    it = ref.erase(it);
+                else
+                    ++it;
+            }
+        }
+    }
+}
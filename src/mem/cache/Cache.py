@@ -169,6 +169,13 @@ class BaseCache(ClockedObject):
     # data cache.
     write_allocator = Param.WriteAllocator(NULL, "Write allocator")
 
+    # A tag-only cache models the timing and the state of its blocks but
+    # doesn't store their data, which is read from and written to the
+    # memory of the system when the cache services requests. All the
+    # caches of the system have to be tag only, and the memories must
+    # store their data (not be null).
+    tag_only = Param.Bool(False, "Only model the tags, keep no data")
+
 
 class Cache(BaseCache):
     type = "Cache"
@@ -45,6 +45,9 @@
 
 #include "mem/cache/base.hh"
 
+#include <array>
+#include <unordered_map>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "debug/Cache.hh"
@@ -67,6 +70,14 @@
 namespace gem5
 {
 
+namespace
+{
+
+/** The number of tag-only caches and caches holding data per system. */
+std::unordered_map<const System *, std::array<int, 2>> cacheKinds;
+
+} // anonymous namespace
+
 BaseCache::CacheResponsePort::CacheResponsePort(const std::string &_name,
                                           BaseCache& _cache,
                                           const std::string &_label)
@@ -91,6 +102,7 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
       prefetcher(p.prefetcher),
       writeAllocator(p.write_allocator),
       writebackClean(p.writeback_clean),
+      tagOnly(p.tag_only),
       tempBlockWriteback(nullptr),
       writebackTempBlockAtomicEvent([this]{ writebackTempBlockAtomic(); },
                                     name(), false,
@@ -128,6 +140,15 @@ BaseCache::BaseCache(const BaseCacheParams &p, unsigned blk_size)
     tempBlock = new TempCacheBlk(blkSize,
         genTagExtractor(tags->params().indexing_policy));
 
+    fatal_if(tagOnly != tags->params().tag_only,
+             "%s: the tags and the cache disagree on tag_only.", name());
+    fatal_if(tagOnly && compressor,
+             "%s: tag-only caches can't compress their data.", name());
+    if (tagOnly) {
+        tagOnlyReq = std::make_shared<Request>(
+            0, blkSize, 0, Request::funcRequestorId);
+    }
+
     tags->tagsInit();
     if (prefetcher)
         prefetcher->setParentInfo(system, getProbeManager(), getBlockSize());
@@ -200,6 +221,37 @@ BaseCache::init()
         fatal("Cache ports on %s are not connected\n", name());
     cpuSidePort.sendRangeChange();
     forwardSnoops = cpuSidePort.isSnooping();
+
+    // The data of a tag-only cache is only up to date in memory, so a
+    // cache holding data would see stale data in it, and would give its
+    // own dirty data to caches which ignore it.
+    auto &kinds = cacheKinds[system];
+    kinds[tagOnly]++;
+    fatal_if(kinds[false] && kinds[true], "%s: tag-only caches and caches "
+             "holding data can't be mixed in a system.", name());
+}
+
+void
+BaseCache::loadTagOnlyData(CacheBlk *blk)
+{
+    assert(tagOnly);
+    Addr addr = regenerateBlkAddr(blk);
+    fatal_if(!system->isMemAddr(addr), "%s: tag-only caches can only cache "
+             "memory, %#x isn't.", name(), addr);
+    tagOnlyReq->setPaddr(addr);
+    Packet pkt(tagOnlyReq, MemCmd::ReadReq);
+    pkt.dataStatic(blk->data);
+    system->getPhysMem().functionalAccess(&pkt);
+}
+
+void
+BaseCache::storeTagOnlyData(CacheBlk *blk)
+{
+    assert(tagOnly);
+    tagOnlyReq->setPaddr(regenerateBlkAddr(blk));
+    Packet pkt(tagOnlyReq, MemCmd::WriteReq);
+    pkt.dataStatic(blk->data);
+    system->getPhysMem().functionalAccess(&pkt);
 }
 
 Port &
@@ -452,7 +504,9 @@ BaseCache::recvTimingReq(PacketPtr pkt)
     if (satisfied) {
         // notify before anything else as later handleTimingReqHit might turn
         // the packet in a response
-        ppHit->notify(CacheAccessProbeArg(pkt,accessor));
+        ppHit->notifyWith([&]() {
+            return CacheAccessProbeArg(pkt, accessor);
+        });
 
         if (prefetcher && blk && blk->wasPrefetched()) {
             DPRINTF(Cache, "Hit on prefetch for addr %#x (%s)\n",
@@ -464,7 +518,9 @@ BaseCache::recvTimingReq(PacketPtr pkt)
     } else {
         handleTimingReqMiss(pkt, blk, forward_time, request_time);
 
-        ppMiss->notify(CacheAccessProbeArg(pkt,accessor));
+        ppMiss->notifyWith([&]() {
+            return CacheAccessProbeArg(pkt, accessor);
+        });
     }
 
     if (prefetcher) {
@@ -561,7 +617,9 @@ BaseCache::recvTimingResp(PacketPtr pkt)
             writeAllocator->allocate() : mshr->allocOnFill();
         blk = handleFill(pkt, blk, writebacks, allocate);
         assert(blk != nullptr);
-        ppFill->notify(CacheAccessProbeArg(pkt, accessor));
+        ppFill->notifyWith([&]() {
+            return CacheAccessProbeArg(pkt, accessor);
+        });
     }
 
     // Don't want to promote the Locked RMW Read until
@@ -723,6 +781,13 @@ BaseCache::functionalAccess(PacketPtr pkt, bool from_cpu_side)
     CacheBlk *blk = tags->findBlock({pkt->getAddr(), is_secure});
     MSHR *mshr = mshrQueue.findMatch(blk_addr, is_secure);
 
+    if (tagOnly) {
+        // The memory has the only copy of the data.
+        if (from_cpu_side)
+            memSidePort.sendFunctional(pkt);
+        return;
+    }
+
     pkt->pushLabel(name());
 
     CacheBlkPrintWrapper cbpw(blk);
@@ -1111,6 +1176,9 @@ BaseCache::satisfyRequest(PacketPtr pkt, CacheBlk *blk, bool, bool)
     // assert(!pkt->needsWritable() || blk->isSet(CacheBlk::WritableBit));
     assert(pkt->getOffset(blkSize) + pkt->getSize() <= blkSize);
 
+    if (tagOnly)
+        loadTagOnlyData(blk);
+
     // Check RMW operations first since both isRead() and
     // isWrite() will be true for them
     if (pkt->cmd == MemCmd::SwapReq) {
@@ -1190,6 +1258,9 @@ BaseCache::satisfyRequest(PacketPtr pkt, CacheBlk *blk, bool, bool)
         DPRINTF(CacheVerbose, "%s for %s (invalidation)\n", __func__,
                 pkt->print());
     }
+
+    if (tagOnly && pkt->isWrite())
+        storeTagOnlyData(blk);
 }
 
 /////////////////////////////////////////////////////
@@ -1744,6 +1815,11 @@ BaseCache::writebackBlk(CacheBlk *blk)
     // make sure the block is not marked dirty
     blk->clearCoherenceBits(CacheBlk::DirtyBit);
 
+    if (tagOnly) {
+        loadTagOnlyData(blk);
+        pkt->setDataInMemory();
+    }
+
     pkt->allocate();
     pkt->setDataFromBlock(blk->data, blkSize);
 
@@ -1789,6 +1865,11 @@ BaseCache::writecleanBlk(CacheBlk *blk, Request::Flags dest, PacketId id)
     // make sure the block is not marked dirty
     blk->clearCoherenceBits(CacheBlk::DirtyBit);
 
+    if (tagOnly) {
+        loadTagOnlyData(blk);
+        pkt->setDataInMemory();
+    }
+
     pkt->allocate();
     pkt->setDataFromBlock(blk->data, blkSize);
 
@@ -2598,6 +2679,27 @@ BaseCache::CpuSidePort::recvAtomic(PacketPtr pkt)
     }
 }
 
+Tick
+BaseCache::CpuSidePort::recvAtomicBackdoor(PacketPtr pkt,
+                                           MemBackdoorPtr &backdoor)
+{
+    // The cache holds no data in cache bypass mode, so the memory
+    // below can be accessed directly
+    if (cache.system->bypassCaches()) {
+        return cache.memSidePort.sendAtomicBackdoor(pkt, backdoor);
+    } else {
+        return cache.recvAtomic(pkt);
+    }
+}
+
+void
+BaseCache::CpuSidePort::recvMemBackdoorReq(const MemBackdoorReq &req,
+                                           MemBackdoorPtr &backdoor)
+{
+    if (cache.system->bypassCaches())
+        cache.memSidePort.sendMemBackdoorReq(req, backdoor);
+}
+
 void
 BaseCache::CpuSidePort::recvFunctional(PacketPtr pkt)
 {
@@ -303,6 +303,12 @@ class BaseCache : public ClockedObject
 
         virtual Tick recvAtomic(PacketPtr pkt) override;
 
+        virtual Tick recvAtomicBackdoor(PacketPtr pkt,
+                                        MemBackdoorPtr &backdoor) override;
+
+        virtual void recvMemBackdoorReq(const MemBackdoorReq &req,
+                                        MemBackdoorPtr &backdoor) override;
+
         virtual void recvFunctional(PacketPtr pkt) override;
 
         virtual AddrRangeList getAddrRanges() const override;
@@ -680,6 +686,25 @@ class BaseCache : public ClockedObject
      */
     const bool writebackClean;
 
+    /**
+     * Whether this cache only models its tags. The blocks share a single
+     * data block, which is loaded from the memory of the system before
+     * the cache uses the data of a block, and stored back after a write.
+     */
+    const bool tagOnly;
+
+    /** Request used to access the memory of the system when tag only. */
+    RequestPtr tagOnlyReq;
+
+    /**
+     * Load the data of a block from the memory of the system into the
+     * shared data block of a tag-only cache.
+     */
+    void loadTagOnlyData(CacheBlk *blk);
+
+    /** Store the shared data block of a tag-only cache to memory. */
+    void storeTagOnlyData(CacheBlk *blk);
+
     /**
      * Writebacks from the tempBlock, resulting on the response path
      * in atomic mode, must happen after the call to recvAtomic has
@@ -1224,6 +1224,9 @@ Cache::handleSnoop(PacketPtr pkt, CacheBlk *blk, bool is_timing,
                  "%s is passing a Modified line through %s, "
                  "but keeping the block", name(), pkt->print());
 
+        if (tagOnly)
+            loadTagOnlyData(blk);
+
         if (is_timing) {
             doTimingSupplyResponse(pkt, blk->data, is_deferred, pending_inval);
         } else {
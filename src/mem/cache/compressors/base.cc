@@ -36,6 +36,7 @@
 #include <climits>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <string>
 
 #include "base/logging.hh"
@@ -88,7 +89,8 @@ Base::Base(const Params &p)
     compExtraLatency(p.comp_extra_latency),
     decompChunksPerCycle(p.decomp_chunks_per_cycle),
     decompExtraLatency(p.decomp_extra_latency),
-    cache(nullptr), stats(*this)
+    cache(nullptr), chunkBuffer((CHAR_BIT * blkSize) / chunkSizeBits),
+    stats(*this)
 {
     fatal_if(64 % chunkSizeBits,
         "64 must be a multiple of the chunk granularity.");
@@ -110,23 +112,26 @@ Base::setCache(BaseCache *_cache)
     cache = _cache;
 }
 
-std::vector<Base::Chunk>
+const std::vector<Base::Chunk>&
 Base::toChunks(const uint64_t* data) const
 {
     // Number of chunks in a 64-bit value
     const unsigned num_chunks_per_64 =
         (sizeof(uint64_t) * CHAR_BIT) / chunkSizeBits;
 
-    // Turn a 64-bit array into a chunkSizeBits-array
-    std::vector<Chunk> chunks((blkSize * CHAR_BIT) / chunkSizeBits, 0);
-    for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+    // Turn a 64-bit array into a chunkSizeBits-array. This is done for
+    // every line compressed, so the same buffer is used for all of them
+    if (num_chunks_per_64 == 1) {
+        std::memcpy(chunkBuffer.data(), data, blkSize);
+        return chunkBuffer;
+    }
+    for (std::size_t i = 0; i < chunkBuffer.size(); i++) {
         const unsigned start = i % num_chunks_per_64;
-        chunks[i] = bits(data[index_64],
+        chunkBuffer[i] = bits(data[i / num_chunks_per_64],
             (start + 1) * chunkSizeBits - 1, start * chunkSizeBits);
     }
 
-    return chunks;
+    return chunkBuffer;
 }
 
 void
@@ -138,8 +143,8 @@ Base::fromChunks(const std::vector<Chunk>& chunks, uint64_t* data) const
 
     // Turn a chunkSizeBits-array into a 64-bit array
     std::memset(data, 0, blkSize);
-    for (int i = 0; i < chunks.size(); i++) {
-        const int index_64 = std::floor(i / (double)num_chunks_per_64);
+    for (std::size_t i = 0; i < chunks.size(); i++) {
+        const std::size_t index_64 = i / num_chunks_per_64;
         const unsigned start = i % num_chunks_per_64;
         replaceBits(data[index_64], (start + 1) * chunkSizeBits - 1,
             start * chunkSizeBits, chunks[i]);
@@ -128,6 +128,9 @@ class Base : public SimObject
     /** Pointer to the parent cache. */
     BaseCache* cache;
 
+    /** The chunks of the last line split by toChunks(). */
+    mutable std::vector<Chunk> chunkBuffer;
+
     struct BaseStats : public statistics::Group
     {
         const Base& compressor;
@@ -160,9 +163,10 @@ class Base : public SimObject
      * parsed by the compressor.
      *
      * @param data The raw pointer to the data being compressed.
-     * @return The raw data divided into a vector of sequential chunks.
+     * @return The raw data divided into a vector of sequential chunks. The
+     *         vector is reused by the next call.
      */
-    std::vector<Chunk> toChunks(const uint64_t* data) const;
+    const std::vector<Chunk>& toChunks(const uint64_t* data) const;
 
     /**
      * This function re-joins the chunks to recreate the original data.
@@ -177,7 +177,7 @@ void
 FrequentValues::sampleValues(const std::vector<uint64_t> &data,
     bool is_invalidation)
 {
-    const std::vector<Chunk> chunks = toChunks(data.data());
+    const std::vector<Chunk>& chunks = toChunks(data.data());
     for (const Chunk& chunk : chunks) {
         VFTEntry* entry = VFT.findEntry(chunk);
         bool saturated = false;
@@ -97,6 +97,78 @@ Queued::DeferredPacket::finish(const Fault &fault,
     owner->translationComplete(this, failed, *cache);
 }
 
+Queued::DeferredQueue::iterator
+Queued::DeferredQueue::insert(const DeferredPacket &dpp)
+{
+    const uint64_t seq = nextSeq++;
+    iterator it = entries.emplace_hint(entries.end(),
+        Key(dpp.priority, seq), dpp);
+    it->second.seq = seq;
+    index.emplace(dpp.pfInfo.getAddr(), it);
+    return it;
+}
+
+std::unordered_multimap<Addr, Queued::DeferredQueue::iterator>::iterator
+Queued::DeferredQueue::indexOf(iterator it)
+{
+    auto range = index.equal_range(it->second.pfInfo.getAddr());
+    for (auto idx = range.first; idx != range.second; ++idx) {
+        if (idx->second == it) {
+            return idx;
+        }
+    }
+    panic("Prefetch queue entry is missing from the queue index.");
+}
+
+Queued::DeferredQueue::iterator
+Queued::DeferredQueue::erase(iterator it)
+{
+    index.erase(indexOf(it));
+    return entries.erase(it);
+}
+
+Queued::DeferredQueue::iterator
+Queued::DeferredQueue::find(const PrefetchInfo &pfi)
+{
+    auto range = index.equal_range(pfi.getAddr());
+    for (auto idx = range.first; idx != range.second; ++idx) {
+        if (idx->second->second.pfInfo.sameAddr(pfi)) {
+            return idx->second;
+        }
+    }
+    return entries.end();
+}
+
+Queued::DeferredQueue::iterator
+Queued::DeferredQueue::find(const DeferredPacket *dp)
+{
+    return entries.find(Key(dp->priority, dp->seq));
+}
+
+void
+Queued::DeferredQueue::setPriority(iterator &it, int32_t priority)
+{
+    auto idx = indexOf(it);
+
+    // Extracting the node keeps the packet in place, so any translation
+    // in flight still refers to it
+    auto node = entries.extract(it);
+    const uint64_t seq = nextSeq++;
+    node.key() = Key(priority, seq);
+    node.mapped().priority = priority;
+    node.mapped().seq = seq;
+    it = entries.insert(std::move(node)).position;
+    idx->second = it;
+}
+
+Queued::DeferredQueue::iterator
+Queued::DeferredQueue::victim()
+{
+    assert(!entries.empty());
+    const int32_t lowest = std::prev(entries.end())->first.first;
+    return entries.lower_bound(Key(lowest, 0));
+}
+
 Queued::Queued(const QueuedPrefetcherParams &p)
     : Base(p), queueSize(p.queue_size),
       missingTranslationQueueSize(
@@ -111,13 +183,13 @@ Queued::Queued(const QueuedPrefetcherParams &p)
 Queued::~Queued()
 {
     // Delete the queued prefetch packets
-    for (DeferredPacket &p : pfq) {
-        delete p.pkt;
+    for (auto &entry : pfq) {
+        delete entry.second.pkt;
     }
 }
 
 void
-Queued::printQueue(const std::list<DeferredPacket> &queue) const
+Queued::printQueue(const DeferredQueue &queue) const
 {
     int pos = 0;
     std::string queue_name = "";
@@ -128,13 +200,14 @@ Queued::printQueue(const std::list<DeferredPacket> &queue) const
         queue_name = "PFTransQ";
     }
 
-    for (const_iterator it = queue.cbegin(); it != queue.cend();
+    for (const_iterator it = queue.begin(); it != queue.end();
                                                             it++, pos++) {
-        Addr vaddr = it->pfInfo.getAddr();
+        const DeferredPacket &dp = it->second;
+        Addr vaddr = dp.pfInfo.getAddr();
         /* Set paddr to 0 if not yet translated */
-        Addr paddr = it->pkt ? it->pkt->getAddr() : 0;
+        Addr paddr = dp.pkt ? dp.pkt->getAddr() : 0;
         DPRINTF(HWPrefetchQueue, "%s[%d]: Prefetch Req VA: %#x PA: %#x "
-                "prio: %3d\n", queue_name, pos, vaddr, paddr, it->priority);
+                "prio: %3d\n", queue_name, pos, vaddr, paddr, dp.priority);
     }
 }
 
@@ -176,27 +249,28 @@ Queued::notify(const CacheAccessProbeArg &acc, const PrefetchInfo &pfi)
     const PacketPtr pkt = acc.pkt;
     const CacheAccessor &cache = acc.cache;
 
-    // Squash queued prefetches if demand miss to same line
+    // Squash queued prefetches if demand miss to same line. Queued
+    // prefetch addresses are block aligned, so the index can be probed
+    // with the block address directly
     if (queueSquash) {
-        auto itr = pfq.begin();
-        while (itr != pfq.end()) {
-            if (blockAddress(itr->pfInfo.getAddr()) == blk_addr &&
-                itr->pfInfo.isSecure() == is_secure) {
+        auto range = pfq.findBlock(blk_addr);
+        while (range.first != range.second) {
+            iterator itr = range.first->second;
+            ++range.first;
+            if (itr->second.pfInfo.isSecure() == is_secure) {
                 DPRINTF(HWPrefetch, "Removing pf candidate addr: %#x "
                         "(cl: %#x), demand request going to the same addr\n",
-                        itr->pfInfo.getAddr(),
-                        blockAddress(itr->pfInfo.getAddr()));
-                delete itr->pkt;
-                itr = pfq.erase(itr);
+                        itr->second.pfInfo.getAddr(), blk_addr);
+                delete itr->second.pkt;
+                pfq.erase(itr);
                 statsQueued.pfRemovedDemand++;
-            } else {
-                ++itr;
             }
         }
     }
 
     // Calculate prefetches given this access
-    std::vector<AddrPriority> addresses;
+    std::vector<AddrPriority> &addresses = pfCandidates;
+    addresses.clear();
     calculatePrefetch(pfi, addresses, cache);
 
     // Get the maximu number of prefetches that we are allowed to generate
@@ -252,7 +326,7 @@ Queued::getPacket()
     }
 
     PacketPtr pkt = pfq.front().pkt;
-    pfq.pop_front();
+    pfq.erase(pfq.begin());
 
     prefetchStats.pfIssued++;
     issuedPrefetches += 1;
@@ -290,7 +364,7 @@ Queued::processMissingTranslations(unsigned max)
     unsigned count = 0;
     iterator it = pfqMissingTranslation.begin();
     while (it != pfqMissingTranslation.end() && count < max) {
-        DeferredPacket &dp = *it;
+        DeferredPacket &dp = it->second;
         // Increase the iterator first because dp.startTranslation can end up
         // calling finishTranslation, which will erase "it"
         it++;
@@ -303,74 +377,56 @@ void
 Queued::translationComplete(DeferredPacket *dp, bool failed,
                             const CacheAccessor &cache)
 {
-    auto it = pfqMissingTranslation.begin();
-    while (it != pfqMissingTranslation.end()) {
-        if (&(*it) == dp) {
-            break;
-        }
-        it++;
-    }
-    assert(it != pfqMissingTranslation.end());
+    iterator it = pfqMissingTranslation.find(dp);
+    assert(it != pfqMissingTranslation.end() && &it->second == dp);
     if (!failed) {
         DPRINTF(HWPrefetch, "%s Translation of vaddr %#x succeeded: "
                 "paddr %#x \n", mmu->name(),
-                it->translationRequest->getVaddr(),
-                it->translationRequest->getPaddr());
-        Addr target_paddr = it->translationRequest->getPaddr();
+                dp->translationRequest->getVaddr(),
+                dp->translationRequest->getPaddr());
+        Addr target_paddr = dp->translationRequest->getPaddr();
         // check if this prefetch is already redundant
         if (cacheSnoop &&
-                (cache.inCache(target_paddr, it->pfInfo.isSecure()) ||
-                 cache.inMissQueue(target_paddr, it->pfInfo.isSecure()))) {
+                (cache.inCache(target_paddr, dp->pfInfo.isSecure()) ||
+                 cache.inMissQueue(target_paddr, dp->pfInfo.isSecure()))) {
             statsQueued.pfInCache++;
             DPRINTF(HWPrefetch, "Dropping redundant in "
                     "cache/MSHR prefetch addr:%#x\n", target_paddr);
         } else {
             Tick pf_time = curTick() + clockPeriod() * latency;
-            it->createPkt(target_paddr, blkSize, requestorId, tagPrefetch,
+            dp->createPkt(target_paddr, blkSize, requestorId, tagPrefetch,
                           pf_time);
-            addToQueue(pfq, *it);
+            addToQueue(pfq, *dp);
         }
     } else {
         DPRINTF(HWPrefetch, "%s Translation of vaddr %#x failed, dropping "
                 "prefetch request %#x \n", mmu->name(),
-                it->translationRequest->getVaddr());
+                dp->translationRequest->getVaddr());
     }
     pfqMissingTranslation.erase(it);
 }
 
 bool
-Queued::alreadyInQueue(std::list<DeferredPacket> &queue,
+Queued::alreadyInQueue(DeferredQueue &queue,
                                  const PrefetchInfo &pfi, int32_t priority)
 {
-    bool found = false;
-    iterator it;
-    for (it = queue.begin(); it != queue.end() && !found; it++) {
-        found = it->pfInfo.sameAddr(pfi);
-    }
+    iterator it = queue.find(pfi);
 
     /* If the address is already in the queue, update priority and leave */
     if (it != queue.end()) {
         statsQueued.pfBufferHit++;
-        if (it->priority < priority) {
+        if (it->second.priority < priority) {
             /* Update priority value and position in the queue */
-            it->priority = priority;
-            iterator prev = it;
-            while (prev != queue.begin()) {
-                prev--;
-                /* If the packet has higher priority, swap */
-                if (*it > *prev) {
-                    std::swap(*it, *prev);
-                    it = prev;
-                }
-            }
+            queue.setPriority(it, priority);
             DPRINTF(HWPrefetch, "Prefetch addr already in "
                 "prefetch queue, priority updated\n");
         } else {
             DPRINTF(HWPrefetch, "Prefetch addr already in "
                 "prefetch queue\n");
         }
+        return true;
     }
-    return found;
+    return false;
 }
 
 RequestPtr
@@ -484,50 +540,33 @@ Queued::insert(const PacketPtr &pkt, PrefetchInfo &new_pfi,
 }
 
 void
-Queued::addToQueue(std::list<DeferredPacket> &queue,
+Queued::addToQueue(DeferredQueue &queue,
                              DeferredPacket &dpp)
 {
+    const unsigned max_size = &queue == &pfq ?
+        queueSize : missingTranslationQueueSize;
+
     /* Verify prefetch buffer space for request */
-    if (queue.size() == queueSize) {
+    if (queue.size() >= max_size) {
         statsQueued.pfRemovedFull++;
-        /* Lowest priority packet */
-        iterator it = queue.end();
-        panic_if (it == queue.begin(),
-            "Prefetch queue is both full and empty!");
-        --it;
-        /* Look for oldest in that level of priority */
-        panic_if (it == queue.begin(),
-            "Prefetch queue is full with 1 element!");
-        iterator prev = it;
-        bool cont = true;
-        /* While not at the head of the queue */
-        while (cont && prev != queue.begin()) {
-            prev--;
-            /* While at the same level of priority */
-            cont = prev->priority == it->priority;
-            if (cont)
-                /* update pointer */
-                it = prev;
+        panic_if(queue.empty(), "Prefetch queue is both full and empty!");
+        /* Oldest packet in the lowest level of priority */
+        iterator it = queue.victim();
+        if (it->second.ongoingTranslation) {
+            // The MMU still holds on to the victim, so drop the new
+            // request instead
+            DPRINTF(HWPrefetch, "Prefetch queue full, dropping packet, "
+                    "addr: %#x\n", dpp.pfInfo.getAddr());
+            return;
         }
         DPRINTF(HWPrefetch, "Prefetch queue full, removing lowest priority "
-                            "oldest packet, addr: %#x\n",it->pfInfo.getAddr());
-        delete it->pkt;
+                            "oldest packet, addr: %#x\n",
+                            it->second.pfInfo.getAddr());
+        delete it->second.pkt;
         queue.erase(it);
     }
 
-    if ((queue.size() == 0) || (dpp <= queue.back())) {
-        queue.emplace_back(dpp);
-    } else {
-        iterator it = queue.end();
-        do {
-            --it;
-        } while (it != queue.begin() && dpp > *it);
-        /* If we reach the head, we have to see if the new element is new head
-         * or not */
-        if (it == queue.begin() && dpp <= *it)
-            it++;
-        queue.insert(it, dpp);
-    }
+    queue.insert(dpp);
 
     if (debug::HWPrefetchQueue)
         printQueue(queue);
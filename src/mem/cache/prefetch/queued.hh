@@ -39,8 +39,10 @@
 #define __MEM_CACHE_PREFETCH_QUEUED_HH__
 
 #include <cstdint>
-#include <list>
+#include <map>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arch/generic/mmu.hh"
 #include "base/statistics.hh"
@@ -71,6 +73,8 @@ class Queued : public Base
         PacketPtr pkt;
         /** The priority of this prefetch */
         int32_t priority;
+        /** Arrival order in the queue holding this prefetch */
+        uint64_t seq;
         /** Request used when a translation is needed */
         RequestPtr translationRequest;
         ThreadContext *tc;
@@ -88,7 +92,7 @@ class Queued : public Base
         DeferredPacket(Queued *o, PrefetchInfo const &pfi, Tick t,
             int32_t prio, const CacheAccessor &_cache)
             : owner(o), pfInfo(pfi), tick(t), pkt(nullptr),
-            priority(prio), translationRequest(), tc(nullptr),
+            priority(prio), seq(0), translationRequest(), tc(nullptr),
             ongoingTranslation(false), cache(&_cache) {
         }
 
@@ -141,11 +145,123 @@ class Queued : public Base
         void startTranslation(BaseMMU *mmu);
     };
 
-    std::list<DeferredPacket> pfq;
-    std::list<DeferredPacket> pfqMissingTranslation;
+    /**
+     * A queue of deferred packets, sorted by decreasing priority and, within
+     * a priority level, by arrival order. Entries are node based so that
+     * their addresses remain stable while their translation is in flight,
+     * and they are indexed by prefetch address so that duplicate filtering
+     * and demand squashing do not have to walk the whole queue.
+     */
+    class DeferredQueue
+    {
+      private:
+        /** Ordering key: the priority and the arrival order of an entry */
+        using Key = std::pair<int32_t, uint64_t>;
+
+        struct KeyCompare
+        {
+            bool
+            operator()(const Key &a, const Key &b) const
+            {
+                return a.first != b.first ? a.first > b.first :
+                                            a.second < b.second;
+            }
+        };
+
+        using Entries = std::map<Key, DeferredPacket, KeyCompare>;
+
+      public:
+        using iterator = Entries::iterator;
+        using const_iterator = Entries::const_iterator;
+
+      private:
+        Entries entries;
+
+        /** Entries indexed by the address of their prefetch */
+        std::unordered_multimap<Addr, iterator> index;
+
+        /** Arrival order given to the next entry */
+        uint64_t nextSeq = 0;
+
+        /** Find the index entry pointing to the given entry */
+        std::unordered_multimap<Addr, iterator>::iterator
+        indexOf(iterator it);
+
+      public:
+        iterator begin() { return entries.begin(); }
+        iterator end() { return entries.end(); }
+        const_iterator begin() const { return entries.begin(); }
+        const_iterator end() const { return entries.end(); }
+
+        size_t size() const { return entries.size(); }
+        bool empty() const { return entries.empty(); }
+
+        DeferredPacket &front() { return entries.begin()->second; }
+        const DeferredPacket &
+        front() const
+        {
+            return entries.begin()->second;
+        }
+
+        /**
+         * Add a copy of a packet after all the queued packets of the same
+         * or higher priority.
+         * @param dpp the packet to add
+         * @return iterator to the added entry
+         */
+        iterator insert(const DeferredPacket &dpp);
+
+        /**
+         * Remove an entry.
+         * @param it the entry to remove
+         * @return iterator to the following entry
+         */
+        iterator erase(iterator it);
+
+        /**
+         * Find a queued prefetch to the same address.
+         * @param pfi information of the prefetch to look for
+         * @return iterator to the entry, or end() if there is none
+         */
+        iterator find(const PrefetchInfo &pfi);
 
-    using const_iterator = std::list<DeferredPacket>::const_iterator;
-    using iterator = std::list<DeferredPacket>::iterator;
+        /**
+         * Find the entry holding a queued packet.
+         * @param dp a packet held by this queue
+         * @return iterator to the entry
+         */
+        iterator find(const DeferredPacket *dp);
+
+        /**
+         * Find all the queued prefetches to a block.
+         * @param blk_addr address of the block
+         * @return the range of index entries for that block, each pointing
+         *         to an entry of the queue
+         */
+        std::pair<std::unordered_multimap<Addr, iterator>::iterator,
+                  std::unordered_multimap<Addr, iterator>::iterator>
+        findBlock(Addr blk_addr) { return index.equal_range(blk_addr); }
+
+        /**
+         * Change the priority of an entry, moving it after all the packets
+         * of the same or higher priority.
+         * @param it the entry; updated to its new position
+         * @param priority the new priority
+         */
+        void setPriority(iterator &it, int32_t priority);
+
+        /**
+         * The entry to drop when the queue is full: the oldest one of the
+         * lowest priority.
+         */
+        iterator victim();
+    };
+
+    DeferredQueue pfq;
+    DeferredQueue pfqMissingTranslation;
+
+    using const_iterator = DeferredQueue::const_iterator;
+    using iterator = DeferredQueue::iterator;
 
     // PARAMETERS
 
@@ -210,7 +326,7 @@ class Queued : public Base
         return pfq.empty() ? MaxTick : pfq.front().tick;
     }
 
-    void printQueue(const std::list<DeferredPacket> &queue) const;
+    void printQueue(const DeferredQueue &queue) const;
 
   private:
 
@@ -219,7 +335,7 @@ class Queued : public Base
      * @param queue selected queue to use
      * @param dpp DeferredPacket to add
      */
-    void addToQueue(std::list<DeferredPacket> &queue, DeferredPacket &dpp);
+    void addToQueue(DeferredQueue &queue, DeferredPacket &dpp);
 
     /**
      * Starts the translations of the queued prefetches with a
@@ -249,9 +365,15 @@ class Queued : public Base
      * @param priority priority of the prefetch request to be added
      * @return True if the prefetch request was found in the queue
      */
-    bool alreadyInQueue(std::list<DeferredPacket> &queue,
+    bool alreadyInQueue(DeferredQueue &queue,
                         const PrefetchInfo &pfi, int32_t priority);
 
+    /**
+     * Candidate buffer handed to calculatePrefetch, kept across
+     * notifications so that it is not reallocated on every access.
+     */
+    std::vector<AddrPriority> pfCandidates;
+
     /**
      * Returns the maxmimum number of prefetch requests that are allowed
      * to be created from the number of prefetch candidates provided.
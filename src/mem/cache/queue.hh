@@ -48,6 +48,8 @@
 #include <cassert>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/named.hh"
@@ -101,6 +103,86 @@ class Queue : public Drainable, public Named
     /** Holds non allocated entries. */
     typename Entry::List freeList;
 
+    /**
+     * Allocated entries indexed by block, so that address lookups do not
+     * have to walk the allocated list. The index points to the oldest
+     * entry of a block; entries sharing a block (e.g., uncacheable ones)
+     * are chained from it in allocation order through blockNext and
+     * blockPrev, which are indexed by the position of an entry in the
+     * storage.
+     */
+    std::unordered_map<Addr, Entry*> blockIndex;
+    std::vector<Entry*> blockNext;
+    std::vector<Entry*> blockPrev;
+
+    static Addr
+    blockKey(Addr blk_addr, bool is_secure)
+    {
+        // Block addresses are aligned, which leaves the low bit free
+        return blk_addr | (is_secure ? 1 : 0);
+    }
+
+    size_t entryIndex(const Entry *entry) const
+    {
+        return entry - entries.data();
+    }
+
+    /**
+     * Oldest allocated entry of a block.
+     *
+     * @return Pointer to the entry, null if there is none.
+     */
+    Entry* blockHead(Addr blk_addr, bool is_secure) const
+    {
+        auto it = blockIndex.find(blockKey(blk_addr, is_secure));
+        return it == blockIndex.end() ? nullptr : it->second;
+    }
+
+    /**
+     * Add a newly allocated entry to the block index. To be called once
+     * the entry holds its block address.
+     *
+     * @param entry The allocated entry.
+     */
+    void addToBlockIndex(Entry *entry)
+    {
+        const size_t idx = entryIndex(entry);
+        blockNext[idx] = nullptr;
+        auto res = blockIndex.emplace(
+            blockKey(entry->blkAddr, entry->isSecure), entry);
+        if (res.second) {
+            blockPrev[idx] = nullptr;
+            return;
+        }
+
+        Entry *tail = res.first->second;
+        while (Entry *next = blockNext[entryIndex(tail)]) {
+            tail = next;
+        }
+        blockNext[entryIndex(tail)] = entry;
+        blockPrev[idx] = tail;
+    }
+
+    void removeFromBlockIndex(Entry *entry)
+    {
+        const size_t idx = entryIndex(entry);
+        Entry *prev = blockPrev[idx];
+        Entry *next = blockNext[idx];
+        if (next) {
+            blockPrev[entryIndex(next)] = prev;
+        }
+        if (prev) {
+            blockNext[entryIndex(prev)] = next;
+        } else {
+            const Addr key = blockKey(entry->blkAddr, entry->isSecure);
+            if (next) {
+                blockIndex[key] = next;
+            } else {
+                blockIndex.erase(key);
+            }
+        }
+    }
+
     typename Entry::Iterator addToReadyList(Entry* entry)
     {
         if (readyList.empty() ||
@@ -135,11 +217,13 @@ class Queue : public Drainable, public Named
         Named(name),
         label(_label), numEntries(num_entries + reserve),
         numReserve(reserve), entries(numEntries, name + ".entry"),
+        blockNext(numEntries, nullptr), blockPrev(numEntries, nullptr),
         _numInService(0), allocated(0)
     {
         for (int i = 0; i < numEntries; ++i) {
             freeList.push_back(&entries[i]);
         }
+        blockIndex.reserve(numEntries);
     }
 
     bool isEmpty() const
@@ -168,15 +252,16 @@ class Queue : public Drainable, public Named
     Entry* findMatch(Addr blk_addr, bool is_secure,
                      bool ignore_uncacheable = true) const
     {
-        for (const auto& entry : allocatedList) {
+        for (Entry *entry = blockHead(blk_addr, is_secure); entry;
+             entry = blockNext[entryIndex(entry)]) {
             // we ignore any entries allocated for uncacheable
             // accesses and simply ignore them when matching, in the
             // cache we never check for matches when adding new
             // uncacheable entries, and we do not want normal
             // cacheable accesses being added to an WriteQueueEntry
             // serving an uncacheable access
-            if (!(ignore_uncacheable && entry->isUncacheable()) &&
-                entry->matchBlockAddr(blk_addr, is_secure)) {
+            if (!(ignore_uncacheable && entry->isUncacheable())) {
+                assert(entry->matchBlockAddr(blk_addr, is_secure));
                 return entry;
             }
         }
@@ -206,12 +291,27 @@ class Queue : public Drainable, public Named
      */
     Entry* findPending(const QueueEntry* entry) const
     {
-        for (const auto& ready_entry : readyList) {
-            if (ready_entry->conflictAddr(entry)) {
-                return ready_entry;
+        // Look for the entries of the same block that have not been sent
+        // downstream, i.e., the ones in the ready list
+        Entry *pending = nullptr;
+        for (Entry *other = blockHead(entry->blkAddr, entry->isSecure);
+             other; other = blockNext[entryIndex(other)]) {
+            if (other->inService) {
+                continue;
             }
+            if (pending) {
+                // Several candidates; the earliest one in the ready list
+                // is the one to report
+                for (const auto& ready_entry : readyList) {
+                    if (ready_entry->conflictAddr(entry)) {
+                        return ready_entry;
+                    }
+                }
+                panic("Pending entries are missing from the ready list.");
+            }
+            pending = other;
         }
-        return nullptr;
+        return pending;
     }
 
     /**
@@ -241,6 +341,7 @@ class Queue : public Drainable, public Named
     deallocate(Entry *entry)
     {
         allocatedList.erase(entry->allocIter);
+        removeFromBlockIndex(entry);
         freeList.push_front(entry);
         allocated--;
         if (entry->inService) {
@@ -30,6 +30,8 @@
 #define __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "mem/cache/replacement_policies/replaceable_entry.hh"
@@ -48,6 +50,48 @@ typedef std::vector<ReplaceableEntry*> ReplacementCandidates;
 namespace replacement_policy
 {
 
+/**
+ * Bulk allocator for the replacement data of a policy. Entries are
+ * constructed in place inside fixed-capacity slabs, and the returned
+ * pointers share ownership of their slab through the aliasing constructor,
+ * so instantiating a cache neither allocates nor creates a control block
+ * per entry, and entries of neighbouring blocks end up contiguous in
+ * memory. A slab is released once the last entry it holds is released.
+ *
+ * @tparam T The policy-specific replacement data type.
+ */
+template <class T>
+class ReplacementDataPool
+{
+  private:
+    /** Number of entries held by each slab. */
+    static constexpr std::size_t slabEntries = 1024;
+
+    /** The slab new entries are currently constructed in. */
+    std::shared_ptr<std::vector<T>> slab;
+
+  public:
+    /**
+     * Construct a new replacement data entry.
+     *
+     * @param args Arguments forwarded to the constructor of T.
+     * @return A shared pointer to the new replacement data.
+     */
+    template <typename... Args>
+    std::shared_ptr<ReplacementData>
+    allocate(Args&&... args)
+    {
+        // The slab never grows past its reserved capacity, so the
+        // addresses of the entries already handed out remain stable
+        if (!slab || slab->size() == slab->capacity()) {
+            slab = std::make_shared<std::vector<T>>();
+            slab->reserve(slabEntries);
+        }
+        slab->emplace_back(std::forward<Args>(args)...);
+        return std::shared_ptr<ReplacementData>(slab, &slab->back());
+    }
+};
+
 /**
  * A common base class of cache replacement policy objects.
  */
@@ -91,6 +91,9 @@ class BRRIP : public Base
         }
     };
 
+    /** Storage for the replacement data of all entries. */
+    ReplacementDataPool<BRRIPReplData> replDataPool;
+
     /**
      * Number of RRPV bits. An entry that saturates its RRPV has the longest
      * possible re-reference interval, that is, it is likely not to be used
@@ -60,6 +60,9 @@ class LRU : public Base
         LRUReplData() : lastTouchTick(0) {}
     };
 
+    /** Storage for the replacement data of all entries. */
+    ReplacementDataPool<LRUReplData> replDataPool;
+
   public:
     typedef LRURPParams Params;
     LRU(const Params &p);
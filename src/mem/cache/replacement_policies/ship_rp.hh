@@ -93,6 +93,9 @@ class SHiP : public BRRIP
         bool wasReReferenced() const;
     };
 
+    /** Storage for the replacement data of all entries. */
+    ReplacementDataPool<SHiPReplData> shipReplDataPool;
+
     /**
      * Saturation percentage at which an entry starts being inserted as
      * intermediate re-reference.
@@ -122,7 +122,7 @@ class TreePLRU : public Base
     /**
      * Holds the latest temporary tree instance created by instantiateEntry().
      */
-    PLRUTree* treeInstance;
+    std::shared_ptr<PLRUTree> treeInstance;
 
   protected:
     /**
@@ -154,6 +154,9 @@ class TreePLRU : public Base
         TreePLRUReplData(const uint64_t index, std::shared_ptr<PLRUTree> tree);
     };
 
+    /** Storage for the replacement data of all entries. */
+    ReplacementDataPool<TreePLRUReplData> replDataPool;
+
   public:
     typedef TreePLRURPParams Params;
     TreePLRU(const Params &p);
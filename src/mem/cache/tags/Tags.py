@@ -77,6 +77,11 @@ class BaseTags(ClockedObject):
     # Get the block size from the parent (system)
     block_size = Param.Int(Parent.cache_line_size, "block size in bytes")
 
+    # Get whether the data is stored from the parent (cache)
+    tag_only = Param.Bool(
+        Parent.tag_only, "Don't allocate storage for the data of the blocks"
+    )
+
     # Get the tag lookup latency from the parent (cache)
     tag_latency = Param.Cycles(
         Parent.tag_latency, "The tag lookup latency for this cache"
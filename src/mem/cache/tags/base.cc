@@ -66,7 +66,9 @@ BaseTags::BaseTags(const Params &p)
       partitionManager(p.partitioning_manager),
       warmupBound((p.warmup_percentage/100.0) * (p.size / p.block_size)),
       warmedUp(false), numBlocks(p.size / p.block_size),
-      dataBlks(new uint8_t[p.size]), // Allocate data storage in one big chunk
+      tagOnly(p.tag_only),
+      // Allocate data storage in one big chunk
+      dataBlks(new uint8_t[tagOnly ? blkSize : p.size]),
       stats(*this)
 {
     registerExitCallback([this]() { cleanupRefs(); });
@@ -81,6 +83,19 @@ BaseTags::findBlockBySetAndWay(int set, int way) const
 CacheBlk*
 BaseTags::findBlock(const CacheBlk::KeyType &key) const
 {
+    // If every way maps the key to the same set, search the set in place
+    // and extract the tag only once
+    if (const auto *set = indexingPolicy->getPossibleSet(key)) {
+        const Addr tag = extractTag(key.address);
+        for (const auto& location : *set) {
+            CacheBlk* blk = static_cast<CacheBlk*>(location);
+            if (blk->matchTag(tag, key.secure)) {
+                return blk;
+            }
+        }
+        return nullptr;
+    }
+
     // Find possible entries that may contain the given address
     const std::vector<ReplaceableEntry*> entries =
         indexingPolicy->getPossibleEntries(key);
@@ -97,6 +112,26 @@ BaseTags::findBlock(const CacheBlk::KeyType &key) const
     return nullptr;
 }
 
+const std::vector<ReplaceableEntry*>&
+BaseTags::getVictimCandidates(const CacheBlk::KeyType &key,
+                              const uint64_t partition_id,
+                              std::vector<ReplaceableEntry*> &storage) const
+{
+    if (!partitionManager) {
+        if (const auto *set = indexingPolicy->getPossibleSet(key)) {
+            return *set;
+        }
+    }
+
+    storage = indexingPolicy->getPossibleEntries(key);
+
+    // Filter entries based on PartitionID
+    if (partitionManager) {
+        partitionManager->filterByPartition(storage, partition_id);
+    }
+    return storage;
+}
+
 void
 BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
 {
@@ -102,9 +102,19 @@ class BaseTags : public ClockedObject
     /** the number of blocks in the cache */
     const unsigned numBlocks;
 
-    /** The data blocks, 1 per cache block. */
+    /** Whether the blocks share a single data block, see tag_only. */
+    const bool tagOnly;
+
+    /** The data blocks, 1 per cache block, or 1 when tag only. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /** Get the data storage of the block with the given index. */
+    uint8_t *
+    blkData(unsigned index)
+    {
+        return tagOnly ? dataBlks.get() : &dataBlks[blkSize * index];
+    }
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
@@ -160,6 +170,22 @@ class BaseTags : public ClockedObject
         statistics::Scalar dataAccesses;
     } stats;
 
+    /**
+     * Get the entries that may be replaced to make room for a key. When
+     * the indexing policy exposes the key's set and there is no
+     * partitioning policy to filter it, the set is returned in place and
+     * nothing is allocated. Otherwise the candidates are built in storage.
+     *
+     * @param key The key to find victim candidates for.
+     * @param partition_id Partition ID for resource management.
+     * @param storage Vector to build the candidates in if needed.
+     * @return The replacement candidates.
+     */
+    const std::vector<ReplaceableEntry*>&
+    getVictimCandidates(const CacheBlk::KeyType &key,
+                        const uint64_t partition_id,
+                        std::vector<ReplaceableEntry*> &storage) const;
+
   public:
     PARAMS(BaseTags);
     BaseTags(const Params &p);
@@ -173,13 +173,9 @@ class BaseSetAssoc : public BaseTags
                          const uint64_t partition_id=0) override
     {
         // Get possible entries to be victimized
-        std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(key);
-
-        // Filter entries based on PartitionID
-        if (partitionManager) {
-            partitionManager->filterByPartition(entries, partition_id);
-        }
+        std::vector<ReplaceableEntry*> storage;
+        const std::vector<ReplaceableEntry*> &entries =
+            getVictimCandidates(key, partition_id, storage);
 
         // Choose replacement victim from replacement candidates
         CacheBlk* victim = entries.empty() ? nullptr :
@@ -94,7 +94,7 @@ CompressedTags::tagsInit()
             blk = &blks[blk_index];
 
             // Associate a data chunk to the block
-            blk->data = &dataBlks[blkSize*blk_index];
+            blk->data = blkData(blk_index);
 
             // Associate superblock to this block
             blk->setSectorBlock(superblock);
@@ -121,14 +121,9 @@ CompressedTags::findVictim(const CacheBlk::KeyType& key,
                            const uint64_t partition_id=0)
 {
     // Get all possible locations of this superblock
-    std::vector<ReplaceableEntry*> superblock_entries =
-        indexingPolicy->getPossibleEntries(key);
-
-    // Filter entries based on PartitionID
-    if (partitionManager){
-        partitionManager->filterByPartition(superblock_entries,
-            partition_id);
-    }
+    std::vector<ReplaceableEntry*> storage;
+    const std::vector<ReplaceableEntry*> &superblock_entries =
+        getVictimCandidates(key, partition_id, storage);
 
     // Check if the superblock this address belongs to has been allocated. If
     // so, try co-allocating
@@ -194,6 +194,22 @@ class IndexingPolicyTemplate : public SimObject
     virtual std::vector<ReplaceableEntry*> getPossibleEntries(const KeyType &key)
                                                                     const = 0;
 
+    /**
+     * Get the possible entries of a key in place, for policies that map
+     * the key to the same set in every way. Unlike getPossibleEntries()
+     * this does not build a new vector, so it is cheap enough for lookups
+     * on the critical path.
+     *
+     * @param key The key to find the set of.
+     * @return The key's set, or nullptr if the possible entries of the key
+     *         are spread over several sets.
+     */
+    virtual const std::vector<ReplaceableEntry*>*
+    getPossibleSet(const KeyType &key) const
+    {
+        return nullptr;
+    }
+
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
      *
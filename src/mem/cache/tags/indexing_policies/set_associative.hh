@@ -118,6 +118,12 @@ class SetAssociative : public BaseIndexingPolicy
     std::vector<ReplaceableEntry*> getPossibleEntries(const Addr &addr) const
                                                                      override;
 
+    const std::vector<ReplaceableEntry*>*
+    getPossibleSet(const Addr &addr) const override
+    {
+        return &sets[extractSet(addr)];
+    }
+
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
      *
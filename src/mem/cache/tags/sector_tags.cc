@@ -99,6 +99,7 @@ SectorTags::tagsInit()
 
         // Associate a replacement data entry to the sector
         sec_blk->replacementData = replacementPolicy->instantiateEntry();
+        sec_blk->registerTagExtractor(genTagExtractor(indexingPolicy));
 
         // Initialize all blocks in this sector
         sec_blk->blks.resize(numBlocksPerSector);
@@ -110,10 +111,11 @@ SectorTags::tagsInit()
             blk = &blks[blk_index];
 
             // Associate a data chunk to the block
-            blk->data = &dataBlks[blkSize*blk_index];
+            blk->data = blkData(blk_index);
 
             // Associate sector block to this block
             blk->setSectorBlock(sec_blk);
+            blk->registerTagExtractor(genTagExtractor(indexingPolicy));
 
             // Associate the sector replacement data to this block
             blk->replacementData = sec_blk->replacementData;
@@ -268,6 +270,19 @@ SectorTags::findBlock(const CacheBlk::KeyType &key) const
     // due to sectors being composed of contiguous-address entries
     const Addr offset = extractSectorOffset(key.address);
 
+    // If every way maps the key to the same set, search the set in place
+    // and extract the tag only once
+    if (const auto *set = indexingPolicy->getPossibleSet(key)) {
+        const Addr tag = extractTag(key.address);
+        for (const auto& sector : *set) {
+            auto blk = static_cast<SectorBlk*>(sector)->blks[offset];
+            if (blk->matchTag(tag, key.secure)) {
+                return blk;
+            }
+        }
+        return nullptr;
+    }
+
     // Find all possible sector entries that may contain the given address
     const std::vector<ReplaceableEntry*> entries =
         indexingPolicy->getPossibleEntries(key);
@@ -291,12 +306,9 @@ SectorTags::findVictim(const CacheBlk::KeyType &key,
                        const uint64_t partition_id)
 {
     // Get possible entries to be victimized
-    std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(key);
-
-    // Filter entries based on PartitionID
-    if (partitionManager)
-        partitionManager->filterByPartition(sector_entries, partition_id);
+    std::vector<ReplaceableEntry*> storage;
+    const std::vector<ReplaceableEntry*> &sector_entries =
+        getVictimCandidates(key, partition_id, storage);
 
     // Check if the sector this address belongs to has been allocated
     SectorBlk* victim_sector = nullptr;
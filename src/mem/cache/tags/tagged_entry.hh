@@ -94,6 +94,12 @@ class TaggedSetAssociative : public TaggedIndexingPolicy
         return sets[extractSet(key)];
     }
 
+    const std::vector<ReplaceableEntry*>*
+    getPossibleSet(const KeyType &key) const override
+    {
+        return &sets[extractSet(key)];
+    }
+
     Addr
     regenerateAddr(const KeyType &key,
                    const ReplaceableEntry *entry) const override
@@ -160,6 +166,20 @@ class TaggedEntry : public ReplaceableEntry
             (isSecure() == key.secure);
     }
 
+    /**
+     * Checks if an already extracted tag corresponds to this entry's. This
+     * lets a lookup over many entries extract the tag only once.
+     *
+     * @param tag The tag value to compare to.
+     * @param is_secure Whether secure bit is set.
+     * @return True if the tag information match this entry's.
+     */
+    bool
+    matchTag(Addr tag, bool is_secure) const
+    {
+        return isValid() && (getTag() == tag) && (isSecure() == is_secure);
+    }
+
     /**
      * Insert the block by assigning it a tag and marking it valid. Touches
      * block if it hadn't been touched previously.
@@ -131,8 +131,10 @@ CfiMemory::ProgramBuffer::writeback()
     if (parent.blocks.isLocked(blockPointer)) {
         return false;
     } else {
-        std::memcpy(parent.toHostAddr(parent.start() + blockPointer),
-            buffer.data(), bytesWritten);
+        auto host_address = parent.toHostAddr(parent.start() + blockPointer);
+        if (parent.deltaImage)
+            parent.deltaImage->fetch(host_address, bytesWritten);
+        std::memcpy(host_address, buffer.data(), bytesWritten);
         return true;
     }
 }
@@ -755,6 +757,8 @@ void
 CfiMemory::BlockData::erase(PacketPtr pkt)
 {
     auto host_address = parent.toHostAddr(pkt->getAddr());
+    if (parent.deltaImage)
+        parent.deltaImage->fetch(host_address, blockSize);
     std::memset(host_address, 0xff, blockSize);
 }
 
@@ -332,10 +332,12 @@ class CoherentXBar : public BaseXBar
      *
      * @param pkt Packet to forward
      * @param exclude_cpu_side_port_id Id of CPU-side port to exclude
-     * @param dests Vector of destination ports for the forwarded pkt
+     * @param dests Destination ports for the forwarded pkt, either a
+     * vector of ports or the targets of a snoop filter lookup
      */
+    template <typename Dests>
     void forwardTiming(PacketPtr pkt, PortID exclude_cpu_side_port_id,
-                       const std::vector<QueuedResponsePort*>& dests);
+                       const Dests& dests);
 
     Tick recvAtomicBackdoor(PacketPtr pkt, PortID cpu_side_port_id,
                             MemBackdoorPtr *backdoor=nullptr);
@@ -367,15 +369,16 @@ class CoherentXBar : public BaseXBar
      * @param exclude_cpu_side_port_id Id of CPU-side port to exclude
      * @param source_mem_side_port_id Id of the memory-side port for
      * snoops from below
-     * @param dests Vector of destination ports for the forwarded pkt
+     * @param dests Destination ports for the forwarded pkt, either a
+     * vector of ports or the targets of a snoop filter lookup
      *
      * @return a pair containing the snoop response and snoop latency
      */
+    template <typename Dests>
     std::pair<MemCmd, Tick> forwardAtomic(PacketPtr pkt,
                                           PortID exclude_cpu_side_port_id,
                                           PortID source_mem_side_port_id,
-                                          const std::vector<QueuedResponsePort*>&
-                                          dests);
+                                          const Dests& dests);
 
     /** Function called by the port when the crossbar is receiving a Functional
         transaction.*/
@@ -370,8 +370,7 @@ CommMonitor::recvAtomic(PacketPtr pkt)
 
     // Some packets, such as WritebackDirty, don't need response.
     assert(pkt->isResponse() || !expects_response);
-    probing::PacketInfo resp_pkt_info(pkt);
-    ppPktResp->notify(resp_pkt_info);
+    ppPktResp->notifyWith([&]() { return probing::PacketInfo(pkt); });
     return delay;
 }
 
@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/delta_image.hh"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <thread>
+
+#include "base/atomicio.hh"
+#include "base/cprintf.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+namespace
+{
+
+struct BlockHeader
+{
+    uint32_t numPages;
+    uint32_t compressedSize;
+};
+
+} // anonymous namespace
+
+std::string
+DeltaImage::write(const std::string &path, const uint8_t *pmem,
+                  const uint8_t *base, Addr start, Addr end, Addr page_size)
+{
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+        return csprintf("Can't create physical memory checkpoint file "
+                        "'%s': %s", path, strerror(errno));
+
+    const std::vector<uint8_t> zero(page_size, 0);
+    std::vector<uint64_t> page_list;
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> compressed(
+        compressBound(PagesPerBlock * page_size));
+
+    auto write_block = [&]() {
+        uLongf compressed_size = compressed.size();
+        if (compress(compressed.data(), &compressed_size, data.data(),
+                     data.size()) != Z_OK) {
+            return false;
+        }
+
+        const BlockHeader header{(uint32_t)page_list.size(),
+                                 (uint32_t)compressed_size};
+        const size_t list_size = page_list.size() * sizeof(uint64_t);
+        bool ok = atomic_write(fd, &header, sizeof(header)) ==
+                sizeof(header) &&
+            atomic_write(fd, page_list.data(), list_size) ==
+                (ssize_t)list_size &&
+            atomic_write(fd, compressed.data(), compressed_size) ==
+                (ssize_t)compressed_size;
+
+        page_list.clear();
+        data.clear();
+        return ok;
+    };
+
+    bool ok = true;
+    for (Addr offset = start; offset < end && ok; offset += page_size) {
+        const Addr len = std::min(page_size, end - offset);
+        const uint8_t *ref = base ? base + offset : zero.data();
+        if (!memcmp(pmem + offset, ref, len))
+            continue;
+
+        page_list.push_back(offset / page_size);
+        data.insert(data.end(), pmem + offset, pmem + offset + len);
+        if (page_list.size() == PagesPerBlock)
+            ok = write_block();
+    }
+    if (ok && !page_list.empty())
+        ok = write_block();
+
+    if (close(fd) || !ok) {
+        return csprintf("Write failed on physical memory checkpoint file "
+                        "'%s'", path);
+    }
+    return "";
+}
+
+DeltaImage::DeltaImage(uint8_t *pmem, Addr size, Addr page_size)
+    : pmem(pmem), size(size), pageSize(page_size),
+      pendingBits(new std::atomic<uint64_t>[
+              divCeil(divCeil(size, page_size), 64)]()),
+      pendingPages(0)
+{
+}
+
+DeltaImage::~DeltaImage()
+{
+    for (int fd : parts)
+        close(fd);
+}
+
+void
+DeltaImage::addPart(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s': %s\n",
+              path, strerror(errno));
+
+    const unsigned part = parts.size();
+    parts.push_back(fd);
+
+    BlockHeader header;
+    ssize_t ret;
+    while ((ret = atomic_read(fd, &header, sizeof(header))) != 0) {
+        fatal_if(ret != sizeof(header) || !header.numPages ||
+                 header.numPages > PagesPerBlock,
+                 "Corrupt block header in physical memory checkpoint "
+                 "file '%s'\n", path);
+
+        Block block;
+        block.part = part;
+        block.compressedSize = header.compressedSize;
+        block.firstPage = pages.size();
+        block.numPages = header.numPages;
+
+        pages.resize(pages.size() + header.numPages);
+        const size_t list_size = header.numPages * sizeof(uint64_t);
+        fatal_if(atomic_read(fd, &pages[block.firstPage], list_size) !=
+                 (ssize_t)list_size,
+                 "Truncated physical memory checkpoint file '%s'\n", path);
+
+        for (size_t i = block.firstPage; i < pages.size(); ++i) {
+            const uint64_t page = pages[i];
+            fatal_if(page * pageSize >= size ||
+                     (i && page <= pages[i - 1]),
+                     "Invalid page %d in physical memory checkpoint file "
+                     "'%s'\n", page, path);
+            pendingBits[page / 64].fetch_or(1ULL << (page % 64),
+                                            std::memory_order_relaxed);
+        }
+
+        block.offset = lseek(fd, 0, SEEK_CUR);
+        lseek(fd, header.compressedSize, SEEK_CUR);
+        blocks.push_back(block);
+        pendingPages.fetch_add(header.numPages, std::memory_order_release);
+    }
+}
+
+void
+DeltaImage::fetchPage(Addr page)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // another thread may have read the block in the meantime
+    if (!isPending(page))
+        return;
+
+    const auto page_it = std::lower_bound(pages.begin(), pages.end(), page);
+    const size_t index = page_it - pages.begin();
+    const auto block_it = std::upper_bound(
+        blocks.begin(), blocks.end(), index,
+        [](size_t i, const Block &b) { return i < b.firstPage; });
+    assert(page_it != pages.end() && *page_it == page &&
+           block_it != blocks.begin());
+
+    const std::string error = readBlock(*std::prev(block_it));
+    fatal_if(!error.empty(), "%s\n", error);
+}
+
+void
+DeltaImage::fetchAll()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::vector<const Block *> todo;
+    for (const auto &block : blocks) {
+        if (isPending(pages[block.firstPage]))
+            todo.push_back(&block);
+    }
+
+    const unsigned num_threads = std::max<size_t>(1, std::min<size_t>(
+        std::thread::hardware_concurrency(), todo.size()));
+    std::vector<std::string> errors(num_threads);
+    auto work = [&](unsigned thread) {
+        for (size_t i = thread; i < todo.size(); i += num_threads) {
+            errors[thread] = readBlock(*todo[i]);
+            if (!errors[thread].empty())
+                return;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < num_threads; ++i)
+        threads.emplace_back(work, i);
+    work(0);
+    for (auto &t : threads)
+        t.join();
+
+    for (const auto &e : errors)
+        fatal_if(!e.empty(), "%s\n", e);
+}
+
+std::string
+DeltaImage::readBlock(const Block &block)
+{
+    std::vector<uint8_t> compressed(block.compressedSize);
+    std::vector<uint8_t> data(block.numPages * pageSize);
+
+    uLongf data_size = data.size();
+    if (pread(parts[block.part], compressed.data(), compressed.size(),
+              block.offset) != (ssize_t)compressed.size() ||
+        uncompress(data.data(), &data_size, compressed.data(),
+                   compressed.size()) != Z_OK) {
+        return "Failed to read a block of a physical memory checkpoint";
+    }
+
+    const uint8_t *src = data.data();
+    for (size_t i = block.firstPage; i < block.firstPage + block.numPages;
+         ++i) {
+        const Addr offset = pages[i] * pageSize;
+        const Addr len = std::min(pageSize, size - offset);
+        std::memcpy(pmem + offset, src, len);
+        src += len;
+
+        pendingBits[pages[i] / 64].fetch_and(~(1ULL << (pages[i] % 64)),
+                                             std::memory_order_release);
+    }
+    pendingPages.fetch_sub(block.numPages, std::memory_order_release);
+    return "";
+}
+
+} // namespace memory
+} // namespace gem5
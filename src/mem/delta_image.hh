@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_DELTA_IMAGE_HH__
+#define __MEM_DELTA_IMAGE_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * The pages of a backing store that differ from a base image, as
+ * recorded by a delta memory checkpoint.
+ *
+ * A delta is written as a number of part files, each covering a
+ * contiguous range of the store. A part is a sequence of blocks of up
+ * to PagesPerBlock pages, and every block is compressed on its own:
+ * a block starts with the number of pages in it and the size of its
+ * compressed data, followed by the page numbers and the data. Blocks
+ * can therefore be read independently of each other, and in any
+ * order.
+ *
+ * Restoring a delta first reads the block headers of all parts, which
+ * marks the pages they contain as pending. Pending pages are read from
+ * the checkpoint when they are fetched, either all at once or one
+ * block at a time as they are accessed.
+ */
+class DeltaImage
+{
+  public:
+    static constexpr unsigned PagesPerBlock = 16;
+
+    /**
+     * Write the pages of a range of a backing store that differ from
+     * the base image to a part file.
+     *
+     * @param path The part file to create
+     * @param pmem The backing store
+     * @param base The base image, or nullptr if it is zero
+     * @param start Offset of the first page in the range
+     * @param end Offset of the end of the range
+     * @param page_size The size of a page
+     * @return An error message, which is empty on success
+     */
+    static std::string write(const std::string &path, const uint8_t *pmem,
+                             const uint8_t *base, Addr start, Addr end,
+                             Addr page_size);
+
+    DeltaImage(uint8_t *pmem, Addr size, Addr page_size);
+    ~DeltaImage();
+
+    /**
+     * Read the block headers of a part file, and mark the pages it
+     * contains as pending.
+     */
+    void addPart(const std::string &path);
+
+    /**
+     * Make sure that all pages overlapping a range of the backing
+     * store are read.
+     *
+     * @param host_addr Start of the range in the backing store
+     * @param size Size of the range
+     */
+    void
+    fetch(const uint8_t *host_addr, Addr size)
+    {
+        if (!pendingPages.load(std::memory_order_acquire) || !size)
+            return;
+
+        const Addr offset = host_addr - pmem;
+        for (Addr page = offset / pageSize;
+             page <= (offset + size - 1) / pageSize; ++page) {
+            if (isPending(page))
+                fetchPage(page);
+        }
+    }
+
+    /** Read all pending pages, using as many host threads as useful. */
+    void fetchAll();
+
+    /** Get the number of pages that are not read yet. */
+    uint64_t pending() const { return pendingPages.load(); }
+
+  private:
+    struct Block
+    {
+        //! The part file this block is stored in.
+        unsigned part;
+        //! The offset of the compressed data in the part file.
+        off_t offset;
+        uint32_t compressedSize;
+        //! Index of the first page of this block in pages.
+        size_t firstPage;
+        size_t numPages;
+    };
+
+    uint8_t *const pmem;
+    const Addr size;
+    const Addr pageSize;
+
+    //! File descriptors of the part files.
+    std::vector<int> parts;
+    std::vector<Block> blocks;
+    //! The page numbers of all blocks, which are in ascending order.
+    std::vector<uint64_t> pages;
+
+    //! One bit per page of the store that is set while it is pending.
+    std::unique_ptr<std::atomic<uint64_t>[]> pendingBits;
+    std::atomic<uint64_t> pendingPages;
+
+    //! Serializes reading blocks.
+    std::mutex mutex;
+
+    bool
+    isPending(Addr page) const
+    {
+        return pendingBits[page / 64].load(std::memory_order_acquire) &
+            (1ULL << (page % 64));
+    }
+
+    void fetchPage(Addr page);
+
+    /**
+     * Read a block into the backing store and clear its pending bits.
+     *
+     * @return An error message, which is empty on success
+     */
+    std::string readBlock(const Block &block);
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_DELTA_IMAGE_HH__
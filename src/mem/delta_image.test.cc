@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mem/delta_image.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+namespace
+{
+
+constexpr Addr PageSize = 4096;
+// Not a multiple of the page size, so the last page is partial.
+constexpr Addr StoreSize = 300 * PageSize + 100;
+
+class DeltaImageTest : public testing::Test
+{
+  protected:
+    std::vector<uint8_t> store = std::vector<uint8_t>(StoreSize, 0);
+    std::vector<std::string> files;
+
+    void
+    TearDown() override
+    {
+        for (const auto &f : files)
+            unlink(f.c_str());
+    }
+
+    std::string
+    tempFile()
+    {
+        files.push_back(testing::TempDir() + "delta_image_test." +
+                        std::to_string(getpid()) + "." +
+                        std::to_string(files.size()));
+        return files.back();
+    }
+
+    // Dirty every seventh page as well as the partial last page.
+    void
+    dirty(std::vector<uint8_t> &mem, uint8_t value)
+    {
+        for (Addr offset = 0; offset < StoreSize; offset += 7 * PageSize)
+            mem[offset + 5] = value;
+        mem[StoreSize - 1] = value;
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(DeltaImageTest, FetchAllFromZero)
+{
+    dirty(store, 1);
+
+    // Write the store as two parts, split at a page boundary.
+    const std::string part0 = tempFile(), part1 = tempFile();
+    ASSERT_EQ(DeltaImage::write(part0, store.data(), nullptr, 0,
+                                150 * PageSize, PageSize), "");
+    ASSERT_EQ(DeltaImage::write(part1, store.data(), nullptr,
+                                150 * PageSize, StoreSize, PageSize), "");
+
+    std::vector<uint8_t> restored(StoreSize, 0);
+    DeltaImage image(restored.data(), StoreSize, PageSize);
+    image.addPart(part0);
+    image.addPart(part1);
+    EXPECT_EQ(image.pending(), 44);
+
+    image.fetchAll();
+    EXPECT_EQ(image.pending(), 0);
+    EXPECT_EQ(restored, store);
+}
+
+TEST_F(DeltaImageTest, FetchOnDemand)
+{
+    std::vector<uint8_t> base(StoreSize);
+    std::mt19937 rng(42);
+    for (auto &b : base)
+        b = rng();
+    store = base;
+    dirty(store, 2);
+
+    const std::string part = tempFile();
+    ASSERT_EQ(DeltaImage::write(part, store.data(), base.data(), 0,
+                                StoreSize, PageSize), "");
+
+    std::vector<uint8_t> restored = base;
+    DeltaImage image(restored.data(), StoreSize, PageSize);
+    image.addPart(part);
+    EXPECT_EQ(image.pending(), 44);
+
+    // Accessing a clean page does not read anything.
+    image.fetch(restored.data() + PageSize, 8);
+    EXPECT_EQ(image.pending(), 44);
+
+    // Accessing a dirty page reads the whole block it is stored in.
+    image.fetch(restored.data() + 7 * PageSize + 5, 1);
+    EXPECT_EQ(restored[7 * PageSize + 5], 2);
+    EXPECT_EQ(image.pending(), 44 - DeltaImage::PagesPerBlock);
+
+    // Accesses crossing into a pending page read that page as well,
+    // which is in the last block. That leaves the block in between.
+    image.fetch(restored.data() + StoreSize - PageSize, PageSize);
+    EXPECT_EQ(restored[StoreSize - 1], 2);
+    EXPECT_EQ(image.pending(), DeltaImage::PagesPerBlock);
+
+    image.fetchAll();
+    EXPECT_EQ(image.pending(), 0);
+    EXPECT_EQ(restored, store);
+}
+
+TEST_F(DeltaImageTest, NothingChanged)
+{
+    const std::string part = tempFile();
+    ASSERT_EQ(DeltaImage::write(part, store.data(), nullptr, 0, StoreSize,
+                                PageSize), "");
+
+    std::vector<uint8_t> restored(StoreSize, 0);
+    DeltaImage image(restored.data(), StoreSize, PageSize);
+    image.addPart(part);
+    EXPECT_EQ(image.pending(), 0);
+    image.fetch(restored.data(), StoreSize);
+    EXPECT_EQ(restored, store);
+}
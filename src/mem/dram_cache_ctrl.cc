@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_cache_ctrl.hh"
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/trace.hh"
+#include "debug/DRAMCache.hh"
+#include "debug/Drain.hh"
+#include "mem/mem_interface.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+DRAMCacheCtrl::FarMemPort::FarMemPort(const std::string &name,
+                                      DRAMCacheCtrl &_ctrl)
+    : QueuedRequestPort(name, _ctrl.farReqQueue, _ctrl.farSnoopRespQueue),
+      ctrl(_ctrl)
+{
+}
+
+bool
+DRAMCacheCtrl::FarMemPort::recvTimingResp(PacketPtr pkt)
+{
+    ctrl.recvFarResp(pkt);
+    return true;
+}
+
+DRAMCacheCtrl::DRAMCacheCtrl(const DRAMCacheCtrlParams &p) :
+    MemCtrl(p),
+    farPort(name() + ".far_mem_port", *this),
+    farReqQueue(*this, farPort),
+    farSnoopRespQueue(*this, farPort),
+    tags(p.cache_size, p.line_size, p.sector_size, p.assoc,
+         ceilLog2(dram->getAddrRange().end())),
+    requestorId(system()->getRequestorId(this)),
+    cacheStats(*this)
+{
+    DPRINTF(DRAMCache, "Tags of %d bits per line, %d bytes in total\n",
+            tags.getEntryBits(), divCeil(tags.storageBits(), 8));
+}
+
+void
+DRAMCacheCtrl::init()
+{
+    MemCtrl::init();
+    fatal_if(!farPort.isConnected(),
+             "%s: the far memory port is not connected.", name());
+}
+
+Port &
+DRAMCacheCtrl::getPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "far_mem_port")
+        return farPort;
+    return MemCtrl::getPort(if_name, idx);
+}
+
+PacketPtr
+DRAMCacheCtrl::farPacket(Addr addr, MemCmd cmd) const
+{
+    auto req = std::make_shared<Request>(addr, tags.getSectorSize(), 0,
+                                         requestorId);
+    PacketPtr pkt = new Packet(req, cmd);
+    pkt->allocate();
+    return pkt;
+}
+
+void
+DRAMCacheCtrl::writeback(const DRAMCacheTags::Victim &victim, bool timing)
+{
+    if (!victim.valid)
+        return;
+
+    for (unsigned i = 0; i < tags.sectorsPerLine(); i++) {
+        if (!bits(victim.dirty, i))
+            continue;
+
+        PacketPtr pkt = farPacket(victim.addr + i * tags.getSectorSize(),
+                                  MemCmd::WritebackDirty);
+        DPRINTF(DRAMCache, "Writing back %#x\n", pkt->getAddr());
+        cacheStats.writebacks++;
+        if (timing) {
+            farPort.schedTimingReq(pkt, curTick());
+        } else {
+            farPort.sendAtomic(pkt);
+            delete pkt;
+        }
+    }
+}
+
+bool
+DRAMCacheCtrl::recvTimingReq(PacketPtr pkt)
+{
+    const Addr addr = pkt->getAddr();
+    const Addr sector = tags.sectorAlign(addr);
+    panic_if(tags.sectorAlign(addr + pkt->getSize() - 1) != sector,
+             "DRAM cache requests must not cross sectors: %s\n",
+             pkt->print());
+
+    // The controller may be done with the packet by the time it returns.
+    const bool is_read = pkt->isRead();
+    const bool present = tags.contains(addr);
+    const bool pending = fills.count(sector);
+
+    // Reads of a sector being fetched wait for it too.
+    if (is_read && (!present || pending))
+        probeMisses.insert(pkt);
+
+    if (!MemCtrl::recvTimingReq(pkt)) {
+        probeMisses.erase(pkt);
+        return false;
+    }
+
+    if (is_read) {
+        if (pending)
+            cacheStats.mergedReadMisses++;
+        else if (present)
+            cacheStats.readHits++;
+        else
+            cacheStats.readMisses++;
+        // Unless the read queue had to answer already
+        if (probeMisses.count(pkt))
+            fills[sector];
+    } else {
+        if (present)
+            cacheStats.writeHits++;
+        else
+            cacheStats.writeMisses++;
+    }
+
+    writeback(tags.access(addr, !is_read), true);
+    return true;
+}
+
+void
+DRAMCacheCtrl::accessAndRespond(PacketPtr pkt, Tick static_latency,
+                                MemInterface* mem_intr)
+{
+    if (probeMisses.erase(pkt)) {
+        auto it = fills.find(tags.sectorAlign(pkt->getAddr()));
+        if (it != fills.end()) {
+            Fill &fill = it->second;
+            fill.waiting.push_back(pkt);
+            if (!fill.requested) {
+                DPRINTF(DRAMCache, "Fetching %#x\n", it->first);
+                fill.requested = true;
+                farPort.schedTimingReq(farPacket(it->first, MemCmd::ReadReq),
+                                       curTick());
+            }
+            return;
+        }
+    }
+
+    MemCtrl::accessAndRespond(pkt, static_latency, mem_intr);
+}
+
+void
+DRAMCacheCtrl::recvFarResp(PacketPtr pkt)
+{
+    const Addr sector = pkt->getAddr();
+    delete pkt;
+
+    auto it = fills.find(sector);
+    assert(it != fills.end());
+    DPRINTF(DRAMCache, "Fetched %#x for %d reads\n", sector,
+            it->second.waiting.size());
+    for (auto waiting: it->second.waiting)
+        MemCtrl::accessAndRespond(waiting, backendLatency, dram);
+    fills.erase(it);
+
+    // The DRAM holds the data already, the fill only takes the time of a
+    // write to it, unless the line was evicted in the meantime.
+    if (tags.contains(sector)) {
+        if (writeQueueFull(divCeil(tags.getSectorSize(),
+                                   dram->bytesPerBurst()))) {
+            cacheStats.droppedFills++;
+        } else {
+            cacheStats.fills++;
+            MemCtrl::recvTimingReq(farPacket(sector, MemCmd::WritebackClean));
+        }
+    }
+
+    if (drainState() == DrainState::Draining && !totalWriteQueueSize &&
+        !totalReadQueueSize && respQEmpty() && allIntfDrained()) {
+        DPRINTF(Drain, "DRAM cache controller done draining\n");
+        signalDrainDone();
+    }
+}
+
+bool
+DRAMCacheCtrl::allIntfDrained() const
+{
+    return fills.empty() && MemCtrl::allIntfDrained();
+}
+
+Tick
+DRAMCacheCtrl::recvAtomic(PacketPtr pkt)
+{
+    const Addr addr = pkt->getAddr();
+    const bool is_read = pkt->isRead();
+    const bool present = tags.contains(addr);
+
+    Tick latency = MemCtrl::recvAtomic(pkt);
+
+    if (is_read) {
+        if (present) {
+            cacheStats.readHits++;
+        } else {
+            cacheStats.readMisses++;
+            PacketPtr fetch = farPacket(tags.sectorAlign(addr),
+                                        MemCmd::ReadReq);
+            latency += farPort.sendAtomic(fetch);
+            delete fetch;
+        }
+    } else {
+        if (present)
+            cacheStats.writeHits++;
+        else
+            cacheStats.writeMisses++;
+    }
+
+    writeback(tags.access(addr, !is_read), false);
+    return latency;
+}
+
+Tick
+DRAMCacheCtrl::recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &backdoor)
+{
+    // A backdoor would bypass the tags.
+    return recvAtomic(pkt);
+}
+
+DRAMCacheCtrl::DRAMCacheStats::DRAMCacheStats(DRAMCacheCtrl &ctrl)
+    : statistics::Group(&ctrl, "cache"),
+    ADD_STAT(readHits, statistics::units::Count::get(),
+             "Number of reads which hit"),
+    ADD_STAT(readMisses, statistics::units::Count::get(),
+             "Number of reads which missed"),
+    ADD_STAT(mergedReadMisses, statistics::units::Count::get(),
+             "Number of reads of a sector already being fetched"),
+    ADD_STAT(writeHits, statistics::units::Count::get(),
+             "Number of writes which hit"),
+    ADD_STAT(writeMisses, statistics::units::Count::get(),
+             "Number of writes which allocated their line or sector"),
+    ADD_STAT(fills, statistics::units::Count::get(),
+             "Number of sectors fetched written to the DRAM"),
+    ADD_STAT(droppedFills, statistics::units::Count::get(),
+             "Number of sectors fetched not written to the DRAM as the "
+             "write queue was full"),
+    ADD_STAT(writebacks, statistics::units::Count::get(),
+             "Number of dirty sectors written back to the far memory"),
+    ADD_STAT(readHitRate, statistics::units::Ratio::get(),
+             "Fraction of the reads which hit",
+             readHits / (readHits + readMisses + mergedReadMisses))
+{
+}
+
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * DRAMCacheCtrl declaration
+ */
+
+#ifndef __MEM_DRAM_CACHE_CTRL_HH__
+#define __MEM_DRAM_CACHE_CTRL_HH__
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/dram_cache_tags.hh"
+#include "mem/mem_ctrl.hh"
+#include "mem/qport.hh"
+#include "params/DRAMCacheCtrl.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * A memory controller using its DRAM as a hardware managed cache of a
+ * larger and slower memory, such as NVM or memory behind a CXL link,
+ * reached through a request port.
+ *
+ * The DRAM interface covers the address range of the far memory and
+ * holds all its data, which keeps the functional behaviour of the
+ * controller that of a MemCtrl. The far memory only provides timing, it
+ * should be null and kept out of the address map. Every access goes to
+ * the DRAM, which for reads returns the tags along with the data like
+ * in an Alloy cache. Reads which then miss fetch their sector
+ * from the far memory, are answered once it comes back, and fill it in
+ * the DRAM. Writes allocate without fetching, as what the caches above
+ * write back is whole sectors. Dirty sectors are written back to the far
+ * memory when their line is evicted.
+ *
+ * The DRAM rows and banks are those of the far memory addresses, not of
+ * the locations of their lines in the cache.
+ */
+class DRAMCacheCtrl : public MemCtrl
+{
+  protected:
+    class FarMemPort : public QueuedRequestPort
+    {
+      public:
+        FarMemPort(const std::string &name, DRAMCacheCtrl &_ctrl);
+
+      protected:
+        bool recvTimingResp(PacketPtr pkt) override;
+        void recvRangeChange() override {}
+
+      private:
+        DRAMCacheCtrl &ctrl;
+    };
+
+    FarMemPort farPort;
+    ReqPacketQueue farReqQueue;
+    SnoopRespPacketQueue farSnoopRespQueue;
+
+    DRAMCacheTags tags;
+
+    const RequestorID requestorId;
+
+    /** Reads which missed, until their DRAM access completes. */
+    std::unordered_set<PacketPtr> probeMisses;
+
+    /** A sector being fetched from the far memory. */
+    struct Fill
+    {
+        bool requested = false;
+        /** The reads whose DRAM access completed, waiting on the fill. */
+        std::vector<PacketPtr> waiting;
+    };
+    std::unordered_map<Addr, Fill> fills;
+
+    /** Write the dirty sectors of an evicted line to the far memory. */
+    void writeback(const DRAMCacheTags::Victim &victim, bool timing);
+
+    /** Create a packet of a sector for the far memory. */
+    PacketPtr farPacket(Addr addr, MemCmd cmd) const;
+
+    void recvFarResp(PacketPtr pkt);
+
+    struct DRAMCacheStats : public statistics::Group
+    {
+        DRAMCacheStats(DRAMCacheCtrl &ctrl);
+
+        statistics::Scalar readHits;
+        statistics::Scalar readMisses;
+        statistics::Scalar mergedReadMisses;
+        statistics::Scalar writeHits;
+        statistics::Scalar writeMisses;
+        statistics::Scalar fills;
+        statistics::Scalar droppedFills;
+        statistics::Scalar writebacks;
+        statistics::Formula readHitRate;
+    };
+    DRAMCacheStats cacheStats;
+
+    void accessAndRespond(PacketPtr pkt, Tick static_latency,
+                          MemInterface* mem_intr) override;
+    bool allIntfDrained() const override;
+
+    Tick recvAtomic(PacketPtr pkt) override;
+    Tick recvAtomicBackdoor(PacketPtr pkt,
+                            MemBackdoorPtr &backdoor) override;
+    bool recvTimingReq(PacketPtr pkt) override;
+
+  public:
+    DRAMCacheCtrl(const DRAMCacheCtrlParams &p);
+
+    Port &getPort(const std::string &if_name,
+                  PortID idx=InvalidPortID) override;
+    void init() override;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_DRAM_CACHE_CTRL_HH__
@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/dram_cache_tags.hh"
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+DRAMCacheTags::DRAMCacheTags(uint64_t capacity, unsigned line_size,
+                             unsigned sector_size, unsigned _assoc,
+                             unsigned addr_bits)
+    : lineSize(line_size), sectorSize(sector_size), assoc(_assoc),
+      numSets(capacity / line_size / _assoc),
+      lineBits(floorLog2(line_size)), setBits(floorLog2(numSets)),
+      tagBits(addr_bits > lineBits + setBits ?
+              addr_bits - lineBits - setBits : 0),
+      sectorBits(line_size / sector_size),
+      rankBits(ceilLog2(_assoc)),
+      entryBits(tagBits + 2 * sectorBits + rankBits)
+{
+    fatal_if(!isPowerOf2(sector_size) || !isPowerOf2(line_size) ||
+             sector_size > line_size,
+             "DRAM cache sectors (%d bytes) and lines (%d bytes) must be "
+             "powers of two, with lines made of whole sectors.",
+             sector_size, line_size);
+    fatal_if(sectorBits > 64, "DRAM cache lines have at most 64 sectors.");
+    fatal_if(assoc == 0 || capacity % ((uint64_t)line_size * assoc) ||
+             !isPowerOf2(numSets),
+             "The DRAM cache capacity must be a power of two number of "
+             "sets of %d lines of %d bytes.", assoc, line_size);
+
+    words.resize(divCeil(storageBits(), 64));
+}
+
+uint64_t
+DRAMCacheTags::readBits(uint64_t pos, unsigned width) const
+{
+    if (!width)
+        return 0;
+    uint64_t word = pos / 64;
+    unsigned shift = pos % 64;
+    uint64_t val = words[word] >> shift;
+    if (shift + width > 64)
+        val |= words[word + 1] << (64 - shift);
+    return val & mask(width);
+}
+
+void
+DRAMCacheTags::writeBits(uint64_t pos, unsigned width, uint64_t val)
+{
+    if (!width)
+        return;
+    uint64_t word = pos / 64;
+    unsigned shift = pos % 64;
+    const uint64_t m = mask(width);
+    val &= m;
+    words[word] = (words[word] & ~(m << shift)) | (val << shift);
+    if (shift + width > 64) {
+        unsigned low = 64 - shift;
+        words[word + 1] = (words[word + 1] & ~(m >> low)) | (val >> low);
+    }
+}
+
+uint64_t
+DRAMCacheTags::getField(uint64_t set, unsigned way, Field field) const
+{
+    uint64_t pos = (set * assoc + way) * entryBits;
+    switch (field) {
+      case Tag:
+        return readBits(pos, tagBits);
+      case Valid:
+        return readBits(pos + tagBits, sectorBits);
+      case Dirty:
+        return readBits(pos + tagBits + sectorBits, sectorBits);
+      case Rank:
+        return readBits(pos + tagBits + 2 * sectorBits, rankBits);
+    }
+    return 0;
+}
+
+void
+DRAMCacheTags::setField(uint64_t set, unsigned way, Field field, uint64_t val)
+{
+    uint64_t pos = (set * assoc + way) * entryBits;
+    switch (field) {
+      case Tag:
+        writeBits(pos, tagBits, val);
+        break;
+      case Valid:
+        writeBits(pos + tagBits, sectorBits, val);
+        break;
+      case Dirty:
+        writeBits(pos + tagBits + sectorBits, sectorBits, val);
+        break;
+      case Rank:
+        writeBits(pos + tagBits + 2 * sectorBits, rankBits, val);
+        break;
+    }
+}
+
+unsigned
+DRAMCacheTags::findWay(uint64_t set, uint64_t tag) const
+{
+    for (unsigned way = 0; way < assoc; way++) {
+        if (getField(set, way, Valid) && getField(set, way, Tag) == tag)
+            return way;
+    }
+    return assoc;
+}
+
+void
+DRAMCacheTags::touch(uint64_t set, unsigned way)
+{
+    if (!rankBits)
+        return;
+    // A line just allocated is ranked after all the others.
+    uint64_t old = getField(set, way, Rank);
+    for (unsigned other = 0; other < assoc; other++) {
+        if (other == way || !getField(set, other, Valid))
+            continue;
+        uint64_t rank = getField(set, other, Rank);
+        if (rank < old)
+            setField(set, other, Rank, rank + 1);
+    }
+    setField(set, way, Rank, 0);
+}
+
+bool
+DRAMCacheTags::contains(Addr addr) const
+{
+    uint64_t line = addr >> lineBits;
+    uint64_t set = line & mask(setBits);
+    unsigned way = findWay(set, line >> setBits);
+    if (way == assoc)
+        return false;
+    unsigned sector = (addr & mask(lineBits)) / sectorSize;
+    return bits(getField(set, way, Valid), sector);
+}
+
+DRAMCacheTags::Victim
+DRAMCacheTags::access(Addr addr, bool write)
+{
+    uint64_t line = addr >> lineBits;
+    uint64_t set = line & mask(setBits);
+    uint64_t tag = line >> setBits;
+    panic_if(tag > mask(tagBits),
+             "Address %#x is out of the range of the DRAM cache tags.", addr);
+
+    Victim victim;
+    unsigned way = findWay(set, tag);
+    if (way == assoc) {
+        // Take an invalid way if there is one, the least recently used
+        // one otherwise.
+        uint64_t worst = 0;
+        for (unsigned w = 0; w < assoc; w++) {
+            if (!getField(set, w, Valid)) {
+                way = w;
+                break;
+            }
+            uint64_t rank = getField(set, w, Rank);
+            if (way == assoc || rank > worst) {
+                way = w;
+                worst = rank;
+            }
+        }
+
+        if (getField(set, way, Valid)) {
+            victim.valid = true;
+            victim.addr = ((getField(set, way, Tag) << setBits) | set) <<
+                lineBits;
+            victim.dirty = getField(set, way, Dirty);
+        }
+        setField(set, way, Tag, tag);
+        setField(set, way, Valid, 0);
+        setField(set, way, Dirty, 0);
+        setField(set, way, Rank, mask(rankBits));
+    }
+
+    uint64_t sector = 1ULL << ((addr & mask(lineBits)) / sectorSize);
+    setField(set, way, Valid, getField(set, way, Valid) | sector);
+    if (write)
+        setField(set, way, Dirty, getField(set, way, Dirty) | sector);
+    touch(set, way);
+
+    return victim;
+}
+
+} // namespace memory
+} // namespace gem5
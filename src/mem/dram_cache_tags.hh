@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_DRAM_CACHE_TAGS_HH__
+#define __MEM_DRAM_CACHE_TAGS_HH__
+
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * The tags of a DRAM cache, which are too many to afford one object per
+ * line. Each entry is packed in as few bits as the geometry allows: the
+ * tag, a valid and a dirty bit per sector, and the rank of the line in
+ * its set for LRU replacement, which takes no bits when direct mapped.
+ *
+ * Lines are the allocation unit and sectors the fetch unit. A line made
+ * of a single sector gives an Alloy cache like organisation, while
+ * larger lines with several sectors track the footprint of each line, as
+ * in footprint caches.
+ */
+class DRAMCacheTags
+{
+  public:
+    /** A line evicted to make room for another. */
+    struct Victim
+    {
+        bool valid = false;
+        Addr addr = 0;
+        /** The dirty sectors, one bit per sector. */
+        uint64_t dirty = 0;
+    };
+
+    /**
+     * @param capacity The capacity of the cache in bytes.
+     * @param line_size The allocation unit in bytes.
+     * @param sector_size The fetch unit in bytes.
+     * @param assoc The number of ways, 1 for direct mapped.
+     * @param addr_bits The number of bits of the addresses cached.
+     */
+    DRAMCacheTags(uint64_t capacity, unsigned line_size,
+                  unsigned sector_size, unsigned assoc, unsigned addr_bits);
+
+    /** Whether the sector holding an address is cached. */
+    bool contains(Addr addr) const;
+
+    /**
+     * Access an address, allocating its line and its sector if need be.
+     *
+     * @param addr The address accessed.
+     * @param write Whether the access makes the sector dirty.
+     * @return The line evicted for the allocation, if any.
+     */
+    Victim access(Addr addr, bool write);
+
+    Addr sectorAlign(Addr addr) const { return addr & ~Addr(sectorSize - 1); }
+    unsigned getSectorSize() const { return sectorSize; }
+    unsigned getLineSize() const { return lineSize; }
+    unsigned sectorsPerLine() const { return lineSize / sectorSize; }
+
+    /** The size of an entry in bits. */
+    unsigned getEntryBits() const { return entryBits; }
+
+    /** The size of the whole tag array in bits. */
+    uint64_t storageBits() const { return entryBits * numSets * assoc; }
+
+  private:
+    uint64_t readBits(uint64_t pos, unsigned width) const;
+    void writeBits(uint64_t pos, unsigned width, uint64_t val);
+
+    /** Access to the fields of the entry of a way of a set. */
+    enum Field { Tag, Valid, Dirty, Rank };
+    uint64_t getField(uint64_t set, unsigned way, Field field) const;
+    void setField(uint64_t set, unsigned way, Field field, uint64_t val);
+
+    /** The way holding a tag, or assoc if none. */
+    unsigned findWay(uint64_t set, uint64_t tag) const;
+
+    /** Make a way the most recently used of its set. */
+    void touch(uint64_t set, unsigned way);
+
+    const unsigned lineSize;
+    const unsigned sectorSize;
+    const unsigned assoc;
+    const uint64_t numSets;
+    const unsigned lineBits;
+    const unsigned setBits;
+    const unsigned tagBits;
+    const unsigned sectorBits;
+    const unsigned rankBits;
+    const unsigned entryBits;
+
+    std::vector<uint64_t> words;
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_DRAM_CACHE_TAGS_HH__
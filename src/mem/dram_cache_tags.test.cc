@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "mem/dram_cache_tags.hh"
+
+using namespace gem5;
+using namespace gem5::memory;
+
+TEST(DRAMCacheTagsTest, DirectMappedConflicts)
+{
+    // 16 lines of 64 bytes, 40 bit addresses
+    DRAMCacheTags tags(1024, 64, 64, 1, 40);
+    EXPECT_EQ(tags.getEntryBits(), 40 - 6 - 4 + 2);
+    EXPECT_EQ(tags.storageBits(), 16 * tags.getEntryBits());
+
+    EXPECT_FALSE(tags.contains(0x1000));
+    EXPECT_FALSE(tags.access(0x1000, false).valid);
+    EXPECT_TRUE(tags.contains(0x1000));
+    EXPECT_TRUE(tags.contains(0x103f));
+
+    // Same set, other tag
+    auto victim = tags.access(0x1400, true);
+    EXPECT_TRUE(victim.valid);
+    EXPECT_EQ(victim.addr, 0x1000);
+    EXPECT_EQ(victim.dirty, 0);
+    EXPECT_FALSE(tags.contains(0x1000));
+
+    victim = tags.access(0x1000, false);
+    EXPECT_TRUE(victim.valid);
+    EXPECT_EQ(victim.addr, 0x1400);
+    EXPECT_EQ(victim.dirty, 1);
+
+    // Other sets are left alone
+    EXPECT_FALSE(tags.access(0x1040, false).valid);
+    EXPECT_TRUE(tags.contains(0x1000));
+}
+
+TEST(DRAMCacheTagsTest, SetAssociativeLRU)
+{
+    // 4 sets of 4 ways
+    DRAMCacheTags tags(1024, 64, 64, 4, 32);
+    const Addr stride = 4 * 64;
+    for (int i = 0; i < 4; i++)
+        EXPECT_FALSE(tags.access(i * stride, false).valid);
+
+    // Make the first line the most recently used
+    EXPECT_FALSE(tags.access(0, false).valid);
+
+    auto victim = tags.access(4 * stride, false);
+    EXPECT_TRUE(victim.valid);
+    EXPECT_EQ(victim.addr, 1 * stride);
+
+    victim = tags.access(5 * stride, false);
+    EXPECT_TRUE(victim.valid);
+    EXPECT_EQ(victim.addr, 2 * stride);
+
+    EXPECT_TRUE(tags.contains(0));
+    EXPECT_TRUE(tags.contains(3 * stride));
+    EXPECT_TRUE(tags.contains(4 * stride));
+    EXPECT_TRUE(tags.contains(5 * stride));
+}
+
+TEST(DRAMCacheTagsTest, Sectors)
+{
+    // 4 lines of 1KiB made of 16 sectors of 64 bytes
+    DRAMCacheTags tags(4096, 1024, 64, 1, 32);
+    EXPECT_EQ(tags.sectorsPerLine(), 16);
+    EXPECT_EQ(tags.sectorAlign(0x10047), 0x10040);
+
+    tags.access(0x10040, false);
+    EXPECT_TRUE(tags.contains(0x10040));
+    EXPECT_FALSE(tags.contains(0x10000));
+    EXPECT_FALSE(tags.contains(0x10080));
+
+    tags.access(0x10100, true);
+    tags.access(0x10140, true);
+    auto victim = tags.access(0x11040, false);
+    EXPECT_TRUE(victim.valid);
+    EXPECT_EQ(victim.addr, 0x10000);
+    EXPECT_EQ(victim.dirty, 0x30);
+    EXPECT_FALSE(tags.contains(0x10100));
+    EXPECT_TRUE(tags.contains(0x11040));
+    EXPECT_FALSE(tags.contains(0x11100));
+}
+
+TEST(DRAMCacheTagsTest, EntriesAcrossWords)
+{
+    // Entries of 23 bits, many of which straddle two words
+    DRAMCacheTags tags(1 << 20, 64, 64, 2, 36);
+    EXPECT_EQ(tags.getEntryBits(), 36 - 6 - 13 + 2 + 1);
+
+    const Addr set_stride = 64;
+    const Addr way_stride = (1 << 13) * 64;
+    for (Addr set = 0; set < (1 << 13); set++) {
+        tags.access(set * set_stride, (set % 3) == 0);
+        tags.access(set * set_stride + way_stride, false);
+    }
+    for (Addr set = 0; set < (1 << 13); set++) {
+        ASSERT_TRUE(tags.contains(set * set_stride));
+        ASSERT_TRUE(tags.contains(set * set_stride + way_stride));
+        ASSERT_FALSE(tags.contains(set * set_stride + 2 * way_stride));
+    }
+    for (Addr set = 0; set < (1 << 13); set++) {
+        auto victim = tags.access(set * set_stride + 2 * way_stride, false);
+        ASSERT_TRUE(victim.valid);
+        ASSERT_EQ(victim.addr, set * set_stride);
+        ASSERT_EQ(victim.dirty, (set % 3) == 0 ? 1 : 0);
+    }
+}
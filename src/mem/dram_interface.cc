@@ -59,30 +59,23 @@ namespace memory
 std::pair<MemPacketQueue::iterator, Tick>
 DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
 {
-    std::vector<uint32_t> earliest_banks(ranksPerChannel, 0);
-
-    // Has minBankPrep been called to populate earliest_banks?
-    bool filled_earliest_banks = false;
-    // can the PRE/ACT sequence be done without impacting utlization?
-    bool hidden_bank_prep = false;
-
     // search for seamless row hits first, if no seamless row hit is
     // found then determine if there are other packets that can be issued
     // without incurring additional bus delay due to bank timing
     // Will select closed rows first to enable more open row possibilies
-    // in future selections
-    bool found_hidden_bank = false;
-
-    // remember if we found a row hit, not seamless, but bank prepped
+    // in future selections. A single pass over the queue records, per
+    // bank, whether requests are waiting and the first one that misses
+    // the open row, so that the bank timing can be evaluated afterwards
+    // without going through the queue again
+    const size_t num_banks = ranksPerChannel * banksPerRank;
+    bankWaiting.assign(num_banks, false);
+    bankFirstMiss.assign(num_banks, queue.end());
+    bool found_miss = false;
+
+    // remember the first row hit, not seamless, but bank prepped
     // and ready
-    bool found_prepped_pkt = false;
-
-    // if we have no row hit, prepped or not, and no seamless packet,
-    // just go for the earliest possible
-    bool found_earliest_pkt = false;
-
-    Tick selected_col_at = MaxTick;
-    auto selected_pkt_it = queue.end();
+    auto prepped_pkt_it = queue.end();
+    Tick prepped_col_at = MaxTick;
 
     for (auto i = queue.begin(); i != queue.end() ; ++i) {
         MemPacket* pkt = *i;
@@ -104,6 +97,8 @@ DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
                         "%s bank %d - Rank %d available\n", __func__,
                         pkt->bank, pkt->rank);
 
+                bankWaiting[pkt->bankId] = true;
+
                 // check if it is a row hit
                 if (bank.openRow == pkt->row) {
                     // no additional rank-to-rank or same bank-group
@@ -115,47 +110,16 @@ DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
                         // additional delay, such as same rank accesses
                         // and/or different bank-group accesses
                         DPRINTF(DRAM, "%s Seamless buffer hit\n", __func__);
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
                         // no need to look through the remaining queue entries
-                        break;
-                    } else if (!found_hidden_bank && !found_prepped_pkt) {
-                        // if we did not find a packet to a closed row that can
-                        // issue the bank commands without incurring delay, and
-                        // did not yet find a packet to a prepped row, remember
-                        // the current one
-                        selected_pkt_it = i;
-                        selected_col_at = col_allowed_at;
-                        found_prepped_pkt = true;
+                        return std::make_pair(i, col_allowed_at);
+                    } else if (prepped_pkt_it == queue.end()) {
+                        prepped_pkt_it = i;
+                        prepped_col_at = col_allowed_at;
                         DPRINTF(DRAM, "%s Prepped row buffer hit\n", __func__);
                     }
-                } else if (!found_earliest_pkt) {
-                    // if we have not initialised the bank status, do it
-                    // now, and only once per scheduling decisions
-                    if (!filled_earliest_banks) {
-                        // determine entries with earliest bank delay
-                        std::tie(earliest_banks, hidden_bank_prep) =
-                            minBankPrep(queue, min_col_at);
-                        filled_earliest_banks = true;
-                    }
-
-                    // bank is amongst first available banks
-                    // minBankPrep will give priority to packets that can
-                    // issue seamlessly
-                    if (bits(earliest_banks[pkt->rank],
-                             pkt->bank, pkt->bank)) {
-                        found_earliest_pkt = true;
-                        found_hidden_bank = hidden_bank_prep;
-
-                        // give priority to packets that can issue
-                        // bank commands 'behind the scenes'
-                        // any additional delay if any will be due to
-                        // col-to-col command requirements
-                        if (hidden_bank_prep || !found_prepped_pkt) {
-                            selected_pkt_it = i;
-                            selected_col_at = col_allowed_at;
-                        }
-                    }
+                } else if (bankFirstMiss[pkt->bankId] == queue.end()) {
+                    bankFirstMiss[pkt->bankId] = i;
+                    found_miss = true;
                 }
             } else {
                 DPRINTF(DRAM, "%s bank %d - Rank %d not available\n", __func__,
@@ -164,6 +128,43 @@ DRAMInterface::chooseNextFRFCFS(MemPacketQueue& queue, Tick min_col_at) const
         }
     }
 
+    auto selected_pkt_it = prepped_pkt_it;
+    Tick selected_col_at = prepped_col_at;
+
+    if (found_miss) {
+        // determine entries with earliest bank delay; minBankPrep will
+        // give priority to banks that can issue seamlessly
+        const auto [earliest_banks, hidden_bank_prep] =
+            minBankPrep(bankWaiting, min_col_at);
+
+        // the first packet in the queue to a row that is not open in one
+        // of the earliest banks
+        auto earliest_pkt_it = queue.end();
+        for (int r = 0; r < ranksPerChannel; r++) {
+            if (!earliest_banks[r])
+                continue;
+            for (int b = 0; b < banksPerRank; b++) {
+                auto it = bankFirstMiss[r * banksPerRank + b];
+                if (bits(earliest_banks[r], b, b) && it != queue.end() &&
+                    (earliest_pkt_it == queue.end() || it < earliest_pkt_it)) {
+                    earliest_pkt_it = it;
+                }
+            }
+        }
+
+        // give priority to packets that can issue bank commands 'behind
+        // the scenes' over prepped row hits; any additional delay if any
+        // will be due to col-to-col command requirements
+        if (earliest_pkt_it != queue.end() &&
+            (hidden_bank_prep || selected_pkt_it == queue.end())) {
+            const MemPacket* pkt = *earliest_pkt_it;
+            const Bank& bank = ranks[pkt->rank]->banks[pkt->bank];
+            selected_pkt_it = earliest_pkt_it;
+            selected_col_at = pkt->isRead() ? bank.rdAllowedAt :
+                                              bank.wrAllowedAt;
+        }
+    }
+
     if (selected_pkt_it == queue.end()) {
         DPRINTF(DRAM, "%s no available DRAM ranks found\n", __func__);
     }
@@ -657,6 +658,7 @@ DRAMInterface::DRAMInterface(const DRAMInterfaceParams &_p)
       maxAccessesPerRow(_p.max_accesses_per_row),
       timeStampOffset(0), activeRank(0),
       enableDRAMPowerdown(_p.enable_dram_powerdown),
+      powerdownWhenIdle(_p.powerdown_when_idle),
       lastStatsResetTick(0),
       stats(*this)
 {
@@ -793,6 +795,14 @@ DRAMInterface::startup()
     }
 }
 
+bool
+DRAMInterface::powerdownAllowed() const
+{
+    return enableDRAMPowerdown ||
+        (powerdownWhenIdle && system() &&
+         system()->threads.numActive() == 0);
+}
+
 bool
 DRAMInterface::isBusy(bool read_queue_empty, bool all_writes_nvm)
 {
@@ -953,7 +963,7 @@ DRAMInterface::respondEvent(uint8_t rank)
     // track if this is the last packet before idling
     // and that there are no outstanding commands to this rank
     if (rank_ref.isQueueEmpty() && rank_ref.outstandingEvents == 0 &&
-        rank_ref.inRefIdleState() && enableDRAMPowerdown) {
+        rank_ref.inRefIdleState() && powerdownAllowed()) {
         // verify that there are no events scheduled
         assert(!rank_ref.activateEvent.scheduled());
         assert(!rank_ref.prechargeEvent.scheduled());
@@ -1025,7 +1035,7 @@ DRAMInterface::suspend()
 }
 
 std::pair<std::vector<uint32_t>, bool>
-DRAMInterface::minBankPrep(const MemPacketQueue& queue,
+DRAMInterface::minBankPrep(const std::vector<bool>& got_waiting,
                       Tick min_col_at) const
 {
     Tick min_act_at = MaxTick;
@@ -1038,16 +1048,6 @@ DRAMInterface::minBankPrep(const MemPacketQueue& queue,
     // delay on the data bus
     bool hidden_bank_prep = false;
 
-    // determine if we have queued transactions targetting the
-    // bank in question
-    std::vector<bool> got_waiting(ranksPerChannel * banksPerRank, false);
-    for (const auto& p : queue) {
-        if (p->pseudoChannel != pseudoChannel)
-            continue;
-        if (p->isDram() && ranks[p->rank]->inRefIdleState())
-            got_waiting[p->bankId] = true;
-    }
-
     // Find command with optimal bank timing
     // Will prioritize commands that can issue seamlessly.
     for (int i = 0; i < ranksPerChannel; i++) {
@@ -1256,7 +1256,7 @@ DRAMInterface::Rank::processPrechargeEvent()
         // no reads to this rank in the Q and no pending
         // RD/WR or refresh commands
         if (isQueueEmpty() && outstandingEvents == 0 &&
-            dram.enableDRAMPowerdown) {
+            dram.powerdownAllowed()) {
             // should still be in ACT state since bank still open
             assert(pwrState == PWR_ACT);
 
@@ -1460,7 +1460,7 @@ DRAMInterface::Rank::processRefreshEvent()
 
             // Force PRE power-down if there are no outstanding commands
             // in Q after refresh.
-            } else if (isQueueEmpty() && dram.enableDRAMPowerdown) {
+            } else if (isQueueEmpty() && dram.powerdownAllowed()) {
                 // still have refresh event outstanding but there should
                 // be no other events outstanding
                 assert(outstandingEvents == 1);
@@ -1732,7 +1732,7 @@ DRAMInterface::Rank::processPowerEvent()
         if (pwrStatePostRefresh == PWR_PRE_PDN && isQueueEmpty() &&
            (dram.ctrl->drainState() != DrainState::Draining) &&
            (dram.ctrl->drainState() != DrainState::Drained) &&
-           dram.enableDRAMPowerdown) {
+           dram.powerdownAllowed()) {
             DPRINTF(DRAMState, "Rank %d bypassing refresh and transitioning "
                     "to self refresh at %11u tick\n", rank, curTick());
             powerDownSleep(PWR_SREF, curTick());
@@ -390,7 +390,7 @@ class DRAMInterface : public MemInterface
             // If powerdown is not enabled, then the ranks never go to idle
             // states. In that case return true here to prevent checkpointing
             // from getting stuck waiting for DRAM to be idle.
-            if (!dram.enableDRAMPowerdown) {
+            if (!dram.enableDRAMPowerdown && !dram.powerdownWhenIdle) {
                 return true;
             }
 
@@ -548,6 +548,18 @@ class DRAMInterface : public MemInterface
     /** Enable or disable DRAM powerdown states. */
     bool enableDRAMPowerdown;
 
+    /**
+     * Enable the powerdown states only while no thread of the system is
+     * active, so that idle ranks go to self-refresh instead of waking the
+     * simulation up for every refresh.
+     */
+    bool powerdownWhenIdle;
+
+    /**
+     * Whether the ranks may go to the powerdown states now.
+     */
+    bool powerdownAllowed() const;
+
     /** The time when stats were last reset used to calculate average power */
     Tick lastStatsResetTick;
 
@@ -645,13 +657,23 @@ class DRAMInterface : public MemInterface
      * for the enqueued requests. Assumes maximum of 32 banks per rank
      * Also checks if the bank is already prepped.
      *
-     * @param queue Queued requests to consider
+     * @param got_waiting Whether requests that can issue are queued for
+     *                    each bank, indexed by bank id
      * @param min_col_at time of seamless burst command
      * @return One-hot encoded mask of bank indices
      * @return boolean indicating burst can issue seamlessly, with no gaps
      */
     std::pair<std::vector<uint32_t>, bool>
-    minBankPrep(const MemPacketQueue& queue, Tick min_col_at) const;
+    minBankPrep(const std::vector<bool>& got_waiting, Tick min_col_at) const;
+
+    /**
+     * Scratch state of chooseNextFRFCFS, kept across calls to avoid
+     * reallocating it for every scheduling decision: whether requests
+     * that can issue are queued for each bank, and the first of them
+     * that misses the open row.
+     */
+    mutable std::vector<bool> bankWaiting;
+    mutable std::vector<MemPacketQueue::iterator> bankFirstMiss;
 
     /*
      * @return time to send a burst of data without gaps
@@ -36,10 +36,10 @@
 
 #include <deque>
 #include <string>
-#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "mem/burst_window.hh"
 #include "mem/mem_ctrl.hh"
 #include "params/HBMCtrl.hh"
 
@@ -177,14 +177,14 @@ class HBMCtrl : public MemCtrl
      * defined Tick. This is used to ensure that the row command bandwidth
      * does not exceed the allowable media constraints.
      */
-    std::unordered_multiset<Tick> rowBurstTicks;
+    BurstWindowCounts rowBurstTicks;
 
     /**
      * This is used to ensure that the column command bandwidth
      * does not exceed the allowable media constraints. HBM2 has separate
      * command bus for row and column commands
      */
-    std::unordered_multiset<Tick> colBurstTicks;
+    BurstWindowCounts colBurstTicks;
 
     /**
      * Pointers to interfaces of the two pseudo channels
@@ -38,16 +38,15 @@
 #ifndef __MEM_MEM_CHECKER_HH__
 #define __MEM_MEM_CHECKER_HH__
 
+#include <array>
 #include <cassert>
 #include <cstdint>
-#include <list>
-#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 #include "base/cprintf.hh"
-#include "base/named.hh"
 #include "base/trace.hh"
 #include "base/types.hh"
 #include "debug/MemChecker.hh"
@@ -100,6 +99,11 @@ class MemChecker : public SimObject
      */
     static const uint8_t DATA_INITIAL   = 0x00;
 
+    /**
+     * Size of the blocks the ByteTrackers are grouped by, see LineTracker.
+     */
+    static const Addr    LINE_SIZE      = 64;
+
     /**
      * The Transaction class captures the lifetimes of read and write
      * operations, and the values they consumed or produced respectively.
@@ -129,7 +133,7 @@ class MemChecker : public SimObject
         uint8_t data;
 
         /**
-         * Orders Transactions for use with std::map.
+         * Orders Transactions by serial.
          */
         bool operator<(const Transaction& rhs) const
         { return serial < rhs.serial; }
@@ -184,31 +188,44 @@ class MemChecker : public SimObject
         Tick complete;  //!< Completion of last write in cluster
 
         /**
-         * Map of Serial --> Transaction of all writes in cluster; contains
-         * all, in-flight or already completed.
+         * All writes in cluster, in-flight or already completed, in the
+         * order they started. Clusters rarely hold more than a few writes,
+         * so they are looked up by serial with a linear search.
          */
-        std::unordered_map<Serial, Transaction> writes;
+        std::vector<Transaction> writes;
 
       private:
+        /**
+         * @return Iterator to the write with the given serial, or
+         *         writes.end() if there is none.
+         */
+        std::vector<Transaction>::iterator findWrite(Serial serial);
+
         Tick completeMax;
         size_t numIncomplete;
     };
 
-    typedef std::list<Transaction> TransactionList;
-    typedef std::list<WriteCluster> WriteClusterList;
+    /**
+     * These are only pruned at the front and appended to at the back, and
+     * stay short, so vectors beat lists on both space and time.
+     */
+    typedef std::vector<Transaction> TransactionList;
+    typedef std::vector<WriteCluster> WriteClusterList;
 
     /**
      * The ByteTracker keeps track of transactions for the *same byte* -- all
      * outstanding reads, the completed reads (and what they observed) and write
      * clusters (see WriteCluster).
+     *
+     * There is one of these per byte ever accessed, so its name is only
+     * built when it is needed for debug output.
      */
-    class ByteTracker : public Named
+    class ByteTracker
     {
       public:
 
         ByteTracker(Addr addr = 0, const MemChecker *parent = NULL)
-            : Named((parent != NULL ? parent->name() : "") +
-                     csprintf(".ByteTracker@%#llx", addr))
+            : addr(addr), parent(parent)
         {
             // The initial transaction has start == complete == TICK_INITIAL,
             // indicating that there has been no real write to this location;
@@ -218,6 +235,13 @@ class MemChecker : public SimObject
                                 DATA_INITIAL));
         }
 
+        std::string
+        name() const
+        {
+            return (parent != NULL ? parent->name() : "") +
+                csprintf(".ByteTracker@%#llx", addr);
+        }
+
         /**
          * Starts a read transaction.
          *
@@ -347,14 +371,18 @@ class MemChecker : public SimObject
         void pruneTransactions();
 
       private:
+        /** Location tracked, for name(). */
+        Addr addr;
+        const MemChecker *parent;
 
         /**
-         * Maintains a map of Serial -> Transaction for all outstanding reads.
+         * All outstanding reads, sorted by serial.
          *
-         * Use an ordered map here, as this makes pruneTransactions() more
+         * Serials are handed out in increasing order, so reads are almost
+         * always appended. Keeping them sorted makes pruneTransactions()
          * efficient (find first outstanding read).
          */
-        std::map<Serial, Transaction> outstandingReads;
+        TransactionList outstandingReads;
 
         /**
          * List of completed reads, i.e. observations of reads.
@@ -452,7 +480,7 @@ class MemChecker : public SimObject
      * the reset with serial S.
      */
     void reset()
-    { byte_trackers.clear(); }
+    { lineTrackers.clear(); }
 
     /**
      * Resets an address-range. This may be useful in case other unmonitored
@@ -477,18 +505,24 @@ class MemChecker : public SimObject
 
   private:
     /**
-     * Returns the instance of ByteTracker for the requested location.
+     * The ByteTrackers of the bytes of a LINE_SIZE aligned block, created
+     * as the bytes get accessed.
      */
-    ByteTracker* getByteTracker(Addr addr)
+    struct LineTracker
     {
-        auto it = byte_trackers.find(addr);
-        if (it == byte_trackers.end()) {
-            it = byte_trackers.insert(
-                std::make_pair(addr, ByteTracker(addr, this))).first;
-        }
-        return &it->second;
+        std::array<std::unique_ptr<ByteTracker>, LINE_SIZE> bytes;
+        /** Number of bytes with a tracker. */
+        unsigned numBytes = 0;
     };
 
+    /**
+     * Calls f(tracker, i) with the ByteTracker of each location addr + i of
+     * the requested range, creating the missing ones. The trackers are
+     * looked up once per line rather than once per byte.
+     */
+    template <typename F>
+    void forEachByteTracker(Addr addr, size_t size, F f);
+
   private:
     /**
      * Detailed error message of the last violation in completeRead.
@@ -502,7 +536,7 @@ class MemChecker : public SimObject
     Serial nextSerial;
 
     /**
-     * Maintain a map of address --> byte-tracker. Per-byte entries are
+     * Maintain a map of line address --> line-tracker. Per-byte entries are
      * initialized as needed.
      *
      * The required space for this obviously grows with the number of distinct
@@ -510,11 +544,33 @@ class MemChecker : public SimObject
      * the number of nodes in the system, those may affect the size of per-byte
      * tracking information.
      *
-     * Access via getByteTracker()!
+     * Access via forEachByteTracker()!
      */
-    std::unordered_map<Addr, ByteTracker> byte_trackers;
+    std::unordered_map<Addr, LineTracker> lineTrackers;
 };
 
+template <typename F>
+inline void
+MemChecker::forEachByteTracker(Addr addr, size_t size, F f)
+{
+    size_t i = 0;
+    while (i < size) {
+        const Addr line_addr = (addr + i) & ~(LINE_SIZE - 1);
+        LineTracker &line = lineTrackers[line_addr];
+
+        for (Addr offset = addr + i - line_addr;
+             offset < LINE_SIZE && i < size; ++offset, ++i) {
+            std::unique_ptr<ByteTracker> &tracker = line.bytes[offset];
+            if (!tracker) {
+                tracker = std::make_unique<ByteTracker>(line_addr + offset,
+                                                        this);
+                ++line.numBytes;
+            }
+            f(*tracker, i);
+        }
+    }
+}
+
 inline MemChecker::Serial
 MemChecker::startRead(Tick start, Addr addr, size_t size)
 {
@@ -522,9 +578,10 @@ MemChecker::startRead(Tick start, Addr addr, size_t size)
             "starting read: serial = %d, start = %d, addr = %#llx, "
             "size = %d\n", nextSerial, start, addr , size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->startRead(nextSerial, start);
-    }
+    forEachByteTracker(addr, size, [this, start](ByteTracker &tracker,
+                                                 size_t i) {
+        tracker.startRead(nextSerial, start);
+    });
 
     return nextSerial++;
 }
@@ -536,9 +593,10 @@ MemChecker::startWrite(Tick start, Addr addr, size_t size, const uint8_t *data)
             "starting write: serial = %d, start = %d, addr = %#llx, "
             "size = %d\n", nextSerial, start, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->startWrite(nextSerial, start, data[i]);
-    }
+    forEachByteTracker(addr, size, [this, start, data](ByteTracker &tracker,
+                                                       size_t i) {
+        tracker.startWrite(nextSerial, start, data[i]);
+    });
 
     return nextSerial++;
 }
@@ -551,9 +609,10 @@ MemChecker::completeWrite(MemChecker::Serial serial, Tick complete,
             "completing write: serial = %d, complete = %d, "
             "addr = %#llx, size = %d\n", serial, complete, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->completeWrite(serial, complete);
-    }
+    forEachByteTracker(addr, size, [serial, complete](ByteTracker &tracker,
+                                                      size_t i) {
+        tracker.completeWrite(serial, complete);
+    });
 }
 
 inline void
@@ -563,9 +622,9 @@ MemChecker::abortWrite(MemChecker::Serial serial, Addr addr, size_t size)
             "aborting write: serial = %d, addr = %#llx, size = %d\n",
             serial, addr, size);
 
-    for (size_t i = 0; i < size; ++i) {
-        getByteTracker(addr + i)->abortWrite(serial);
-    }
+    forEachByteTracker(addr, size, [serial](ByteTracker &tracker, size_t i) {
+        tracker.abortWrite(serial);
+    });
 }
 
 } // namespace gem5
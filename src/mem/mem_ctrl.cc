@@ -65,6 +65,7 @@ MemCtrl::MemCtrl(const MemCtrlParams &p) :
                          respondEvent, nextReqEvent, retryWrReq);}, name()),
     respondEvent([this] {processRespondEvent(dram, respQueue,
                          respondEvent, retryRdReq); }, name()),
+    burstTicks(p.command_window),
     dram(p.dram),
     readBufferSize(dram->readBufferSize),
     writeBufferSize(dram->writeBufferSize),
@@ -121,6 +122,15 @@ MemCtrl::startup()
     }
 }
 
+void
+MemCtrl::regProbePoints()
+{
+    qos::MemCtrl::regProbePoints();
+
+    ppAccessLatency.reset(
+        new probing::AccessLatency(getProbeManager(), "AccessLatency"));
+}
+
 Tick
 MemCtrl::recvAtomic(PacketPtr pkt)
 {
@@ -661,14 +671,7 @@ MemCtrl::accessAndRespond(PacketPtr pkt, Tick static_latency,
 void
 MemCtrl::pruneBurstTick()
 {
-    auto it = burstTicks.begin();
-    while (it != burstTicks.end()) {
-        auto current_it = it++;
-        if (curTick() > *current_it) {
-            DPRINTF(MemCtrl, "Removing burstTick for %d\n", *current_it);
-            burstTicks.erase(current_it);
-        }
-    }
+    burstTicks.prune(curTick());
 }
 
 Tick
@@ -831,6 +834,15 @@ MemCtrl::doBurstAccess(MemPacket* mem_pkt, MemInterface* mem_intr)
             mem_pkt->readyTime - mem_pkt->entryTime;
     }
 
+    // The packet of a write may already be gone, so only use the
+    // fields kept in the burst.
+    ppAccessLatency->notifyWith([&]() {
+        return probing::AccessLatencyInfo{
+            mem_pkt->addr, mem_pkt->size, mem_pkt->isRead(),
+            mem_pkt->requestorId(), 0,
+            mem_pkt->readyTime - mem_pkt->entryTime };
+    });
+
     return cmd_at;
 }
 
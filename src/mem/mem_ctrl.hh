@@ -55,10 +55,12 @@
 #include "base/callback.hh"
 #include "base/statistics.hh"
 #include "enums/MemSched.hh"
+#include "mem/burst_window.hh"
 #include "mem/qos/mem_ctrl.hh"
 #include "mem/qport.hh"
 #include "params/MemCtrl.hh"
 #include "sim/eventq.hh"
+#include "sim/probe/mem.hh"
 
 namespace gem5
 {
@@ -496,7 +498,7 @@ class MemCtrl : public qos::MemCtrl
      * defined Tick. This is used to ensure that the command bandwidth
      * does not exceed the allowable media constraints.
      */
-    std::unordered_multiset<Tick> burstTicks;
+    BurstWindowCounts burstTicks;
 
     /**
 +    * Create pointer to interface of the actual memory media when connected
@@ -621,6 +623,9 @@ class MemCtrl : public qos::MemCtrl
 
     CtrlStats stats;
 
+    /** Bursts issued, with the ticks from their arrival to readiness */
+    probing::AccessLatencyUPtr ppAccessLatency;
+
     /**
      * Upstream caches need this packet until true is returned, so
      * hold it for deletion until a subsequent call
@@ -778,6 +783,7 @@ class MemCtrl : public qos::MemCtrl
     virtual void init() override;
     virtual void startup() override;
     virtual void drainResume() override;
+    void regProbePoints() override;
 
   protected:
 
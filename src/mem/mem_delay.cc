@@ -37,6 +37,10 @@
 
 #include "mem/mem_delay.hh"
 
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "params/CXLLink.hh"
 #include "params/MemDelay.hh"
 #include "params/SimpleMemDelay.hh"
 
@@ -212,4 +216,40 @@ SimpleMemDelay::delayResp(PacketPtr pkt)
     }
 }
 
+
+CXLLink::CXLLink(const CXLLinkParams &p)
+    : MemDelay(p),
+      latency(p.latency),
+      ticksPerByte(p.bandwidth),
+      flitSize(p.flit_size),
+      flitPayload(p.flit_payload)
+{
+    fatal_if(!flitPayload || flitPayload > flitSize,
+             "%s: the flit payload must fit in a flit.", name());
+}
+
+Tick
+CXLLink::transfer(unsigned data_size, Tick &free_at)
+{
+    unsigned flits = 1 + divCeil(data_size, flitPayload);
+    Tick start = std::max(curTick(), free_at);
+    free_at = start + flits * flitSize * ticksPerByte;
+    return free_at - curTick() + latency;
+}
+
+Tick
+CXLLink::delayReq(PacketPtr pkt)
+{
+    return transfer(pkt->isWrite() ? pkt->getSize() : 0, reqFreeAt);
+}
+
+Tick
+CXLLink::delayResp(PacketPtr pkt)
+{
+    // Atomic accesses pass the request, which may not need a response.
+    if (!pkt->isResponse() && !pkt->needsResponse())
+        return 0;
+    return transfer(pkt->isRead() ? pkt->getSize() : 0, respFreeAt);
+}
+
 } // namespace gem5
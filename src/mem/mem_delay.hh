@@ -44,6 +44,7 @@
 namespace gem5
 {
 
+struct CXLLinkParams;
 struct MemDelayParams;
 struct SimpleMemDelayParams;
 
@@ -180,6 +181,40 @@ class SimpleMemDelay : public MemDelay
     const Tick writeRespDelay;
 };
 
+/**
+ * Delay packets by the time a CXL link takes to carry them. Each message
+ * takes a flit for its header and as many flits as its data needs, which
+ * are serialized behind those of the previous messages going the same
+ * way, and then the latency of the link.
+ */
+class CXLLink : public MemDelay
+{
+  public:
+    CXLLink(const CXLLinkParams &params);
+
+  protected:
+    Tick delayReq(PacketPtr pkt) override;
+    Tick delayResp(PacketPtr pkt) override;
+
+    /**
+     * Carry a message across one direction of the link.
+     *
+     * @param data_size The size of the data the message carries.
+     * @param free_at When that direction of the link is free, updated.
+     * @return The time until the message is across.
+     */
+    Tick transfer(unsigned data_size, Tick &free_at);
+
+  protected: // Params
+    const Tick latency;
+    const double ticksPerByte;
+    const unsigned flitSize;
+    const unsigned flitPayload;
+
+    Tick reqFreeAt = 0;
+    Tick respFreeAt = 0;
+};
+
 } // namespace gem5
 
 #endif //__MEM_MEM_DELAY_HH__
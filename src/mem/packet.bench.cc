@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Micro-benchmarks of the life cycle of the packets of a memory access:
+ * creating the request and the packet, allocating and filling the data
+ * and turning the packet into a response.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+
+#include "mem/packet.hh"
+#include "mem/request.hh"
+#include "sim/cur_tick.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Requests are stamped with the current tick, there is no event queue. */
+Tick benchTick = 0;
+
+/**
+ * A read: the data is allocated by the packet and filled by the responder.
+ * Argument: size of the access.
+ */
+void
+PacketReadLifeCycle(benchmark::State &state)
+{
+    const unsigned size = state.range(0);
+    std::array<uint8_t, 64> data{};
+    Addr addr = 0;
+    Gem5Internal::_curTickPtr = &benchTick;
+
+    for (auto _ : state) {
+        auto req = std::make_shared<Request>(addr, size, 0, 0);
+        PacketPtr pkt = new Packet(req, MemCmd::ReadReq);
+        pkt->allocate();
+        pkt->makeResponse();
+        pkt->setData(data.data());
+        benchmark::DoNotOptimize(pkt->getConstPtr<uint8_t>());
+        delete pkt;
+        addr += 64;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(PacketReadLifeCycle)->Arg(8)->Arg(64);
+
+/**
+ * A write: the packet points to the data of the requestor.
+ * Argument: size of the access.
+ */
+void
+PacketWriteLifeCycle(benchmark::State &state)
+{
+    const unsigned size = state.range(0);
+    std::array<uint8_t, 64> data{};
+    Addr addr = 0;
+    Gem5Internal::_curTickPtr = &benchTick;
+
+    for (auto _ : state) {
+        auto req = std::make_shared<Request>(addr, size, 0, 0);
+        PacketPtr pkt = new Packet(req, MemCmd::WriteReq);
+        pkt->dataStatic(data.data());
+        pkt->makeResponse();
+        benchmark::DoNotOptimize(pkt);
+        delete pkt;
+        addr += 64;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(PacketWriteLifeCycle)->Arg(8)->Arg(64);
+
+} // anonymous namespace
@@ -58,6 +58,7 @@
 #include "base/extensible.hh"
 #include "base/flags.hh"
 #include "base/logging.hh"
+#include "base/pool_alloc.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
 #include "mem/htm.hh"
@@ -360,7 +361,12 @@ class Packet : public Printable, public Extensible<Packet>
 
         // Signal block present to squash prefetch and cache evict packets
         // through express snoop flag
-        BLOCK_CACHED          = 0x00010000
+        BLOCK_CACHED          = 0x00010000,
+
+        // Set on the writebacks of tag-only caches, whose data is already
+        // in memory. The memory must not write the data of the packet,
+        // which may be older than what it has.
+        DATA_IN_MEMORY        = 0x00020000
     };
 
     Flags flags;
@@ -396,6 +402,15 @@ class Packet : public Printable, public Extensible<Packet>
     /// The size of the request or transfer.
     unsigned size;
 
+    /**
+     * Storage for payloads of up to InlineDataSize bytes, which saves
+     * allocate() a trip to the heap for the common case of accesses of
+     * up to a cache line. The data pointer then points here, and the
+     * packet is marked as having dynamic data as usual.
+     */
+    static constexpr unsigned InlineDataSize = 64;
+    alignas(8) uint8_t inlineData[InlineDataSize];
+
     /**
      * Track the bytes found that satisfy a functional read.
      */
@@ -759,6 +774,8 @@ class Packet : public Printable, public Extensible<Packet>
     void setBlockCached()          { flags.set(BLOCK_CACHED); }
     bool isBlockCached() const     { return flags.isSet(BLOCK_CACHED); }
     void clearBlockCached()        { flags.clear(BLOCK_CACHED); }
+    void setDataInMemory()         { flags.set(DATA_IN_MEMORY); }
+    bool dataInMemory() const      { return flags.isSet(DATA_IN_MEMORY); }
 
     /**
      * QoS Value getter
@@ -1054,6 +1071,23 @@ class Packet : public Printable, public Extensible<Packet>
         deleteData();
     }
 
+    /**
+     * Packets are created and destroyed for every memory access, so
+     * they are allocated from per-thread pools rather than from the
+     * global heap.
+     */
+    static void *
+    operator new(std::size_t size)
+    {
+        return PoolAllocator::allocate(size);
+    }
+
+    static void
+    operator delete(void *ptr, std::size_t size)
+    {
+        PoolAllocator::deallocate(ptr, size);
+    }
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1355,7 +1389,7 @@ class Packet : public Printable, public Extensible<Packet>
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(DYNAMIC_DATA) && data != inlineData)
             delete [] data;
 
         flags.clear(STATIC_DATA|DYNAMIC_DATA);
@@ -1371,7 +1405,10 @@ class Packet : public Printable, public Extensible<Packet>
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
             flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= InlineDataSize)
+                data = inlineData;
+            else
+                data = new uint8_t[getSize()];
         }
     }
 
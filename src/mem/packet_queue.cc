@@ -131,6 +131,20 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
     // ourselves again before we had a chance to update waitingOnRetry
     // assert(waitingOnRetry || sendEvent.scheduled());
 
+    // most packets are ready after all the queued ones, so check the
+    // tail first, and then the head, which is only possible if we are
+    // not forced to keep the order of the packets to the same address
+    if (!transmitList.empty() && transmitList.back().tick <= when) {
+        insertPacket(transmitList.end(), when, pkt);
+        return;
+    }
+    if (transmitList.empty() ||
+        (!forceOrder && when < transmitList.front().tick)) {
+        insertPacket(transmitList.begin(), when, pkt);
+        schedSendEvent(when);
+        return;
+    }
+
     // this belongs in the middle somewhere, so search from the end to
     // order by tick; however, if forceOrder is set, also make sure
     // not to re-order in front of some existing packet with the same
@@ -139,18 +153,36 @@ PacketQueue::schedSendTiming(PacketPtr pkt, Tick when)
     while (it != transmitList.begin()) {
         --it;
         if ((forceOrder && it->pkt->matchAddr(pkt)) || it->tick <= when) {
-            // emplace inserts the element before the position pointed to by
+            // insert the element before the position pointed to by
             // the iterator, so advance it one step
-            transmitList.emplace(++it, when, pkt);
+            insertPacket(++it, when, pkt);
             return;
         }
     }
-    // either the packet list is empty or this has to be inserted
-    // before every other packet
-    transmitList.emplace_front(when, pkt);
+    // this has to be inserted before every other packet
+    insertPacket(transmitList.begin(), when, pkt);
     schedSendEvent(when);
 }
 
+void
+PacketQueue::insertPacket(DeferredPacketList::iterator pos, Tick when,
+                          PacketPtr pkt)
+{
+    if (freeList.empty()) {
+        transmitList.emplace(pos, when, pkt);
+    } else {
+        freeList.front().tick = when;
+        freeList.front().pkt = pkt;
+        transmitList.splice(pos, freeList, freeList.begin());
+    }
+}
+
+void
+PacketQueue::popPacket()
+{
+    freeList.splice(freeList.begin(), transmitList, transmitList.begin());
+}
+
 void
 PacketQueue::schedSendEvent(Tick when)
 {
@@ -201,7 +233,7 @@ PacketQueue::sendDeferredPacket()
     // (most notaly when responding to the timing CPU, leading to a
     // new request hitting in the L1 icache, leading to a new
     // response)
-    transmitList.pop_front();
+    popPacket();
 
     // use the appropriate implementation of sendTiming based on the
     // type of queue
@@ -213,7 +245,7 @@ PacketQueue::sendDeferredPacket()
         schedSendEvent(deferredPacketReadyTime());
     } else {
         // put the packet back at the front of the list
-        transmitList.emplace_front(dp);
+        insertPacket(transmitList.begin(), dp.tick, dp.pkt);
     }
 }
 
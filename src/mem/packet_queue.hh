@@ -81,6 +81,22 @@ class PacketQueue : public Drainable
     /** A list of outgoing packets. */
     DeferredPacketList transmitList;
 
+    /**
+     * Nodes no longer used by the transmit list. They are spliced in
+     * and out of it, rather than allocated and freed for every packet.
+     */
+    DeferredPacketList freeList;
+
+    /**
+     * Put a packet in the transmit list before pos, reusing a free
+     * node if there is one.
+     */
+    void insertPacket(DeferredPacketList::iterator pos, Tick when,
+                      PacketPtr pkt);
+
+    /** Move the head of the transmit list to the free list. */
+    void popPacket();
+
     /** The manager which is used for the event queue */
     EventManager& em;
 
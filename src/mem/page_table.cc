@@ -33,6 +33,7 @@
  */
 #include "mem/page_table.hh"
 
+#include <algorithm>
 #include <string>
 
 #include "base/compiler.hh"
@@ -44,6 +45,67 @@
 namespace gem5
 {
 
+EmulationPageTable::Entry *
+EmulationPageTable::find(Addr vaddr) const
+{
+    auto it = leaves.find(leafIndex(vaddr));
+    if (it == leaves.end())
+        return nullptr;
+    const unsigned slot = leafSlot(vaddr);
+    return it->second->valid[slot] ? &it->second->entries[slot] : nullptr;
+}
+
+void
+EmulationPageTable::setEntries(Addr vaddr, Addr paddr, uint64_t npages,
+                               uint64_t flags, bool clobber)
+{
+    while (npages) {
+        auto &leaf = leaves[leafIndex(vaddr)];
+        if (!leaf)
+            leaf = std::make_unique<Leaf>();
+
+        // Fill in as much of this leaf as the region covers
+        unsigned slot = leafSlot(vaddr);
+        for (; npages && slot < LeafPages; slot++, npages--) {
+            if (leaf->valid[slot]) {
+                // already mapped
+                panic_if(!clobber,
+                         "EmulationPageTable::allocate: addr %#x already "
+                         "mapped", vaddr);
+            } else {
+                leaf->valid[slot] = true;
+                numPages++;
+            }
+            leaf->entries[slot] = Entry(paddr, flags);
+
+            vaddr += _pageSize;
+            paddr += _pageSize;
+        }
+    }
+}
+
+void
+EmulationPageTable::clearEntries(Addr vaddr, uint64_t npages)
+{
+    while (npages) {
+        auto it = leaves.find(leafIndex(vaddr));
+        assert(it != leaves.end());
+        Leaf &leaf = *it->second;
+
+        unsigned slot = leafSlot(vaddr);
+        for (; npages && slot < LeafPages; slot++, npages--) {
+            assert(leaf.valid[slot]);
+            leaf.valid[slot] = false;
+            numPages--;
+            vaddr += _pageSize;
+        }
+
+        // Release leaves as soon as they are empty
+        if (leaf.valid.none())
+            leaves.erase(it);
+    }
+}
+
 void
 EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 {
@@ -53,22 +115,8 @@ EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 
     DPRINTF(MMU, "Allocating Page: %#x-%#x\n", vaddr, vaddr + size);
 
-    while (size > 0) {
-        auto it = pTable.find(vaddr);
-        if (it != pTable.end()) {
-            // already mapped
-            panic_if(!clobber,
-                     "EmulationPageTable::allocate: addr %#x already mapped",
-                     vaddr);
-            it->second = Entry(paddr, flags);
-        } else {
-            pTable.emplace(vaddr, Entry(paddr, flags));
-        }
-
-        size -= _pageSize;
-        vaddr += _pageSize;
-        paddr += _pageSize;
-    }
+    if (size > 0)
+        setEntries(vaddr, paddr, divCeil(size, _pageSize), flags, clobber);
 }
 
 void
@@ -81,12 +129,12 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
             new_vaddr, size);
 
     while (size > 0) {
-        [[maybe_unused]] auto new_it = pTable.find(new_vaddr);
-        auto old_it = pTable.find(vaddr);
-        assert(old_it != pTable.end() && new_it == pTable.end());
+        const Entry *old_entry = find(vaddr);
+        assert(old_entry && !find(new_vaddr));
 
-        pTable.emplace(new_vaddr, old_it->second);
-        pTable.erase(old_it);
+        const Entry entry = *old_entry;
+        clearEntries(vaddr, 1);
+        setEntries(new_vaddr, entry.paddr, 1, entry.flags, false);
         size -= _pageSize;
         vaddr += _pageSize;
         new_vaddr += _pageSize;
@@ -96,8 +144,17 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 void
 EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 {
-    for (auto &iter : pTable)
-        addr_maps->push_back(std::make_pair(iter.first, iter.second.paddr));
+    addr_maps->reserve(addr_maps->size() + numPages);
+    for (auto &[index, leaf] : leaves) {
+        const Addr base = index << LeafBits << pageShift;
+        for (unsigned slot = 0; slot < LeafPages; slot++) {
+            if (leaf->valid[slot]) {
+                addr_maps->push_back(std::make_pair(
+                    base + (Addr(slot) << pageShift),
+                    leaf->entries[slot].paddr));
+            }
+        }
+    }
 }
 
 void
@@ -107,13 +164,8 @@ EmulationPageTable::unmap(Addr vaddr, int64_t size)
 
     DPRINTF(MMU, "Unmapping page: %#x-%#x\n", vaddr, vaddr + size);
 
-    while (size > 0) {
-        auto it = pTable.find(vaddr);
-        assert(it != pTable.end());
-        pTable.erase(it);
-        size -= _pageSize;
-        vaddr += _pageSize;
-    }
+    if (size > 0)
+        clearEntries(vaddr, divCeil(size, _pageSize));
 }
 
 bool
@@ -122,9 +174,26 @@ EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
 
-    for (int64_t offset = 0; offset < size; offset += _pageSize)
-        if (pTable.find(vaddr + offset) != pTable.end())
-            return false;
+    while (size > 0) {
+        const Addr leaf_size = Addr(LeafPages) << pageShift;
+        const Addr leaf_left = leaf_size - (vaddr & (leaf_size - 1));
+
+        // Skip whole leaves which aren't there at all
+        auto it = leaves.find(leafIndex(vaddr));
+        if (it == leaves.end()) {
+            size -= leaf_left;
+            vaddr += leaf_left;
+            continue;
+        }
+
+        unsigned slot = leafSlot(vaddr);
+        for (; size > 0 && slot < LeafPages; slot++) {
+            if (it->second->valid[slot])
+                return false;
+            size -= _pageSize;
+            vaddr += _pageSize;
+        }
+    }
 
     return true;
 }
@@ -132,11 +201,7 @@ EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
 const EmulationPageTable::Entry *
 EmulationPageTable::lookup(Addr vaddr)
 {
-    Addr page_addr = pageAlign(vaddr);
-    PTableItr iter = pTable.find(page_addr);
-    if (iter == pTable.end())
-        return nullptr;
-    return &(iter->second);
+    return find(pageAlign(vaddr));
 }
 
 bool
@@ -186,17 +251,57 @@ void
 EmulationPageTable::serialize(CheckpointOut &cp) const
 {
     ScopedCheckpointSection sec(cp, "ptable");
-    paramOut(cp, "size", pTable.size());
 
-    PTable::size_type count = 0;
-    for (auto &pte : pTable) {
-        ScopedCheckpointSection sec(cp, csprintf("Entry%d", count++));
+    // Record runs of pages which are contiguous in both address spaces
+    // and have the same flags as one entry, in address order, which
+    // keeps checkpoints of large mappings small.
+    std::vector<Addr> indices;
+    indices.reserve(leaves.size());
+    for (auto &leaf : leaves)
+        indices.push_back(leaf.first);
+    std::sort(indices.begin(), indices.end());
+
+    struct Run
+    {
+        Addr vaddr;
+        Entry entry;
+        uint64_t pages;
+    };
+    std::vector<Run> runs;
+    for (Addr index : indices) {
+        const Leaf &leaf = *leaves.at(index);
+        const Addr base = index << LeafBits << pageShift;
+        for (unsigned slot = 0; slot < LeafPages; slot++) {
+            if (!leaf.valid[slot])
+                continue;
+
+            const Addr vaddr = base + (Addr(slot) << pageShift);
+            const Entry &entry = leaf.entries[slot];
+            if (!runs.empty()) {
+                Run &last = runs.back();
+                const Addr offset = last.pages << pageShift;
+                if (last.vaddr + offset == vaddr &&
+                        last.entry.paddr + offset == entry.paddr &&
+                        last.entry.flags == entry.flags) {
+                    last.pages++;
+                    continue;
+                }
+            }
+            runs.push_back({vaddr, entry, 1});
+        }
+    }
 
-        paramOut(cp, "vaddr", pte.first);
-        paramOut(cp, "paddr", pte.second.paddr);
-        paramOut(cp, "flags", pte.second.flags);
+    paramOut(cp, "size", runs.size());
+    for (size_t count = 0; count < runs.size(); count++) {
+        ScopedCheckpointSection sec(cp, csprintf("Entry%d", count));
+
+        const Run &run = runs[count];
+        paramOut(cp, "vaddr", run.vaddr);
+        paramOut(cp, "paddr", run.entry.paddr);
+        paramOut(cp, "flags", run.entry.flags);
+        if (run.pages != 1)
+            paramOut(cp, "pages", run.pages);
     }
-    assert(count == pTable.size());
 }
 
 void
@@ -215,8 +320,11 @@ EmulationPageTable::unserialize(CheckpointIn &cp)
         uint64_t flags;
         UNSERIALIZE_SCALAR(paddr);
         UNSERIALIZE_SCALAR(flags);
+        // Older checkpoints have one entry per page
+        uint64_t pages = 1;
+        optParamIn(cp, "pages", pages, false);
 
-        pTable.emplace(vaddr, Entry(paddr, flags));
+        setEntries(vaddr, paddr, pages, flags, true);
     }
 }
 
@@ -224,8 +332,14 @@ const std::string
 EmulationPageTable::externalize() const
 {
     std::stringstream ss;
-    for (PTable::const_iterator it=pTable.begin(); it != pTable.end(); ++it) {
-        ss << std::hex << it->first << ":" << it->second.paddr << ";";
+    for (auto &[index, leaf] : leaves) {
+        const Addr base = index << LeafBits << pageShift;
+        for (unsigned slot = 0; slot < LeafPages; slot++) {
+            if (leaf->valid[slot]) {
+                ss << std::hex << base + (Addr(slot) << pageShift) << ":"
+                   << leaf->entries[slot].paddr << ";";
+            }
+        }
     }
     return ss.str();
 }
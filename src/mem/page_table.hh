@@ -35,6 +35,9 @@
 #ifndef __MEM_PAGE_TABLE_HH__
 #define __MEM_PAGE_TABLE_HH__
 
+#include <array>
+#include <bitset>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -63,12 +66,50 @@ class EmulationPageTable : public Serializable
     };
 
   protected:
-    typedef std::unordered_map<Addr, Entry> PTable;
-    typedef PTable::iterator PTableItr;
-    PTable pTable;
+    /** log2 of the number of pages in a leaf of the table */
+    static constexpr unsigned LeafBits = 9;
+    static constexpr unsigned LeafPages = 1 << LeafBits;
+
+    /**
+     * The entries of LeafPages consecutive pages, aligned to the range
+     * they cover (2MiB with 4KiB pages). Keeping entries in leaves
+     * rather than one hash table node per page makes mapping large
+     * regions much cheaper in time and memory.
+     */
+    struct Leaf
+    {
+        std::array<Entry, LeafPages> entries;
+        std::bitset<LeafPages> valid;
+    };
+
+    /** Leaves, indexed by the upper bits of their page numbers */
+    std::unordered_map<Addr, std::unique_ptr<Leaf>> leaves;
+    /** Number of pages mapped in all leaves */
+    uint64_t numPages = 0;
 
     const Addr _pageSize;
     const Addr offsetMask;
+    const unsigned pageShift;
+
+    Addr leafIndex(Addr vaddr) const { return vaddr >> pageShift >> LeafBits; }
+    unsigned
+    leafSlot(Addr vaddr) const
+    {
+        return (vaddr >> pageShift) & (LeafPages - 1);
+    }
+
+    /** Find the entry of the page containing vaddr, if it is mapped. */
+    Entry *find(Addr vaddr) const;
+
+    /**
+     * Set the entries of npages pages starting at vaddr.
+     * @param clobber Whether pages may be mapped already.
+     */
+    void setEntries(Addr vaddr, Addr paddr, uint64_t npages,
+                    uint64_t flags, bool clobber);
+
+    /** Clear the entries of npages mapped pages starting at vaddr. */
+    void clearEntries(Addr vaddr, uint64_t npages);
 
     const uint64_t _pid;
     const std::string _name;
@@ -78,7 +119,8 @@ class EmulationPageTable : public Serializable
     EmulationPageTable(
             const std::string &__name, uint64_t _pid, Addr _pageSize) :
             _pageSize(_pageSize), offsetMask(mask(floorLog2(_pageSize))),
-            _pid(_pid), _name(__name), shared(false)
+            pageShift(floorLog2(_pageSize)), _pid(_pid), _name(__name),
+            shared(false)
     {
         assert(isPowerOf2(_pageSize));
     }
@@ -196,6 +238,9 @@ class EmulationPageTable : public Serializable
 
     void getMappings(std::vector<std::pair<Addr, Addr>> *addr_mappings);
 
+    /** Number of pages currently mapped */
+    uint64_t mappedPages() const { return numPages; }
+
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
 };
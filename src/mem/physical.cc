@@ -38,17 +38,24 @@
 #include "mem/physical.hh"
 
 #include <fcntl.h>
+#include <sys/file.h>
 #include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/user.h>
 #include <unistd.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include "base/intmath.hh"
 #include "base/trace.hh"
@@ -76,14 +83,81 @@ namespace gem5
 namespace memory
 {
 
+namespace
+{
+
+/**
+ * The smallest amount of memory worth handing to a host thread of its
+ * own when writing or reading a checkpoint.
+ */
+constexpr Addr minPartSize = 256 * 1024 * 1024;
+
+/**
+ * Get the number of parts a backing store of the given size is split
+ * into, so that the parts can be compressed concurrently.
+ */
+unsigned
+numParts(Addr size)
+{
+    const Addr threads = std::max(1U, std::thread::hardware_concurrency());
+    return std::max<Addr>(1, std::min(threads, divCeil(size, minPartSize)));
+}
+
+/**
+ * Get the byte range of a part of a backing store. Parts cover whole
+ * pages, except for the end of a store that is not a multiple of the
+ * page size.
+ */
+std::pair<Addr, Addr>
+partBounds(Addr size, Addr page_size, unsigned parts, unsigned part)
+{
+    const Addr pages = divCeil(size, page_size);
+    return {std::min(size, pages * part / parts * page_size),
+            std::min(size, pages * (part + 1) / parts * page_size)};
+}
+
+/**
+ * Call func with the index of every part, each on a host thread of
+ * its own. The function returns an error message, which is empty if
+ * it succeeded, and the first error is fatal once all parts are done.
+ */
+template <typename F>
+void
+forEachPart(unsigned parts, F func)
+{
+    std::vector<std::string> errors(parts);
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < parts; ++i)
+        threads.emplace_back([&, i]() { errors[i] = func(i); });
+    errors[0] = func(0);
+    for (auto &t : threads)
+        t.join();
+
+    for (const auto &e : errors)
+        fatal_if(!e.empty(), "%s\n", e);
+}
+
+std::string
+partPath(const std::string &filepath, unsigned part)
+{
+    return filepath + "." + std::to_string(part);
+}
+
+} // anonymous namespace
+
 PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               MemoryCheckpointFormat checkpoint_format,
+                               bool lazy_restore, bool mergeable_backstore,
+                               const std::string &image_cache) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
-    pageSize(sysconf(_SC_PAGE_SIZE))
+    pageSize(sysconf(_SC_PAGE_SIZE)), checkpointFormat(checkpoint_format),
+    lazyRestore(lazy_restore), mergeableBackstore(mergeable_backstore),
+    imageCache(image_cache)
 {
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
@@ -93,6 +167,9 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
     if (mmap_using_noreserve)
         warn("Not reserving swap space. May cause SIGSEGV on actual usage\n");
 
+    warn_if(mergeable_backstore && !sharedBackstore.empty(),
+            "A shared backing store can't have its pages merged.\n");
+
     // add the memories from the system to the address map as
     // appropriate
     for (const auto& m : _memories) {
@@ -153,7 +230,8 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                     for (const auto& c : curr_memories)
                         if (f->isConfReported() != c->isConfReported() ||
                             f->isInAddrMap() != c->isInAddrMap() ||
-                            f->isKvmMap() != c->isKvmMap())
+                            f->isKvmMap() != c->isKvmMap() ||
+                            f->getHostNumaNode() != c->getHostNumaNode())
                             fatal("Inconsistent flags in an interleaved "
                                   "range\n");
 
@@ -185,7 +263,8 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
         for (const auto& c : curr_memories)
             if (f->isConfReported() != c->isConfReported() ||
                 f->isInAddrMap() != c->isInAddrMap() ||
-                f->isKvmMap() != c->isKvmMap())
+                f->isKvmMap() != c->isKvmMap() ||
+                f->getHostNumaNode() != c->getHostNumaNode())
                 fatal("Inconsistent flags in an interleaved "
                       "range\n");
 
@@ -248,11 +327,22 @@ PhysicalMemory::createBackingStore(
               range.to_string());
     }
 
+    if (shm_fd == -1)
+        adviseMergeable(pmem, range.size());
+
+    // all the memories of an interleaved range are on the same node,
+    // which is checked by the caller
+    const int numa_node = _memories.front()->getHostNumaNode();
+    bindToNumaNode(pmem, range.size(), numa_node);
+
     // remember this backing store so we can checkpoint it and unmap
     // it appropriately
     backingStore.emplace_back(range, pmem,
                               conf_table_reported, in_addr_map, kvm_map,
-                              shm_fd, map_offset);
+                              shm_fd, map_offset, numa_node);
+    baseImages.emplace_back();
+    deltaImages.emplace_back();
+    storeMemories.push_back(_memories);
 
     // point the memories to their backing store
     for (const auto& m : _memories) {
@@ -262,6 +352,49 @@ PhysicalMemory::createBackingStore(
     }
 }
 
+void
+PhysicalMemory::adviseMergeable(uint8_t *pmem, Addr size) const
+{
+    if (!mergeableBackstore)
+        return;
+
+#ifdef MADV_MERGEABLE
+    if (madvise(pmem, size, MADV_MERGEABLE)) {
+        warn("Can't make the backing store mergeable: %s\n",
+             strerror(errno));
+    }
+#else
+    warn_once("The host can't merge identical pages of the backing "
+              "store.\n");
+#endif
+}
+
+void
+PhysicalMemory::bindToNumaNode(uint8_t *pmem, Addr size, int node) const
+{
+    if (node < 0)
+        return;
+
+#if defined(__linux__) && defined(SYS_mbind)
+    // call mbind directly rather than depend on libnuma for it
+    constexpr int mpol_bind = 2;
+    constexpr unsigned long bits = sizeof(unsigned long) * CHAR_BIT;
+    std::vector<unsigned long> nodemask(node / bits + 1, 0);
+    nodemask[node / bits] = 1UL << (node % bits);
+    if (syscall(SYS_mbind, pmem, size, mpol_bind, nodemask.data(),
+                nodemask.size() * bits, 0) != 0) {
+        warn("Can't bind the backing store to host NUMA node %d: %s\n",
+             node, strerror(errno));
+    } else {
+        DPRINTF(AddrRanges, "Bound backing store at %p to host NUMA "
+                "node %d\n", pmem, node);
+    }
+#else
+    warn_once("Binding the backing store to a host NUMA node is only "
+              "supported on Linux.\n");
+#endif
+}
+
 PhysicalMemory::~PhysicalMemory()
 {
     // unmap the backing store
@@ -332,6 +465,10 @@ PhysicalMemory::functionalAccess(PacketPtr pkt)
 void
 PhysicalMemory::serialize(CheckpointOut &cp) const
 {
+    // pages that are still pending would otherwise be missing from
+    // the checkpoint
+    completeRestore();
+
     // serialize all the locked addresses and their context ids
     std::vector<Addr> lal_addr;
     std::vector<ContextID> lal_cid;
@@ -365,36 +502,75 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
 {
     // we cannot use the address range for the name as the
     // memories that are not part of the address map can overlap
-    std::string filename =
-        name() + ".store" + std::to_string(store_id) + ".pmem";
+    std::string filename = name() + ".store" + std::to_string(store_id);
     Addr range_size = range.size();
 
+    std::string format;
+    switch (checkpointFormat) {
+      case MemoryCheckpointFormat::gzip:
+        format = "gzip";
+        filename += ".pmem";
+        break;
+      case MemoryCheckpointFormat::raw:
+        format = "raw";
+        filename += ".raw";
+        break;
+      case MemoryCheckpointFormat::delta:
+        format = "delta";
+        filename += ".delta";
+        break;
+      default:
+        panic("Unknown memory checkpoint format\n");
+    }
+
     DPRINTF(Checkpoint, "Serializing physical memory %s with size %d\n",
             filename, range_size);
 
     SERIALIZE_SCALAR(store_id);
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
+    SERIALIZE_SCALAR(format);
 
-    // write memory file
+    // write memory file, concurrently with the other stores and
+    // the rest of the checkpoint
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
+    if (checkpointFormat == MemoryCheckpointFormat::gzip) {
+        writeAsync([=]() { writeGzipStore(filepath, pmem, range_size); });
+    } else if (checkpointFormat == MemoryCheckpointFormat::raw) {
+        writeAsync([=]() { writeRawStore(filepath, pmem, range_size); });
+    } else {
+        unsigned parts = numParts(range_size);
+        Addr page_size = pageSize;
+        std::string base = baseImages[store_id];
+        SERIALIZE_SCALAR(parts);
+        SERIALIZE_SCALAR(page_size);
+        SERIALIZE_SCALAR(base);
+        writeAsync([=]() {
+            writeDeltaStore(filepath, parts, pmem, range_size, base);
+        });
+    }
+}
+
+void
+PhysicalMemory::writeGzipStore(const std::string &filepath,
+                               const uint8_t *pmem, Addr size) const
+{
     gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
     if (compressed_mem == NULL)
         fatal("Can't open physical memory checkpoint file '%s'\n",
-              filename);
+              filepath);
 
     uint64_t pass_size = 0;
 
     // gzwrite fails if (int)len < 0 (gzwrite returns int)
-    for (uint64_t written = 0; written < range.size();
-         written += pass_size) {
-        pass_size = (uint64_t)INT_MAX < (range.size() - written) ?
-            (uint64_t)INT_MAX : (range.size() - written);
+    for (uint64_t written = 0; written < size; written += pass_size) {
+        pass_size = (uint64_t)INT_MAX < (size - written) ?
+            (uint64_t)INT_MAX : (size - written);
 
         if (gzwrite(compressed_mem, pmem + written,
                     (unsigned int) pass_size) != (int) pass_size) {
             fatal("Write failed on physical memory checkpoint file '%s'\n",
-                  filename);
+                  filepath);
         }
     }
 
@@ -402,8 +578,85 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     // is zero
     if (gzclose(compressed_mem))
         fatal("Close failed on physical memory checkpoint file '%s'\n",
-              filename);
+              filepath);
+}
+
+void
+PhysicalMemory::writeRawStore(const std::string &filepath,
+                              const uint8_t *pmem, Addr size) const
+{
+    // remove any existing image first, as it may be the very image
+    // the backing store is mapped from
+    unlink(filepath.c_str());
+    int fd = open(filepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1 || ftruncate(fd, size))
+        fatal("Can't create physical memory checkpoint file '%s': %s\n",
+              filepath, strerror(errno));
+
+    // only write the pages that are not zero, which leaves holes in
+    // the file for the others
+    const std::vector<uint8_t> zero(pageSize, 0);
+    const unsigned parts = numParts(size);
+    forEachPart(parts, [&](unsigned part) -> std::string {
+        auto [start, end] = partBounds(size, pageSize, parts, part);
+        Addr run = start;
+        for (Addr offset = start; ; offset += pageSize) {
+            const Addr len = offset < end ?
+                std::min<Addr>(pageSize, end - offset) : 0;
+            if (len && memcmp(pmem + offset, zero.data(), len))
+                continue;
+
+            // write the run of non-zero pages that ends here
+            const Addr stop = std::min(offset, end);
+            while (run < stop) {
+                ssize_t ret = pwrite(fd, pmem + run, stop - run, run);
+                if (ret <= 0)
+                    return csprintf("Write failed on physical memory "
+                                    "checkpoint file '%s': %s", filepath,
+                                    strerror(errno));
+                run += ret;
+            }
+
+            if (!len)
+                return "";
+            run = offset + len;
+        }
+    });
+
+    if (close(fd))
+        fatal("Close failed on physical memory checkpoint file '%s'\n",
+              filepath);
+}
+
+void
+PhysicalMemory::writeDeltaStore(const std::string &filepath, unsigned parts,
+                                const uint8_t *pmem, Addr size,
+                                const std::string &base_image) const
+{
+    // map the base image to compare against, or use zeroed memory
+    // if there is none
+    const uint8_t *base = nullptr;
+    if (!base_image.empty()) {
+        int fd = open(base_image.c_str(), O_RDONLY);
+        if (fd == -1)
+            fatal("Can't open base memory image '%s': %s\n", base_image,
+                  strerror(errno));
+        base = (const uint8_t *)mmap(NULL, size, PROT_READ, MAP_SHARED,
+                                     fd, 0);
+        close(fd);
+        if (base == (const uint8_t *)MAP_FAILED)
+            fatal("Can't map base memory image '%s': %s\n", base_image,
+                  strerror(errno));
+    }
+
+    forEachPart(parts, [&](unsigned part) {
+        auto [start, end] = partBounds(size, pageSize, parts, part);
+        return DeltaImage::write(partPath(filepath, part), pmem, base,
+                                 start, end, pageSize);
+    });
 
+    if (base)
+        munmap((void *)base, size);
 }
 
 void
@@ -424,18 +677,24 @@ PhysicalMemory::unserialize(CheckpointIn &cp)
     unsigned int nbr_of_stores;
     UNSERIALIZE_SCALAR(nbr_of_stores);
 
+    std::vector<std::function<void()>> reads;
     for (unsigned int i = 0; i < nbr_of_stores; ++i) {
         ScopedCheckpointSection sec(cp, csprintf("store%d", i));
-        unserializeStore(cp);
+        reads.push_back(unserializeStore(cp));
     }
 
+    // the stores are independent, so their files are read concurrently
+    if (!reads.empty()) {
+        forEachPart(reads.size(), [&](unsigned i) {
+            reads[i]();
+            return std::string();
+        });
+    }
 }
 
-void
+std::function<void()>
 PhysicalMemory::unserializeStore(CheckpointIn &cp)
 {
-    const uint32_t chunk_size = 16384;
-
     unsigned int store_id;
     UNSERIALIZE_SCALAR(store_id);
 
@@ -443,14 +702,9 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
-    // mmap memoryfile
-    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
-    if (compressed_mem == NULL)
-        fatal("Can't open physical memory checkpoint file '%s'", filename);
-
     // we've already got the actual backing store mapped
-    uint8_t* pmem = backingStore[store_id].pmem;
-    AddrRange range = backingStore[store_id].range;
+    const BackingStoreEntry &store = backingStore[store_id];
+    AddrRange range = store.range;
 
     Addr range_size;
     UNSERIALIZE_SCALAR(range_size);
@@ -462,9 +716,65 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
         fatal("Memory range size has changed! Saw %lld, expected %lld\n",
               range_size, range.size());
 
+    // checkpoints predating the other formats are all gzipped
+    std::string format = "gzip";
+    optParamIn(cp, "format", format, false);
+
+    if (format == "gzip" && !imageCache.empty() && store.shmFd == -1) {
+        return [this, filepath, &store, store_id]() {
+            readRawStore(cachedImage(filepath, store), store);
+            baseImages[store_id].clear();
+        };
+    } else if (format == "gzip") {
+        return [this, filepath, &store, range_size, store_id]() {
+            readGzipStore(filepath, store.pmem, range_size);
+            baseImages[store_id].clear();
+        };
+    } else if (format == "raw") {
+        return [this, filepath, &store, store_id]() {
+            readRawStore(filepath, store);
+            char *path = realpath(filepath.c_str(), NULL);
+            baseImages[store_id] = path ? path : filepath;
+            free(path);
+        };
+    } else if (format == "delta") {
+        unsigned parts;
+        Addr page_size;
+        std::string base;
+        UNSERIALIZE_SCALAR(parts);
+        UNSERIALIZE_SCALAR(page_size);
+        UNSERIALIZE_SCALAR(base);
+
+        fatal_if(page_size != pageSize, "Physical memory checkpoint '%s' "
+                 "uses %d byte pages, but the host uses %d byte pages\n",
+                 filename, page_size, pageSize);
+
+        return [this, filepath, &store, parts, base, store_id]() {
+            // the memory is zero, unless there is an image to start from
+            if (!base.empty())
+                readRawStore(base, store);
+            readDeltaStore(filepath, parts, store_id);
+            baseImages[store_id] = base;
+        };
+    } else {
+        fatal("Unknown format '%s' of physical memory checkpoint '%s'\n",
+              format, filename);
+    }
+}
+
+void
+PhysicalMemory::readGzipStore(const std::string &filepath,
+                              uint8_t *pmem, Addr size)
+{
+    const uint32_t chunk_size = 16384;
+
+    gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
+    if (compressed_mem == NULL)
+        fatal("Can't open physical memory checkpoint file '%s'", filepath);
+
     uint64_t curr_size = 0;
     uint32_t bytes_read;
-    while (curr_size < range.size()) {
+    while (curr_size < size) {
         bytes_read = gzread(compressed_mem, pmem, chunk_size);
         if (bytes_read == 0)
             break;
@@ -474,7 +784,123 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
 
     if (gzclose(compressed_mem))
         fatal("Close failed on physical memory checkpoint file '%s'\n",
-              filename);
+              filepath);
+}
+
+std::string
+PhysicalMemory::cachedImage(const std::string &filepath,
+                            const BackingStoreEntry &store)
+{
+    const Addr size = store.range.size();
+    struct stat st;
+    if (stat(filepath.c_str(), &st))
+        fatal("Can't open physical memory checkpoint file '%s': %s\n",
+              filepath, strerror(errno));
+
+    // the image is identified by the file it is decompressed from
+    const std::string image = csprintf("%s/%x-%x-%x-%x.raw", imageCache,
+                                       st.st_dev, st.st_ino, st.st_mtime,
+                                       size);
+
+    // simulations restoring the same checkpoint at the same time wait
+    // for the first one to decompress it
+    const std::string lock_path = image + ".lock";
+    int lock_fd = open(lock_path.c_str(), O_RDWR | O_CREAT, 0666);
+    if (lock_fd == -1 || flock(lock_fd, LOCK_EX))
+        fatal("Can't lock memory image cache entry '%s': %s\n",
+              lock_path, strerror(errno));
+
+    if (::access(image.c_str(), R_OK) != 0) {
+        DPRINTF(Checkpoint, "Decompressing %s into %s\n", filepath, image);
+        // the image is renamed once complete, so that a simulation
+        // that is killed while writing it leaves no partial image
+        const std::string tmp = csprintf("%s.%d", image, getpid());
+        readGzipStore(filepath, store.pmem, size);
+        writeRawStore(tmp, store.pmem, size);
+        if (rename(tmp.c_str(), image.c_str()))
+            fatal("Can't add '%s' to the memory image cache: %s\n",
+                  image, strerror(errno));
+    } else {
+        DPRINTF(Checkpoint, "Restoring %s from %s\n", filepath, image);
+    }
+
+    flock(lock_fd, LOCK_UN);
+    close(lock_fd);
+    return image;
+}
+
+void
+PhysicalMemory::readRawStore(const std::string &filepath,
+                             const BackingStoreEntry &store)
+{
+    const Addr size = store.range.size();
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd == -1)
+        fatal("Can't open physical memory checkpoint file '%s': %s\n",
+              filepath, strerror(errno));
+
+    // a private mapping of the image replaces the anonymous memory,
+    // and pages are only read and copied when they are touched;
+    // memory shared with other processes has to be copied up front
+    if (store.shmFd == -1 && size % pageSize == 0) {
+        int map_flags = MAP_PRIVATE | MAP_FIXED;
+        if (mmapUsingNoReserve)
+            map_flags |= MAP_NORESERVE;
+        if (mmap(store.pmem, size, PROT_READ | PROT_WRITE, map_flags,
+                 fd, 0) == MAP_FAILED) {
+            fatal("Can't map physical memory checkpoint file '%s': %s\n",
+                  filepath, strerror(errno));
+        }
+        // the pages are copied from the image when they are written,
+        // and those copies can be merged again if they don't diverge
+        adviseMergeable(store.pmem, size);
+        // the new mapping doesn't inherit the policy of the old one
+        bindToNumaNode(store.pmem, size, store.numaNode);
+    } else {
+        for (Addr offset = 0; offset < size; ) {
+            ssize_t ret = pread(fd, store.pmem + offset, size - offset,
+                                offset);
+            if (ret <= 0)
+                fatal("Read failed on physical memory checkpoint file "
+                      "'%s'\n", filepath);
+            offset += ret;
+        }
+    }
+
+    close(fd);
+}
+
+void
+PhysicalMemory::readDeltaStore(const std::string &filepath, unsigned parts,
+                               unsigned store_id)
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+    auto image = std::make_unique<DeltaImage>(store.pmem, store.range.size(),
+                                              pageSize);
+    for (unsigned part = 0; part < parts; ++part)
+        image->addPart(partPath(filepath, part));
+
+    // memory that is shared with other processes is accessed behind
+    // our back, so it has to be restored right away
+    if (!lazyRestore || store.shmFd != -1) {
+        image->fetchAll();
+        return;
+    }
+
+    DPRINTF(Checkpoint, "Restoring %d pages of %s on demand\n",
+            image->pending(), filepath);
+    for (auto *m : storeMemories[store_id])
+        m->setDeltaImage(image.get());
+    deltaImages[store_id] = std::move(image);
+}
+
+void
+PhysicalMemory::completeRestore() const
+{
+    for (const auto &image : deltaImages) {
+        if (image)
+            image->fetchAll();
+    }
 }
 
 } // namespace memory
@@ -39,11 +39,15 @@
 #define __MEM_PHYSICAL_HH__
 
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
+#include "enums/MemoryCheckpointFormat.hh"
+#include "mem/delta_image.hh"
 #include "mem/packet.hh"
 #include "sim/serialize.hh"
 
@@ -71,10 +75,11 @@ class BackingStoreEntry
      */
     BackingStoreEntry(AddrRange range, uint8_t* pmem,
                       bool conf_table_reported, bool in_addr_map, bool kvm_map,
-                      int shm_fd=-1, off_t shm_offset=0)
+                      int shm_fd=-1, off_t shm_offset=0,
+                      int numa_node=-1)
         : range(range), pmem(pmem), confTableReported(conf_table_reported),
           inAddrMap(in_addr_map), kvmMap(kvm_map), shmFd(shm_fd),
-          shmOffset(shm_offset)
+          shmOffset(shm_offset), numaNode(numa_node)
         {}
 
     /**
@@ -115,6 +120,12 @@ class BackingStoreEntry
       * of this backing store in the share memory. Otherwise, the value is 0.
       */
      off_t shmOffset;
+
+     /**
+      * The host NUMA node the pages of this backing store are bound to,
+      * or -1 if they are not bound.
+      */
+     int numaNode;
 };
 
 /**
@@ -142,7 +153,7 @@ class PhysicalMemory : public Serializable
     std::string _name;
 
     // Global address map
-    AddrRangeMap<AbstractMemory*, 1> addrMap;
+    AddrRangeMap<AbstractMemory*> addrMap;
 
     // All address-mapped memories
     std::vector<AbstractMemory*> memories;
@@ -162,12 +173,61 @@ class PhysicalMemory : public Serializable
     // system
     std::vector<BackingStoreEntry> backingStore;
 
+    // The memories that each backing store provides the memory for
+    std::vector<std::vector<AbstractMemory*>> storeMemories;
+
+    // The format used when checkpointing the backing stores
+    const MemoryCheckpointFormat checkpointFormat;
+
+    // Only read the pages of a delta checkpoint when they are accessed
+    const bool lazyRestore;
+
+    // Let the host merge the identical pages of the backing stores
+    const bool mergeableBackstore;
+
+    // Directory gzipped checkpoints are decompressed into, if any
+    const std::string imageCache;
+
+    /**
+     * For every backing store restored on demand, the pages of the
+     * delta checkpoint that are not read yet.
+     */
+    std::vector<std::unique_ptr<DeltaImage>> deltaImages;
+
+    /**
+     * For every backing store, the path of the uncompressed image it
+     * was restored from, if any. Delta checkpoints only record the
+     * pages that differ from this image, or the pages that are not
+     * zero if there is none.
+     */
+    std::vector<std::string> baseImages;
+
     // Prevent copying
     PhysicalMemory(const PhysicalMemory&);
 
     // Prevent assignment
     PhysicalMemory& operator=(const PhysicalMemory&);
 
+    /**
+     * Let the host kernel merge the pages of a private mapping of the
+     * backing store with identical pages, in this process or in others
+     * (KSM on Linux), if the backing stores are mergeable.
+     *
+     * @param pmem Start of the mapping
+     * @param size Size of the mapping
+     */
+    void adviseMergeable(uint8_t *pmem, Addr size) const;
+
+    /**
+     * Bind the pages of a mapping of the backing store to a host NUMA
+     * node, so that they are allocated there when first touched.
+     *
+     * @param pmem Start of the mapping
+     * @param size Size of the mapping
+     * @param node Host NUMA node, nothing is done if negative
+     */
+    void bindToNumaNode(uint8_t *pmem, Addr size, int node) const;
+
     /**
      * Create the memory region providing the backing store for a
      * given address range that corresponds to a set of memories in
@@ -182,6 +242,48 @@ class PhysicalMemory : public Serializable
                             bool conf_table_reported,
                             bool in_addr_map, bool kvm_map);
 
+    /**
+     * Write a backing store to a checkpoint file, either as a gzipped
+     * image, as an uncompressed image, or as the pages that differ
+     * from its base image.
+     */
+    void writeGzipStore(const std::string &filepath,
+                        const uint8_t *pmem, Addr size) const;
+    void writeRawStore(const std::string &filepath,
+                       const uint8_t *pmem, Addr size) const;
+    void writeDeltaStore(const std::string &filepath, unsigned parts,
+                         const uint8_t *pmem, Addr size,
+                         const std::string &base_image) const;
+
+    /**
+     * Read a backing store from the corresponding checkpoint files.
+     * An uncompressed image is mapped copy-on-write over the backing
+     * store where possible, so only the pages that are touched are
+     * ever read. The pages of a delta are read on demand as well if
+     * a lazy restore is requested.
+     */
+    void readGzipStore(const std::string &filepath,
+                       uint8_t *pmem, Addr size);
+    void readRawStore(const std::string &filepath,
+                      const BackingStoreEntry &store);
+    void readDeltaStore(const std::string &filepath, unsigned parts,
+                        unsigned store_id);
+
+    /**
+     * Get the uncompressed image of a gzipped checkpoint file from the
+     * image cache, decompressing it into the cache first if no other
+     * simulation did. The image is mapped copy-on-write like a raw
+     * checkpoint, so the simulations restoring the same checkpoint
+     * share the pages they don't write.
+     *
+     * @param filepath The gzipped checkpoint file.
+     * @param store The backing store the file is restored into, which
+     * is used as a buffer when decompressing it.
+     * @return The path of the uncompressed image.
+     */
+    std::string cachedImage(const std::string &filepath,
+                            const BackingStoreEntry &store);
+
   public:
 
     /**
@@ -191,7 +293,10 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   MemoryCheckpointFormat checkpoint_format,
+                   bool lazy_restore, bool mergeable_backstore=false,
+                   const std::string &image_cache="");
 
     /**
      * Unmap all the backing store we have used.
@@ -245,6 +350,15 @@ class PhysicalMemory : public Serializable
     std::vector<BackingStoreEntry> getBackingStore() const
     { return backingStore; }
 
+    /**
+     * Read all the pages that a lazy restore has not read yet. This
+     * has to happen before anything accesses the backing store other
+     * than through the memories, e.g., a virtual machine that maps
+     * it. As it only makes the backing store hold what the memories
+     * already return, it does not change the observable state.
+     */
+    void completeRestore() const;
+
     /**
      * Perform an untimed memory access and update all the state
      * (e.g. locked addresses) and statistics accordingly. The packet
@@ -293,8 +407,11 @@ class PhysicalMemory : public Serializable
 
     /**
      * Unserialize a specific backing store, identified by a section.
+     *
+     * @return A function reading the contents of the store, which can
+     * run concurrently with the ones of the other stores.
      */
-    void unserializeStore(CheckpointIn &cp);
+    std::function<void()> unserializeStore(CheckpointIn &cp);
 
 };
 
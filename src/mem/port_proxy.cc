@@ -37,15 +37,61 @@
 
 #include "mem/port_proxy.hh"
 
-#include "base/chunk_generator.hh"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "base/intmath.hh"
 #include "cpu/thread_context.hh"
 #include "mem/port.hh"
 
 namespace gem5
 {
 
+namespace
+{
+
+/** Host copies at least this large are split over several threads */
+constexpr uint64_t ParallelCopySize = 32 * 1024 * 1024;
+/** Maximum number of threads used for a host copy */
+constexpr unsigned MaxCopyThreads = 8;
+
+/**
+ * Run body(offset, length) over a block of host memory of the given
+ * size, in parallel for large blocks. Loading big kernels and initial
+ * ramdisks into a fresh memory mostly waits for the pages of its
+ * backing store to be faulted in, which scales with the number of
+ * threads touching them.
+ */
+void
+forEachPart(uint64_t size,
+            const std::function<void(uint64_t, uint64_t)> &body)
+{
+    const unsigned threads = std::min(MaxCopyThreads,
+                                      std::thread::hardware_concurrency());
+    if (size < ParallelCopySize || threads < 2) {
+        body(0, size);
+        return;
+    }
+
+    const uint64_t part = roundUp(divCeil(size, threads), 4096);
+    std::vector<std::thread> workers;
+    for (uint64_t offset = part; offset < size; offset += part)
+        workers.emplace_back(body, offset, std::min(part, size - offset));
+    body(0, part);
+    for (auto &worker : workers)
+        worker.join();
+}
+
+} // anonymous namespace
+
 PortProxy::PortProxy(ThreadContext *tc, Addr cache_line_size) :
     PortProxy([tc](PacketPtr pkt)->void { tc->sendFunctional(pkt); },
+        [tc](const MemBackdoorReq &req, MemBackdoorPtr &backdoor)->void {
+            tc->sendMemBackdoorReq(req, backdoor);
+        },
         cache_line_size)
 {}
 
@@ -54,20 +100,56 @@ PortProxy::PortProxy(const RequestPort &port, Addr cache_line_size) :
         cache_line_size)
 {}
 
+uint8_t *
+PortProxy::backdoorPtr(Addr addr, uint64_t size, MemBackdoor::Flags flags,
+                       uint64_t &avail) const
+{
+    if (!sendBackdoorReq)
+        return nullptr;
+
+    // Ask for the first line only, which never spans two memories
+    const Addr line_left = _cacheLineSize - (addr % _cacheLineSize);
+    const AddrRange line(addr, addr + std::min<uint64_t>(size, line_left));
+
+    MemBackdoorPtr backdoor = nullptr;
+    sendBackdoorReq(MemBackdoorReq(line, flags), backdoor);
+    if (!backdoor || !backdoor->ptr() ||
+        (backdoor->flags() & flags) != flags ||
+        backdoor->range().interleaved() || !backdoor->range().contains(addr))
+        return nullptr;
+
+    const AddrRange &range = backdoor->range();
+    avail = std::min<uint64_t>(size, range.end() - addr);
+    return backdoor->ptr() + (addr - range.start());
+}
+
 void
 PortProxy::readBlobPhys(Addr addr, Request::Flags flags,
                         void *p, uint64_t size) const
 {
-    for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
-         gen.next()) {
+    while (size) {
+        uint64_t chunk;
+        uint8_t *host = flags ? nullptr :
+            backdoorPtr(addr, size, MemBackdoor::Readable, chunk);
+        if (host) {
+            uint8_t *dst = static_cast<uint8_t *>(p);
+            forEachPart(chunk, [dst, host](uint64_t off, uint64_t len) {
+                std::memcpy(dst + off, host + off, len);
+            });
+        } else {
+            chunk = std::min<uint64_t>(
+                size, _cacheLineSize - (addr % _cacheLineSize));
 
-        auto req = std::make_shared<Request>(
-            gen.addr(), gen.size(), flags, Request::funcRequestorId);
+            auto req = std::make_shared<Request>(
+                addr, chunk, flags, Request::funcRequestorId);
 
-        Packet pkt(req, MemCmd::ReadReq);
-        pkt.dataStatic(static_cast<uint8_t *>(p));
-        sendFunctional(&pkt);
-        p = static_cast<uint8_t *>(p) + gen.size();
+            Packet pkt(req, MemCmd::ReadReq);
+            pkt.dataStatic(static_cast<uint8_t *>(p));
+            sendFunctional(&pkt);
+        }
+        addr += chunk;
+        size -= chunk;
+        p = static_cast<uint8_t *>(p) + chunk;
     }
 }
 
@@ -75,16 +157,29 @@ void
 PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
                          const void *p, uint64_t size) const
 {
-    for (ChunkGenerator gen(addr, size, _cacheLineSize); !gen.done();
-         gen.next()) {
+    while (size) {
+        uint64_t chunk;
+        uint8_t *host = flags ? nullptr :
+            backdoorPtr(addr, size, MemBackdoor::Writeable, chunk);
+        if (host) {
+            const uint8_t *src = static_cast<const uint8_t *>(p);
+            forEachPart(chunk, [host, src](uint64_t off, uint64_t len) {
+                std::memcpy(host + off, src + off, len);
+            });
+        } else {
+            chunk = std::min<uint64_t>(
+                size, _cacheLineSize - (addr % _cacheLineSize));
 
-        auto req = std::make_shared<Request>(
-            gen.addr(), gen.size(), flags, Request::funcRequestorId);
+            auto req = std::make_shared<Request>(
+                addr, chunk, flags, Request::funcRequestorId);
 
-        Packet pkt(req, MemCmd::WriteReq);
-        pkt.dataStaticConst(static_cast<const uint8_t *>(p));
-        sendFunctional(&pkt);
-        p = static_cast<const uint8_t *>(p) + gen.size();
+            Packet pkt(req, MemCmd::WriteReq);
+            pkt.dataStaticConst(static_cast<const uint8_t *>(p));
+            sendFunctional(&pkt);
+        }
+        addr += chunk;
+        size -= chunk;
+        p = static_cast<const uint8_t *>(p) + chunk;
     }
 }
 
@@ -92,13 +187,42 @@ void
 PortProxy::memsetBlobPhys(Addr addr, Request::Flags flags,
                           uint8_t v, uint64_t size) const
 {
-    // quick and dirty...
-    uint8_t *buf = new uint8_t[size];
+    std::vector<uint8_t> line;
+    while (size) {
+        uint64_t chunk;
+        uint8_t *host = flags ? nullptr :
+            backdoorPtr(addr, size, MemBackdoor::Writeable, chunk);
+        if (host) {
+            forEachPart(chunk, [host, v](uint64_t off, uint64_t len) {
+                std::memset(host + off, v, len);
+            });
+        } else {
+            // Fill the memory a cache line at a time rather than
+            // allocating a buffer as large as the whole block, which
+            // may be a large bss.
+            chunk = std::min<uint64_t>(
+                size, _cacheLineSize - (addr % _cacheLineSize));
+            line.resize(_cacheLineSize, v);
 
-    std::memset(buf, v, size);
-    PortProxy::writeBlobPhys(addr, flags, buf, size);
+            auto req = std::make_shared<Request>(
+                addr, chunk, flags, Request::funcRequestorId);
 
-    delete [] buf;
+            Packet pkt(req, MemCmd::WriteReq);
+            pkt.dataStaticConst(line.data());
+            sendFunctional(&pkt);
+        }
+        addr += chunk;
+        size -= chunk;
+    }
+}
+
+uint8_t *
+PortProxy::hostPtrPhys(Addr addr, uint64_t size,
+                       MemBackdoor::Flags flags) const
+{
+    uint64_t avail = 0;
+    uint8_t *host = backdoorPtr(addr, size, flags, avail);
+    return (host && avail == size) ? host : nullptr;
 }
 
 bool
@@ -87,13 +87,36 @@ class PortProxy : FunctionalRequestProtocol
 {
   public:
     typedef std::function<void(PacketPtr pkt)> SendFunctionalFunc;
+    typedef std::function<void(const MemBackdoorReq &req,
+                               MemBackdoorPtr &backdoor)>
+        SendMemBackdoorReqFunc;
 
   private:
     SendFunctionalFunc sendFunctional;
 
+    /**
+     * Optional source of backdoors, which must only hand out backdoors
+     * when accessing memory directly is coherent, e.g. when no cache
+     * holds data.
+     */
+    SendMemBackdoorReqFunc sendBackdoorReq;
+
     /** Granularity of any transactions issued through this proxy. */
     const Addr _cacheLineSize;
 
+    /**
+     * Get a host pointer to the memory at addr through a backdoor.
+     *
+     * @param addr Physical address to access
+     * @param size Size of the remaining access
+     * @param flags How the memory is to be accessed
+     * @param avail Set to the number of bytes accessible from addr,
+     *              up to size
+     * @return Host pointer, or nullptr to use functional accesses
+     */
+    uint8_t *backdoorPtr(Addr addr, uint64_t size,
+                         MemBackdoor::Flags flags, uint64_t &avail) const;
+
     void
     recvFunctionalSnoop(PacketPtr pkt) override
     {
@@ -107,6 +130,17 @@ class PortProxy : FunctionalRequestProtocol
         sendFunctional(func), _cacheLineSize(cache_line_size)
     {}
 
+    /**
+     * Create a proxy which copies directly from and to memory through
+     * backdoors where it can, and falls back to functional accesses of
+     * a cache line elsewhere.
+     */
+    PortProxy(SendFunctionalFunc func, SendMemBackdoorReqFunc backdoor_func,
+              Addr cache_line_size) :
+        sendFunctional(func), sendBackdoorReq(backdoor_func),
+        _cacheLineSize(cache_line_size)
+    {}
+
     // Helpers which create typical SendFunctionalFunc-s from other objects.
     PortProxy(ThreadContext *tc, Addr cache_line_size);
     PortProxy(const RequestPort &port, Addr cache_line_size);
@@ -134,6 +168,16 @@ class PortProxy : FunctionalRequestProtocol
     void memsetBlobPhys(Addr addr, Request::Flags flags,
                         uint8_t v, uint64_t size) const;
 
+    /**
+     * Get a host pointer to size bytes of memory at physical address
+     * addr, which must all be reachable through a single backdoor.
+     *
+     * @return Host pointer, or nullptr if the memory has to be accessed
+     *         with functional accesses
+     */
+    uint8_t *hostPtrPhys(Addr addr, uint64_t size,
+                         MemBackdoor::Flags flags) const;
+
 
 
     /** Methods to override in base classes */
@@ -171,6 +215,18 @@ class PortProxy : FunctionalRequestProtocol
         return true;
     }
 
+    /**
+     * Get a host pointer through which size bytes at addr can be
+     * accessed in place, as the given flags allow. This is only
+     * possible when the memory is contiguous on the host as well.
+     * Returns nullptr when the memory has to be copied instead.
+     */
+    virtual uint8_t *
+    tryHostPtr(Addr addr, uint64_t size, MemBackdoor::Flags flags) const
+    {
+        return hostPtrPhys(addr, size, flags);
+    }
+
 
 
     /** Higher level interfaces based on the above. */
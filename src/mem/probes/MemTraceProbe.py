@@ -36,6 +36,7 @@
 from m5.objects.BaseMemProbe import BaseMemProbe
 from m5.params import *
 from m5.proxy import *
+from m5.SimObject import *
 
 
 class MemTraceProbe(BaseMemProbe):
@@ -43,6 +44,11 @@ class MemTraceProbe(BaseMemProbe):
     cxx_header = "mem/probes/mem_trace.hh"
     cxx_class = "gem5::MemTraceProbe"
 
+    cxx_exports = [
+        PyBindMethod("startRecording"),
+        PyBindMethod("stopRecording"),
+    ]
+
     # Boolean to compress the trace or not.
     trace_compress = Param.Bool(True, "Enable trace compression")
 
@@ -52,5 +58,11 @@ class MemTraceProbe(BaseMemProbe):
     # packet trace output file, disabled by default
     trace_file = Param.String("", "Packet trace output file")
 
+    # Record from the start of the simulation, or only after a call to
+    # startRecording(). The ticks in the trace are relative to when the
+    # recording started, and stopRecording() closes the trace so that it
+    # can be replayed, e.g. by traffic generators taking over from CPUs.
+    start_enabled = Param.Bool(True, "Record from the start of simulation")
+
     # System object to look up the name associated with a requestor ID
     system = Param.System(Parent.any, "System the probe belongs to")
@@ -0,0 +1,79 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.proxy import *
+from m5.SimObject import *
+
+
+class ProbeSamplerArg(Enum):
+    vals = ["Packet", "CacheAccess", "AccessLatency", "Count"]
+
+
+class ProbeSampler(SimObject):
+    """Sample one notification every period of a set of probe points,
+    such as the PktRequest probes of CommMonitors, the Hit and Miss
+    probes of caches, the AccessLatency probes of memory controllers or
+    the DataAccessLatency probes of O3 CPUs.
+
+    Samples are kept in a buffer per probe point until collect() returns
+    them as a NumPy structured array with the fields tick, addr, pc,
+    value (the requestor of packets, the latency of accesses or the
+    count of PMU probes), size, source (an index in sources()) and flags
+    (1 for reads, 2 for writes), e.g.:
+
+        while exit_event.getCause() == "simulate() limit reached":
+            exit_event = m5.simulate(interval)
+            process(sampler.getCCObject().collect())
+    """
+
+    type = "ProbeSampler"
+    cxx_header = "mem/probes/sampler.hh"
+    cxx_class = "gem5::ProbeSampler"
+
+    cxx_exports = [
+        PyBindMethod("collect"),
+        PyBindMethod("disable"),
+        PyBindMethod("dropped"),
+        PyBindMethod("enable"),
+        PyBindMethod("setPeriod"),
+        PyBindMethod("sources"),
+    ]
+
+    manager = VectorParam.SimObject(
+        Parent.any, "Probe manager(s) to instrument"
+    )
+    probe_names = VectorParam.String(
+        ["PktRequest"], "Probe points to sample on every manager"
+    )
+    arg_type = Param.ProbeSamplerArg(
+        "Packet", "Argument type of all the probe points"
+    )
+    period = Param.Unsigned(1000, "Sample one notification out of period")
+    buffer_size = Param.Unsigned(
+        65536, "Samples kept per probe point between collections"
+    )
+    start_enabled = Param.Bool(True, "Sample from the start of simulation")
@@ -38,6 +38,10 @@ from m5.params import *
 from m5.proxy import *
 
 
+class StackDistEngine(ScopedEnum):
+    vals = ["Tree", "Fenwick"]
+
+
 class StackDistProbe(BaseMemProbe):
     type = "StackDistProbe"
     cxx_header = "mem/probes/stack_dist.hh"
@@ -53,6 +57,21 @@ class StackDistProbe(BaseMemProbe):
         "equal to the system's line size)",
     )
 
+    # Tree keeps the full LRU stack and supports verification, Fenwick
+    # counts the distinct addresses in O(log n) per access and can
+    # sample addresses to bound its memory usage
+    engine = Param.StackDistEngine(
+        "Tree", "Algorithm used to calculate the stack distances"
+    )
+    sample_rate = Param.Float(
+        1.0, "Fraction of the lines sampled by the Fenwick engine"
+    )
+    max_lines = Param.Unsigned(
+        0,
+        "Largest number of lines tracked by the Fenwick engine, "
+        "lowering the sampling rate as needed (0 for no bound)",
+    )
+
     # enable verification stack
     verify = Param.Bool(
         False, "Verify behaviuor with reference implementation"
@@ -38,6 +38,7 @@
 #include "mem/probes/mem_trace.hh"
 
 #include "base/callback.hh"
+#include "base/logging.hh"
 #include "base/output.hh"
 #include "params/MemTraceProbe.hh"
 #include "proto/packet.pb.h"
@@ -52,7 +53,9 @@ MemTraceProbe::MemTraceProbe(const MemTraceProbeParams &p)
     : BaseMemProbe(p),
       traceStream(nullptr),
       system(p.system),
-      withPC(p.with_pc)
+      withPC(p.with_pc),
+      recording(p.start_enabled),
+      startTick(0)
 {
     std::string filename;
     if (p.trace_file != "") {
@@ -105,14 +108,33 @@ MemTraceProbe::closeStreams()
 {
     if (traceStream != NULL)
         delete traceStream;
+    traceStream = nullptr;
+}
+
+void
+MemTraceProbe::startRecording()
+{
+    fatal_if(!traceStream, "%s cannot record to a closed trace.\n", name());
+    recording = true;
+    startTick = curTick();
+}
+
+void
+MemTraceProbe::stopRecording()
+{
+    recording = false;
+    closeStreams();
 }
 
 void
 MemTraceProbe::handleRequest(const probing::PacketInfo &pkt_info)
 {
+    if (!recording)
+        return;
+
     ProtoMessage::Packet pkt_msg;
 
-    pkt_msg.set_tick(curTick());
+    pkt_msg.set_tick(curTick() - startTick);
     pkt_msg.set_cmd(pkt_info.cmd.toInt());
     pkt_msg.set_flags(pkt_info.flags);
     pkt_msg.set_addr(pkt_info.addr);
@@ -64,6 +64,20 @@ class MemTraceProbe : public BaseMemProbe
 
     void startup() override;
 
+  public:
+
+    /**
+     * Start recording requests. The ticks of the trace are relative to
+     * the current tick.
+     */
+    void startRecording();
+
+    /**
+     * Stop recording requests, and close the trace. Recording cannot
+     * be started again once the trace is closed.
+     */
+    void stopRecording();
+
   protected:
 
     /** Trace output stream */
@@ -75,6 +89,12 @@ class MemTraceProbe : public BaseMemProbe
 
     /** Include the Program Counter in the memory trace */
     const bool withPC;
+
+    /** Whether requests are currently recorded */
+    bool recording;
+
+    /** Tick the recording started at */
+    Tick startTick;
 };
 
 } // namespace gem5
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/probes/sampler.hh"
+
+#include <algorithm>
+
+#include "pybind11/numpy.h"
+
+#include "base/logging.hh"
+#include "mem/cache/cache_probe_arg.hh"
+#include "params/ProbeSampler.hh"
+#include "sim/cur_tick.hh"
+#include "sim/probe/mem.hh"
+#include "sim/probe/pmu.hh"
+
+namespace py = pybind11;
+
+namespace gem5
+{
+
+/** Sampling state and buffer of a probe point */
+class ProbeSampler::Listener
+{
+  public:
+    Listener(ProbeSampler &_sampler, uint16_t _source,
+             const std::string &_source_name)
+        : sourceName(_source_name), dropped(0),
+          countdown(_sampler.period), sampler(_sampler), source(_source)
+    {
+        samples.reserve(sampler.bufferSize);
+    }
+
+    virtual ~Listener() = default;
+
+    const std::string sourceName;
+    std::vector<Sample> samples;
+    uint64_t dropped;
+    unsigned countdown;
+
+  protected:
+    /**
+     * Count a notification.
+     *
+     * @return The sample to fill, or nullptr if the notification is
+     * not sampled.
+     */
+    Sample *
+    sample()
+    {
+        if (!sampler.sampling || --countdown)
+            return nullptr;
+        countdown = sampler.period;
+
+        if (samples.size() >= sampler.bufferSize) {
+            dropped++;
+            return nullptr;
+        }
+
+        Sample &s = samples.emplace_back();
+        s.tick = curTick();
+        s.source = source;
+        return &s;
+    }
+
+  private:
+    ProbeSampler &sampler;
+    const uint16_t source;
+};
+
+namespace
+{
+
+uint16_t
+cmdFlags(const MemCmd &cmd)
+{
+    return (cmd.isRead() ? ProbeSampler::Read : 0) |
+        (cmd.isWrite() ? ProbeSampler::Write : 0);
+}
+
+void
+fill(ProbeSampler::Sample &s, const probing::PacketInfo &info)
+{
+    s.addr = info.addr;
+    s.pc = info.pc;
+    s.value = info.id;
+    s.size = info.size;
+    s.flags = cmdFlags(info.cmd);
+}
+
+void
+fill(ProbeSampler::Sample &s, const CacheAccessProbeArg &arg)
+{
+    const PacketPtr pkt = arg.pkt;
+    s.addr = pkt->getAddr();
+    s.pc = pkt->req->hasPC() ? pkt->req->getPC() : 0;
+    s.value = pkt->req->requestorId();
+    s.size = pkt->getSize();
+    s.flags = cmdFlags(pkt->cmd);
+}
+
+void
+fill(ProbeSampler::Sample &s, const probing::AccessLatencyInfo &info)
+{
+    s.addr = info.addr;
+    s.pc = info.pc;
+    s.value = info.latency;
+    s.size = info.size;
+    s.flags = info.isRead ? ProbeSampler::Read : ProbeSampler::Write;
+}
+
+void
+fill(ProbeSampler::Sample &s, const uint64_t &count)
+{
+    s.value = count;
+}
+
+template <typename Arg>
+class ArgListener : public ProbeSampler::Listener,
+                    public ProbeListenerArgBase<Arg>
+{
+  public:
+    ArgListener(ProbeSampler &sampler, uint16_t source, ProbeManager *pm,
+                const std::string &probe, const std::string &source_name)
+        : Listener(sampler, source, source_name),
+          ProbeListenerArgBase<Arg>(pm, probe)
+    {}
+
+    void
+    notify(const Arg &arg) override
+    {
+        if (ProbeSampler::Sample *s = sample())
+            fill(*s, arg);
+    }
+};
+
+} // anonymous namespace
+
+ProbeSampler::ProbeSampler(const ProbeSamplerParams &p)
+    : SimObject(p), sampling(p.start_enabled), period(p.period),
+      bufferSize(p.buffer_size)
+{
+    fatal_if(period == 0, "%s: The sampling period must not be 0.", name());
+}
+
+ProbeSampler::~ProbeSampler()
+{
+}
+
+void
+ProbeSampler::regProbeListeners()
+{
+    const ProbeSamplerParams &p =
+        dynamic_cast<const ProbeSamplerParams &>(params());
+
+    for (auto *obj : p.manager) {
+        ProbeManager *const mgr = obj->getProbeManager();
+        for (const auto &probe : p.probe_names) {
+            fatal_if(listeners.size() > UINT16_MAX,
+                     "%s: Too many probe points.", name());
+            const uint16_t source = listeners.size();
+            const std::string source_name = obj->name() + "." + probe;
+
+            Listener *l = nullptr;
+            switch (p.arg_type) {
+              case enums::Packet:
+                l = new ArgListener<probing::PacketInfo>(
+                    *this, source, mgr, probe, source_name);
+                break;
+              case enums::CacheAccess:
+                l = new ArgListener<CacheAccessProbeArg>(
+                    *this, source, mgr, probe, source_name);
+                break;
+              case enums::AccessLatency:
+                l = new ArgListener<probing::AccessLatencyInfo>(
+                    *this, source, mgr, probe, source_name);
+                break;
+              case enums::Count:
+                l = new ArgListener<uint64_t>(
+                    *this, source, mgr, probe, source_name);
+                break;
+              default:
+                panic("Unknown probe argument type.");
+            }
+            listeners.emplace_back(l);
+        }
+    }
+}
+
+void
+ProbeSampler::setPeriod(unsigned _period)
+{
+    fatal_if(_period == 0, "%s: The sampling period must not be 0.",
+             name());
+    period = _period;
+    for (auto &l : listeners)
+        l->countdown = period;
+}
+
+std::vector<std::string>
+ProbeSampler::sources() const
+{
+    std::vector<std::string> names;
+    for (const auto &l : listeners)
+        names.push_back(l->sourceName);
+    return names;
+}
+
+uint64_t
+ProbeSampler::dropped() const
+{
+    uint64_t total = 0;
+    for (const auto &l : listeners)
+        total += l->dropped;
+    return total;
+}
+
+py::object
+ProbeSampler::collect()
+{
+    static bool dtype_registered = false;
+    if (!dtype_registered) {
+        PYBIND11_NUMPY_DTYPE(Sample, tick, addr, pc, value, size, source,
+                             flags);
+        dtype_registered = true;
+    }
+
+    size_t total = 0;
+    for (const auto &l : listeners)
+        total += l->samples.size();
+
+    py::array_t<Sample> array(total);
+    Sample *const out = array.mutable_data();
+    Sample *end = out;
+    for (auto &l : listeners) {
+        end = std::copy(l->samples.begin(), l->samples.end(), end);
+        l->samples.clear();
+    }
+    std::stable_sort(out, end, [](const Sample &a, const Sample &b) {
+        return a.tick < b.tick;
+    });
+
+    return std::move(array);
+}
+
+} // namespace gem5
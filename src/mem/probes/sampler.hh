@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_PROBES_SAMPLER_HH__
+#define __MEM_PROBES_SAMPLER_HH__
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "pybind11/pybind11.h"
+
+#include "base/compiler.hh"
+#include "base/types.hh"
+#include "sim/sim_object.hh"
+
+namespace gem5
+{
+
+struct ProbeSamplerParams;
+
+/**
+ * PMU-like sampling of probe points.
+ *
+ * Instead of running a custom listener on every notification, the
+ * sampler keeps a small fixed-size record of one notification every
+ * period, for any number of probe points sharing an argument type.
+ * Each probe point has its own buffer, only written by the thread
+ * notifying it, so sampling takes no lock. The buffers are emptied
+ * from Python between simulation steps with collect(), which returns a
+ * NumPy structured array. A full buffer drops new samples until then.
+ */
+class GEM5_LOCAL ProbeSampler : public SimObject
+{
+  public:
+    enum SampleFlags : uint16_t
+    {
+        Read = 0x1,
+        Write = 0x2,
+    };
+
+    struct Sample
+    {
+        Tick tick;
+        Addr addr;
+        Addr pc;
+        /** Requestor, latency or count, depending on the argument */
+        uint64_t value;
+        uint32_t size;
+        /** Index of the probe point in sources() */
+        uint16_t source;
+        uint16_t flags;
+    };
+
+    class Listener;
+
+    ProbeSampler(const ProbeSamplerParams &p);
+    ~ProbeSampler();
+
+    void regProbeListeners() override;
+
+  public: // Python API
+    void enable() { sampling = true; }
+    void disable() { sampling = false; }
+    void setPeriod(unsigned period);
+
+    /** @return Name of the probe point of each source index. */
+    std::vector<std::string> sources() const;
+
+    /** @return Number of samples dropped on full buffers. */
+    uint64_t dropped() const;
+
+    /**
+     * Take the samples of all probe points, in tick order. This must
+     * not be called while the simulation is running.
+     */
+    pybind11::object collect();
+
+  private:
+    std::vector<std::unique_ptr<Listener>> listeners;
+
+    bool sampling;
+    unsigned period;
+    const size_t bufferSize;
+};
+
+} // namespace gem5
+
+#endif // __MEM_PROBES_SAMPLER_HH__
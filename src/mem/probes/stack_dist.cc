@@ -48,9 +48,13 @@ StackDistProbe::StackDistProbe(const StackDistProbeParams &p)
       lineSize(p.line_size),
       disableLinearHists(p.disable_linear_hists),
       disableLogHists(p.disable_log_hists),
+      engine(p.engine),
       calc(p.verify),
+      reuseCalc(p.sample_rate, p.max_lines),
       stats(this)
 {
+    fatal_if(p.verify && engine != StackDistEngine::Tree,
+             "Only the Tree stack distance engine can be verified.");
     fatal_if(p.system->cacheLineSize() > p.line_size,
              "The stack distance probe must use a cache line size that is "
              "larger or equal to the system's cache line size.");
@@ -107,7 +111,15 @@ StackDistProbe::handleRequest(const probing::PacketInfo &pkt_info)
     const Addr aligned_addr(roundDown(pkt_info.addr, lineSize));
 
     // Calculate the stack distance
-    const uint64_t sd(calc.calcStackDistAndUpdate(aligned_addr).first);
+    uint64_t sd;
+    if (engine == StackDistEngine::Fenwick) {
+        sd = reuseCalc.access(aligned_addr);
+        if (sd == ReuseDistCalc::NotSampled)
+            return;
+    } else {
+        sd = calc.calcStackDistAndUpdate(aligned_addr).first;
+    }
+
     if (sd == StackDistCalc::Infinity) {
         stats.infiniteSD++;
         return;
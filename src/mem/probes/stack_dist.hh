@@ -38,8 +38,10 @@
 #ifndef __MEM_PROBES_STACK_DIST_HH__
 #define __MEM_PROBES_STACK_DIST_HH__
 
+#include "enums/StackDistEngine.hh"
 #include "mem/packet.hh"
 #include "mem/probes/base.hh"
+#include "mem/reuse_dist_calc.hh"
 #include "mem/stack_dist_calc.hh"
 #include "sim/stats.hh"
 
@@ -66,8 +68,12 @@ class StackDistProbe : public BaseMemProbe
     // Disable the logarithmic histograms
     const bool disableLogHists;
 
+    // Algorithm used to calculate the stack distances
+    const StackDistEngine engine;
+
   protected:
     StackDistCalc calc;
+    ReuseDistCalc reuseCalc;
 
     struct StackDistProbeStats : public statistics::Group
     {
@@ -37,6 +37,8 @@
 
 #include "mem/qos/mem_ctrl.hh"
 
+#include <algorithm>
+
 #include "mem/qos/policy.hh"
 #include "mem/qos/q_policy.hh"
 #include "mem/qos/turnaround_policy.hh"
@@ -113,7 +115,7 @@ MemCtrl::logRequest(BusState dir, RequestorID id, uint8_t _qos,
 
     packetPriorities[id][_qos] += entries;
     for (auto j = 0; j < entries; ++j) {
-        requestTimes[id][addr].push_back(curTick());
+        requestTimes[id].push_back({addr, curTick(), false});
     }
 
     // Record statistics
@@ -173,22 +175,23 @@ MemCtrl::logResponse(BusState dir, RequestorID id, uint8_t _qos,
 
     packetPriorities[id][_qos] -= entries;
 
+    auto &request_times = requestTimes[id];
     for (auto j = 0; j < entries; ++j) {
-        auto it = requestTimes[id].find(addr);
-        panic_if(it == requestTimes[id].end(),
+        auto it = std::find_if(request_times.begin(), request_times.end(),
+            [addr](const RequestTime &request)
+            { return !request.responded && request.addr == addr; });
+        panic_if(it == request_times.end(),
                  "qos::MemCtrl::logResponse requestor %s unmatched response "
                  "for address %#x received", requestors[id], addr);
 
         // Load request time
-        uint64_t requestTime = it->second.front();
-
-        // Remove request entry
-        it->second.pop_front();
+        uint64_t requestTime = it->tick;
 
-        // Remove whole address entry if last one
-        if (it->second.empty()) {
-            requestTimes[id].erase(it);
-        }
+        // Remove request entry, along with the older ones which already
+        // got their response
+        it->responded = true;
+        while (!request_times.empty() && request_times.front().responded)
+            request_times.pop_front();
         // Compute latency
         double latency = (double) (curTick() + delay - requestTime)
                 / sim_clock::as_float::s;
@@ -274,8 +277,17 @@ void
 MemCtrl::addRequestor(RequestorID id)
 {
     if (!hasRequestor(id)) {
-        requestors.emplace(id, _system->getRequestorName(id));
+        if (id >= requestors.size()) {
+            // Make room for all the requestors of the system at once
+            size_t num_requestors =
+                std::max<size_t>(id + 1, _system->maxRequestors());
+            requestors.resize(num_requestors);
+            packetPriorities.resize(num_requestors);
+            requestTimes.resize(num_requestors);
+        }
+        requestors[id] = _system->getRequestorName(id);
         packetPriorities[id].resize(numPriorities(), 0);
+        activeRequestors.push_back(id);
 
         DPRINTF(QOS,
                 "qos::MemCtrl::addRequestor registering"
@@ -41,7 +41,7 @@
 #include <cstdint>
 #include <deque>
 #include <memory>
-#include <unordered_map>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -104,15 +104,33 @@ class MemCtrl : public ClockedObject
      */
     const bool qosSyncroScheduler;
 
-    /** Hash of requestor ID - requestor name */
-    std::unordered_map<RequestorID, const std::string> requestors;
+    /**
+     * Requestor ID - requestor name, empty for the requestors which have
+     * not been registered
+     */
+    std::vector<std::string> requestors;
 
-    /** Hash of requestors - number of packets queued per priority */
-    std::unordered_map<RequestorID, std::vector<uint64_t> > packetPriorities;
+    /** IDs of the registered requestors, in registration order */
+    std::vector<RequestorID> activeRequestors;
 
-    /** Hash of requestors - address of request - queue of times of request */
-    std::unordered_map<RequestorID,
-            std::unordered_map<uint64_t, std::deque<uint64_t>> > requestTimes;
+    /** Requestor ID - number of packets queued per priority */
+    std::vector<std::vector<uint64_t>> packetPriorities;
+
+    /** An entry of a request waiting for its response */
+    struct RequestTime
+    {
+        Addr addr;
+        Tick tick;
+        bool responded;
+    };
+
+    /**
+     * Requestor ID - outstanding requests in arrival order.  A response
+     * matches the oldest request to its address.  Responded entries are
+     * left in place until they reach the front, so a response only costs
+     * a search through the requests queued for its requestor.
+     */
+    std::vector<std::deque<RequestTime>> requestTimes;
 
     /**
      * Vector of QoS priorities/last service time. Refreshed at every
@@ -314,7 +332,7 @@ class MemCtrl : public ClockedObject
      */
     bool hasRequestor(RequestorID id) const
     {
-        return requestors.find(id) != requestors.end();
+        return id < requestors.size() && !requestors[id].empty();
     }
 
     /**
@@ -505,20 +523,20 @@ MemCtrl::qosSchedule(std::initializer_list<Queues*> queues,
 
     if (qosSyncroScheduler) {
         // Call the scheduling function on all other requestors.
-        for (const auto& requestor : requestors) {
+        for (RequestorID requestor : activeRequestors) {
 
-            if (requestor.first == pkt->requestorId())
+            if (requestor == pkt->requestorId())
                 continue;
 
-            uint8_t prio = schedule(requestor.first, 0);
+            uint8_t prio = schedule(requestor, 0);
 
             if (qosPriorityEscalation) {
                 DPRINTF(QOS,
                         "qos::MemCtrl::qosSchedule: (syncro) escalating "
                         "REQUESTOR %s to assigned priority %d\n",
-                        _system->getRequestorName(requestor.first),
+                        _system->getRequestorName(requestor),
                         prio);
-                escalate(queues, queue_entry_size, requestor.first, prio);
+                escalate(queues, queue_entry_size, requestor, prio);
             }
         }
     }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/reuse_dist_calc.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+ReuseDistCalc::ReuseDistCalc(double sample_rate, size_t max_lines)
+    : threshold(std::llround(sample_rate * HashRange)),
+      maxLines(max_lines), tree(InitialSlots + 1, 0), nextSlot(0)
+{
+    fatal_if(sample_rate <= 0 || sample_rate > 1,
+             "The sampling rate must be in (0, 1], not %f.", sample_rate);
+    threshold = std::max<uint64_t>(threshold, 1);
+}
+
+uint64_t
+ReuseDistCalc::hash(Addr addr)
+{
+    // Finalizer of splitmix64, which mixes all the address bits
+    uint64_t h = addr;
+    h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h >> 40;
+}
+
+void
+ReuseDistCalc::add(size_t slot, int delta)
+{
+    for (size_t i = slot + 1; i < tree.size(); i += i & -i)
+        tree[i] += delta;
+}
+
+uint64_t
+ReuseDistCalc::prefix(size_t slot) const
+{
+    uint64_t sum = 0;
+    for (size_t i = slot; i > 0; i -= i & -i)
+        sum += tree[i];
+    return sum;
+}
+
+void
+ReuseDistCalc::compact()
+{
+    std::vector<std::pair<uint64_t, Addr>> live;
+    live.reserve(lastSlot.size());
+    for (const auto &[addr, slot] : lastSlot)
+        live.emplace_back(slot, addr);
+    std::sort(live.begin(), live.end());
+
+    const size_t slots = std::max(InitialSlots, 2 * live.size());
+    tree.assign(slots + 1, 0);
+    for (size_t i = 0; i < live.size(); i++) {
+        lastSlot[live[i].second] = i;
+        tree[i + 1] = 1;
+    }
+    // Build the tree in place by pushing every node to its parent
+    for (size_t i = 1; i <= slots; i++) {
+        const size_t parent = i + (i & -i);
+        if (parent <= slots)
+            tree[parent] += tree[i];
+    }
+    nextSlot = live.size();
+}
+
+void
+ReuseDistCalc::evict()
+{
+    while (lastSlot.size() > maxLines) {
+        threshold = byHash.top().first;
+        while (!byHash.empty() && byHash.top().first >= threshold) {
+            auto it = lastSlot.find(byHash.top().second);
+            add(it->second, -1);
+            lastSlot.erase(it);
+            byHash.pop();
+        }
+    }
+}
+
+uint64_t
+ReuseDistCalc::access(Addr addr)
+{
+    const uint64_t h = hash(addr);
+    if (h >= threshold)
+        return NotSampled;
+
+    if (nextSlot + 1 >= tree.size())
+        compact();
+
+    const uint64_t slot = nextSlot++;
+    auto [it, inserted] = lastSlot.try_emplace(addr, slot);
+    uint64_t dist = Infinity;
+    if (!inserted) {
+        const uint64_t distinct = prefix(slot) - prefix(it->second + 1);
+        add(it->second, -1);
+        it->second = slot;
+        // Scale the distance by the sampling rate, as SHARDS does
+        dist = distinct * HashRange / threshold;
+    }
+    add(slot, 1);
+
+    if (inserted && maxLines) {
+        byHash.emplace(h, addr);
+        evict();
+    }
+    return dist;
+}
+
+} // namespace gem5
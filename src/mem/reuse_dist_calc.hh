@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_REUSE_DIST_CALC_HH__
+#define __MEM_REUSE_DIST_CALC_HH__
+
+#include <cstdint>
+#include <limits>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * Stack (reuse) distance calculator counting the distinct addresses
+ * accessed since the previous access to the same address.
+ *
+ * Every access is given a slot in a Fenwick tree, and the tree holds
+ * a one for the slot of the latest access to each address. The stack
+ * distance of an access is the number of ones between the slot of the
+ * previous access to its address and the current slot, so an access
+ * is a hash map lookup and two O(log n) tree walks, without any
+ * allocation. When the slots run out, the live ones are renumbered to
+ * the start of the tree, which keeps the tree proportional to the
+ * number of distinct addresses.
+ *
+ * The calculator can sample addresses spatially like SHARDS
+ * (Waldspurger et al., FAST'15): only the addresses whose hash is
+ * below a threshold are tracked, and their distances are scaled back
+ * by the sampling rate. With a bound on the number of tracked
+ * addresses, the threshold is lowered, and the addresses with the
+ * largest hashes evicted, whenever the bound is exceeded, which keeps
+ * the memory used constant on arbitrarily long traces.
+ *
+ * Unlike StackDistCalc, addresses cannot be marked or removed.
+ */
+class ReuseDistCalc
+{
+  public:
+    /** Distance of the first access to an address */
+    static constexpr uint64_t Infinity = std::numeric_limits<uint64_t>::max();
+
+    /** Returned for the accesses to addresses that are not sampled */
+    static constexpr uint64_t NotSampled = Infinity - 1;
+
+    /**
+     * @param sample_rate Fraction of the addresses to track, in (0, 1].
+     * @param max_lines Largest number of addresses to track, or 0 for
+     *        no bound.
+     */
+    ReuseDistCalc(double sample_rate = 1.0, size_t max_lines = 0);
+
+    /**
+     * Account for an access to an address.
+     *
+     * @return The estimated stack distance of the access, Infinity for
+     *         the first access to the address, or NotSampled.
+     */
+    uint64_t access(Addr addr);
+
+    /** @return The current fraction of the addresses tracked. */
+    double sampleRate() const { return double(threshold) / HashRange; }
+
+    /** @return The number of addresses tracked. */
+    size_t trackedLines() const { return lastSlot.size(); }
+
+  private:
+    /** Range of the address hashes used for sampling */
+    static constexpr uint64_t HashRange = uint64_t(1) << 24;
+
+    /** Number of slots of the tree when it is created */
+    static constexpr size_t InitialSlots = 1024;
+
+    static uint64_t hash(Addr addr);
+
+    /** Add delta to the slot */
+    void add(size_t slot, int delta);
+    /** @return The number of live slots before slot. */
+    uint64_t prefix(size_t slot) const;
+
+    /** Renumber the live slots from 0, once all the slots are used. */
+    void compact();
+
+    /** Lower the threshold until maxLines addresses are tracked. */
+    void evict();
+
+    /** Addresses are tracked if their hash is below threshold */
+    uint64_t threshold;
+    const size_t maxLines;
+
+    /** Slot of the last access of every tracked address */
+    std::unordered_map<Addr, uint64_t> lastSlot;
+
+    /** Fenwick tree over the slots, indexed from 1 */
+    std::vector<uint32_t> tree;
+    /** Next slot to use */
+    uint64_t nextSlot;
+
+    /** Tracked addresses by hash, if the number of them is bounded */
+    std::priority_queue<std::pair<uint64_t, Addr>> byHash;
+};
+
+} // namespace gem5
+
+#endif // __MEM_REUSE_DIST_CALC_HH__
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <random>
+
+#include "mem/reuse_dist_calc.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Reference LRU stack, where the distance is the position in it */
+class NaiveStack
+{
+  public:
+    uint64_t
+    access(Addr addr)
+    {
+        auto it = std::find(stack.begin(), stack.end(), addr);
+        uint64_t dist = ReuseDistCalc::Infinity;
+        if (it != stack.end()) {
+            dist = std::distance(stack.begin(), it);
+            stack.erase(it);
+        }
+        stack.push_front(addr);
+        return dist;
+    }
+
+  private:
+    std::list<Addr> stack;
+};
+
+} // anonymous namespace
+
+TEST(ReuseDistCalcTest, Simple)
+{
+    ReuseDistCalc calc;
+    EXPECT_EQ(calc.access(0x0), ReuseDistCalc::Infinity);
+    EXPECT_EQ(calc.access(0x40), ReuseDistCalc::Infinity);
+    EXPECT_EQ(calc.access(0x80), ReuseDistCalc::Infinity);
+    EXPECT_EQ(calc.access(0x80), 0);
+    EXPECT_EQ(calc.access(0x0), 2);
+    EXPECT_EQ(calc.access(0x40), 2);
+    EXPECT_EQ(calc.access(0x40), 0);
+    EXPECT_EQ(calc.trackedLines(), 3);
+}
+
+/** Compare random accesses against the reference, across compactions */
+TEST(ReuseDistCalcTest, MatchesReference)
+{
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<Addr> line(0, 3000);
+    ReuseDistCalc calc;
+    NaiveStack ref;
+    for (int i = 0; i < 50000; i++) {
+        const Addr addr = line(rng) * 64;
+        ASSERT_EQ(calc.access(addr), ref.access(addr)) << "access " << i;
+    }
+}
+
+/** Sampled distances are scaled back to estimate the exact ones */
+TEST(ReuseDistCalcTest, Sampled)
+{
+    ReuseDistCalc calc(0.25);
+    const int lines = 20000;
+    for (Addr a = 0; a < lines; a++)
+        calc.access(a * 64);
+
+    int sampled = 0;
+    for (Addr a = 0; a < lines; a++) {
+        const uint64_t dist = calc.access(a * 64);
+        if (dist == ReuseDistCalc::NotSampled)
+            continue;
+        sampled++;
+        // The exact distance of a cyclic sweep is lines - 1
+        EXPECT_NEAR(double(dist), lines - 1, lines * 0.1);
+    }
+    EXPECT_NEAR(sampled, lines / 4, lines / 40);
+    EXPECT_EQ(calc.trackedLines(), sampled);
+}
+
+/** The number of tracked addresses never exceeds the bound */
+TEST(ReuseDistCalcTest, Bounded)
+{
+    ReuseDistCalc calc(1.0, 512);
+    const int lines = 20000;
+    for (int pass = 0; pass < 2; pass++) {
+        for (Addr a = 0; a < lines; a++) {
+            const uint64_t dist = calc.access(a * 64);
+            ASSERT_LE(calc.trackedLines(), 512);
+            if (pass == 1 && dist != ReuseDistCalc::NotSampled) {
+                EXPECT_NEAR(double(dist), lines - 1, lines * 0.2);
+            }
+        }
+    }
+    EXPECT_LT(calc.sampleRate(), 512.0 / lines * 1.2);
+    EXPECT_GT(calc.trackedLines(), 256);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/row_buffer_mem.hh"
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+RowBufferMemory::RowBufferMemory(const RowBufferMemoryParams &p) :
+    SimpleMemory(p), banks(p.banks),
+    rowBufferSize(p.row_buffer_size),
+    rowActivateLatency(p.row_activate_latency),
+    rowPrechargeLatency(p.row_precharge_latency),
+    rowStats(*this)
+{
+    fatal_if(banks.empty(), "%s: needs at least one bank\n", name());
+    fatal_if(rowBufferSize == 0, "%s: row buffer size must be non-zero\n",
+             name());
+}
+
+Tick
+RowBufferMemory::getLatency(const PacketPtr pkt)
+{
+    const Addr offset = range.getOffset(pkt->getAddr());
+    const Addr row_index = offset / rowBufferSize;
+    Bank &bank = banks[row_index % banks.size()];
+    const Addr row = row_index / banks.size();
+
+    const Tick now = curTick();
+    const Tick wait = bank.readyAt > now ? bank.readyAt - now : 0;
+
+    Tick row_latency = 0;
+    if (bank.openRow == row) {
+        ++rowStats.rowHits;
+    } else {
+        if (bank.openRow == NoRow) {
+            ++rowStats.rowEmpty;
+        } else {
+            ++rowStats.rowConflicts;
+            row_latency += rowPrechargeLatency;
+        }
+        row_latency += rowActivateLatency;
+        bank.openRow = row;
+        bank.readyAt = now + wait + row_latency;
+    }
+    rowStats.bankWaitTicks += wait;
+
+    return SimpleMemory::getLatency(pkt) + wait + row_latency;
+}
+
+RowBufferMemory::RowBufferMemoryStats::RowBufferMemoryStats(
+        RowBufferMemory &mem)
+    : statistics::Group(&mem),
+    ADD_STAT(rowHits, statistics::units::Count::get(),
+             "Number of accesses that hit in the open row"),
+    ADD_STAT(rowEmpty, statistics::units::Count::get(),
+             "Number of accesses to a precharged bank"),
+    ADD_STAT(rowConflicts, statistics::units::Count::get(),
+             "Number of accesses that closed another row"),
+    ADD_STAT(bankWaitTicks, statistics::units::Tick::get(),
+             "Ticks spent waiting for a bank to open a row"),
+    ADD_STAT(rowHitRate, statistics::units::Ratio::get(),
+             "Fraction of accesses that hit in the open row",
+             rowHits / (rowHits + rowEmpty + rowConflicts))
+{
+    rowHitRate.precision(4);
+}
+
+} // namespace memory
+} // namespace gem5
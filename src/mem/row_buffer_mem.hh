@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * RowBufferMemory declaration
+ */
+
+#ifndef __MEM_ROW_BUFFER_MEM_HH__
+#define __MEM_ROW_BUFFER_MEM_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/simple_mem.hh"
+#include "params/RowBufferMemory.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * A simple memory that adds a first-order model of DRAM row buffers
+ * on top of the fixed latency and bandwidth regulation of
+ * SimpleMemory. Every bank remembers its open row and the tick at
+ * which it is done opening it. A row hit costs the base latency, an
+ * access to a closed bank additionally pays the activate latency,
+ * and a row conflict pays for the precharge as well. Accesses to a
+ * bank that is still opening a row wait for it to finish. There is
+ * no command scheduling, refresh, or power modelling, which keeps
+ * the cost per access close to that of SimpleMemory.
+ *
+ * Addresses are mapped to banks with the row above the bank bits
+ * and the column in the low order bits, i.e. consecutive rows are
+ * spread over the banks (RoRaBaCo). Each instance models a single
+ * channel, and interleaved address ranges are used to build a
+ * multi-channel memory, just like with the DRAM controller.
+ *
+ * @sa \ref gem5MemorySystem "gem5 Memory System"
+ */
+class RowBufferMemory : public SimpleMemory
+{
+  private:
+
+    /** Row value used to mark a bank as precharged. */
+    static constexpr Addr NoRow = MaxAddr;
+
+    struct Bank
+    {
+        /** The row currently held in the row buffer, if any. */
+        Addr openRow = NoRow;
+
+        /** Tick at which the bank has finished opening the row. */
+        Tick readyAt = 0;
+    };
+
+    std::vector<Bank> banks;
+
+    /** Size of the row buffer of a bank, in bytes. */
+    const Addr rowBufferSize;
+
+    /** Latency to open a row in a precharged bank. */
+    const Tick rowActivateLatency;
+
+    /** Latency to close the open row of a bank. */
+    const Tick rowPrechargeLatency;
+
+    struct RowBufferMemoryStats : public statistics::Group
+    {
+        RowBufferMemoryStats(RowBufferMemory &mem);
+
+        /** Number of accesses that hit in the open row */
+        statistics::Scalar rowHits;
+        /** Number of accesses to a precharged bank */
+        statistics::Scalar rowEmpty;
+        /** Number of accesses that had to close another row */
+        statistics::Scalar rowConflicts;
+        /** Ticks spent waiting for a bank to finish opening a row */
+        statistics::Scalar bankWaitTicks;
+        /** Fraction of accesses that hit in the open row */
+        statistics::Formula rowHitRate;
+    } rowStats;
+
+  protected:
+
+    Tick getLatency(const PacketPtr pkt) override;
+
+  public:
+
+    RowBufferMemory(const RowBufferMemoryParams &p);
+};
+
+} // namespace memory
+} // namespace gem5
+
+#endif //__MEM_ROW_BUFFER_MEM_HH__
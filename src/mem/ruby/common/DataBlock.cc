@@ -57,9 +57,7 @@ DataBlock::DataBlock(const DataBlock &cp)
 
     uint8_t *block_update;
     m_block_size = cp.getBlockSize();
-    m_data = new uint8_t[m_block_size];
-    memcpy(m_data, cp.m_data, m_block_size);
-    m_alloc = true;
+    copyData(cp);
     // If this data block is involved in an atomic operation, the effect
     // of applying the atomic operations on the data block are recorded in
     // m_atomicLog. If so, we must copy over every entry in the change log
@@ -79,11 +77,46 @@ DataBlock::alloc()
         return;
     }
 
-    m_data = new uint8_t[m_block_size];
+    if (m_block_size <= InlineSize) {
+        m_data = m_inline;
+    } else {
+        m_shared.reset(new uint8_t[m_block_size]);
+        m_data = m_shared.get();
+    }
     m_alloc = true;
     clear();
 }
 
+void
+DataBlock::copyData(const DataBlock &obj)
+{
+    assert(m_block_size == obj.getBlockSize());
+
+    if (obj.m_shared) {
+        m_shared = obj.m_shared;
+        m_data = m_shared.get();
+    } else {
+        if (m_block_size <= InlineSize) {
+            m_shared.reset();
+            m_data = m_inline;
+        } else {
+            m_shared.reset(new uint8_t[m_block_size]);
+            m_data = m_shared.get();
+        }
+        memcpy(m_data, obj.m_data, m_block_size);
+    }
+    m_alloc = true;
+}
+
+void
+DataBlock::unshare()
+{
+    std::shared_ptr<uint8_t[]> data(new uint8_t[m_block_size]);
+    memcpy(data.get(), m_data, m_block_size);
+    m_shared = std::move(data);
+    m_data = m_shared.get();
+}
+
 void
 DataBlock::realloc(int blk_size)
 {
@@ -91,7 +124,7 @@ DataBlock::realloc(int blk_size)
     assert(m_block_size > 0);
 
     if (m_alloc) {
-        delete [] m_data;
+        m_shared.reset();
         m_alloc = false;
     }
     alloc();
@@ -102,6 +135,7 @@ DataBlock::clear()
 {
     assert(m_alloc);
     assert(m_block_size > 0);
+    makeWritable();
     memset(m_data, 0, m_block_size);
 }
 
@@ -112,7 +146,7 @@ DataBlock::equal(const DataBlock& obj) const
     assert(m_block_size > 0);
     size_t block_bytes = m_block_size;
     // Check that the block contents match
-    if (memcmp(m_data, obj.m_data, block_bytes)) {
+    if (m_data != obj.m_data && memcmp(m_data, obj.m_data, block_bytes)) {
         return false;
     }
     if (m_atomicLog.size() != obj.m_atomicLog.size()) {
@@ -131,8 +165,9 @@ DataBlock::copyPartial(const DataBlock &dblk, const WriteMask &mask)
 {
     assert(m_alloc);
     assert(m_block_size > 0);
+    makeWritable();
     for (int i = 0; i < m_block_size; i++) {
-        if (mask.getMask(i, 1)) {
+        if (mask.test(i)) {
             m_data[i] = dblk.m_data[i];
         }
     }
@@ -144,9 +179,8 @@ DataBlock::atomicPartial(const DataBlock &dblk, const WriteMask &mask,
 {
     assert(m_alloc);
     assert(m_block_size > 0);
-    for (int i = 0; i < m_block_size; i++) {
-        m_data[i] = dblk.m_data[i];
-    }
+    makeWritable();
+    memcpy(m_data, dblk.m_data, m_block_size);
     mask.performAtomic(m_data, m_atomicLog, isAtomicNoReturn);
 }
 
@@ -174,7 +208,7 @@ DataBlock::popAtomicLogEntryFront()
 {
     assert(m_atomicLog.size() > 0);
     auto ret = m_atomicLog.front();
-    m_atomicLog.pop_front();
+    m_atomicLog.erase(m_atomicLog.begin());
     return ret;
 }
 void
@@ -200,6 +234,7 @@ uint8_t*
 DataBlock::getDataMod(int offset)
 {
     assert(m_alloc);
+    makeWritable();
     return &m_data[offset];
 }
 
@@ -207,6 +242,7 @@ void
 DataBlock::setData(const uint8_t *data, int offset, int len)
 {
     assert(m_alloc);
+    makeWritable();
     memcpy(&m_data[offset], data, len);
 }
 
@@ -217,34 +253,28 @@ DataBlock::setData(PacketPtr pkt)
     assert(m_block_size > 0);
     int offset = getOffset(pkt->getAddr(), floorLog2(m_block_size));
     assert(offset + pkt->getSize() <= m_block_size);
+    makeWritable();
     pkt->writeData(&m_data[offset]);
 }
 
 DataBlock &
 DataBlock::operator=(const DataBlock & obj)
 {
-    // Reallocate if needed
-    if (m_alloc && m_block_size != obj.getBlockSize()) {
-        delete [] m_data;
-        m_block_size = obj.getBlockSize();
-        alloc();
-    } else if (!m_alloc) {
-        m_block_size = obj.getBlockSize();
-        alloc();
+    if (this == &obj)
+        return *this;
 
-        // Assume this will be realloc'd later if zero.
-        if (m_block_size == 0) {
-            return *this;
-        }
-    } else {
-        assert(m_alloc && m_block_size == obj.getBlockSize());
+    // Assume this will be realloc'd later if zero.
+    if (obj.getBlockSize() == 0) {
+        assert(!m_alloc);
+        m_block_size = 0;
+        return *this;
     }
-    assert(m_block_size > 0);
+
+    m_block_size = obj.getBlockSize();
+    copyData(obj);
 
     uint8_t *block_update;
     size_t block_bytes = m_block_size;
-    // Copy entire block contents from obj to current block
-    memcpy(m_data, obj.m_data, block_bytes);
     // If this data block is involved in an atomic operation, the effect
     // of applying the atomic operations on the data block are recorded in
     // m_atomicLog. If so, we must copy over every entry in the change log
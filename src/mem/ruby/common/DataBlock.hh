@@ -44,9 +44,10 @@
 #include <inttypes.h>
 
 #include <cassert>
-#include <deque>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "mem/packet.hh"
 
@@ -76,9 +77,6 @@ class DataBlock
 
     ~DataBlock()
     {
-        if (m_alloc)
-            delete [] m_data;
-
         // If data block involved in atomic
         // operations, free all meta data
         for (auto log : m_atomicLog) {
@@ -113,22 +111,47 @@ class DataBlock
     void realloc(int blk_size);
 
   private:
+    /**
+     * Blocks of up to this many bytes are stored in the DataBlock
+     * itself. Larger blocks are allocated on the heap, and shared
+     * between copies of the block (e.g., in cloned messages) until one
+     * of the copies is written.
+     */
+    static constexpr int InlineSize = 64;
+
     void alloc();
+    void copyData(const DataBlock &obj);
+    void unshare();
+
+    /**
+     * Make sure the data is not shared with another block. This has to
+     * be called before modifying the data, and pointers to modifiable
+     * data must not be held across copies of the block.
+     */
+    void
+    makeWritable()
+    {
+        if (m_shared.use_count() > 1)
+            unshare();
+    }
+
     uint8_t *m_data = nullptr;
     bool m_alloc = false;
     int m_block_size = 0;
 
+    std::shared_ptr<uint8_t[]> m_shared;
+
     // Tracks block changes when atomic ops are applied
-    std::deque<uint8_t*> m_atomicLog;
+    std::vector<uint8_t*> m_atomicLog;
+
+    alignas(8) uint8_t m_inline[InlineSize];
 };
 
 inline void
 DataBlock::assign(uint8_t *data)
 {
     assert(data != NULL);
-    if (m_alloc) {
-        delete [] m_data;
-    }
+    m_shared.reset();
     m_data = data;
     m_alloc = false;
 }
@@ -144,6 +167,7 @@ inline void
 DataBlock::setByte(int whichByte, uint8_t data)
 {
     assert(m_alloc);
+    makeWritable();
     m_data[whichByte] = data;
 }
 
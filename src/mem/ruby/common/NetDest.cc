@@ -51,7 +51,7 @@ NetDest::NetDest(RubySystem *ruby_system)
 void
 NetDest::add(MachineID newElement)
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
     assert(bitIndex(newElement.num) < m_bits[vecIndex(newElement)].getSize());
     m_bits[vecIndex(newElement)].add(bitIndex(newElement.num));
 }
@@ -59,9 +59,9 @@ NetDest::add(MachineID newElement)
 void
 NetDest::addNetDest(const NetDest& netDest)
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == netDest.getSize());
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    assert(m_size == netDest.getSize());
+    for (int i = 0; i < m_size; i++) {
         m_bits[i].addSet(netDest.m_bits[i]);
     }
 }
@@ -80,16 +80,16 @@ NetDest::setNetDest(MachineType machine, const Set& set)
 void
 NetDest::remove(MachineID oldElement)
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
     m_bits[vecIndex(oldElement)].remove(bitIndex(oldElement.num));
 }
 
 void
 NetDest::removeNetDest(const NetDest& netDest)
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == netDest.getSize());
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    assert(m_size == netDest.getSize());
+    for (int i = 0; i < m_size; i++) {
         m_bits[i].removeSet(netDest.m_bits[i]);
     }
 }
@@ -97,8 +97,8 @@ NetDest::removeNetDest(const NetDest& netDest)
 void
 NetDest::clear()
 {
-    assert(m_bits.size() > 0);
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    for (int i = 0; i < m_size; i++) {
         m_bits[i].clear();
     }
 }
@@ -128,11 +128,11 @@ std::vector<NodeID>
 NetDest::getAllDest()
 {
     assert(m_ruby_system != nullptr);
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
 
     std::vector<NodeID> dest;
     dest.clear();
-    for (int i = 0; i < m_bits.size(); i++) {
+    for (int i = 0; i < m_size; i++) {
         for (int j = 0; j < m_bits[i].getSize(); j++) {
             if (m_bits[i].isElement(j)) {
                 int id = MachineType_base_number((MachineType)i) + j;
@@ -146,10 +146,10 @@ NetDest::getAllDest()
 int
 NetDest::count() const
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
 
     int counter = 0;
-    for (int i = 0; i < m_bits.size(); i++) {
+    for (int i = 0; i < m_size; i++) {
         counter += m_bits[i].count();
     }
     return counter;
@@ -158,16 +158,16 @@ NetDest::count() const
 NodeID
 NetDest::elementAt(MachineID index)
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
     return m_bits[vecIndex(index)].elementAt(bitIndex(index.num));
 }
 
 MachineID
 NetDest::smallestElement() const
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
     assert(count() > 0);
-    for (int i = 0; i < m_bits.size(); i++) {
+    for (int i = 0; i < m_size; i++) {
         for (NodeID j = 0; j < m_bits[i].getSize(); j++) {
             if (m_bits[i].isElement(j)) {
                 MachineID mach = {MachineType_from_base_level(i), j};
@@ -181,7 +181,7 @@ NetDest::smallestElement() const
 MachineID
 NetDest::smallestElement(MachineType machine) const
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
     assert(m_ruby_system != nullptr);
 
     int size = m_bits[MachineType_base_level(machine)].getSize();
@@ -199,8 +199,8 @@ NetDest::smallestElement(MachineType machine) const
 bool
 NetDest::isBroadcast() const
 {
-    assert(m_bits.size() > 0);
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    for (int i = 0; i < m_size; i++) {
         if (!m_bits[i].isBroadcast()) {
             return false;
         }
@@ -212,8 +212,8 @@ NetDest::isBroadcast() const
 bool
 NetDest::isEmpty() const
 {
-    assert(m_bits.size() > 0);
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    for (int i = 0; i < m_size; i++) {
         if (!m_bits[i].isEmpty()) {
             return false;
         }
@@ -225,11 +225,11 @@ NetDest::isEmpty() const
 NetDest
 NetDest::OR(const NetDest& orNetDest) const
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == orNetDest.getSize());
-    NetDest result(m_ruby_system);
-    for (int i = 0; i < m_bits.size(); i++) {
-        result.m_bits[i] = m_bits[i].OR(orNetDest.m_bits[i]);
+    assert(m_size > 0);
+    assert(m_size == orNetDest.getSize());
+    NetDest result(*this);
+    for (int i = 0; i < m_size; i++) {
+        result.m_bits[i].addSet(orNetDest.m_bits[i]);
     }
     return result;
 }
@@ -238,10 +238,10 @@ NetDest::OR(const NetDest& orNetDest) const
 NetDest
 NetDest::AND(const NetDest& andNetDest) const
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == andNetDest.getSize());
-    NetDest result(m_ruby_system);
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    assert(m_size == andNetDest.getSize());
+    NetDest result(*this);
+    for (int i = 0; i < m_size; i++) {
         result.m_bits[i] = m_bits[i].AND(andNetDest.m_bits[i]);
     }
     return result;
@@ -251,9 +251,9 @@ NetDest::AND(const NetDest& andNetDest) const
 bool
 NetDest::intersectionIsNotEmpty(const NetDest& other_netDest) const
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == other_netDest.getSize());
-    for (int i = 0; i < m_bits.size(); i++) {
+    assert(m_size > 0);
+    assert(m_size == other_netDest.getSize());
+    for (int i = 0; i < m_size; i++) {
         if (!m_bits[i].intersectionIsEmpty(other_netDest.m_bits[i])) {
             return true;
         }
@@ -264,10 +264,10 @@ NetDest::intersectionIsNotEmpty(const NetDest& other_netDest) const
 bool
 NetDest::isSuperset(const NetDest& test) const
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == test.getSize());
+    assert(m_size > 0);
+    assert(m_size == test.getSize());
 
-    for (int i = 0; i < m_bits.size(); i++) {
+    for (int i = 0; i < m_size; i++) {
         if (!m_bits[i].isSuperset(test.m_bits[i])) {
             return false;
         }
@@ -278,7 +278,7 @@ NetDest::isSuperset(const NetDest& test) const
 bool
 NetDest::isElement(MachineID element) const
 {
-    assert(m_bits.size() > 0);
+    assert(m_size > 0);
     return ((m_bits[vecIndex(element)])).isElement(bitIndex(element.num));
 }
 
@@ -287,10 +287,10 @@ NetDest::resize()
 {
     assert(m_ruby_system != nullptr);
 
-    m_bits.resize(MachineType_base_level(MachineType_NUM));
-    assert(m_bits.size() == MachineType_NUM);
+    m_size = MachineType_base_level(MachineType_NUM);
+    assert(m_size == MachineType_NUM);
 
-    for (int i = 0; i < m_bits.size(); i++) {
+    for (int i = 0; i < m_size; i++) {
         m_bits[i].setSize(MachineType_base_count((MachineType)i));
     }
 }
@@ -298,10 +298,10 @@ NetDest::resize()
 void
 NetDest::print(std::ostream& out) const
 {
-    assert(m_bits.size() > 0);
-    out << "[NetDest (" << m_bits.size() << ") ";
+    assert(m_size > 0);
+    out << "[NetDest (" << m_size << ") ";
 
-    for (int i = 0; i < m_bits.size(); i++) {
+    for (int i = 0; i < m_size; i++) {
         for (int j = 0; j < m_bits[i].getSize(); j++) {
             out << (bool) m_bits[i].isElement(j) << " ";
         }
@@ -313,9 +313,9 @@ NetDest::print(std::ostream& out) const
 bool
 NetDest::isEqual(const NetDest& n) const
 {
-    assert(m_bits.size() > 0);
-    assert(m_bits.size() == n.m_bits.size());
-    for (unsigned int i = 0; i < m_bits.size(); ++i) {
+    assert(m_size > 0);
+    assert(m_size == n.m_size);
+    for (unsigned int i = 0; i < m_size; ++i) {
         if (!m_bits[i].isEqual(n.m_bits[i]))
             return false;
     }
@@ -29,6 +29,7 @@
 #ifndef __MEM_RUBY_COMMON_NETDEST_HH__
 #define __MEM_RUBY_COMMON_NETDEST_HH__
 
+#include <array>
 #include <iostream>
 #include <vector>
 
@@ -94,7 +95,7 @@ class NetDest
     MachineID smallestElement(MachineType machine) const;
 
     void resize();
-    int getSize() const { return m_bits.size(); }
+    int getSize() const { return m_size; }
 
     // get element for a index
     NodeID elementAt(MachineID index);
@@ -110,13 +111,17 @@ class NetDest
     vecIndex(MachineID m) const
     {
         int vec_index = MachineType_base_level(m.type);
-        assert(vec_index < m_bits.size());
+        assert(vec_index < m_size);
         return vec_index;
     }
 
     NodeID bitIndex(NodeID index) const { return index; }
 
-    std::vector<Set> m_bits;  // a vector of bit vectors - i.e. Sets
+    // One bit vector (Set) per machine type. They are stored inline so
+    // that creating and copying destinations does not allocate. m_size
+    // is the number of Sets in use, which is 0 until resize() is called.
+    std::array<Set, MachineType_NUM> m_bits;
+    int m_size = 0;
 
     // Needed to call MacheinType_base_count/level
     RubySystem *m_ruby_system = nullptr;
@@ -41,12 +41,16 @@
 #ifndef __MEM_RUBY_COMMON_WRITEMASK_HH__
 #define __MEM_RUBY_COMMON_WRITEMASK_HH__
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <iomanip>
 #include <iostream>
 #include <vector>
 
 #include "base/amo.hh"
+#include "base/bitfield.hh"
 #include "mem/ruby/common/DataBlock.hh"
 #include "mem/ruby/common/TypeDefines.hh"
 
@@ -61,19 +65,33 @@ class WriteMask
   public:
     typedef std::vector<std::pair<int, AtomicOpFunctor* >> AtomicOpVector;
 
+    /**
+     * The largest block size a mask can cover. The bits are stored
+     * inline, so that masks can be created and copied without
+     * allocating and combined a word at a time.
+     */
+    static constexpr int MaxSize = 256;
+
     WriteMask();
 
     WriteMask(int size)
-      : mSize(size), mMask(size, false), mAtomic(false)
-    {}
+      : mSize(size), mAtomic(false)
+    {
+        assert(size <= MaxSize);
+    }
 
-    WriteMask(int size, std::vector<bool> & mask)
-      : mSize(size), mMask(mask), mAtomic(false)
-    {}
+    WriteMask(int size, const std::vector<bool> & mask)
+      : mSize(size), mAtomic(false)
+    {
+        setBits(mask);
+    }
 
-    WriteMask(int size, std::vector<bool> &mask, AtomicOpVector atomicOp)
-      : mSize(size), mMask(mask), mAtomic(true), mAtomicOp(atomicOp)
-    {}
+    WriteMask(int size, const std::vector<bool> &mask,
+              AtomicOpVector atomicOp)
+      : mSize(size), mAtomic(true), mAtomicOp(atomicOp)
+    {
+        setBits(mask);
+    }
 
     ~WriteMask()
     {}
@@ -85,7 +103,7 @@ class WriteMask
         // This should only be used once if the default ctor was used. Probably
         // by src/mem/ruby/protocol/RubySlicc_MemControl.sm.
         assert(mSize == 0);
-        assert(size > 0);
+        assert(size > 0 && size <= MaxSize);
         mSize = size;
         clear();
     }
@@ -93,7 +111,7 @@ class WriteMask
     void
     clear()
     {
-        mMask = std::vector<bool>(mSize, false);
+        mMask.fill(0);
     }
 
     bool
@@ -101,7 +119,7 @@ class WriteMask
     {
         assert(mSize > 0);
         assert(offset < mSize);
-        return mMask[offset];
+        return (mMask[offset / BitsPerWord] >> (offset % BitsPerWord)) & 1;
     }
 
     void
@@ -109,80 +127,75 @@ class WriteMask
     {
         assert(mSize > 0);
         assert(mSize >= (offset + len));
-        for (int i = 0; i < len; i++) {
-            mMask[offset + i] = val;
+        for (int w = offset / BitsPerWord; w * BitsPerWord < offset + len;
+             w++) {
+            uint64_t bits = wordMask(w, offset, offset + len);
+            if (val)
+                mMask[w] |= bits;
+            else
+                mMask[w] &= ~bits;
         }
     }
     void
     fillMask()
     {
         assert(mSize > 0);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = true;
-        }
+        setMask(0, mSize);
     }
 
     bool
     getMask(int offset, int len) const
     {
-        bool tmp = true;
         assert(mSize > 0);
         assert(mSize >= (offset + len));
-        for (int i = 0; i < len; i++) {
-            tmp = tmp & mMask.at(offset + i);
+        for (int w = offset / BitsPerWord; w * BitsPerWord < offset + len;
+             w++) {
+            uint64_t bits = wordMask(w, offset, offset + len);
+            if ((mMask[w] & bits) != bits)
+                return false;
         }
-        return tmp;
+        return true;
     }
 
     bool
     isOverlap(const WriteMask &readMask) const
     {
-        bool tmp = false;
         assert(mSize > 0);
         assert(mSize == readMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            if (readMask.mMask.at(i)) {
-                tmp = tmp | mMask.at(i);
-            }
-        }
-        return tmp;
+        uint64_t overlap = 0;
+        for (int w = 0; w < MaskWords; w++)
+            overlap |= mMask[w] & readMask.mMask[w];
+        return overlap != 0;
     }
 
     bool
     containsMask(const WriteMask &readMask) const
     {
-        bool tmp = true;
         assert(mSize > 0);
         assert(mSize == readMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            if (readMask.mMask.at(i)) {
-                tmp = tmp & mMask.at(i);
-            }
-        }
-        return tmp;
+        uint64_t missing = 0;
+        for (int w = 0; w < MaskWords; w++)
+            missing |= readMask.mMask[w] & ~mMask[w];
+        return missing == 0;
     }
 
     bool isEmpty() const
     {
         assert(mSize > 0);
-        for (int i = 0; i < mSize; i++) {
-            if (mMask.at(i)) {
-                return false;
-            }
-        }
-        return true;
+        uint64_t bits = 0;
+        for (int w = 0; w < MaskWords; w++)
+            bits |= mMask[w];
+        return bits == 0;
     }
 
     bool
     isFull() const
     {
         assert(mSize > 0);
-        for (int i = 0; i < mSize; i++) {
-            if (!mMask.at(i)) {
-                return false;
-            }
-        }
-        return true;
+        uint64_t missing = 0;
+        for (int w = 0; w < MaskWords; w++)
+            missing |= wordMask(w, 0, mSize) & ~mMask[w];
+        return missing == 0;
     }
 
     void
@@ -190,9 +203,8 @@ class WriteMask
     {
         assert(mSize > 0);
         assert(mSize == writeMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = (mMask.at(i)) && (writeMask.mMask.at(i));
-        }
+        for (int w = 0; w < MaskWords; w++)
+            mMask[w] &= writeMask.mMask[w];
 
         if (writeMask.mAtomic) {
             mAtomic = true;
@@ -205,9 +217,8 @@ class WriteMask
     {
         assert(mSize > 0);
         assert(mSize == writeMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = (mMask.at(i)) || (writeMask.mMask.at(i));
-        }
+        for (int w = 0; w < MaskWords; w++)
+            mMask[w] |= writeMask.mMask[w];
 
         if (writeMask.mAtomic) {
             mAtomic = true;
@@ -220,18 +231,20 @@ class WriteMask
     {
         assert(mSize > 0);
         assert(mSize == writeMask.mSize);
-        for (int i = 0; i < mSize; i++) {
-            mMask[i] = !writeMask.mMask.at(i);
-        }
+        for (int w = 0; w < MaskWords; w++)
+            mMask[w] = ~writeMask.mMask[w] & wordMask(w, 0, mSize);
     }
 
     int
     firstBitSet(bool val, int offset = 0) const
     {
         assert(mSize > 0);
-        for (int i = offset; i < mSize; ++i)
-            if (mMask[i] == val)
-                return i;
+        for (int w = offset / BitsPerWord; w * BitsPerWord < mSize; w++) {
+            uint64_t bits = (val ? mMask[w] : ~mMask[w]) &
+                wordMask(w, offset, mSize);
+            if (bits)
+                return w * BitsPerWord + findLsbSet(bits);
+        }
         return mSize;
     }
 
@@ -240,8 +253,8 @@ class WriteMask
     {
         assert(mSize > 0);
         int count = 0;
-        for (int i = offset; i < mSize; ++i)
-            count += mMask[i];
+        for (int w = offset / BitsPerWord; w * BitsPerWord < mSize; w++)
+            count += popCount(mMask[w] & wordMask(w, offset, mSize));
         return count;
     }
 
@@ -255,7 +268,7 @@ class WriteMask
      * specific atomic operation.
      */
     void performAtomic(uint8_t * p,
-            std::deque<uint8_t*>& atomicChangeLog,
+            std::vector<uint8_t*>& atomicChangeLog,
             bool isAtomicNoReturn=true) const;
 
     const AtomicOpVector&
@@ -272,8 +285,32 @@ class WriteMask
     }
 
   private:
+    static constexpr int BitsPerWord = 64;
+    static constexpr int MaskWords = MaxSize / BitsPerWord;
+
+    // The bits of word w that are in [begin, end).
+    static uint64_t
+    wordMask(int w, int begin, int end)
+    {
+        int lo = std::max(begin - w * BitsPerWord, 0);
+        int hi = std::min(end - w * BitsPerWord, BitsPerWord);
+        return lo < hi ? mask(hi) & ~mask(lo) : 0;
+    }
+
+    void
+    setBits(const std::vector<bool> &mask)
+    {
+        assert(mSize <= MaxSize);
+        assert(mask.size() <= mSize);
+        for (int i = 0; i < mask.size(); i++) {
+            if (mask[i])
+                mMask[i / BitsPerWord] |= 1ULL << (i % BitsPerWord);
+        }
+    }
+
     int mSize;
-    std::vector<bool> mMask;
+    // Bits beyond mSize are always zero.
+    std::array<uint64_t, MaskWords> mMask = {};
     bool mAtomic;
     AtomicOpVector mAtomicOp;
 };
@@ -77,6 +77,9 @@ MessageBuffer::MessageBuffer(const Params &p)
              "Total number of ticks messages were stalled in this buffer"),
     ADD_STAT(m_stall_count, statistics::units::Count::get(),
              "Number of times messages were stalled"),
+    ADD_STAT(m_stall_depth, statistics::units::Count::get(),
+             "Number of messages stalled on the same line, including the "
+             "new one, when a message stalls"),
     ADD_STAT(m_avg_stall_time, statistics::units::Rate<
                 statistics::units::Tick, statistics::units::Count>::get(),
              "Average stall ticks per message"),
@@ -114,6 +117,10 @@ MessageBuffer::MessageBuffer(const Params &p)
     m_stall_count
         .flags(statistics::nozero);
 
+    m_stall_depth
+        .init(8)
+        .flags(statistics::nozero);
+
     m_avg_stall_time
         .flags(statistics::nozero | statistics::nonan);
 
@@ -132,6 +139,21 @@ MessageBuffer::MessageBuffer(const Params &p)
     m_avg_stall_time = m_stall_time / m_msg_count;
 }
 
+void
+MessageBuffer::init()
+{
+    SimObject::init();
+
+    // Every queue may send to this buffer once the simulation runs in
+    // parallel, so their channels are created upfront.
+    if (numMainEventQueues > 1) {
+        for (uint32_t i = 0; i < numMainEventQueues; i++) {
+            m_remote_channels.emplace(mainEventQueue[i],
+                                      std::make_unique<RemoteChannel>());
+        }
+    }
+}
+
 unsigned int
 MessageBuffer::getSize(Tick curTime)
 {
@@ -219,26 +241,28 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
                        bool ruby_is_random, bool ruby_warmup,
                        bool bypassStrictFIFO)
 {
-    // record current time incase we have a pop that also adjusts my size
-    if (m_time_last_time_enqueue < current_time) {
-        m_msgs_this_cycle = 0;  // first msg this cycle
-        m_time_last_time_enqueue = current_time;
-    }
-
-    m_msg_counter++;
-    m_msgs_this_cycle++;
-
     // Calculate the arrival time of the message, that is, the first
     // cycle the message can be dequeued.
     panic_if((delta == 0) && !m_allow_zero_latency,
            "Delta equals zero and allow_zero_latency is false during enqueue");
-    Tick arrival_time = 0;
 
     // random delays are inserted if the RubySystem level randomization flag
     // is turned on and this buffer allows it
-    if ((m_randomization == MessageRandomization::disabled) ||
-        ((m_randomization == MessageRandomization::ruby_system) &&
-          !ruby_is_random)) {
+    bool randomize =
+        !((m_randomization == MessageRandomization::disabled) ||
+          ((m_randomization == MessageRandomization::ruby_system) &&
+            !ruby_is_random));
+
+    assert(m_consumer != NULL);
+    if (inParallelMode &&
+        m_consumer->getObject()->eventQueue() != curEventQueue()) {
+        enqueueRemote(message, current_time, delta, randomize, ruby_warmup,
+                      bypassStrictFIFO);
+        return;
+    }
+
+    Tick arrival_time = 0;
+    if (!randomize) {
         // No randomization
         arrival_time = current_time + delta;
     } else {
@@ -253,6 +277,23 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
         }
     }
 
+    insert(message, current_time, arrival_time, ruby_warmup,
+           bypassStrictFIFO);
+}
+
+void
+MessageBuffer::insert(MsgPtr message, Tick current_time, Tick arrival_time,
+                      bool ruby_warmup, bool bypassStrictFIFO)
+{
+    // record current time incase we have a pop that also adjusts my size
+    if (m_time_last_time_enqueue < current_time) {
+        m_msgs_this_cycle = 0;  // first msg this cycle
+        m_time_last_time_enqueue = current_time;
+    }
+
+    m_msg_counter++;
+    m_msgs_this_cycle++;
+
     // Check the arrival time
     assert(arrival_time >= current_time);
     if (m_strict_fifo &&
@@ -260,8 +301,8 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
         if (arrival_time < m_last_arrival_time) {
             panic("FIFO ordering violated: %s name: %s current time: %d "
                   "delta: %d arrival_time: %d last arrival_time: %d\n",
-                  *this, name(), current_time, delta, arrival_time,
-                  m_last_arrival_time);
+                  *this, name(), current_time, arrival_time - current_time,
+                  arrival_time, m_last_arrival_time);
         }
     }
 
@@ -296,11 +337,107 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
             arrival_time, *(message.get()));
 
     // Schedule the wakeup
-    assert(m_consumer != NULL);
     m_consumer->scheduleEventAbsolute(arrival_time);
     m_consumer->storeEventInfo(m_vnet_id);
 }
 
+void
+MessageBuffer::enqueueRemote(MsgPtr message, Tick current_time, Tick delta,
+                             bool randomize, bool ruby_warmup,
+                             bool bypassStrictFIFO)
+{
+    EventQueue *consumer_eventq = m_consumer->getObject()->eventQueue();
+
+    fatal_if(randomize, "%s: Messages to %s on another event queue cannot "
+             "be randomized.", name(), *m_consumer);
+    fatal_if(m_max_size != 0, "%s: Buffers that cross event queues must "
+             "be infinite, but buffer_size is %d.", name(), m_max_size);
+    fatal_if(delta < simQuantum, "%s: The latency of messages to %s on "
+             "another event queue (%d ticks) must not be less than the "
+             "simulation quantum (%d ticks).", name(), *m_consumer, delta,
+             simQuantum);
+
+    auto it = m_remote_channels.find(curEventQueue());
+    assert(it != m_remote_channels.end());
+    RemoteChannel &channel = *it->second;
+
+    // The messages of a channel are delivered in the order in which they
+    // were sent, so a message can't overtake the previous one.
+    Tick arrival_time = std::max(current_time + delta, channel.lastArrival);
+
+    // The message becomes visible to the consumer when it arrives, so
+    // only the message itself is updated here.
+    assert(current_time >= message->getLastEnqueueTime() &&
+           "ensure we aren't dequeued early");
+    message->updateDelayedTicks(current_time);
+    message->setLastEnqueueTime(arrival_time);
+
+    DPRINTF(RubyQueue, "Remote enqueue arrival_time: %lld, Message: %s\n",
+            arrival_time, *message);
+
+    channel.push(RemoteMessage{message, ruby_warmup, bypassStrictFIFO});
+
+    // Messages arriving together share a delivery, which can't have
+    // happened yet since it is at least a quantum ahead.
+    if (channel.lastDelivery && arrival_time == channel.lastArrival) {
+        channel.lastDelivery->count++;
+    } else {
+        channel.lastDelivery = new DeliveryEvent(this, &channel);
+        channel.lastArrival = arrival_time;
+        consumer_eventq->schedule(channel.lastDelivery, arrival_time);
+    }
+}
+
+void
+MessageBuffer::deliverRemote(RemoteChannel &channel, unsigned count)
+{
+    for (unsigned i = 0; i < count; i++) {
+        RemoteMessage remote = channel.pop();
+        assert(remote.message->getLastEnqueueTime() == curTick());
+        insert(std::move(remote.message), curTick(), curTick(),
+               remote.rubyWarmup, remote.bypassStrictFIFO);
+    }
+}
+
+MessageBuffer::RemoteChannel::~RemoteChannel()
+{
+    while (head) {
+        Node *next = head->next.load(std::memory_order_relaxed);
+        delete head;
+        head = next;
+    }
+}
+
+void
+MessageBuffer::RemoteChannel::push(RemoteMessage remote)
+{
+    Node *node = new Node;
+    node->remote = std::move(remote);
+    tail->next.store(node, std::memory_order_release);
+    tail = node;
+}
+
+MessageBuffer::RemoteMessage
+MessageBuffer::RemoteChannel::pop()
+{
+    Node *next = head->next.load(std::memory_order_acquire);
+    assert(next);
+    RemoteMessage remote = std::move(next->remote);
+    delete head;
+    head = next;
+    return remote;
+}
+
+void
+MessageBuffer::RemoteChannel::forEach(
+    const std::function<void(Message *)> &f) const
+{
+    for (Node *node = head->next.load(std::memory_order_acquire); node;
+         node = node->next.load(std::memory_order_acquire)) {
+        f(node->remote.message.get());
+    }
+}
+
 Tick
 MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
 {
@@ -386,30 +523,40 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
 }
 
 void
-MessageBuffer::reanalyzeList(std::list<MsgPtr> &lt, Tick schdTick)
+MessageBuffer::reanalyzeList(StallList &lt, Tick schdTick)
 {
-    while (!lt.empty()) {
-        MsgPtr m = lt.front();
+    for (auto &m : lt) {
         assert(m->getLastEnqueueTime() <= schdTick);
 
-        m_prio_heap.push_back(m);
+        DPRINTF(RubyQueue, "Requeue arrival_time: %lld, Message: %s\n",
+            schdTick, *(m.get()));
+
+        m_prio_heap.push_back(std::move(m));
         push_heap(m_prio_heap.begin(), m_prio_heap.end(),
                   std::greater<MsgPtr>());
+    }
 
+    // A single wakeup covers all the messages of the list
+    if (!lt.empty())
         m_consumer->scheduleEventAbsolute(schdTick);
 
-        DPRINTF(RubyQueue, "Requeue arrival_time: %lld, Message: %s\n",
-            schdTick, *(m.get()));
+    m_stall_map_size -= lt.size();
+    assert(m_stall_map_size >= 0);
+}
 
-        lt.pop_front();
-    }
+void
+MessageBuffer::releaseStallList(StallList &lt)
+{
+    lt.clear();
+    m_free_stall_lists.push_back(std::move(lt));
 }
 
 void
 MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
 {
     DPRINTF(RubyQueue, "ReanalyzeMessages %#x\n", addr);
-    assert(m_stall_msg_map.count(addr) > 0);
+    auto it = m_stall_msg_map.find(addr);
+    assert(it != m_stall_msg_map.end());
 
     //
     // Put all stalled messages associated with this address back on the
@@ -417,10 +564,9 @@ MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle
     //
-    m_stall_map_size -= m_stall_msg_map[addr].size();
-    assert(m_stall_map_size >= 0);
-    reanalyzeList(m_stall_msg_map[addr], current_time);
-    m_stall_msg_map.erase(addr);
+    reanalyzeList(it->second, current_time);
+    releaseStallList(it->second);
+    m_stall_msg_map.erase(it);
 }
 
 void
@@ -434,11 +580,9 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle.
     //
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end(); ++map_iter) {
-        m_stall_map_size -= map_iter->second.size();
-        assert(m_stall_map_size >= 0);
-        reanalyzeList(map_iter->second, current_time);
+    for (auto &entry : m_stall_msg_map) {
+        reanalyzeList(entry.second, current_time);
+        releaseStallList(entry.second);
     }
     m_stall_msg_map.clear();
 }
@@ -459,9 +603,15 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     // Instead the controller is responsible to call reanalyzeMessages when
     // these addresses change state.
     //
-    (m_stall_msg_map[addr]).push_back(message);
+    auto [it, inserted] = m_stall_msg_map.try_emplace(addr);
+    if (inserted && !m_free_stall_lists.empty()) {
+        it->second = std::move(m_free_stall_lists.back());
+        m_free_stall_lists.pop_back();
+    }
+    it->second.push_back(std::move(message));
     m_stall_map_size++;
     m_stall_count++;
+    m_stall_depth.sample(it->second.size());
 }
 
 bool
@@ -561,14 +711,9 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
 
     // Check the stall queue and write any messages that may
     // correspond to the address in the packet.
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end();
-         ++map_iter) {
-
-        for (std::list<MsgPtr>::iterator it = (map_iter->second).begin();
-            it != (map_iter->second).end(); ++it) {
-
-            Message *msg = (*it).get();
+    for (auto &entry : m_stall_msg_map) {
+        for (auto &stalled : entry.second) {
+            Message *msg = stalled.get();
             if (is_read && !mask && msg->functionalRead(pkt))
                 return 1;
             else if (is_read && mask && msg->functionalRead(pkt, *mask))
@@ -578,6 +723,25 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
         }
     }
 
+    // Check the messages that are still on their way from another
+    // event queue. Their consumer must not be delivering them meanwhile,
+    // which holds outside of the parallel parts of the simulation.
+    bool found = false;
+    for (auto &entry : m_remote_channels) {
+        entry.second->forEach([&](Message *msg) {
+            if (found)
+                return;
+            if (is_read && !mask && msg->functionalRead(pkt))
+                found = true;
+            else if (is_read && mask && msg->functionalRead(pkt, *mask))
+                num_functional_accesses++;
+            else if (!is_read && msg->functionalWrite(pkt))
+                num_functional_accesses++;
+        });
+        if (found)
+            return 1;
+    }
+
     return num_functional_accesses;
 }
 
@@ -47,9 +47,11 @@
 #define __MEM_RUBY_NETWORK_MESSAGEBUFFER_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -63,6 +65,7 @@
 #include "mem/ruby/network/dummy_port.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 #include "params/MessageBuffer.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -77,6 +80,8 @@ class MessageBuffer : public SimObject
     typedef MessageBufferParams Params;
     MessageBuffer(const Params &p);
 
+    void init() override;
+
     void reanalyzeMessages(Addr addr, Tick current_time);
     void reanalyzeAllMessages(Tick current_time);
     void stallMessage(Addr addr, Tick current_time);
@@ -124,6 +129,16 @@ class MessageBuffer : public SimObject
 
     const MsgPtr &peekMsgPtr() const { return m_prio_heap.front(); }
 
+    /**
+     * Enqueue a message that can be dequeued delta ticks from now.
+     *
+     * The sender may run on another event queue than the consumer of
+     * this buffer. The message is then held aside and handed over on
+     * the consumer's event queue when it arrives, so delta must not be
+     * less than the simulation quantum. Such buffers must be infinite
+     * and their messages cannot be randomized, as the sender cannot
+     * look at the state of the consumer's side.
+     */
     void enqueue(MsgPtr message, Tick curTime, Tick delta,
                 bool ruby_is_random, bool ruby_warmup,
                 bool bypassStrictFIFO = false);
@@ -197,10 +212,105 @@ class MessageBuffer : public SimObject
     int routingPriority() const { return m_routing_priority; }
 
   private:
-    void reanalyzeList(std::list<MsgPtr> &, Tick);
+    // Stalled messages of a line, in the order in which they stalled
+    typedef std::vector<MsgPtr> StallList;
+
+    void reanalyzeList(StallList &, Tick);
+    void releaseStallList(StallList &);
 
     uint32_t functionalAccess(Packet *pkt, bool is_read, WriteMask *mask);
 
+    /**
+     * Insert a message into the priority heap and schedule the
+     * consumer. The arrival time has already been computed.
+     */
+    void insert(MsgPtr message, Tick current_time, Tick arrival_time,
+                bool ruby_warmup, bool bypassStrictFIFO);
+
+    /** Enqueue from a sender on another event queue. */
+    void enqueueRemote(MsgPtr message, Tick current_time, Tick delta,
+                       bool randomize, bool ruby_warmup,
+                       bool bypassStrictFIFO);
+
+    struct RemoteMessage
+    {
+        MsgPtr message;
+        bool rubyWarmup;
+        bool bypassStrictFIFO;
+    };
+
+    class DeliveryEvent;
+
+    /**
+     * Messages on their way from one event queue, in arrival order. The
+     * sender appends them to a linked list and the consumer frees its
+     * head, so the two sides don't need a lock.
+     *
+     * The sender is at least one simulation quantum ahead of the arrival
+     * of its messages, so the consumer can't have delivered the newest
+     * message yet when the next one is sent.
+     */
+    class RemoteChannel
+    {
+      private:
+        struct Node
+        {
+            RemoteMessage remote;
+            std::atomic<Node *> next{nullptr};
+        };
+
+        /** Node before the oldest message, owned by the consumer. */
+        Node *head;
+        /** Newest node, owned by the sender. */
+        Node *tail;
+
+      public:
+        /** Arrival time of the newest message. */
+        Tick lastArrival = 0;
+        /** The event which delivers the newest message. */
+        DeliveryEvent *lastDelivery = nullptr;
+
+        RemoteChannel() : head(new Node), tail(head) {}
+        ~RemoteChannel();
+
+        /** Append a message. Only the sender may call this. */
+        void push(RemoteMessage remote);
+
+        /** Take the oldest message. Only the consumer may call this. */
+        RemoteMessage pop();
+
+        /** Call a function on every message in flight. */
+        void forEach(const std::function<void(Message *)> &f) const;
+    };
+
+    /**
+     * Hands the messages arriving at a given tick from a channel over
+     * to the consumer's side.
+     */
+    class DeliveryEvent : public Event
+    {
+      private:
+        MessageBuffer *buffer;
+        RemoteChannel *channel;
+
+      public:
+        /** The number of messages delivered. */
+        unsigned count = 1;
+
+        DeliveryEvent(MessageBuffer *_buffer, RemoteChannel *_channel)
+            : Event(Default_Pri - 1, AutoDelete), buffer(_buffer),
+              channel(_channel)
+        {}
+
+        void process() override { buffer->deliverRemote(*channel, count); }
+        const char *description() const override
+        {
+            return "message delivery";
+        }
+    };
+
+    void deliverRemote(RemoteChannel &channel, unsigned count);
+
   private:
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
@@ -209,9 +319,7 @@ class MessageBuffer : public SimObject
 
     std::function<void()> m_dequeue_callback;
 
-    // use a std::map for the stalled messages as this container is
-    // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    typedef std::unordered_map<Addr, StallList> StallMsgMapType;
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
@@ -224,10 +332,19 @@ class MessageBuffer : public SimObject
      * NOTE: The stall map holds messages in the order in which they were
      * initially received, and when a line is unblocked, the messages are
      * moved back to the m_prio_heap in the same order. This prevents starving
-     * older requests with younger ones.
+     * older requests with younger ones. The heap orders messages by arrival
+     * time and counter, so the order in which lines are reanalyzed does
+     * not matter and the map does not need to be sorted.
      */
     StallMsgMapType m_stall_msg_map;
 
+    /**
+     * Lists of lines that were reanalyzed. Their storage is reused for
+     * the next lines that stall, so that contended lines do not allocate
+     * on every stall.
+     */
+    std::vector<StallList> m_free_stall_lists;
+
     /**
      * A map from line addresses to corresponding vectors of messages that
      * are deferred for enqueueing. Messages in this map are waiting to be
@@ -287,12 +404,19 @@ class MessageBuffer : public SimObject
     int m_input_link_id;
     int m_vnet_id;
 
+    // Messages from senders on other event queues that have not
+    // arrived yet, with one channel per sender queue. The map is filled
+    // in init() and only read afterwards.
+    std::unordered_map<const EventQueue *, std::unique_ptr<RemoteChannel>>
+        m_remote_channels;
+
     // Count the # of times I didn't have N slots available
     statistics::Scalar m_not_avail_count;
     statistics::Scalar m_msg_count;
     statistics::Average m_buf_msgs;
     statistics::Scalar m_stall_time;
     statistics::Scalar m_stall_count;
+    statistics::Histogram m_stall_depth;
     statistics::Formula m_avg_stall_time;
     statistics::Formula m_occupancy;
 };
@@ -29,7 +29,12 @@
 
 #include "mem/ruby/network/Topology.hh"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <thread>
 
 #include "base/trace.hh"
 #include "debug/RubyNetwork.hh"
@@ -46,6 +51,7 @@ namespace ruby
 {
 
 const int INFINITE_LATENCY = 10000; // Yes, this is a big hack
+const int UNREACHABLE = std::numeric_limits<int>::max();
 
 // Note: In this file, we use the first 2*m_nodes SwitchIDs to
 // represent the input and output endpoint links.  These really are
@@ -126,37 +132,24 @@ Topology::createLinks(Network *net)
         max_switch_id = std::max(max_switch_id, src_dest.first);
         max_switch_id = std::max(max_switch_id, src_dest.second);
     }
-
-    // Initialize weight, latency, and inter switched vectors
     int num_switches = max_switch_id+1;
-    Matrix topology_weights(m_vnets,
-            std::vector<std::vector<int>>(num_switches,
-            std::vector<int>(num_switches, INFINITE_LATENCY)));
-    Matrix component_latencies(num_switches,
-            std::vector<std::vector<int>>(num_switches,
-            std::vector<int>(m_vnets, -1)));
-    Matrix component_inter_switches(num_switches,
-            std::vector<std::vector<int>>(num_switches,
-            std::vector<int>(m_vnets, 0)));
-
-    // Set identity weights to zero
-    for (int i = 0; i < topology_weights[0].size(); i++) {
-        for (int v = 0; v < m_vnets; v++) {
-            topology_weights[v][i][i] = 0;
-        }
-    }
 
-    // Fill in the topology weights and bandwidth multipliers
-    for (auto link_group : m_link_map) {
+    // Fill in the weight of each edge in every vnet. The link map is
+    // sorted, so the edges are in order of source and destination.
+    std::vector<Edge> edges;
+    edges.reserve(m_link_map.size());
+    for (const auto &link_group : m_link_map) {
         std::pair<int, int> src_dest = link_group.first;
         std::vector<bool> vnet_done(m_vnets, 0);
-        int src = src_dest.first;
-        int dst = src_dest.second;
+        Edge edge{(SwitchID)src_dest.first, (SwitchID)src_dest.second,
+                  std::vector<int>(m_vnets, INFINITE_LATENCY)};
 
         // Iterate over all links for this source and destination
-        std::vector<LinkEntry> link_entries = link_group.second;
+        const std::vector<LinkEntry> &link_entries = link_group.second;
         for (int l = 0; l < link_entries.size(); l++) {
             BasicLink* link = link_entries[l].link;
+            fatal_if(link->m_weight < 0, "Link %s has a negative weight",
+                     link->name());
             if (link->mVnets.size() == 0) {
                 for (int v = 0; v < m_vnets; v++) {
                     // Two links connecting same src and destination
@@ -164,8 +157,7 @@ Topology::createLinks(Network *net)
                     fatal_if(vnet_done[v], "Two links connecting same src"
                     " and destination cannot support same vnets");
 
-                    component_latencies[src][dst][v] = link->m_latency;
-                    topology_weights[v][src][dst] = link->m_weight;
+                    edge.weights[v] = link->m_weight;
                     vnet_done[v] = true;
                 }
             } else {
@@ -178,43 +170,48 @@ Topology::createLinks(Network *net)
                     fatal_if(vnet_done[vnet], "Two links connecting same src"
                     " and destination cannot support same vnets");
 
-                    component_latencies[src][dst][vnet] = link->m_latency;
-                    topology_weights[vnet][src][dst] = link->m_weight;
+                    edge.weights[vnet] = link->m_weight;
                     vnet_done[vnet] = true;
                 }
             }
         }
+        edges.push_back(std::move(edge));
     }
 
     // Walk topology and hookup the links
-    Matrix dist = shortest_path(topology_weights, component_latencies,
-                                component_inter_switches);
-
-    for (int i = 0; i < topology_weights[0].size(); i++) {
-        for (int j = 0; j < topology_weights[0][i].size(); j++) {
-            std::vector<NetDest> routingMap;
-            routingMap.resize(m_vnets, m_ruby_system);
-
-            // Not all sources and destinations are connected
-            // by direct links. We only construct the links
-            // which have been configured in topology.
-            bool realLink = false;
-
-            for (int v = 0; v < m_vnets; v++) {
-                int weight = topology_weights[v][i][j];
-                if (weight > 0 && weight != INFINITE_LATENCY) {
-                    realLink = true;
-                    routingMap[v] =
-                        shortest_path_to_node(i, j, topology_weights, dist, v);
-                }
-            }
-            // Make one link for each set of vnets between
-            // a given source and destination. We do not
-            // want to create one link for each vnet.
-            if (realLink) {
-                makeLink(net, i, j, routingMap);
+    std::vector<std::vector<uint64_t>> routes =
+        computeRoutes(edges, num_switches);
+
+    for (int e = 0; e < edges.size(); e++) {
+        const Edge &edge = edges[e];
+        std::vector<NetDest> routingMap;
+        routingMap.resize(m_vnets, m_ruby_system);
+
+        // Edges only exist where links have been configured in the
+        // topology, but a link may carry none of the vnets.
+        bool realLink = false;
+
+        for (int v = 0; v < m_vnets; v++) {
+            int weight = edge.weights[v];
+            if (weight > 0 && weight != INFINITE_LATENCY) {
+                realLink = true;
+                routingMap[v] = routeToNetDest(routes[e * m_vnets + v]);
+
+                DPRINTF(RubyNetwork, "Returning shortest path\n"
+                        "(src-(2*max_machines)): %d, "
+                        "(next-(2*max_machines)): %d, "
+                        "src: %d, next: %d, vnet:%d result: %s\n",
+                        (int)(edge.src-(2*m_nodes)),
+                        (int)(edge.dest-(2*m_nodes)),
+                        edge.src, edge.dest, v, routingMap[v]);
             }
         }
+        // Make one link for each set of vnets between
+        // a given source and destination. We do not
+        // want to create one link for each vnet.
+        if (realLink) {
+            makeLink(net, edge.src, edge.dest, routingMap);
+        }
     }
 }
 
@@ -334,107 +331,138 @@ Topology::makeLink(Network *net, SwitchID src, SwitchID dest,
     }
 }
 
-// The following all-pairs shortest path algorithm is based on the
-// discussion from Cormen et al., Chapter 26.1.
 void
-Topology::extend_shortest_path(Matrix &current_dist, Matrix &latencies,
-    Matrix &inter_switches)
+Topology::shortestDistancesTo(SwitchID dest, const Adjacency &incoming,
+                              std::vector<int> &dist) const
 {
-    int nodes = current_dist[0].size();
+    typedef std::pair<int, SwitchID> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                        std::greater<QueueEntry>> queue;
+
+    std::fill(dist.begin(), dist.end(), UNREACHABLE);
+    dist[dest] = 0;
+    queue.emplace(0, dest);
+
+    while (!queue.empty()) {
+        auto [d, node] = queue.top();
+        queue.pop();
+        if (d != dist[node])
+            continue;
+        for (const auto &[prev, weight] : incoming[node]) {
+            if (d + weight < dist[prev]) {
+                dist[prev] = d + weight;
+                queue.emplace(dist[prev], prev);
+            }
+        }
+    }
+}
 
-    // We find the shortest path for each vnet for a given pair of
-    // source and destinations. This is done simply by traversing via
-    // all other nodes and finding the minimum distance.
+// Instead of computing the shortest paths between all pairs of switches,
+// which takes cubic time and memory in their number, we only need the
+// distances from every switch to each output endpoint. These come from
+// one run of Dijkstra's algorithm per endpoint and vnet on the reversed
+// graph. An edge (src, next) leads to endpoint d along a shortest path
+// if weight(src, next) + dist(next, d) == dist(src, d).
+//
+// Vnets are usually all carried by the same links, so the distances are
+// only computed once for each distinct set of weights. The endpoints are
+// independent, so they are spread over host threads in groups of 64, one
+// word of the route bitmaps, which means no two threads ever write the
+// same word.
+std::vector<std::vector<uint64_t>>
+Topology::computeRoutes(const std::vector<Edge> &edges,
+                        int num_switches) const
+{
+    // The vnets with the weights of each distinct vnet
+    std::vector<std::vector<int>> vnet_groups;
     for (int v = 0; v < m_vnets; v++) {
-        // There is a different topology for each vnet. Here we try to
-        // build a topology by finding the minimum number of intermediate
-        // switches needed to reach the destination
-        bool change = true;
-        while (change) {
-            change = false;
-            for (int i = 0; i < nodes; i++) {
-                for (int j = 0; j < nodes; j++) {
-                    // We follow an iterative process to build the shortest
-                    // path tree:
-                    // 1. Start from the direct connection (if there is one,
-                    // otherwise assume a hypothetical infinite weight link).
-                    // 2. Then we iterate through all other nodes considering
-                    // new potential intermediate switches. If we find any
-                    // lesser weight combination, we set(update) that as the
-                    // new weight between the source and destination.
-                    // 3. Repeat for all pairs of nodes.
-                    // 4. Go to step 1 if there was any new update done in
-                    // Step 2.
-                    int minimum = current_dist[v][i][j];
-                    int previous_minimum = minimum;
-                    int intermediate_switch = -1;
-                    for (int k = 0; k < nodes; k++) {
-                        minimum = std::min(minimum,
-                            current_dist[v][i][k] + current_dist[v][k][j]);
-                        if (previous_minimum != minimum) {
-                            intermediate_switch = k;
-                            inter_switches[i][j][v] =
-                                inter_switches[i][k][v] +
-                                inter_switches[k][j][v] + 1;
+        auto same_weights = [&](const std::vector<int> &group) {
+            for (const Edge &edge : edges) {
+                if (edge.weights[v] != edge.weights[group[0]])
+                    return false;
+            }
+            return true;
+        };
+        auto it = std::find_if(vnet_groups.begin(), vnet_groups.end(),
+                               same_weights);
+        if (it == vnet_groups.end())
+            vnet_groups.push_back({v});
+        else
+            it->push_back(v);
+    }
+
+    std::vector<Adjacency> incoming(vnet_groups.size(),
+                                    Adjacency(num_switches));
+    for (const Edge &edge : edges) {
+        for (int g = 0; g < vnet_groups.size(); g++) {
+            int weight = edge.weights[vnet_groups[g][0]];
+            if (weight != INFINITE_LATENCY)
+                incoming[g][edge.dest].emplace_back(edge.src, weight);
+        }
+    }
+
+    const size_t num_words = (m_nodes + 63) / 64;
+    std::vector<std::vector<uint64_t>> routes(edges.size() * m_vnets,
+                                              std::vector<uint64_t>());
+    for (int e = 0; e < edges.size(); e++) {
+        for (int v = 0; v < m_vnets; v++) {
+            int weight = edges[e].weights[v];
+            if (weight > 0 && weight != INFINITE_LATENCY)
+                routes[e * m_vnets + v].resize(num_words, 0);
+        }
+    }
+
+    const unsigned num_threads = std::max<size_t>(1, std::min<size_t>(
+        std::thread::hardware_concurrency(), num_words));
+    auto work = [&](unsigned thread) {
+        std::vector<int> dist(num_switches);
+        for (size_t w = thread; w < num_words; w += num_threads) {
+            const uint32_t last = std::min<size_t>(m_nodes, (w + 1) * 64);
+            for (uint32_t d = w * 64; d < last; d++) {
+                for (int g = 0; g < vnet_groups.size(); g++) {
+                    // The "destination" switches for the machines are
+                    // numbered [m_nodes...2*m_nodes-1] for the component
+                    // network
+                    shortestDistancesTo(d + m_nodes, incoming[g], dist);
+                    for (int e = 0; e < edges.size(); e++) {
+                        const Edge &edge = edges[e];
+                        int weight = edge.weights[vnet_groups[g][0]];
+                        if (dist[edge.dest] == UNREACHABLE ||
+                            weight + dist[edge.dest] != dist[edge.src]) {
+                            continue;
+                        }
+                        for (int v : vnet_groups[g]) {
+                            std::vector<uint64_t> &route =
+                                routes[e * m_vnets + v];
+                            if (!route.empty())
+                                route[w] |= (uint64_t)1 << (d % 64);
                         }
-                        previous_minimum = minimum;
-                    }
-                    if (current_dist[v][i][j] != minimum) {
-                        change = true;
-                        current_dist[v][i][j] = minimum;
-                        assert(intermediate_switch >= 0);
-                        assert(intermediate_switch < latencies[i].size());
-                        latencies[i][j][v] =
-                            latencies[i][intermediate_switch][v] +
-                            latencies[intermediate_switch][j][v];
                     }
                 }
             }
         }
-    }
-}
+    };
 
-Matrix
-Topology::shortest_path(const Matrix &weights, Matrix &latencies,
-                        Matrix &inter_switches)
-{
-    Matrix dist = weights;
-    extend_shortest_path(dist, latencies, inter_switches);
-    return dist;
-}
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < num_threads; ++i)
+        threads.emplace_back(work, i);
+    work(0);
+    for (auto &t : threads)
+        t.join();
 
-bool
-Topology::link_is_shortest_path_to_node(SwitchID src, SwitchID next,
-                                        SwitchID final, const Matrix &weights,
-                                        const Matrix &dist, int vnet)
-{
-    return weights[vnet][src][next] + dist[vnet][next][final] ==
-        dist[vnet][src][final];
+    return routes;
 }
 
 NetDest
-Topology::shortest_path_to_node(SwitchID src, SwitchID next,
-                                const Matrix &weights, const Matrix &dist,
-                                int vnet)
+Topology::routeToNetDest(const std::vector<uint64_t> &route) const
 {
     NetDest result(m_ruby_system);
     int d = 0;
-    int machines;
-    int max_machines;
 
-    machines = MachineType_NUM;
-    max_machines = m_ruby_system->MachineType_base_number(MachineType_NUM);
-
-    for (int m = 0; m < machines; m++) {
+    for (int m = 0; m < MachineType_NUM; m++) {
         for (NodeID i = 0;
             i < m_ruby_system->MachineType_base_count((MachineType)m); i++) {
-            // we use "d+max_machines" below since the "destination"
-            // switches for the machines are numbered
-            // [MachineType_base_number(MachineType_NUM)...
-            //  2*MachineType_base_number(MachineType_NUM)-1] for the
-            // component network
-            if (link_is_shortest_path_to_node(src, next, d + max_machines,
-                    weights, dist, vnet)) {
+            if (route[d / 64] >> (d % 64) & 1) {
                 MachineID mach = {(MachineType)m, i};
                 result.add(mach);
             }
@@ -442,12 +470,6 @@ Topology::shortest_path_to_node(SwitchID src, SwitchID next,
         }
     }
 
-    DPRINTF(RubyNetwork, "Returning shortest path\n"
-            "(src-(2*max_machines)): %d, (next-(2*max_machines)): %d, "
-            "src: %d, next: %d, vnet:%d result: %s\n",
-            (src-(2*max_machines)), (next-(2*max_machines)),
-            src, next, vnet, result);
-
     return result;
 }
 
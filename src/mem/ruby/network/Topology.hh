@@ -41,7 +41,9 @@
 #ifndef __MEM_RUBY_NETWORK_TOPOLOGY_HH__
 #define __MEM_RUBY_NETWORK_TOPOLOGY_HH__
 
+#include <cstdint>
 #include <iostream>
+#include <utility>
 #include <vector>
 
 #include "mem/ruby/common/TypeDefines.hh"
@@ -57,14 +59,6 @@ namespace ruby
 class NetDest;
 class Network;
 
-/*
- * We use a three-dimensional vector matrix for calculating
- * the shortest paths for each pair of source and destination
- * and for each type of virtual network. The three dimensions
- * represent the source ID, destination ID, and vnet number.
- */
-typedef std::vector<std::vector<std::vector<int>>> Matrix;
-
 struct LinkEntry
 {
     BasicLink *link;
@@ -94,20 +88,42 @@ class Topology
     void makeLink(Network *net, SwitchID src, SwitchID dest,
                   std::vector<NetDest>& routing_table_entry);
 
-    // Helper functions based on chapter 29 of Cormen et al.
-    void extend_shortest_path(Matrix &current_dist, Matrix &latencies,
-                              Matrix &inter_switches);
-
-    Matrix shortest_path(const Matrix &weights,
-            Matrix &latencies, Matrix &inter_switches);
-
-    bool link_is_shortest_path_to_node(SwitchID src, SwitchID next,
-            SwitchID final, const Matrix &weights, const Matrix &dist,
-            int vnet);
-
-    NetDest shortest_path_to_node(SwitchID src, SwitchID next,
-                                  const Matrix &weights, const Matrix &dist,
-                                  int vnet);
+    /**
+     * A uni-directional connection between two switches, standing for
+     * all the links configured between them, with its weight in each
+     * vnet.
+     */
+    struct Edge
+    {
+        SwitchID src;
+        SwitchID dest;
+        std::vector<int> weights;
+    };
+
+    /**
+     * The edges of one vnet, listed by the switch they lead to as pairs
+     * of source switch and weight.
+     */
+    typedef std::vector<std::vector<std::pair<SwitchID, int>>> Adjacency;
+
+    /**
+     * Compute the length of the shortest path from every switch to dest
+     * with Dijkstra's algorithm. Unreachable switches are left at
+     * UNREACHABLE.
+     */
+    void shortestDistancesTo(SwitchID dest, const Adjacency &incoming,
+                             std::vector<int> &dist) const;
+
+    /**
+     * Find the machines each edge lies on a shortest path to, in each
+     * vnet. The result holds one bitmap of machines per edge and vnet,
+     * at index edge * m_vnets + vnet, with machines numbered like the
+     * output endpoints.
+     */
+    std::vector<std::vector<uint64_t>> computeRoutes(
+        const std::vector<Edge> &edges, int num_switches) const;
+
+    NetDest routeToNetDest(const std::vector<uint64_t> &route) const;
 
     uint32_t m_nodes;
     const uint32_t m_number_of_switches;
@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/network/analytical/AnalyticalNetwork.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/trace.hh"
+#include "debug/RubyNetwork.hh"
+#include "mem/ruby/common/NetDest.hh"
+#include "mem/ruby/network/BasicLink.hh"
+#include "mem/ruby/network/BasicRouter.hh"
+#include "mem/ruby/network/MessageBuffer.hh"
+#include "mem/ruby/slicc_interface/Message.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+AnalyticalNetwork::AnalyticalNetwork(const Params &p)
+    : Network(p), m_utilization_window(p.utilization_window),
+      m_max_utilization(p.max_utilization),
+      m_contention_factor(p.contention_factor), networkStats(this)
+{
+    fatal_if(m_utilization_window == 0,
+             "%s: utilization_window must not be zero.", name());
+    fatal_if(m_max_utilization < 0 || m_max_utilization >= 1,
+             "%s: max_utilization must be in [0, 1).", name());
+    fatal_if(m_contention_factor < 0,
+             "%s: contention_factor must not be negative.", name());
+
+    for (auto *router : p.routers) {
+        size_t id = router->params().router_id;
+        if (id >= m_router_latencies.size())
+            m_router_latencies.resize(id + 1, Cycles(0));
+        m_router_latencies[id] = Cycles(router->params().latency);
+    }
+}
+
+void
+AnalyticalNetwork::init()
+{
+    Network::init();
+
+    m_in_routers.resize(m_nodes,
+                        std::vector<int>(m_virtual_networks, -1));
+    m_last_arrivals.resize(m_nodes,
+                           std::vector<Tick>(m_virtual_networks, 0));
+
+    // The topology pointer should have already been initialized in
+    // the parent class network constructor.
+    assert(m_topology_ptr != NULL);
+    m_topology_ptr->createLinks(this);
+
+    for (NodeID node = 0; node < m_nodes; node++) {
+        m_ports.emplace_back(new NodePort(this, node));
+        for (auto *buffer : m_toNetQueues[node]) {
+            if (buffer)
+                buffer->setConsumer(m_ports.back().get());
+        }
+    }
+}
+
+int
+AnalyticalNetwork::addLink(BasicLink *link, int dest, NodeID node)
+{
+    fatal_if(link->m_bandwidth_factor <= 0,
+             "%s: the bandwidth_factor of %s must be positive.", name(),
+             link->name());
+
+    Link l;
+    l.latency = link->m_latency;
+    l.bandwidth = link->m_bandwidth_factor;
+    l.dest = dest;
+    l.node = node;
+    l.windowStart = Cycles(0);
+    l.busy = 0;
+    l.messages = 0;
+    l.utilization = 0;
+    l.meanOccupancy = 0;
+    m_links.push_back(l);
+
+    return m_links.size() - 1;
+}
+
+void
+AnalyticalNetwork::addRoutes(SwitchID router, int link,
+                             std::vector<NetDest> &routing_table_entry)
+{
+    if (router >= m_routes.size())
+        m_routes.resize(router + 1);
+    m_routes[router].resize(m_virtual_networks);
+
+    for (int vnet = 0; vnet < routing_table_entry.size(); vnet++) {
+        std::vector<int> &routes = m_routes[router][vnet];
+        for (NodeID dest : routing_table_entry[vnet].getAllDest()) {
+            if (dest >= routes.size())
+                routes.resize(dest + 1, -1);
+            // The topology only offers links on shortest paths. Like
+            // the weight-based routing of the simple network, the
+            // first one is taken.
+            if (routes[dest] < 0)
+                routes[dest] = link;
+        }
+    }
+}
+
+// From a router to an endpoint node
+void
+AnalyticalNetwork::makeExtOutLink(SwitchID src, NodeID global_dest,
+                                  BasicLink* link,
+                                  std::vector<NetDest>& routing_table_entry)
+{
+    NodeID local_dest = getLocalNodeID(global_dest);
+    assert(local_dest < m_nodes);
+
+    addRoutes(src, addLink(link, -1, local_dest), routing_table_entry);
+}
+
+// From an endpoint node to a router
+void
+AnalyticalNetwork::makeExtInLink(NodeID global_src, SwitchID dest,
+                                 BasicLink* link,
+                                 std::vector<NetDest>& routing_table_entry)
+{
+    NodeID local_src = getLocalNodeID(global_src);
+    assert(local_src < m_nodes);
+
+    // Like in the simple network, the latency of the link into the
+    // network is not modeled.
+    for (int vnet = 0; vnet < m_virtual_networks; vnet++) {
+        if (link->mVnets.empty() ||
+            std::find(link->mVnets.begin(), link->mVnets.end(), vnet) !=
+            link->mVnets.end()) {
+            m_in_routers[local_src][vnet] = dest;
+        }
+    }
+}
+
+// From a router to a router
+void
+AnalyticalNetwork::makeInternalLink(SwitchID src, SwitchID dest,
+                                    BasicLink* link,
+                                    std::vector<NetDest>& routing_table_entry,
+                                    PortDirection src_outport,
+                                    PortDirection dst_inport)
+{
+    addRoutes(src, addLink(link, dest, 0), routing_table_entry);
+}
+
+void
+AnalyticalNetwork::inject(NodeID local_src)
+{
+    Tick current_time = clockEdge();
+    std::vector<MessageBuffer *> &in_buffers = m_toNetQueues[local_src];
+
+    for (int vnet = 0; vnet < in_buffers.size(); vnet++) {
+        MessageBuffer *in = in_buffers[vnet];
+        if (in == nullptr)
+            continue;
+
+        while (in->isReady(current_time)) {
+            MsgPtr msg = in->peekMsgPtr();
+            NetDest destination = msg->getDestination();
+            std::vector<NodeID> dests = destination.getAllDest();
+
+            if (!canDeliver(dests, vnet, current_time)) {
+                // Retry once the destinations had a chance to drain.
+                networkStats.stalls++;
+                m_ports[local_src]->scheduleEvent(Cycles(1));
+                break;
+            }
+
+            in->dequeue(current_time);
+            int bytes = MessageSizeType_to_int(msg->getMessageSize());
+
+            for (int i = 0; i < dests.size(); i++) {
+                int hops = 0;
+                double queueing = 0;
+                double latency = traverse(local_src, dests[i], vnet, bytes,
+                                          hops, queueing);
+
+                NodeID local_dest = getLocalNodeID(dests[i]);
+                MessageBuffer *out = m_fromNetQueues[local_dest][vnet];
+                Tick arrival = clockEdge(Cycles(std::ceil(latency)));
+
+                // The modeled delay varies, so messages to an ordered
+                // buffer are held back behind the ones sent before.
+                Tick &last_arrival = m_last_arrivals[local_dest][vnet];
+                if (out->getOrdered())
+                    arrival = std::max(arrival, last_arrival);
+                last_arrival = arrival;
+
+                DPRINTF(RubyNetwork, "Node %d to node %d on vnet %d: "
+                        "%d hops, %.1f cycles (%.1f queueing)\n", local_src,
+                        local_dest, vnet, hops, latency, queueing);
+
+                out->enqueue(i + 1 < dests.size() ? msg->clone() : msg,
+                             current_time, arrival - current_time,
+                             getRandomization(), getWarmupEnabled());
+
+                networkStats.deliveries++;
+                networkStats.totalHops += hops;
+                networkStats.totalLatency += latency;
+                networkStats.totalQueueingLatency += queueing;
+            }
+        }
+    }
+}
+
+bool
+AnalyticalNetwork::canDeliver(const std::vector<NodeID> &dests, int vnet,
+                              Tick current_time)
+{
+    for (NodeID dest : dests) {
+        NodeID local_dest = getLocalNodeID(dest);
+        panic_if(vnet >= m_fromNetQueues[local_dest].size() ||
+                 m_fromNetQueues[local_dest][vnet] == nullptr,
+                 "%s: node %d has no buffer for vnet %d.", name(),
+                 local_dest, vnet);
+        if (!m_fromNetQueues[local_dest][vnet]->areNSlotsAvailable(
+                1, current_time)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double
+AnalyticalNetwork::traverse(NodeID local_src, NodeID global_dest, int vnet,
+                            int bytes, int &hops, double &queueing)
+{
+    int router = m_in_routers[local_src][vnet];
+    panic_if(router < 0, "%s: node %d is not connected for vnet %d.",
+             name(), local_src, vnet);
+
+    double latency = m_router_latencies[router];
+    while (true) {
+        const std::vector<int> &routes = m_routes[router][vnet];
+        int l = global_dest < routes.size() ? routes[global_dest] : -1;
+        panic_if(l < 0, "%s: router %d has no route to node %d on "
+                 "vnet %d.", name(), router, global_dest, vnet);
+
+        Link &link = m_links[l];
+        double wait = queueingDelay(link,
+                                    curCycle() + Cycles(std::lround(latency)),
+                                    divCeil(bytes, link.bandwidth));
+        latency += link.latency + wait;
+        queueing += wait;
+
+        if (link.dest < 0) {
+            assert(link.node == getLocalNodeID(global_dest));
+            return latency;
+        }
+
+        router = link.dest;
+        latency += m_router_latencies[router];
+        hops++;
+    }
+}
+
+double
+AnalyticalNetwork::queueingDelay(Link &link, Cycles when, uint64_t occupancy)
+{
+    // The utilization of a window is known once it is over, so the
+    // delay is based on the previous window. Messages that reach the
+    // link in an earlier window than the last one are counted in the
+    // current window.
+    uint64_t window = m_utilization_window;
+    Cycles window_start(when / window * window);
+    if (window_start > link.windowStart) {
+        if (window_start == link.windowStart + m_utilization_window &&
+            link.messages > 0) {
+            link.utilization = double(link.busy) / window;
+            link.meanOccupancy = double(link.busy) / link.messages;
+        } else {
+            link.utilization = 0;
+            link.meanOccupancy = 0;
+        }
+        link.windowStart = window_start;
+        link.busy = 0;
+        link.messages = 0;
+    }
+
+    link.busy += occupancy;
+    link.messages++;
+
+    double rho = std::min(link.utilization, m_max_utilization);
+    return m_contention_factor * rho * link.meanOccupancy / (2 * (1 - rho));
+}
+
+void
+AnalyticalNetwork::print(std::ostream& out) const
+{
+    out << "[AnalyticalNetwork]";
+}
+
+void
+AnalyticalNetwork::NodePort::print(std::ostream& out) const
+{
+    out << "[AnalyticalNetwork node " << node << "]";
+}
+
+AnalyticalNetwork::
+NetworkStats::NetworkStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(deliveries, statistics::units::Count::get(),
+               "Number of messages delivered to a destination"),
+      ADD_STAT(totalHops, statistics::units::Count::get(),
+               "Total number of router hops of the delivered messages"),
+      ADD_STAT(totalLatency, statistics::units::Cycle::get(),
+               "Total modeled latency of the delivered messages"),
+      ADD_STAT(totalQueueingLatency, statistics::units::Cycle::get(),
+               "Total modeled queueing delay of the delivered messages"),
+      ADD_STAT(stalls, statistics::units::Count::get(),
+               "Number of times a message waited for a full destination "
+               "buffer"),
+      ADD_STAT(avgHops, statistics::units::Rate<
+                   statistics::units::Count, statistics::units::Count>::get(),
+               "Average number of router hops per delivery"),
+      ADD_STAT(avgLatency, statistics::units::Rate<
+                   statistics::units::Cycle, statistics::units::Count>::get(),
+               "Average modeled latency per delivery"),
+      ADD_STAT(avgQueueingLatency, statistics::units::Rate<
+                   statistics::units::Cycle, statistics::units::Count>::get(),
+               "Average modeled queueing delay per delivery")
+{
+    avgHops = totalHops / deliveries;
+    avgLatency = totalLatency / deliveries;
+    avgQueueingLatency = totalQueueingLatency / deliveries;
+}
+
+} // namespace ruby
+} // namespace gem5
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_ANALYTICAL_ANALYTICALNETWORK_HH__
+#define __MEM_RUBY_NETWORK_ANALYTICAL_ANALYTICALNETWORK_HH__
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/network/Network.hh"
+#include "params/AnalyticalNetwork.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * A Ruby network that does not model switching. When a message enters
+ * the network, its delivery time to every destination is computed from
+ * the route the topology gives it, and the message is enqueued in the
+ * destination buffer with that delay, so every delivery costs a single
+ * event.
+ *
+ * Each hop adds the link latency, the latency of the router at its end,
+ * and the mean waiting time of an M/D/1 queue at the link,
+ *
+ *     W = rho * S / (2 * (1 - rho)),
+ *
+ * where S is the time the message occupies the link and rho is the
+ * link utilization measured over the previous utilization window. The
+ * delay is scaled by the contention factor, which can be tuned to match
+ * a detailed network.
+ */
+class AnalyticalNetwork : public Network
+{
+  public:
+    PARAMS(AnalyticalNetwork);
+
+    AnalyticalNetwork(const Params &p);
+    ~AnalyticalNetwork() = default;
+
+    void init() override;
+
+    // Methods used by Topology to setup the network
+    void makeExtOutLink(SwitchID src, NodeID dest, BasicLink* link,
+                     std::vector<NetDest>& routing_table_entry) override;
+    void makeExtInLink(NodeID src, SwitchID dest, BasicLink* link,
+                    std::vector<NetDest>& routing_table_entry) override;
+    void makeInternalLink(SwitchID src, SwitchID dest, BasicLink* link,
+                          std::vector<NetDest>& routing_table_entry,
+                          PortDirection src_outport,
+                          PortDirection dst_inport) override;
+
+    void collateStats() override {}
+    void print(std::ostream& out) const override;
+
+    // Messages are in the buffers of the controllers as soon as they
+    // are sent, so there is nothing to access in the network itself.
+    bool functionalRead(Packet *pkt) override { return false; }
+    bool
+    functionalRead(Packet *pkt, WriteMask &mask) override
+    {
+        return false;
+    }
+    uint32_t functionalWrite(Packet *pkt) override { return 0; }
+
+  private:
+    /** Wakes up the network when a node has messages to send. */
+    class NodePort : public Consumer
+    {
+      private:
+        AnalyticalNetwork *network;
+        NodeID node;
+
+      public:
+        NodePort(AnalyticalNetwork *_network, NodeID _node)
+            : Consumer(_network), network(_network), node(_node)
+        {}
+
+        void wakeup() override { network->inject(node); }
+        void print(std::ostream& out) const override;
+    };
+
+    struct Link
+    {
+        Cycles latency;
+        // Bytes per cycle
+        int bandwidth;
+        // Router at the end of the link, or -1 for links to a node
+        int dest;
+        // Local id of the node an external link leads to
+        NodeID node;
+
+        // Cycles the link was occupied and messages it carried in the
+        // current window
+        Cycles windowStart;
+        uint64_t busy;
+        uint64_t messages;
+        // Measured in the previous window
+        double utilization;
+        double meanOccupancy;
+    };
+
+    int addLink(BasicLink *link, int dest, NodeID node);
+    void addRoutes(SwitchID router, int link,
+                   std::vector<NetDest> &routing_table_entry);
+
+    /** Sends the ready messages of a node into the network. */
+    void inject(NodeID local_src);
+
+    /** Checks that all destinations of a message can take it. */
+    bool canDeliver(const std::vector<NodeID> &dests, int vnet,
+                    Tick current_time);
+
+    /**
+     * Walks the route of a message from a source to a destination and
+     * returns its latency in cycles. Also accounts the message to the
+     * utilization of the links on the way.
+     */
+    double traverse(NodeID local_src, NodeID global_dest, int vnet,
+                    int bytes, int &hops, double &queueing);
+
+    /** M/D/1 waiting time at a link, updating its utilization. */
+    double queueingDelay(Link &link, Cycles when, uint64_t occupancy);
+
+    const Cycles m_utilization_window;
+    const double m_max_utilization;
+    const double m_contention_factor;
+
+    std::vector<Cycles> m_router_latencies;
+    std::vector<Link> m_links;
+    // Router each vnet of a node enters the network at
+    std::vector<std::vector<int>> m_in_routers;
+    // Next link to each global destination, indexed by router and vnet
+    std::vector<std::vector<std::vector<int>>> m_routes;
+    std::vector<std::unique_ptr<NodePort>> m_ports;
+    // Latest arrival time in each destination buffer
+    std::vector<std::vector<Tick>> m_last_arrivals;
+
+    struct NetworkStats : public statistics::Group
+    {
+        NetworkStats(statistics::Group *parent);
+
+        statistics::Scalar deliveries;
+        statistics::Scalar totalHops;
+        statistics::Scalar totalLatency;
+        statistics::Scalar totalQueueingLatency;
+        statistics::Scalar stalls;
+        statistics::Formula avgHops;
+        statistics::Formula avgLatency;
+        statistics::Formula avgQueueingLatency;
+    } networkStats;
+};
+
+inline std::ostream&
+operator<<(std::ostream& out, const AnalyticalNetwork& obj)
+{
+    obj.print(out);
+    out << std::flush;
+    return out;
+}
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_NETWORK_ANALYTICAL_ANALYTICALNETWORK_HH__
@@ -0,0 +1,57 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.objects.Network import RubyNetwork
+from m5.params import *
+from m5.proxy import *
+
+
+class AnalyticalNetwork(RubyNetwork):
+    """A network that delivers every message with a single event.
+
+    The delivery time is computed when a message enters the network: the
+    router and link latencies along its route, plus an M/D/1 queueing
+    delay at each link based on the utilization measured over the last
+    utilization window. It uses the plain BasicRouter, BasicIntLink and
+    BasicExtLink objects of the topology, and bandwidth_factor is the
+    link bandwidth in bytes per cycle.
+    """
+
+    type = "AnalyticalNetwork"
+    cxx_header = "mem/ruby/network/analytical/AnalyticalNetwork.hh"
+    cxx_class = "gem5::ruby::AnalyticalNetwork"
+
+    utilization_window = Param.Cycles(
+        1000, "number of cycles over which link utilization is measured"
+    )
+    max_utilization = Param.Float(
+        0.95, "upper bound of the link utilization used in the delay model"
+    )
+    contention_factor = Param.Float(
+        1.0,
+        "scale applied to the modeled queueing delay, for calibration "
+        "against a detailed network (0 disables contention)",
+    )
@@ -71,6 +71,7 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     m_buffers_per_ctrl_vc = p.buffers_per_ctrl_vc;
     m_routing_algorithm = p.routing_algorithm;
     m_next_packet_id = 0;
+    m_partitioned = false;
 
     m_enable_fault_model = p.enable_fault_model;
     if (m_enable_fault_model)
@@ -121,6 +122,32 @@ GarnetNetwork::init()
     assert(m_topology_ptr != NULL);
     m_topology_ptr->createLinks(this);
 
+    // Routers and interfaces on different event queues are simulated in
+    // parallel. Every link runs on the queue of its source, and the links
+    // between queues hand their flits and credits over to the other side.
+    for (auto *router : m_routers)
+        m_partitioned |= router->eventQueue() != eventQueue();
+
+    if (m_partitioned) {
+        fatal_if(!m_networkbridges.empty(), "Network bridges (CDC and "
+                 "SerDes) are not supported when the routers of %s are "
+                 "on different event queues.", name());
+
+        // The interfaces run next to their routers, which is also where
+        // the controllers have to be.
+        for (auto *ni : m_nis)
+            ni->followRouters();
+
+        int num_remote_links = 0;
+        for (auto *link : m_networklinks)
+            num_remote_links += link->followSource();
+        for (auto *link : m_creditlinks)
+            num_remote_links += link->followSource();
+
+        inform("%s: %d links connect different event queues\n", name(),
+               num_remote_links);
+    }
+
     // Initialize topology specific parameters
     if (getNumRows() > 0) {
         // Only for Mesh topology
@@ -134,6 +161,9 @@ GarnetNetwork::init()
         m_num_cols = -1;
     }
 
+    for (auto *router : m_routers)
+        router->buildRoutingTables();
+
     // FaultModel: declare each router to the fault model
     if (isFaultModelEnabled()) {
         for (std::vector<Router*>::const_iterator i= m_routers.begin();
@@ -609,6 +639,7 @@ GarnetNetwork::update_traffic_distribution(RouteInfo route)
     int dest_node = route.dest_router;
     int vnet = route.vnet;
 
+    auto lock = statsLock();
     if (m_vnet_type[vnet] == DATA_VNET_)
         (*m_data_traffic_distribution[src_node][dest_node])++;
     else
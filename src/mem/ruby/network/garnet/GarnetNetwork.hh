@@ -32,7 +32,9 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 #define __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 
+#include <atomic>
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 #include "mem/ruby/network/Network.hh"
@@ -93,6 +95,7 @@ class GarnetNetwork : public Network
         return m_vnet_type[vnet];
     }
     int getNumRouters();
+    Router *getRouter(SwitchID id) const { return m_routers[id]; }
     int get_router_id(int ni, int vnet);
 
 
@@ -118,39 +121,66 @@ class GarnetNetwork : public Network
     void print(std::ostream& out) const;
 
     // increment counters
-    void increment_injected_packets(int vnet) { m_packets_injected[vnet]++; }
-    void increment_received_packets(int vnet) { m_packets_received[vnet]++; }
+    void
+    increment_injected_packets(int vnet)
+    {
+        auto lock = statsLock();
+        m_packets_injected[vnet]++;
+    }
+
+    void
+    increment_received_packets(int vnet)
+    {
+        auto lock = statsLock();
+        m_packets_received[vnet]++;
+    }
 
     void
     increment_packet_network_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_packet_network_latency[vnet] += latency;
     }
 
     void
     increment_packet_queueing_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_packet_queueing_latency[vnet] += latency;
     }
 
-    void increment_injected_flits(int vnet) { m_flits_injected[vnet]++; }
-    void increment_received_flits(int vnet) { m_flits_received[vnet]++; }
+    void
+    increment_injected_flits(int vnet)
+    {
+        auto lock = statsLock();
+        m_flits_injected[vnet]++;
+    }
+
+    void
+    increment_received_flits(int vnet)
+    {
+        auto lock = statsLock();
+        m_flits_received[vnet]++;
+    }
 
     void
     increment_flit_network_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_flit_network_latency[vnet] += latency;
     }
 
     void
     increment_flit_queueing_latency(Tick latency, int vnet)
     {
+        auto lock = statsLock();
         m_flit_queueing_latency[vnet] += latency;
     }
 
     void
     increment_total_hops(int hops)
     {
+        auto lock = statsLock();
         m_total_hops += hops;
     }
 
@@ -213,7 +243,22 @@ class GarnetNetwork : public Network
     std::vector<NetworkBridge *> m_networkbridges; // All network bridges
     std::vector<CreditLink *> m_creditlinks; // All credit links in the network
     std::vector<NetworkInterface *> m_nis;   // All NI's in Network
-    int m_next_packet_id; // static vairable for packet id allocation
+    std::atomic<int> m_next_packet_id; // variable for packet id allocation
+
+    /**
+     * Set when the routers and interfaces are spread over several event
+     * queues. The interfaces then update the network-wide stats from
+     * different threads, so the updates are serialized.
+     */
+    bool m_partitioned;
+    std::mutex m_stats_mutex;
+
+    std::unique_lock<std::mutex>
+    statsLock()
+    {
+        return m_partitioned ? std::unique_lock<std::mutex>(m_stats_mutex)
+                             : std::unique_lock<std::mutex>();
+    }
 };
 
 inline std::ostream&
@@ -36,9 +36,11 @@
 #include <cmath>
 
 #include "base/cast.hh"
+#include "base/logging.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/MessageBuffer.hh"
 #include "mem/ruby/network/garnet/Credit.hh"
+#include "mem/ruby/network/garnet/Router.hh"
 #include "mem/ruby/network/garnet/flitBuffer.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 #include "mem/ruby/system/RubySystem.hh"
@@ -141,6 +143,32 @@ NetworkInterface::addNode(std::vector<MessageBuffer *>& in,
     }
 }
 
+void
+NetworkInterface::followRouters()
+{
+    assert(!outPorts.empty());
+    EventQueue *router_eventq =
+        m_net_ptr->getRouter(outPorts[0]->routerID())->eventQueue();
+
+    for (auto &oPort : outPorts) {
+        fatal_if(m_net_ptr->getRouter(oPort->routerID())->eventQueue() !=
+                 router_eventq, "%s injects into routers on different "
+                 "event queues.", name());
+    }
+
+    auto check_buffers = [&](const std::vector<MessageBuffer *> &buffers) {
+        for (auto *buffer : buffers) {
+            fatal_if(buffer && buffer->eventQueue() != router_eventq,
+                     "%s must be on the same event queue as the router "
+                     "%s is attached to.", buffer->name(), name());
+        }
+    };
+    check_buffers(inNode_ptr);
+    check_buffers(outNode_ptr);
+
+    eventq = router_eventq;
+}
+
 void
 NetworkInterface::dequeueCallback()
 {
@@ -191,12 +219,14 @@ NetworkInterface::incrementStats(flit *t_flit)
 void
 NetworkInterface::wakeup()
 {
-    std::ostringstream oss;
-    for (auto &oPort: outPorts) {
-        oss << oPort->routerID() << "[" << oPort->printVnets() << "] ";
+    if (debug::RubyNetwork) {
+        std::ostringstream oss;
+        for (auto &oPort: outPorts) {
+            oss << oPort->routerID() << "[" << oPort->printVnets() << "] ";
+        }
+        DPRINTF(RubyNetwork, "Network Interface %d connected to router:%s "
+                "woke up. Period: %ld\n", m_id, oss.str(), clockPeriod());
     }
-    DPRINTF(RubyNetwork, "Network Interface %d connected to router:%s "
-            "woke up. Period: %ld\n", m_id, oss.str(), clockPeriod());
 
     assert(curTick() == clockEdge());
     MsgPtr msg_ptr;
@@ -452,6 +482,7 @@ NetworkInterface::flitisizeMessage(MsgPtr msg_ptr, int vnet)
 
             fl->set_src_delay(curTick() - msg_ptr->getTime());
             niOutVcs[vc].insert(fl);
+            m_ni_out_flits++;
         }
 
         m_ni_out_vcs_enqueue_time[vc] = curTick();
@@ -527,6 +558,7 @@ NetworkInterface::scheduleOutputPort(OutputPort *oPort)
 
                // Just removing the top flit
                flit *t_flit = niOutVcs[vc].getTopFlit();
+               m_ni_out_flits--;
                t_flit->set_time(clockEdge(Cycles(1)));
 
                // Scheduling the flit
@@ -556,6 +588,9 @@ NetworkInterface::scheduleOutputPort(OutputPort *oPort)
 void
 NetworkInterface::scheduleOutputLink()
 {
+    if (m_ni_out_flits == 0)
+        return;
+
     // Schedule each output link
     for (auto &oPort: outPorts) {
         scheduleOutputPort(oPort);
@@ -640,10 +675,12 @@ NetworkInterface::checkReschedule()
         }
     }
 
-    for (auto& ni_out_vc : niOutVcs) {
-        if (ni_out_vc.isReady(clockEdge(Cycles(1)))) {
-            scheduleEvent(Cycles(1));
-            return;
+    if (m_ni_out_flits > 0) {
+        for (auto& ni_out_vc : niOutVcs) {
+            if (ni_out_vc.isReady(clockEdge(Cycles(1)))) {
+                scheduleEvent(Cycles(1));
+                return;
+            }
         }
     }
 
@@ -33,6 +33,7 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET_0_NETWORKINTERFACE_HH__
 #define __MEM_RUBY_NETWORK_GARNET_0_NETWORKINTERFACE_HH__
 
+#include <deque>
 #include <iostream>
 #include <vector>
 
@@ -79,6 +80,12 @@ class NetworkInterface : public ClockedObject, public Consumer
     int get_vnet(int vc);
     void init_net_ptr(GarnetNetwork *net_ptr) { m_net_ptr = net_ptr; }
 
+    /**
+     * Move this interface to the event queue of the routers it injects
+     * into. The controller it serves has to be on the same queue.
+     */
+    void followRouters();
+
     bool functionalRead(Packet *pkt, WriteMask &mask);
     uint32_t functionalWrite(Packet *);
 
@@ -285,6 +292,9 @@ class NetworkInterface : public ClockedObject, public Consumer
     // The flit buffers which will serve the Consumer
     std::vector<flitBuffer>  niOutVcs;
     std::vector<Tick> m_ni_out_vcs_enqueue_time;
+    // Number of flits in niOutVcs, so that wakeups without outgoing
+    // flits do not have to look at every VC
+    int m_ni_out_flits = 0;
 
     // The Message buffers that takes messages from the protocol
     std::vector<MessageBuffer *> inNode_ptr;
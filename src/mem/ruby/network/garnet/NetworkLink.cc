@@ -32,9 +32,11 @@
 
 #include "mem/ruby/network/garnet/NetworkLink.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/RubyNetwork.hh"
 #include "mem/ruby/network/garnet/CreditLink.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -49,7 +51,7 @@ NetworkLink::NetworkLink(const Params &p)
     : ClockedObject(p), Consumer(this), m_id(p.link_id),
       m_type(NUM_LINK_TYPES_),
       m_latency(p.link_latency), m_link_utilized(0),
-      m_virt_nets(p.virt_nets), linkBuffer(),
+      m_remote_consumer(false), m_virt_nets(p.virt_nets), linkBuffer(),
       link_consumer(nullptr), link_srcQueue(nullptr)
 {
     int num_vnets = (p.supported_vnets).size();
@@ -98,8 +100,15 @@ NetworkLink::wakeup()
                 (mVnets.size() == 0));
         }
         t_flit->set_time(clockEdge(m_latency));
-        linkBuffer.insert(t_flit);
-        link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
+        if (m_remote_consumer) {
+            std::lock_guard<std::mutex> lock(m_in_flight_mutex);
+            m_in_flight.insert(t_flit);
+            link_consumer->getObject()->eventQueue()->schedule(
+                new DeliveryEvent(this), clockEdge(m_latency));
+        } else {
+            linkBuffer.insert(t_flit);
+            link_consumer->scheduleEventAbsolute(clockEdge(m_latency));
+        }
         m_link_utilized++;
         m_vc_load[t_flit->get_vc()]++;
     }
@@ -109,6 +118,42 @@ NetworkLink::wakeup()
     }
 }
 
+bool
+NetworkLink::followSource()
+{
+    EventQueue *src_eventq = src_object->eventQueue();
+    EventQueue *dst_eventq = link_consumer->getObject()->eventQueue();
+
+    eventq = src_eventq;
+    m_remote_consumer = src_eventq != dst_eventq;
+
+    if (m_remote_consumer) {
+        fatal_if(simQuantum == 0, "%s connects %s and %s on different "
+                 "event queues, which requires sim_quantum or "
+                 "sim_lookahead to be set.", name(), src_object->name(),
+                 link_consumer->getObject()->name());
+        fatal_if(cyclesToTicks(m_latency) < simQuantum, "The latency of "
+                 "%s (%d ticks) must not be less than the simulation "
+                 "quantum (%d ticks), as it connects different event "
+                 "queues.", name(), cyclesToTicks(m_latency), simQuantum);
+    }
+
+    return m_remote_consumer;
+}
+
+void
+NetworkLink::deliverFlit()
+{
+    flit *t_flit;
+    {
+        std::lock_guard<std::mutex> lock(m_in_flight_mutex);
+        t_flit = m_in_flight.getTopFlit();
+    }
+    assert(t_flit->get_time() == curTick());
+    linkBuffer.insert(t_flit);
+    link_consumer->scheduleEventAbsolute(curTick());
+}
+
 void
 NetworkLink::resetStats()
 {
@@ -122,13 +167,23 @@ NetworkLink::resetStats()
 bool
 NetworkLink::functionalRead(Packet *pkt, WriteMask &mask)
 {
-    return linkBuffer.functionalRead(pkt, mask);
+    bool read = linkBuffer.functionalRead(pkt, mask);
+    if (m_remote_consumer) {
+        std::lock_guard<std::mutex> lock(m_in_flight_mutex);
+        read |= m_in_flight.functionalRead(pkt, mask);
+    }
+    return read;
 }
 
 uint32_t
 NetworkLink::functionalWrite(Packet *pkt)
 {
-    return linkBuffer.functionalWrite(pkt);
+    uint32_t num_written = linkBuffer.functionalWrite(pkt);
+    if (m_remote_consumer) {
+        std::lock_guard<std::mutex> lock(m_in_flight_mutex);
+        num_written += m_in_flight.functionalWrite(pkt);
+    }
+    return num_written;
 }
 
 } // namespace garnet
@@ -34,6 +34,7 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_NETWORKLINK_HH__
 
 #include <iostream>
+#include <mutex>
 #include <vector>
 
 #include "mem/ruby/common/Consumer.hh"
@@ -70,6 +71,16 @@ class NetworkLink : public ClockedObject, public Consumer
     flitBuffer *getBuffer() { return &linkBuffer;}
     virtual void wakeup();
 
+    /**
+     * Move this link to the event queue of its source. If the consumer
+     * is on another event queue, flits are handed over to it with
+     * events on the consumer's queue, which makes the link latency the
+     * lookahead between the two queues.
+     *
+     * @return true if the link crosses event queues.
+     */
+    bool followSource();
+
     unsigned int getLinkUtilization() const { return m_link_utilized; }
     const std::vector<unsigned int> & getVcLoad() const { return m_vc_load; }
 
@@ -89,6 +100,23 @@ class NetworkLink : public ClockedObject, public Consumer
     uint32_t bitWidth;
 
   private:
+    /** Hands the oldest in-flight flit over to a remote consumer. */
+    class DeliveryEvent : public Event
+    {
+      private:
+        NetworkLink *link;
+
+      public:
+        DeliveryEvent(NetworkLink *_link)
+            : Event(Default_Pri - 1, AutoDelete), link(_link)
+        {}
+
+        void process() override { link->deliverFlit(); }
+        const char *description() const override { return "flit delivery"; }
+    };
+
+    void deliverFlit();
+
     const int m_id;
     link_type m_type;
     const Cycles m_latency;
@@ -99,6 +127,12 @@ class NetworkLink : public ClockedObject, public Consumer
     unsigned int m_link_utilized;
     std::vector<unsigned int> m_vc_load;
 
+    // Flits sent to a consumer on another event queue that have not
+    // been delivered yet. The mutex is only needed in that case.
+    bool m_remote_consumer;
+    std::mutex m_in_flight_mutex;
+    flitBuffer m_in_flight;
+
   protected:
     uint32_t m_virt_nets;
     flitBuffer linkBuffer;
@@ -36,6 +36,7 @@
 #include "mem/ruby/network/garnet/InputUnit.hh"
 #include "mem/ruby/network/garnet/Router.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
+#include "mem/ruby/system/RubySystem.hh"
 
 namespace gem5
 {
@@ -87,14 +88,93 @@ RoutingUnit::supportsVnet(int vnet, std::vector<int> sVnets)
     return false;
 }
 
+void
+RoutingUnit::buildTables()
+{
+    GarnetNetwork *net = m_router->get_net_ptr();
+    const int num_vnets = m_routing_table.size();
+    const int num_links = m_weight_table.size();
+    m_num_nodes =
+        net->getRubySystem()->MachineType_base_number(MachineType_NUM);
+    m_link_words = (num_links + 63) / 64;
+
+    m_dest_links.assign((size_t)num_vnets * m_num_nodes * m_link_words, 0);
+    for (int vnet = 0; vnet < num_vnets; vnet++) {
+        for (int link = 0; link < m_routing_table[vnet].size(); link++) {
+            for (NodeID dest : m_routing_table[vnet][link].getAllDest()) {
+                size_t entry = (size_t)vnet * m_num_nodes + dest;
+                m_dest_links[entry * m_link_words + link / 64] |=
+                    (uint64_t)1 << (link % 64);
+            }
+        }
+    }
+
+    // Keep the candidates with the minimum weight, in link order
+    m_candidate_offsets.assign(1, 0);
+    m_candidates.clear();
+    for (size_t entry = 0; entry < (size_t)num_vnets * m_num_nodes;
+         entry++) {
+        const uint64_t *links = &m_dest_links[entry * m_link_words];
+        int min_weight = INFINITE_;
+        for (int link = 0; link < num_links; link++) {
+            if ((links[link / 64] >> (link % 64) & 1) &&
+                m_weight_table[link] <= min_weight) {
+                min_weight = m_weight_table[link];
+            }
+        }
+        for (int link = 0; link < num_links; link++) {
+            if ((links[link / 64] >> (link % 64) & 1) &&
+                m_weight_table[link] == min_weight) {
+                m_candidates.push_back(link);
+            }
+        }
+        m_candidate_offsets.push_back(m_candidates.size());
+    }
+
+    // XY routing only depends on the destination router in a mesh
+    const int num_cols = net->getNumCols();
+    if (net->getNumRows() <= 0 || num_cols <= 0)
+        return;
+
+    const int num_routers = net->getNumRouters();
+    const int my_id = m_router->get_id();
+    const int my_x = my_id % num_cols;
+    const int my_y = my_id / num_cols;
+    m_xy_outports.assign(num_routers, -1);
+    m_xy_outport_dirns.assign(num_routers, "Unknown");
+    for (int dest_id = 0; dest_id < num_routers; dest_id++) {
+        int dest_x = dest_id % num_cols;
+        int dest_y = dest_id / num_cols;
+
+        PortDirection outport_dirn;
+        if (dest_x != my_x)
+            outport_dirn = dest_x > my_x ? "East" : "West";
+        else if (dest_y != my_y)
+            outport_dirn = dest_y > my_y ? "North" : "South";
+        else
+            continue;
+
+        // Directions this router does not have map to port 0, as the
+        // directions of mesh routers are expected to be complete.
+        auto it = m_outports_dirn2idx.find(outport_dirn);
+        m_xy_outports[dest_id] =
+            it != m_outports_dirn2idx.end() ? it->second : 0;
+        m_xy_outport_dirns[dest_id] = outport_dirn;
+    }
+}
+
 /*
  * This is the default routing algorithm in garnet.
  * The routing table is populated during topology creation.
  * Routes can be biased via weight assignments in the topology file.
  * Correct weight assignments are critical to provide deadlock avoidance.
+ *
+ * The routing table is flattened by buildTables() into the minimum weight
+ * candidate output links of each destination, so that a unicast lookup is
+ * a single table access.
  */
 int
-RoutingUnit::lookupRoutingTable(int vnet, NetDest msg_destination)
+RoutingUnit::lookupRoutingTable(int vnet, NodeID dest)
 {
     // First find all possible output link candidates
     // For ordered vnet, just choose the first
@@ -102,31 +182,58 @@ RoutingUnit::lookupRoutingTable(int vnet, NetDest msg_destination)
     // For unordered vnet, randomly choose any of the links
     // To have a strict ordering between links, they should be given
     // different weights in the topology file
+    assert(dest < m_num_nodes);
+    const size_t entry = (size_t)vnet * m_num_nodes + dest;
+    assert(entry + 1 < m_candidate_offsets.size());
+    const uint32_t first = m_candidate_offsets[entry];
+    const int num_candidates = m_candidate_offsets[entry + 1] - first;
 
-    int output_link = -1;
-    int min_weight = INFINITE_;
-    std::vector<int> output_link_candidates;
-    int num_candidates = 0;
+    if (num_candidates == 0) {
+        fatal("Fatal Error:: No Route exists from this Router.");
+        exit(0);
+    }
 
-    // Identify the minimum weight among the candidate output links
-    for (int link = 0; link < m_routing_table[vnet].size(); link++) {
-        if (msg_destination.intersectionIsNotEmpty(
-            m_routing_table[vnet][link])) {
+    // Randomly select any candidate output link
+    int candidate = 0;
+    if (!(m_router->get_net_ptr())->isVNetOrdered(vnet))
+        candidate = rand() % num_candidates;
+
+    return m_candidates[first + candidate];
+}
 
-        if (m_weight_table[link] <= min_weight)
+int
+RoutingUnit::lookupRoutingTable(int vnet, NetDest msg_destination)
+{
+    std::vector<NodeID> dests = msg_destination.getAllDest();
+    if (dests.size() == 1)
+        return lookupRoutingTable(vnet, dests[0]);
+
+    // The candidates of a multicast destination are the links leading to
+    // any of its nodes
+    std::vector<uint64_t> links(m_link_words, 0);
+    for (NodeID dest : dests) {
+        assert(dest < m_num_nodes);
+        const uint64_t *dest_links =
+            &m_dest_links[((size_t)vnet * m_num_nodes + dest) * m_link_words];
+        for (int w = 0; w < m_link_words; w++)
+            links[w] |= dest_links[w];
+    }
+
+    // Identify the minimum weight among the candidate output links
+    int min_weight = INFINITE_;
+    for (int link = 0; link < m_weight_table.size(); link++) {
+        if ((links[link / 64] >> (link % 64) & 1) &&
+            m_weight_table[link] <= min_weight) {
             min_weight = m_weight_table[link];
         }
     }
 
     // Collect all candidate output links with this minimum weight
-    for (int link = 0; link < m_routing_table[vnet].size(); link++) {
-        if (msg_destination.intersectionIsNotEmpty(
-            m_routing_table[vnet][link])) {
-
-            if (m_weight_table[link] == min_weight) {
-                num_candidates++;
-                output_link_candidates.push_back(link);
-            }
+    std::vector<int> output_link_candidates;
+    for (int link = 0; link < m_weight_table.size(); link++) {
+        if ((links[link / 64] >> (link % 64) & 1) &&
+            m_weight_table[link] == min_weight) {
+            output_link_candidates.push_back(link);
         }
     }
 
@@ -138,10 +245,9 @@ RoutingUnit::lookupRoutingTable(int vnet, NetDest msg_destination)
     // Randomly select any candidate output link
     int candidate = 0;
     if (!(m_router->get_net_ptr())->isVNetOrdered(vnet))
-        candidate = rand() % num_candidates;
+        candidate = rand() % output_link_candidates.size();
 
-    output_link = output_link_candidates.at(candidate);
-    return output_link;
+    return output_link_candidates.at(candidate);
 }
 
 
@@ -176,7 +282,7 @@ RoutingUnit::outportCompute(RouteInfo route, int inport,
         // Multiple NIs may be connected to this router,
         // all with output port direction = "Local"
         // Get exact outport id from table
-        outport = lookupRoutingTable(route.vnet, route.net_dest);
+        outport = lookupRoutingTable(route.vnet, route.dest_ni);
         return outport;
     }
 
@@ -185,79 +291,58 @@ RoutingUnit::outportCompute(RouteInfo route, int inport,
     RoutingAlgorithm routing_algorithm =
         (RoutingAlgorithm) m_router->get_net_ptr()->getRoutingAlgorithm();
 
+    // The network interfaces split multicast messages into one packet per
+    // destination, so the table can be indexed by dest_ni directly.
     switch (routing_algorithm) {
         case TABLE_:  outport =
-            lookupRoutingTable(route.vnet, route.net_dest); break;
+            lookupRoutingTable(route.vnet, route.dest_ni); break;
         case XY_:     outport =
             outportComputeXY(route, inport, inport_dirn); break;
         // any custom algorithm
         case CUSTOM_: outport =
             outportComputeCustom(route, inport, inport_dirn); break;
         default: outport =
-            lookupRoutingTable(route.vnet, route.net_dest); break;
+            lookupRoutingTable(route.vnet, route.dest_ni); break;
     }
 
     assert(outport != -1);
     return outport;
 }
 
+// Whether XY routing may go out of outport_dirn after coming in from
+// inport_dirn
+[[maybe_unused]] static bool
+xyTurnAllowed(const PortDirection &inport_dirn,
+              const PortDirection &outport_dirn)
+{
+    if (outport_dirn == "East")
+        return inport_dirn == "Local" || inport_dirn == "West";
+    if (outport_dirn == "West")
+        return inport_dirn == "Local" || inport_dirn == "East";
+    // "Local" or "South" or "West" or "East"
+    if (outport_dirn == "North")
+        return inport_dirn != "North";
+    // "Local" or "North" or "West" or "East"
+    return inport_dirn != "South";
+}
+
 // XY routing implemented using port directions
 // Only for reference purpose in a Mesh
 // By default Garnet uses the routing table
+// The outport to each destination router is computed by buildTables().
 int
 RoutingUnit::outportComputeXY(RouteInfo route,
                               int inport,
                               PortDirection inport_dirn)
 {
-    PortDirection outport_dirn = "Unknown";
-
-    [[maybe_unused]] int num_rows = m_router->get_net_ptr()->getNumRows();
-    int num_cols = m_router->get_net_ptr()->getNumCols();
-    assert(num_rows > 0 && num_cols > 0);
-
-    int my_id = m_router->get_id();
-    int my_x = my_id % num_cols;
-    int my_y = my_id / num_cols;
-
-    int dest_id = route.dest_router;
-    int dest_x = dest_id % num_cols;
-    int dest_y = dest_id / num_cols;
-
-    int x_hops = abs(dest_x - my_x);
-    int y_hops = abs(dest_y - my_y);
-
-    bool x_dirn = (dest_x >= my_x);
-    bool y_dirn = (dest_y >= my_y);
+    assert(route.dest_router < m_xy_outports.size());
+    int outport = m_xy_outports[route.dest_router];
 
     // already checked that in outportCompute() function
-    assert(!(x_hops == 0 && y_hops == 0));
-
-    if (x_hops > 0) {
-        if (x_dirn) {
-            assert(inport_dirn == "Local" || inport_dirn == "West");
-            outport_dirn = "East";
-        } else {
-            assert(inport_dirn == "Local" || inport_dirn == "East");
-            outport_dirn = "West";
-        }
-    } else if (y_hops > 0) {
-        if (y_dirn) {
-            // "Local" or "South" or "West" or "East"
-            assert(inport_dirn != "North");
-            outport_dirn = "North";
-        } else {
-            // "Local" or "North" or "West" or "East"
-            assert(inport_dirn != "South");
-            outport_dirn = "South";
-        }
-    } else {
-        // x_hops == 0 and y_hops == 0
-        // this is not possible
-        // already checked that in outportCompute() function
-        panic("x_hops == y_hops == 0");
-    }
+    panic_if(outport == -1, "x_hops == y_hops == 0");
 
-    return m_outports_dirn2idx[outport_dirn];
+    assert(xyTurnAllowed(inport_dirn, m_xy_outport_dirns[route.dest_router]));
+    return outport;
 }
 
 // Template for implementing custom routing algorithm
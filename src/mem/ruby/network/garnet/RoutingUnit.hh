@@ -31,6 +31,10 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET_0_ROUTINGUNIT_HH__
 #define __MEM_RUBY_NETWORK_GARNET_0_ROUTINGUNIT_HH__
 
+#include <cstdint>
+#include <map>
+#include <vector>
+
 #include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
@@ -61,8 +65,13 @@ class RoutingUnit
     void addRoute(std::vector<NetDest>& routing_table_entry);
     void addWeight(int link_weight);
 
+    // Flatten the routing table and the mesh coordinates into the
+    // lookup tables below, once all the output ports have been added
+    void buildTables();
+
     // get output port from routing table
     int  lookupRoutingTable(int vnet, NetDest net_dest);
+    int  lookupRoutingTable(int vnet, NodeID dest);
 
     // Topology-specific direction based routing
     void addInDirection(PortDirection inport_dirn, int inport);
@@ -90,6 +99,24 @@ class RoutingUnit
     std::vector<std::vector<NetDest>> m_routing_table;
     std::vector<int> m_weight_table;
 
+    // Per (vnet, destination) lookup tables derived from the routing
+    // table by buildTables(), at index vnet * m_num_nodes + dest. The
+    // minimum weight candidate links of an entry are
+    // m_candidates[m_candidate_offsets[entry]...
+    // m_candidate_offsets[entry + 1] - 1], and m_dest_links[entry *
+    // m_link_words...] is the bit mask of all the links leading to the
+    // destination, used for multicast destinations.
+    int m_num_nodes = 0;
+    int m_link_words = 0;
+    std::vector<uint32_t> m_candidate_offsets;
+    std::vector<int> m_candidates;
+    std::vector<uint64_t> m_dest_links;
+
+    // XY routing outport (and its direction) to each destination
+    // router, -1 for this router
+    std::vector<int> m_xy_outports;
+    std::vector<PortDirection> m_xy_outport_dirns;
+
     // Inport and Outport direction to idx maps
     std::map<PortDirection, int> m_inports_dirn2idx;
     std::map<int, PortDirection> m_inports_idx2dirn;
@@ -34,6 +34,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "base/pool_alloc.hh"
 #include "base/types.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
@@ -47,7 +48,9 @@ namespace ruby
 namespace garnet
 {
 
-class flit
+// Flits and credits are created and deleted for every packet, so they
+// come from the pool allocator.
+class flit : public PoolAllocated
 {
   public:
     flit() {}
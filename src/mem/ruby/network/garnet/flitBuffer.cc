@@ -53,30 +53,19 @@ flitBuffer::flitBuffer(int maximum_size)
 bool
 flitBuffer::isEmpty()
 {
-    return (m_buffer.size() == 0);
-}
-
-bool
-flitBuffer::isReady(Tick curTime)
-{
-    if (m_buffer.size() != 0 ) {
-        flit *t_flit = peekTopFlit();
-        if (t_flit->get_time() <= curTime)
-            return true;
-    }
-    return false;
+    return (m_count == 0);
 }
 
 void
 flitBuffer::print(std::ostream& out) const
 {
-    out << "[flitBuffer: " << m_buffer.size() << "] " << std::endl;
+    out << "[flitBuffer: " << m_count << "] " << std::endl;
 }
 
 bool
 flitBuffer::isFull()
 {
-    return (m_buffer.size() >= max_size);
+    return (m_count >= max_size);
 }
 
 void
@@ -85,12 +74,23 @@ flitBuffer::setMaxSize(int maximum)
     max_size = maximum;
 }
 
+void
+flitBuffer::grow()
+{
+    std::vector<flit *> buffer(std::max<size_t>(4, 2 * m_buffer.size()));
+    for (size_t i = 0; i < m_count; ++i)
+        buffer[i] = m_buffer[(m_head + i) & (m_buffer.size() - 1)];
+    m_buffer.swap(buffer);
+    m_head = 0;
+}
+
 bool
 flitBuffer::functionalRead(Packet *pkt, WriteMask &mask)
 {
     bool read = false;
-    for (unsigned int i = 0; i < m_buffer.size(); ++i) {
-        if (m_buffer[i]->functionalRead(pkt, mask)) {
+    for (size_t i = 0; i < m_count; ++i) {
+        flit *f = m_buffer[(m_head + i) & (m_buffer.size() - 1)];
+        if (f->functionalRead(pkt, mask)) {
             read = true;
         }
     }
@@ -103,8 +103,9 @@ flitBuffer::functionalWrite(Packet *pkt)
 {
     uint32_t num_functional_writes = 0;
 
-    for (unsigned int i = 0; i < m_buffer.size(); ++i) {
-        if (m_buffer[i]->functionalWrite(pkt)) {
+    for (size_t i = 0; i < m_count; ++i) {
+        flit *f = m_buffer[(m_head + i) & (m_buffer.size() - 1)];
+        if (f->functionalWrite(pkt)) {
             num_functional_writes++;
         }
     }
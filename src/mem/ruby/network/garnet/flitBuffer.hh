@@ -32,6 +32,8 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_FLITBUFFER_HH__
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <iostream>
 #include <vector>
 
@@ -53,38 +55,56 @@ class flitBuffer
     flitBuffer();
     flitBuffer(int maximum_size);
 
-    bool isReady(Tick curTime);
+    bool
+    isReady(Tick curTime)
+    {
+        return m_count != 0 && m_buffer[m_head]->get_time() <= curTime;
+    }
+
     bool isEmpty();
     void print(std::ostream& out) const;
     bool isFull();
     void setMaxSize(int maximum);
-    int getSize() const { return m_buffer.size(); }
+    int getSize() const { return m_count; }
 
     flit *
     getTopFlit()
     {
-        flit *f = m_buffer.front();
-        m_buffer.pop_front();
+        assert(m_count != 0);
+        flit *f = m_buffer[m_head];
+        m_head = (m_head + 1) & (m_buffer.size() - 1);
+        m_count--;
         return f;
     }
 
     flit *
     peekTopFlit()
     {
-        return m_buffer.front();
+        assert(m_count != 0);
+        return m_buffer[m_head];
     }
 
     void
     insert(flit *flt)
     {
-        m_buffer.push_back(flt);
+        if (m_count == m_buffer.size())
+            grow();
+        m_buffer[(m_head + m_count) & (m_buffer.size() - 1)] = flt;
+        m_count++;
     }
 
     bool functionalRead(Packet *pkt, WriteMask &mask);
     uint32_t functionalWrite(Packet *pkt);
 
   private:
-    std::deque<flit *> m_buffer;
+    void grow();
+
+    // The flits are kept in insertion order in a ring buffer, whose size
+    // is a power of two. It only grows when it is full, so that a buffer
+    // in use does not allocate.
+    std::vector<flit *> m_buffer;
+    size_t m_head = 0;
+    size_t m_count = 0;
     int max_size;
 };
 
@@ -49,7 +49,7 @@ class AccessTraceForAddress
   public:
     AccessTraceForAddress()
         : m_loads(0), m_stores(0), m_atomics(0), m_total(0), m_user(0),
-          m_sharing(0), m_histogram_ptr(NULL)
+          m_sharing(0), m_error(0), m_histogram_ptr(NULL)
     { }
     ~AccessTraceForAddress();
 
@@ -62,6 +62,14 @@ class AccessTraceForAddress
     Addr getAddress() const { return m_addr; }
     void addSample(int value);
 
+    /**
+     * Upper bound of the samples missed before this trace was created, when
+     * it replaced another one in a bounded AddressProfiler::AddressMap.
+     */
+    void setError(uint64_t error) { m_error = error; }
+    uint64_t getError() const { return m_error; }
+    uint64_t getEstimate() const { return getTotal() + m_error; }
+
     void print(std::ostream& out) const;
 
     static inline bool
@@ -79,6 +87,7 @@ class AccessTraceForAddress
     uint64_t m_total;
     uint64_t m_user;
     uint64_t m_sharing;
+    uint64_t m_error;
     Set m_touched_by;
     Histogram* m_histogram_ptr;
 };
@@ -28,6 +28,8 @@
 
 #include "mem/ruby/profiler/AddressProfiler.hh"
 
+#include <algorithm>
+#include <cassert>
 #include <vector>
 
 #include "base/bitfield.hh"
@@ -46,29 +48,62 @@ typedef AddressProfiler::AddressMap AddressMap;
 
 using gem5::stl_helpers::operator<<;
 
-// Helper functions
 AccessTraceForAddress&
-lookupTraceForAddress(Addr addr, AddressMap& record_map)
+AddressMap::lookup(Addr addr)
 {
-    // we create a static default object here that is used to insert
-    // since the insertion will create a copy of the object in the
-    // process.  Perhaps this is optimizing early, but it doesn't seem
-    // like it could hurt.
-    static const AccessTraceForAddress dflt;
-
-    std::pair<AddressMap::iterator, bool> r =
-        record_map.insert(std::make_pair(addr, dflt));
-    AddressMap::iterator i = r.first;
-    AccessTraceForAddress &access_trace = i->second;
-    if (r.second) {
-        // there was nothing there and the insert succeed, so we need
-        // to actually set the address.
-        access_trace.setAddress(addr);
-    }
+    auto i = m_map.find(addr);
+    if (i != m_map.end())
+        return i->second;
+
+    uint64_t error = 0;
+    if (bounded() && m_map.size() >= m_capacity)
+        error = evict();
+
+    AccessTraceForAddress &access_trace = m_map[addr];
+    access_trace.setAddress(addr);
+    access_trace.setError(error);
+    m_counts.emplace(error, addr);
 
     return access_trace;
 }
 
+uint64_t
+AddressMap::evict()
+{
+    while (true) {
+        Count top = m_counts.top();
+        m_counts.pop();
+
+        auto i = m_map.find(top.second);
+        assert(i != m_map.end());
+        uint64_t estimate = i->second.getEstimate();
+        if (estimate != top.first) {
+            // Samples were added since it was pushed
+            m_counts.emplace(estimate, top.second);
+            continue;
+        }
+
+        m_map.erase(i);
+        m_evicted++;
+        return estimate;
+    }
+}
+
+void
+AddressMap::clear()
+{
+    m_map.clear();
+    m_counts = decltype(m_counts)();
+    m_evicted = 0;
+}
+
+// Helper functions
+AccessTraceForAddress&
+lookupTraceForAddress(Addr addr, AddressMap& record_map)
+{
+    return record_map.lookup(addr);
+}
+
 void
 printSorted(std::ostream& out, int num_of_sequencers,
         const AddressMap &record_map, std::string description,
@@ -86,10 +121,18 @@ printSorted(std::ostream& out, int num_of_sequencers,
         misses += record->getTotal();
         sorted.push_back(record);
     }
-    sort(sorted.begin(), sorted.end(), AccessTraceForAddress::less_equal);
+    // Most accessed first, by the estimate which ranks the addresses
+    // when the map is bounded.
+    std::stable_sort(sorted.begin(), sorted.end(),
+        [](const AccessTraceForAddress *a, const AccessTraceForAddress *b)
+        { return a->getEstimate() > b->getEstimate(); });
 
     out << "Total_entries_" << description << ": " << record_map.size()
         << std::endl;
+    if (record_map.bounded()) {
+        out << "Evicted_entries_" << description << ": "
+            << record_map.evicted() << std::endl;
+    }
     if (profiler->getAllInstructions()) {
         out << "Total_Instructions_" << description << ": " << misses
             << std::endl;
@@ -136,6 +179,7 @@ printSorted(std::ostream& out, int num_of_sequencers,
         remaining_records.add(record->getTotal());
         all_records_log.add(record->getTotal());
         remaining_records_log.add(record->getTotal());
+        counter++;
         m_touched_vec[record->getTouchedBy()]++;
         m_touched_weighted_vec[record->getTouchedBy()] += record->getTotal();
     }
@@ -178,6 +222,15 @@ AddressProfiler::setAllInstructions(bool all_instructions)
     m_all_instructions = all_instructions;
 }
 
+void
+AddressProfiler::setMaxEntries(size_t max_entries)
+{
+    m_dataAccessTrace.setCapacity(max_entries);
+    m_macroBlockAccessTrace.setCapacity(max_entries);
+    m_programCounterAccessTrace.setCapacity(max_entries);
+    m_retryProfileMap.setCapacity(max_entries);
+}
+
 void
 AddressProfiler::printStats(std::ostream& out) const
 {
@@ -29,8 +29,12 @@
 #ifndef __MEM_RUBY_PROFILER_ADDRESSPROFILER_HH__
 #define __MEM_RUBY_PROFILER_ADDRESSPROFILER_HH__
 
+#include <functional>
 #include <iostream>
+#include <queue>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/Histogram.hh"
@@ -50,7 +54,52 @@ class Set;
 class AddressProfiler
 {
   public:
-    typedef std::unordered_map<Addr, AccessTraceForAddress> AddressMap;
+    /**
+     * Access traces indexed by address. A capacity bounds the memory used
+     * by only keeping the most accessed addresses, following the
+     * Space-Saving algorithm: when full, a new address replaces the one
+     * with the smallest count, and inherits that count as the number of
+     * samples it could have missed. Any address which got more than
+     * total / capacity samples is guaranteed to be kept.
+     */
+    class AddressMap
+    {
+      public:
+        typedef std::unordered_map<Addr, AccessTraceForAddress> Map;
+        typedef Map::const_iterator const_iterator;
+
+        AddressMap() : m_capacity(0), m_evicted(0) {}
+
+        /** Set the maximum number of addresses kept, 0 for no limit */
+        void setCapacity(size_t capacity) { m_capacity = capacity; }
+        bool bounded() const { return m_capacity != 0; }
+
+        /** Get the trace of an address, creating it if needed */
+        AccessTraceForAddress &lookup(Addr addr);
+        void clear();
+
+        const_iterator begin() const { return m_map.begin(); }
+        const_iterator end() const { return m_map.end(); }
+        size_t size() const { return m_map.size(); }
+        uint64_t evicted() const { return m_evicted; }
+
+      private:
+        /** Remove the trace with the smallest estimate and return it */
+        uint64_t evict();
+
+        size_t m_capacity;
+        uint64_t m_evicted;
+        Map m_map;
+
+        typedef std::pair<uint64_t, Addr> Count;
+        /**
+         * One (estimate, address) pair per trace, ordered by estimate. The
+         * estimates are only refreshed when reaching the top, which is
+         * fine as they can only grow.
+         */
+        std::priority_queue<Count, std::vector<Count>,
+                            std::greater<Count>> m_counts;
+    };
 
   public:
     AddressProfiler(int num_of_sequencers, Profiler *profiler);
@@ -73,6 +122,7 @@ class AddressProfiler
     //added by SS
     void setHotLines(bool hot_lines);
     void setAllInstructions(bool all_instructions);
+    void setMaxEntries(size_t max_entries);
     void regStats(const std::string &name) {}
     void collateStats() {}
 
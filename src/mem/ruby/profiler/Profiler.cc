@@ -95,11 +95,13 @@ Profiler::Profiler(const RubySystemParams &p, RubySystem *rs)
     m_address_profiler_ptr = new AddressProfiler(p.num_of_sequencers, this);
     m_address_profiler_ptr->setHotLines(m_hot_lines);
     m_address_profiler_ptr->setAllInstructions(m_all_instructions);
+    m_address_profiler_ptr->setMaxEntries(p.hot_lines_entries);
 
     if (m_all_instructions) {
         m_inst_profiler_ptr = new AddressProfiler(p.num_of_sequencers, this);
         m_inst_profiler_ptr->setHotLines(m_hot_lines);
         m_inst_profiler_ptr->setAllInstructions(m_all_instructions);
+        m_inst_profiler_ptr->setMaxEntries(p.hot_lines_entries);
     }
 }
 
@@ -237,7 +237,7 @@ void
 CacheController::sendCompAck(ARM::CHI::Payload &payload,
                              ARM::CHI::Phase &phase)
 {
-    auto res_msg = std::make_shared<CHIResponseMsg>(
+    auto res_msg = ruby::makeMessage<CHIResponseMsg>(
         curTick(), cacheLineSize, m_ruby_system);
 
     res_msg->m_addr = ruby::makeLineAddress(payload.address, cacheLineBits);
@@ -298,7 +298,7 @@ void
 CacheController::sendRequestMsg(ARM::CHI::Payload &payload,
                                 ARM::CHI::Phase &phase)
 {
-    auto req_msg = std::make_shared<CHIRequestMsg>(
+    auto req_msg = ruby::makeMessage<CHIRequestMsg>(
         curTick(), cacheLineSize, m_ruby_system);
 
     req_msg->m_addr = ruby::makeLineAddress(payload.address, cacheLineBits);
@@ -327,7 +327,7 @@ void
 CacheController::sendDataMsg(ARM::CHI::Payload &payload,
                              ARM::CHI::Phase &phase)
 {
-    auto data_msg = std::make_shared<CHIDataMsg>(
+    auto data_msg = ruby::makeMessage<CHIDataMsg>(
         curTick(), cacheLineSize, m_ruby_system);
 
     data_msg->m_addr = ruby::makeLineAddress(payload.address, cacheLineBits);
@@ -356,7 +356,7 @@ void
 CacheController::sendResponseMsg(ARM::CHI::Payload &payload,
                                  ARM::CHI::Phase &phase)
 {
-    auto res_msg = std::make_shared<CHIResponseMsg>(
+    auto res_msg = ruby::makeMessage<CHIResponseMsg>(
         curTick(), cacheLineSize, m_ruby_system);
 
     res_msg->m_addr = ruby::makeLineAddress(payload.address, cacheLineBits);
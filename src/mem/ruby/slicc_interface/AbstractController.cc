@@ -92,6 +92,9 @@ AbstractController::init()
     downstreamDestinations.setRubySystem(m_ruby_system);
     upstreamDestinations.setRubySystem(m_ruby_system);
 
+    m_functionally_indexed =
+        m_ruby_system->getFunctionalIndexEnabled() && functionalIndexable();
+
     // Initialize the addr->downstream machine mappings. Multiple machines
     // in downstream_destinations can have the same address range if they have
     // different types. If this is the case, mapAddressToDownstreamMachine
@@ -120,6 +123,14 @@ AbstractController::init()
     }
 }
 
+void
+AbstractController::indexFunctionalLine(Addr addr, AccessPermission perm)
+{
+    m_ruby_system->updateFunctionalIndex(this, makeLineAddress(addr),
+        perm != AccessPermission_Invalid &&
+        perm != AccessPermission_NotPresent);
+}
+
 void
 AbstractController::resetStats()
 {
@@ -148,15 +159,14 @@ AbstractController::profileMsgDelay(uint32_t virtualNetwork, Cycles delay)
 void
 AbstractController::stallBuffer(MessageBuffer* buf, Addr addr)
 {
-    if (m_waiting_buffers.count(addr) == 0) {
-        MsgVecType* msgVec = new MsgVecType;
-        msgVec->resize(m_in_ports, NULL);
-        m_waiting_buffers[addr] = msgVec;
+    auto [iter, inserted] = m_waiting_buffers.try_emplace(addr);
+    if (inserted) {
+        iter->second.resize(m_in_ports, NULL);
     }
     DPRINTF(RubyQueue, "stalling %s port %d addr %#x\n", buf, m_cur_in_port,
             addr);
     assert(m_in_ports > m_cur_in_port);
-    (*(m_waiting_buffers[addr]))[m_cur_in_port] = buf;
+    iter->second[m_cur_in_port] = buf;
 }
 
 void
@@ -165,17 +175,16 @@ AbstractController::wakeUpBuffer(MessageBuffer* buf, Addr addr)
     auto iter = m_waiting_buffers.find(addr);
     if (iter != m_waiting_buffers.end()) {
         bool has_other_msgs = false;
-        MsgVecType* msgVec = iter->second;
-        for (unsigned int port = 0; port < msgVec->size(); ++port) {
-            if ((*msgVec)[port] == buf) {
+        MsgVecType &msgVec = iter->second;
+        for (unsigned int port = 0; port < msgVec.size(); ++port) {
+            if (msgVec[port] == buf) {
                 buf->reanalyzeMessages(addr, clockEdge());
-                (*msgVec)[port] = NULL;
-            } else if ((*msgVec)[port] != NULL) {
+                msgVec[port] = NULL;
+            } else if (msgVec[port] != NULL) {
                 has_other_msgs = true;
             }
         }
         if (!has_other_msgs) {
-            delete msgVec;
             m_waiting_buffers.erase(iter);
         }
     }
@@ -184,41 +193,41 @@ AbstractController::wakeUpBuffer(MessageBuffer* buf, Addr addr)
 void
 AbstractController::wakeUpBuffers(Addr addr)
 {
-    if (m_waiting_buffers.count(addr) > 0) {
+    auto iter = m_waiting_buffers.find(addr);
+    if (iter != m_waiting_buffers.end()) {
         //
         // Wake up all possible lower rank (i.e. lower priority) buffers that could
         // be waiting on this message.
         //
+        MsgVecType &msgVec = iter->second;
         for (int in_port_rank = m_cur_in_port - 1;
              in_port_rank >= 0;
              in_port_rank--) {
-            if ((*(m_waiting_buffers[addr]))[in_port_rank] != NULL) {
-                (*(m_waiting_buffers[addr]))[in_port_rank]->
-                    reanalyzeMessages(addr, clockEdge());
+            if (msgVec[in_port_rank] != NULL) {
+                msgVec[in_port_rank]->reanalyzeMessages(addr, clockEdge());
             }
         }
-        delete m_waiting_buffers[addr];
-        m_waiting_buffers.erase(addr);
+        m_waiting_buffers.erase(iter);
     }
 }
 
 void
 AbstractController::wakeUpAllBuffers(Addr addr)
 {
-    if (m_waiting_buffers.count(addr) > 0) {
+    auto iter = m_waiting_buffers.find(addr);
+    if (iter != m_waiting_buffers.end()) {
         //
         // Wake up all possible buffers that could be waiting on this message.
         //
+        MsgVecType &msgVec = iter->second;
         for (int in_port_rank = m_in_ports - 1;
              in_port_rank >= 0;
              in_port_rank--) {
-            if ((*(m_waiting_buffers[addr]))[in_port_rank] != NULL) {
-                (*(m_waiting_buffers[addr]))[in_port_rank]->
-                    reanalyzeMessages(addr, clockEdge());
+            if (msgVec[in_port_rank] != NULL) {
+                msgVec[in_port_rank]->reanalyzeMessages(addr, clockEdge());
             }
         }
-        delete m_waiting_buffers[addr];
-        m_waiting_buffers.erase(addr);
+        m_waiting_buffers.erase(iter);
     }
 }
 
@@ -228,37 +237,20 @@ AbstractController::wakeUpAllBuffers()
     //
     // Wake up all possible buffers that could be waiting on any message.
     //
-
-    std::vector<MsgVecType*> wokeUpMsgVecs;
     MsgBufType wokeUpMsgBufs;
 
-    if (m_waiting_buffers.size() > 0) {
-        for (WaitingBufType::iterator buf_iter = m_waiting_buffers.begin();
-             buf_iter != m_waiting_buffers.end();
-             ++buf_iter) {
-             for (MsgVecType::iterator vec_iter = buf_iter->second->begin();
-                  vec_iter != buf_iter->second->end();
-                  ++vec_iter) {
-                  //
-                  // Make sure the MessageBuffer has not already be reanalyzed
-                  //
-                  if (*vec_iter != NULL &&
-                      (wokeUpMsgBufs.count(*vec_iter) == 0)) {
-                      (*vec_iter)->reanalyzeAllMessages(clockEdge());
-                      wokeUpMsgBufs.insert(*vec_iter);
-                  }
-             }
-             wokeUpMsgVecs.push_back(buf_iter->second);
-        }
-
-        for (std::vector<MsgVecType*>::iterator wb_iter = wokeUpMsgVecs.begin();
-             wb_iter != wokeUpMsgVecs.end();
-             ++wb_iter) {
-             delete (*wb_iter);
+    for (auto &entry : m_waiting_buffers) {
+        for (auto *buf : entry.second) {
+            //
+            // Make sure the MessageBuffer has not already be reanalyzed
+            //
+            if (buf != NULL && wokeUpMsgBufs.insert(buf).second) {
+                buf->reanalyzeAllMessages(clockEdge());
+            }
         }
-
-        m_waiting_buffers.clear();
     }
+
+    m_waiting_buffers.clear();
 }
 
 bool
@@ -387,8 +379,7 @@ AbstractController::recvTimingResp(PacketPtr pkt)
 
     int blk_size = m_ruby_system->getBlockSizeBytes();
 
-    std::shared_ptr<MemoryMsg> msg =
-        std::make_shared<MemoryMsg>(clockEdge(), blk_size, m_ruby_system);
+    auto msg = makeMessage<MemoryMsg>(clockEdge(), blk_size, m_ruby_system);
     (*msg).m_addr = pkt->getAddr();
     (*msg).m_Sender = m_machineID;
 
@@ -422,6 +413,20 @@ AbstractController::recvAtomic(PacketPtr pkt)
    return ticksToCycles(memoryPort.sendAtomic(pkt));
 }
 
+Tick
+AbstractController::recvAtomicBackdoor(PacketPtr pkt,
+                                       MemBackdoorPtr &backdoor)
+{
+    return ticksToCycles(memoryPort.sendAtomicBackdoor(pkt, backdoor));
+}
+
+void
+AbstractController::recvMemBackdoorReq(const MemBackdoorReq &req,
+                                       MemBackdoorPtr &backdoor)
+{
+    memoryPort.sendMemBackdoorReq(req, backdoor);
+}
+
 MachineID
 AbstractController::mapAddressToMachine(Addr addr, MachineType mtype) const
 {
@@ -157,6 +157,24 @@ class AbstractController : public ClockedObject, public Consumer
     virtual int functionalWrite(const Addr &addr, PacketPtr) = 0;
     int functionalMemoryWrite(PacketPtr);
 
+    /**
+     * Whether the controller can only hold a copy of a line after a
+     * transition on it, which is the case when its default state has no
+     * permission. The RubySystem then indexes the lines it holds, and
+     * skips the controller in the functional accesses to other lines.
+     */
+    virtual bool functionalIndexable() const { return false; }
+    bool functionallyIndexed() const { return m_functionally_indexed; }
+
+    //! Called after every transition with the permission of the next
+    //! state, to keep the functional index of the RubySystem up to date.
+    void
+    updateFunctionalIndex(Addr addr, AccessPermission perm)
+    {
+        if (m_functionally_indexed)
+            indexFunctionalLine(addr, perm);
+    }
+
     //! Function for enqueuing a prefetch request
     virtual void enqueuePrefetch(const Addr &, const RubyRequestType&)
     { fatal("Prefetches not implemented!");}
@@ -185,6 +203,9 @@ class AbstractController : public ClockedObject, public Consumer
 
     bool recvTimingResp(PacketPtr pkt);
     Tick recvAtomic(PacketPtr pkt);
+    Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &backdoor);
+    void recvMemBackdoorReq(const MemBackdoorReq &req,
+                            MemBackdoorPtr &backdoor);
 
     const AddrRangeList &getAddrRanges() const { return addrRanges; }
 
@@ -417,7 +438,10 @@ class AbstractController : public ClockedObject, public Consumer
 
     typedef std::vector<MessageBuffer*> MsgVecType;
     typedef std::set<MessageBuffer*> MsgBufType;
-    typedef std::map<Addr, MsgVecType* > WaitingBufType;
+    // The buffers that stalled on each line, indexed by in_port rank.
+    // Waking up lines in any order gives the same result, so they are
+    // hashed rather than sorted.
+    typedef std::unordered_map<Addr, MsgVecType> WaitingBufType;
     WaitingBufType m_waiting_buffers;
 
     unsigned int m_in_ports;
@@ -474,10 +498,14 @@ class AbstractController : public ClockedObject, public Consumer
     int machineCount(MachineType machType);
 
   private:
+    void indexFunctionalLine(Addr addr, AccessPermission perm);
+
+    bool m_functionally_indexed = false;
+
     /** The address range to which the controller responds on the CPU side. */
     const AddrRangeList addrRanges;
 
-    std::unordered_map<MachineType, AddrRangeMap<MachineID, 3>>
+    std::unordered_map<MachineType, AddrRangeMap<MachineID>>
       downstreamAddrMap;
 
     NetDest downstreamDestinations;
@@ -41,14 +41,20 @@
 #ifndef __MEM_RUBY_SLICC_INTERFACE_MESSAGE_HH__
 #define __MEM_RUBY_SLICC_INTERFACE_MESSAGE_HH__
 
+#include <atomic>
+#include <cstdint>
 #include <iostream>
-#include <memory>
 #include <stack>
+#include <utility>
 
+#include "base/compiler.hh"
+#include "base/pool_alloc.hh"
+#include "base/refcnt.hh"
 #include "mem/packet.hh"
 #include "mem/ruby/common/NetDest.hh"
 #include "mem/ruby/common/WriteMask.hh"
 #include "mem/ruby/protocol/MessageSizeType.hh"
+#include "sim/eventq.hh"
 
 namespace gem5
 {
@@ -57,9 +63,19 @@ namespace ruby
 {
 
 class Message;
-typedef std::shared_ptr<Message> MsgPtr;
+typedef RefCountingPtr<Message> MsgPtr;
 
-class Message
+/**
+ * Base class of the messages exchanged by the Ruby controllers.
+ *
+ * Messages are created and destroyed at a high rate, so they come from
+ * the PoolAllocator and count their references themselves. The count
+ * is only updated atomically in parallel mode, when messages may be
+ * handed over to the event queue of another thread; the rest of the
+ * time, Ruby runs on a single thread. Messages must be created through
+ * makeMessage(), or given to a MsgPtr right away.
+ */
+class Message : public PoolAllocated
 {
   public:
     Message(Tick curTime, int block_size, const RubySystem *rs)
@@ -122,10 +138,55 @@ class Message
     int getVnet() const { return vnet; }
     void setVnet(int net) { vnet = net; }
 
+    /// Add a reference to the message.
+    void
+    incref() const
+    {
+        if (GEM5_UNLIKELY(inParallelMode)) {
+            m_refcount.count.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            m_refcount.count.store(
+                m_refcount.count.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+        }
+    }
+
+    /// Drop a reference to the message, and destroy it if it was the
+    /// last one.
+    void
+    decref() const
+    {
+        uint32_t left;
+        if (GEM5_UNLIKELY(inParallelMode)) {
+            left = m_refcount.count.fetch_sub(1,
+                                              std::memory_order_acq_rel) - 1;
+        } else {
+            left = m_refcount.count.load(std::memory_order_relaxed) - 1;
+            m_refcount.count.store(left, std::memory_order_relaxed);
+        }
+        if (left == 0)
+            delete this;
+    }
+
   protected:
     int m_block_size = 0;
 
   private:
+    /**
+     * Copies of a message are new objects, which start without any
+     * reference. This keeps the copy constructors and assignment
+     * operators of the messages the default ones.
+     */
+    struct RefCount
+    {
+        RefCount() = default;
+        RefCount(const RefCount &) {}
+        RefCount &operator=(const RefCount &) { return *this; }
+
+        std::atomic<uint32_t> count = 0;
+    };
+    mutable RefCount m_refcount;
+
     Tick m_time;
     Tick m_LastEnqueueTime; // my last enqueue time
     Tick m_DelayedTicks; // my delayed cycles
@@ -136,6 +197,16 @@ class Message
     int vnet;
 };
 
+/**
+ * Create a message of type T, which references it.
+ */
+template <class T, class... Args>
+RefCountingPtr<T>
+makeMessage(Args &&...args)
+{
+    return RefCountingPtr<T>(new T(std::forward<Args>(args)...));
+}
+
 inline bool
 operator>(const MsgPtr &lhs, const MsgPtr &rhs)
 {
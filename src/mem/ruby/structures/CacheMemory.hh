@@ -43,7 +43,6 @@
 #define __MEM_RUBY_STRUCTURES_CACHEMEMORY_HH__
 
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "base/statistics.hh"
@@ -179,14 +178,22 @@ class CacheMemory : public SimObject
     // Data Members (m_prefix)
     bool m_is_instruction_only_cache;
 
+    // The line address held by every way, indexed by
+    // set * associativity + way, so that a lookup scans one contiguous
+    // row instead of chasing pointers. Empty ways hold MaxAddr.
+    std::vector<Addr> m_tags;
+
     // The first index is the # of cache lines.
     // The second index is the the amount associativity.
-    std::unordered_map<Addr, int> m_tag_index;
     std::vector<std::vector<AbstractCacheEntry*> > m_cache;
 
     /** We use the replacement policies from the Classic memory system. */
     replacement_policy::Base *m_replacementPolicy_ptr;
 
+    // Scratch list of replacement candidates reused by cacheProbe so that
+    // choosing a victim does not allocate
+    mutable std::vector<ReplaceableEntry*> m_candidates;
+
     BankedArray dataArray;
     BankedArray tagArray;
     ALUFreeListArray atomicALUArray;
@@ -57,8 +57,10 @@ MN_TBETable::chooseNewDistributor()
     std::vector<MiscNode_TBE*> potential_sync_dependency_tbes;
     bool has_waiting_sync = false;
     int waiting_count = 0;
-    for (auto& keyValuePair : m_map) {
-        MiscNode_TBE& tbe = keyValuePair.second;
+    for (auto& slot : m_slots) {
+        if (!slot.entry)
+            continue;
+        MiscNode_TBE& tbe = *slot.entry;
 
         switch (tbe.getstate()) {
             case MiscNode_State_DvmSync_Distributing:
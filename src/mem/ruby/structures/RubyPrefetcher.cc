@@ -175,13 +175,21 @@ RubyPrefetcher::issueNextPrefetch(Addr address, PrefetchEntry *stream)
         if (!m_prefetch_cross_pages) {
             // Deallocate the stream since we are not prefetching
             // across page boundries
+            unindexStream(stream - m_array.data());
             stream->m_is_valid = false;
             return;
         }
         rubyPrefetcherStats.numPagesCrossed++;
     }
 
-    // launch next prefetch
+    // launch next prefetch, the oldest outstanding prefetch of the stream
+    // leaving its window
+    uint32_t index = stream - m_array.data();
+    if (m_num_startup_pfs > 0) {
+        unindexAddress(makeNextStrideAddress(stream->m_address,
+            -(stream->m_stride * int(m_num_startup_pfs - 1))), index);
+        m_stream_index[line_addr] = index;
+    }
     rubyPrefetcherStats.numPrefetchRequested++;
     stream->m_address = line_addr;
     stream->m_use_time = m_controller->curCycle();
@@ -214,6 +222,9 @@ RubyPrefetcher::initializeStream(Addr address, int stride,
 {
     rubyPrefetcherStats.numAllocatedStreams++;
 
+    // the stream may be replacing another one
+    unindexStream(index);
+
     // initialize the stream prefetcher
     PrefetchEntry *mystream = &(m_array[index]);
     mystream->m_address = makeLineAddress(address, m_block_size_bits);
@@ -247,24 +258,50 @@ RubyPrefetcher::initializeStream(Addr address, int stride,
 
     // update the address to be the last address prefetched
     mystream->m_address = line_addr;
+    indexStream(index);
 }
 
 PrefetchEntry *
 RubyPrefetcher::getPrefetchEntry(Addr address, uint32_t &index)
 {
-    // search all streams for a match
-    for (int i = 0; i < m_num_streams; i++) {
-        // search all the outstanding prefetches for this stream
-        if (m_array[i].m_is_valid) {
-            for (int j = 0; j < m_num_startup_pfs; j++) {
-                if (makeNextStrideAddress(m_array[i].m_address,
-                    -(m_array[i].m_stride*j)) == address) {
-                    return &(m_array[i]);
-                }
-            }
-        }
+    auto it = m_stream_index.find(address);
+    if (it == m_stream_index.end())
+        return NULL;
+
+    assert(m_array[it->second].m_is_valid);
+    return &(m_array[it->second]);
+}
+
+void
+RubyPrefetcher::indexStream(uint32_t index)
+{
+    const PrefetchEntry &stream = m_array[index];
+    assert(stream.m_is_valid);
+    for (int j = m_num_startup_pfs - 1; j >= 0; j--) {
+        m_stream_index[makeNextStrideAddress(stream.m_address,
+            -(stream.m_stride * j))] = index;
     }
-    return NULL;
+}
+
+void
+RubyPrefetcher::unindexStream(uint32_t index)
+{
+    const PrefetchEntry &stream = m_array[index];
+    if (!stream.m_is_valid)
+        return;
+
+    for (int j = 0; j < m_num_startup_pfs; j++) {
+        unindexAddress(makeNextStrideAddress(stream.m_address,
+            -(stream.m_stride * j)), index);
+    }
+}
+
+void
+RubyPrefetcher::unindexAddress(Addr address, uint32_t index)
+{
+    auto it = m_stream_index.find(address);
+    if (it != m_stream_index.end() && it->second == index)
+        m_stream_index.erase(it);
 }
 
 bool
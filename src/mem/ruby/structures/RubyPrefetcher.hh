@@ -45,6 +45,7 @@
 // Implements Power 4 like prefetching
 
 #include <bitset>
+#include <unordered_map>
 
 #include "base/circular_queue.hh"
 #include "base/statistics.hh"
@@ -177,6 +178,26 @@ class RubyPrefetcher : public SimObject
         PrefetchEntry* getPrefetchEntry(Addr address,
             uint32_t &index);
 
+        /**
+         * Add the addresses of the outstanding prefetches of a stream, the
+         * last m_num_startup_pfs addresses it prefetched, to the stream
+         * index.
+         *
+         * @param index Index of the stream in m_array.
+         */
+        void indexStream(uint32_t index);
+
+        /**
+         * Remove the addresses of the outstanding prefetches of a stream
+         * from the stream index.
+         *
+         * @param index Index of the stream in m_array.
+         */
+        void unindexStream(uint32_t index);
+
+        /** Remove an address from the stream index if it maps to index. */
+        void unindexAddress(Addr address, uint32_t index);
+
         /**
          * Access a unit stride filter to determine if there is a hit, and
          * update it otherwise.
@@ -209,6 +230,14 @@ class RubyPrefetcher : public SimObject
         //! an array of the active prefetch streams
         std::vector<PrefetchEntry> m_array;
 
+        /**
+         * Maps the addresses of the outstanding prefetches of the valid
+         * streams to their index in m_array, so that misses don't have to
+         * search all the streams. When streams overlap, an address belongs
+         * to the stream which prefetched it last.
+         */
+        std::unordered_map<Addr, uint32_t> m_stream_index;
+
         //! number of misses I must see before allocating a stream
         uint32_t m_train_misses;
         //! number of initial prefetches to startup a stream
@@ -124,17 +124,17 @@ RubyPrefetcherProxy::issuePrefetch()
                 RubyRequestType req_type = pkt->needsWritable() ?
                                     RubyRequestType_ST : RubyRequestType_LD;
 
-                std::shared_ptr<RubyRequest> msg =
-                    std::make_shared<RubyRequest>(cacheCntrl->clockEdge(),
-                                                  blk_size,
-                                                  cacheCntrl->m_ruby_system,
-                                                  pkt->getAddr(),
-                                                  blk_size,
-                                                  0, // pc
-                                                  req_type,
-                                                  RubyAccessMode_Supervisor,
-                                                  pkt,
-                                                  PrefetchBit_Yes);
+                RefCountingPtr<RubyRequest> msg =
+                    makeMessage<RubyRequest>(cacheCntrl->clockEdge(),
+                                             blk_size,
+                                             cacheCntrl->m_ruby_system,
+                                             pkt->getAddr(),
+                                             blk_size,
+                                             0, // pc
+                                             req_type,
+                                             RubyAccessMode_Supervisor,
+                                             pkt,
+                                             PrefetchBit_Yes);
 
                 // enqueue request into prefetch queue to the cache
                 pfQueue->enqueue(msg, cacheCntrl->clockEdge(),
@@ -170,7 +170,7 @@ RubyPrefetcherProxy::notifyPfHit(const RequestPtr& req, bool is_read,
     pkt.dataStaticConst<uint8_t>(data_blk.getData(getOffset(req->getPaddr()),
                                   pkt.getSize()));
     DPRINTF(HWPrefetch, "notify hit: %s\n", pkt.print());
-    ppHit->notify(CacheAccessProbeArg(&pkt, *this));
+    ppHit->notifyWith([&]() { return CacheAccessProbeArg(&pkt, *this); });
     scheduleNextPrefetch();
 }
 
@@ -186,7 +186,7 @@ RubyPrefetcherProxy::notifyPfMiss(const RequestPtr& req, bool is_read,
     pkt.dataStaticConst<uint8_t>(data_blk.getData(getOffset(req->getPaddr()),
                                   pkt.getSize()));
     DPRINTF(HWPrefetch, "notify miss: %s\n", pkt.print());
-    ppMiss->notify(CacheAccessProbeArg(&pkt, *this));
+    ppMiss->notifyWith([&]() { return CacheAccessProbeArg(&pkt, *this); });
     scheduleNextPrefetch();
 }
 
@@ -204,7 +204,7 @@ RubyPrefetcherProxy::notifyPfFill(const RequestPtr& req,
     pkt.dataStaticConst<uint8_t>(data_blk.getData(getOffset(req->getPaddr()),
                                   pkt.getSize()));
     DPRINTF(HWPrefetch, "notify fill: %s\n", pkt.print());
-    ppFill->notify(CacheAccessProbeArg(&pkt, *this));
+    ppFill->notifyWith([&]() { return CacheAccessProbeArg(&pkt, *this); });
     scheduleNextPrefetch();
 }
 
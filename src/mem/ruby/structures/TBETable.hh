@@ -41,9 +41,13 @@
 #ifndef __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 #define __MEM_RUBY_STRUCTURES_TBETABLE_HH__
 
+#include <cstdint>
+#include <deque>
 #include <iostream>
-#include <unordered_map>
+#include <optional>
+#include <vector>
 
+#include "base/intmath.hh"
 #include "mem/ruby/common/Address.hh"
 
 namespace gem5
@@ -52,6 +56,17 @@ namespace gem5
 namespace ruby
 {
 
+/**
+ * Table of transaction buffer entries keyed by line address.
+ *
+ * Entries live in a pool of slots that is only ever appended to, so a
+ * pointer returned by lookup() stays valid until that entry is
+ * deallocated, and a freed slot is reused by the next allocation rather
+ * than going back to the heap. Slots are located through an
+ * open-addressing index with linear probing which stores slot numbers
+ * only; the pool grows on demand up to number_of_TBEs so that very large
+ * tables do not pay for entries they never use.
+ */
 template<class ENTRY>
 class TBETable
 {
@@ -59,6 +74,7 @@ class TBETable
     TBETable(int number_of_TBEs)
         : m_number_of_TBEs(number_of_TBEs)
     {
+        rehash(minIndexSize);
     }
 
     bool isPresent(Addr address) const;
@@ -67,10 +83,10 @@ class TBETable
     bool
     areNSlotsAvailable(int n, Tick current_time) const
     {
-        return (m_number_of_TBEs - m_map.size()) >= n;
+        return (m_number_of_TBEs - m_live) >= n;
     }
 
-    void setBlockSize(const int block_size) { m_block_size = block_size; }
+    void setBlockSize(const int block_size);
 
     ENTRY *getNullEntry();
     ENTRY *lookup(Addr address);
@@ -83,12 +99,42 @@ class TBETable
     TBETable(const TBETable& obj);
     TBETable& operator=(const TBETable& obj);
 
+    struct Slot
+    {
+        Addr addr = 0;
+        // Empty while the slot is on the free list
+        std::optional<ENTRY> entry;
+    };
+
     // Data Members (m_prefix)
-    std::unordered_map<Addr, ENTRY> m_map;
+    // Iterated in slot order by derived tables, skipping empty slots
+    std::deque<Slot> m_slots;
 
   private:
+    static constexpr int emptyBucket = -1;
+    static constexpr size_t minIndexSize = 16;
+
+    size_t
+    home(Addr address) const
+    {
+        // Fibonacci hashing spreads consecutive lines over the index
+        uint64_t key = address >> m_block_bits;
+        return (key * 0x9e3779b97f4a7c15ULL) >> m_hash_shift;
+    }
+
+    int find(Addr address) const;
+    void rehash(size_t size);
+
+    std::vector<int> m_index;
+    size_t m_index_mask = 0;
+    int m_hash_shift = 64;
+
+    std::vector<int> m_free_slots;
+    int m_live = 0;
+
     int m_number_of_TBEs = 0;
     int m_block_size = 0;
+    int m_block_bits = 0;
 };
 
 template<class ENTRY>
@@ -100,13 +146,53 @@ operator<<(std::ostream& out, const TBETable<ENTRY>& obj)
     return out;
 }
 
+template<class ENTRY>
+inline void
+TBETable<ENTRY>::rehash(size_t size)
+{
+    m_index.assign(size, emptyBucket);
+    m_index_mask = size - 1;
+    m_hash_shift = 64 - floorLog2(size);
+    for (int i = 0; i < m_slots.size(); ++i) {
+        if (!m_slots[i].entry)
+            continue;
+        size_t b = home(m_slots[i].addr);
+        while (m_index[b] != emptyBucket)
+            b = (b + 1) & m_index_mask;
+        m_index[b] = i;
+    }
+}
+
+template<class ENTRY>
+inline int
+TBETable<ENTRY>::find(Addr address) const
+{
+    for (size_t b = home(address); m_index[b] != emptyBucket;
+         b = (b + 1) & m_index_mask) {
+        if (m_slots[m_index[b]].addr == address)
+            return m_index[b];
+    }
+    return emptyBucket;
+}
+
+template<class ENTRY>
+inline void
+TBETable<ENTRY>::setBlockSize(const int block_size)
+{
+    m_block_size = block_size;
+    m_block_bits = floorLog2(block_size);
+    // Entries hashed under the old block size would not be found again
+    if (m_live > 0)
+        rehash(m_index.size());
+}
+
 template<class ENTRY>
 inline bool
 TBETable<ENTRY>::isPresent(Addr address) const
 {
     assert(address == makeLineAddress(address, floorLog2(m_block_size)));
-    assert(m_map.size() <= m_number_of_TBEs);
-    return !!m_map.count(address);
+    assert(m_live <= m_number_of_TBEs);
+    return find(address) != emptyBucket;
 }
 
 template<class ENTRY>
@@ -114,9 +200,30 @@ inline void
 TBETable<ENTRY>::allocate(Addr address)
 {
     assert(!isPresent(address));
-    assert(m_map.size() < m_number_of_TBEs);
+    assert(m_live < m_number_of_TBEs);
     assert(m_block_size > 0);
-    m_map.emplace(address, ENTRY(m_block_size));
+
+    int slot;
+    if (!m_free_slots.empty()) {
+        slot = m_free_slots.back();
+        m_free_slots.pop_back();
+    } else {
+        slot = m_slots.size();
+        m_slots.emplace_back();
+    }
+    m_slots[slot].addr = address;
+    m_slots[slot].entry.emplace(m_block_size);
+    ++m_live;
+
+    // Keep the index at most half full so probe sequences stay short
+    if (m_live * 2 > m_index.size()) {
+        rehash(m_index.size() * 2);
+    } else {
+        size_t b = home(address);
+        while (m_index[b] != emptyBucket)
+            b = (b + 1) & m_index_mask;
+        m_index[b] = slot;
+    }
 }
 
 template<class ENTRY>
@@ -124,8 +231,33 @@ inline void
 TBETable<ENTRY>::deallocate(Addr address)
 {
     assert(isPresent(address));
-    assert(m_map.size() > 0);
-    m_map.erase(address);
+    assert(m_live > 0);
+
+    size_t hole = home(address);
+    while (m_slots[m_index[hole]].addr != address)
+        hole = (hole + 1) & m_index_mask;
+    int slot = m_index[hole];
+
+    // Backward-shift deletion: pull later members of the probe run into
+    // the hole so lookups never need tombstones
+    size_t b = hole;
+    while (true) {
+        b = (b + 1) & m_index_mask;
+        if (m_index[b] == emptyBucket)
+            break;
+        size_t h = home(m_slots[m_index[b]].addr);
+        bool movable = (hole <= b) ? (h <= hole || h > b)
+                                   : (h <= hole && h > b);
+        if (movable) {
+            m_index[hole] = m_index[b];
+            hole = b;
+        }
+    }
+    m_index[hole] = emptyBucket;
+
+    m_slots[slot].entry.reset();
+    m_free_slots.push_back(slot);
+    --m_live;
 }
 
 template<class ENTRY>
@@ -140,8 +272,10 @@ template<class ENTRY>
 inline ENTRY*
 TBETable<ENTRY>::lookup(Addr address)
 {
-  if (m_map.find(address) != m_map.end()) return &(m_map.find(address)->second);
-  return NULL;
+    int slot = find(address);
+    if (slot == emptyBucket)
+        return nullptr;
+    return &*m_slots[slot].entry;
 }
 
 
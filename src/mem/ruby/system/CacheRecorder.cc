@@ -29,6 +29,7 @@
 
 #include "mem/ruby/system/CacheRecorder.hh"
 
+#include "base/logging.hh"
 #include "debug/RubyCacheTrace.hh"
 #include "mem/packet.hh"
 #include "mem/ruby/system/RubySystem.hh"
@@ -53,14 +54,18 @@ CacheRecorder::CacheRecorder(uint8_t* uncompressed_trace,
                              uint64_t uncompressed_trace_size,
                              std::vector<RubyPort*>& ruby_port_map,
                              uint64_t trace_block_size_bytes,
-                             uint64_t system_block_size_bytes)
+                             uint64_t system_block_size_bytes,
+                             unsigned warmup_window)
     : m_uncompressed_trace(uncompressed_trace),
       m_uncompressed_trace_size(uncompressed_trace_size),
       m_ruby_port_map(ruby_port_map), m_bytes_read(0),
       m_records_read(0), m_records_flushed(0),
-      m_block_size_bytes(trace_block_size_bytes)
+      m_block_size_bytes(trace_block_size_bytes),
+      m_warmup_window(warmup_window), m_fetches_outstanding(0)
 
 {
+    fatal_if(m_warmup_window == 0, "The cache warmup window must be at "
+             "least one request.");
     if (m_uncompressed_trace != NULL) {
         if (m_block_size_bytes < system_block_size_bytes) {
             // Block sizes larger than when the trace was recorded are not
@@ -112,56 +117,76 @@ CacheRecorder::enqueueNextFlushRequest()
 void
 CacheRecorder::enqueueNextFetchRequest()
 {
-    if (m_bytes_read < m_uncompressed_trace_size) {
-        TraceRecord* traceRecord = (TraceRecord*) (m_uncompressed_trace +
-                                                                m_bytes_read);
-
-        DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
-
-        for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
-                rec_bytes_read += m_block_size_bytes) {
-            RequestPtr req;
-            MemCmd::Command requestType;
-
-            if (traceRecord->m_type == RubyRequestType_LD) {
-                requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
-                    traceRecord->m_data_address + rec_bytes_read,
-                    m_block_size_bytes, 0,
-                                    Request::funcRequestorId);
-            }   else if (traceRecord->m_type == RubyRequestType_IFETCH) {
-                requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
-                        traceRecord->m_data_address + rec_bytes_read,
-                        m_block_size_bytes,
-                        Request::INST_FETCH, Request::funcRequestorId);
-            }   else {
-                requestType = MemCmd::WriteReq;
-                req = std::make_shared<Request>(
-                    traceRecord->m_data_address + rec_bytes_read,
-                    m_block_size_bytes, 0,
-                                Request::funcRequestorId);
-            }
-
-            Packet *pkt = new Packet(req, requestType);
-            pkt->dataStatic(traceRecord->m_data + rec_bytes_read);
-            pkt->req->setReqInstSeqNum(m_records_read);
-
+    // Every call but the one starting the warmup reports a completed fetch
+    if (m_fetches_outstanding > 0) {
+        m_fetches_outstanding--;
+    }
 
-            RubyPort* m_ruby_port_ptr =
-                m_ruby_port_map[traceRecord->m_cntrl_id];
-            assert(m_ruby_port_ptr != NULL);
-            m_ruby_port_ptr->makeRequest(pkt);
+    while (m_fetches_outstanding < m_warmup_window &&
+           m_bytes_read < m_uncompressed_trace_size) {
+        if (!issueNextFetchRequest()) {
+            // Only a completion can make room in the sequencer again
+            panic_if(m_fetches_outstanding == 0,
+                     "Cache warmup request rejected with nothing "
+                     "outstanding.");
+            return;
         }
+        m_fetches_outstanding++;
+    }
 
-        m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
-        m_records_read++;
-    } else {
+    if (m_fetches_outstanding == 0) {
         exitSimLoop("Finished Warmup", 0);
         DPRINTF(RubyCacheTrace, "Fetched all %d records\n", m_records_read);
     }
 }
 
+bool
+CacheRecorder::issueNextFetchRequest()
+{
+    TraceRecord* traceRecord = (TraceRecord*) (m_uncompressed_trace +
+                                                            m_bytes_read);
+
+    DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
+
+    RequestPtr req;
+    MemCmd::Command requestType;
+
+    if (traceRecord->m_type == RubyRequestType_LD) {
+        requestType = MemCmd::ReadReq;
+        req = std::make_shared<Request>(traceRecord->m_data_address,
+                                        m_block_size_bytes, 0,
+                                        Request::funcRequestorId);
+    } else if (traceRecord->m_type == RubyRequestType_IFETCH) {
+        requestType = MemCmd::ReadReq;
+        req = std::make_shared<Request>(traceRecord->m_data_address,
+                                        m_block_size_bytes,
+                                        Request::INST_FETCH,
+                                        Request::funcRequestorId);
+    } else {
+        requestType = MemCmd::WriteReq;
+        req = std::make_shared<Request>(traceRecord->m_data_address,
+                                        m_block_size_bytes, 0,
+                                        Request::funcRequestorId);
+    }
+
+    Packet *pkt = new Packet(req, requestType);
+    pkt->dataStatic(traceRecord->m_data);
+    pkt->req->setReqInstSeqNum(m_records_read);
+
+    RubyPort* m_ruby_port_ptr = m_ruby_port_map[traceRecord->m_cntrl_id];
+    assert(m_ruby_port_ptr != NULL);
+    if (m_ruby_port_ptr->makeRequest(pkt) == RequestStatus_BufferFull) {
+        DPRINTF(RubyCacheTrace, "Sequencer full, retrying %s later\n",
+                *traceRecord);
+        delete pkt;
+        return false;
+    }
+
+    m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
+    m_records_read++;
+    return true;
+}
+
 void
 CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
                          RubyRequestType type, Tick time, DataBlock& data)
@@ -79,7 +79,8 @@ class CacheRecorder
                   uint64_t uncompressed_trace_size,
                   std::vector<RubyPort*>& ruby_port_map,
                   uint64_t trace_block_size_bytes,
-                  uint64_t system_block_size_bytes);
+                  uint64_t system_block_size_bytes,
+                  unsigned warmup_window = 1);
     ~CacheRecorder();
 
     void addRecord(int cntrl, Addr data_addr, Addr pc_addr,
@@ -102,9 +103,13 @@ class CacheRecorder
     /*!
      * Function for fetching warming up the memory and the caches. It goes
      * through the recorded contents of the caches, as available in the
-     * checkpoint and issues fetch requests. Except for the first one, a
-     * fetch request is issued only after the previous one has completed.
-     * It should be possible to use this with any protocol.
+     * checkpoint and issues fetch requests in trace order. It is called
+     * once to start the warmup and then once for every completed fetch,
+     * and keeps up to the warmup window of fetches outstanding. A fetch
+     * that a sequencer rejects because it is full is retried when the
+     * next one completes. With a window of one, a fetch request is issued
+     * only after the previous one has completed. It should be possible to
+     * use this with any protocol.
      */
     void enqueueNextFetchRequest();
 
@@ -113,6 +118,14 @@ class CacheRecorder
     CacheRecorder(const CacheRecorder& obj);
     CacheRecorder& operator=(const CacheRecorder& obj);
 
+    /*!
+     * Issue the fetch for the next record in the trace.
+     *
+     * @return false if the sequencer was full and the record has to be
+     *         retried later.
+     */
+    bool issueNextFetchRequest();
+
     std::vector<TraceRecord*> m_records;
     uint8_t* m_uncompressed_trace;
     uint64_t m_uncompressed_trace_size;
@@ -121,6 +134,8 @@ class CacheRecorder
     uint64_t m_records_read;
     uint64_t m_records_flushed;
     uint64_t m_block_size_bytes;
+    unsigned m_warmup_window;
+    unsigned m_fetches_outstanding;
 };
 
 inline bool
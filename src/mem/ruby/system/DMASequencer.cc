@@ -40,6 +40,7 @@
 
 #include "mem/ruby/system/DMASequencer.hh"
 
+#include <algorithm>
 #include <memory>
 
 #include "debug/RubyDma.hh"
@@ -65,8 +66,11 @@ DMARequest::DMARequest(uint64_t start_paddr, int len, bool write,
 
 DMASequencer::DMASequencer(const Params &p)
     : RubyPort(p), m_outstanding_count(0),
-      m_max_outstanding_requests(p.max_outstanding_requests)
+      m_max_outstanding_requests(p.max_outstanding_requests),
+      m_max_outstanding_lines(p.max_outstanding_lines)
 {
+    fatal_if(m_max_outstanding_lines < 1,
+             "%s: max_outstanding_lines must be at least 1.", name());
 }
 
 void
@@ -93,70 +97,66 @@ DMASequencer::makeRequest(PacketPtr pkt)
 
     assert(m_outstanding_count < m_max_outstanding_requests);
     Addr line_addr = makeLineAddress(paddr);
+
+    // This is pretty conservative.  A regular Sequencer with a  more beefy
+    // request table that can track multiple requests for a cache line should
+    // be used if a more aggressive policy is needed. The lines of a request
+    // are issued as the earlier ones complete, so none of them may be in use
+    // by another request.
+    int blk_size = m_ruby_system->getBlockSizeBytes();
+    for (Addr addr = line_addr; addr < paddr + len; addr += blk_size) {
+        if (m_RequestTable.count(addr) || m_LineTable.count(addr)) {
+            DPRINTF(RubyDma, "DMA aliased: addr %p, len %d\n",
+                    line_addr, len);
+            return RequestStatus_Aliased;
+        }
+    }
+
     auto emplace_pair =
         m_RequestTable.emplace(std::piecewise_construct,
                                std::forward_as_tuple(line_addr),
                                std::forward_as_tuple(paddr, len, write, 0,
                                                      0, data, pkt));
+    assert(emplace_pair.second);
     DMARequest& active_request = emplace_pair.first->second;
 
-    // This is pretty conservative.  A regular Sequencer with a  more beefy
-    // request table that can track multiple requests for a cache line should
-    // be used if a more aggressive policy is needed.
-    if (!emplace_pair.second) {
-            DPRINTF(RubyDma, "DMA aliased: addr %p, len %d\n", line_addr, len);
-            return RequestStatus_Aliased;
-    }
-
     DPRINTF(RubyDma, "DMA req created: addr %p, len %d\n", line_addr, len);
 
-    int blk_size = m_ruby_system->getBlockSizeBytes();
+    m_outstanding_count++;
 
-    std::shared_ptr<SequencerMsg> msg =
-        std::make_shared<SequencerMsg>(clockEdge(), blk_size, m_ruby_system);
+    if (!pkt->req->isAtomic()) {
+        issueNext(line_addr);
+        return RequestStatus_Issued;
+    }
+
+    auto msg =
+        makeMessage<SequencerMsg>(clockEdge(), blk_size, m_ruby_system);
     msg->getPhysicalAddress() = paddr;
     msg->getLineAddress() = line_addr;
+    msg->setType(SequencerRequestType_ATOMIC);
 
-    if (pkt->req->isAtomic()) {
-        msg->setType(SequencerRequestType_ATOMIC);
-
-        // While regular LD/ST can support DMAs spanning multiple cache lines,
-        // atomic requests are only supported within a single cache line. The
-        // atomic request will end upon atomicCallback and not call issueNext.
-        int block_size = m_ruby_system->getBlockSizeBytes();
-        int atomic_offset = pkt->getAddr() - line_addr;
-        std::vector<bool> access_mask(block_size, false);
-        assert(atomic_offset + pkt->getSize() <= block_size);
-
-        for (int idx = 0; idx < pkt->getSize(); ++idx) {
-            access_mask[atomic_offset + idx] = true;
-        }
+    // While regular LD/ST can support DMAs spanning multiple cache lines,
+    // atomic requests are only supported within a single cache line. The
+    // atomic request will end upon atomicCallback and not call issueNext.
+    int atomic_offset = pkt->getAddr() - line_addr;
+    std::vector<bool> access_mask(blk_size, false);
+    assert(atomic_offset + pkt->getSize() <= blk_size);
 
-        std::vector<std::pair<int, AtomicOpFunctor*>> atomic_ops;
-        std::pair<int, AtomicOpFunctor*>
-            atomic_op(atomic_offset, pkt->getAtomicOp());
-
-        atomic_ops.emplace_back(atomic_op);
-        msg->getwriteMask().setAtomicOps(atomic_ops);
-    } else if (write) {
-        msg->setType(SequencerRequestType_ST);
-    } else {
-        assert(pkt->isRead());
-        msg->setType(SequencerRequestType_LD);
+    for (int idx = 0; idx < pkt->getSize(); ++idx) {
+        access_mask[atomic_offset + idx] = true;
     }
 
-    int offset = paddr & m_data_block_mask;
+    std::vector<std::pair<int, AtomicOpFunctor*>> atomic_ops;
+    std::pair<int, AtomicOpFunctor*>
+        atomic_op(atomic_offset, pkt->getAtomicOp());
 
-    msg->getLen() = (offset + len) <= m_ruby_system->getBlockSizeBytes() ?
-        len : m_ruby_system->getBlockSizeBytes() - offset;
+    atomic_ops.emplace_back(atomic_op);
+    msg->getwriteMask().setAtomicOps(atomic_ops);
 
-    if (write && (data != NULL)) {
-        if (active_request.data != NULL) {
-            msg->getDataBlk().setData(data, offset, msg->getLen());
-        }
-    }
+    msg->getLen() = len;
 
-    m_outstanding_count++;
+    m_LineTable.emplace(line_addr, line_addr);
+    active_request.lines_outstanding++;
 
     assert(m_mandatory_q_ptr != NULL);
     m_mandatory_q_ptr->enqueue(msg, clockEdge(), cyclesToTicks(Cycles(1)),
@@ -167,18 +167,89 @@ DMASequencer::makeRequest(PacketPtr pkt)
 }
 
 void
-DMASequencer::issueNext(const Addr& address)
+DMASequencer::issueNext(const Addr& key)
 {
-    RequestTable::iterator i = m_RequestTable.find(address);
+    RequestTable::iterator i = m_RequestTable.find(key);
     assert(i != m_RequestTable.end());
 
     DMARequest &active_request = i->second;
 
     assert(m_outstanding_count <= m_max_outstanding_requests);
-    active_request.bytes_completed = active_request.bytes_issued;
+    int blk_size = m_ruby_system->getBlockSizeBytes();
+
+    // The controllers stall the requests for lines they are busy with, and
+    // the lines of a request are distinct, so the lines in flight can be
+    // serviced in any order.
+    while (active_request.bytes_issued < active_request.len &&
+           active_request.lines_outstanding < m_max_outstanding_lines) {
+        auto msg =
+            makeMessage<SequencerMsg>(clockEdge(), blk_size, m_ruby_system);
+        Addr paddr = active_request.start_paddr + active_request.bytes_issued;
+        int offset = paddr & m_data_block_mask;
+        msg->getPhysicalAddress() = paddr;
+        msg->getLineAddress() = makeLineAddress(paddr);
+
+        msg->getType() = (active_request.write ? SequencerRequestType_ST :
+                         SequencerRequestType_LD);
+
+        msg->getLen() = std::min(active_request.len -
+                                 active_request.bytes_issued,
+                                 blk_size - offset);
+
+        if (active_request.write && active_request.data != NULL) {
+            msg->getDataBlk().
+                setData(&active_request.data[active_request.bytes_issued],
+                        offset, msg->getLen());
+        }
+
+        m_LineTable.emplace(msg->getLineAddress(), key);
+        active_request.lines_outstanding++;
+
+        assert(m_mandatory_q_ptr != NULL);
+        m_mandatory_q_ptr->enqueue(msg, clockEdge(),
+            cyclesToTicks(Cycles(1)), m_ruby_system->getRandomization(),
+            m_ruby_system->getWarmupEnabled());
+        active_request.bytes_issued += msg->getLen();
+        DPRINTF(RubyDma,
+                "DMA request bytes issued %d, bytes completed %d, "
+                "total len %d\n", active_request.bytes_issued,
+                active_request.bytes_completed, active_request.len);
+    }
+}
+
+void
+DMASequencer::lineDone(const Addr& line_addr, const DataBlock *dblk)
+{
+    auto l = m_LineTable.find(line_addr);
+    assert(l != m_LineTable.end());
+    Addr key = l->second;
+    m_LineTable.erase(l);
+
+    RequestTable::iterator i = m_RequestTable.find(key);
+    assert(i != m_RequestTable.end());
+
+    DMARequest &active_request = i->second;
+
+    // The part of the request which is in this line.
+    Addr start = std::max<Addr>(active_request.start_paddr, line_addr);
+    Addr end = std::min<Addr>(active_request.start_paddr + active_request.len,
+                              line_addr + m_ruby_system->getBlockSizeBytes());
+    int len = end - start;
+    if (dblk) {
+        assert(!active_request.write);
+        if (active_request.data != NULL) {
+            memcpy(&active_request.data[start - active_request.start_paddr],
+                   dblk->getData(start & m_data_block_mask, len), len);
+        }
+    }
+
+    active_request.lines_outstanding--;
+    active_request.bytes_completed += len;
+    assert(active_request.bytes_completed <= active_request.bytes_issued);
     if (active_request.len == active_request.bytes_completed) {
         DPRINTF(RubyDma, "DMA request completed: addr %p, size %d\n",
-                address, active_request.len);
+                key, active_request.len);
+        assert(active_request.lines_outstanding == 0);
         m_outstanding_count--;
         PacketPtr pkt = active_request.pkt;
         m_RequestTable.erase(i);
@@ -186,66 +257,19 @@ DMASequencer::issueNext(const Addr& address)
         return;
     }
 
-    int blk_size = m_ruby_system->getBlockSizeBytes();
-
-    std::shared_ptr<SequencerMsg> msg =
-        std::make_shared<SequencerMsg>(clockEdge(), blk_size, m_ruby_system);
-    msg->getPhysicalAddress() = active_request.start_paddr +
-                                active_request.bytes_completed;
-
-    assert((msg->getPhysicalAddress() & m_data_block_mask) == 0);
-    msg->getLineAddress() = makeLineAddress(msg->getPhysicalAddress());
-
-    msg->getType() = (active_request.write ? SequencerRequestType_ST :
-                     SequencerRequestType_LD);
-
-    msg->getLen() =
-        (active_request.len -
-         active_request.bytes_completed < m_ruby_system->getBlockSizeBytes() ?
-         active_request.len - active_request.bytes_completed :
-         m_ruby_system->getBlockSizeBytes());
-
-    if (active_request.write) {
-        msg->getDataBlk().
-            setData(&active_request.data[active_request.bytes_completed],
-                    0, msg->getLen());
-    }
-
-    assert(m_mandatory_q_ptr != NULL);
-    m_mandatory_q_ptr->enqueue(msg, clockEdge(), cyclesToTicks(Cycles(1)),
-        m_ruby_system->getRandomization(), m_ruby_system->getWarmupEnabled());
-    active_request.bytes_issued += msg->getLen();
-    DPRINTF(RubyDma,
-            "DMA request bytes issued %d, bytes completed %d, total len %d\n",
-            active_request.bytes_issued, active_request.bytes_completed,
-            active_request.len);
+    issueNext(key);
 }
 
 void
 DMASequencer::dataCallback(const DataBlock & dblk, const Addr& address)
 {
-
-    RequestTable::iterator i = m_RequestTable.find(address);
-    assert(i != m_RequestTable.end());
-
-    DMARequest &active_request = i->second;
-    int len = active_request.bytes_issued - active_request.bytes_completed;
-    int offset = 0;
-    if (active_request.bytes_completed == 0)
-        offset = active_request.start_paddr & m_data_block_mask;
-    assert(!active_request.write);
-    if (active_request.data != NULL) {
-        memcpy(&active_request.data[active_request.bytes_completed],
-               dblk.getData(offset, len), len);
-    }
-    issueNext(address);
+    lineDone(address, &dblk);
 }
 
 void
 DMASequencer::ackCallback(const Addr& address)
 {
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    issueNext(address);
+    lineDone(address, nullptr);
 }
 
 void
@@ -253,6 +277,7 @@ DMASequencer::atomicCallback(const DataBlock& dblk, const Addr& address)
 {
     RequestTable::iterator i = m_RequestTable.find(address);
     assert(i != m_RequestTable.end());
+    m_LineTable.erase(address);
 
     DMARequest &active_request = i->second;
     PacketPtr pkt = active_request.pkt;
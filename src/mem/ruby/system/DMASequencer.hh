@@ -57,6 +57,8 @@ struct DMARequest
     int bytes_issued;
     uint8_t *data;
     PacketPtr pkt;
+    /** Lines of the request issued to the controller and not done yet */
+    int lines_outstanding = 0;
 };
 
 class DMASequencer : public RubyPort
@@ -81,15 +83,29 @@ class DMASequencer : public RubyPort
     void recordRequestType(DMASequencerRequestType requestType);
 
   private:
-    void issueNext(const Addr &addr);
+    /**
+     * Issue lines of a request until it has as many lines in flight as
+     * allowed, or until all of it is issued.
+     *
+     * @param key The line address of the start of the request.
+     */
+    void issueNext(const Addr &key);
+
+    /** Account for a line of a request once the controller is done. */
+    void lineDone(const Addr &line_addr, const DataBlock *dblk);
 
     uint64_t m_data_block_mask;
 
+    /** Requests, by the line address of their start */
     typedef std::unordered_map<Addr, DMARequest> RequestTable;
     RequestTable m_RequestTable;
 
+    /** The request of each line in flight, by line address */
+    std::unordered_map<Addr, Addr> m_LineTable;
+
     int m_outstanding_count;
     int m_max_outstanding_requests;
+    int m_max_outstanding_lines;
 };
 
 } // namespace ruby
@@ -31,6 +31,8 @@
 
 #include "mem/ruby/system/GPUCoalescer.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
@@ -69,9 +71,10 @@ UncoalescedTable::insertPacket(PacketPtr pkt)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    instMap[seqNum].push_back(pkt);
+    auto &pkts = instMap[seqNum].pkts;
+    pkts.push_back(pkt);
     DPRINTF(GPUCoalescer, "Adding 0x%X seqNum %d to map. (map %d vec %d)\n",
-            pkt->getAddr(), seqNum, instMap.size(), instMap[seqNum].size());
+            pkt->getAddr(), seqNum, instMap.size(), pkts.size());
 }
 
 void
@@ -79,7 +82,7 @@ UncoalescedTable::insertReqType(PacketPtr pkt, RubyRequestType type)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    reqTypeMap[seqNum] = type;
+    instMap[seqNum].reqType = type;
 }
 
 bool
@@ -91,34 +94,23 @@ UncoalescedTable::packetAvailable()
 void
 UncoalescedTable::initPacketsRemaining(InstSeqNum seqNum, int count)
 {
-    if (!instPktsRemaining.count(seqNum)) {
-        instPktsRemaining[seqNum] = count;
+    InstEntry &entry = instMap[seqNum];
+    if (!entry.pktsRemainingSet) {
+        entry.pktsRemaining = count;
+        entry.pktsRemainingSet = true;
     }
 }
 
 int
 UncoalescedTable::getPacketsRemaining(InstSeqNum seqNum)
 {
-    return instPktsRemaining[seqNum];
+    return instMap[seqNum].pktsRemaining;
 }
 
 void
 UncoalescedTable::setPacketsRemaining(InstSeqNum seqNum, int count)
 {
-    instPktsRemaining[seqNum] = count;
-}
-
-PerInstPackets*
-UncoalescedTable::getInstPackets(int offset)
-{
-    if (offset >= instMap.size()) {
-        return nullptr;
-    }
-
-    auto instMapIter = instMap.begin();
-    std::advance(instMapIter, offset);
-
-    return &(instMapIter->second);
+    instMap[seqNum].pktsRemaining = count;
 }
 
 void
@@ -128,14 +120,14 @@ UncoalescedTable::updateResources()
         InstSeqNum seq_num = iter->first;
         DPRINTF(GPUCoalescer, "%s checking remaining pkts for %d\n",
                 coalescer->name().c_str(), seq_num);
-        assert(instPktsRemaining.count(seq_num));
+        const InstEntry &entry = iter->second;
+        assert(entry.pktsRemainingSet);
 
-        if (instPktsRemaining[seq_num] == 0) {
-            assert(iter->second.empty());
+        if (entry.pktsRemaining == 0) {
+            assert(entry.pkts.empty());
+            const RubyRequestType req_type = entry.reqType;
 
-            // Remove from both maps
             instMap.erase(iter++);
-            instPktsRemaining.erase(seq_num);
 
             // Release the token if the Ruby system is not in cooldown
             // or warmup phases. When in these phases, the RubyPorts
@@ -144,14 +136,12 @@ UncoalescedTable::updateResources()
             // sending tokens through the port unnecessary
             if (!coalescer->getRubySystem()->getWarmupEnabled() &&
                 !coalescer->getRubySystem()->getCooldownEnabled()) {
-                if (reqTypeMap[seq_num] != RubyRequestType_FLUSH) {
+                if (req_type != RubyRequestType_FLUSH) {
                     DPRINTF(GPUCoalescer,
                             "Returning token seqNum %d\n", seq_num);
                     coalescer->getGMTokenPort().sendTokens(1);
                 }
             }
-
-            reqTypeMap.erase(seq_num);
         } else {
             ++iter;
         }
@@ -160,12 +150,13 @@ UncoalescedTable::updateResources()
 
 bool
 UncoalescedTable::areRequestsDone(const uint64_t instSeqNum) {
-    // iterate the instructions held in UncoalescedTable to see whether there
-    // are more requests to issue; if yes, not yet done; otherwise, done
-    for (auto& inst : instMap) {
-        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n"
-            ,inst.first, inst.second.size());
-        if (inst.first == instSeqNum) { return false; }
+    // check whether the instruction is still held in UncoalescedTable with
+    // more requests to issue; if yes, not yet done; otherwise, done
+    auto inst = instMap.find(instSeqNum);
+    if (inst != instMap.end()) {
+        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n",
+                inst->first, inst->second.pkts.size());
+        return false;
     }
 
     return true;
@@ -178,7 +169,7 @@ UncoalescedTable::printRequestTable(std::stringstream& ss)
 
     for (auto& inst : instMap) {
         ss << "\tAddr: " << coalescer->printAddress(inst.first) << " with "
-           << inst.second.size() << " pending packets" << std::endl;
+           << inst.second.pkts.size() << " pending packets" << std::endl;
     }
 }
 
@@ -188,7 +179,7 @@ UncoalescedTable::checkDeadlock(Tick threshold)
     Tick current_time = curTick();
 
     for (auto &it : instMap) {
-        for (auto &pkt : it.second) {
+        for (auto &pkt : it.second.pkts) {
             if (current_time - pkt->req->time() > threshold) {
                 std::stringstream ss;
                 printRequestTable(ss);
@@ -231,6 +222,9 @@ GPUCoalescer::GPUCoalescer(const Params &p)
     m_max_outstanding_requests = p.max_outstanding_requests;
     m_deadlock_threshold = p.deadlock_threshold;
 
+    coalescedTable.reserve(m_max_outstanding_requests);
+    freeCoalescedReqs.reserve(m_max_outstanding_requests);
+
     assert(m_max_outstanding_requests > 0);
     assert(m_deadlock_threshold > 0);
     assert(m_instCache_ptr);
@@ -442,7 +436,7 @@ GPUCoalescer::writeCallback(Addr address,
                 forwardRequestTime, firstResponseTime, isRegion, false);
 
     // remove this crequest in coalescedTable
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
 
     if (coalescedTable.at(address).empty()) {
@@ -533,7 +527,7 @@ GPUCoalescer::readCallback(Addr address,
     hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                 forwardRequestTime, firstResponseTime, isRegion, externalHit);
 
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
     if (coalescedTable.at(address).empty()) {
       coalescedTable.erase(address);
@@ -794,7 +788,7 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
         DPRINTF(GPUCoalescer, "Creating new or aliased request for 0x%X\n",
                 line_addr);
 
-        CoalescedRequest *creq = new CoalescedRequest(seqNum);
+        CoalescedRequest *creq = allocCoalescedRequest(seqNum);
         creq->insertPacket(pkt);
         creq->setRubyType(getRequestType(pkt));
         creq->setIssueTime(curCycle());
@@ -862,24 +856,43 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
     return false;
 }
 
+CoalescedRequest *
+GPUCoalescer::allocCoalescedRequest(uint64_t seq_num)
+{
+    if (freeCoalescedReqs.empty())
+        return new CoalescedRequest(seq_num);
+
+    CoalescedRequest *creq = freeCoalescedReqs.back().release();
+    freeCoalescedReqs.pop_back();
+    creq->reset(seq_num);
+    return creq;
+}
+
+void
+GPUCoalescer::freeCoalescedRequest(CoalescedRequest *creq)
+{
+    // There can be no more requests in use than can be outstanding, so
+    // the pool never needs to hold more than that.
+    if (freeCoalescedReqs.size() < size_t(m_max_outstanding_requests))
+        freeCoalescedReqs.emplace_back(creq);
+    else
+        delete creq;
+}
+
 void
 GPUCoalescer::completeIssue()
 {
     // Iterate over the maximum number of instructions we can coalesce
-    // per cycle (coalescingWindow).
-    for (int instIdx = 0; instIdx < coalescingWindow; ++instIdx) {
-        PerInstPackets *pkt_list =
-            uncoalescedTable.getInstPackets(instIdx);
-
-        // getInstPackets will return nullptr if no instruction
-        // exists at the current offset.
-        if (!pkt_list) {
-            break;
-        } else if (pkt_list->empty()) {
+    // per cycle (coalescingWindow), oldest first.
+    uncoalescedTable.forEachInst(coalescingWindow,
+            [this](PerInstPackets &pkts) {
+        PerInstPackets *pkt_list = &pkts;
+
+        if (pkt_list->empty()) {
             // Found something, but it has not been cleaned up by update
             // resources yet. See if there is anything else to coalesce.
             // Assume we can't check anymore if the coalescing window is 1.
-            continue;
+            return;
         } else {
             // All packets in the list have the same seqNum, use first.
             InstSeqNum seq_num = pkt_list->front()->req->getReqInstSeqNum();
@@ -892,9 +905,9 @@ GPUCoalescer::completeIssue()
             // erase them from the list if coalescing is successful and
             // leave them in the list otherwise. This aggressively attempts
             // to coalesce as many packets as possible from the current inst.
-            pkt_list->remove_if(
-                [&](PacketPtr pkt) { return coalescePacket(pkt); }
-            );
+            pkt_list->erase(std::remove_if(pkt_list->begin(), pkt_list->end(),
+                [&](PacketPtr pkt) { return coalescePacket(pkt); }),
+                pkt_list->end());
 
             if (coalescedReqs.count(seq_num)) {
                 auto& creqs = coalescedReqs.at(seq_num);
@@ -919,7 +932,7 @@ GPUCoalescer::completeIssue()
                     "Coalesced %d pkts for seqNum %d, %d remaining\n",
                     pkt_list_diff, seq_num, num_remaining);
         }
-    }
+    });
 
     // Clean up any instructions in the uncoalesced table that have had
     // all of their packets coalesced and return a token for that column.
@@ -967,7 +980,7 @@ GPUCoalescer::atomicCallback(Addr address,
     hitCallback(crequest, mach, (DataBlock&)data, true,
                 crequest->getIssueTime(), Cycles(0), Cycles(0), false, false);
 
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
 
     if (coalescedTable.at(address).empty()) {
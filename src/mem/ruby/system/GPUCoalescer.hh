@@ -32,8 +32,12 @@
 #ifndef __MEM_RUBY_SYSTEM_GPU_COALESCER_HH__
 #define __MEM_RUBY_SYSTEM_GPU_COALESCER_HH__
 
+#include <deque>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "gpu-compute/gpu_dyn_inst.hh"
@@ -62,7 +66,7 @@ struct MachineID;
 class CacheMemory;
 
 // List of packets that belongs to a specific instruction.
-typedef std::list<PacketPtr> PerInstPackets;
+typedef std::vector<PacketPtr> PerInstPackets;
 
 class UncoalescedTable
 {
@@ -81,10 +85,17 @@ class UncoalescedTable
     int getPacketsRemaining(InstSeqNum seqNum);
     void setPacketsRemaining(InstSeqNum seqNum, int count);
 
-    // Returns a pointer to the list of packets corresponding to an
-    // instruction in the instruction map or nullptr if there are no
-    // instructions at the offset.
-    PerInstPackets* getInstPackets(int offset);
+    // Calls func on the list of packets of each of the count oldest
+    // instructions in the instruction map, in age order.
+    template <typename Func>
+    void
+    forEachInst(int count, Func func)
+    {
+        for (auto iter = instMap.begin();
+                iter != instMap.end() && count > 0; ++iter, --count) {
+            func(iter->second.pkts);
+        }
+    }
     void updateResources();
     bool areRequestsDone(const InstSeqNum instSeqNum);
 
@@ -95,15 +106,23 @@ class UncoalescedTable
   private:
     GPUCoalescer *coalescer;
 
-    // Maps an instructions unique sequence number to a queue of packets
-    // which need responses. This data structure assumes the sequence number
+    // Everything tracked for an instruction, kept together so that each
+    // packet needs a single lookup.
+    struct InstEntry
+    {
+        // The packets which need responses.
+        PerInstPackets pkts;
+        // The number of packets still to be coalesced, once set.
+        int pktsRemaining = 0;
+        bool pktsRemainingSet = false;
+        RubyRequestType reqType = RubyRequestType_NULL;
+    };
+
+    // Maps an instructions unique sequence number to the packets which
+    // need responses. This data structure assumes the sequence number
     // is monotonically increasing (which is true for CU class) in order to
     // issue packets in age order.
-    std::map<InstSeqNum, PerInstPackets> instMap;
-
-    std::map<InstSeqNum, int> instPktsRemaining;
-
-    std::map<InstSeqNum, RubyRequestType> reqTypeMap;
+    std::map<InstSeqNum, InstEntry> instMap;
 };
 
 class CoalescedRequest
@@ -126,6 +145,17 @@ class CoalescedRequest
     RubyRequestType getRubyType() const { return rubyType; }
     std::vector<PacketPtr>& getPackets() { return pkts; }
 
+    // Prepare a completed request for reuse, keeping the storage for
+    // its packets.
+    void
+    reset(uint64_t _seqNum)
+    {
+        seqNum = _seqNum;
+        issueTime = Cycles(0);
+        rubyType = RubyRequestType_NULL;
+        pkts.clear();
+    }
+
   private:
     uint64_t seqNum;
     Cycles issueTime;
@@ -418,6 +448,11 @@ class GPUCoalescer : public RubyPort
     // "target" list of the coalescedTable.
     bool coalescePacket(PacketPtr pkt);
 
+    // Get a coalesced request from the pool of completed ones, or a new
+    // one if that is empty, and return one to the pool once completed.
+    CoalescedRequest *allocCoalescedRequest(uint64_t seq_num);
+    void freeCoalescedRequest(CoalescedRequest *creq);
+
     EventFunctionWrapper issueEvent;
 
   protected:
@@ -440,8 +475,12 @@ class GPUCoalescer : public RubyPort
     // this table may or may not be outstanding in the memory hierarchy. The
     // maximum size is equal to the maximum outstanding requests for a CU
     // (typically the number of blocks in TCP). If there are duplicates of
-    // an address, the are serviced in age order.
-    std::map<Addr, std::deque<CoalescedRequest*>> coalescedTable;
+    // an address, the are serviced in age order. It is only ever looked up
+    // by line address, so it is hashed rather than ordered.
+    std::unordered_map<Addr, std::deque<CoalescedRequest*>> coalescedTable;
+    // Completed coalesced requests, which are reused for new requests
+    // rather than allocating one for every coalesced line.
+    std::vector<std::unique_ptr<CoalescedRequest>> freeCoalescedReqs;
     // Map of instruction sequence number to coalesced requests that get
     // created in coalescePacket, used in completeIssue to send the fully
     // coalesced request
@@ -39,6 +39,7 @@
 #define __MEM_RUBY_SYSTEM_HTMSEQUENCER_HH__
 
 #include <cassert>
+#include <deque>
 #include <iostream>
 
 #include "mem/htm.hh"
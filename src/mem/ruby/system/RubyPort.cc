@@ -320,6 +320,63 @@ RubyPort::MemResponsePort::recvTimingReq(PacketPtr pkt)
 
 Tick
 RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
+{
+    return atomicAccess(pkt, nullptr);
+}
+
+Tick
+RubyPort::MemResponsePort::recvAtomicBackdoor(PacketPtr pkt,
+                                              MemBackdoorPtr &backdoor)
+{
+    return atomicAccess(pkt, &backdoor);
+}
+
+void
+RubyPort::MemResponsePort::recvMemBackdoorReq(const MemBackdoorReq &req,
+                                              MemBackdoorPtr &backdoor)
+{
+    // Ruby caches may hold the latest data unless they are bypassed
+    if (!owner.system->bypassCaches())
+        return;
+
+    const Addr addr = req.range().start();
+    if (!owner.system->isMemAddr(addr) || isShadowRomAddress(addr))
+        return;
+
+    if (access_backing_store)
+        owner.m_ruby_system->getPhysMem()->getBackdoor(backdoor);
+    else
+        memInterface(addr)->recvMemBackdoorReq(req, backdoor);
+}
+
+AbstractController *
+RubyPort::MemResponsePort::memInterface(Addr addr) const
+{
+    RubySystem *rs = owner.m_ruby_system;
+
+    // Find the machine type of memory controller interface
+    static int mem_interface_type = -1;
+    if (mem_interface_type == -1) {
+        if (rs->m_abstract_controls[MachineType_Directory].size() != 0) {
+            mem_interface_type = MachineType_Directory;
+        }
+        else if (rs->m_abstract_controls[MachineType_Memory].size() != 0) {
+            mem_interface_type = MachineType_Memory;
+        }
+        else {
+            panic("Can't find the memory controller interface\n");
+        }
+    }
+
+    // Find the controller for the target address
+    MachineID id = owner.m_controller->mapAddressToMachine(
+                    addr, (MachineType)mem_interface_type);
+    return rs->m_abstract_controls[mem_interface_type][id.getNum()];
+}
+
+Tick
+RubyPort::MemResponsePort::atomicAccess(PacketPtr pkt,
+                                        MemBackdoorPtr *backdoor)
 {
     // Only atomic_noncaching mode supported!
     if (!owner.system->bypassCaches()) {
@@ -349,28 +406,18 @@ RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
                rs->getBlockSizeBytes());
     }
 
-    // Find the machine type of memory controller interface
-    static int mem_interface_type = -1;
-    if (mem_interface_type == -1) {
-        if (rs->m_abstract_controls[MachineType_Directory].size() != 0) {
-            mem_interface_type = MachineType_Directory;
-        }
-        else if (rs->m_abstract_controls[MachineType_Memory].size() != 0) {
-            mem_interface_type = MachineType_Memory;
-        }
-        else {
-            panic("Can't find the memory controller interface\n");
-        }
+    AbstractController *mem_interface = memInterface(pkt->getAddr());
+    if (!access_backing_store) {
+        return backdoor ?
+            mem_interface->recvAtomicBackdoor(pkt, *backdoor) :
+            mem_interface->recvAtomic(pkt);
     }
 
-    // Find the controller for the target address
-    MachineID id = owner.m_controller->mapAddressToMachine(
-                    pkt->getAddr(), (MachineType)mem_interface_type);
-    AbstractController *mem_interface =
-        rs->m_abstract_controls[mem_interface_type][id.getNum()];
     Tick latency = mem_interface->recvAtomic(pkt);
-    if (access_backing_store)
-        rs->getPhysMem()->access(pkt);
+    rs->getPhysMem()->access(pkt);
+    // The backing store holds the official version of the data
+    if (backdoor)
+        rs->getPhysMem()->getBackdoor(*backdoor);
     return latency;
 }
 
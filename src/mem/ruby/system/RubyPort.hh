@@ -100,6 +100,12 @@ class RubyPort : public ClockedObject
 
         Tick recvAtomic(PacketPtr pkt);
 
+        Tick recvAtomicBackdoor(PacketPtr pkt,
+                                MemBackdoorPtr &backdoor) override;
+
+        void recvMemBackdoorReq(const MemBackdoorReq &req,
+                                MemBackdoorPtr &backdoor) override;
+
         void recvFunctional(PacketPtr pkt);
 
         AddrRangeList getAddrRanges() const
@@ -108,6 +114,16 @@ class RubyPort : public ClockedObject
         void addToRetryList();
 
       private:
+        /**
+         * Perform an atomic access, and get a backdoor to the memory
+         * it accessed if backdoor is not null. Backdoors are only
+         * handed out in cache bypass mode, as Ruby caches no data then.
+         */
+        Tick atomicAccess(PacketPtr pkt, MemBackdoorPtr *backdoor);
+
+        /** Memory controller interface the address is mapped to */
+        AbstractController *memInterface(Addr addr) const;
+
         bool isShadowRomAddress(Addr addr) const;
         bool isPhysMemAddress(PacketPtr pkt) const;
     };
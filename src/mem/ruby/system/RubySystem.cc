@@ -43,6 +43,7 @@
 #include <fcntl.h>
 #include <zlib.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <list>
 
@@ -52,6 +53,7 @@
 #include "debug/RubyCacheTrace.hh"
 #include "debug/RubySystem.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/WriteMask.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/system/DMASequencer.hh"
 #include "mem/ruby/system/Sequencer.hh"
@@ -70,13 +72,18 @@ namespace ruby
 // of RubySystems that need to be warmed up on checkpoint restore.
 
 RubySystem::RubySystem(const Params &p)
-    : ClockedObject(p), m_access_backing_store(p.access_backing_store),
+    : ClockedObject(p), m_warmup_window(p.warmup_window),
+      m_access_backing_store(p.access_backing_store),
+      m_functional_index_enabled(p.functional_index),
       m_cache_recorder(NULL)
 {
     m_randomization = p.randomization;
 
     m_block_size_bytes = p.block_size_bytes;
     assert(isPowerOf2(m_block_size_bytes));
+    fatal_if(m_block_size_bytes > WriteMask::MaxSize,
+             "Ruby block size %d is larger than the maximum of %d bytes.",
+             m_block_size_bytes, WriteMask::MaxSize);
     m_block_size_bits = floorLog2(m_block_size_bytes);
     m_memory_size_bits = p.memory_size_bits;
 
@@ -217,7 +224,8 @@ RubySystem::makeCacheRecorder(uint8_t *uncompressed_trace,
     // Create the CacheRecorder and record the cache trace
     m_cache_recorder = new CacheRecorder(uncompressed_trace, cache_trace_size,
                                          ruby_port_map, block_size_bytes,
-                                         m_block_size_bytes);
+                                         m_block_size_bytes,
+                                         m_warmup_window);
 }
 
 void
@@ -351,7 +359,9 @@ RubySystem::serialize(CheckpointOut &cp) const
     uint64_t cache_trace_size = m_cache_recorder->aggregateRecords(
                                                         &raw_data, 4096);
     std::string cache_trace_file = name() + ".cache.gz";
-    writeCompressedTrace(raw_data, cache_trace_file, cache_trace_size);
+    writeAsync([=]() {
+        writeCompressedTrace(raw_data, cache_trace_file, cache_trace_size);
+    });
 
     SERIALIZE_SCALAR(cache_trace_file);
     SERIALIZE_SCALAR(cache_trace_size);
@@ -504,6 +514,63 @@ RubySystem::resetStats()
     ClockedObject::resetStats();
 }
 
+void
+RubySystem::updateFunctionalIndex(AbstractController *cntrl, Addr line_addr,
+                                  bool may_hold)
+{
+    if (!m_functional_index_valid.load(std::memory_order_relaxed))
+        return;
+
+    // Controllers on different event queues would race on the index
+    if (inParallelMode) {
+        m_functional_index_valid.store(false, std::memory_order_relaxed);
+        return;
+    }
+
+    auto it = m_functional_index.find(line_addr);
+    if (may_hold) {
+        if (it == m_functional_index.end())
+            it = m_functional_index.try_emplace(line_addr).first;
+        auto &holders = it->second;
+        if (std::find(holders.begin(), holders.end(), cntrl) == holders.end())
+            holders.push_back(cntrl);
+    } else if (it != m_functional_index.end()) {
+        auto &holders = it->second;
+        auto holder = std::find(holders.begin(), holders.end(), cntrl);
+        if (holder != holders.end()) {
+            *holder = holders.back();
+            holders.pop_back();
+            if (holders.empty())
+                m_functional_index.erase(it);
+        }
+    }
+}
+
+const std::vector<AbstractController *> *
+RubySystem::functionalHolders(Addr line_addr) const
+{
+    static const std::vector<AbstractController *> none;
+
+    if (!m_functional_index_enabled ||
+        !m_functional_index_valid.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    auto it = m_functional_index.find(line_addr);
+    return it == m_functional_index.end() ? &none : &it->second;
+}
+
+AccessPermission
+RubySystem::functionalPermission(
+    AbstractController *cntrl, Addr line_addr,
+    const std::vector<AbstractController *> *holders) const
+{
+    if (holders && cntrl->functionallyIndexed() &&
+        std::find(holders->begin(), holders->end(), cntrl) == holders->end()) {
+        return AccessPermission_NotPresent;
+    }
+    return cntrl->getAccessPermission(line_addr);
+}
+
 bool
 RubySystem::functionalRead(PacketPtr pkt) {
     if (protocolInfo->getPartialFuncReads()) {
@@ -539,11 +606,12 @@ RubySystem::simpleFunctionalRead(PacketPtr pkt)
     AbstractController *ctrl_rw = nullptr;
     AbstractController *ctrl_ms = nullptr;
     AbstractController *ctrl_backing_store = nullptr;
+    const auto *holders = functionalHolders(line_address);
 
     // In this loop we count the number of controllers that have the given
     // address in read only, read write and busy states.
     for (auto& cntrl : netCntrls[request_net_id]) {
-        access_perm = cntrl-> getAccessPermission(line_address);
+        access_perm = functionalPermission(cntrl, line_address, holders);
         if (access_perm == AccessPermission_Read_Only){
             num_ro++;
             if (ctrl_ro == nullptr) ctrl_ro = cntrl;
@@ -667,10 +735,11 @@ RubySystem::partialFunctionalRead(PacketPtr pkt)
     std::vector<AbstractController*> ctrl_others;
     AbstractController *ctrl_rw = nullptr;
     AbstractController *ctrl_bs = nullptr;
+    const auto *holders = functionalHolders(line_address);
 
     // Build lists of controllers that have line
     for (auto ctrl : m_abs_cntrl_vec) {
-        switch(ctrl->getAccessPermission(line_address)) {
+        switch(functionalPermission(ctrl, line_address, holders)) {
             case AccessPermission_Read_Only:
                 ctrl_ro.push_back(ctrl);
                 break;
@@ -770,11 +839,12 @@ RubySystem::functionalWrite(PacketPtr pkt)
     assert(requestorToNetwork.count(pkt->requestorId()));
     int request_net_id = requestorToNetwork[pkt->requestorId()];
     assert(netCntrls.count(request_net_id));
+    const auto *holders = functionalHolders(line_addr);
 
     for (auto& cntrl : netCntrls[request_net_id]) {
         num_functional_writes += cntrl->functionalWriteBuffers(pkt);
 
-        access_perm = cntrl->getAccessPermission(line_addr);
+        access_perm = functionalPermission(cntrl, line_addr, holders);
         if (access_perm != AccessPermission_Invalid &&
             access_perm != AccessPermission_NotPresent) {
             num_functional_writes +=
@@ -35,7 +35,9 @@
 #ifndef __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 #define __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 
+#include <atomic>
 #include <unordered_map>
+#include <vector>
 
 #include "base/callback.hh"
 #include "base/output.hh"
@@ -79,6 +81,7 @@ class RubySystem : public ClockedObject
     memory::SimpleMemory *getPhysMem() { return m_phys_mem; }
     Cycles getStartCycle() { return m_start_cycle; }
     bool getAccessBackingStore() { return m_access_backing_store; }
+    bool getFunctionalIndexEnabled() { return m_functional_index_enabled; }
 
     // Public Methods
     Profiler*
@@ -97,6 +100,9 @@ class RubySystem : public ClockedObject
     void memWriteback() override;
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+    // The contents of the caches are written back to memory when
+    // checkpointing
+    bool hasArchitecturalState() const override { return false; }
     void drainResume() override;
     void process();
     void init() override;
@@ -104,6 +110,17 @@ class RubySystem : public ClockedObject
     bool functionalRead(Packet *ptr);
     bool functionalWrite(Packet *ptr);
 
+    /**
+     * Record whether a controller may hold a copy of a line after a
+     * transition on it. Only the controllers which are functionally
+     * indexed (see AbstractController::functionalIndexable()) report
+     * their lines, and functional accesses only ask those that may hold
+     * the line. The index is given up for the rest of the simulation when
+     * transitions happen in parallel.
+     */
+    void updateFunctionalIndex(AbstractController *cntrl, Addr line_addr,
+                               bool may_hold);
+
     void registerNetwork(Network*);
     void registerAbstractController(
         AbstractController*, std::unique_ptr<ProtocolInfo>
@@ -143,17 +160,36 @@ class RubySystem : public ClockedObject
     bool simpleFunctionalRead(PacketPtr pkt);
     bool partialFunctionalRead(PacketPtr pkt);
 
+    /**
+     * The indexed controllers that may hold a copy of a line, or nullptr
+     * when the index cannot be used and every controller has to be asked.
+     */
+    const std::vector<AbstractController *> *
+    functionalHolders(Addr line_addr) const;
+
+    AccessPermission functionalPermission(
+        AbstractController *cntrl, Addr line_addr,
+        const std::vector<AbstractController *> *holders) const;
+
   private:
     // configuration parameters
     bool m_randomization;
     uint32_t m_block_size_bytes;
     uint32_t m_block_size_bits;
     uint32_t m_memory_size_bits;
+    unsigned m_warmup_window;
 
     bool m_warmup_enabled = false;
     bool m_cooldown_enabled = false;
     memory::SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const bool m_functional_index_enabled;
+
+    // Lines held by the functionally indexed controllers, and whether the
+    // index is still up to date.
+    std::unordered_map<Addr, std::vector<AbstractController *>>
+        m_functional_index;
+    std::atomic<bool> m_functional_index_valid{true};
 
     //std::vector<Network *> m_networks;
     std::vector<std::unique_ptr<Network>> m_networks;
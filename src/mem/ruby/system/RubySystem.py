@@ -48,6 +48,13 @@ class RubySystem(ClockedObject):
         64, "number of bits that a memory address requires"
     )
 
+    warmup_window = Param.Unsigned(
+        1,
+        "maximum number of cache warmup requests outstanding at once when "
+        "restoring the Ruby caches from a checkpoint; 1 replays the trace "
+        "strictly in order",
+    )
+
     phys_mem = Param.SimpleMemory(NULL, "")
     system = Param.System(Parent.any, "system object")
 
@@ -56,9 +63,19 @@ class RubySystem(ClockedObject):
         "Use phys_mem as the functional \
         store and only use ruby for timing.",
     )
+    functional_index = Param.Bool(
+        True,
+        "Track the lines held by the caches so that functional accesses "
+        "only ask the controllers that may have a copy",
+    )
 
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
+    hot_lines_entries = Param.Unsigned(
+        0,
+        "Maximum number of addresses tracked by each address profile, "
+        "keeping the most accessed ones (0 for no limit)",
+    )
     num_of_sequencers = Param.Int("")
     number_of_virtual_networks = Param.Unsigned("")
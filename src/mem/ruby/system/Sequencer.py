@@ -156,3 +156,6 @@ class DMASequencer(RubyPort):
     cxx_class = "gem5::ruby::DMASequencer"
 
     max_outstanding_requests = Param.Int(64, "max outstanding requests")
+    max_outstanding_lines = Param.Int(
+        1, "max cache lines in flight per DMA request"
+    )
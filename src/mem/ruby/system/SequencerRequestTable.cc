@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/system/SequencerRequestTable.hh"
+
+#include "base/intmath.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace
+{
+
+constexpr size_t minIndexSize = 16;
+
+} // anonymous namespace
+
+SequencerRequestTable::SequencerRequestTable()
+{
+    rehash(minIndexSize);
+}
+
+int
+SequencerRequestTable::find(Addr line_addr) const
+{
+    for (size_t b = home(line_addr); m_index[b] != invalid;
+         b = (b + 1) & m_index_mask) {
+        if (m_entries[m_index[b]].line == line_addr)
+            return b;
+    }
+    return invalid;
+}
+
+void
+SequencerRequestTable::rehash(size_t size)
+{
+    std::vector<int> old_index(size, invalid);
+    m_index.swap(old_index);
+    m_index_mask = size - 1;
+    m_hash_shift = 64 - floorLog2(size);
+    for (int head : old_index) {
+        if (head == invalid)
+            continue;
+        size_t b = home(m_entries[head].line);
+        while (m_index[b] != invalid)
+            b = (b + 1) & m_index_mask;
+        m_index[b] = head;
+    }
+}
+
+int
+SequencerRequestTable::emplace(Addr line_addr, PacketPtr pkt,
+                               RubyRequestType primary_type,
+                               RubyRequestType secondary_type,
+                               Cycles issue_time)
+{
+    int entry;
+    if (!m_free_entries.empty()) {
+        entry = m_free_entries.back();
+        m_free_entries.pop_back();
+    } else {
+        entry = m_entries.size();
+        m_entries.emplace_back();
+    }
+
+    Entry &e = m_entries[entry];
+    e.req.emplace(pkt, primary_type, secondary_type, issue_time);
+    e.line = line_addr;
+    e.next = invalid;
+    e.tail = entry;
+    e.count = 1;
+
+    // Requests are issued in cycle order, so appending keeps the age
+    // list sorted by issue time
+    assert(m_newest == invalid ||
+           m_entries[m_newest].req->issue_time <= issue_time);
+    e.older = m_newest;
+    e.newer = invalid;
+    if (m_newest != invalid)
+        m_entries[m_newest].newer = entry;
+    else
+        m_oldest = entry;
+    m_newest = entry;
+    ++m_size;
+
+    int bucket = find(line_addr);
+    if (bucket != invalid) {
+        Entry &head = m_entries[m_index[bucket]];
+        m_entries[head.tail].next = entry;
+        head.tail = entry;
+        return ++head.count;
+    }
+
+    // Keep the index at most half full so probe sequences stay short
+    if (++m_lines * 2 > m_index.size())
+        rehash(m_index.size() * 2);
+    size_t b = home(line_addr);
+    while (m_index[b] != invalid)
+        b = (b + 1) & m_index_mask;
+    m_index[b] = entry;
+    return 1;
+}
+
+SequencerRequest *
+SequencerRequestTable::front(Addr line_addr)
+{
+    int bucket = find(line_addr);
+    if (bucket == invalid)
+        return nullptr;
+    return &*m_entries[m_index[bucket]].req;
+}
+
+int
+SequencerRequestTable::lineCount(Addr line_addr) const
+{
+    int bucket = find(line_addr);
+    return bucket == invalid ? 0 : m_entries[m_index[bucket]].count;
+}
+
+const SequencerRequest *
+SequencerRequestTable::oldest() const
+{
+    return m_oldest == invalid ? nullptr : &*m_entries[m_oldest].req;
+}
+
+void
+SequencerRequestTable::unlinkAge(int entry)
+{
+    Entry &e = m_entries[entry];
+    if (e.older != invalid)
+        m_entries[e.older].newer = e.newer;
+    else
+        m_oldest = e.newer;
+    if (e.newer != invalid)
+        m_entries[e.newer].older = e.older;
+    else
+        m_newest = e.older;
+}
+
+void
+SequencerRequestTable::popFront(Addr line_addr)
+{
+    int bucket = find(line_addr);
+    assert(bucket != invalid);
+    int entry = m_index[bucket];
+    Entry &e = m_entries[entry];
+
+    if (e.next != invalid) {
+        // The next request becomes the head; its line hashes to the
+        // same bucket so the index only needs the new entry number
+        Entry &next = m_entries[e.next];
+        next.tail = e.tail;
+        next.count = e.count - 1;
+        m_index[bucket] = e.next;
+    } else {
+        // Backward-shift deletion: pull later members of the probe run
+        // into the hole so lookups never need tombstones
+        size_t hole = bucket;
+        size_t b = hole;
+        while (true) {
+            b = (b + 1) & m_index_mask;
+            if (m_index[b] == invalid)
+                break;
+            size_t h = home(m_entries[m_index[b]].line);
+            bool movable = (hole <= b) ? (h <= hole || h > b)
+                                       : (h <= hole && h > b);
+            if (movable) {
+                m_index[hole] = m_index[b];
+                hole = b;
+            }
+        }
+        m_index[hole] = invalid;
+        --m_lines;
+    }
+
+    unlinkAge(entry);
+    e.req.reset();
+    m_free_entries.push_back(entry);
+    --m_size;
+}
+
+void
+SequencerRequestTable::print(std::ostream &out) const
+{
+    for (int head : m_index) {
+        if (head == invalid)
+            continue;
+        out << "[ " << m_entries[head].line << " =";
+        for (int i = head; i != invalid; i = m_entries[i].next) {
+            out << " "
+                << RubyRequestType_to_string(m_entries[i].req->m_second_type);
+        }
+    }
+    out << " ]";
+}
+
+} // namespace ruby
+} // namespace gem5
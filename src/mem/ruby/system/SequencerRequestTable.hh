@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_SYSTEM_SEQUENCERREQUESTTABLE_HH__
+#define __MEM_RUBY_SYSTEM_SEQUENCERREQUESTTABLE_HH__
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <optional>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/packet.hh"
+#include "mem/ruby/common/Address.hh"
+#include "mem/ruby/protocol/RubyRequestType.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+struct SequencerRequest
+{
+    PacketPtr pkt;
+    RubyRequestType m_type;
+    RubyRequestType m_second_type;
+    Cycles issue_time;
+    SequencerRequest(PacketPtr _pkt, RubyRequestType _m_type,
+                     RubyRequestType _m_second_type, Cycles _issue_time)
+                : pkt(_pkt), m_type(_m_type), m_second_type(_m_second_type),
+                  issue_time(_issue_time)
+    {}
+
+    bool functionalWrite(Packet *func_pkt) const
+    {
+        // Follow-up on RubyRequest::functionalWrite
+        // This makes sure the hitCallback won't overrite the value we
+        // expect to find
+        assert(func_pkt->isWrite());
+        return func_pkt->trySatisfyFunctional(pkt);
+    }
+};
+
+std::ostream& operator<<(std::ostream& out, const SequencerRequest& obj);
+
+/**
+ * Outstanding sequencer requests, queued in arrival order per cache line.
+ *
+ * Requests are kept in a slab of entries that is only ever appended to,
+ * so a reference to a request stays valid until it is popped, and freed
+ * entries are recycled instead of going back to the heap. Each line's
+ * queue is a singly linked list through the slab, found through an
+ * open-addressing index on the line address.
+ *
+ * All requests are also threaded on an age list in issue order. Every
+ * request times out after the same number of cycles, so the oldest
+ * outstanding request is always at the head of that list and the
+ * deadlock check only has to look at one entry.
+ */
+class SequencerRequestTable
+{
+  public:
+    SequencerRequestTable();
+
+    /**
+     * Append a request to the queue of its line.
+     *
+     * @return The number of requests queued for the line, including the
+     *         new one.
+     */
+    int emplace(Addr line_addr, PacketPtr pkt, RubyRequestType primary_type,
+                RubyRequestType secondary_type, Cycles issue_time);
+
+    /** Oldest request for a line, or nullptr if none is queued. */
+    SequencerRequest *front(Addr line_addr);
+
+    /** Remove the oldest request for a line. */
+    void popFront(Addr line_addr);
+
+    bool contains(Addr line_addr) const { return find(line_addr) != invalid; }
+    bool empty() const { return m_size == 0; }
+    int size() const { return m_size; }
+
+    /** Request with the earliest issue time, or nullptr if empty. */
+    const SequencerRequest *oldest() const;
+
+    /** Number of requests queued for a line. */
+    int lineCount(Addr line_addr) const;
+
+    /** Visit every request in issue order. */
+    template <typename F>
+    void
+    forEach(F &&f) const
+    {
+        for (int i = m_oldest; i != invalid; i = m_entries[i].newer)
+            f(*m_entries[i].req);
+    }
+
+    void print(std::ostream &out) const;
+
+  private:
+    static constexpr int invalid = -1;
+
+    struct Entry
+    {
+        // Empty while the entry is on the free list
+        std::optional<SequencerRequest> req;
+        Addr line = 0;
+        // Next request for the same line
+        int next = invalid;
+        // Last request and queue length; only valid at the line's head
+        int tail = invalid;
+        int count = 0;
+        // Neighbours on the age list
+        int older = invalid;
+        int newer = invalid;
+    };
+
+    size_t
+    home(Addr line_addr) const
+    {
+        // Fibonacci hashing spreads consecutive lines over the index.
+        // The top bits of the product depend on every bit of the key,
+        // so the always-zero offset bits need not be shifted out.
+        return (uint64_t(line_addr) * 0x9e3779b97f4a7c15ULL) >> m_hash_shift;
+    }
+
+    /** Index bucket holding the head of a line, or invalid. */
+    int find(Addr line_addr) const;
+    void rehash(size_t size);
+    void unlinkAge(int entry);
+
+    std::deque<Entry> m_entries;
+    std::vector<int> m_free_entries;
+
+    // Head entry of each line's queue, or invalid
+    std::vector<int> m_index;
+    size_t m_index_mask = 0;
+    int m_hash_shift = 64;
+    int m_lines = 0;
+
+    int m_oldest = invalid;
+    int m_newest = invalid;
+    int m_size = 0;
+};
+
+inline std::ostream &
+operator<<(std::ostream &out, const SequencerRequestTable &obj)
+{
+    obj.print(out);
+    out << std::flush;
+    return out;
+}
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_SYSTEM_SEQUENCERREQUESTTABLE_HH__
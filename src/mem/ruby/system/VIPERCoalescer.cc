@@ -157,9 +157,9 @@ VIPERCoalescer::issueRequest(CoalescedRequest* crequest)
             accessMask[tmpOffset + j] = true;
         }
     }
-    std::shared_ptr<RubyRequest> msg;
+    RefCountingPtr<RubyRequest> msg;
     if (pkt->isAtomicOp()) {
-        msg = std::make_shared<RubyRequest>(clockEdge(), blockSize,
+        msg = makeMessage<RubyRequest>(clockEdge(), blockSize,
                               m_ruby_system, pkt->getAddr(), pkt->getSize(),
                               pc, crequest->getRubyType(),
                               RubyAccessMode_Supervisor, pkt,
@@ -167,7 +167,7 @@ VIPERCoalescer::issueRequest(CoalescedRequest* crequest)
                               blockSize, accessMask,
                               dataBlock, atomicOps, crequest->getSeqNum());
     } else {
-        msg = std::make_shared<RubyRequest>(clockEdge(), blockSize,
+        msg = makeMessage<RubyRequest>(clockEdge(), blockSize,
                               m_ruby_system, pkt->getAddr(), pkt->getSize(),
                               pc, crequest->getRubyType(),
                               RubyAccessMode_Supervisor, pkt,
@@ -299,7 +299,7 @@ VIPERCoalescer::invTCP()
         Addr addr = m_dataCache_ptr->getAddressAtIdx(i);
         // Evict Read-only data
         RubyRequestType request_type = RubyRequestType_REPLACEMENT;
-        std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+        RefCountingPtr<RubyRequest> msg = makeMessage<RubyRequest>(
             clockEdge(), m_ruby_system->getBlockSizeBytes(), m_ruby_system,
             addr, 0, 0, request_type, RubyAccessMode_Supervisor, nullptr);
         DPRINTF(GPUCoalescer, "Evicting addr 0x%x\n", addr);
@@ -347,7 +347,7 @@ VIPERCoalescer::invTCC(PacketPtr pkt)
     Addr addr = pkt->req->getPaddr();
     RubyRequestType request_type = RubyRequestType_InvL2;
 
-    std::shared_ptr<RubyRequest> msg = std::make_shared<RubyRequest>(
+    RefCountingPtr<RubyRequest> msg = makeMessage<RubyRequest>(
         clockEdge(), m_ruby_system->getBlockSizeBytes(), m_ruby_system,
         addr, 0, 0, request_type, RubyAccessMode_Supervisor, nullptr);
 
@@ -79,7 +79,7 @@ SimpleMemory::recvAtomic(PacketPtr pkt)
              "is responding");
 
     access(pkt);
-    return getLatency();
+    return getLatency(pkt);
 }
 
 Tick
@@ -171,7 +171,7 @@ SimpleMemory::recvTimingReq(PacketPtr pkt)
         // atomic response
         assert(pkt->isResponse());
 
-        Tick when_to_send = curTick() + receive_delay + getLatency();
+        Tick when_to_send = curTick() + receive_delay + getLatency(pkt);
 
         // typically this should be added at the end, so start the
         // insertion sort with the last element, also make sure not to
@@ -234,7 +234,7 @@ SimpleMemory::dequeue()
 }
 
 Tick
-SimpleMemory::getLatency() const
+SimpleMemory::getLatency(const PacketPtr pkt)
 {
     return latency +
         (latency_var ? rng->random<Tick>(0, latency_var) : 0);
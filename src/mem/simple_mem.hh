@@ -169,13 +169,6 @@ class SimpleMemory : public AbstractMemory
 
     EventFunctionWrapper dequeueEvent;
 
-    /**
-     * Detemine the latency.
-     *
-     * @return the latency seen by the current packet
-     */
-    Tick getLatency() const;
-
     /**
      * Upstream caches need this packet until true is returned, so
      * hold it for deletion until a subsequent call
@@ -193,6 +186,14 @@ class SimpleMemory : public AbstractMemory
     void init() override;
 
   protected:
+    /**
+     * Detemine the latency.
+     *
+     * @param pkt the packet being serviced
+     * @return the latency seen by the current packet
+     */
+    virtual Tick getLatency(const PacketPtr pkt);
+
     Tick recvAtomic(PacketPtr pkt);
     Tick recvAtomicBackdoor(PacketPtr pkt, MemBackdoorPtr &_backdoor);
     void recvFunctional(PacketPtr pkt);
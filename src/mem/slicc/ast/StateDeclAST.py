@@ -67,6 +67,9 @@ class StateDeclAST(DeclAST):
             self.state_machine,
         )
         self.symtab.newSymbol(t)
+        machine = self.symtab.state_machine
+        if machine:
+            machine.StateType = t
 
         # Add all of the states of the type to it
         for state in self.states:
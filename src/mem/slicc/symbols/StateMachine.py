@@ -125,6 +125,7 @@ class StateMachine(Symbol):
         self.objects = []
         self.TBEType = None
         self.EntryType = None
+        self.StateType = None
         # Python's sets are not sorted so we have to be careful when using
         # this to generate deterministic output.
         self.debug_flags = set()
@@ -258,7 +259,7 @@ class StateMachine(Symbol):
         self.printControllerPython(path)
         self.printControllerHH(path)
         self.printControllerCC(path, includes)
-        self.printCSwitch(path)
+        self.printCSwitch(path, includes)
         self.printCWakeup(path, includes)
 
     def printControllerPython(self, path):
@@ -417,6 +418,7 @@ class $c_ident : public AbstractController
     bool functionalReadBuffers(PacketPtr&);
     bool functionalReadBuffers(PacketPtr&, WriteMask&);
     int functionalWriteBuffers(PacketPtr&);
+    bool functionalIndexable() const override;
 
     void countTransition(${ident}_State state, ${ident}_Event event);
     void possibleTransition(${ident}_State state, ${ident}_Event event);
@@ -584,12 +586,9 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
 
         code.write(path, f"{gen_filename}.hh")
 
-    def printControllerCC(self, path, includes):
-        """Output the actions for performing the actions"""
+    def printActionIncludes(self, code, includes):
+        """Output the includes needed by the controller's actions"""
 
-        code = self.symtab.codeFormatter()
-        ident = self.ident
-        c_ident = f"{self.ident}_Controller"
         gen_filename = f"{self.symtab.slicc.protocol}/{self.ident}"
 
         # Unfortunately, clang compilers will throw a "call to function ...
@@ -617,21 +616,6 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
 
 """
 
-        code(
-            """
-// Created by slicc definition of Module "${{self.short}}"
-
-#include <sys/types.h>
-#include <unistd.h>
-
-#include <cassert>
-#include <sstream>
-#include <string>
-#include <typeinfo>
-
-"""
-        )
-
         code(boolvec_include)
         code(base_include)
         # We have to sort self.debug_flags in order to produce deterministic
@@ -670,6 +654,112 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
                     )
             seen_types.add(var.type.ident)
 
+    def printActions(self, code):
+        """Output the definitions of the controller's actions"""
+
+        ident = self.ident
+        c_ident = f"{self.ident}_Controller"
+
+        if self.TBEType != None and self.EntryType != None:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, ${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    try {
+       ${{action["c_code"]}}
+    } catch (const RejectException & e) {
+       fatal("Error in action ${{ident}}:${{action.ident}}: "
+             "executed a peek statement with the wrong message "
+             "type specified. ");
+    }
+}
+
+"""
+                )
+        elif self.TBEType != None:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    ${{action["c_code"]}}
+}
+
+"""
+                )
+        elif self.EntryType != None:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    ${{action["c_code"]}}
+}
+
+"""
+                )
+        else:
+            for action in self.actions.values():
+                if "c_code" not in action:
+                    continue
+
+                code(
+                    """
+/** \\brief ${{action.desc}} */
+void
+$c_ident::${{action.ident}}(Addr addr)
+{
+    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
+    ${{action["c_code"]}}
+}
+
+"""
+                )
+
+    def printControllerCC(self, path, includes):
+        """Output the controller implementation, except for the actions"""
+
+        code = self.symtab.codeFormatter()
+        ident = self.ident
+        c_ident = f"{self.ident}_Controller"
+        gen_filename = f"{self.symtab.slicc.protocol}/{self.ident}"
+
+        code(
+            """
+// Created by slicc definition of Module "${{self.short}}"
+
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+
+"""
+        )
+
+        self.printActionIncludes(code, includes)
+
         num_in_ports = len(self.in_ports)
 
         code(
@@ -1304,83 +1394,8 @@ $c_ident::recordCacheTrace(int cntrl, CacheRecorder* tr)
             """
 }
 
-// Actions
 """
         )
-        if self.TBEType != None and self.EntryType != None:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, ${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    try {
-       ${{action["c_code"]}}
-    } catch (const RejectException & e) {
-       fatal("Error in action ${{ident}}:${{action.ident}}: "
-             "executed a peek statement with the wrong message "
-             "type specified. ");
-    }
-}
-
-"""
-                )
-        elif self.TBEType != None:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(${{self.TBEType.c_ident}}*& m_tbe_ptr, Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    ${{action["c_code"]}}
-}
-
-"""
-                )
-        elif self.EntryType != None:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(${{self.EntryType.c_ident}}*& m_cache_entry_ptr, Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    ${{action["c_code"]}}
-}
-
-"""
-                )
-        else:
-            for action in self.actions.values():
-                if "c_code" not in action:
-                    continue
-
-                code(
-                    """
-/** \\brief ${{action.desc}} */
-void
-$c_ident::${{action.ident}}(Addr addr)
-{
-    DPRINTF(RubyGenerated, "executing ${{action.ident}}\\n");
-    ${{action["c_code"]}}
-}
-
-"""
-                )
         for func in self.functions:
             code(func.generateCode())
 
@@ -1412,6 +1427,36 @@ $c_ident::functionalWriteBuffers(PacketPtr& pkt)
 """
         )
 
+        # Lines in the default state are not held when that state has no
+        # permission, then only transitions can make the controller hold
+        # a line
+        code(
+            """
+bool
+$c_ident::functionalIndexable() const
+{
+"""
+        )
+        if self.StateType is not None and "default" in self.StateType:
+            default_state = self.StateType["default"]
+            code(
+                """
+    AccessPermission perm = ${ident}_State_to_permission($default_state);
+    return perm == AccessPermission_Invalid ||
+        perm == AccessPermission_NotPresent;
+}
+
+"""
+            )
+        else:
+            code(
+                """
+    return false;
+}
+
+"""
+            )
+
         # Function for functional reads to messages buffered in the controller
         code(
             """
@@ -1628,8 +1673,12 @@ ${ident}_Controller::wakeup()
 
         code.write(path, f"{gen_filename}_Wakeup.cc")
 
-    def printCSwitch(self, path):
-        """Output switch statement for transition table"""
+    def printCSwitch(self, path, includes):
+        """Output switch statement for transition table
+
+        The actions are defined in the same file as the switch so that the
+        compiler can inline them into the transitions that use them.
+        """
 
         code = self.symtab.codeFormatter()
         ident = self.ident
@@ -1640,16 +1689,18 @@ ${ident}_Controller::wakeup()
 // ${ident}: ${{self.short}}
 
 #include <cassert>
+#include <sstream>
 
+"""
+        )
+        # BoolVec.hh has to come before anything that pulls in cprintf.hh
+        self.printActionIncludes(code, includes)
+        code(
+            """
 #include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/ProtocolTrace.hh"
 #include "debug/RubyGenerated.hh"
-#include "mem/ruby/protocol/${gen_filename}_Controller.hh"
-#include "mem/ruby/protocol/${gen_filename}_Event.hh"
-#include "mem/ruby/protocol/${gen_filename}_State.hh"
-#include "mem/ruby/protocol/${protocol}/Types.hh"
-#include "mem/ruby/system/RubySystem.hh"
 
 #define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
 
@@ -1665,6 +1716,18 @@ namespace ruby
 namespace ${protocol}
 {
 
+#ifndef NDEBUG
+#define APPEND_TRANSITION_COMMENT(str) (${ident}_transitionComment << str)
+#else
+#define APPEND_TRANSITION_COMMENT(str) do {} while (0)
+#endif
+
+// Actions
+"""
+        )
+        self.printActions(code)
+        code(
+            """
 TransitionResult
 ${ident}_Controller::doTransition(${ident}_Event event,
 """
@@ -1731,7 +1794,7 @@ TransitionResult result =
         code(
             """
 
-if (result == TransitionResult_Valid) {
+if (GEM5_LIKELY(result == TransitionResult_Valid)) {
     DPRINTF(RubyGenerated, "next_state: %s\\n",
             ${ident}_State_to_string(next_state));
     countTransition(state, event);
@@ -1758,6 +1821,9 @@ if (result == TransitionResult_Valid) {
         else:
             code("setState(addr, next_state);")
             code("setAccessPermission(addr, next_state);")
+        code(
+            "updateFunctionalIndex(addr, ${ident}_State_to_permission(next_state));"
+        )
 
         code(
             """
@@ -1855,7 +1921,7 @@ ${ident}_Controller::doTransitionWorker(${ident}_Event event,
             res = trans.resources
             for key, val in res.items():
                 val = f"""
-if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
+if (GEM5_UNLIKELY(!{key.code}.areNSlotsAvailable({val}, clockEdge())))
     return TransitionResult_ResourceStall;
 """
                 case_sorter.append(val)
@@ -1863,7 +1929,7 @@ if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
             # Check all of the request_types for resource constraints
             for request_type in request_types:
                 val = """
-if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
+if (GEM5_UNLIKELY(!checkResourceAvailable({}_RequestType_{}, addr))) {{
     return TransitionResult_ResourceStall;
 }}
 """.format(
@@ -63,7 +63,7 @@ SnoopFilter::eraseIfNullEntry(SnoopFilterCache::iterator& sf_it)
     }
 }
 
-std::pair<SnoopFilter::SnoopList, Cycles>
+std::pair<SnoopFilter::SnoopTargets, Cycles>
 SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
                            cpu_side_port)
 {
@@ -113,8 +113,7 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
 
     // If we are not allocating, we are done
     if (!allocate)
-        return snoopSelected(maskToPortList(interested & ~req_port),
-                             lookupLatency);
+        return snoopSelected(interested & ~req_port, lookupLatency);
 
     if (cpkt->needsResponse()) {
         if (!cpkt->cacheResponding()) {
@@ -153,7 +152,7 @@ SnoopFilter::lookupRequest(const Packet* cpkt, const ResponsePort&
         }
     }
 
-    return snoopSelected(maskToPortList(interested & ~req_port), lookupLatency);
+    return snoopSelected(interested & ~req_port, lookupLatency);
 }
 
 void
@@ -180,7 +179,7 @@ SnoopFilter::finishRequest(bool will_retry, Addr addr, bool is_secure)
     }
 }
 
-std::pair<SnoopFilter::SnoopList, Cycles>
+std::pair<SnoopFilter::SnoopTargets, Cycles>
 SnoopFilter::lookupSnoop(const Packet* cpkt)
 {
     DPRINTF(SnoopFilter, "%s: packet %s\n", __func__, cpkt->print());
@@ -237,7 +236,7 @@ SnoopFilter::lookupSnoop(const Packet* cpkt)
         eraseIfNullEntry(sf_it);
     }
 
-    return snoopSelected(maskToPortList(interested), lookupLatency);
+    return snoopSelected(interested, lookupLatency);
 }
 
 void
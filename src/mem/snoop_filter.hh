@@ -95,12 +95,93 @@ class SnoopFilter : public SimObject
 
     typedef std::vector<QueuedResponsePort*> SnoopList;
 
+    /**
+     * The underlying type for the bitmask we use for tracking. This
+     * limits the number of snooping ports supported per crossbar.
+     */
+    typedef std::bitset<SNOOP_MASK_SIZE> SnoopMask;
+
+    /**
+     * The ports a lookup selected, as a bitmask over the snooping
+     * CPU-side ports. This is what the lookups return rather than a
+     * SnoopList, so that no list has to be built for every
+     * request. The targets can be iterated like a SnoopList, but do
+     * not outlive the snoop filter.
+     */
+    class SnoopTargets
+    {
+      public:
+        class const_iterator
+        {
+          public:
+            const_iterator(const SnoopTargets &_targets, size_t _idx)
+                : targets(_targets), idx(_idx)
+            {
+                skip();
+            }
+
+            QueuedResponsePort *
+            operator*() const
+            {
+                return (*targets.ports)[idx];
+            }
+
+            const_iterator &
+            operator++()
+            {
+                ++idx;
+                skip();
+                return *this;
+            }
+
+            bool
+            operator!=(const const_iterator &other) const
+            {
+                return idx != other.idx;
+            }
+
+          private:
+            /** Advance to the next selected port, or the end */
+            void
+            skip()
+            {
+                while (idx < targets.ports->size() && !targets.mask[idx])
+                    ++idx;
+            }
+
+            const SnoopTargets &targets;
+            size_t idx;
+        };
+
+        SnoopTargets(const SnoopList &_ports, const SnoopMask &_mask)
+            : ports(&_ports), mask(_mask)
+        {}
+
+        const_iterator begin() const { return const_iterator(*this, 0); }
+        const_iterator
+        end() const
+        {
+            return const_iterator(*this, ports->size());
+        }
+
+        size_t size() const { return mask.count(); }
+        bool empty() const { return mask.none(); }
+
+      private:
+        /** The snooping ports, indexed like the bits of the mask */
+        const SnoopList *ports;
+        SnoopMask mask;
+    };
+
     SnoopFilter (const SnoopFilterParams &p) :
         SimObject(p), reqLookupResult(cachedLocations.end()),
         linesize(p.system->cacheLineSize()), lookupLatency(p.lookup_latency),
         maxEntryCount(p.max_capacity / p.system->cacheLineSize()),
         stats(this)
     {
+        // allocate the buckets for the full capacity up front, the
+        // table is then never rehashed while the simulation runs
+        cachedLocations.reserve(maxEntryCount);
     }
 
     /**
@@ -137,9 +218,9 @@ class SnoopFilter : public SimObject
      *
      * @param cpkt              Pointer to the request packet. Not changed.
      * @param cpu_side_port     Response port where the request came from.
-     * @return Pair of a vector of snoop target ports and lookup latency.
+     * @return Pair of the snoop target ports and lookup latency.
      */
-    std::pair<SnoopList, Cycles> lookupRequest(const Packet* cpkt,
+    std::pair<SnoopTargets, Cycles> lookupRequest(const Packet* cpkt,
                                         const ResponsePort& cpu_side_port);
 
     /**
@@ -159,10 +240,10 @@ class SnoopFilter : public SimObject
      * additional steering thanks to the snoop filter.
      *
      * @param cpkt Pointer to const Packet containing the snoop.
-     * @return Pair with a vector of ResponsePorts that need snooping and a
+     * @return Pair with the ResponsePorts that need snooping and a
      * lookup latency.
      */
-    std::pair<SnoopList, Cycles> lookupSnoop(const Packet* cpkt);
+    std::pair<SnoopTargets, Cycles> lookupSnoop(const Packet* cpkt);
 
     /**
      * Let the snoop filter see any snoop responses that turn into
@@ -204,12 +285,6 @@ class SnoopFilter : public SimObject
 
   protected:
 
-    /**
-     * The underlying type for the bitmask we use for tracking. This
-     * limits the number of snooping ports supported per crossbar.
-     */
-    typedef std::bitset<SNOOP_MASK_SIZE> SnoopMask;
-
     /**
     * Per cache line item tracking a bitmask of ResponsePorts who have an
     * outstanding request to this line (requested) or already share a
@@ -228,19 +303,22 @@ class SnoopFilter : public SimObject
     /**
      * Simple factory methods for standard return values.
      */
-    std::pair<SnoopList, Cycles> snoopAll(Cycles latency) const
+    std::pair<SnoopTargets, Cycles> snoopAll(Cycles latency) const
     {
-        return std::make_pair(cpuSidePorts, latency);
+        // only the bits of the snooping ports we actually have
+        SnoopMask all = SnoopMask().set() >>
+            (SNOOP_MASK_SIZE - cpuSidePorts.size());
+        return std::make_pair(SnoopTargets(cpuSidePorts, all), latency);
     }
-    std::pair<SnoopList, Cycles> snoopSelected(const SnoopList&
-                                _cpu_side_ports, Cycles latency) const
+    std::pair<SnoopTargets, Cycles> snoopSelected(SnoopMask ports,
+                                                  Cycles latency) const
     {
-        return std::make_pair(_cpu_side_ports, latency);
+        return std::make_pair(SnoopTargets(cpuSidePorts, ports), latency);
     }
-    std::pair<SnoopList, Cycles> snoopDown(Cycles latency) const
+    std::pair<SnoopTargets, Cycles> snoopDown(Cycles latency) const
     {
-        SnoopList empty;
-        return std::make_pair(empty , latency);
+        return std::make_pair(SnoopTargets(cpuSidePorts, SnoopMask()),
+                              latency);
     }
 
     /**
@@ -345,9 +423,8 @@ inline SnoopFilter::SnoopList
 SnoopFilter::maskToPortList(SnoopMask port_mask) const
 {
     SnoopList res;
-    for (const auto& p : cpuSidePorts)
-        if ((port_mask & portToMask(*p)).any())
-            res.push_back(p);
+    for (auto p : SnoopTargets(cpuSidePorts, port_mask))
+        res.push_back(p);
     return res;
 }
 
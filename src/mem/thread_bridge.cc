@@ -27,6 +27,7 @@
 
 #include "mem/thread_bridge.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "sim/eventq.hh"
 
@@ -34,10 +35,112 @@ namespace gem5
 {
 
 ThreadBridge::ThreadBridge(const ThreadBridgeParams &p)
-    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this)
+    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this),
+      inEventq(getEventQueue(p.in_eventq_index)), delay(p.delay),
+      reqCrossing(true), respCrossing(false), numPending(0)
 {
 }
 
+void
+ThreadBridge::init()
+{
+    SimObject::init();
+
+    if (inEventq != eventQueue()) {
+        fatal_if(simQuantum == 0, "%s connects different event queues, "
+                 "which requires sim_quantum or sim_lookahead to be set.",
+                 name());
+        fatal_if(delay < simQuantum, "The delay of %s (%d ticks) must not "
+                 "be less than the simulation quantum (%d ticks), as it "
+                 "connects different event queues.", name(), delay,
+                 simQuantum);
+    }
+}
+
+DrainState
+ThreadBridge::drain()
+{
+    return numPending == 0 ? DrainState::Drained : DrainState::Draining;
+}
+
+void
+ThreadBridge::send(Crossing &crossing, EventQueue *dest, PacketPtr pkt)
+{
+    // The packet is delayed by the bridge, which also accounts for
+    // the time it spent arriving here
+    Tick when = curTick() + delay + pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    ++numPending;
+
+    std::list<PacketPtr>::iterator it;
+    {
+        std::lock_guard<std::mutex> lock(crossing.mutex);
+        it = crossing.inFlight.insert(crossing.inFlight.end(), pkt);
+    }
+
+    // Scheduling on the queue of the other side is an asynchronous
+    // insertion when the two sides run on different threads
+    dest->schedule(new DeliveryEvent(*this, crossing, it), when);
+}
+
+void
+ThreadBridge::deliver(Crossing &crossing,
+                      std::list<PacketPtr>::iterator pkt)
+{
+    {
+        std::lock_guard<std::mutex> lock(crossing.mutex);
+        crossing.ready.push_back(*pkt);
+        crossing.inFlight.erase(pkt);
+    }
+
+    trySend(crossing);
+}
+
+void
+ThreadBridge::trySend(Crossing &crossing)
+{
+    while (!crossing.waitingForRetry) {
+        PacketPtr pkt;
+        {
+            std::lock_guard<std::mutex> lock(crossing.mutex);
+            if (crossing.ready.empty())
+                return;
+            pkt = crossing.ready.front();
+            crossing.ready.pop_front();
+        }
+
+        bool sent = crossing.isRequest ? out_port_.sendTimingReq(pkt) :
+            in_port_.sendTimingResp(pkt);
+
+        if (!sent) {
+            std::lock_guard<std::mutex> lock(crossing.mutex);
+            crossing.ready.push_front(pkt);
+            crossing.waitingForRetry = true;
+            return;
+        }
+
+        if (--numPending == 0 && drainState() == DrainState::Draining)
+            signalDrainDone();
+    }
+}
+
+bool
+ThreadBridge::checkFunctional(Crossing &crossing, PacketPtr pkt)
+{
+    std::lock_guard<std::mutex> lock(crossing.mutex);
+
+    for (auto queued : crossing.ready) {
+        if (pkt->trySatisfyFunctional(queued))
+            return true;
+    }
+    for (auto queued : crossing.inFlight) {
+        if (pkt->trySatisfyFunctional(queued))
+            return true;
+    }
+    return false;
+}
+
 ThreadBridge::IncomingPort::IncomingPort(const std::string &name,
                                          ThreadBridge &device)
     : ResponsePort(name), device_(device)
@@ -54,12 +157,15 @@ ThreadBridge::IncomingPort::getAddrRanges() const
 bool
 ThreadBridge::IncomingPort::recvTimingReq(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    // The bridge has unbounded buffering and never refuses a request
+    device_.send(device_.reqCrossing, device_.eventQueue(), pkt);
+    return true;
 }
 void
 ThreadBridge::IncomingPort::recvRespRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    device_.respCrossing.waitingForRetry = false;
+    device_.trySend(device_.respCrossing);
 }
 
 // AtomicResponseProtocol
@@ -74,6 +180,17 @@ ThreadBridge::IncomingPort::recvAtomic(PacketPtr pkt)
 void
 ThreadBridge::IncomingPort::recvFunctional(PacketPtr pkt)
 {
+    pkt->pushLabel(name());
+
+    // Packets inside the bridge have to be checked before the access
+    // goes past them
+    if (device_.checkFunctional(device_.respCrossing, pkt) ||
+        device_.checkFunctional(device_.reqCrossing, pkt)) {
+        pkt->popLabel();
+        return;
+    }
+    pkt->popLabel();
+
     EventQueue::ScopedMigration migrate(device_.eventQueue());
     device_.out_port_.sendFunctional(pkt);
 }
@@ -94,12 +211,14 @@ ThreadBridge::OutgoingPort::recvRangeChange()
 bool
 ThreadBridge::OutgoingPort::recvTimingResp(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    device_.send(device_.respCrossing, device_.inEventq, pkt);
+    return true;
 }
 void
 ThreadBridge::OutgoingPort::recvReqRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    device_.reqCrossing.waitingForRetry = false;
+    device_.trySend(device_.reqCrossing);
 }
 
 Port &
@@ -28,8 +28,14 @@
 #ifndef __MEM_THREAD_BRIDGE_HH__
 #define __MEM_THREAD_BRIDGE_HH__
 
+#include <atomic>
+#include <deque>
+#include <list>
+#include <mutex>
+
 #include "mem/port.hh"
 #include "params/ThreadBridge.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -43,6 +49,10 @@ class ThreadBridge : public SimObject
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
 
+    void init() override;
+
+    DrainState drain() override;
+
   private:
     class IncomingPort : public ResponsePort
     {
@@ -78,8 +88,79 @@ class ThreadBridge : public SimObject
         ThreadBridge &device_;
     };
 
+    /**
+     * Timing packets travelling in one direction. Packets are put in
+     * flight by the thread of the sending side and delivered by an
+     * event on the event queue of the receiving side, so the lists are
+     * shared between the two threads and protected by the mutex.
+     */
+    struct Crossing
+    {
+        explicit Crossing(bool is_request) : isRequest(is_request) {}
+
+        const bool isRequest;
+
+        std::mutex mutex;
+
+        /** Packets that have not reached the receiving side yet. */
+        std::list<PacketPtr> inFlight;
+
+        /** Packets that arrived and wait to be sent on. */
+        std::deque<PacketPtr> ready;
+
+        /** Only touched by the receiving side. */
+        bool waitingForRetry = false;
+    };
+
+    class DeliveryEvent : public Event
+    {
+      private:
+        ThreadBridge &bridge;
+        Crossing &crossing;
+        std::list<PacketPtr>::iterator pkt;
+
+      public:
+        DeliveryEvent(ThreadBridge &_bridge, Crossing &_crossing,
+                      std::list<PacketPtr>::iterator _pkt)
+            : Event(Default_Pri, AutoDelete), bridge(_bridge),
+              crossing(_crossing), pkt(_pkt)
+        {}
+
+        void process() override { bridge.deliver(crossing, pkt); }
+        const char *description() const override
+        {
+            return "thread bridge delivery";
+        }
+    };
+
+    /**
+     * Put a timing packet in flight towards the other side, where it
+     * arrives after the bridge delay.
+     */
+    void send(Crossing &crossing, EventQueue *dest, PacketPtr pkt);
+
+    void deliver(Crossing &crossing, std::list<PacketPtr>::iterator pkt);
+
+    /** Send on the packets that arrived until the peer refuses one. */
+    void trySend(Crossing &crossing);
+
+    /** Check a functional access against the packets of a crossing. */
+    bool checkFunctional(Crossing &crossing, PacketPtr pkt);
+
     IncomingPort in_port_;
     OutgoingPort out_port_;
+
+    /** Event queue of the requestor side, where responses arrive. */
+    EventQueue *inEventq;
+
+    /** Latency of a timing access crossing the bridge. */
+    const Tick delay;
+
+    Crossing reqCrossing;
+    Crossing respCrossing;
+
+    /** Number of timing packets inside the bridge, for draining. */
+    std::atomic<unsigned> numPending;
 };
 
 }  // namespace gem5
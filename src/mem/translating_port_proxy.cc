@@ -121,4 +121,33 @@ TranslatingPortProxy::tryMemsetBlob(Addr addr, uint8_t v, uint64_t size) const
     });
 }
 
+uint8_t *
+TranslatingPortProxy::tryHostPtr(Addr addr, uint64_t size,
+                                 MemBackdoor::Flags bd_flags) const
+{
+    if (!size)
+        return nullptr;
+
+    const auto mode = (bd_flags & MemBackdoor::Writeable) ?
+        BaseMMU::Write : BaseMMU::Read;
+    uint8_t *start = nullptr;
+    uint64_t mapped = 0;
+    bool contiguous = true;
+    const bool success = tryOnBlob(mode,
+        _tc->getMMUPtr()->translateFunctional(addr, size, _tc, mode, flags),
+        [&](const auto &range) {
+            if (!contiguous)
+                return;
+            uint8_t *host = range.flags ? nullptr :
+                PortProxy::hostPtrPhys(range.paddr, range.size, bd_flags);
+            if (host && (!start || host == start + mapped)) {
+                start = start ? start : host;
+                mapped += range.size;
+            } else {
+                contiguous = false;
+            }
+    });
+    return (success && contiguous && mapped == size) ? start : nullptr;
+}
+
 } // namespace gem5
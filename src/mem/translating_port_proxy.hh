@@ -87,6 +87,14 @@ class TranslatingPortProxy : public PortProxy
      * Fill size bytes starting at addr with byte value val.
      */
     bool tryMemsetBlob(Addr address, uint8_t  v, uint64_t size) const override;
+
+    /**
+     * Version of tryHostPtr that translates virt->phys, which only
+     * succeeds if all the pages the range spans are adjacent on the
+     * host.
+     */
+    uint8_t *tryHostPtr(Addr addr, uint64_t size,
+                        MemBackdoor::Flags bd_flags) const override;
 };
 
 } // namespace gem5
@@ -195,15 +195,11 @@ BaseXBar::Layer<SrcType, DstType>::tryTiming(SrcType* src_port)
     // destination port is already engaged in a transaction waiting
     // for a retry from the peer
     if (state == BUSY || waitingForPeer != NULL) {
-        // the port should not be waiting already
-        assert(std::find(waitingForLayer.begin(), waitingForLayer.end(),
-                         src_port) == waitingForLayer.end());
-
         // put the port at the end of the retry list waiting for the
         // layer to be freed up (and in the case of a busy peer, for
         // that transaction to go through, and then the layer to free
-        // up)
-        waitingForLayer.push_back(src_port);
+        // up), a port already waiting keeps its place
+        addWaiting(src_port, false);
         return false;
     }
 
@@ -287,6 +283,7 @@ BaseXBar::Layer<SrcType, DstType>::retryWaiting()
     // off the list
     SrcType* retryingPort = waitingForLayer.front();
     waitingForLayer.pop_front();
+    isWaiting[retryingPort->getId()] = false;
 
     // tell the port to retry, which in some cases ends up calling the
     // layer again
@@ -305,6 +302,24 @@ BaseXBar::Layer<SrcType, DstType>::retryWaiting()
     }
 }
 
+template <typename SrcType, typename DstType>
+void
+BaseXBar::Layer<SrcType, DstType>::addWaiting(SrcType* src_port, bool front)
+{
+    const PortID id = src_port->getId();
+    assert(id != InvalidPortID);
+    if (size_t(id) >= isWaiting.size())
+        isWaiting.resize(id + 1, false);
+    if (isWaiting[id])
+        return;
+    isWaiting[id] = true;
+
+    if (front)
+        waitingForLayer.push_front(src_port);
+    else
+        waitingForLayer.push_back(src_port);
+}
+
 template <typename SrcType, typename DstType>
 void
 BaseXBar::Layer<SrcType, DstType>::recvRetry()
@@ -316,7 +331,7 @@ BaseXBar::Layer<SrcType, DstType>::recvRetry()
     // add the port where the failed packet originated to the front of
     // the waiting ports for the layer, this allows us to call retry
     // on the port immediately if the crossbar layer is idle
-    waitingForLayer.push_front(waitingForPeer);
+    addWaiting(waitingForPeer, true);
 
     // we are no longer waiting for the peer
     waitingForPeer = NULL;
@@ -48,6 +48,7 @@
 
 #include <deque>
 #include <unordered_map>
+#include <vector>
 
 #include "base/addr_range_map.hh"
 #include "base/types.hh"
@@ -206,10 +207,23 @@ class BaseXBar : public ClockedObject
 
         /**
          * A deque of ports that retry should be called on because
-         * the original send was delayed due to a busy layer.
+         * the original send was delayed due to a busy layer. A port is
+         * in it at most once, so it never holds more entries than
+         * there are ports connected to the crossbar.
          */
         std::deque<SrcType*> waitingForLayer;
 
+        /** Whether each port, by id, is in waitingForLayer */
+        std::vector<bool> isWaiting;
+
+        /**
+         * Add a port to waitingForLayer, unless it already is in it.
+         *
+         * @param src_port Port waiting for the layer
+         * @param front Add the port at the front rather than the back
+         */
+        void addWaiting(SrcType* src_port, bool front);
+
         /**
          * Track who is waiting for the retry when receiving it from a
          * peer. If no port is waiting NULL is stored.
@@ -316,7 +330,7 @@ class BaseXBar : public ClockedObject
     /** the width of the xbar in bytes */
     const uint32_t width;
 
-    AddrRangeMap<PortID, 3> portMap;
+    AddrRangeMap<PortID> portMap;
 
     /**
      * Remember where request packets came from so that we can route
@@ -191,6 +191,9 @@ class PrivateL1CacheHierarchy(AbstractRubyCacheHierarchy):
 
         cluster.dcache.ruby_system = self.ruby_system
         cluster.icache.ruby_system = self.ruby_system
+        cluster.eventq_index = board.get_processor().get_core_eventq_index(
+            core_num
+        )
 
         core.connect_icache(cluster.icache.sequencer.in_ports)
         core.connect_dcache(cluster.dcache.sequencer.in_ports)
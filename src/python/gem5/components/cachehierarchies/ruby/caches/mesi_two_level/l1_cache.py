@@ -27,6 +27,7 @@
 import math
 
 from m5.objects import (
+    NULL,
     ClockDomain,
     MESI_Two_Level_L1Cache_Controller,
     MessageBuffer,
@@ -85,6 +86,7 @@ class L1Cache(MESI_Two_Level_L1Cache_Controller):
         self.l2_select_num_bits = int(math.log(num_l2Caches, 2))
         self.clk_domain = clk_domain
         self.prefetcher = RubyPrefetcher(block_size=self._cache_line_size)
+        self.classic_prefetcher = NULL
         self.send_evictions = core.requires_send_evicts()
         self.transitions_per_cycle = 4
         self.enable_prefetch = False
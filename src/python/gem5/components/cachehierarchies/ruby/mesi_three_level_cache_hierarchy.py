@@ -132,6 +132,9 @@ class MESIThreeLevelCacheHierarchy(
                 l1_cache.sequencer.connectIOPorts(board.get_io_bus())
 
             l1_cache.ruby_system = self.ruby_system
+            l1_cache.eventq_index = (
+                board.get_processor().get_core_eventq_index(core_idx)
+            )
 
             core.connect_icache(l1_cache.sequencer.in_ports)
             core.connect_dcache(l1_cache.sequencer.in_ports)
@@ -126,6 +126,9 @@ class MESITwoLevelCacheHierarchy(
                 cache.sequencer.connectIOPorts(board.get_io_bus())
 
             cache.ruby_system = self.ruby_system
+            cache.eventq_index = board.get_processor().get_core_eventq_index(
+                i
+            )
 
             core.connect_icache(cache.sequencer.in_ports)
             core.connect_dcache(cache.sequencer.in_ports)
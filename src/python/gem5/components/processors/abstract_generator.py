@@ -70,10 +70,40 @@ class AbstractGenerator(AbstractProcessor):
         """
         super().__init__(cores=cores)
 
+    @overrides(AbstractProcessor)
+    def set_core_event_queues(self, sim_quantum: str) -> None:
+        """Simulate each generator on its own event queue, and so its own
+        host thread.
+
+        Generator ``i`` is placed on event queue ``i + 1``. With a Ruby cache
+        hierarchy, the L1 controllers of a generator are on its queue too,
+        as for CPU cores. With any other hierarchy the generator crosses to
+        event queue 0 through a ``ThreadBridge``, which delays its accesses
+        by ``sim_quantum`` in each direction.
+
+        This must be called before the board is created.
+
+        :param sim_quantum: The simulation quantum, e.g. ``"1ns"``.
+        """
+        super().set_core_event_queues(sim_quantum)
+        for i, core in enumerate(self.get_cores()):
+            core.set_event_queue(self.get_core_eventq_index(i))
+
     @overrides(AbstractProcessor)
     def incorporate_processor(self, board: AbstractBoard) -> None:
         board.set_mem_mode(MemMode.TIMING)
 
+        if self.get_core_eventq_index(0) != 0:
+            hierarchy = board.get_cache_hierarchy()
+            is_ruby = hierarchy is not None and hierarchy.is_ruby()
+            for i, core in enumerate(self.get_cores()):
+                if is_ruby:
+                    core.place_thread_bridge(
+                        self.get_core_eventq_index(i), "0ns"
+                    )
+                else:
+                    core.place_thread_bridge(0, self._sim_quantum)
+
     @abstractmethod
     def start_traffic(self) -> None:
         """
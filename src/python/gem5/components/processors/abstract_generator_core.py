@@ -31,6 +31,7 @@ from typing import Optional
 from m5.objects import (
     Port,
     PortTerminator,
+    ThreadBridge,
 )
 
 from ...isas import ISA
@@ -55,6 +56,44 @@ class AbstractGeneratorCore(AbstractCore):
         """
         super().__init__()
         self.port_end = PortTerminator()
+        self._eventq_index = 0
+
+    def set_event_queue(self, eventq_index: int) -> None:
+        """Simulate the generator on its own event queue. The generator then
+        reaches the cache hierarchy through a ``ThreadBridge``, which is
+        configured by ``place_thread_bridge``.
+
+        This must be called before the cache hierarchy is connected.
+
+        :param eventq_index: The event queue of the generator.
+        """
+        self._eventq_index = eventq_index
+
+    def _connect_generator_port(self, port: Port) -> None:
+        """Connect the request port of the generator to ``port``, through a
+        ``ThreadBridge`` if the generator is on its own event queue.
+        """
+        if self._eventq_index == 0:
+            self.generator.port = port
+            return
+
+        self.generator.eventq_index = self._eventq_index
+        self.thread_bridge = ThreadBridge(in_eventq_index=self._eventq_index)
+        self.generator.port = self.thread_bridge.in_port
+        self.thread_bridge.out_port = port
+
+    def place_thread_bridge(self, eventq_index: int, delay: str) -> None:
+        """Set the event queue of the memory side of the ``ThreadBridge`` of
+        a generator on its own event queue.
+
+        :param eventq_index: The event queue of what the generator is
+                             connected to.
+        :param delay: The latency of the bridge, which must not be less than
+                      the simulation quantum if the event queues differ.
+        """
+        if self._eventq_index != 0:
+            self.thread_bridge.eventq_index = eventq_index
+            self.thread_bridge.delay = delay
 
     @overrides(AbstractCore)
     def is_kvm_core(self) -> bool:
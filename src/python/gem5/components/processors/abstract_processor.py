@@ -33,10 +33,12 @@ from typing import (
     Optional,
 )
 
+import m5
 from m5.objects import (
     Root,
     SubSystem,
 )
+from m5.util.convert import toLatency
 
 from ...isas import ISA
 from ...utils.requires import requires
@@ -68,6 +70,11 @@ class AbstractProcessor(SubSystem):
         else:
             self._isa = isa
 
+        self._sim_quantum = None
+        self._host_thread_affinity = None
+        self._kvm_quantum = "1ms"
+        self._kvm_max_quantum = None
+
     def get_num_cores(self) -> int:
         assert getattr(self, "cores")
         return len(self.cores)
@@ -79,6 +86,57 @@ class AbstractProcessor(SubSystem):
     def get_isa(self) -> ISA:
         return self._isa
 
+    def set_core_event_queues(self, sim_quantum: str) -> None:
+        """Simulate each core on its own event queue, and so its own host
+        thread.
+
+        Core ``i`` is placed on event queue ``i + 1``. Ruby cache
+        hierarchies put the L1 controllers of a core on the queue of the
+        core, while the shared caches, the directories and the network stay
+        on event queue 0. The queues synchronize every ``sim_quantum``,
+        which must not be longer than the latency of any message between
+        the L1 controllers and the network.
+
+        :param sim_quantum: The simulation quantum, e.g. ``"1ns"``.
+        """
+        self._sim_quantum = sim_quantum
+
+    def set_kvm_quantum(
+        self, quantum: str, max_quantum: Optional[str] = None
+    ) -> None:
+        """Set how often KVM cores, which each run on their own event queue,
+        synchronize with each other and with the devices.
+
+        If ``max_quantum`` is given, the period doubles, up to
+        ``max_quantum``, for as long as no core accesses a device, and drops
+        back to ``quantum`` once one does. The default is a fixed ``"1ms"``.
+
+        :param quantum: The simulation quantum, e.g. ``"1ms"``.
+        :param max_quantum: The largest simulation quantum. ``None`` keeps
+                            the quantum fixed.
+        """
+        self._kvm_quantum = quantum
+        self._kvm_max_quantum = max_quantum
+
+    def set_host_thread_affinity(self, host_cpus: List[int]) -> None:
+        """Pin the host threads simulating the event queues to host CPUs.
+
+        The thread of event queue ``i`` is pinned to
+        ``host_cpus[i % len(host_cpus)]``. Cores on their own event queues
+        are on queue ``core_id + 1``, the rest of the system on queue 0.
+
+        :param host_cpus: The host CPU numbers to use.
+        """
+        self._host_thread_affinity = list(host_cpus)
+
+    def get_core_eventq_index(self, core_id: int) -> int:
+        """Get the event queue of a core and its private caches. This is 0
+        unless ``set_core_event_queues`` was called.
+        """
+        if self._sim_quantum is None:
+            return 0
+        return core_id + 1
+
     @abstractmethod
     def incorporate_processor(self, board: AbstractBoard) -> None:
         raise NotImplementedError
@@ -94,4 +152,19 @@ class AbstractProcessor(SubSystem):
 
         Subclasses should override this method to set up any connections.
         """
-        pass
+        if self._sim_quantum is not None:
+            m5.ticks.fixGlobalFrequency()
+            root.sim_quantum = m5.ticks.fromSeconds(
+                toLatency(self._sim_quantum)
+            )
+        if self._host_thread_affinity:
+            root.sim_thread_affinity = self._host_thread_affinity
+
+    def _set_kvm_quantum(self, root: Root) -> None:
+        """Set the simulation quantum of a simulation using KVM cores."""
+        m5.ticks.fixGlobalFrequency()
+        root.sim_quantum = m5.ticks.fromSeconds(toLatency(self._kvm_quantum))
+        if self._kvm_max_quantum is not None:
+            root.sim_max_quantum = m5.ticks.fromSeconds(
+                toLatency(self._kvm_max_quantum)
+            )
@@ -27,7 +27,6 @@
 
 from typing import List
 
-import m5
 from m5.objects import (
     BaseAtomicSimpleCPU,
     BaseMinorCPU,
@@ -71,6 +70,14 @@ class BaseCPUProcessor(AbstractProcessor):
 
     @overrides(AbstractProcessor)
     def incorporate_processor(self, board: AbstractBoard) -> None:
+        if self.get_core_eventq_index(0) != 0 and not isinstance(
+            self.cores[0].get_simobject(),
+            (BaseTimingSimpleCPU, BaseO3CPU, BaseMinorCPU),
+        ):
+            raise Exception(
+                "Only timing cores can be put on separate event queues."
+            )
+
         if any(core.is_kvm_core() for core in self.get_cores()):
             board.kvm_vm = self.kvm_vm
             # To get the KVM CPUs to run on different host CPUs
@@ -85,6 +92,23 @@ class BaseCPUProcessor(AbstractProcessor):
             (BaseTimingSimpleCPU, BaseO3CPU, BaseMinorCPU),
         ):
             board.set_mem_mode(MemMode.TIMING)
+            # Only Ruby can pass messages between event queues, see
+            # `set_core_event_queues`.
+            if self.get_core_eventq_index(0) != 0:
+                if not board.get_cache_hierarchy().is_ruby():
+                    raise Exception(
+                        "Cores on separate event queues need a Ruby cache "
+                        "hierarchy."
+                    )
+                if board.has_io_bus():
+                    raise Exception(
+                        "Cores on separate event queues cannot be used with "
+                        "an I/O bus."
+                    )
+                for i, core in enumerate(self.cores):
+                    core.get_simobject().eventq_index = (
+                        self.get_core_eventq_index(i)
+                    )
         elif isinstance(
             self.cores[0].get_simobject(), BaseNonCachingSimpleCPU
         ):
@@ -105,5 +129,4 @@ class BaseCPUProcessor(AbstractProcessor):
     def _pre_instantiate(self, root: Root) -> None:
         super()._pre_instantiate(root)
         if any(core.is_kvm_core() for core in self.get_cores()):
-            m5.ticks.fixGlobalFrequency()
-            root.sim_quantum = m5.ticks.fromSeconds(0.001)
+            self._set_kvm_quantum(root)
@@ -101,7 +101,7 @@ class ComplexGeneratorCore(AbstractGeneratorCore):
 
     @overrides(AbstractCore)
     def connect_dcache(self, port: Port) -> None:
-        self.generator.port = port
+        self._connect_generator_port(port)
 
     def add_linear(
         self,
@@ -63,4 +63,4 @@ class GUPSGeneratorCore(AbstractGeneratorCore):
 
     @overrides(AbstractCore)
     def connect_dcache(self, port: Port) -> None:
-        self.generator.port = port
+        self._connect_generator_port(port)
@@ -88,7 +88,7 @@ class LinearGeneratorCore(AbstractGeneratorCore):
 
     @overrides(AbstractCore)
     def connect_dcache(self, port: Port) -> None:
-        self.generator.port = port
+        self._connect_generator_port(port)
 
     def _set_traffic(self) -> None:
         """
@@ -63,7 +63,7 @@ class SpatterGeneratorCore(AbstractGeneratorCore):
 
     @overrides(AbstractCore)
     def connect_dcache(self, port: Port) -> None:
-        self.generator.port = port
+        self._connect_generator_port(port)
 
     def add_kernel(self, kernel: SpatterKernel) -> None:
         self._kernels.append(kernel)
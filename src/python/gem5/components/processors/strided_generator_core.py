@@ -104,7 +104,7 @@ class StridedGeneratorCore(AbstractGeneratorCore):
 
     @overrides(AbstractCore)
     def connect_dcache(self, port: Port) -> None:
-        self.generator.port = port
+        self._connect_generator_port(port)
 
     def _set_traffic(self) -> None:
         self._traffic = self._create_traffic()
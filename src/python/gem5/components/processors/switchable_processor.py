@@ -175,5 +175,4 @@ class SwitchableProcessor(AbstractProcessor):
         # scheduling of exits for the non-KVM cores will be incorrect. This
         # will be fixed at a later date.
         if self._prepare_kvm:
-            m5.ticks.fixGlobalFrequency()
-            root.sim_quantum = m5.ticks.fromSeconds(0.001)
+            self._set_kvm_quantum(root)
@@ -52,8 +52,8 @@ from ..utils.socks_ssl_context import get_proxy_context
 from .client import get_resource_json_obj
 from .client import list_resources as client_list_resources
 from .md5_utils import (
-    md5_dir,
-    md5_file,
+    get_cached_md5,
+    md5_cached,
 )
 
 """
@@ -69,6 +69,10 @@ def _download(url: str, download_to: str, max_attempts: int = 6) -> None:
     The function will run a Truncated Exponential Backoff algorithm to retry
     the download if the HTTP Status Code returned is deemed retryable.
 
+    The file is downloaded to ``<download_to>.part`` and only renamed to
+    ``download_to`` once complete, so that an interrupted download is never
+    mistaken for the resource.
+
     :param url: The URL of the file to download.
 
     :param download_to: The location the downloaded file is to be stored.
@@ -81,6 +85,7 @@ def _download(url: str, download_to: str, max_attempts: int = 6) -> None:
     # TODO: This whole setup will only work for single files we can get via
     # wget. We also need to support git clones going forward.
 
+    part = f"{download_to}.part"
     attempt = 0
     while True:
         # The loop will be broken on a successful download, via a `return`, or
@@ -96,7 +101,7 @@ def _download(url: str, download_to: str, max_attempts: int = 6) -> None:
                     request, context=proxy_context
                 ) as fr:
                     with tqdm.wrapattr(
-                        open(download_to, "wb"),
+                        open(part, "wb"),
                         "write",
                         miniters=1,
                         desc="Downloading {download_to}",
@@ -113,8 +118,9 @@ def _download(url: str, download_to: str, max_attempts: int = 6) -> None:
                     desc=f"Downloading {download_to}",
                 ) as t:
                     urllib.request.urlretrieve(
-                        url, download_to, reporthook=progress_hook(t)
+                        url, part, reporthook=progress_hook(t)
                     )
+            os.replace(part, download_to)
             return
         except HTTPError as e:
             # If the error code retrieved is retryable, we retry using a
@@ -242,24 +248,30 @@ def get_resource(
                        at ``to_path``.
     """
 
+    resource_json = get_resource_json_obj(
+        resource_name,
+        resource_version=resource_version,
+        clients=clients,
+        gem5_version=gem5_version,
+    )
+
+    # A resource whose md5 value was checked before, and which has not
+    # changed since, can be used right away. This needs no lock, so many
+    # simulations can share resources, even from a read-only directory.
+    if (
+        os.path.exists(to_path)
+        and get_cached_md5(Path(to_path)) == resource_json["md5sum"]
+    ):
+        return
+
     # We apply a lock for a specific resource. This is to avoid circumstances
     # where multiple instances of gem5 are running and trying to obtain the
     # same resources at once. The timeout here is somewhat arbitarily put at 15
     # minutes.Most resources should be downloaded and decompressed in this
     # timeframe, even on the most constrained of systems.
     with FileLock(f"{to_path}.lock", timeout=900):
-        resource_json = get_resource_json_obj(
-            resource_name,
-            resource_version=resource_version,
-            clients=clients,
-            gem5_version=gem5_version,
-        )
-
         if os.path.exists(to_path):
-            if os.path.isfile(to_path):
-                md5 = md5_file(Path(to_path))
-            else:
-                md5 = md5_dir(Path(to_path))
+            md5 = md5_cached(Path(to_path))
 
             if md5 == resource_json["md5sum"]:
                 # In this case, the file has already been download, no need to
@@ -349,8 +361,9 @@ def get_resource(
                 )
             unzip_to = download_dest[: -len(zip_extension)]
             with gzip.open(download_dest, "rb") as f:
-                with open(unzip_to, "wb") as o:
-                    shutil.copyfileobj(f, o)
+                with open(f"{unzip_to}.part", "wb") as o:
+                    shutil.copyfileobj(f, o, 1024 * 1024)
+            os.replace(f"{unzip_to}.part", unzip_to)
             os.remove(download_dest)
             download_dest = unzip_to
             if not quiet:
@@ -26,8 +26,15 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 import hashlib
+import json
+import os
+import tempfile
 from pathlib import Path
-from typing import Type
+from typing import (
+    List,
+    Optional,
+    Type,
+)
 
 
 def _md5_update_from_file(
@@ -50,7 +57,7 @@ def _md5_update_from_file(
         desc=f"Computing md5sum on {filename}",
         total=filename.stat().st_size,
     ) as f:
-        for chunk in iter(lambda: f.read(4096), b""):
+        for chunk in iter(lambda: f.read(1024 * 1024), b""):
             hash.update(chunk)
     return hash
 
@@ -105,3 +112,81 @@ def md5_dir(directory: Path) -> str:
         if empty files are included or filenames are changed.
     """
     return str(_md5_update_from_dir(directory, hashlib.md5()).hexdigest())
+
+
+def _md5_cache_path(path: Path) -> Path:
+    return path.parent / f"{path.name}.md5cache"
+
+
+def _stat_signature(path: Path) -> List:
+    """
+    Gets the size and modification time of a file, or of everything in a
+    directory. These change whenever the contents do, in practice, and are
+    much cheaper to get than the md5 value.
+    """
+    if path.is_file():
+        st = path.stat()
+        return [st.st_size, st.st_mtime_ns]
+
+    signature = []
+    for root, dirs, files in os.walk(path):
+        dirs.sort()
+        for name in dirs + sorted(files):
+            entry = os.path.join(root, name)
+            st = os.stat(entry)
+            signature.append(
+                [os.path.relpath(entry, path), st.st_size, st.st_mtime_ns]
+            )
+    return signature
+
+
+def get_cached_md5(path: Path) -> Optional[str]:
+    """
+    Gets the md5 value of a file or directory recorded by ``md5_cached``, if
+    the file or directory has not changed since.
+
+    :param path: The path to get the md5 of.
+
+    :returns: The md5 value, or ``None`` if none is recorded or it is outdated.
+    """
+    try:
+        with open(_md5_cache_path(path)) as f:
+            cache = json.load(f)
+        if cache["signature"] == _stat_signature(path):
+            return cache["md5"]
+    except (OSError, ValueError, KeyError, TypeError):
+        pass
+    return None
+
+
+def md5_cached(path: Path) -> str:
+    """
+    Gets the md5 value of a file or directory, like ``md5``, and records it in
+    a ``<path>.md5cache`` file next to it. Later calls reuse the recorded value
+    for as long as the sizes and modification times of the files are
+    unchanged, rather than reading the whole resource again.
+
+    Nothing is recorded if the directory containing ``path`` is not writable,
+    the value is then computed on every call.
+
+    :param path: The path to get the md5 of.
+    """
+    value = get_cached_md5(path)
+    if value is not None:
+        return value
+
+    signature = _stat_signature(path)
+    value = md5(path)
+    if _stat_signature(path) != signature:
+        # The resource changed while it was read, don't record anything.
+        return value
+
+    try:
+        with tempfile.NamedTemporaryFile(
+            mode="w", dir=path.parent, prefix=f".{path.name}.", delete=False
+        ) as f:
+            json.dump({"signature": signature, "md5": value}, f)
+        os.replace(f.name, _md5_cache_path(path))
+    except OSError:
+        pass
+    return value
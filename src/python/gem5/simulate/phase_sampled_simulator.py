@@ -0,0 +1,415 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+A Simulator sampling a workload by phases: the detailed cores only run
+until the CPI of the current phase has converged, the rest of the phase is
+fast-forwarded and its cycles are extrapolated from that CPI. The phases
+are detected online from the instruction mix of the cores, with no
+offline profiling pass.
+"""
+
+import re
+import statistics
+from typing import (
+    Dict,
+    List,
+    Optional,
+    Tuple,
+)
+
+import m5
+
+from ..components.boards.abstract_board import AbstractBoard
+from ..components.processors.switchable_processor import SwitchableProcessor
+from .exit_event import ExitEvent
+from .simulator import Simulator
+
+
+class PhaseSampledSimulator(Simulator):
+    """
+    A Simulator switching between detailed and fast cores as the program
+    goes through phases.
+
+    The workload is simulated in intervals of ``interval`` instructions.
+    The signature of an interval is its instruction mix: the fraction of
+    loads, stores, floating point, vector and control instructions among
+    the committed instructions. It is the same whichever cores execute the
+    interval, and two intervals with a distance (the sum of the absolute
+    differences of the fractions) above ``phase_threshold`` are considered
+    in different phases.
+
+    1. A phase starts on the ``detailed_cores``, with an optional detailed
+       warm-up of ``detailed_warmup`` instructions. The CPI of every
+       interval is measured until the last ``window`` intervals have a
+       coefficient of variation within ``tolerance``, or after
+       ``max_detailed_intervals``. A new phase starts if the signature
+       changes during the measurement.
+    2. The phase then continues on the ``fast_cores``, until the signature
+       of an interval moves away from the one of the last detailed interval,
+       or after ``max_fast_intervals`` if set. The cycles of these intervals
+       are estimated with the mean CPI of the converged window.
+
+    The processor must start on the detailed cores. The detailed intervals
+    have their own stats dumps.
+
+    Example
+    -------
+
+    .. code-block::
+
+        simulator = PhaseSampledSimulator(
+            board=board,
+            fast_cores="atomic",
+            detailed_cores="o3",
+            interval=1_000_000,
+        )
+        simulator.run()
+        print(simulator.get_cpi_estimate(), simulator.get_detailed_fraction())
+    """
+
+    # The stats making up the signature, relative to the number of
+    # committed instructions
+    _signature_stats = (
+        "numLoadInsts",
+        "numStoreInsts",
+        "numFpInsts",
+        "numVecInsts",
+        "committedControl",
+    )
+
+    def __init__(
+        self,
+        board: AbstractBoard,
+        fast_cores: str,
+        detailed_cores: str,
+        interval: int,
+        detailed_warmup: int = 0,
+        window: int = 3,
+        tolerance: float = 0.02,
+        max_detailed_intervals: int = 20,
+        phase_threshold: float = 0.1,
+        max_fast_intervals: Optional[int] = None,
+        **kwargs,
+    ) -> None:
+        """
+        :param board: The board to be simulated. Its processor must be a
+                      SwitchableProcessor.
+        :param fast_cores: The key of the cores used to fast-forward.
+        :param detailed_cores: The key of the cores used to measure the CPI.
+        :param interval: The number of instructions of every interval.
+        :param detailed_warmup: The number of instructions simulated on the
+                                detailed cores at the start of a phase before
+                                measuring it.
+        :param window: The number of consecutive intervals whose CPI must
+                       agree for the phase to be measured.
+        :param tolerance: The maximum coefficient of variation of the CPI of
+                          the window.
+        :param max_detailed_intervals: The maximum number of intervals
+                                       measured in a phase, for phases whose
+                                       CPI never converges.
+        :param phase_threshold: The distance between signatures above which
+                                intervals are in different phases.
+        :param max_fast_intervals: The maximum number of intervals
+                                   fast-forwarded before measuring the phase
+                                   again. Unlimited if not set.
+        :param kwargs: Other parameters passed to the ``Simulator``. The
+                       ``MAX_INSTS`` exit event is used by the sampling and
+                       cannot be overridden.
+        """
+        processor = board.get_processor()
+        if not isinstance(processor, SwitchableProcessor):
+            raise Exception(
+                "The PhaseSampledSimulator requires a SwitchableProcessor."
+            )
+        if interval <= 0:
+            raise ValueError("The interval cannot be empty.")
+        if window < 2:
+            raise ValueError("The window needs at least two intervals.")
+        if max_detailed_intervals < window:
+            raise ValueError(
+                "The maximum number of detailed intervals cannot be smaller "
+                "than the window."
+            )
+
+        self._fast_cores = fast_cores
+        self._detailed_cores = detailed_cores
+        self._interval = interval
+        self._detailed_warmup = detailed_warmup
+        self._window = window
+        self._tolerance = tolerance
+        self._max_detailed_intervals = max_detailed_intervals
+        self._phase_threshold = phase_threshold
+        self._max_fast_intervals = max_fast_intervals
+
+        self._snapshot = None
+        self._last_counts = {}
+        self._phases = []
+        # Instructions and estimated core cycles of the finished intervals
+        self._insts = 0
+        self._detailed_insts = 0
+        self._core_cycles = 0.0
+        # Tick and instruction count at the start of the current interval,
+        # along with whether it is detailed and its estimated CPI
+        self._mark = None
+
+        on_exit_event = kwargs.pop("on_exit_event", None) or {}
+        if ExitEvent.MAX_INSTS in on_exit_event:
+            raise ValueError(
+                "The MAX_INSTS exit event is used by the "
+                "PhaseSampledSimulator."
+            )
+        on_exit_event[ExitEvent.MAX_INSTS] = self._sampling_generator()
+
+        super().__init__(board=board, on_exit_event=on_exit_event, **kwargs)
+
+    def get_phases(self) -> List[Dict]:
+        """
+        Returns the phases seen so far. Every phase is a dictionary with its
+        first instruction (``start``), its length in instructions
+        (``insts``), the number of them simulated on the detailed cores
+        (``detailed_insts``) and its CPI (``cpi``). The CPI of a phase that
+        is still being measured is ``None``.
+        """
+        return [dict(phase) for phase in self._phases]
+
+    def get_cpi_estimate(self) -> float:
+        """
+        Estimate the CPI of the whole run: measured on the detailed
+        intervals, and extrapolated from the CPI of their phase on the
+        fast-forwarded ones.
+        """
+        insts, core_cycles, _ = self._totals()
+        if not insts:
+            raise Exception("No instruction has been simulated yet.")
+        return core_cycles / insts
+
+    def get_estimated_cycles(self) -> float:
+        """Estimate the number of cycles of the whole run."""
+        _, core_cycles, _ = self._totals()
+        return core_cycles / self._board.get_processor().get_num_cores()
+
+    def get_detailed_fraction(self) -> float:
+        """Returns the fraction of instructions simulated in detail."""
+        insts, _, detailed_insts = self._totals()
+        return detailed_insts / insts if insts else 0.0
+
+    def run(self, max_ticks: Optional[int] = None) -> None:
+        if not self._instantiated:
+            # The first phase starts on the detailed cores, with the
+            # simulation. The board may come from a checkpoint, hence the
+            # interval is only marked once it is instantiated.
+            self._instantiate()
+            self._begin_phase()
+            self._start_interval(detailed=True)
+            self._signature()
+            self.schedule_max_insts(self._detailed_warmup or self._interval)
+        super().run(max_ticks)
+
+    def _switch_to(self, key: str) -> None:
+        processor = self._board.get_processor()
+        if processor.get_cores() != processor._switchable_cores[key]:
+            processor.switch_to_processor(key)
+
+    def _inst_count(self) -> int:
+        return sum(
+            core.get_simobject().totalInsts()
+            for core in self._board.get_processor().get_cores()
+        )
+
+    def _start_interval(self, detailed: bool, cpi: float = 0.0) -> None:
+        self._mark = (
+            self.get_current_tick(),
+            self._inst_count(),
+            detailed,
+            cpi,
+        )
+
+    def _current_interval(self) -> Tuple[int, float]:
+        """
+        Returns the instructions and core cycles of the current interval so
+        far, measured on the detailed cores or estimated on the fast ones.
+        """
+        if self._mark is None:
+            return 0, 0.0
+        start_tick, start_insts, detailed, cpi = self._mark
+        insts = self._inst_count() - start_insts
+        if not detailed:
+            return insts, insts * cpi
+        period = self._board.get_clock_domain().clock[0].getValue()
+        cycles = (self.get_current_tick() - start_tick) / period
+        return insts, cycles * self._board.get_processor().get_num_cores()
+
+    def _end_interval(self) -> Tuple[int, float]:
+        insts, core_cycles = self._current_interval()
+        detailed = self._mark[2]
+        self._mark = None
+
+        self._insts += insts
+        self._core_cycles += core_cycles
+        phase = self._phases[-1]
+        phase["insts"] += insts
+        if detailed:
+            self._detailed_insts += insts
+            phase["detailed_insts"] += insts
+        return insts, core_cycles
+
+    def _totals(self) -> Tuple[int, float, int]:
+        # Include the interval in progress, e.g., when the workload ended
+        # in the middle of it.
+        insts, core_cycles = self._current_interval()
+        detailed_insts = self._detailed_insts
+        if self._mark is not None and self._mark[2]:
+            detailed_insts += insts
+        return (
+            self._insts + insts,
+            self._core_cycles + core_cycles,
+            detailed_insts,
+        )
+
+    def _signature(self) -> Dict[str, float]:
+        """
+        Returns the instruction mix of the cores since the last call.
+        """
+        if self._snapshot is None:
+            stats = "|".join(("numInsts",) + self._signature_stats)
+            self._snapshot = m5.stats.snapshot(
+                [rf".*\.commitStats\d+\.({stats})(::.*)?"]
+            )
+            self._leaves = [
+                re.sub(r".*\.commitStats\d+\.", "", name)
+                for name in self._snapshot.names
+            ]
+        else:
+            self._snapshot.update()
+
+        counts = {}
+        for leaf, value in zip(self._leaves, memoryview(self._snapshot)):
+            counts[leaf] = counts.get(leaf, 0.0) + value
+
+        # The stats may have been reset since the last call, in which case
+        # they count from the reset.
+        deltas = {}
+        for leaf, value in counts.items():
+            delta = value - self._last_counts.get(leaf, 0.0)
+            deltas[leaf] = delta if delta >= 0 else value
+        self._last_counts = counts
+
+        insts = deltas.pop("numInsts", 0.0)
+        if not insts:
+            return {}
+        return {leaf: delta / insts for leaf, delta in deltas.items()}
+
+    def _new_phase(self, signature: Dict[str, float]) -> bool:
+        """Whether a signature is in a different phase than a reference."""
+        distance = sum(
+            abs(signature.get(leaf, 0.0) - reference)
+            for leaf, reference in self._reference.items()
+        ) + sum(
+            value
+            for leaf, value in signature.items()
+            if leaf not in self._reference
+        )
+        return distance > self._phase_threshold
+
+    def _reset_stats(self) -> None:
+        m5.stats.reset()
+        self._last_counts = {}
+
+    def _begin_phase(self) -> None:
+        # Called before the end of the interval starting the phase
+        self._phases.append(
+            {
+                "start": self._insts,
+                "insts": 0,
+                "detailed_insts": 0,
+                "cpi": None,
+            }
+        )
+
+    def _sampling_generator(self):
+        warming = bool(self._detailed_warmup)
+        while True:
+            # Measure the phase in detail until its CPI converges. An
+            # interval, or the warm-up, has just ended on the detailed cores.
+            cpis = []
+            while True:
+                signature = self._signature()
+                if warming:
+                    self._end_interval()
+                    warming = False
+                else:
+                    if cpis and self._new_phase(signature):
+                        # The phase changed in the middle of the measurement
+                        self._begin_phase()
+                        cpis = []
+                    insts, core_cycles = self._end_interval()
+                    m5.stats.dump()
+                    if insts:
+                        cpis.append(core_cycles / insts)
+                self._reference = signature
+
+                window = cpis[-self._window :]
+                if len(window) == self._window and (
+                    statistics.stdev(window)
+                    <= self._tolerance * statistics.mean(window)
+                    or len(cpis) >= self._max_detailed_intervals
+                ):
+                    break
+
+                self._reset_stats()
+                self._start_interval(detailed=True)
+                self.schedule_max_insts(self._interval)
+                yield False
+
+            cpi = statistics.mean(window)
+            self._phases[-1]["cpi"] = cpi
+
+            # Fast-forward for as long as the phase lasts
+            self._switch_to(self._fast_cores)
+            fast_intervals = 0
+            while True:
+                self._start_interval(detailed=False, cpi=cpi)
+                self.schedule_max_insts(self._interval)
+                yield False
+
+                fast_intervals += 1
+                new_phase = self._new_phase(self._signature())
+                if new_phase:
+                    self._begin_phase()
+                self._end_interval()
+                if new_phase or (
+                    self._max_fast_intervals is not None
+                    and fast_intervals >= self._max_fast_intervals
+                ):
+                    break
+
+            self._switch_to(self._detailed_cores)
+            warming = bool(self._detailed_warmup)
+            self._reset_stats()
+            self._start_interval(detailed=True)
+            self.schedule_max_insts(self._detailed_warmup or self._interval)
+            yield False
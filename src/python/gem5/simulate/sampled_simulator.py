@@ -0,0 +1,286 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+A Simulator performing statistical sampling of a workload in the style of
+SMARTS: the workload alternates between fast-forwarding on fast cores and
+short detailed windows, and the CPI of the whole run is estimated from the
+CPI of the windows along with a confidence interval.
+"""
+
+import math
+import random
+import statistics
+from typing import (
+    List,
+    Optional,
+    Tuple,
+)
+
+import m5
+
+from ..components.boards.abstract_board import AbstractBoard
+from ..components.processors.switchable_processor import SwitchableProcessor
+from .exit_event import ExitEvent
+from .simulator import Simulator
+
+
+class SampledSimulator(Simulator):
+    """
+    A Simulator sampling the execution of a workload periodically.
+
+    Every ``period`` instructions, the simulator goes through the following
+    phases:
+
+    1. Fast-forward on the ``fast_cores`` of the board's SwitchableProcessor.
+       Atomic cores with caches functionally warm the caches and branch
+       predictors, KVM cores do not warm anything.
+    2. Optionally, functional warm-up for ``functional_warmup`` instructions
+       on the ``warming_cores`` (e.g., atomic cores after KVM fast-forward).
+    3. Detailed warm-up for ``detailed_warmup`` instructions on the
+       ``detailed_cores`` to fill the pipeline and the queues.
+    4. Measurement for ``measurement`` instructions on the detailed cores.
+       The stats are reset at the start of the window and dumped at its end,
+       so every window has its own stats dump.
+
+    With the ``"systematic"`` schedule, the windows are evenly spaced. With
+    the ``"random"`` schedule, the fast-forward length of every period is
+    drawn uniformly from twice its systematic length, which keeps the mean
+    period unchanged while avoiding aliasing with periodic program behavior.
+
+    The processor must start on the fast cores. The simulation ends when the
+    workload ends or after ``num_samples`` windows if set.
+
+    Example
+    -------
+
+    .. code-block::
+
+        simulator = SampledSimulator(
+            board=board,
+            fast_cores="atomic",
+            detailed_cores="o3",
+            period=10_000_000,
+            detailed_warmup=20_000,
+            measurement=10_000,
+        )
+        simulator.run()
+        cpi, error = simulator.get_cpi_estimate(confidence=0.997)
+    """
+
+    def __init__(
+        self,
+        board: AbstractBoard,
+        fast_cores: str,
+        detailed_cores: str,
+        period: int,
+        detailed_warmup: int,
+        measurement: int,
+        warming_cores: Optional[str] = None,
+        functional_warmup: int = 0,
+        schedule: str = "systematic",
+        num_samples: Optional[int] = None,
+        seed: Optional[int] = None,
+        **kwargs,
+    ) -> None:
+        """
+        :param board: The board to be simulated. Its processor must be a
+                      SwitchableProcessor.
+        :param fast_cores: The key of the cores used to fast-forward.
+        :param detailed_cores: The key of the cores used for the detailed
+                               warm-up and the measurement.
+        :param period: The number of instructions between the start of two
+                       measurement windows.
+        :param detailed_warmup: The number of instructions simulated on the
+                                detailed cores before every window.
+        :param measurement: The number of instructions in every window.
+        :param warming_cores: The key of the cores used for functional
+                              warm-up, if any.
+        :param functional_warmup: The number of instructions of functional
+                                  warm-up on the warming cores before the
+                                  detailed warm-up.
+        :param schedule: Either ``"systematic"`` or ``"random"``.
+        :param num_samples: The number of windows after which the simulation
+                            ends. If not set, it runs until the workload
+                            ends.
+        :param seed: The seed of the random schedule.
+        :param kwargs: Other parameters passed to the ``Simulator``. The
+                       ``MAX_INSTS`` exit event is used by the sampling and
+                       cannot be overridden.
+        """
+        processor = board.get_processor()
+        if not isinstance(processor, SwitchableProcessor):
+            raise Exception(
+                "The SampledSimulator requires a SwitchableProcessor."
+            )
+        if warming_cores is None and functional_warmup:
+            raise ValueError(
+                "Functional warm-up requires the warming cores to be set."
+            )
+        if schedule not in ("systematic", "random"):
+            raise ValueError(f"Unknown sampling schedule '{schedule}'.")
+
+        self._fast_forward = (
+            period - functional_warmup - detailed_warmup - measurement
+        )
+        if self._fast_forward <= 0:
+            raise ValueError(
+                "The sampling period must be longer than the warm-up and "
+                "measurement windows."
+            )
+        if measurement <= 0:
+            raise ValueError("The measurement window cannot be empty.")
+
+        self._fast_cores = fast_cores
+        self._warming_cores = warming_cores
+        self._detailed_cores = detailed_cores
+        self._functional_warmup = functional_warmup
+        self._detailed_warmup = detailed_warmup
+        self._measurement = measurement
+        self._schedule = schedule
+        self._num_samples = num_samples
+        self._random = random.Random(seed)
+
+        self._cpi_samples = []
+        self._window_start = None
+
+        on_exit_event = kwargs.pop("on_exit_event", None) or {}
+        if ExitEvent.MAX_INSTS in on_exit_event:
+            raise ValueError(
+                "The MAX_INSTS exit event is used by the SampledSimulator."
+            )
+        on_exit_event[ExitEvent.MAX_INSTS] = self._sampling_generator()
+
+        super().__init__(board=board, on_exit_event=on_exit_event, **kwargs)
+
+    def get_cpi_samples(self) -> List[float]:
+        """Returns the CPI measured in every window so far."""
+        return list(self._cpi_samples)
+
+    def get_cpi_estimate(
+        self, confidence: float = 0.95
+    ) -> Tuple[float, float]:
+        """
+        Estimate the CPI of the whole run from the windows measured so far.
+
+        :param confidence: The confidence level of the interval.
+
+        :returns: The mean CPI of the windows and the half-width of its
+                  confidence interval. The half-width is infinite if fewer
+                  than two windows were measured.
+        """
+        if not self._cpi_samples:
+            raise Exception("No measurement window has been simulated yet.")
+
+        mean = statistics.mean(self._cpi_samples)
+        if len(self._cpi_samples) < 2:
+            return mean, math.inf
+
+        z = statistics.NormalDist().inv_cdf(0.5 + confidence / 2)
+        stdev = statistics.stdev(self._cpi_samples)
+        return mean, z * stdev / math.sqrt(len(self._cpi_samples))
+
+    def get_required_samples(
+        self, relative_error: float, confidence: float = 0.95
+    ) -> int:
+        """
+        Estimate, from the variability of the windows measured so far, how
+        many windows are needed for the CPI to be within ``relative_error``
+        of its true value with the given confidence.
+
+        :param relative_error: The target relative error, e.g. ``0.03``.
+        :param confidence: The confidence level.
+        """
+        if len(self._cpi_samples) < 2:
+            raise Exception("At least two windows are needed.")
+
+        z = statistics.NormalDist().inv_cdf(0.5 + confidence / 2)
+        variation = statistics.stdev(self._cpi_samples) / statistics.mean(
+            self._cpi_samples
+        )
+        return math.ceil((z * variation / relative_error) ** 2)
+
+    def run(self, max_ticks: Optional[int] = None) -> None:
+        if not self._instantiated:
+            self._schedule_fast_forward()
+        super().run(max_ticks)
+
+    def _switch_to(self, key: str) -> None:
+        processor = self._board.get_processor()
+        if processor.get_cores() != processor._switchable_cores[key]:
+            processor.switch_to_processor(key)
+
+    def _schedule_fast_forward(self) -> None:
+        insts = self._fast_forward
+        if self._schedule == "random":
+            insts = self._random.randint(1, 2 * self._fast_forward)
+        self.schedule_max_insts(insts)
+
+    def _inst_count(self) -> int:
+        return sum(
+            core.get_simobject().totalInsts()
+            for core in self._board.get_processor().get_cores()
+        )
+
+    def _end_window(self) -> None:
+        start_tick, start_insts = self._window_start
+        processor = self._board.get_processor()
+        period = self._board.get_clock_domain().clock[0].getValue()
+        cycles = (self.get_current_tick() - start_tick) / period
+        insts = self._inst_count() - start_insts
+        if insts:
+            self._cpi_samples.append(
+                cycles * processor.get_num_cores() / insts
+            )
+        m5.stats.dump()
+
+    def _sampling_generator(self):
+        while True:
+            if self._warming_cores and self._functional_warmup:
+                self._switch_to(self._warming_cores)
+                self.schedule_max_insts(self._functional_warmup)
+                yield False
+
+            self._switch_to(self._detailed_cores)
+            if self._detailed_warmup:
+                self.schedule_max_insts(self._detailed_warmup)
+                yield False
+
+            m5.stats.reset()
+            self._window_start = (self.get_current_tick(), self._inst_count())
+            self.schedule_max_insts(self._measurement)
+            yield False
+
+            self._end_window()
+            if (
+                self._num_samples is not None
+                and len(self._cpi_samples) >= self._num_samples
+            ):
+                yield True
+
+            self._switch_to(self._fast_cores)
+            self._schedule_fast_forward()
+            yield False
@@ -776,3 +776,98 @@ class Simulator:
                                will be saved.
         """
         m5.checkpoint(str(checkpoint_dir))
+
+    def fork_samples(
+        self,
+        sample_ticks: List[int],
+        sample: Callable[["Simulator", int], None],
+        max_children: Optional[int] = None,
+        outdir: str = "%(parent)s/sample%(fork_seq)i",
+    ) -> List[int]:
+        """
+        Fast-forward through a list of sample points once and fork a child
+        process at each of them to simulate that sample in detail.
+
+        The parent runs up to every tick in ``sample_ticks`` in turn, using
+        whatever processor is currently active (typically KVM or atomic
+        cores), and forks a copy-on-write child there. Each child gets its
+        own output directory, so its stats do not mix with those of the
+        other samples. The child calls ``sample(simulator, index)``, which
+        would usually switch to detailed cores, reset the stats and run the
+        region of interest, and then exits, dumping its stats. The parent
+        carries on fast-forwarding to the next sample point.
+
+        Forking needs all the interactive listeners (terminals, GDB) to be
+        disabled, so they are disabled if the simulation has not been
+        instantiated yet. KVM cores cannot be used in the children, since
+        the KVM VM is not inherited across the fork.
+
+        :param sample_ticks: The absolute ticks to fork a sample at.
+        :param sample: The function to run in each child. It is passed the
+                       simulator and the index of the sample.
+        :param max_children: The maximum number of children running at the
+                             same time. Defaults to the number of host CPUs.
+        :param outdir: The output directory of each child. See ``m5.fork``
+                       for the format.
+
+        :returns: The exit status of each child, in sample order.
+        """
+        if max_children is None:
+            max_children = os.cpu_count() or 1
+        if max_children < 1:
+            raise ValueError("At least one child has to be allowed to run.")
+
+        if not self._instantiated:
+            m5.disableAllListeners()
+        elif not m5.listenersDisabled():
+            raise Exception(
+                "Cannot fork samples with listeners enabled. Call "
+                "fork_samples before running the simulation or disable the "
+                "listeners with m5.disableAllListeners()."
+            )
+        self._instantiate()
+
+        running = {}
+        status = [None] * len(sample_ticks)
+
+        def reap_child() -> None:
+            pid, child_status = os.wait()
+            if os.WIFEXITED(child_status):
+                child_status = os.WEXITSTATUS(child_status)
+            else:
+                child_status = -os.WTERMSIG(child_status)
+            status[running.pop(pid)] = child_status
+
+        for index, tick in sorted(
+            enumerate(sample_ticks), key=lambda sample_tick: sample_tick[1]
+        ):
+            if tick > self.get_current_tick():
+                m5.scheduleTickExitAbsolute(tick)
+                self._last_exit_event = m5.simulate(self.get_max_ticks())
+                exit_enum = ExitEvent.translate_exit_status(
+                    self.get_last_exit_event_cause()
+                )
+                self._tick_stopwatch.append(
+                    (exit_enum, self.get_current_tick())
+                )
+                if exit_enum != ExitEvent.SCHEDULED_TICK:
+                    warn(
+                        f"Fast-forwarding ended with a '{exit_enum.value}' "
+                        f"exit event before sample {index}. No more samples "
+                        "will be forked."
+                    )
+                    break
+
+            while len(running) >= max_children:
+                reap_child()
+
+            pid = m5.fork(outdir)
+            if pid == 0:
+                sample(self, index)
+                sys.exit(0)
+            running[pid] = index
+
+        while running:
+            reap_child()
+
+        return status
@@ -25,8 +25,10 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from .multisim import (
+    add_region_simulators,
     add_simulator,
     get_simulator_ids,
+    merge_region_stats,
     num_simulators,
     run,
     set_num_processes,
@@ -50,11 +50,17 @@ This script is then passed to the child processes to load.
 """
 
 import importlib
+import json
 import multiprocessing
 from pathlib import Path
 from typing import (
+    Any,
+    Callable,
+    Dict,
     Optional,
     Set,
+    Tuple,
+    Union,
 )
 
 from m5.core import override_re_outdir
@@ -71,6 +77,19 @@ _num_processes = None
 
 _multi_sim: Set["Simulator"] = set()
 
+# The regions of a workload to run in parallel, added with
+# `add_region_simulators`. Each region ID maps to the function creating its
+# simulator, the region passed to that function, and the region weight. The
+# simulators are only created in the child process running the region.
+_multi_sim_regions: Dict[
+    str,
+    Tuple[Callable[[Union[int, str]], "Simulator"], Union[int, str], float],
+] = {}
+
+# The name of the file, in the output directory of each region, holding the
+# region stats used to compute the weighted stats.
+_region_stats_file = "region_stats.json"
+
 
 def _load_module(module_path: Path) -> None:
     """Load the module at the given path."""
@@ -99,6 +118,22 @@ def _get_simulator_ids_child_process(id_list, module_path: Path) -> None:
     if len(id_list) != 0:
         id_list *= 0
     id_list.extend([sim.get_id() for sim in _multi_sim])
+    id_list.extend(_multi_sim_regions.keys())
+
+
+def _get_region_weights_child_process(
+    weights_dict, module_path: Path
+) -> None:
+    """Get the weights of the regions to be run.
+
+    Like `_get_simulator_ids_child_process`, this is run in a child process
+    which loads the module (config script) then reads the weights.
+    """
+
+    _load_module(module_path)
+    weights_dict.update(
+        {id: weight for id, (_, _, weight) in _multi_sim_regions.items()}
+    )
 
 
 def _get_num_processes_child_process(
@@ -156,24 +191,97 @@ def get_num_processes(config_module_path: Path) -> Optional[int]:
     return num_processes_dict["num_processes"]
 
 
+def get_region_weights(config_module_path: Path) -> Dict[str, float]:
+    """Get the weights of the regions added with `add_region_simulators`,
+    by simulator ID. Like `get_simulator_ids`, this imports the module in a
+    child process.
+    """
+
+    manager = multiprocessing.Manager()
+    weights_dict = manager.dict()
+    p = multiprocessing.Process(
+        target=_get_region_weights_child_process,
+        args=(weights_dict, config_module_path),
+    )
+    p.start()
+    p.join()
+    return dict(weights_dict)
+
+
 def _run(module_path: Path, id: str) -> None:
     """Run the simulator with the ID specified."""
 
     _load_module(module_path)
 
     global _multi_sim
-    sim_list = [sim for sim in _multi_sim if sim.get_id() == id]
+    if id in _multi_sim_regions:
+        create_simulator, region, _ = _multi_sim_regions[id]
+        simulator = create_simulator(region)
+        simulator.set_id(id)
+    else:
+        sim_list = [sim for sim in _multi_sim if sim.get_id() == id]
 
-    assert len(sim_list) != 0, f"No simulator with id '{id}' found."
-    assert len(sim_list) == 1, f"Multiple simulators with id '{id}' found."
+        assert len(sim_list) != 0, f"No simulator with id '{id}' found."
+        assert (
+            len(sim_list) == 1
+        ), f"Multiple simulators with id '{id}' found."
+        simulator = sim_list[0]
     import m5
 
-    subdir = Path(Path(m5.options.outdir) / Path(sim_list[0].get_id()))
-    sim_list[0].override_outdir(subdir)
+    subdir = Path(Path(m5.options.outdir) / Path(simulator.get_id()))
+    simulator.override_outdir(subdir)
     # This doesn't do anything if none of the redirect options are passed
     override_re_outdir(subdir)
 
-    sim_list[0].run()
+    simulator.run()
+
+    if id in _multi_sim_regions:
+        with open(subdir / _region_stats_file, "w") as stats_file:
+            json.dump(simulator.get_stats(), stats_file)
+
+
+def _weighted_stats(
+    stats: Dict[str, Any], weight: float, total: Dict
+) -> None:
+    """Add the numeric values of a region's stats, multiplied by the region
+    weight, to the matching values in `total`.
+    """
+    for key, value in stats.items():
+        if isinstance(value, dict):
+            _weighted_stats(value, weight, total.setdefault(key, {}))
+        elif isinstance(value, (int, float)) and not isinstance(value, bool):
+            total[key] = total.get(key, 0) + weight * value
+        else:
+            total.setdefault(key, value)
+
+
+def merge_region_stats(
+    outdir: Path, weights: Dict[str, float]
+) -> Dict[str, Any]:
+    """Merge the stats of the regions run in `outdir` into weighted stats.
+
+    Every numeric stat is the sum, over all regions, of the stat multiplied
+    by the weight of the region. With SimPoint weights, which sum to one,
+    this is the weighted average of the regions. With LoopPoint multipliers
+    it is an extrapolation of the whole program.
+
+    :param outdir: The MultiSim output directory.
+    :param weights: The weight of each region, by simulator ID.
+
+    :returns: The weighted stats, in the JSON structure of the stats of a
+              single region.
+    """
+    total = {}
+    for id, weight in weights.items():
+        stats_path = Path(outdir) / id / _region_stats_file
+        if not stats_path.is_file():
+            raise Exception(
+                f"The stats of region '{id}' were not found at "
+                f"'{stats_path}'."
+            )
+        with open(stats_path) as stats_file:
+            _weighted_stats(json.load(stats_file), weight, total)
+    return total
 
 
 def run(module_path: Path, processes: Optional[int] = None) -> None:
@@ -212,6 +320,19 @@ def run(module_path: Path, processes: Optional[int] = None) -> None:
     # run.
     pool.starmap(_run, zip([module_path for _ in range(len(ids))], tuple(ids)))
 
+    # Merge the stats of the regions of a workload, if any were added.
+    region_weights = get_region_weights(module_path)
+    if region_weights:
+        import m5
+
+        weighted_stats_path = Path(m5.options.outdir) / "weighted_stats.json"
+        with open(weighted_stats_path, "w") as stats_file:
+            json.dump(
+                merge_region_stats(Path(m5.options.outdir), region_weights),
+                stats_file,
+                indent=4,
+            )
+
 
 def set_num_processes(num_processes: int) -> None:
     """Set the max number of processes to run in parallel.
@@ -262,43 +383,110 @@ def add_simulator(simulator: "Simulator") -> None:
     # passed a traditional gem5 config and not via the multisim module.
     global module_run
     if not module_run:
-        import argparse
+        _run_directly(simulator.get_id(), lambda: simulator)
 
-        parser = argparse.ArgumentParser(
-            description="Run a specific simulation based on the id."
-        )
-        parser.add_argument(
-            "id",
-            type=str,
-            nargs="?",
-            default=None,
-            help="The id of the simulator to run. "
-            "WARNING: If the id is invalid nothing is done.",
-        )
-        parser.add_argument(
-            "-l",
-            "--list",
-            help="List the ids of the simulators to run.",
-            action="store_true",
+
+def add_region_simulators(
+    regions: Union["SimpointResource", "SimPoint", "Looppoint"],
+    create_simulator: Callable[[Union[int, str]], "Simulator"],
+    id_prefix: str = "region",
+) -> None:
+    """Add one simulator per region of a workload to the MultiSim.
+
+    The regions are either the SimPoints of a SimPoint resource, identified
+    by their index, or the regions of a LoopPoint, identified by their
+    region ID. ``create_simulator`` is called with the index or ID of a
+    region in the child process running that region, and must return the
+    simulator for it (e.g., restoring the checkpoint taken at the start of
+    the region). The simulators of the other regions are never created, so
+    a workload can have thousands of regions.
+
+    Once all the regions have been run, MultiSim merges their stats into
+    ``weighted_stats.json`` in the output directory, weighting each region
+    by its SimPoint weight or LoopPoint multiplier. See
+    ``merge_region_stats``.
+
+    :param regions: The SimPoint or LoopPoint describing the regions.
+    :param create_simulator: The function creating the simulator of a
+                             region.
+    :param id_prefix: The prefix of the simulator IDs, which are
+                      ``<id_prefix>_<region>``.
+    """
+
+    if hasattr(regions, "get_regions"):
+        weights = {
+            region_id: region.get_multiplier()
+            for region_id, region in regions.get_regions().items()
+        }
+    elif hasattr(regions, "get_weight_list"):
+        weights = dict(enumerate(regions.get_weight_list()))
+    else:
+        raise TypeError(
+            "The regions must be described by a SimPoint or a LoopPoint."
         )
-        args = parser.parse_args()
-        if args.list:
-            print(simulator.get_id())
-        elif not args.id:
-            raise Exception(
-                "If running this script directly as a configuration script "
-                "then a single argument must be specified: the id of the "
-                "simulator to run. This will run the simulation associated "
-                "with that id and no other. If the intent is instead to run "
-                "the script via the MultiSim utility then run this script via "
-                "the multisim module: "
-                "`<gem5> -m gem5.utils.multisim <config_script>`.\n\n"
-                "To list the ids of the simulators to run use the `--list` "
-                "(`-l`)  flag."
+
+    global _multi_sim_regions
+    for region, weight in weights.items():
+        id = f"{id_prefix}_{region}"
+        if id in _multi_sim_regions:
+            raise ValueError(f"A region with id '{id}' was already added.")
+        _multi_sim_regions[id] = (create_simulator, region, weight)
+
+    global module_run
+    if not module_run:
+        for region in weights.keys():
+            _run_directly(
+                f"{id_prefix}_{region}",
+                lambda region=region: create_simulator(region),
             )
-        elif args.id == simulator.get_id():
-            import m5
 
-            subdir = Path(Path(m5.options.outdir) / Path(simulator.get_id()))
-            simulator.override_outdir(subdir)
-            simulator.run()
+
+def _run_directly(id: str, get_simulator: Callable[[], "Simulator"]) -> None:
+    """Run a single simulation from a config script not run via the MultiSim
+    module, if it is the one whose id is passed as an argument.
+
+    :param id: The id of the simulator.
+    :param get_simulator: The function returning the simulator.
+    """
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description="Run a specific simulation based on the id."
+    )
+    parser.add_argument(
+        "id",
+        type=str,
+        nargs="?",
+        default=None,
+        help="The id of the simulator to run. "
+        "WARNING: If the id is invalid nothing is done.",
+    )
+    parser.add_argument(
+        "-l",
+        "--list",
+        help="List the ids of the simulators to run.",
+        action="store_true",
+    )
+    args = parser.parse_args()
+    if args.list:
+        print(id)
+    elif not args.id:
+        raise Exception(
+            "If running this script directly as a configuration script "
+            "then a single argument must be specified: the id of the "
+            "simulator to run. This will run the simulation associated "
+            "with that id and no other. If the intent is instead to run "
+            "the script via the MultiSim utility then run this script via "
+            "the multisim module: "
+            "`<gem5> -m gem5.utils.multisim <config_script>`.\n\n"
+            "To list the ids of the simulators to run use the `--list` "
+            "(`-l`)  flag."
+        )
+    elif args.id == id:
+        import m5
+
+        simulator = get_simulator()
+        simulator.set_id(id)
+        subdir = Path(Path(m5.options.outdir) / Path(id))
+        simulator.override_outdir(subdir)
+        simulator.run()
@@ -745,6 +745,7 @@ class SimObject(metaclass=MetaSimObject):
         self._name = None
         self._ccObject = None  # pointer to C++ object
         self._ccParams = None
+        self._path = None  # cached once the hierarchy is final
         self._instantiated = False  # really "cloned"
         self._init_called = True  # Checked so subclasses don't forget __init__
 
@@ -1004,6 +1005,8 @@ class SimObject(metaclass=MetaSimObject):
                 self.add_child(key, val)
 
     def path(self):
+        if self._path is not None:
+            return self._path
         if not self._parent:
             return f"<orphan {self.__class__}>"
         elif isinstance(self._parent, MetaSimObject):
@@ -1014,6 +1017,14 @@ class SimObject(metaclass=MetaSimObject):
             return self._name
         return ppath + "." + self._name
 
+    def freezePath(self):
+        """Remember the path of this object once the configuration
+        hierarchy can no longer change. Dumping and instantiating the
+        configuration look the path up many times, and computing it
+        walks all the way up to the root."""
+        self._path = None
+        self._path = self.path()
+
     def path_list(self):
         if self._parent:
             return self._parent.path_list() + [self._name]
@@ -44,7 +44,9 @@ import _m5.event
 from _m5.event import GlobalSimLoopExitEvent as SimExit
 from _m5.event import PyEvent as Event
 from _m5.event import (
+    enableProfiler,
     getEventQueue,
+    numEventQueues,
     setEventQueue,
 )
 
@@ -89,6 +91,26 @@ def create(func, priority=Event.Default_Pri):
     return EventWrapper(func, priority=priority)
 
 
+def queue_stats():
+    """Describe the activity of the main event queues since the start of
+    the simulation, as a list of dictionaries indexed by queue.
+
+    Each dictionary holds the counters of EventQueue::Counters (e.g.,
+    "scheduled", "async_merged", "barrier_wait_seconds"), the
+    "schedule_distance" histogram, where bucket 0 counts events
+    scheduled for the current tick and bucket i distances in
+    [2^(i-1), 2^i) ticks, and the number of events of every pending
+    (tick, priority) bin, "bin_depths".
+    """
+
+    stats = []
+    for index in range(numEventQueues()):
+        queue_stats = getEventQueue(index).stats()
+        queue_stats["pending"] = sum(queue_stats["bin_depths"])
+        stats.append(queue_stats)
+    return stats
+
+
 __all__ = [
     "Event",
     "EventWrapper",
@@ -96,4 +118,5 @@ __all__ = [
     "SimExit",
     "mainq",
     "create",
+    "queue_stats",
 ]
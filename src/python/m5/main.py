@@ -261,6 +261,13 @@ def parse_options():
         help="Create DOT & pdf outputs of the DVFS configuration"
         + " [Default: %default]",
     )
+    option(
+        "--no-config-files",
+        action="store_true",
+        default=False,
+        help="Do not write the config.ini, JSON and DOT outputs, which "
+        "takes a while for very large configurations",
+    )
 
     # Debugging options
     group("Debugging Options")
@@ -301,6 +308,21 @@ def parse_options():
         help="Sets the output file for debug. Append '.gz' to the name for it"
         " to be compressed automatically [Default: %default]",
     )
+    option(
+        "--debug-binary",
+        action="store_true",
+        default=False,
+        help="Record debug output in a compact binary form instead of text."
+        " Use util/decode_binary_trace.py to format it.",
+    )
+    option(
+        "--debug-per-queue",
+        action="store_true",
+        default=False,
+        help="Write the debug output of each event queue to its own file,"
+        " <debug-file>.<queue>, so that parallel simulator threads do not"
+        " share a stream.",
+    )
     option(
         "--debug-activate",
         metavar="EXPR[,EXPR]",
@@ -315,6 +337,29 @@ def parse_options():
         split=":",
         help="Ignore EXPR sim objects",
     )
+    option(
+        "--event-profile",
+        metavar="FILE",
+        default="",
+        help="Profile the host time spent in events, by SimObject and event"
+        " type, and write it to FILE as folded stacks for flamegraph.pl."
+        " Event counts are written to FILE.counts.",
+    )
+    option(
+        "--event-profile-period",
+        metavar="N",
+        type="int",
+        default=1,
+        help="Only time one event out of N [Default: %default]",
+    )
+    option(
+        "--host-timeline",
+        metavar="FILE",
+        default="",
+        help="Record when the simulator threads run events, wait at"
+        " barriers, drain, dump stats or checkpoint, and write it to FILE"
+        " in the Chrome trace event format.",
+    )
     option(
         "--remote-gdb-port",
         type="int",
@@ -616,7 +661,12 @@ def main():
         e = event.create(trace.disable, event.Event.Debug_Enable_Pri)
         event.mainq.schedule(e, options.debug_end)
 
-    trace.output(options.debug_file)
+    if options.debug_binary:
+        trace.outputBinary(options.debug_file)
+    elif options.debug_per_queue:
+        trace.outputPerQueue(options.debug_file)
+    else:
+        trace.output(options.debug_file)
 
     for activate in options.debug_activate:
         _check_tracing()
@@ -626,6 +676,14 @@ def main():
         _check_tracing()
         trace.ignore(ignore)
 
+    if options.event_profile:
+        event.enableProfiler(
+            options.event_profile, options.event_profile_period
+        )
+
+    if options.host_timeline:
+        event.enableTimeline(options.host_timeline)
+
     sys.argv = arguments
 
     if options.m:
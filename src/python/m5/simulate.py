@@ -73,11 +73,21 @@ MaxTick = 2**64 - 1
 _drain_manager = _m5.drain.DrainManager.instance()
 
 _instantiated = False  # Has m5.instantiate() been called?
+_ini_config = None  # Set by m5.instantiateFromConfig()
 
 
 # The final call to instantiate the SimObject graph and initialize the
 # system.
-def instantiate(ckpt_dir=None):
+def instantiate(ckpt_dir=None, transplant=False, section_renames=None):
+    """Create the C++ objects of the configuration and initialize them.
+
+    :param ckpt_dir: Checkpoint to restore, if any.
+    :param transplant: Only restore the architectural state of the
+        checkpoint, so that it can be restored into a configuration with
+        different caches, predictors, or TLBs.
+    :param section_renames: Dictionary mapping the names of objects in
+        the checkpoint to their names in this configuration.
+    """
     global _instantiated
     from m5 import options
 
@@ -103,14 +113,23 @@ def instantiate(ckpt_dir=None):
     for obj in root.descendants():
         obj.unproxyParams()
 
-    if options.dump_config:
+    # Unproxying may still move parameters into the hierarchy, but
+    # from here on it is fixed. Walk it once and reuse the result (in
+    # the same order) for all the passes below.
+    all_objs = list(root.descendants())
+    for obj in all_objs:
+        obj.freezePath()
+
+    write_configs = not options.no_config_files
+
+    if write_configs and options.dump_config:
         ini_file = open(os.path.join(options.outdir, options.dump_config), "w")
         # Print ini sections in sorted order for easier diffing
-        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+        for obj in sorted(all_objs, key=lambda o: o.path()):
             obj.print_ini(ini_file)
         ini_file.close()
 
-    if options.json_config:
+    if write_configs and options.json_config:
         try:
             import json
 
@@ -123,7 +142,7 @@ def instantiate(ckpt_dir=None):
         except ImportError:
             pass
 
-    if options.dot_config:
+    if write_configs and options.dot_config:
         do_dot(root, options.outdir, options.dot_config)
         do_ruby_dot(root, options.outdir, options.dot_config)
 
@@ -131,13 +150,13 @@ def instantiate(ckpt_dir=None):
     stats.initSimStats()
 
     # Create the C++ sim objects and connect ports
-    for obj in root.descendants():
+    for obj in all_objs:
         obj.createCCObject()
-    for obj in root.descendants():
+    for obj in all_objs:
         obj.connectPorts()
 
     # Do a second pass to finish initializing the sim objects
-    for obj in root.descendants():
+    for obj in all_objs:
         obj.init()
 
     # Do a third pass to initialize statistics
@@ -145,11 +164,11 @@ def instantiate(ckpt_dir=None):
     root.regStats()
 
     # Do a fourth pass to initialize probe points
-    for obj in root.descendants():
+    for obj in all_objs:
         obj.regProbePoints()
 
     # Do a fifth pass to connect probe listeners
-    for obj in root.descendants():
+    for obj in all_objs:
         obj.regProbeListeners()
 
     # We want to generate the DVFS diagram for the system. This can only be
@@ -165,10 +184,13 @@ def instantiate(ckpt_dir=None):
     if ckpt_dir:
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
-        for obj in root.descendants():
+        ckpt.setTransplant(transplant)
+        for old_name, new_name in (section_renames or {}).items():
+            ckpt.renameSection(old_name, new_name)
+        for obj in all_objs:
             obj.loadState(ckpt)
     else:
-        for obj in root.descendants():
+        for obj in all_objs:
             obj.initState()
 
     # Check to see if any of the stat events are in the past after resuming from
@@ -178,6 +200,55 @@ def instantiate(ckpt_dir=None):
     gather_citations(root)
 
 
+def instantiateFromConfig(config_file, ckpt_dir=None, params=None):
+    """Instantiate the simulator from a config.ini file written by an
+    earlier run, instead of from Python SimObjects.
+
+    The objects are created by the C++ configuration manager straight
+    from the resolved parameters in the file, which skips running the
+    configuration scripts and building the SimObject tree. This needs a
+    build with the C++ configuration wrappers (--with-cxx-config).
+
+    :param config_file: The config.ini file to instantiate.
+    :param ckpt_dir: Checkpoint to restore, if any.
+    :param params: Parameters to override, as a dictionary mapping
+        (object path, parameter name) to a string value or a list of
+        string values.
+    """
+    global _instantiated
+    global _ini_config
+
+    if _instantiated:
+        fatal("m5.instantiate() called twice.")
+
+    _instantiated = True
+
+    ticks.fixGlobalFrequency()
+    stats.initSimStats()
+
+    import _m5.cxx_config
+
+    config = _m5.cxx_config.IniConfig(config_file)
+    for (obj, param), value in (params or {}).items():
+        if isinstance(value, (list, tuple)):
+            config.setParamVector(obj, param, list(value))
+        else:
+            config.setParam(obj, param, value)
+
+    config.instantiate()
+    stats.setRoot(config.getStatGroup("root"))
+    stats.enable()
+
+    if ckpt_dir:
+        _drain_manager.preCheckpointRestore()
+        config.loadState(ckpt_dir)
+    else:
+        config.initState()
+
+    updateStatEvents()
+    _ini_config = config
+
+
 need_startup = True
 
 
@@ -189,9 +260,12 @@ def simulate(*args, **kwargs):
         fatal("m5.instantiate() must be called before m5.simulate().")
 
     if need_startup:
-        root = objects.Root.getInstance()
-        for obj in root.descendants():
-            obj.startup()
+        if _ini_config:
+            _ini_config.startup()
+        else:
+            root = objects.Root.getInstance()
+            for obj in root.descendants():
+                obj.startup()
         need_startup = False
 
         # Python exit handlers happen in reverse order.
@@ -304,13 +378,31 @@ def drain():
         return False
 
     # Don't try to drain a system that is already drained
-    is_drained = _drain_manager.isDrained()
-    while not is_drained:
-        is_drained = _drain()
+    with _m5.event.TimelineSpan("drain"):
+        is_drained = _drain_manager.isDrained()
+        while not is_drained:
+            is_drained = _drain()
 
     assert _drain_manager.isDrained(), "Drain state inconsistent"
 
 
+def _drainObjects(objs):
+    """Drain a subset of the C++ objects, leaving the rest of the
+    simulator running.
+
+    Arguments:
+      objs -- C++ objects to drain
+    """
+
+    with _m5.event.TimelineSpan("drain"):
+        while not _drain_manager.tryDrainObjects(objs):
+            # WARNING: if a valid exit event occurs while draining, it
+            # will not get returned to the user script
+            exit_event = _m5.event.simulate()
+            while exit_event.getCause() != "Finished drain":
+                exit_event = simulate()
+
+
 def memWriteback(root):
     for obj in root.descendants():
         obj.memWriteback()
@@ -348,7 +440,7 @@ def _changeMemoryMode(system, mode):
         print("System already in target mode. Memory mode unchanged.")
 
 
-def switchCpus(system, cpuList, verbose=True):
+def switchCpus(system, cpuList, verbose=True, targeted_drain=False):
     """Switch CPUs in a system.
 
     .. note::
@@ -360,6 +452,9 @@ def switchCpus(system, cpuList, verbose=True):
     Arguments:
       system -- Simulated system.
       cpuList -- (old_cpu, new_cpu) tuples
+      targeted_drain -- Only drain the CPUs and their children, instead
+        of the whole simulator, when the memory mode doesn't change.
+        This makes frequent switches, e.g. for sampling, cheaper.
     """
 
     if verbose:
@@ -407,7 +502,20 @@ def switchCpus(system, cpuList, verbose=True):
     except KeyError:
         raise RuntimeError(f"Invalid memory mode ({memory_mode_name})")
 
-    drain()
+    # A memory mode change needs the whole memory system to be drained,
+    # otherwise draining the CPUs is enough to hand them over.
+    drained_objs = None
+    if targeted_drain and system.getMemoryMode() == memory_mode:
+        drained_objs = list(
+            {
+                id(obj): obj.getCCObject()
+                for cpu in old_cpus + new_cpus
+                for obj in cpu.descendants()
+            }.values()
+        )
+        _drainObjects(drained_objs)
+    else:
+        drain()
 
     # Now all of the CPUs are ready to be switched out
     for old_cpu, new_cpu in cpuList:
@@ -428,6 +536,56 @@ def switchCpus(system, cpuList, verbose=True):
     for old_cpu, new_cpu in cpuList:
         new_cpu.takeOverFrom(old_cpu)
 
+    if drained_objs is not None:
+        _drain_manager.resumeObjects(drained_objs)
+
+
+def switchCpusToGenerators(system, genList, verbose=True):
+    """Switch CPUs in a system out for traffic generators.
+
+    Each generator takes over the data port of its CPU, so that it can
+    replay traffic, e.g. a trace the CPU's requests were recorded to
+    with a MemTraceProbe, into the caches and memory the CPU was using.
+    The generators must be created with switched_out set, and the
+    memory system is switched to timing mode if needed.
+
+    Arguments:
+      system -- Simulated system.
+      genList -- (old_cpu, generator) tuples
+    """
+
+    if verbose:
+        print("switching cpus to traffic generators")
+
+    if not isinstance(genList, list):
+        raise RuntimeError("Must pass a list to this function")
+    for item in genList:
+        if not isinstance(item, tuple) or len(item) != 2:
+            raise RuntimeError("List must have tuples of (oldCPU,generator)")
+
+    for old_cpu, gen in genList:
+        if not isinstance(old_cpu, objects.BaseCPU):
+            raise TypeError(f"{old_cpu} is not of type BaseCPU")
+        if not isinstance(gen, objects.BaseTrafficGen):
+            raise TypeError(f"{gen} is not of type BaseTrafficGen")
+        if not gen.switched_out:
+            raise RuntimeError(f"Generator ({gen}) is already connected.")
+        if old_cpu.switchedOut():
+            raise RuntimeError(f"Old CPU ({old_cpu}) is inactive.")
+
+    drain()
+
+    for old_cpu, gen in genList:
+        old_cpu.switchOut()
+
+    MemoryMode = params.allEnums["MemoryMode"]
+    timing = MemoryMode("timing").getValue()
+    if system.getMemoryMode() != timing:
+        _changeMemoryMode(system, timing)
+
+    for old_cpu, gen in genList:
+        gen.takeOverFrom(old_cpu)
+
 
 def notifyFork(root):
     for obj in root.descendants():
@@ -45,11 +45,13 @@ from m5.util import (
     fatal,
 )
 
+import _m5.event
 import _m5.stats
 
 # Stat exports
 from _m5.stats import periodicStatDump
 from _m5.stats import schedStatEvent as schedEvent
+from _m5.stats import setLazyStorage
 
 from .gem5stats import JsonOutputVistor
 
@@ -154,7 +156,9 @@ def _textFactory(fn, desc=True, spaces=True):
 
 
 @_url_factory(["h5"], enable=hasattr(_m5.stats, "initHDF5"))
-def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
+def _hdf5Factory(
+    fn, chunking=10, desc=True, formulas=True, compression=1, threaded=False
+):
     """Output stats in HDF5 format.
 
     The HDF5 file format is a structured binary file format. It has
@@ -181,13 +185,42 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
       * chunking (unsigned): Number of time steps to pre-allocate (default: 10)
       * desc (bool): Output stat descriptions (default: True)
       * formulas (bool): Output derived stats (default: True)
+      * compression (unsigned): Deflate level from 0 (no compression) to 9
+        (default: 1)
+      * threaded (bool): Write the file on a separate thread, so that the
+        simulation only waits for the values to be captured (default: False)
 
     Example:
       h5://stats.h5?desc=False;chunking=100;formulas=False
+      h5://stats.h5?chunking=100;compression=0;threaded=True
 
     """
 
-    return _m5.stats.initHDF5(fn, chunking, desc, formulas)
+    return _m5.stats.initHDF5(
+        fn, chunking, desc, formulas, compression, threaded
+    )
+
+
+@_url_factory(["col"])
+def _columnarFactory(fn):
+    """Output stats in a streaming, columnar binary format.
+
+    Every stat is assigned a fixed set of columns the first time it is
+    dumped. Later dumps only store the columns that changed since the
+    previous dump, or a dense row if most of them did, which keeps
+    frequent periodic dumps cheap both in time and in file size. The
+    file can be read back with m5.stats.columnar.
+
+    Known limitations:
+      * Sparse histograms are unsupported.
+      * No support for forking.
+
+    Example:
+      col://stats.col
+
+    """
+
+    return _m5.stats.initColumnar(fn)
 
 
 @_url_factory(["json"])
@@ -252,6 +285,22 @@ def printStatVisitorTypes():
         print_doc(inspect.getdoc(factory))
 
 
+# Root of the stat hierarchy if there is no Python Root object, i.e.
+# when the simulator was instantiated from a config file
+_root = None
+
+
+def setRoot(root):
+    """Use a C++ stat group as the root of the stat hierarchy."""
+    global _root
+    _root = root
+
+
+def _getRoot():
+    root = Root.getInstance()
+    return root if root else _root
+
+
 def initSimStats():
     _m5.stats.initSimStats()
     _m5.stats.registerPythonStatsHandlers()
@@ -259,7 +308,7 @@ def initSimStats():
 
 def _visit_groups(visitor, root=None):
     if root is None:
-        root = Root.getInstance()
+        root = _getRoot()
     for group in root.getStatGroups().values():
         visitor(group)
         _visit_groups(visitor, root=group)
@@ -376,7 +425,7 @@ def _dump_to_visitor(visitor, roots=None):
                 visitor.endGroup()
     else:
         # New stats starting from root.
-        dump_group(Root.getInstance())
+        dump_group(_getRoot())
 
         # Legacy stats
         for stat in stats_list:
@@ -391,6 +440,11 @@ global_dump_roots = []
 def dump(roots=None):
     """Dump all statistics data to the registered outputs"""
 
+    with _m5.event.TimelineSpan("stats dump"):
+        _dump(roots)
+
+
+def _dump(roots):
     all_roots = []
     if roots is not None:
         all_roots.extend(roots)
@@ -412,29 +466,35 @@ def dump(roots=None):
     if new_dump:
         _m5.stats.processDumpQueue()
         # Notify new-style stats group that we are about to dump stats.
-        sim_root = Root.getInstance()
+        sim_root = _getRoot()
         if sim_root:
             sim_root.preDumpStats()
         prepare()
 
-    for output in outputList:
-        if isinstance(output, JsonOutputVistor):
-            if not all_roots:
-                output.dump(Root.getInstance())
+    # Nothing changes the stats while they are written out, so formulas
+    # only need to be computed once for all the outputs.
+    _m5.stats.beginFormulaCache()
+    try:
+        for output in outputList:
+            if isinstance(output, JsonOutputVistor):
+                if not all_roots:
+                    output.dump(Root.getInstance())
+                else:
+                    output.dump(all_roots)
             else:
-                output.dump(all_roots)
-        else:
-            if output.valid():
-                output.begin()
-                _dump_to_visitor(output, roots=all_roots)
-                output.end()
+                if output.valid():
+                    output.begin()
+                    _dump_to_visitor(output, roots=all_roots)
+                    output.end()
+    finally:
+        _m5.stats.endFormulaCache()
 
 
 def reset():
     """Reset all statistics to the base state"""
 
     # call reset stats on all SimObjects
-    root = Root.getInstance()
+    root = _getRoot()
     if root:
         root.resetStats()
 
@@ -445,6 +505,36 @@ def reset():
     _m5.stats.processResetQueue()
 
 
+def snapshot(patterns=None, root=None):
+    """Capture a selection of stats into a flat, reusable snapshot
+
+    The stats are selected once by matching their full names (e.g.,
+    "system.cpu.ipc") against a list of regular expressions. Calling
+    update() on the returned object refreshes the values in place,
+    which is much cheaper than walking the stat tree when a script only
+    polls a few stats between simulate() calls. The snapshot exposes
+    the values through the buffer protocol, so numpy.asarray() returns
+    a read-only view that follows every update without copying.
+
+    Example:
+      snap = m5.stats.snapshot([r"system\.cpu\.(ipc|numCycles)"])
+      values = numpy.asarray(snap)
+      ...
+      snap.update()
+      print(snap.version, dict(zip(snap.names, values)))
+
+    :param patterns: Regular expressions matching the stats to capture.
+                     All supported stats are captured if None.
+    :param root: Group to capture stats from, Root by default.
+    """
+
+    if root is None:
+        root = _getRoot()
+    snap = _m5.stats.Snapshot(root, list(patterns or []))
+    snap.update()
+    return snap
+
+
 flags = attrdict(
     {
         "none": 0x0000,
@@ -456,5 +546,6 @@ flags = attrdict(
         "dist": 0x0080,
         "nozero": 0x0100,
         "nonan": 0x0200,
+        "lazy": 0x0800,
     }
 )
@@ -0,0 +1,155 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Reader for the columnar binary stats format written by the col:// stats
+output (see src/base/stats/columnar.hh).
+
+The file is a sequence of records. Schema records describe the columns
+of a stat the first time it is dumped, dump records either hold the
+columns that changed since the previous dump or every column. This
+module replays the records and yields the full row of every dump.
+
+Example:
+
+    from m5.stats.columnar import ColumnarReader
+
+    reader = ColumnarReader("m5out/stats.col")
+    for tick, row in reader:
+        print(tick, row[reader.column("system.cpu.numCycles")])
+"""
+
+import struct
+from typing import (
+    BinaryIO,
+    Dict,
+    Iterator,
+    List,
+    NamedTuple,
+    Tuple,
+)
+
+MAGIC = b"gem5col\0"
+VERSION = 1
+
+
+class ColumnarStat(NamedTuple):
+    name: str
+    unit: str
+    desc: str
+    first: int
+    columns: List[str]
+
+
+class ColumnarReader:
+    """Read a columnar stats file dump by dump."""
+
+    def __init__(self, filename: str):
+        self._filename = filename
+        self.stats: Dict[str, ColumnarStat] = {}
+        self.names: List[str] = []
+
+    def _read(self, f: BinaryIO, fmt: str):
+        size = struct.calcsize(fmt)
+        data = f.read(size)
+        if len(data) != size:
+            raise EOFError(f"Truncated columnar stats file {self._filename}")
+        return struct.unpack(fmt, data)
+
+    def _read_string(self, f: BinaryIO) -> str:
+        (length,) = self._read(f, "<I")
+        return f.read(length).decode()
+
+    def _read_schema(self, f: BinaryIO) -> None:
+        (first,) = self._read(f, "<I")
+        name = self._read_string(f)
+        unit = self._read_string(f)
+        desc = self._read_string(f)
+        (count,) = self._read(f, "<I")
+        columns = [self._read_string(f) for _ in range(count)]
+        if first != len(self.names):
+            raise ValueError(f"Unexpected first column for {name}")
+
+        self.stats[name] = ColumnarStat(name, unit, desc, first, columns)
+        self.names += [f"{name}::{c}" if c else name for c in columns]
+
+    def __iter__(self) -> Iterator[Tuple[int, List[float]]]:
+        self.stats = {}
+        self.names = []
+        row: List[float] = []
+
+        with open(self._filename, "rb") as f:
+            if f.read(len(MAGIC)) != MAGIC:
+                raise ValueError(f"{self._filename} is not a columnar file")
+            (version,) = self._read(f, "<I")
+            if version != VERSION:
+                raise ValueError(f"Unsupported columnar version {version}")
+
+            while True:
+                kind = f.read(1)
+                if not kind:
+                    return
+                elif kind == b"S":
+                    self._read_schema(f)
+                    row += [0.0] * (len(self.names) - len(row))
+                elif kind == b"D":
+                    tick, count = self._read(f, "<QI")
+                    for col, val in struct.iter_unpack(
+                        "<Id", f.read(count * 12)
+                    ):
+                        row[col] = val
+                    yield tick, list(row)
+                elif kind == b"F":
+                    tick, count = self._read(f, "<QI")
+                    row = list(self._read(f, f"<{count}d"))
+                    yield tick, list(row)
+                else:
+                    raise ValueError(f"Unknown record type {kind!r}")
+
+    def column(self, name: str) -> int:
+        """Index of a column in the rows, e.g. "system.cpu.ipc" or
+        "system.cpu.op_class::IntAlu" for a named column of a stat."""
+        return self.names.index(name)
+
+    def to_columns(self) -> Tuple[List[int], Dict[str, List[float]]]:
+        """Read the whole file and return the dump ticks together with
+        a time series of every column.
+
+        Columns that did not exist yet because their stat had not been
+        dumped are padded with zeros.
+        """
+        ticks = []
+        rows = []
+        for tick, row in self:
+            ticks.append(tick)
+            rows.append(row)
+
+        series = {name: [] for name in self.names}
+        for row in rows:
+            row += [0.0] * (len(self.names) - len(row))
+            for name, val in zip(self.names, row):
+                series[name].append(val)
+        return ticks, series
@@ -109,6 +109,8 @@ init_drain(py::module_ &m_native)
         m, "DrainManager")
         .def("tryDrain", &DrainManager::tryDrain)
         .def("resume", &DrainManager::resume)
+        .def("tryDrainObjects", &DrainManager::tryDrainObjects)
+        .def("resumeObjects", &DrainManager::resumeObjects)
         .def("preCheckpointRestore", &DrainManager::preCheckpointRestore)
         .def("isDrained", &DrainManager::isDrained)
         .def("state", &DrainManager::state)
@@ -128,6 +130,8 @@ init_serialize(py::module_ &m_native)
         ;
 
     py::class_<CheckpointIn>(m, "CheckpointIn")
+        .def("setTransplant", &CheckpointIn::setTransplant)
+        .def("renameSection", &CheckpointIn::renameSection)
         ;
 }
 
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "pybind11/pybind11.h"
+#include "pybind11/stl.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/stats/group.hh"
+#include "python/pybind11/pybind.hh"
+#include "sim/cxx_config_ini.hh"
+#include "sim/cxx_manager.hh"
+#include "sim/init.hh"
+#include "sim/serialize.hh"
+#include "sim/sim_object.hh"
+
+namespace py = pybind11;
+
+namespace gem5
+{
+
+namespace
+{
+
+/**
+ * A configuration loaded from a config.ini file, which is instantiated
+ * directly in C++ without building the Python SimObject tree. This
+ * needs a build with the C++ configuration wrappers (--with-cxx-config).
+ */
+class IniConfig
+{
+  public:
+    explicit IniConfig(const std::string &config_file)
+    {
+        if (!ini.load(config_file))
+            throw std::runtime_error("Can't open config file: " +
+                                     config_file);
+        manager.reset(new CxxConfigManager(ini));
+    }
+
+    CxxIniFile ini;
+    std::unique_ptr<CxxConfigManager> manager;
+};
+
+void
+cxxconfig_pybind(py::module_ &m_internal)
+{
+    py::module_ m = m_internal.def_submodule("cxx_config");
+
+    py::register_exception_translator([](std::exception_ptr p) {
+        try {
+            if (p)
+                std::rethrow_exception(p);
+        } catch (const CxxConfigManager::Exception &e) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            (e.name.empty() ? e.message :
+                             e.name + ": " + e.message).c_str());
+        }
+    });
+
+    py::class_<IniConfig>(m, "IniConfig")
+        .def(py::init<const std::string &>())
+        .def("setParam", [](IniConfig &self, const std::string &object,
+                            const std::string &param,
+                            const std::string &value) {
+                self.manager->setParam(object, param, value);
+            })
+        .def("setParamVector", [](IniConfig &self,
+                                  const std::string &object,
+                                  const std::string &param,
+                                  const std::vector<std::string> &values) {
+                self.manager->setParamVector(object, param, values);
+            })
+        .def("instantiate", [](IniConfig &self) {
+                self.manager->instantiate();
+            })
+        .def("initState", [](IniConfig &self) {
+                self.manager->initState();
+            })
+        .def("startup", [](IniConfig &self) {
+                self.manager->startup();
+            })
+        .def("loadState", [](IniConfig &self, const std::string &cpt_dir) {
+                SimObject::setSimObjectResolver(
+                    &self.manager->getSimObjectResolver());
+                CheckpointIn checkpoint(cpt_dir);
+                self.manager->loadState(checkpoint);
+            })
+        .def("getStatGroup", [](IniConfig &self, const std::string &name) {
+                return static_cast<statistics::Group *>(
+                    &self.manager->getObject<SimObject>(name));
+            }, py::return_value_policy::reference)
+        ;
+}
+EmbeddedPyBind embed_("cxx_config", &cxxconfig_pybind);
+
+} // anonymous namespace
+} // namespace gem5
@@ -45,11 +45,14 @@
 #include <map>
 #include <vector>
 
+#include "base/binary_logger.hh"
 #include "base/compiler.hh"
 #include "base/debug.hh"
 #include "base/output.hh"
 #include "base/trace.hh"
+#include "sim/core.hh"
 #include "sim/debug.hh"
+#include "sim/queue_logger.hh"
 
 namespace py = pybind11;
 
@@ -67,6 +70,25 @@ output(const char *filename)
     trace::setDebugLogger(new trace::OstreamLogger(*file_stream->stream()));
 }
 
+static void
+outputBinary(const char *filename)
+{
+    auto *logger = new trace::BinaryLogger(simout.create(filename, true));
+    trace::setDebugLogger(logger);
+
+    // The logger is never deleted, make sure its buffers get written
+    registerExitCallback([logger]() { logger->flush(); });
+}
+
+static void
+outputPerQueue(const char *filename)
+{
+    auto *logger = new trace::QueueLogger(filename);
+    trace::setDebugLogger(logger);
+
+    registerExitCallback([logger]() { logger->flush(); });
+}
+
 static void
 activate(const char *expr)
 {
@@ -129,6 +151,8 @@ pybind_init_debug(py::module_ &m_native)
     py::module_ m_trace = m_native.def_submodule("trace");
     m_trace
         .def("output", &output)
+        .def("outputBinary", &outputBinary)
+        .def("outputPerQueue", &outputPerQueue)
         .def("activate", &activate)
         .def("ignore", &ignore)
         .def("enable", &trace::enable)
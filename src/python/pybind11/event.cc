@@ -44,7 +44,11 @@
 #include "pybind11/stl.h"
 
 #include "base/logging.hh"
+#include "base/output.hh"
+#include "sim/core.hh"
+#include "sim/event_profiler.hh"
 #include "sim/eventq.hh"
+#include "sim/host_timeline.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
 #include "sim/simulate.hh"
@@ -73,6 +77,7 @@ class PyEvent : public Event
     }
 
     void process() override {
+        host_timeline::Span span("python event");
         // Call the Python implementation as __call__. This provides a
         // slightly more Python-friendly interface.
         PYBIND11_OVERLOAD_PURE_NAME(void, PyEvent, "__call__", process);
@@ -100,6 +105,93 @@ class PyEvent : public Event
     }
 };
 
+/**
+ * Profile the host time spent in events and write the folded stacks
+ * to filename and filename.counts at exit.
+ */
+static void
+enableProfiler(const std::string &filename, unsigned period)
+{
+    event_profiler::enable(period);
+
+    registerExitCallback([filename]() {
+        OutputStream *nanoseconds = simout.create(filename);
+        OutputStream *events = simout.create(filename + ".counts");
+        event_profiler::dump(*nanoseconds->stream(), *events->stream());
+        simout.close(nanoseconds);
+        simout.close(events);
+    });
+}
+
+/**
+ * Record the host timeline of the simulator threads and write it to
+ * filename at exit.
+ */
+static void
+enableTimeline(const std::string &filename)
+{
+    host_timeline::enable();
+
+    registerExitCallback([filename]() {
+        OutputStream *os = simout.create(filename);
+        host_timeline::dump(*os->stream());
+        simout.close(os);
+    });
+}
+
+/** A host timeline span for Python, used as a context manager. */
+class PyTimelineSpan
+{
+  private:
+    const char *const name;
+    uint64_t begin = 0;
+
+  public:
+    PyTimelineSpan(const std::string &_name)
+        : name(host_timeline::intern(_name))
+    {}
+
+    void
+    enter()
+    {
+        if (host_timeline::enabled)
+            begin = host_timeline::now();
+    }
+
+    void
+    exit()
+    {
+        if (begin)
+            host_timeline::record(name, -1, begin, host_timeline::now());
+        begin = 0;
+    }
+};
+
+/**
+ * Describe the state and the activity of a queue since the start of
+ * the simulation.
+ */
+static py::dict
+queueStats(const EventQueue *eq)
+{
+    const auto &counters = eq->getCounters();
+    const auto depths = eq->binDepths();
+
+    py::dict stats;
+    stats["scheduled"] = counters.scheduled;
+    stats["async_merged"] = counters.asyncMerged;
+    stats["descheduled"] = counters.descheduled;
+    stats["rescheduled"] = counters.rescheduled;
+    stats["serviced"] = counters.serviced;
+    stats["squashed"] = counters.squashed;
+    stats["barrier_waits"] = counters.barrierWaits;
+    stats["barrier_wait_seconds"] = counters.barrierWaitNs / 1e9;
+    stats["schedule_distance"] = std::vector<uint64_t>(
+        counters.distance.begin(), counters.distance.end());
+    stats["bin_depths"] = depths;
+    return stats;
+}
+
 void
 pybind_init_event(py::module_ &m_native)
 {
@@ -111,15 +203,31 @@ pybind_init_event(py::module_ &m_native)
     m.def("getMaxTick", &get_max_tick, py::return_value_policy::copy);
     m.def("terminateEventQueueThreads", &terminateEventQueueThreads);
     m.def("exitSimLoop", &exitSimLoop);
+    m.def("enableProfiler", &enableProfiler,
+          py::arg("filename"), py::arg("period") = 1);
+    m.def("enableTimeline", &enableTimeline, py::arg("filename"));
+
+    py::class_<PyTimelineSpan>(m, "TimelineSpan")
+        .def(py::init<const std::string &>())
+        .def("__enter__", [](PyTimelineSpan &span) {
+                span.enter();
+                return &span;
+            }, py::return_value_policy::reference)
+        .def("__exit__", [](PyTimelineSpan &span, py::args) {
+                span.exit();
+            })
+        ;
     m.def("getEventQueue", []() { return curEventQueue(); },
           py::return_value_policy::reference);
     m.def("setEventQueue", [](EventQueue *q) { return curEventQueue(q); });
     m.def("getEventQueue", &getEventQueue,
           py::return_value_policy::reference);
+    m.def("numEventQueues", []() { return numMainEventQueues; });
 
     py::class_<EventQueue>(m, "EventQueue")
         .def("name",  [](EventQueue *eq) { return eq->name(); })
         .def("dump", &EventQueue::dump)
+        .def("stats", &queueStats)
         .def("schedule", [](EventQueue *eq, PyEvent *e, Tick t) {
                 eq->schedule(e, t);
             }, py::arg("event"), py::arg("when"))
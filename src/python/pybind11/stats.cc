@@ -42,6 +42,9 @@
 #include "pybind11/stl.h"
 
 #include "base/statistics.hh"
+#include "base/stats/columnar.hh"
+#include "base/stats/snapshot.hh"
+#include "base/stats/storage.hh"
 #include "base/stats/text.hh"
 #include "config/have_hdf5.hh"
 
@@ -113,6 +116,7 @@ pybind_init_stats(py::module_ &m_native)
         .def("initSimStats", &statistics::initSimStats)
         .def("initText", &statistics::initText,
             py::return_value_policy::reference)
+        .def("initColumnar", &statistics::initColumnar)
 #if HAVE_HDF5
         .def("initHDF5", &statistics::initHDF5)
 #endif
@@ -123,9 +127,12 @@ pybind_init_stats(py::module_ &m_native)
         .def("updateEvents", &statistics::updateEvents)
         .def("processResetQueue", &statistics::processResetQueue)
         .def("processDumpQueue", &statistics::processDumpQueue)
+        .def("beginFormulaCache", &statistics::beginFormulaCache)
+        .def("endFormulaCache", &statistics::endFormulaCache)
         .def("enable", &statistics::enable)
         .def("enabled", &statistics::enabled)
         .def("statsList", &statistics::statsList)
+        .def("setLazyStorage", &statistics::setLazyStorage)
         ;
 
     py::class_<statistics::Output>(m, "Output")
@@ -268,6 +275,22 @@ pybind_init_stats(py::module_ &m_native)
                  return cast_stat_info(stat);
              })
         ;
+
+    py::class_<statistics::Snapshot>(m, "Snapshot", py::buffer_protocol())
+        .def(py::init<const statistics::Group &,
+                      const std::vector<std::string> &>(),
+             py::keep_alive<1, 2>())
+        .def("update", &statistics::Snapshot::update)
+        .def_property_readonly("names", &statistics::Snapshot::names)
+        .def_property_readonly("changed", &statistics::Snapshot::changed)
+        .def_property_readonly("version", &statistics::Snapshot::version)
+        .def_buffer([](statistics::Snapshot &self) -> py::buffer_info {
+                // The values never move, so expose them without a copy.
+                // The buffer is read-only as update() owns the contents.
+                const std::vector<double> &values = self.values();
+                return py::buffer_info(values.data(), values.size());
+            })
+        ;
 }
 
 } // namespace gem5
@@ -67,6 +67,89 @@ class Root(SimObject):
     # Needs to be set explicitly for a multi-eventq simulation.
     sim_quantum = Param.Tick(0, "simulation quantum")
 
+    # Upper bound for an adaptive simulation quantum. When larger than
+    # sim_quantum, the period between synchronizations doubles for as long as
+    # threads rarely access another thread's event queue (e.g., KVM CPUs doing
+    # MMIO to devices) and drops back to sim_quantum as soon as they do more
+    # often. The accesses are counted per sim_quantum of simulated time: at
+    # most sim_quantum_grow_accesses let the quantum grow, and more than
+    # sim_quantum_shrink_accesses reset it. In between, it stays the same. By
+    # default, a single access resets it. The quantum also only grows if the
+    # last one took less than sim_quantum_target_host_ns of host time, when
+    # that is set, since longer quanta don't gain much from fewer barriers.
+    sim_max_quantum = Param.Tick(
+        0, "maximum adaptive simulation quantum (0: fixed sim_quantum)"
+    )
+    sim_quantum_grow_accesses = Param.UInt64(
+        0,
+        "cross-queue accesses per sim_quantum up to which the adaptive "
+        "quantum grows",
+    )
+    sim_quantum_shrink_accesses = Param.UInt64(
+        0,
+        "cross-queue accesses per sim_quantum above which the adaptive "
+        "quantum is reset",
+    )
+    sim_quantum_target_host_ns = Param.UInt64(
+        0,
+        "host time per quantum below which the adaptive quantum grows "
+        "(0: any)",
+    )
+
+    # Lookahead for conservative multiple main event queue simulation. When
+    # set, the queues synchronize at the earliest pending event plus the
+    # lookahead rather than every sim_quantum, which lets them skip over
+    # periods where no queue has work. It must not exceed the minimum latency
+    # of any path between objects on different event queues.
+    sim_lookahead = Param.Tick(
+        0,
+        "minimum cross-queue latency for lookahead-based synchronization "
+        "(mutually exclusive with sim_quantum)",
+    )
+
+    # Number of host threads used to run the main event queues. By default
+    # there is one thread per queue. With fewer threads, the queues are
+    # partitioned dynamically among the threads in every quantum, so a
+    # simulation can be split into many small queues without needing as many
+    # host cores. This mode is not compatible with KVM CPUs, which need to
+    # stay on the thread that created them.
+    sim_threads = Param.Unsigned(
+        0,
+        "number of host threads for multi-eventq simulation "
+        "(0: one per queue)",
+    )
+
+    # Host CPUs to pin the simulator threads to. The thread running event
+    # queue i is pinned to entry i modulo the length of the list.
+    sim_thread_affinity = VectorParam.Int(
+        [], "host CPUs to pin the simulator threads to (Linux only)"
+    )
+
+    # The main event queues keep pending events in a list sorted by time and
+    # priority. Simulations with many pending events (e.g., large Ruby
+    # networks) are faster with a calendar queue. The order in which events
+    # are processed is the same in both cases.
+    calendar_event_queues = Param.Bool(
+        False, "use calendar queues for the main event queues"
+    )
+
+    # Events that a thread schedules on another thread's queue are merged at
+    # the end of each quantum. By default they are merged in the order in
+    # which the threads posted them, which can change from one run to the
+    # next. In deterministic mode they are sorted by time, priority, source
+    # queue and the order in which the source queue posted them, so parallel
+    # simulations give the same results on every run.
+    deterministic_parallel = Param.Bool(
+        False, "merge cross-queue events in a reproducible order"
+    )
+
+    # Binary checkpoints keep numbers in their in-memory representation and
+    # are indexed, which makes large checkpoints much faster to create and
+    # restore. util/cpt_to_ini.py converts them to the INI text format.
+    binary_checkpoints = Param.Bool(
+        False, "create checkpoints in the binary format"
+    )
+
     full_system = Param.Bool("if this is a full system simulation")
 
     # Time syncing prevents the simulation from running faster than real time.
@@ -49,6 +49,10 @@ class MemoryMode(Enum):
     vals = ["invalid", "atomic", "timing", "atomic_noncaching"]
 
 
+class MemoryCheckpointFormat(ScopedEnum):
+    vals = ["gzip", "raw", "delta"]
+
+
 class System(SimObject):
     type = "System"
     cxx_header = "sim/system.hh"
@@ -59,6 +63,8 @@ class System(SimObject):
     cxx_exports = [
         PyBindMethod("getMemoryMode"),
         PyBindMethod("setMemoryMode"),
+        PyBindMethod("getWorkBeginEvents"),
+        PyBindMethod("getWorkEndEvents"),
     ]
 
     memories = VectorParam.AbstractMemory(
@@ -104,15 +110,66 @@ class System(SimObject):
         "shared_backstore is non-empty.",
     )
 
+    # Systems booting the same image, in one process or in several as
+    # with dist-gem5, end up with many identical pages. The host kernel
+    # can merge them copy-on-write (KSM on Linux, which has to be
+    # enabled through /sys/kernel/mm/ksm/run).
+    mergeable_backstore = Param.Bool(
+        False,
+        "Let the host kernel merge the identical pages of the backing "
+        "store with other pages of this or other processes.",
+    )
+
+    # Checkpointing a large memory as a single gzipped image is slow,
+    # both when writing and when restoring it. A raw image is mapped
+    # copy-on-write when restoring, and a delta only contains the
+    # pages that differ from the raw image the memory was restored
+    # from, or the pages that are not zero if there is no such image.
+    memory_checkpoint_format = Param.MemoryCheckpointFormat(
+        "gzip",
+        "Format of the backing store in checkpoints (gzip, raw or delta)",
+    )
+    lazy_memory_restore = Param.Bool(
+        False,
+        "Only read the pages of a delta memory checkpoint when they are "
+        "first accessed",
+    )
+    # Simulations restoring the same gzipped checkpoint, e.g. in a
+    # farm, can share its memory: the first one decompresses it into
+    # this directory, and all of them map the image copy-on-write as
+    # they do with raw checkpoints. The directory is not cleaned up.
+    memory_image_cache = Param.String(
+        "",
+        "Directory to decompress gzipped memory checkpoints into, shared "
+        "by the simulations restoring them (empty: disabled)",
+    )
+
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
     redirect_paths = VectorParam.RedirectPath([], "Path redirections")
 
+    stats_insts_window = Param.Latency(
+        "0ns",
+        "Merge the non periodic statistics dumps and resets requested by "
+        "pseudo instructions within this time of the previous one into a "
+        "single operation at the end of the window, 0 to disable",
+    )
+
     exit_on_work_items = Param.Bool(
         False,
         "Exit from the simulation loop when "
         "encountering work item annotations.",
     )
+    work_item_exit_batch = Param.Unsigned(
+        1,
+        "With exit_on_work_items, only exit from the simulation loop once "
+        "every this many work item begins, and as many ends",
+    )
+    work_item_exit_ids = VectorParam.Int(
+        [],
+        "With exit_on_work_items, work item ids which exit from the "
+        "simulation loop every time regardless of work_item_exit_batch",
+    )
     work_item_id = Param.Int(-1, "specific work item id")
     num_work_ids = Param.Int(16, "Number of distinct work item types")
     work_begin_cpu_id_exit = Param.Int(
@@ -136,6 +136,12 @@ class SEWorkload(Workload, metaclass=SEWorkloadMeta):
     cxx_class = "gem5::SEWorkload"
     abstract = True
 
+    thread_quantum = Param.Latency(
+        "0ns",
+        "Time slice of guest threads when they outnumber the thread "
+        "contexts, 0 makes clone() fail when no context is free",
+    )
+
     @classmethod
     def _is_compatible_with(cls, obj):
         return False
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/binary_checkpoint.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "base/inifile.hh"
+#include "base/logging.hh"
+#include "sim/serialize_handlers.hh"
+
+namespace gem5
+{
+
+namespace binary_checkpoint
+{
+
+namespace
+{
+
+template <class T>
+void
+showValues(std::ostream &os, std::string_view data, uint64_t count)
+{
+    for (uint64_t i = 0; i < count; ++i) {
+        T value;
+        std::memcpy(&value, data.data() + i * sizeof(T), sizeof(T));
+        if (i)
+            os << " ";
+        ShowParam<T>::show(os, value);
+    }
+}
+
+template <class T>
+void
+writeValue(std::ostream &os, const T &value)
+{
+    os.write((const char *)&value, sizeof(value));
+}
+
+void
+writeString(std::ostream &os, std::string_view str)
+{
+    writeValue<uint64_t>(os, str.size());
+    os.write(str.data(), str.size());
+}
+
+/** Reads the contents of a binary checkpoint file. */
+class Reader
+{
+  public:
+    Reader(const std::string &filename, std::string_view contents)
+        : filename(filename), contents(contents)
+    {}
+
+    template <class T>
+    T
+    get()
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(T)).data(), sizeof(T));
+        return value;
+    }
+
+    std::string_view getString() { return take(get<uint64_t>()); }
+
+    std::string_view
+    take(uint64_t size)
+    {
+        fatal_if(size > contents.size(),
+                 "Binary checkpoint '%s' is truncated.", filename);
+        std::string_view data = contents.substr(0, size);
+        contents.remove_prefix(size);
+        return data;
+    }
+
+  private:
+    const std::string &filename;
+    std::string_view contents;
+};
+
+uint64_t
+typeSize(Type type)
+{
+    switch (type) {
+      case Type::Text:
+      case Type::Bool:
+      case Type::Int8:
+      case Type::UInt8:
+        return 1;
+      case Type::Int16:
+      case Type::UInt16:
+        return 2;
+      case Type::Int32:
+      case Type::UInt32:
+      case Type::Float:
+        return 4;
+      case Type::Int64:
+      case Type::UInt64:
+      case Type::Double:
+        return 8;
+      default:
+        return 0;
+    }
+}
+
+} // anonymous namespace
+
+std::string
+Entry::text() const
+{
+    std::ostringstream os;
+    switch (type) {
+      case Type::Text: return std::string(data);
+      case Type::Bool: showValues<bool>(os, data, count); break;
+      case Type::Int8: showValues<int8_t>(os, data, count); break;
+      case Type::UInt8: showValues<uint8_t>(os, data, count); break;
+      case Type::Int16: showValues<int16_t>(os, data, count); break;
+      case Type::UInt16: showValues<uint16_t>(os, data, count); break;
+      case Type::Int32: showValues<int32_t>(os, data, count); break;
+      case Type::UInt32: showValues<uint32_t>(os, data, count); break;
+      case Type::Int64: showValues<int64_t>(os, data, count); break;
+      case Type::UInt64: showValues<uint64_t>(os, data, count); break;
+      case Type::Float: showValues<float>(os, data, count); break;
+      case Type::Double: showValues<double>(os, data, count); break;
+    }
+    return os.str();
+}
+
+Out::~Out()
+{
+    close();
+}
+
+void
+Out::close()
+{
+    if (closed)
+        return;
+    closed = true;
+
+    // Everything that was not added as binary entries is text in the
+    // INI format, section headers included.
+    IniFile ini;
+    std::istringstream text(str());
+    fatal_if(!ini.load(text), "Malformed checkpoint text for '%s'.",
+             filename);
+    std::vector<std::string> names;
+    ini.getSectionNames(names);
+    for (const auto &name : names) {
+        auto &section = sections[name];
+        ini.visitSection(name,
+            [&section](const std::string &key, const std::string &value) {
+                section.try_emplace(key, OutEntry{Type::Text, 1, value});
+            });
+    }
+
+    std::ofstream os(filename, std::ios::binary);
+    fatal_if(!os, "Unable to open file %s for writing.", filename);
+
+    os.write(Magic, sizeof(Magic));
+    writeValue<uint32_t>(os, Version);
+    writeValue<uint32_t>(os, sections.size());
+    for (const auto &[name, entries] : sections) {
+        writeString(os, name);
+        writeValue<uint32_t>(os, entries.size());
+        for (const auto &[entry_name, entry] : entries) {
+            writeString(os, entry_name);
+            writeValue<uint8_t>(os, (uint8_t)entry.type);
+            writeValue<uint64_t>(os, entry.count);
+            writeString(os, entry.data);
+        }
+    }
+
+    os.close();
+    fatal_if(!os, "Failed to write checkpoint file %s.", filename);
+}
+
+bool
+In::isBinary(const std::string &filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    char magic[sizeof(Magic)];
+    return is.read(magic, sizeof(magic)) &&
+        std::memcmp(magic, Magic, sizeof(Magic)) == 0;
+}
+
+bool
+In::load(const std::string &filename)
+{
+    std::ifstream is(filename, std::ios::binary);
+    if (!is)
+        return false;
+    contents.assign(std::istreambuf_iterator<char>(is),
+                    std::istreambuf_iterator<char>());
+    sections.clear();
+
+    Reader reader(filename, contents);
+    if (contents.size() < sizeof(Magic) ||
+            reader.take(sizeof(Magic)) != std::string_view(Magic,
+                                                           sizeof(Magic))) {
+        return false;
+    }
+
+    uint32_t version = reader.get<uint32_t>();
+    fatal_if(version != Version,
+             "Binary checkpoint '%s' has version %d, expected %d.",
+             filename, version, Version);
+
+    sections.resize(reader.get<uint32_t>());
+    for (auto &section : sections) {
+        section.name = reader.getString();
+        section.entries.resize(reader.get<uint32_t>());
+        for (auto &[name, entry] : section.entries) {
+            name = reader.getString();
+            entry.type = (Type)reader.get<uint8_t>();
+            entry.count = reader.get<uint64_t>();
+            entry.data = reader.getString();
+
+            uint64_t size = typeSize(entry.type);
+            fatal_if(!size, "Binary checkpoint '%s' has an entry of "
+                     "unknown type %d.", filename, (int)entry.type);
+            fatal_if(entry.type != Type::Text &&
+                     entry.data.size() != entry.count * size,
+                     "Binary checkpoint '%s' has a corrupt entry %s.%s.",
+                     filename, section.name, name);
+        }
+    }
+
+    // The writer sorts everything, but lookups rely on that, so do not
+    // trust the file.
+    auto by_name = [](const auto &a, const auto &b) {
+        return a.name < b.name;
+    };
+    if (!std::is_sorted(sections.begin(), sections.end(), by_name))
+        std::sort(sections.begin(), sections.end(), by_name);
+    for (auto &section : sections) {
+        auto &entries = section.entries;
+        auto by_key = [](const auto &a, const auto &b) {
+            return a.first < b.first;
+        };
+        if (!std::is_sorted(entries.begin(), entries.end(), by_key))
+            std::sort(entries.begin(), entries.end(), by_key);
+    }
+
+    return true;
+}
+
+const In::Section *
+In::findSection(std::string_view section) const
+{
+    auto it = std::lower_bound(sections.begin(), sections.end(), section,
+        [](const Section &s, std::string_view name) {
+            return s.name < name;
+        });
+    return it != sections.end() && it->name == section ? &*it : nullptr;
+}
+
+const Entry *
+In::find(std::string_view section, std::string_view entry) const
+{
+    const Section *s = findSection(section);
+    if (!s)
+        return nullptr;
+    auto it = std::lower_bound(s->entries.begin(), s->entries.end(), entry,
+        [](const auto &e, std::string_view name) {
+            return e.first < name;
+        });
+    return it != s->entries.end() && it->first == entry ?
+        &it->second : nullptr;
+}
+
+bool
+In::sectionExists(std::string_view section) const
+{
+    return findSection(section) != nullptr;
+}
+
+} // namespace binary_checkpoint
+} // namespace gem5
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_BINARY_CHECKPOINT_HH__
+#define __SIM_BINARY_CHECKPOINT_HH__
+
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace gem5
+{
+
+/**
+ * Binary checkpoints store the same sections and entries as the INI
+ * text format, but numbers and arrays of numbers are kept in their
+ * in-memory representation, and sections and entries are sorted by
+ * name so they can be looked up without parsing the whole file.
+ *
+ * The file starts with a header, followed by the sections:
+ *
+ *   char magic[8] = "gem5cpt"   uint32_t version   uint32_t num_sections
+ *   for every section: string name, uint32_t num_entries, and
+ *     for every entry: string name, uint8_t type, uint64_t count,
+ *                      string data
+ *
+ * where a string is a uint64_t length followed by that many bytes.
+ * Everything is stored in host byte order. Text entries hold what the
+ * INI format holds, all other entries hold count values of their
+ * type. util/cpt_to_ini.py converts a binary checkpoint to text.
+ */
+namespace binary_checkpoint
+{
+
+constexpr char Magic[8] = "gem5cpt";
+constexpr uint32_t Version = 1;
+
+enum class Type : uint8_t
+{
+    Text, Bool, Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64,
+    Float, Double
+};
+
+/** Whether values of type T are stored in their binary representation. */
+template <class T>
+constexpr bool isRaw = std::is_arithmetic_v<T> &&
+    !std::is_same_v<T, long double> && sizeof(T) <= 8;
+
+template <class T>
+constexpr Type
+typeOf()
+{
+    static_assert(isRaw<T>);
+    if constexpr (std::is_same_v<T, bool>) {
+        return Type::Bool;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return sizeof(T) == 4 ? Type::Float : Type::Double;
+    } else if constexpr (std::is_signed_v<T>) {
+        return sizeof(T) == 1 ? Type::Int8 : sizeof(T) == 2 ? Type::Int16 :
+            sizeof(T) == 4 ? Type::Int32 : Type::Int64;
+    } else {
+        return sizeof(T) == 1 ? Type::UInt8 : sizeof(T) == 2 ? Type::UInt16 :
+            sizeof(T) == 4 ? Type::UInt32 : Type::UInt64;
+    }
+}
+
+struct Entry
+{
+    Type type;
+    uint64_t count;
+    std::string_view data;
+
+    /** Get the entry in the format of the INI text. */
+    std::string text() const;
+};
+
+/**
+ * Collects the contents of a checkpoint that is being created, and
+ * writes them to a binary checkpoint file when it is closed. Entries
+ * of numbers are added with add(), everything else that is written to
+ * the stream, including section headers, is text in the INI format.
+ */
+class Out : public std::ostringstream
+{
+  public:
+    Out(const std::string &filename) : filename(filename) {}
+    ~Out();
+
+    /** Add an entry of values to the current section. */
+    template <class T>
+    void
+    add(const std::string &section, const std::string &name,
+        const T *values, uint64_t count)
+    {
+        auto &entry = sections[section][name];
+        entry.type = typeOf<T>();
+        entry.count = count;
+        entry.data.assign((const char *)values, count * sizeof(T));
+    }
+
+    /** Write the checkpoint file. */
+    void close();
+
+  private:
+    struct OutEntry
+    {
+        Type type;
+        uint64_t count;
+        std::string data;
+    };
+
+    const std::string filename;
+    std::map<std::string, std::map<std::string, OutEntry>> sections;
+    bool closed = false;
+};
+
+/**
+ * The index of a binary checkpoint file, which is read into memory in
+ * one go. Looking up an entry does not copy or parse anything.
+ */
+class In
+{
+  public:
+    /** Check if a file is a binary checkpoint. */
+    static bool isBinary(const std::string &filename);
+
+    /** Load a file, returning false if it is not a binary checkpoint. */
+    bool load(const std::string &filename);
+
+    const Entry *find(std::string_view section,
+                      std::string_view entry) const;
+    bool sectionExists(std::string_view section) const;
+
+    /** Call a function with the name and text of all entries. */
+    template <class F>
+    void
+    visitSection(std::string_view section, F func) const
+    {
+        if (const Section *s = findSection(section)) {
+            for (const auto &[name, entry] : s->entries)
+                func(std::string(name), entry.text());
+        }
+    }
+
+  private:
+    struct Section
+    {
+        std::string_view name;
+        std::vector<std::pair<std::string_view, Entry>> entries;
+    };
+
+    std::string contents;
+    std::vector<Section> sections;
+
+    const Section *findSection(std::string_view section) const;
+};
+
+} // namespace binary_checkpoint
+} // namespace gem5
+
+#endif // __SIM_BINARY_CHECKPOINT_HH__
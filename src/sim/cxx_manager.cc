@@ -438,6 +438,28 @@ CxxConfigManager::findTraversalOrder(const std::string &object_name)
     }
 }
 
+void
+CxxConfigManager::bindStatGroups(const std::string &object_name)
+{
+    SimObject *object = findObject(object_name);
+    if (!object)
+        return;
+
+    std::vector<std::string> children;
+    configFile.getObjectChildren(object_name, children, false);
+
+    for (const auto &child : children) {
+        const std::string child_name = object_name == "root" ?
+            child : object_name + "." + child;
+        SimObject *child_object = findObject(child_name);
+        if (!child_object)
+            continue;
+
+        object->addStatGroup(child.c_str(), child_object);
+        bindStatGroups(child_name);
+    }
+}
+
 void
 CxxConfigManager::bindAllPorts()
 {
@@ -603,7 +625,15 @@ CxxConfigManager::instantiate(bool build_all)
     forEachObject(&SimObject::init);
 
     DPRINTF(CxxConfig, "Registering stats\n");
-    forEachObject(&SimObject::regStats);
+    if (build_all) {
+        // Registering the stats of the root registers all of them
+        // through the stat group hierarchy.
+        bindStatGroups("root");
+        if (SimObject *root = findObject("root"))
+            root->regStats();
+    } else {
+        forEachObject(&SimObject::regStats);
+    }
 
     DPRINTF(CxxConfig, "Registering probe points\n");
     forEachObject(&SimObject::regProbePoints);
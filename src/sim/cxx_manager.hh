@@ -232,6 +232,11 @@ class CxxConfigManager
      *  the given object name down through all its children */
     void findTraversalOrder(const std::string &object_name);
 
+    /** Add the stats of all the children of the given object to its stat
+     *  group, recursively, so that stats are named after the object
+     *  hierarchy as they are when building the configuration in Python */
+    void bindStatGroups(const std::string &object_name);
+
     /** Find an object from objectsByName with a type-checking cast.
      *  This function is provided for manipulating objects after
      *  instantiate as it assumes the named object exists. */
@@ -115,6 +115,33 @@ class DrainManager
      */
     void resume();
 
+    /**
+     * Try to drain a subset of the objects while the rest of the
+     * system keeps running.
+     *
+     * This is meant for operations which only involve a few objects,
+     * such as a CPU handover that doesn't change the memory mode. It
+     * works like tryDrain(), the simulation loop returning "Finished
+     * drain" once all the objects are drained, but the system as a
+     * whole stays in the Running state.
+     *
+     * @param objs Objects to drain.
+     * @return true if all the objects were drained successfully,
+     * false if more simulation is needed.
+     *
+     * @ingroup api_drain
+     */
+    bool tryDrainObjects(const std::vector<Drainable *> &objs);
+
+    /**
+     * Resume the objects drained by tryDrainObjects().
+     *
+     * @param objs Objects to resume.
+     *
+     * @ingroup api_drain
+     */
+    void resumeObjects(const std::vector<Drainable *> &objs);
+
     /**
      * Run state fixups before a checkpoint restore operation.
      *
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "sim/drain.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Object which takes a given number of drain cycles to drain */
+class TestDrainable : public Drainable
+{
+  public:
+    TestDrainable(int cycles=0) : cycles(cycles) {}
+
+    DrainState
+    drain() override
+    {
+        drainCalls++;
+        return cycles == 0 ? DrainState::Drained : DrainState::Draining;
+    }
+
+    void drainResume() override { resumeCalls++; }
+
+    /** Finish draining, as the object would on an event */
+    void
+    finishDrain()
+    {
+        cycles = 0;
+        signalDrainDone();
+    }
+
+    int cycles;
+    int drainCalls = 0;
+    int resumeCalls = 0;
+};
+
+} // anonymous namespace
+
+TEST(DrainTest, TargetedDrain)
+{
+    DrainManager &dm = DrainManager::instance();
+    TestDrainable target, other;
+
+    EXPECT_TRUE(dm.tryDrainObjects({&target}));
+    EXPECT_EQ(target.drainState(), DrainState::Drained);
+    EXPECT_EQ(target.drainCalls, 1);
+
+    // The rest of the system is left alone
+    EXPECT_EQ(other.drainState(), DrainState::Running);
+    EXPECT_EQ(other.drainCalls, 0);
+    EXPECT_EQ(dm.state(), DrainState::Running);
+
+    dm.resumeObjects({&target});
+    EXPECT_EQ(target.drainState(), DrainState::Running);
+    EXPECT_EQ(target.resumeCalls, 1);
+    EXPECT_EQ(other.resumeCalls, 0);
+}
+
+TEST(DrainTest, TargetedDrainNeedsCycles)
+{
+    DrainManager &dm = DrainManager::instance();
+    // Signalling the end of the drain schedules an exit event
+    curEventQueue(getEventQueue(0));
+
+    TestDrainable fast, slow(1);
+    std::vector<Drainable *> objs = {&fast, &slow};
+
+    EXPECT_FALSE(dm.tryDrainObjects(objs));
+    EXPECT_EQ(fast.drainState(), DrainState::Drained);
+    EXPECT_EQ(slow.drainState(), DrainState::Draining);
+
+    slow.finishDrain();
+    EXPECT_EQ(slow.drainState(), DrainState::Drained);
+
+    EXPECT_TRUE(dm.tryDrainObjects(objs));
+    EXPECT_EQ(dm.state(), DrainState::Running);
+
+    dm.resumeObjects(objs);
+    EXPECT_EQ(fast.drainState(), DrainState::Running);
+    EXPECT_EQ(slow.drainState(), DrainState::Running);
+    EXPECT_EQ(slow.resumeCalls, 1);
+}
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_calendar.hh"
+
+#include <algorithm>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+bool
+binOrder(const Event *l, const Event *r)
+{
+    return *l < *r;
+}
+
+} // anonymous namespace
+
+EventCalendar::EventCalendar()
+    : buckets(MinBuckets, nullptr), widthShift(DefaultWidthShift),
+      numBins(0), curSlot(MaxTick)
+{
+}
+
+Tick
+EventCalendar::slotOf(const Event *event) const
+{
+    return event->when() >> widthShift;
+}
+
+Event **
+EventCalendar::findLink(const Event *event)
+{
+    Event **link = &buckets[bucketIndex(slotOf(event))];
+    while (*link && **link < *event)
+        link = &(*link)->nextBin;
+    return link;
+}
+
+void
+EventCalendar::link(Event *top)
+{
+    Event **link = findLink(top);
+    assert(!*link || **link != *top);
+
+    top->nextBin = *link;
+    *link = top;
+    numBins++;
+    curSlot = std::min(curSlot, slotOf(top));
+}
+
+void
+EventCalendar::insert(Event *event)
+{
+    Event **link = findLink(event);
+    if (*link && **link == *event) {
+        // Put the event on top of the bin's stack, which matches what
+        // Event::insertBefore() does on the sorted list.
+        event->nextBin = (*link)->nextBin;
+        event->nextInBin = *link;
+        *link = event;
+        return;
+    }
+
+    event->nextInBin = nullptr;
+    event->nextBin = *link;
+    *link = event;
+    numBins++;
+    curSlot = std::min(curSlot, slotOf(event));
+
+    if (numBins > 2 * buckets.size())
+        resize(2 * buckets.size());
+}
+
+void
+EventCalendar::insertBin(Event *top)
+{
+    link(top);
+
+    if (numBins > 2 * buckets.size())
+        resize(2 * buckets.size());
+}
+
+void
+EventCalendar::remove(Event *event)
+{
+    Event **link = findLink(event);
+    if (!*link || **link != *event)
+        panic("event not found!");
+
+    Event *top = *link;
+    const bool last = event == top && !top->nextInBin;
+    *link = Event::removeItem(event, top);
+
+    if (last) {
+        numBins--;
+        if (buckets.size() > MinBuckets && numBins < buckets.size() / 2)
+            resize(buckets.size() / 2);
+    }
+}
+
+Event *
+EventCalendar::popBin()
+{
+    if (!numBins)
+        return nullptr;
+
+    // Look for a bin in the current slot of each bucket in turn, which
+    // finds the earliest bin unless the calendar is very sparse.
+    Event **bucket = nullptr;
+    for (size_t i = 0; i < buckets.size(); ++i, ++curSlot) {
+        Event *&candidate = buckets[bucketIndex(curSlot)];
+        if (candidate && slotOf(candidate) == curSlot) {
+            bucket = &candidate;
+            break;
+        }
+    }
+
+    if (!bucket) {
+        // No bin within a whole round of buckets, search directly.
+        for (auto &candidate : buckets) {
+            if (candidate && (!bucket || *candidate < **bucket))
+                bucket = &candidate;
+        }
+        curSlot = slotOf(*bucket);
+    }
+
+    Event *top = *bucket;
+    *bucket = top->nextBin;
+    top->nextBin = nullptr;
+    numBins--;
+
+    if (buckets.size() > MinBuckets && numBins < buckets.size() / 2)
+        resize(buckets.size() / 2);
+
+    return top;
+}
+
+void
+EventCalendar::resize(size_t num_buckets)
+{
+    std::vector<Event *> all;
+    all.reserve(numBins);
+    for (auto *top : buckets) {
+        for (; top; top = top->nextBin)
+            all.push_back(top);
+    }
+
+    // Estimate the bucket width from the spacing of the earliest bins.
+    // Use the median spacing so that a few far away events (e.g., the
+    // simulation limit at MaxTick) do not blow up the estimate.
+    constexpr size_t num_samples = 32;
+    if (all.size() > 2) {
+        const size_t n = std::min(all.size(), num_samples);
+        std::partial_sort(all.begin(), all.begin() + n, all.end(),
+                          binOrder);
+
+        std::vector<Tick> gaps;
+        for (size_t i = 1; i < n; ++i) {
+            const Tick gap = all[i]->when() - all[i - 1]->when();
+            if (gap)
+                gaps.push_back(gap);
+        }
+
+        if (!gaps.empty()) {
+            auto median = gaps.begin() + gaps.size() / 2;
+            std::nth_element(gaps.begin(), median, gaps.end());
+            const Tick width = *median < MaxTick / 3 ? *median * 3 : MaxTick;
+            widthShift = std::min<unsigned>(ceilLog2(width), 63);
+        }
+    }
+
+    buckets.assign(num_buckets, nullptr);
+    numBins = 0;
+    curSlot = MaxTick;
+    for (auto *top : all)
+        link(top);
+}
+
+std::vector<Event *>
+EventCalendar::bins() const
+{
+    std::vector<Event *> all;
+    all.reserve(numBins);
+    for (auto *top : buckets) {
+        for (; top; top = top->nextBin)
+            all.push_back(top);
+    }
+    std::sort(all.begin(), all.end(), binOrder);
+    return all;
+}
+
+Event *
+EventCalendar::toList(Event *head)
+{
+    Event *list = head;
+    Event **tail = head ? &head->nextBin : &list;
+    for (auto *top : bins()) {
+        *tail = top;
+        tail = &top->nextBin;
+    }
+    *tail = nullptr;
+
+    buckets.assign(MinBuckets, nullptr);
+    numBins = 0;
+    curSlot = MaxTick;
+
+    return list;
+}
+
+Event *
+EventCalendar::fromList(Event *list)
+{
+    if (!list)
+        return nullptr;
+
+    Event *top = list->nextBin;
+    list->nextBin = nullptr;
+    while (top) {
+        Event *next = top->nextBin;
+        insertBin(top);
+        top = next;
+    }
+
+    return list;
+}
+
+} // namespace gem5
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_CALENDAR_HH__
+#define __SIM_EVENT_CALENDAR_HH__
+
+#include <cstddef>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class Event;
+
+/**
+ * Calendar queue (R. Brown, CACM 1988) of event bins.
+ *
+ * A bin is the set of events that share the same (when, priority)
+ * key. Just like in the sorted list used by EventQueue, a bin is
+ * represented by its top event and the other events of the bin are
+ * stacked behind it through Event::nextInBin. Bins are hashed by time
+ * into an array of buckets, each of them holding a short list of bins
+ * sorted by key and linked through Event::nextBin. Bins of a bucket
+ * are the ones whose slot (when / bucket width) maps to it, so finding
+ * the position of an event or the earliest bin is O(1) amortized
+ * instead of a walk over all the pending bins.
+ *
+ * The number of buckets follows the number of bins, and the width of
+ * a bucket is estimated from the spacing of the earliest bins whenever
+ * the calendar is resized. The order in which events are returned is
+ * exactly the same as with the sorted list.
+ */
+class EventCalendar
+{
+  private:
+    //! Lists of bins, sorted by key.
+    std::vector<Event *> buckets;
+    //! Log2 of the time covered by a bucket.
+    unsigned widthShift;
+    //! Number of bins in the calendar.
+    size_t numBins;
+    //! Slot where the search for the earliest bin resumes. No bin has
+    //! an earlier slot.
+    Tick curSlot;
+
+    static constexpr size_t MinBuckets = 16;
+    static constexpr unsigned DefaultWidthShift = 10;
+
+    size_t bucketIndex(Tick slot) const { return slot & (buckets.size() - 1); }
+    Tick slotOf(const Event *event) const;
+
+    /**
+     * Find the link in the bucket that points to the bin for the
+     * event's key, or to where that bin should be inserted.
+     */
+    Event **findLink(const Event *event);
+
+    /** Insert a bin into its bucket without resizing. */
+    void link(Event *top);
+
+    /**
+     * Rebuild the calendar with the given number of buckets and a
+     * bucket width derived from the earliest bins.
+     */
+    void resize(size_t num_buckets);
+
+  public:
+    EventCalendar();
+
+    bool empty() const { return numBins == 0; }
+    size_t size() const { return numBins; }
+
+    /**
+     * Insert an event, either on top of the bin with the same key or
+     * as a new bin.
+     */
+    void insert(Event *event);
+
+    /**
+     * Insert a bin (an event and the stack of events behind it). There
+     * must be no other bin with the same key.
+     */
+    void insertBin(Event *top);
+
+    /** Remove an event from its bin. */
+    void remove(Event *event);
+
+    /**
+     * Remove the earliest bin.
+     *
+     * @return The top event of the bin, or nullptr if the calendar is
+     * empty. The nextBin pointer of the returned top is cleared.
+     */
+    Event *popBin();
+
+    /** Get the top events of all bins in key order. */
+    std::vector<Event *> bins() const;
+
+    /**
+     * Move all bins to a sorted list of bins as used by EventQueue.
+     *
+     * @param head Bin to put in front of the calendar's bins.
+     * @return The first bin of the list.
+     */
+    Event *toList(Event *head);
+
+    /**
+     * Move all bins of a sorted list of bins, except the first one,
+     * into the calendar.
+     *
+     * @return The first bin of the list, with nextBin cleared.
+     */
+    Event *fromList(Event *list);
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENT_CALENDAR_HH__
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/event_profiler.hh"
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+#include "base/logging.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace event_profiler
+{
+
+bool enabled = false;
+
+namespace
+{
+
+struct Entry
+{
+    uint64_t events = 0;
+    uint64_t nanoseconds = 0;
+};
+
+/** Profile of a simulator thread */
+struct Profile
+{
+    /** Events left before the next sample */
+    unsigned countdown = 0;
+    /** Samples by folded stack */
+    std::unordered_map<std::string, Entry> entries;
+};
+
+unsigned samplePeriod = 1;
+
+/** Protects profiles */
+std::mutex profilesLock;
+std::vector<std::unique_ptr<Profile>> profiles;
+
+thread_local Profile *threadProfile = nullptr;
+
+Profile &
+getProfile()
+{
+    if (!threadProfile) {
+        std::lock_guard<std::mutex> lock(profilesLock);
+        profiles.emplace_back(new Profile);
+        threadProfile = profiles.back().get();
+    }
+    return *threadProfile;
+}
+
+/**
+ * Build the folded stack of an event: the components of its name,
+ * then its description. Events without a name of their own only have
+ * an instance number, so they are all attributed to the same frame.
+ */
+std::string
+foldedStack(const Event *event)
+{
+    std::string stack = event->name();
+    if (stack.compare(0, 6, "Event_") == 0)
+        stack = "[unnamed]";
+    for (auto &c : stack) {
+        if (c == '.' || c == ';')
+            c = ';';
+        else if (c == ' ')
+            c = '_';
+    }
+    stack += ';';
+    stack += event->description();
+    return stack;
+}
+
+void
+writeFolded(std::ostream &os, const std::map<std::string, uint64_t> &values)
+{
+    for (const auto &[stack, value] : values)
+        os << stack << ' ' << value << '\n';
+}
+
+} // anonymous namespace
+
+void
+enable(unsigned period)
+{
+    fatal_if(enabled, "The event profiler is already enabled.");
+    fatal_if(period == 0, "The event profiler period must not be 0.");
+
+    samplePeriod = period;
+    enabled = true;
+}
+
+void
+process(Event *event)
+{
+    Profile &profile = getProfile();
+    if (profile.countdown) {
+        profile.countdown--;
+        event->process();
+        return;
+    }
+    profile.countdown = samplePeriod - 1;
+
+    // The event may delete itself, so everything needed from it has
+    // to be read first.
+    std::string stack = foldedStack(event);
+
+    const auto start = std::chrono::steady_clock::now();
+    event->process();
+    const auto end = std::chrono::steady_clock::now();
+
+    Entry &entry = profile.entries[stack];
+    entry.events++;
+    entry.nanoseconds += std::chrono::duration_cast<
+        std::chrono::nanoseconds>(end - start).count();
+}
+
+void
+dump(std::ostream &nanoseconds_os, std::ostream &events_os)
+{
+    std::map<std::string, uint64_t> nanoseconds;
+    std::map<std::string, uint64_t> events;
+    {
+        std::lock_guard<std::mutex> lock(profilesLock);
+        for (const auto &profile : profiles) {
+            for (const auto &[stack, entry] : profile->entries) {
+                nanoseconds[stack] += entry.nanoseconds * samplePeriod;
+                events[stack] += entry.events * samplePeriod;
+            }
+        }
+    }
+
+    writeFolded(nanoseconds_os, nanoseconds);
+    writeFolded(events_os, events);
+}
+
+} // namespace event_profiler
+} // namespace gem5
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENT_PROFILER_HH__
+#define __SIM_EVENT_PROFILER_HH__
+
+#include <ostream>
+
+namespace gem5
+{
+
+class Event;
+
+/**
+ * Host time profiler for the event queues.
+ *
+ * When enabled, one event every period is timed with the host clock
+ * while it is processed. The time and the number of events are
+ * aggregated by the name of the event, which usually starts with the
+ * name of its owning SimObject, and by its description, i.e., the
+ * event class. The estimates are written as folded stacks,
+ * one frame per level of the SimObject hierarchy followed by the event
+ * class, which can be rendered by flamegraph.pl.
+ *
+ * Every simulator thread keeps its own table, so servicing events does
+ * not take any lock.
+ */
+namespace event_profiler
+{
+
+/** Checked by EventQueue::serviceOne() before every event. */
+extern bool enabled;
+
+/**
+ * Start profiling events.
+ *
+ * @param period Profile one event out of period.
+ */
+void enable(unsigned period);
+
+/** Process an event, timing it if it is sampled. */
+void process(Event *event);
+
+/**
+ * Write the profiles of all threads as folded stacks. No event may be
+ * processed meanwhile.
+ *
+ * @param nanoseconds Stream for the host time of each stack.
+ * @param events Stream for the number of events of each stack.
+ */
+void dump(std::ostream &nanoseconds, std::ostream &events);
+
+} // namespace event_profiler
+} // namespace gem5
+
+#endif // __SIM_EVENT_PROFILER_HH__
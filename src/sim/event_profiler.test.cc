@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include "sim/event_profiler.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+class NamedEvent : public Event
+{
+  public:
+    NamedEvent(const std::string &_name) : objName(_name) {}
+
+    void process() override {}
+    const std::string name() const override { return objName; }
+    const char *description() const override { return "Tick"; }
+
+  private:
+    const std::string objName;
+};
+
+class UnnamedEvent : public Event
+{
+  public:
+    void process() override {}
+};
+
+} // anonymous namespace
+
+/**
+ * Events are aggregated by the components of their names and their
+ * descriptions; events without a name share a frame.
+ */
+TEST(EventProfilerTest, FoldedStacks)
+{
+    EventQueue eq("test_queue");
+    curEventQueue(&eq);
+
+    NamedEvent cpu("system.cpu.tickEvent");
+    NamedEvent mem("system.mem");
+    UnnamedEvent unnamed_a, unnamed_b;
+
+    event_profiler::enable(1);
+
+    for (Tick when = 1; when <= 3; when++) {
+        eq.schedule(&cpu, when);
+        eq.serviceOne();
+    }
+    eq.schedule(&mem, 4);
+    eq.schedule(&unnamed_a, 5);
+    eq.schedule(&unnamed_b, 6);
+    while (!eq.empty())
+        eq.serviceOne();
+
+    std::ostringstream nanoseconds, events;
+    event_profiler::dump(nanoseconds, events);
+
+    EXPECT_EQ(events.str(),
+              "[unnamed];generic 2\n"
+              "system;cpu;tickEvent;Tick 3\n"
+              "system;mem;Tick 1\n");
+
+    // Every stack has a time, whatever its value on this host
+    std::istringstream lines(nanoseconds.str());
+    std::string stack;
+    uint64_t value;
+    int count = 0;
+    while (lines >> stack >> value)
+        count++;
+    EXPECT_EQ(count, 3);
+}
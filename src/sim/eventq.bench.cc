@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Micro-benchmarks of the event queue: the "hold" model of a simulation
+ * in steady state, where every serviced event schedules itself again,
+ * and the schedule/deschedule pairs of events which get cancelled.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+constexpr Tick Cycle = 500;
+
+/**
+ * Delays shared by all events, pre-generated to keep the RNG out of the
+ * measurements. Most delays are a few cycles, a small fraction are long
+ * ones like timeouts.
+ */
+const std::vector<Tick> &
+delays()
+{
+    static const std::vector<Tick> values = [] {
+        std::mt19937_64 rng(0);
+        std::vector<Tick> v(1 << 16);
+        for (auto &delay : v) {
+            if (rng() % 64 == 0)
+                delay = Cycle * (1000 + rng() % 100000);
+            else
+                delay = Cycle * (1 + rng() % 16);
+        }
+        return v;
+    }();
+    return values;
+}
+
+class HoldEvent : public Event
+{
+  public:
+    HoldEvent(EventQueue &_eq, size_t _next)
+        : Event(Default_Pri), eq(_eq), next(_next)
+    {}
+
+    void
+    process() override
+    {
+        next = (next + 1) % delays().size();
+        eq.schedule(this, eq.getCurTick() + delays()[next]);
+    }
+
+  private:
+    EventQueue &eq;
+    size_t next;
+};
+
+class NopEvent : public Event
+{
+  public:
+    void process() override {}
+};
+
+/**
+ * Service events with a constant number of them pending.
+ * Arguments: number of pending events, whether to use the calendar queue.
+ */
+void
+EventQueueHold(benchmark::State &state)
+{
+    const size_t num_events = state.range(0);
+    EventQueue eq("bench_queue");
+    eq.useCalendar(state.range(1));
+    curEventQueue(&eq);
+
+    std::vector<std::unique_ptr<HoldEvent>> events;
+    for (size_t i = 0; i < num_events; i++) {
+        events.emplace_back(new HoldEvent(eq, i * 7919));
+        eq.schedule(events.back().get(), delays()[i % delays().size()]);
+    }
+
+    for (auto _ : state)
+        eq.serviceOne();
+    state.SetItemsProcessed(state.iterations());
+
+    while (!eq.empty())
+        eq.deschedule(eq.getHead());
+    curEventQueue(nullptr);
+}
+BENCHMARK(EventQueueHold)->ArgsProduct({{16, 256, 4096, 65536}, {0, 1}});
+
+/**
+ * Schedule and then deschedule an event in a queue which already holds
+ * other pending ones.
+ * Arguments: number of pending events, whether to use the calendar queue.
+ */
+void
+EventQueueScheduleDeschedule(benchmark::State &state)
+{
+    const size_t num_events = state.range(0);
+    EventQueue eq("bench_queue");
+    eq.useCalendar(state.range(1));
+    curEventQueue(&eq);
+
+    std::vector<std::unique_ptr<NopEvent>> events(num_events);
+    for (size_t i = 0; i < num_events; i++) {
+        events[i].reset(new NopEvent);
+        eq.schedule(events[i].get(), delays()[i % delays().size()]);
+    }
+
+    NopEvent event;
+    size_t next = 0;
+    for (auto _ : state) {
+        eq.schedule(&event, delays()[next]);
+        eq.deschedule(&event);
+        next = (next + 1) % delays().size();
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    while (!eq.empty())
+        eq.deschedule(eq.getHead());
+    curEventQueue(nullptr);
+}
+BENCHMARK(EventQueueScheduleDeschedule)
+    ->ArgsProduct({{16, 4096}, {0, 1}});
+
+} // anonymous namespace
@@ -30,7 +30,9 @@
 
 #include "sim/eventq.hh"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <mutex>
 #include <string>
@@ -41,11 +43,18 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/event_profiler.hh"
 
 namespace gem5
 {
 
 Tick simQuantum = 0;
+Tick simLookahead = 0;
+Tick simMaxQuantum = 0;
+uint64_t simQuantumGrowAccesses = 0;
+uint64_t simQuantumShrinkAccesses = 0;
+uint64_t simQuantumTargetHostNs = 0;
+std::atomic<uint64_t> numCrossQueueAccesses(0);
 
 //
 // Main Event Queues
@@ -53,7 +62,11 @@ Tick simQuantum = 0;
 // Events on these queues are processed at the *beginning* of each
 // cycle, before the pipeline simulation is performed.
 //
+bool calendarEventQueues = false;
+bool deterministicAsyncInsertions = false;
 uint32_t numMainEventQueues = 0;
+uint32_t numSimulatorThreads = 0;
+std::vector<int> simThreadAffinity;
 std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
@@ -64,7 +77,9 @@ getEventQueue(uint32_t index)
     while (numMainEventQueues <= index) {
         numMainEventQueues++;
         mainEventQueue.push_back(
-            new EventQueue(csprintf("MainEventQueue-%d", index)));
+            new EventQueue(csprintf("MainEventQueue-%d", index),
+                           numMainEventQueues - 1));
+        mainEventQueue.back()->useCalendar(calendarEventQueues);
     }
 
     return mainEventQueue[index];
@@ -139,10 +154,21 @@ EventQueue::insert(Event *event)
 {
     // Deal with the head case
     if (!head || *event <= *head) {
+        // The head bin is never in the calendar, so move it there if
+        // it is about to be replaced by a new bin.
+        if (calendar && head && *event < *head) {
+            calendar->insertBin(head);
+            head = nullptr;
+        }
         head = Event::insertBefore(event, head);
         return;
     }
 
+    if (calendar) {
+        calendar->insert(event);
+        return;
+    }
+
     // Figure out either which 'in bin' list we are on, or where a new list
     // needs to be inserted
     Event *prev = head;
@@ -200,6 +226,13 @@ EventQueue::remove(Event *event)
     // time as the head)
     if (*head == *event) {
         head = Event::removeItem(event, head);
+        if (!head && calendar)
+            head = calendar->popBin();
+        return;
+    }
+
+    if (calendar) {
+        calendar->remove(event);
         return;
     }
 
@@ -238,6 +271,8 @@ EventQueue::serviceOne()
         // this was the only element on the 'in bin' list, so get rid of
         // the 'in bin' list and point to the next bin list
         head = head->nextBin;
+        if (!head && calendar)
+            head = calendar->popBin();
     }
 
     // handle action
@@ -246,7 +281,11 @@ EventQueue::serviceOne()
         setCurTick(event->when());
         if (debug::Event)
             event->trace("executed");
-        event->process();
+        counters.serviced++;
+        if (GEM5_UNLIKELY(event_profiler::enabled))
+            event_profiler::process(event);
+        else
+            event->process();
         if (event->isExitEvent()) {
             assert(!event->flags.isSet(Event::Managed) ||
                    !event->flags.isSet(Event::IsMainQueue)); // would be silly
@@ -254,6 +293,7 @@ EventQueue::serviceOne()
         }
     } else {
         event->flags.clear(Event::Squashed);
+        counters.squashed++;
     }
 
     event->release();
@@ -321,15 +361,12 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
+        for (Event *nextBin : bins()) {
             Event *nextInBin = nextBin;
             while (nextInBin) {
                 nextInBin->dump();
                 nextInBin = nextInBin->nextInBin;
             }
-
-            nextBin = nextBin->nextBin;
         }
     }
 
@@ -344,8 +381,7 @@ EventQueue::debugVerify() const
     Tick time = 0;
     short priority = 0;
 
-    Event *nextBin = head;
-    while (nextBin) {
+    for (Event *nextBin : bins()) {
         Event *nextInBin = nextBin;
         while (nextInBin) {
             if (nextInBin->when() < time) {
@@ -371,18 +407,57 @@ EventQueue::debugVerify() const
 
             nextInBin = nextInBin->nextInBin;
         }
-
-        nextBin = nextBin->nextBin;
     }
 
     return true;
 }
 
+std::vector<Event *>
+EventQueue::bins() const
+{
+    std::vector<Event *> all;
+    for (Event *bin = head; bin; bin = bin->nextBin)
+        all.push_back(bin);
+
+    if (calendar) {
+        auto rest = calendar->bins();
+        all.insert(all.end(), rest.begin(), rest.end());
+    }
+
+    return all;
+}
+
+std::vector<size_t>
+EventQueue::binDepths() const
+{
+    std::vector<size_t> depths;
+    for (const Event *bin : bins()) {
+        size_t depth = 0;
+        for (const Event *e = bin; e; e = e->nextInBin)
+            depth++;
+        depths.push_back(depth);
+    }
+    return depths;
+}
+
+void
+EventQueue::useCalendar(bool enable)
+{
+    if (enable && !calendar) {
+        calendar = std::make_unique<EventCalendar>();
+        head = calendar->fromList(head);
+    } else if (!enable && calendar) {
+        head = calendar->toList(head);
+        calendar.reset();
+    }
+}
+
 Event*
 EventQueue::replaceHead(Event* s)
 {
-    Event* t = head;
-    head = s;
+    // Callers expect the whole queue as a sorted list of bins.
+    Event* t = calendar ? calendar->toList(head) : head;
+    head = calendar ? calendar->fromList(s) : s;
     return t;
 }
 
@@ -441,16 +516,24 @@ Event::dump() const
     }
 }
 
-EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+EventQueue::EventQueue(const std::string &n, uint32_t index)
+    : objName(n), head(NULL), _curTick(0), _index(index)
 {
 }
 
 void
 EventQueue::asyncInsert(Event *event)
 {
+    numCrossQueueAccesses.fetch_add(1, std::memory_order_relaxed);
+
+    // The source queue is only serviced by the calling thread, which
+    // is the only one updating its sequence number.
+    EventQueue *source = curEventQueue();
+    AsyncEvent async_event{event, source ? source->_index : UINT32_MAX,
+                           source ? source->asyncSeq++ : 0};
+
     async_queue_mutex.lock();
-    async_queue.push_back(event);
+    async_queue.push_back(async_event);
     async_queue_mutex.unlock();
 }
 
@@ -460,10 +543,29 @@ EventQueue::handleAsyncInsertions()
     assert(this == curEventQueue());
     async_queue_mutex.lock();
 
-    while (!async_queue.empty()) {
-        insert(async_queue.front());
-        async_queue.pop_front();
+    // The order in which events with the same time and priority are
+    // serviced depends on the order in which they are inserted, so they
+    // are sorted by the queue which scheduled them rather than taken in
+    // the order the threads got to the lock.
+    if (deterministicAsyncInsertions) {
+        std::sort(async_queue.begin(), async_queue.end(),
+            [](const AsyncEvent &a, const AsyncEvent &b) {
+                if (a.event->when() != b.event->when())
+                    return a.event->when() < b.event->when();
+                if (a.event->priority() != b.event->priority())
+                    return a.event->priority() < b.event->priority();
+                if (a.source != b.source)
+                    return a.source < b.source;
+                return a.seq < b.seq;
+            });
+    }
+
+    for (const auto &async_event : async_queue) {
+        insert(async_event.event);
+        counters.asyncMerged++;
+        countDistance(async_event.event->when());
     }
+    async_queue.clear();
 
     async_queue_mutex.unlock();
 }
@@ -36,23 +36,28 @@
 #define __SIM_EVENTQ_HH__
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <functional>
 #include <iosfwd>
-#include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
+#include "base/intmath.hh"
 #include "base/named.hh"
+#include "base/pool_alloc.hh"
 #include "base/trace.hh"
 #include "base/type_traits.hh"
 #include "base/types.hh"
 #include "base/uncontended_mutex.hh"
 #include "debug/Event.hh"
 #include "sim/cur_tick.hh"
+#include "sim/event_calendar.hh"
 #include "sim/serialize.hh"
 
 namespace gem5
@@ -68,9 +73,63 @@ class BaseGlobalEvent;
 //! Queue B should be at least simQuantum ticks away in future.
 extern Tick simQuantum;
 
+//! Lookahead for conservative multiple eventq simulation.
+//! When non-zero, the queues no longer synchronize every simQuantum
+//! ticks. Instead, every synchronization computes the earliest pending
+//! event across all queues and lets the queues run until lookahead
+//! ticks past it. Like simQuantum, this requires any event scheduled
+//! on Queue A by an event on Queue B to be at least simLookahead ticks
+//! away in the future.
+extern Tick simLookahead;
+
+//! Upper bound for an adaptive simulation quantum. When larger than
+//! simQuantum, the queues double the period between synchronizations
+//! for as long as threads rarely interact with other queues, and fall
+//! back to simQuantum as soon as they do more often. Zero keeps the
+//! period fixed.
+extern Tick simMaxQuantum;
+
+//! Number of cross-queue accesses per simQuantum of simulated time up
+//! to which the adaptive quantum doubles.
+extern uint64_t simQuantumGrowAccesses;
+
+//! Number of cross-queue accesses per simQuantum of simulated time
+//! above which the adaptive quantum falls back to simQuantum.
+extern uint64_t simQuantumShrinkAccesses;
+
+//! Host time a quantum must take less than for the adaptive quantum to
+//! double, since the synchronization overhead is negligible in longer
+//! ones. Zero disables the check.
+extern uint64_t simQuantumTargetHostNs;
+
+//! Number of accesses made so far by threads to event queues other
+//! than their own, either by migrating to them or by posting
+//! asynchronous events. Used to adapt the simulation quantum.
+extern std::atomic<uint64_t> numCrossQueueAccesses;
+
+//! Whether new main event queues keep the pending events in a
+//! calendar queue rather than in a sorted list. The calendar is
+//! faster when a queue holds many pending events at distinct times.
+extern bool calendarEventQueues;
+
+//! Whether the events scheduled on a queue by other threads are merged
+//! in an order that doesn't depend on the timing of the host threads,
+//! which makes parallel simulations reproducible.
+extern bool deterministicAsyncInsertions;
+
 //! Current number of allocated main event queues.
 extern uint32_t numMainEventQueues;
 
+//! Number of host threads executing the main event queues. Zero means
+//! one thread per queue. Fewer threads than queues makes the threads
+//! pick queues dynamically within every quantum.
+extern uint32_t numSimulatorThreads;
+
+//! Host CPUs the simulator threads are pinned to. The thread running
+//! queue i is pinned to simThreadAffinity[i % size]. Empty leaves the
+//! threads to the host scheduler.
+extern std::vector<int> simThreadAffinity;
+
 //! Array for main event queues.
 extern std::vector<EventQueue *> mainEventQueue;
 
@@ -254,6 +313,7 @@ class EventBase
 class Event : public EventBase, public Serializable
 {
     friend class EventQueue;
+    friend class EventCalendar;
 
   private:
     // The event queue is now a linked list of linked lists.  The
@@ -512,6 +572,41 @@ class Event : public EventBase, public Serializable
     //! NULL.  (Overridden in GlobalEvent::BarrierEvent.)
     virtual BaseGlobalEvent *globalEvent() { return NULL; }
 
+    /**
+     * Heap allocated events are frequently short-lived (e.g.,
+     * AutoDelete events), so they come from the small object pools
+     * rather than from the global heap.
+     */
+    static void *
+    operator new(std::size_t size)
+    {
+        return PoolAllocator::allocate(size);
+    }
+
+    static void *
+    operator new(std::size_t size, std::align_val_t align)
+    {
+        return ::operator new(size, align);
+    }
+
+    static void *
+    operator new(std::size_t size, void *ptr) noexcept
+    {
+        return ptr;
+    }
+
+    static void
+    operator delete(void *ptr, std::size_t size)
+    {
+        PoolAllocator::deallocate(ptr, size);
+    }
+
+    static void
+    operator delete(void *ptr, std::size_t size, std::align_val_t align)
+    {
+        ::operator delete(ptr, align);
+    }
+
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
 };
@@ -614,6 +709,36 @@ operator!=(const Event &l, const Event &r)
  */
 class EventQueue
 {
+  public:
+    /**
+     * Activity counters of a queue. They are updated by the thread
+     * servicing the queue and never reset; EventQueueStats turns them
+     * into statistics.
+     */
+    struct Counters
+    {
+        /**
+         * Buckets of the schedule distance histogram. Bucket 0 counts
+         * events scheduled for the current tick, and bucket i > 0
+         * distances in [2^(i-1), 2^i).
+         */
+        static constexpr int DistanceBuckets = 65;
+
+        /** Events scheduled by the thread servicing the queue */
+        uint64_t scheduled = 0;
+        uint64_t descheduled = 0;
+        uint64_t rescheduled = 0;
+        uint64_t serviced = 0;
+        uint64_t squashed = 0;
+        /** Events scheduled by other threads, merged from async_queue */
+        uint64_t asyncMerged = 0;
+        /** Number of waits on global event barriers */
+        uint64_t barrierWaits = 0;
+        /** Host time spent waiting on global event barriers */
+        uint64_t barrierWaitNs = 0;
+        std::array<uint64_t, DistanceBuckets> distance{};
+    };
+
   private:
     friend void curEventQueue(EventQueue *);
 
@@ -621,11 +746,43 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+    /**
+     * Calendar holding all bins but the head one, if enabled. To keep
+     * the fast paths unchanged, the head bin is always kept outside
+     * of the calendar, so head->nextBin is always null.
+     */
+    std::unique_ptr<EventCalendar> calendar;
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
+    /** An event added by another thread to this event queue. */
+    struct AsyncEvent
+    {
+        Event *event;
+        /** Index of the queue that scheduled the event. */
+        uint32_t source;
+        /** Number of events the source queue scheduled before. */
+        uint64_t seq;
+    };
+
     //! List of events added by other threads to this event queue.
-    std::list<Event*> async_queue;
+    std::vector<AsyncEvent> async_queue;
+
+    //! Index of this queue among the main event queues.
+    const uint32_t _index;
+
+    //! Number of events this queue scheduled on other queues.
+    uint64_t asyncSeq = 0;
+
+    Counters counters;
+
+    void
+    countDistance(Tick when)
+    {
+        const Tick distance = when - _curTick;
+        counters.distance[distance ? floorLog2(distance) + 1 : 0]++;
+    }
 
     /**
      * Lock protecting event handling.
@@ -654,6 +811,9 @@ class EventQueue
     void insert(Event *event);
     void remove(Event *event);
 
+    //! Get the top event of all bins in order.
+    std::vector<Event *> bins() const;
+
     //! Function for adding events to the async queue. The added events
     //! are added to main event queue later. Threads, other than the
     //! owning thread, should call this function instead of insert().
@@ -684,6 +844,7 @@ class EventQueue
              doMigrate((&new_eq != &old_eq)&&_doMigrate)
         {
             if (doMigrate){
+                numCrossQueueAccesses.fetch_add(1, std::memory_order_relaxed);
                 old_eq.unlock();
                 new_eq.lock();
                 curEventQueue(&new_eq);
@@ -738,7 +899,7 @@ class EventQueue
     /**
      * @ingroup api_eventq
      */
-    EventQueue(const std::string &n);
+    EventQueue(const std::string &n, uint32_t index=0);
 
     /**
      * @ingroup api_eventq
@@ -748,6 +909,16 @@ class EventQueue
     void name(const std::string &st) { objName = st; }
     /** @}*/ //end of api_eventq group
 
+    /**
+     * Select the data structure holding the pending events. Events
+     * already in the queue are moved over, and the order in which
+     * events are serviced does not depend on the choice.
+     *
+     * @param enable Use a calendar queue instead of a sorted list.
+     */
+    void useCalendar(bool enable);
+    bool usesCalendar() const { return calendar != nullptr; }
+
     /**
      * Schedule the given event on this queue. Safe to call from any thread.
      *
@@ -773,6 +944,8 @@ class EventQueue
             asyncInsert(event);
         } else {
             insert(event);
+            counters.scheduled++;
+            countDistance(when);
         }
         event->flags.set(Event::Scheduled);
         event->acquire();
@@ -794,6 +967,7 @@ class EventQueue
         assert(!inParallelMode || this == curEventQueue());
 
         remove(event);
+        counters.descheduled++;
 
         event->flags.clear(Event::Squashed);
         event->flags.clear(Event::Scheduled);
@@ -826,6 +1000,8 @@ class EventQueue
 
         event->setWhen(when, this);
         insert(event);
+        counters.rescheduled++;
+        countDistance(when);
         event->flags.clear(Event::Squashed);
         event->flags.set(Event::Scheduled);
 
@@ -852,6 +1028,28 @@ class EventQueue
 
     Event *serviceOne();
 
+    /** @return The activity counters of the queue. */
+    const Counters &getCounters() const { return counters; }
+
+    /**
+     * Account for time spent on a global event barrier by the thread
+     * servicing the queue.
+     */
+    void
+    countBarrierWait(uint64_t ns)
+    {
+        counters.barrierWaits++;
+        counters.barrierWaitNs += ns;
+    }
+
+    /**
+     * Walk the queue to count the events of every bin, i.e., of every
+     * distinct (tick, priority) pair. This is not meant for fast paths.
+     *
+     * @return The number of events of each bin, in servicing order.
+     */
+    std::vector<size_t> binDepths() const;
+
     /**
      * process all events up to the given timestamp.  we inline a quick test
      * to see if there are any events to process; if so, call the internal
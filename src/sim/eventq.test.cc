@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Event that records the order in which it was serviced. */
+class RecordingEvent : public Event
+{
+  public:
+    RecordingEvent(std::vector<int> &_log, int _id, Priority p)
+        : Event(p), log(_log), id(_id)
+    {}
+
+    void process() override { log.push_back(id); }
+
+  private:
+    std::vector<int> &log;
+    int id;
+};
+
+/**
+ * Drive two queues, one with the sorted list and one with the
+ * calendar, through the same random sequence of operations.
+ */
+class EventQueueImplTest : public ::testing::Test
+{
+  protected:
+    struct Side
+    {
+        Side(bool calendar, std::vector<int> &log, int num_events)
+            : eq("test_queue")
+        {
+            eq.useCalendar(calendar);
+            for (int i = 0; i < num_events; i++) {
+                events.emplace_back(
+                    new RecordingEvent(log, i, i % 3 - 1));
+            }
+        }
+
+        ~Side()
+        {
+            curEventQueue(&eq);
+            while (!eq.empty())
+                eq.deschedule(eq.getHead());
+            curEventQueue(nullptr);
+        }
+
+        EventQueue eq;
+        std::vector<std::unique_ptr<RecordingEvent>> events;
+    };
+
+    static constexpr int NumEvents = 200;
+
+    std::vector<int> listLog;
+    std::vector<int> calendarLog;
+    Side list{false, listLog, NumEvents};
+    Side calendar{true, calendarLog, NumEvents};
+
+    /** Apply the same operation to both queues. */
+    template <typename F>
+    void
+    both(F &&f)
+    {
+        curEventQueue(&list.eq);
+        f(list);
+        curEventQueue(&calendar.eq);
+        f(calendar);
+        curEventQueue(nullptr);
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(EventQueueImplTest, SameServiceOrder)
+{
+    std::mt19937 rng(1234);
+
+    for (int iter = 0; iter < 20000; iter++) {
+        const int idx = rng() % NumEvents;
+        const Tick delay = (rng() % 4 == 0) ? rng() % 100000 : rng() % 8;
+        const int op = rng() % 10;
+
+        both([&](Side &side) {
+            Event *event = side.events[idx].get();
+            const Tick now = side.eq.getCurTick();
+            if (op < 6) {
+                if (event->scheduled())
+                    side.eq.reschedule(event, now + delay);
+                else
+                    side.eq.schedule(event, now + delay);
+            } else if (op < 7) {
+                if (event->scheduled())
+                    side.eq.deschedule(event);
+            } else if (!side.eq.empty()) {
+                side.eq.serviceOne();
+            }
+        });
+
+        ASSERT_EQ(list.eq.empty(), calendar.eq.empty());
+        if (!list.eq.empty()) {
+            ASSERT_EQ(list.eq.nextTick(), calendar.eq.nextTick());
+            ASSERT_EQ(list.eq.getCurTick(), calendar.eq.getCurTick());
+        }
+    }
+
+    both([](Side &side) {
+        while (!side.eq.empty())
+            side.eq.serviceOne();
+    });
+
+    EXPECT_FALSE(listLog.empty());
+    EXPECT_EQ(listLog, calendarLog);
+    EXPECT_TRUE(calendar.eq.debugVerify());
+}
+
+TEST_F(EventQueueImplTest, SwitchImplementation)
+{
+    std::mt19937 rng(42);
+    std::vector<Tick> when(NumEvents);
+    for (auto &w : when)
+        w = 1 + rng() % 1000;
+
+    both([&](Side &side) {
+        for (int i = 0; i < NumEvents; i++)
+            side.eq.schedule(side.events[i].get(), when[i]);
+    });
+
+    // Move the pending events between the implementations and back.
+    both([](Side &side) {
+        side.eq.useCalendar(!side.eq.usesCalendar());
+        EXPECT_TRUE(side.eq.debugVerify());
+        side.eq.useCalendar(!side.eq.usesCalendar());
+    });
+
+    both([](Side &side) {
+        while (!side.eq.empty())
+            side.eq.serviceOne();
+    });
+
+    EXPECT_EQ(listLog.size(), NumEvents);
+    EXPECT_EQ(listLog, calendarLog);
+}
+
+TEST_F(EventQueueImplTest, ReplaceHead)
+{
+    both([](Side &side) {
+        for (int i = 0; i < NumEvents / 2; i++)
+            side.eq.schedule(side.events[i].get(), 10 * i);
+    });
+
+    // Save the queue, run other events and put the saved ones back.
+    both([](Side &side) {
+        Event *saved = side.eq.replaceHead(nullptr);
+        EXPECT_TRUE(side.eq.empty());
+        for (int i = NumEvents / 2; i < NumEvents; i++)
+            side.eq.schedule(side.events[i].get(), i);
+        while (!side.eq.empty())
+            side.eq.serviceOne();
+        side.eq.setCurTick(0);
+        side.eq.replaceHead(saved);
+        while (!side.eq.empty())
+            side.eq.serviceOne();
+    });
+
+    EXPECT_EQ(listLog.size(), NumEvents);
+    EXPECT_EQ(listLog, calendarLog);
+}
+
+TEST_F(EventQueueImplTest, Counters)
+{
+    both([](Side &side) {
+        auto &eq = side.eq;
+        Event *a = side.events[0].get();
+        Event *b = side.events[1].get();
+        Event *c = side.events[2].get();
+
+        eq.schedule(a, 0);
+        eq.schedule(b, 1000);
+        eq.schedule(c, 1000);
+        eq.reschedule(b, 5);
+        EXPECT_EQ(eq.binDepths(), (std::vector<size_t>{ 1, 1, 1 }));
+
+        eq.deschedule(c);
+        c->squash();
+        eq.schedule(c, 5);
+        while (!eq.empty())
+            eq.serviceOne();
+
+        const auto &counters = eq.getCounters();
+        EXPECT_EQ(counters.scheduled, 4);
+        EXPECT_EQ(counters.rescheduled, 1);
+        EXPECT_EQ(counters.descheduled, 1);
+        EXPECT_EQ(counters.serviced, 2);
+        EXPECT_EQ(counters.squashed, 1);
+        // Distances of 0, 1000 twice, 5 twice
+        EXPECT_EQ(counters.distance[0], 1);
+        EXPECT_EQ(counters.distance[3], 2);
+        EXPECT_EQ(counters.distance[10], 2);
+        EXPECT_TRUE(eq.binDepths().empty());
+    });
+}
+
+TEST(EventQueueAsyncTest, DeterministicMerge)
+{
+    std::vector<int> log;
+    EventQueue dest("dest", 0);
+    EventQueue first("first", 1);
+    EventQueue second("second", 2);
+    RecordingEvent a(log, 0, Event::Default_Pri);
+    RecordingEvent b(log, 1, Event::Default_Pri);
+    RecordingEvent c(log, 2, Event::Default_Pri);
+    RecordingEvent d(log, 3, Event::Default_Pri);
+
+    inParallelMode = true;
+    deterministicAsyncInsertions = true;
+
+    // Post the events in an order which differs from the one of their
+    // sources
+    curEventQueue(&second);
+    dest.schedule(&c, 10);
+    curEventQueue(&first);
+    dest.schedule(&a, 10);
+    dest.schedule(&d, 5);
+    curEventQueue(&second);
+    dest.schedule(&b, 10);
+
+    curEventQueue(&dest);
+    dest.handleAsyncInsertions();
+    inParallelMode = false;
+    deterministicAsyncInsertions = false;
+
+    // Same bin events are serviced last in first, so the merge order
+    // is reversed within a bin
+    while (!dest.empty())
+        dest.serviceOne();
+    curEventQueue(nullptr);
+
+    EXPECT_EQ(log, std::vector<int>({3, 1, 2, 0}));
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/eventq_stats.hh"
+
+#include <algorithm>
+
+#include "base/cprintf.hh"
+#include "sim/stats.hh"
+
+namespace gem5
+{
+
+EventQueueStats::EventQueueStats(statistics::Group *parent,
+                                 const std::string &name,
+                                 EventQueue &_eventq)
+    : statistics::Group(parent, name.c_str()),
+      eventq(_eventq), base(_eventq.getCounters()),
+      ADD_STAT(scheduled, statistics::units::Count::get(),
+               "Number of events scheduled by the thread of the queue"),
+      ADD_STAT(asyncMerged, statistics::units::Count::get(),
+               "Number of events scheduled by other threads and merged "
+               "into the queue"),
+      ADD_STAT(descheduled, statistics::units::Count::get(),
+               "Number of events descheduled"),
+      ADD_STAT(rescheduled, statistics::units::Count::get(),
+               "Number of events rescheduled"),
+      ADD_STAT(serviced, statistics::units::Count::get(),
+               "Number of events processed"),
+      ADD_STAT(squashed, statistics::units::Count::get(),
+               "Number of squashed events skipped"),
+      ADD_STAT(barrierWaits, statistics::units::Count::get(),
+               "Number of waits on global event barriers"),
+      ADD_STAT(barrierWaitTime, statistics::units::Second::get(),
+               "Host time spent waiting on global event barriers"),
+      ADD_STAT(scheduleRate, statistics::units::Rate<
+                   statistics::units::Count, statistics::units::Second>::get(),
+               "Events scheduled, merged or rescheduled per host second"),
+      ADD_STAT(serviceRate, statistics::units::Rate<
+                   statistics::units::Count, statistics::units::Second>::get(),
+               "Events processed per host second"),
+      ADD_STAT(barrierWaitFraction, statistics::units::Ratio::get(),
+               "Fraction of the host time spent waiting on barriers"),
+      ADD_STAT(pending, statistics::units::Count::get(),
+               "Number of events in the queue"),
+      ADD_STAT(bins, statistics::units::Count::get(),
+               "Number of distinct (tick, priority) pairs in the queue"),
+      ADD_STAT(maxBinDepth, statistics::units::Count::get(),
+               "Largest number of events sharing a (tick, priority) pair"),
+      ADD_STAT(scheduleDistance, statistics::units::Tick::get(),
+               "Distribution of the distance between the current tick and "
+               "the tick events are scheduled for")
+{
+    scheduleRate = (scheduled + asyncMerged + rescheduled) / hostSeconds;
+    serviceRate = serviced / hostSeconds;
+    barrierWaitFraction = barrierWaitTime / hostSeconds;
+    scheduleRate.precision(0);
+    serviceRate.precision(0);
+    barrierWaitTime.precision(6);
+
+    pending.functor([this]() {
+        size_t total = 0;
+        for (size_t depth : eventq.binDepths())
+            total += depth;
+        return total;
+    });
+    bins.functor([this]() { return eventq.binDepths().size(); });
+    maxBinDepth.functor([this]() {
+        const auto depths = eventq.binDepths();
+        return depths.empty() ? 0 :
+            *std::max_element(depths.begin(), depths.end());
+    });
+
+    scheduleDistance
+        .init(EventQueue::Counters::DistanceBuckets)
+        .flags(statistics::total | statistics::nozero)
+        ;
+    scheduleDistance.subname(0, "0");
+    for (int i = 1; i < EventQueue::Counters::DistanceBuckets; i++) {
+        const uint64_t low = uint64_t(1) << (i - 1);
+        scheduleDistance.subname(i, csprintf("%d-%d", low, 2 * low - 1));
+    }
+}
+
+void
+EventQueueStats::preDumpStats()
+{
+    statistics::Group::preDumpStats();
+
+    const auto &counters = eventq.getCounters();
+    scheduled = counters.scheduled - base.scheduled;
+    asyncMerged = counters.asyncMerged - base.asyncMerged;
+    descheduled = counters.descheduled - base.descheduled;
+    rescheduled = counters.rescheduled - base.rescheduled;
+    serviced = counters.serviced - base.serviced;
+    squashed = counters.squashed - base.squashed;
+    barrierWaits = counters.barrierWaits - base.barrierWaits;
+    barrierWaitTime =
+        (counters.barrierWaitNs - base.barrierWaitNs) / 1e9;
+    for (int i = 0; i < EventQueue::Counters::DistanceBuckets; i++)
+        scheduleDistance[i] = counters.distance[i] - base.distance[i];
+}
+
+void
+EventQueueStats::resetStats()
+{
+    statistics::Group::resetStats();
+    base = eventq.getCounters();
+}
+
+} // namespace gem5
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_EVENTQ_STATS_HH__
+#define __SIM_EVENTQ_STATS_HH__
+
+#include <string>
+
+#include "base/statistics.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+/**
+ * Statistics of an event queue: how busy it is, how far ahead events
+ * are scheduled, and how long its thread waits on global barriers.
+ *
+ * The queue only maintains plain counters (EventQueue::Counters) on
+ * its fast paths. They are copied into the statistics before every
+ * dump, relative to their values at the last reset.
+ */
+class EventQueueStats : public statistics::Group
+{
+  public:
+    EventQueueStats(statistics::Group *parent, const std::string &name,
+                    EventQueue &eventq);
+
+    void preDumpStats() override;
+    void resetStats() override;
+
+  private:
+    EventQueue &eventq;
+
+    /** Counters at the last reset */
+    EventQueue::Counters base;
+
+    statistics::Scalar scheduled;
+    statistics::Scalar asyncMerged;
+    statistics::Scalar descheduled;
+    statistics::Scalar rescheduled;
+    statistics::Scalar serviced;
+    statistics::Scalar squashed;
+    statistics::Scalar barrierWaits;
+    statistics::Scalar barrierWaitTime;
+
+    statistics::Formula scheduleRate;
+    statistics::Formula serviceRate;
+    statistics::Formula barrierWaitFraction;
+
+    statistics::Value pending;
+    statistics::Value bins;
+    statistics::Value maxBinDepth;
+
+    statistics::Vector scheduleDistance;
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENTQ_STATS_HH__
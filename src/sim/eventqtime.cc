@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Micro-benchmark of the event queue implementations.
+ *
+ * This uses the classic "hold" model: a fixed number of events are
+ * pending and every serviced event schedules itself again a random
+ * delay into the future. Most delays are a few clock cycles, like the
+ * ones of the pipelines and links of a memory system or network, with
+ * a small fraction of long delays representing timeouts and devices.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+constexpr Tick Cycle = 500;
+
+/** Delays shared by all events, pre-generated to keep RNG out. */
+std::vector<Tick> delays;
+
+class HoldEvent : public Event
+{
+  public:
+    HoldEvent(EventQueue &_eq, size_t _next)
+        : Event(Default_Pri), eq(_eq), next(_next)
+    {}
+
+    void
+    process() override
+    {
+        next = (next + 1) % delays.size();
+        eq.schedule(this, eq.getCurTick() + delays[next]);
+    }
+
+  private:
+    EventQueue &eq;
+    size_t next;
+};
+
+double
+run(bool calendar, size_t num_events, size_t num_ops)
+{
+    EventQueue eq("bench_queue");
+    eq.useCalendar(calendar);
+    curEventQueue(&eq);
+
+    std::vector<std::unique_ptr<HoldEvent>> events;
+    for (size_t i = 0; i < num_events; i++) {
+        events.emplace_back(new HoldEvent(eq, i * 7919));
+        eq.schedule(events.back().get(), delays[i % delays.size()]);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < num_ops; i++)
+        eq.serviceOne();
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    while (!eq.empty())
+        eq.deschedule(eq.getHead());
+    curEventQueue(nullptr);
+
+    return num_ops / elapsed.count();
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char **argv)
+{
+    const size_t num_ops = argc > 1 ? std::strtoull(argv[1], nullptr, 0) :
+        2000000;
+
+    std::mt19937_64 rng(0);
+    delays.resize(1 << 16);
+    for (auto &delay : delays) {
+        if (rng() % 64 == 0)
+            delay = Cycle * (1000 + rng() % 100000);
+        else
+            delay = Cycle * (1 + rng() % 16);
+    }
+
+    for (size_t num_events : {16, 256, 4096, 65536}) {
+        const double list = run(false, num_events, num_ops);
+        const double calendar = run(true, num_events, num_ops);
+        ccprintf(std::cout,
+                 "%6d pending events: list %.0f events/s, "
+                 "calendar %.0f events/s (%.2fx)\n",
+                 num_events, list, calendar, calendar / list);
+    }
+
+    return 0;
+}
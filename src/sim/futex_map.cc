@@ -28,6 +28,11 @@
 
 #include <sim/futex_map.hh>
 
+#include "base/logging.hh"
+#include "sim/guest_thread_scheduler.hh"
+#include "sim/process.hh"
+#include "sim/se_workload.hh"
+
 namespace gem5
 {
 
@@ -49,6 +54,15 @@ WaiterState::checkMask(int wakeup_bitmask) const
     return bitmask & wakeup_bitmask;
 }
 
+void
+WaiterState::wake() const
+{
+    if (thread)
+        thread->process->seWorkload->threadScheduler().wake(thread);
+    else
+        tc->activate();
+}
+
 void
 FutexMap::suspend(Addr addr, uint64_t tgid, ThreadContext *tc)
 {
@@ -72,11 +86,12 @@ FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
         // memory addresses outside of syscalls, so we
         // must only count threads that were actually
         // woken up by this syscall.
-        auto& tc = waiterList.front().tc;
-        tc->activate();
+        auto &waiter = waiterList.front();
+        if (!waiter.thread)
+            waitingTcs.erase(waiter.tc);
+        waiter.wake();
         woken_up++;
         waiterList.pop_front();
-        waitingTcs.erase(tc);
     }
 
     if (waiterList.empty())
@@ -122,8 +137,9 @@ FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
         WaiterState& waiter = *iter;
 
         if (waiter.checkMask(bitmask)) {
-            waiter.tc->activate();
-            waitingTcs.erase(waiter.tc);
+            if (!waiter.thread)
+                waitingTcs.erase(waiter.tc);
+            waiter.wake();
             iter = waiterList.erase(iter);
             woken_up++;
         } else {
@@ -150,7 +166,10 @@ FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
     auto &waiterList1 = it1->second;
 
     while (!waiterList1.empty() && woken_up < count) {
-        waiterList1.front().tc->activate();
+        auto &waiter = waiterList1.front();
+        if (!waiter.thread)
+            waitingTcs.erase(waiter.tc);
+        waiter.wake();
         waiterList1.pop_front();
         woken_up++;
     }
@@ -187,4 +206,34 @@ FutexMap::is_waiting(ThreadContext *tc)
     return waitingTcs.find(tc) != waitingTcs.end();
 }
 
+void
+FutexMap::park(ThreadContext *tc, GuestThread *thread)
+{
+    for (auto &futex: *this) {
+        for (auto &waiter: futex.second) {
+            if (waiter.tc == tc && !waiter.thread) {
+                waiter.tc = nullptr;
+                waiter.thread = thread;
+                waitingTcs.erase(tc);
+                return;
+            }
+        }
+    }
+    panic("Parked thread context isn't waiting on a futex");
+}
+
+void
+FutexMap::forget(const GuestThread *thread)
+{
+    for (auto it = begin(); it != end();) {
+        it->second.remove_if([thread](const WaiterState &waiter) {
+            return waiter.thread == thread;
+        });
+        if (it->second.empty())
+            it = erase(it);
+        else
+            ++it;
+    }
+}
+
 } // namespace gem5
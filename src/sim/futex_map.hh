@@ -37,6 +37,8 @@
 namespace gem5
 {
 
+class GuestThread;
+
 /**
  * FutexKey class defines an unique identifier for a particular futex in the
  * system. The tgid and an address are the unique values needed as the key.
@@ -89,6 +91,9 @@ class WaiterState
     ThreadContext* tc;
     int bitmask;
 
+    /** Thread waiting without a context, parked by the scheduler */
+    GuestThread *thread = nullptr;
+
     /**
      * this constructor is used if futex ops with bitset are used
      */
@@ -99,6 +104,9 @@ class WaiterState
      * a waking thread and this thread's internal bitmask is non-zero
      */
     bool checkMask(int wakeup_bitmask) const;
+
+    /** Resume the waiting thread */
+    void wake() const;
 };
 
 typedef std::list<WaiterState> WaiterList;
@@ -138,6 +146,15 @@ class FutexMap : public std::unordered_map<FutexKey, WaiterList>
      */
     bool is_waiting(ThreadContext *tc);
 
+    /**
+     * The thread waiting on a context was parked by the guest thread
+     * scheduler, which will find it a context once it is woken up.
+     */
+    void park(ThreadContext *tc, GuestThread *thread);
+
+    /** Stop tracking a parked thread which is discarded. */
+    void forget(const GuestThread *thread);
+
   private:
 
     std::unordered_set<ThreadContext *> waitingTcs;
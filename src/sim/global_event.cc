@@ -29,12 +29,18 @@
 
 #include "sim/global_event.hh"
 
+#include <algorithm>
+
+#include "base/intmath.hh"
 #include "sim/cur_tick.hh"
 
 namespace gem5
 {
 
+AdaptiveQuantumCounters adaptiveQuantumCounters;
+
 std::mutex BaseGlobalEvent::globalQMutex;
+bool BaseGlobalEvent::cooperativeBarriers = false;
 
 BaseGlobalEvent::BaseGlobalEvent(Priority p, Flags f)
     : barrier(numMainEventQueues),
@@ -136,7 +142,7 @@ GlobalEvent::BarrierEvent::process()
 
     // second barrier to force all queues to wait for event processing
     // to finish before continuing
-    globalBarrier();
+    releaseBarrier();
 }
 
 
@@ -150,14 +156,49 @@ GlobalSyncEvent::BarrierEvent::process()
 
     // second barrier to force all queues to wait for event processing
     // to finish before continuing
-    globalBarrier();
+    releaseBarrier();
     curEventQueue()->handleAsyncInsertions();
 }
 
 void
 GlobalSyncEvent::process()
 {
-    if (repeat) {
+    if (!repeat)
+        return;
+
+    if (maxRepeat > repeat) {
+        // All threads are waiting on the barrier, so nothing can race
+        // with the counter here.
+        const uint64_t accesses = numCrossQueueAccesses.load();
+        const auto now = std::chrono::steady_clock::now();
+        const uint64_t host_ns =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                now - lastSync).count();
+
+        // Compare accesses over the same amount of simulated time,
+        // rounding up so that a single access always counts.
+        const uint64_t rate = divCeil(
+            (accesses - lastCrossQueueAccesses) * repeat, curRepeat);
+
+        auto &counters = adaptiveQuantumCounters;
+        if (rate > shrinkAccesses) {
+            if (curRepeat != repeat)
+                counters.shrinks++;
+            curRepeat = repeat;
+        } else if (rate <= growAccesses &&
+                   (!targetHostNs || host_ns < targetHostNs)) {
+            if (curRepeat != maxRepeat)
+                counters.grows++;
+            curRepeat = std::min(curRepeat * 2, maxRepeat);
+        }
+        lastCrossQueueAccesses = accesses;
+        lastSync = now;
+
+        counters.syncs++;
+        counters.totalQuantum += curRepeat;
+        counters.current = curRepeat;
+        schedule(curTick() + curRepeat);
+    } else {
         schedule(curTick() + repeat);
     }
 }
@@ -168,4 +209,64 @@ GlobalSyncEvent::description() const
     return "GlobalSyncEvent";
 }
 
+LookaheadSyncEvent::LookaheadSyncEvent(Tick when, Tick _lookahead,
+                                       Priority p, Flags f)
+    : Base(p, f), lookahead(_lookahead),
+      localNextTick(numMainEventQueues, MaxTick), lbts(0)
+{
+    assert(lookahead > 0);
+    schedule(when);
+}
+
+void
+LookaheadSyncEvent::BarrierEvent::process()
+{
+    auto *sync = static_cast<LookaheadSyncEvent *>(_globalEvent);
+    EventQueue *eventq = curEventQueue();
+
+    // Once all threads have arrived, nobody can post events to this
+    // queue any more, so everything sent during the last window can be
+    // merged before looking at the head of the queue.
+    globalBarrier();
+    eventq->handleAsyncInsertions();
+
+    auto it = std::find(sync->barrierEvent.begin(),
+                        sync->barrierEvent.end(), this);
+    assert(it != sync->barrierEvent.end());
+    sync->localNextTick[it - sync->barrierEvent.begin()] =
+        eventq->empty() ? MaxTick : eventq->nextTick();
+
+    if (globalBarrier()) {
+        _globalEvent->process();
+    }
+
+    globalBarrier();
+    eventq->handleAsyncInsertions();
+
+    // No queue has anything to do before the LBTS, so move local time
+    // forward. This keeps global events scheduled relative to the
+    // current tick (e.g., asynchronous stat dumps) out of the window.
+    if (eventq->getCurTick() < sync->lbts)
+        eventq->setCurTick(sync->lbts);
+}
+
+void
+LookaheadSyncEvent::process()
+{
+    lbts = *std::min_element(localNextTick.begin(), localNextTick.end());
+
+    const Tick next = lbts < MaxTick - lookahead ? lbts + lookahead : MaxTick;
+
+    // The only way for the window not to advance is to hit the end of
+    // time, in which case the exit event will terminate the loop.
+    if (next > curTick())
+        schedule(next);
+}
+
+const char *
+LookaheadSyncEvent::description() const
+{
+    return "LookaheadSyncEvent";
+}
+
 } // namespace gem5
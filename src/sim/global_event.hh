@@ -30,11 +30,13 @@
 #ifndef __SIM_GLOBAL_EVENT_HH__
 #define __SIM_GLOBAL_EVENT_HH__
 
+#include <chrono>
 #include <mutex>
 #include <vector>
 
 #include "base/barrier.hh"
 #include "sim/eventq.hh"
+#include "sim/host_timeline.hh"
 
 namespace gem5
 {
@@ -92,6 +94,9 @@ class BaseGlobalEvent : public EventBase
 
         bool globalBarrier()
         {
+            if (cooperativeBarriers)
+                return _globalEvent->arrive();
+
             // This method will be called from the process() method in
             // the local barrier events
             // (GlobalSyncEvent::BarrierEvent).  The local event
@@ -100,8 +105,30 @@ class BaseGlobalEvent : public EventBase
             // locked when entering this method. We need to unlock it
             // while waiting on the barrier to prevent deadlocks if
             // another thread wants to lock the event queue.
-            EventQueue::ScopedRelease release(curEventQueue());
-            return _globalEvent->barrier.wait();
+            EventQueue *eventq = curEventQueue();
+            EventQueue::ScopedRelease release(eventq);
+            const auto start = std::chrono::steady_clock::now();
+            host_timeline::Span span("barrier wait");
+            const bool last = _globalEvent->barrier.wait();
+            eventq->countBarrierWait(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count());
+            return last;
+        }
+
+        /**
+         * Wait for the global event to be processed before servicing
+         * the next events of this queue. Cooperative barriers are
+         * serviced by a single thread which does not return to any
+         * queue until all of them arrived, so this only blocks with
+         * threaded barriers, and only the first barrier of each queue
+         * counts as an arrival.
+         */
+        void
+        releaseBarrier()
+        {
+            if (!cooperativeBarriers)
+                globalBarrier();
         }
 
       public:
@@ -115,7 +142,25 @@ class BaseGlobalEvent : public EventBase
     //! The individual local event instances (one per thread/event queue).
     std::vector<BarrierEvent *> barrierEvent;
 
+    //! Number of queues that arrived at the cooperative barrier.
+    uint32_t numArrived = 0;
+
+    //! Non-blocking barrier arrival. Returns true for the last queue.
+    bool
+    arrive()
+    {
+        if (++numArrived < numMainEventQueues)
+            return false;
+        numArrived = 0;
+        return true;
+    }
+
   public:
+    //! When set, the local barrier events are serviced one queue at a
+    //! time by a single thread after all queues have reached them, so
+    //! the barrier only needs to count arrivals instead of blocking.
+    static bool cooperativeBarriers;
+
     BaseGlobalEvent(Priority p, Flags f);
 
     virtual ~BaseGlobalEvent();
@@ -237,7 +282,102 @@ class GlobalSyncEvent : public BaseGlobalEventTemplate<GlobalSyncEvent>
 
     const char *description() const;
 
+    /**
+     * Let the period grow, doubling up to max_repeat, while threads
+     * rarely access other event queues between two synchronizations.
+     * The accesses are scaled to a period of repeat ticks: at most
+     * grow_accesses let the period double, and more than
+     * shrink_accesses reset it to repeat.
+     *
+     * @param max_repeat Upper bound of the period.
+     * @param grow_accesses Accesses up to which the period grows.
+     * @param shrink_accesses Accesses above which the period resets.
+     * @param target_host_ns Host time a period must take less than to
+     *        grow, or zero to ignore the host time.
+     */
+    void
+    adaptRepeat(Tick max_repeat, uint64_t grow_accesses=0,
+                uint64_t shrink_accesses=0, uint64_t target_host_ns=0)
+    {
+        maxRepeat = max_repeat;
+        growAccesses = grow_accesses;
+        shrinkAccesses = shrink_accesses;
+        targetHostNs = target_host_ns;
+        curRepeat = repeat;
+        lastCrossQueueAccesses = numCrossQueueAccesses.load();
+        lastSync = std::chrono::steady_clock::now();
+    }
+
     Tick repeat;
+
+  private:
+    Tick maxRepeat = 0;
+    Tick curRepeat = 0;
+    uint64_t growAccesses = 0;
+    uint64_t shrinkAccesses = 0;
+    uint64_t targetHostNs = 0;
+    uint64_t lastCrossQueueAccesses = 0;
+    std::chrono::steady_clock::time_point lastSync;
+};
+
+/**
+ * Decisions of the adaptive simulation quantum, accumulated over the
+ * whole simulation.
+ */
+struct AdaptiveQuantumCounters
+{
+    /** Number of synchronizations with an adaptive quantum. */
+    uint64_t syncs = 0;
+    /** Number of times the quantum doubled. */
+    uint64_t grows = 0;
+    /** Number of times the quantum was reset. */
+    uint64_t shrinks = 0;
+    /** Sum of the quanta chosen at every synchronization. */
+    Tick totalQuantum = 0;
+    /** The quantum chosen at the last synchronization. */
+    Tick current = 0;
+};
+
+extern AdaptiveQuantumCounters adaptiveQuantumCounters;
+
+/**
+ * A global synchronization event for conservative, lookahead-based
+ * parallel simulation. Rather than synchronizing at a fixed period,
+ * all threads agree on the lower bound on the time stamp (LBTS) of
+ * the events pending in any queue. Since no thread can post an event
+ * to another queue less than the lookahead into its own future, every
+ * queue can then safely run up to LBTS + lookahead before the next
+ * synchronization. Periods where no queue has work are skipped.
+ */
+class LookaheadSyncEvent
+    : public BaseGlobalEventTemplate<LookaheadSyncEvent>
+{
+  public:
+    typedef BaseGlobalEventTemplate<LookaheadSyncEvent> Base;
+
+    class BarrierEvent : public Base::BarrierEvent
+    {
+      public:
+        void process();
+        BarrierEvent(Base *global_event, Priority p, Flags f)
+            : Base::BarrierEvent(global_event, p, f)
+        { }
+    };
+
+    LookaheadSyncEvent(Tick when, Tick _lookahead, Priority p, Flags f);
+
+    void process();
+
+    const char *description() const;
+
+    Tick lookahead;
+
+  private:
+    //! Next pending event of every queue, published at the barrier.
+    std::vector<Tick> localNextTick;
+
+    //! Lower bound on the time stamp of any event in the current window.
+    Tick lbts;
 };
 
 } // namespace gem5
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "sim/eventq.hh"
+#include "sim/global_event.hh"
+
+using namespace gem5;
+
+/*
+ * Simulator threads servicing several queues each use cooperative
+ * barriers: once every queue is parked at a global event, a single
+ * thread services the local barrier events one queue after the other.
+ */
+
+namespace
+{
+
+/** Global event checking that it runs once all queues arrived */
+class CheckingGlobalEvent : public GlobalEvent
+{
+  public:
+    CheckingGlobalEvent(Tick when) : GlobalEvent(when, Default_Pri, 0) {}
+
+    void
+    process() override
+    {
+        EXPECT_FALSE(scheduled());
+        processed++;
+    }
+
+    const char *description() const override { return "test"; }
+
+    int processed = 0;
+};
+
+class CooperativeBarrierTest : public ::testing::Test
+{
+  protected:
+    // An even number of queues, every queue services two barriers.
+    static constexpr uint32_t numQueues = 4;
+
+    void
+    SetUp() override
+    {
+        getEventQueue(numQueues - 1);
+        ASSERT_EQ(numMainEventQueues, numQueues);
+        BaseGlobalEvent::cooperativeBarriers = true;
+    }
+
+    void TearDown() override { BaseGlobalEvent::cooperativeBarriers = false; }
+
+    /** Service the barrier events the way simulator threads do. */
+    void
+    serviceBarriers()
+    {
+        for (uint32_t i = numQueues; i-- > 0;) {
+            curEventQueue(mainEventQueue[i]);
+            ASSERT_FALSE(mainEventQueue[i]->empty());
+            ASSERT_NE(mainEventQueue[i]->getHead()->globalEvent(), nullptr);
+            mainEventQueue[i]->serviceOne();
+        }
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(CooperativeBarrierTest, ProcessOnce)
+{
+    CheckingGlobalEvent event(100);
+    ASSERT_TRUE(event.scheduled());
+    serviceBarriers();
+    EXPECT_EQ(event.processed, 1);
+    EXPECT_FALSE(event.scheduled());
+}
+
+TEST_F(CooperativeBarrierTest, SyncEventRepeats)
+{
+    const Tick start = mainEventQueue[0]->getCurTick() + 1000;
+    GlobalSyncEvent sync(start, 1000, Event::Default_Pri, 0);
+    for (int i = 1; i <= 3; i++) {
+        serviceBarriers();
+        ASSERT_TRUE(sync.scheduled());
+        EXPECT_EQ(sync.when(), start + i * 1000);
+        for (uint32_t q = 0; q < numQueues; q++)
+            EXPECT_EQ(mainEventQueue[q]->getCurTick(), start + (i - 1) * 1000);
+    }
+    sync.deschedule();
+}
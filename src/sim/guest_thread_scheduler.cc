@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/guest_thread_scheduler.hh"
+
+#include <algorithm>
+
+#include "arch/generic/isa.hh"
+#include "arch/generic/mmu.hh"
+#include "base/trace.hh"
+#include "cpu/thread_context.hh"
+#include "debug/Thread.hh"
+#include "sim/cur_tick.hh"
+#include "sim/process.hh"
+#include "sim/system.hh"
+
+namespace gem5
+{
+
+GuestThread::GuestThread(ThreadContext *tc)
+    : process(tc->getProcessPtr()), pc(tc->pcState().clone())
+{
+    const auto &reg_classes = tc->getIsaPtr()->regClasses();
+    for (const auto *reg_class: reg_classes) {
+        if (reg_class->type() == MiscRegClass)
+            continue;
+
+        const size_t reg_bytes = reg_class->regBytes();
+        std::vector<uint8_t> values(reg_bytes * reg_class->numRegs());
+        auto *reg_ptr = values.data();
+        for (const auto &id: *reg_class) {
+            tc->getReg(id, reg_ptr);
+            reg_ptr += reg_bytes;
+        }
+        regs.push_back(std::move(values));
+    }
+
+    const BaseISA *isa = tc->getIsaPtr();
+    miscRegs.resize(reg_classes.at(MiscRegClass)->numRegs());
+    for (int i = 0; i < miscRegs.size(); i++) {
+        if (isa->isValidMiscReg(i))
+            miscRegs[i] = tc->readMiscRegNoEffect(i);
+    }
+}
+
+void
+GuestThread::restoreRegs(ThreadContext *tc) const
+{
+    const auto &reg_classes = tc->getIsaPtr()->regClasses();
+    auto values = regs.begin();
+    for (const auto *reg_class: reg_classes) {
+        if (reg_class->type() == MiscRegClass)
+            continue;
+
+        const size_t reg_bytes = reg_class->regBytes();
+        auto *reg_ptr = values->data();
+        for (const auto &id: *reg_class) {
+            tc->setReg(id, reg_ptr);
+            reg_ptr += reg_bytes;
+        }
+        ++values;
+    }
+
+    const BaseISA *isa = tc->getIsaPtr();
+    for (int i = 0; i < miscRegs.size(); i++) {
+        if (isa->isValidMiscReg(i))
+            tc->setMiscRegNoEffect(i, miscRegs[i]);
+    }
+
+    tc->pcState(*pc);
+}
+
+void
+GuestThreadScheduler::bind(ThreadContext *tc, Process *process)
+{
+    Process *owner = tc->getProcessPtr();
+    if (owner == process)
+        return;
+
+    tc->setProcessPtr(process);
+    process->assignThreadContext(tc->contextId());
+    owner->revokeThreadContext(tc->contextId());
+
+    // There are no address space identifiers in SE mode, the TLBs
+    // would keep translating with the page table of the previous process.
+    tc->getMMUPtr()->flushAll();
+}
+
+void
+GuestThreadScheduler::park(ThreadContext *tc)
+{
+    threads.push_back(std::make_unique<GuestThread>(tc));
+    runQueue.push_back(threads.back().get());
+    DPRINTF(Thread, "Parked thread of pid %d, %d threads parked\n",
+            tc->getProcessPtr()->pid(), threads.size());
+}
+
+void
+GuestThreadScheduler::wake(GuestThread *thread)
+{
+    assert(thread->blocked);
+    thread->blocked = false;
+    runQueue.push_back(thread);
+    dispatch();
+}
+
+void
+GuestThreadScheduler::switchIn(GuestThread *thread, ThreadContext *tc)
+{
+    DPRINTF(Thread, "Switching thread of pid %d onto context %d\n",
+            thread->process->pid(), tc->contextId());
+
+    bind(tc, thread->process);
+    thread->restoreRegs(tc);
+    sliceStart[tc->contextId()] = curTick();
+
+    auto it = std::find_if(threads.begin(), threads.end(),
+            [thread](const auto &t) { return t.get() == thread; });
+    assert(it != threads.end());
+    threads.erase(it);
+}
+
+ThreadContext *
+GuestThreadScheduler::freeContext()
+{
+    if (ThreadContext *tc = system->threads.findFree())
+        return tc;
+
+    // The thread of a context sleeping on a futex can wait without it,
+    // the futex wakes it up wherever it is.
+    for (ThreadContext *tc: system->threads) {
+        if (tc->status() != ThreadContext::Suspended ||
+            !system->futexMap.is_waiting(tc)) {
+            continue;
+        }
+
+        threads.push_back(std::make_unique<GuestThread>(tc));
+        GuestThread *blocked = threads.back().get();
+        blocked->blocked = true;
+        system->futexMap.park(tc, blocked);
+        DPRINTF(Thread, "Parked blocked thread of pid %d\n",
+                blocked->process->pid());
+        return tc;
+    }
+
+    return nullptr;
+}
+
+void
+GuestThreadScheduler::dispatch()
+{
+    while (!runQueue.empty()) {
+        ThreadContext *tc = freeContext();
+        if (!tc)
+            return;
+
+        GuestThread *thread = runQueue.front();
+        runQueue.pop_front();
+        switchIn(thread, tc);
+        tc->activate();
+    }
+}
+
+void
+GuestThreadScheduler::syscallDone(ThreadContext *tc)
+{
+    if (runQueue.empty())
+        return;
+
+    if (tc->status() == ThreadContext::Active &&
+        curTick() - sliceStart[tc->contextId()] >= quantum) {
+        park(tc);
+
+        GuestThread *next = runQueue.front();
+        runQueue.pop_front();
+        switchIn(next, tc);
+    }
+
+    // This also hands over the context if the thread exited or started
+    // waiting on a futex
+    dispatch();
+}
+
+bool
+GuestThreadScheduler::hasThreads(uint64_t tgid) const
+{
+    return std::any_of(threads.begin(), threads.end(),
+            [tgid](const auto &t) { return t->process->tgid() == tgid; });
+}
+
+void
+GuestThreadScheduler::discard(uint64_t tgid)
+{
+    auto in_group = [tgid](const GuestThread *t) {
+        return t->process->tgid() == tgid;
+    };
+
+    runQueue.erase(std::remove_if(runQueue.begin(), runQueue.end(),
+                                  in_group),
+                   runQueue.end());
+
+    for (auto it = threads.begin(); it != threads.end();) {
+        if (in_group(it->get())) {
+            if ((*it)->blocked)
+                system->futexMap.forget(it->get());
+            it = threads.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+} // namespace gem5
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_GUEST_THREAD_SCHEDULER_HH__
+#define __SIM_GUEST_THREAD_SCHEDULER_HH__
+
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "arch/generic/pcstate.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class Process;
+class System;
+class ThreadContext;
+
+/**
+ * Architectural state of an SE mode guest thread which doesn't have a
+ * thread context to run on.
+ */
+class GuestThread
+{
+  public:
+    /** Capture the state of the thread running on a context. */
+    GuestThread(ThreadContext *tc);
+
+    /** Load the registers of the thread into a context. */
+    void restoreRegs(ThreadContext *tc) const;
+
+    /** Process of the thread. */
+    Process *const process;
+
+    /** Is the thread waiting on a futex? */
+    bool blocked = false;
+
+  private:
+    /** Values of the registers of every class but the misc registers */
+    std::vector<std::vector<uint8_t>> regs;
+    std::vector<RegVal> miscRegs;
+    std::unique_ptr<PCStateBase> pc;
+};
+
+/**
+ * Time slices SE mode guest threads onto the thread contexts of a
+ * system, so that workloads can create more threads than there are
+ * contexts.
+ *
+ * A thread created by clone() when all contexts are busy is parked here
+ * until a context is released, either by a thread exiting or blocking
+ * on a futex, or by a running thread using up its time slice while
+ * others are waiting. Threads are only switched at the end of a system
+ * call, where every CPU model holds the architectural state of the
+ * thread in its thread context.
+ */
+class GuestThreadScheduler
+{
+  public:
+    GuestThreadScheduler(Tick quantum) : quantum(quantum) {}
+
+    void setSystem(System *sys) { system = sys; }
+
+    /** Can threads be parked? Otherwise clone() fails without a context */
+    bool enabled() const { return quantum != 0; }
+
+    /** Park the thread of a context until a context is available. */
+    void park(ThreadContext *tc);
+
+    /** Put a blocked thread back on the run queue. */
+    void wake(GuestThread *thread);
+
+    /**
+     * Switch threads at the end of a system call if the context became
+     * free or its thread used up its time slice.
+     */
+    void syscallDone(ThreadContext *tc);
+
+    /** Number of parked threads, blocked or not. */
+    size_t numThreads() const { return threads.size(); }
+
+    /** Are there parked threads in a thread group? */
+    bool hasThreads(uint64_t tgid) const;
+
+    /** Drop the parked threads of a thread group which is exiting. */
+    void discard(uint64_t tgid);
+
+    /**
+     * Bind a context to a process, updating the contexts of the
+     * process it belonged to and flushing its TLBs.
+     */
+    static void bind(ThreadContext *tc, Process *process);
+
+  private:
+    /** Run the state of a parked thread on a context. */
+    void switchIn(GuestThread *thread, ThreadContext *tc);
+
+    /**
+     * Find a context for a thread of the run queue, parking the thread
+     * of a context waiting on a futex if none is halted.
+     */
+    ThreadContext *freeContext();
+
+    /** Give free contexts to the threads of the run queue. */
+    void dispatch();
+
+    const Tick quantum;
+    System *system = nullptr;
+
+    std::list<std::unique_ptr<GuestThread>> threads;
+    /** Parked threads which are not blocked, in arrival order */
+    std::deque<GuestThread *> runQueue;
+    /** When the time slice of the thread on each context started */
+    std::map<ContextID, Tick> sliceStart;
+};
+
+} // namespace gem5
+
+#endif // __SIM_GUEST_THREAD_SCHEDULER_HH__
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/host_timeline.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace host_timeline
+{
+
+bool enabled = false;
+
+namespace
+{
+
+struct Record
+{
+    const char *name;
+    int64_t arg;
+    uint64_t begin;
+    uint64_t end;
+};
+
+/** Protects timelines */
+std::mutex timelinesLock;
+std::vector<std::unique_ptr<std::vector<Record>>> timelines;
+
+thread_local std::vector<Record> *threadTimeline = nullptr;
+
+/** Protects names */
+std::mutex namesLock;
+std::unordered_set<std::string> names;
+
+std::vector<Record> &
+getTimeline()
+{
+    if (!threadTimeline) {
+        std::lock_guard<std::mutex> lock(timelinesLock);
+        timelines.emplace_back(new std::vector<Record>);
+        threadTimeline = timelines.back().get();
+    }
+    return *threadTimeline;
+}
+
+/** Print a time in nanoseconds as the microseconds Chrome expects. */
+void
+printTime(std::ostream &os, uint64_t ns)
+{
+    ccprintf(os, "%d.%03d", ns / 1000, ns % 1000);
+}
+
+} // anonymous namespace
+
+void
+enable()
+{
+    fatal_if(enabled, "The host timeline is already enabled.");
+    enabled = true;
+}
+
+uint64_t
+now()
+{
+    // The clock starts at an arbitrary point, which is never 0 in
+    // practice. Span uses 0 to tell it was not timed.
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void
+record(const char *name, int64_t arg, uint64_t begin, uint64_t end)
+{
+    getTimeline().push_back({name, arg, begin, end});
+}
+
+const char *
+intern(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(namesLock);
+    return names.insert(name).first->c_str();
+}
+
+void
+dump(std::ostream &os)
+{
+    std::lock_guard<std::mutex> lock(timelinesLock);
+
+    uint64_t origin = UINT64_MAX;
+    for (const auto &timeline : timelines) {
+        for (const auto &rec : *timeline)
+            origin = std::min(origin, rec.begin);
+    }
+
+    os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    const char *sep = "";
+    for (size_t tid = 0; tid < timelines.size(); tid++) {
+        ccprintf(os, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                 "\"tid\":%d,\"args\":{\"name\":\"simulator thread %d\"}}",
+                 sep, tid, tid);
+        sep = ",\n";
+        for (const auto &rec : *timelines[tid]) {
+            ccprintf(os, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,"
+                     "\"tid\":%d,\"ts\":", sep, rec.name, tid);
+            printTime(os, rec.begin - origin);
+            os << ",\"dur\":";
+            printTime(os, rec.end - rec.begin);
+            if (rec.arg >= 0)
+                ccprintf(os, ",\"args\":{\"arg\":%d}", rec.arg);
+            os << '}';
+        }
+    }
+    os << "\n]}\n";
+}
+
+} // namespace host_timeline
+} // namespace gem5
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_HOST_TIMELINE_HH__
+#define __SIM_HOST_TIMELINE_HH__
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+#include "base/compiler.hh"
+
+namespace gem5
+{
+
+/**
+ * Host time timeline of the simulator threads.
+ *
+ * When enabled, the simulator threads record spans of host time: running
+ * event queues, waiting at the barriers of global events, servicing
+ * asynchronous events, draining, dumping statistics, checkpointing and
+ * running Python events. The spans are written in the Chrome trace event
+ * format, which chrome://tracing and the Perfetto UI display as one track
+ * per thread.
+ *
+ * Every simulator thread records its spans in a buffer of its own, so
+ * recording does not take any lock. Spans are kept in memory until they
+ * are dumped.
+ */
+namespace host_timeline
+{
+
+/** Checked by Span before reading the host clock. */
+extern bool enabled;
+
+/** Start recording spans. */
+void enable();
+
+/** Host time in nanoseconds, on the clock spans are recorded with. */
+uint64_t now();
+
+/**
+ * Record a span of the current thread.
+ *
+ * @param name Name of the span, which must outlive the timeline.
+ * @param arg Argument of the span, e.g. a queue number, or -1 for none.
+ * @param begin Host time the span started at.
+ * @param end Host time the span ended at.
+ */
+void record(const char *name, int64_t arg, uint64_t begin, uint64_t end);
+
+/**
+ * Get a copy of a span name which outlives the timeline, for names which
+ * are not string literals.
+ */
+const char *intern(const std::string &name);
+
+/**
+ * Write the spans of all threads as a Chrome trace. No span may be
+ * recorded meanwhile.
+ */
+void dump(std::ostream &os);
+
+/** A span covering the lifetime of the object. */
+class Span
+{
+  private:
+    const char *const name;
+    const int64_t arg;
+    const uint64_t begin;
+
+  public:
+    Span(const char *_name, int64_t _arg=-1)
+        : name(_name), arg(_arg),
+          begin(GEM5_UNLIKELY(enabled) ? now() : 0)
+    {}
+
+    ~Span()
+    {
+        if (GEM5_UNLIKELY(begin))
+            record(name, arg, begin, now());
+    }
+
+    Span(const Span &) = delete;
+    Span &operator=(const Span &) = delete;
+};
+
+} // namespace host_timeline
+} // namespace gem5
+
+#endif // __SIM_HOST_TIMELINE_HH__
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <thread>
+
+#include "sim/host_timeline.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+size_t
+count(const std::string &s, const std::string &what)
+{
+    size_t n = 0;
+    for (size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + 1)) {
+        n++;
+    }
+    return n;
+}
+
+} // anonymous namespace
+
+/** Spans are only recorded once the timeline is enabled. */
+TEST(HostTimelineTest, Spans)
+{
+    {
+        host_timeline::Span span("before");
+    }
+
+    host_timeline::enable();
+    {
+        host_timeline::Span outer("outer");
+        host_timeline::Span inner("inner", 3);
+    }
+    std::thread([]() {
+        host_timeline::Span span(host_timeline::intern("other thread"));
+    }).join();
+
+    std::ostringstream os;
+    host_timeline::dump(os);
+    const std::string trace = os.str();
+
+    EXPECT_EQ(count(trace, "\"before\""), 0);
+    EXPECT_EQ(count(trace, "\"name\":\"outer\",\"ph\":\"X\",\"pid\":0,"
+                           "\"tid\":0,"), 1);
+    EXPECT_EQ(count(trace, "\"name\":\"inner\""), 1);
+    EXPECT_EQ(count(trace, "\"args\":{\"arg\":3}"), 1);
+    EXPECT_EQ(count(trace, "\"name\":\"other thread\",\"ph\":\"X\","
+                           "\"pid\":0,\"tid\":1,"), 1);
+    EXPECT_EQ(count(trace, "\"ph\":\"M\""), 2);
+    EXPECT_EQ(trace.front(), '{');
+    EXPECT_EQ(trace.substr(trace.size() - 3), "]}\n");
+}
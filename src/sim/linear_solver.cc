@@ -37,54 +37,131 @@
 
 #include "sim/linear_solver.hh"
 
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+#include "base/logging.hh"
+
 namespace gem5
 {
 
+std::vector <double>
+LinearSystem::rhs() const
+{
+    std::vector <double> b(matrix.size());
+    for (unsigned i = 0; i < matrix.size(); i++)
+        b[i] = -matrix[i][matrix[i].cnt()];
+    return b;
+}
+
 std::vector <double>
 LinearSystem::solve() const
 {
-    // Solve using gauss elimination, not ideal for big matrices
-    std::vector < LinearEquation > smatrix = this->matrix;
-
-    unsigned order = smatrix.size();
-    for (unsigned row = 0; row < order - 1; row++) {
-        // Look for a non-zero row, and swap
-        for (unsigned i = row; i < order; i++) {
-            if (smatrix[i][row] != 0.0f) {
-                if (i != row) {
-                    LinearEquation tmp = smatrix[i];
-                    smatrix[i] = smatrix[row];
-                    smatrix[row] = tmp;
-                }
-                break;
-            }
+    return LUDecomposition(*this).solve(rhs());
+}
+
+LUDecomposition::LUDecomposition(const LinearSystem &ls)
+{
+    unsigned order = ls.size();
+
+    // Factorize a dense copy in place, L below the diagonal and U on and
+    // above it.
+    std::vector < std::vector <double> > a(order,
+                                           std::vector <double>(order));
+    coeffs.resize(order);
+    for (unsigned i = 0; i < order; i++) {
+        for (unsigned j = 0; j < order; j++) {
+            a[i][j] = ls[i][j];
+            if (a[i][j] != 0.0)
+                coeffs[i].push_back({j, a[i][j]});
+        }
+    }
+
+    perm.resize(order);
+    std::iota(perm.begin(), perm.end(), 0);
+
+    for (unsigned k = 0; k < order; k++) {
+        unsigned pivot = k;
+        for (unsigned i = k + 1; i < order; i++) {
+            if (std::fabs(a[i][k]) > std::fabs(a[pivot][k]))
+                pivot = i;
+        }
+        fatal_if(a[pivot][k] == 0.0,
+                 "Singular linear system, x%d is not determined\n", k);
+        if (pivot != k) {
+            std::swap(a[pivot], a[k]);
+            std::swap(perm[pivot], perm[k]);
         }
 
-        // Divide row by leading number to make it 1.0
-        smatrix[row] *= (1.0f / smatrix[row][row]);
+        for (unsigned i = k + 1; i < order; i++) {
+            if (a[i][k] == 0.0)
+                continue;
+            double f = a[i][k] / a[k][k];
+            a[i][k] = f;
+            for (unsigned j = k + 1; j < order; j++)
+                a[i][j] -= f * a[k][j];
+        }
+    }
 
-        // Add it (properly scaled) to the rows below
-        for (unsigned i = row + 1; i < order; i++) {
-            LinearEquation t = smatrix[row];
-            t *= -1.0f * smatrix[i][row];
-            smatrix[i] = smatrix[i] + t;
+    lower.resize(order);
+    upper.resize(order);
+    diag.resize(order);
+    for (unsigned i = 0; i < order; i++) {
+        for (unsigned j = 0; j < order; j++) {
+            if (a[i][j] == 0.0 || i == j)
+                continue;
+            if (j < i)
+                lower[i].push_back({j, a[i][j]});
+            else
+                upper[i].push_back({j, a[i][j]});
         }
+        diag[i] = a[i][i];
     }
+}
 
-    // smatrix is now a triangular matrix with diagonal being 1
-    // Just backproagate variable values from order-1 till 0
-    std::vector <double> ret(order, 0.0f);
-    for (int row = order - 1; row >= 0; row--) {
-        // Unknown value
-        ret[row] = -smatrix[row][smatrix[row].cnt()] / smatrix[row][row];
-        // Propagate variable in the cnt term
-        for (int i = row - 1; i >= 0; i--) {
-            smatrix[i][smatrix[i].cnt()] += ret[row] * smatrix[i][row];
-            smatrix[i][row] = 0.0f;
+bool
+LUDecomposition::sameCoefficients(const LinearSystem &ls) const
+{
+    if (ls.size() != order())
+        return false;
+
+    for (unsigned i = 0; i < order(); i++) {
+        auto entry = coeffs[i].begin();
+        for (unsigned j = 0; j < order(); j++) {
+            double expected = 0.0;
+            if (entry != coeffs[i].end() && entry->col == j)
+                expected = (entry++)->value;
+            if (ls[i][j] != expected)
+                return false;
         }
     }
+    return true;
+}
+
+std::vector <double>
+LUDecomposition::solve(const std::vector <double> &b) const
+{
+    assert(b.size() == order());
+
+    // L * y = P * b
+    std::vector <double> x(order());
+    for (unsigned i = 0; i < order(); i++) {
+        double sum = b[perm[i]];
+        for (auto &e : lower[i])
+            sum -= e.value * x[e.col];
+        x[i] = sum;
+    }
+
+    // U * x = y
+    for (int i = order() - 1; i >= 0; i--) {
+        double sum = x[i];
+        for (auto &e : upper[i])
+            sum -= e.value * x[e.col];
+        x[i] = sum / diag[i];
+    }
 
-    return ret;
+    return x;
 }
 
 } // namespace gem5
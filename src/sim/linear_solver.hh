@@ -71,6 +71,16 @@ class LinearEquation
         return res;
     }
 
+    // Add another equation to this one
+    LinearEquation & operator+= (const LinearEquation& rhs) {
+        assert(this->eq.size() == rhs.eq.size());
+
+        for (unsigned i = 0; i < eq.size(); i++)
+            eq[i] += rhs.eq[i];
+
+        return *this;
+    }
+
     // Multiply the equation by a constant
     LinearEquation & operator*= (const double cnt) {
         for (auto & c: eq)
@@ -85,6 +95,11 @@ class LinearEquation
         return eq[unkw];
     }
 
+    double operator[] (unsigned unkw) const {
+        assert(unkw < eq.size());
+        return eq[unkw];
+    }
+
     // Get a string representation
     std::string toStr() const {
         std::ostringstream oss;
@@ -121,6 +136,19 @@ class LinearSystem
         return matrix[eq];
     }
 
+    const LinearEquation & operator[] (unsigned eq) const {
+        assert(eq < matrix.size());
+        return matrix[eq];
+    }
+
+    unsigned size() const { return matrix.size(); }
+
+    /**
+     * Get the right hand side of the system once written as A * x = b,
+     * that is the negated constant terms of the equations.
+     */
+    std::vector <double> rhs() const;
+
     std::string toStr() const {
         std::string r;
         for (auto & eq: matrix)
@@ -134,6 +162,61 @@ class LinearSystem
     std::vector < LinearEquation > matrix;
 };
 
+/**
+ * LU factorization, with partial pivoting, of the coefficients of a
+ * linear system. Factorizing is as expensive as solving the system once,
+ * but the factors solve it again for any other constant terms with a
+ * forward and a backward substitution. The factors are stored sparsely,
+ * so substitutions only cost as much as their non-zero entries, which
+ * are few for the nodal equations of a circuit.
+ */
+class LUDecomposition
+{
+  public:
+    /** An empty factorization, which matches no system */
+    LUDecomposition() {}
+
+    LUDecomposition(const LinearSystem &ls);
+
+    /**
+     * Check whether a system has the coefficients these factors were
+     * computed from, whatever its constant terms.
+     */
+    bool sameCoefficients(const LinearSystem &ls) const;
+
+    /**
+     * Solve A * x = b, A being the factorized coefficients.
+     *
+     * @param b The right hand side of the system.
+     * @return The value of each unknown.
+     */
+    std::vector <double> solve(const std::vector <double> &b) const;
+
+    unsigned order() const { return perm.size(); }
+
+  private:
+    struct Entry
+    {
+        unsigned col;
+        double value;
+    };
+
+    typedef std::vector <Entry> SparseRow;
+
+    /** Non-zero coefficients of the factorized system */
+    std::vector <SparseRow> coeffs;
+
+    /** Strictly lower part of L, which has a unit diagonal */
+    std::vector <SparseRow> lower;
+    /** Strictly upper part of U */
+    std::vector <SparseRow> upper;
+    /** Diagonal of U */
+    std::vector <double> diag;
+
+    /** Equation of the system used as each row of the factors */
+    std::vector <unsigned> perm;
+};
+
 } // namespace gem5
 
 #endif
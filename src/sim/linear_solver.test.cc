@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "sim/linear_solver.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+// Unit resistors chained from a node at 10 to ground, through x1, x0 and
+// x2, with the given current injected in x0:
+//   (x0 - x1) + (x0 - x2) = current
+//   (x1 - 10) + (x1 - x0) = 0
+//   (x2 - x0) + x2 = 0
+LinearSystem
+resistorChain(double current)
+{
+    LinearSystem ls(3);
+    ls[0][0] = 2.0;
+    ls[0][1] = -1.0;
+    ls[0][2] = -1.0;
+    ls[0][3] = -current;
+    ls[1][0] = -1.0;
+    ls[1][1] = 2.0;
+    ls[1][3] = -10.0;
+    ls[2][0] = -1.0;
+    ls[2][2] = 2.0;
+    return ls;
+}
+
+void
+expectSolves(const LinearSystem &ls, const std::vector<double> &x)
+{
+    ASSERT_EQ(x.size(), ls.size());
+    for (unsigned i = 0; i < ls.size(); i++) {
+        double sum = ls[i][ls[i].cnt()];
+        for (unsigned j = 0; j < ls.size(); j++)
+            sum += ls[i][j] * x[j];
+        EXPECT_NEAR(sum, 0.0, 1e-9) << "equation " << i;
+    }
+}
+
+} // anonymous namespace
+
+TEST(LinearSolverTest, Solve)
+{
+    LinearSystem ls = resistorChain(0.0);
+    std::vector<double> x = ls.solve();
+    EXPECT_NEAR(x[0], 5.0, 1e-9);
+    EXPECT_NEAR(x[1], 7.5, 1e-9);
+    EXPECT_NEAR(x[2], 2.5, 1e-9);
+}
+
+TEST(LinearSolverTest, NeedsPivoting)
+{
+    // The first equation has no x0, the factorization must pick another
+    LinearSystem ls(3);
+    ls[0][1] = 1.0;
+    ls[0][2] = 1.0;
+    ls[0][3] = -5.0;
+    ls[1][0] = 1.0;
+    ls[1][2] = -1.0;
+    ls[2][0] = 2.0;
+    ls[2][1] = 1.0;
+    ls[2][3] = -4.0;
+    expectSolves(ls, ls.solve());
+}
+
+TEST(LinearSolverTest, ReuseFactors)
+{
+    LinearSystem ls = resistorChain(0.0);
+    LUDecomposition factors(ls);
+    EXPECT_EQ(factors.order(), 3);
+    EXPECT_TRUE(factors.sameCoefficients(ls));
+
+    // New constant terms are solved with the same factors
+    for (double current : {1.0, -3.0, 100.0}) {
+        LinearSystem step = resistorChain(current);
+        EXPECT_TRUE(factors.sameCoefficients(step));
+        expectSolves(step, factors.solve(step.rhs()));
+    }
+
+    // Different coefficients are noticed, including new non-zero ones
+    LinearSystem other = resistorChain(0.0);
+    other[1][2] = 0.5;
+    EXPECT_FALSE(factors.sameCoefficients(other));
+    other = resistorChain(0.0);
+    other[0][0] = 3.0;
+    EXPECT_FALSE(factors.sameCoefficients(other));
+    EXPECT_FALSE(factors.sameCoefficients(LinearSystem(2)));
+    EXPECT_FALSE(LUDecomposition().sameCoefficients(ls));
+}
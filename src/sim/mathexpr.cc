@@ -166,6 +166,89 @@ MathExpr::eval(const Node *n, EvalCallback fn) const {
     return 0;
 }
 
+MathExpr::Program
+MathExpr::compile(IndexCallback index) const
+{
+    Program prog;
+    prog.stack.resize(compile(root, index, prog));
+    return prog;
+}
+
+unsigned
+MathExpr::compile(const Node *n, IndexCallback &index, Program &prog) const
+{
+    Program::Instr instr;
+    instr.op = n->op;
+    if (n->op == sValue) {
+        instr.value = n->value;
+        prog.code.push_back(instr);
+        return 1;
+    } else if (n->op == sVariable) {
+        instr.var = index(n->variable);
+        prog.code.push_back(instr);
+        return 1;
+    }
+
+    panic_if(n->op == nInvalid || !n->r, "Invalid node!\n");
+    if (!n->l) {
+        // Only negations have a single operand
+        assert(n->op == uNeg);
+        unsigned depth = compile(n->r, index, prog);
+        prog.code.push_back(instr);
+        return depth;
+    }
+
+    // The left operand is kept on the stack while evaluating the right
+    unsigned l_depth = compile(n->l, index, prog);
+    unsigned r_depth = compile(n->r, index, prog);
+    prog.code.push_back(instr);
+    return std::max(l_depth, r_depth + 1);
+}
+
+double
+MathExpr::Program::eval(const double *vars) const
+{
+    double *top = stack.data() - 1;
+    for (auto &instr : code) {
+        switch (instr.op) {
+          case sValue:
+            *++top = instr.value;
+            break;
+          case sVariable:
+            *++top = vars[instr.var];
+            break;
+          case uNeg:
+            *top = -*top;
+            break;
+          case bAdd:
+            top--;
+            top[0] = top[0] + top[1];
+            break;
+          case bSub:
+            top--;
+            top[0] = top[0] - top[1];
+            break;
+          case bMul:
+            top--;
+            top[0] = top[0] * top[1];
+            break;
+          case bDiv:
+            top--;
+            top[0] = top[0] / top[1];
+            break;
+          case bPow:
+            top--;
+            top[0] = std::pow(top[0], top[1]);
+            break;
+          default:
+            panic("Invalid operation!\n");
+        }
+    }
+
+    assert(top == stack.data());
+    return *top;
+}
+
 std::string
 MathExpr::toStr(Node *n, std::string prefix) const {
     std::string ret;
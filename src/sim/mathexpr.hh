@@ -93,6 +93,63 @@ class MathExpr
         bAdd, bSub, bMul, bDiv, bPow, uNeg, sValue, sVariable, nInvalid
     };
 
+  public:
+    /**
+     * An expression compiled to a flat list of operations in postfix
+     * order, whose variables were resolved to indices beforehand. It
+     * evaluates with a single loop over the operations, without
+     * recursion, callbacks or variable lookups.
+     */
+    class Program
+    {
+      public:
+        /**
+         * Evaluates the expression
+         *
+         * @param vars The value of each variable, at the index the
+         *        expression was compiled with
+         *
+         * @return The value for this expression
+         */
+        double eval(const double *vars) const;
+
+        /** Whether nothing was compiled in this program */
+        bool empty() const { return code.empty(); }
+
+      private:
+        friend class MathExpr;
+
+        struct Instr
+        {
+            Operator op;
+            /** Constant for sValue, variable index for sVariable */
+            union
+            {
+                double value;
+                unsigned var;
+            };
+        };
+
+        std::vector<Instr> code;
+
+        /** Evaluation stack, as deep as the expression needs */
+        mutable std::vector<double> stack;
+    };
+
+    typedef std::function<unsigned(const std::string &)> IndexCallback;
+
+    /**
+     * Compiles the expression
+     *
+     * @param index A callback function giving the index of each variable
+     *        in the values passed to Program::eval()
+     *
+     * @return The compiled expression
+     */
+    Program compile(IndexCallback index) const;
+
+  private:
+
     // Match operators
     const int MAX_PRIO = 4;
     typedef double (*binOp)(double, double);
@@ -147,6 +204,11 @@ class MathExpr
     /** Return all variable reachable from a node to a vector of
      * strings */
     void getVariables(const Node *n, std::vector<std::string> &vars) const;
+
+    /** Append the operations of a node to a program, returning the
+     * stack depth they need */
+    unsigned compile(const Node *n, IndexCallback &index,
+                     Program &prog) const;
 };
 
 } // namespace gem5
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+#include "sim/mathexpr.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const std::map<std::string, double> values = {
+    {"a", 3.0}, {"b.c", -2.5}, {"d_e", 0.5},
+};
+
+double
+interpret(const std::string &str)
+{
+    return MathExpr(str).eval(
+        [](std::string name) { return values.at(name); });
+}
+
+double
+compileAndRun(const std::string &str)
+{
+    std::vector<std::string> names;
+    MathExpr::Program prog = MathExpr(str).compile(
+        [&](const std::string &name) {
+            names.push_back(name);
+            return names.size() - 1;
+        });
+    EXPECT_FALSE(prog.empty());
+
+    std::vector<double> vars;
+    for (auto &name : names)
+        vars.push_back(values.at(name));
+    return prog.eval(vars.data());
+}
+
+} // anonymous namespace
+
+TEST(MathExprTest, CompiledMatchesInterpreted)
+{
+    for (const char *str : {
+            "1", "a", "-a", "a + b.c * d_e", "(a + b.c) * d_e",
+            "a - b.c - d_e", "a / b.c / d_e", "2 ^ a ^ d_e",
+            "-(a * -b.c) + 4 * (d_e - (a / 2))", "a * a * a - a"}) {
+        EXPECT_DOUBLE_EQ(compileAndRun(str), interpret(str)) << str;
+    }
+}
+
+TEST(MathExprTest, CompiledValues)
+{
+    EXPECT_DOUBLE_EQ(compileAndRun("a + b.c * d_e"), 1.75);
+    EXPECT_DOUBLE_EQ(compileAndRun("(a + 1) * -(d_e - 2)"), 6.0);
+    EXPECT_DOUBLE_EQ(compileAndRun("a ^ 2 / 4.5"), 2.0);
+}
+
+TEST(MathExprTest, EmptyProgram)
+{
+    EXPECT_TRUE(MathExpr::Program().empty());
+}
@@ -29,6 +29,8 @@
 #include "sim/mem_state.hh"
 
 #include <cassert>
+#include <iterator>
+#include <vector>
 
 #include "arch/generic/mmu.hh"
 #include "debug/Vma.hh"
@@ -67,7 +69,7 @@ MemState::operator=(const MemState &in)
     _stackMin = in._stackMin;
     _nextThreadStackBase = in._nextThreadStackBase;
     _mmapEnd = in._mmapEnd;
-    _vmaList = in._vmaList; /* This assignment does a deep copy. */
+    _vmas = in._vmas; /* This assignment does a deep copy. */
 
     return *this;
 }
@@ -78,27 +80,34 @@ MemState::resetOwner(Process *owner)
     _ownerProcess = owner;
 }
 
+MemState::VMAMap::iterator
+MemState::firstVmaAfter(Addr addr)
+{
+    auto vma = _vmas.upper_bound(addr);
+    if (vma != _vmas.begin() && std::prev(vma)->second.end() > addr)
+        return std::prev(vma);
+    return vma;
+}
+
 bool
 MemState::isUnmapped(Addr start_addr, Addr length)
 {
     Addr end_addr = start_addr + length;
-    const AddrRange range(start_addr, end_addr);
-    for (const auto &vma : _vmaList) {
-        if (vma.intersects(range))
-            return false;
-    }
+    auto vma = firstVmaAfter(start_addr);
+    if (vma != _vmas.end() && vma->second.start() < end_addr)
+        return false;
 
     /**
      * In case someone skips the VMA interface and just directly maps memory
      * also consult the page tables to make sure that this memory isnt mapped.
      */
-    for (auto start = start_addr; start < end_addr;
-         start += _pageBytes) {
-        if (_ownerProcess->pTable->lookup(start) != nullptr) {
-            panic("Someone allocated physical memory at VA %p without "
-                  "creating a VMA!\n", start);
-            return false;
-        }
+    const Addr first_page = roundDown(start_addr, _pageBytes);
+    if (length &&
+            !_ownerProcess->pTable->isUnmapped(first_page,
+                                               end_addr - first_page)) {
+        panic("Someone allocated physical memory in VA range %p-%p "
+              "without creating a VMA!\n", start_addr, end_addr);
+        return false;
     }
     return true;
 }
@@ -184,8 +193,8 @@ MemState::mapRegion(Addr start_addr, Addr length,
     /**
      * Record the region in our list structure.
      */
-    _vmaList.emplace_back(AddrRange(start_addr, start_addr + length),
-                          _pageBytes, region_name, sim_fd, offset);
+    _vmas.try_emplace(start_addr, AddrRange(start_addr, start_addr + length),
+                      _pageBytes, region_name, sim_fd, offset);
 }
 
 void
@@ -194,64 +203,69 @@ MemState::unmapRegion(Addr start_addr, Addr length)
     Addr end_addr = start_addr + length;
     const AddrRange range(start_addr, end_addr);
 
-    auto vma = std::begin(_vmaList);
-    while (vma != std::end(_vmaList)) {
-        if (vma->isStrictSuperset(range)) {
+    auto vma = firstVmaAfter(start_addr);
+    while (vma != _vmas.end() && vma->second.start() < end_addr) {
+        VMA &area = vma->second;
+        if (area.isStrictSuperset(range)) {
             DPRINTF(Vma, "memstate: split vma [0x%x - 0x%x] into "
                     "[0x%x - 0x%x] and [0x%x - 0x%x]\n",
-                    vma->start(), vma->end(),
-                    vma->start(), start_addr,
-                    end_addr, vma->end());
+                    area.start(), area.end(),
+                    area.start(), start_addr,
+                    end_addr, area.end());
             /**
              * Need to split into two smaller regions.
              * Create a clone of the old VMA and slice it to the right.
              */
-            _vmaList.push_back(*vma);
-            _vmaList.back().sliceRegionRight(start_addr);
+            VMA left = area;
+            left.sliceRegionRight(start_addr);
 
             /**
              * Slice old VMA to encapsulate the left region.
              */
-            vma->sliceRegionLeft(end_addr);
+            auto node = _vmas.extract(vma);
+            node.mapped().sliceRegionLeft(end_addr);
+            node.key() = node.mapped().start();
+            _vmas.insert(std::move(node));
+            _vmas.emplace(left.start(), std::move(left));
 
             /**
              * Region cannot be in any more VMA, because it is completely
              * contained in this one!
              */
             break;
-        } else if (vma->isSubset(range)) {
+        } else if (area.isSubset(range)) {
             DPRINTF(Vma, "memstate: destroying vma [0x%x - 0x%x]\n",
-                    vma->start(), vma->end());
+                    area.start(), area.end());
             /**
              * Need to nuke the existing VMA.
              */
-            vma = _vmaList.erase(vma);
+            vma = _vmas.erase(vma);
 
             continue;
 
-        } else if (vma->intersects(range)) {
+        } else if (area.start() < start_addr) {
+            DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
+                    "into [0x%x - 0x%x]\n",
+                    area.start(), area.end(),
+                    area.start(), start_addr);
             /**
-             * Trim up the existing VMA.
+             * Overlaps from the right.
              */
-            if (vma->start() < start_addr) {
-                DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
-                        "into [0x%x - 0x%x]\n",
-                        vma->start(), vma->end(),
-                        vma->start(), start_addr);
-                /**
-                 * Overlaps from the right.
-                 */
-                vma->sliceRegionRight(start_addr);
-            } else {
-                DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
-                        "into [0x%x - 0x%x]\n",
-                        vma->start(), vma->end(),
-                        end_addr, vma->end());
-                /**
-                 * Overlaps from the left.
-                 */
-                vma->sliceRegionLeft(end_addr);
-            }
+            area.sliceRegionRight(start_addr);
+        } else {
+            DPRINTF(Vma, "memstate: resizing vma [0x%x - 0x%x] "
+                    "into [0x%x - 0x%x]\n",
+                    area.start(), area.end(),
+                    end_addr, area.end());
+            /**
+             * Overlaps from the left. This VMA now starts at end_addr,
+             * so it is the last one to consider.
+             */
+            auto node = _vmas.extract(vma);
+            node.mapped().sliceRegionLeft(end_addr);
+            node.key() = node.mapped().start();
+            _vmas.insert(std::move(node));
+            break;
         }
 
         vma++;
@@ -289,73 +303,45 @@ void
 MemState::remapRegion(Addr start_addr, Addr new_start_addr, Addr length)
 {
     Addr end_addr = start_addr + length;
-    const AddrRange range(start_addr, end_addr);
-
-    auto vma = std::begin(_vmaList);
-    while (vma != std::end(_vmaList)) {
-        if (vma->isStrictSuperset(range)) {
-            /**
-             * Create clone of the old VMA and slice right.
-             */
-            _vmaList.push_back(*vma);
-            _vmaList.back().sliceRegionRight(start_addr);
-
-            /**
-             * Create clone of the old VMA and slice it left.
-             */
-            _vmaList.push_back(*vma);
-            _vmaList.back().sliceRegionLeft(end_addr);
 
-            /**
-             * Slice the old VMA left and right to adjust the file backing,
-             * then overwrite the virtual addresses!
-             */
-            vma->sliceRegionLeft(start_addr);
-            vma->sliceRegionRight(end_addr);
-            vma->remap(new_start_addr);
+    /**
+     * Take all VMAs which overlap the region out of the map, since the
+     * parts which move may land on other VMAs we are still to visit.
+     */
+    std::vector<VMA> areas;
+    auto vma = firstVmaAfter(start_addr);
+    while (vma != _vmas.end() && vma->second.start() < end_addr) {
+        VMA area = std::move(vma->second);
+        vma = _vmas.erase(vma);
 
+        if (area.start() < start_addr) {
             /**
-             * The region cannot be in any more VMAs, because it is
-             * completely contained in this one!
+             * Overlaps from the right, keep the left part in place.
              */
-            break;
-        } else if (vma->isSubset(range)) {
-            /**
-             * Just go ahead and remap it!
-             */
-            vma->remap(vma->start() - start_addr + new_start_addr);
-        } else if (vma->intersects(range)) {
+            areas.push_back(area);
+            areas.back().sliceRegionRight(start_addr);
+            area.sliceRegionLeft(start_addr);
+        }
+        if (area.end() > end_addr) {
             /**
-             * Create a clone of the old VMA.
+             * Overlaps from the left, keep the right part in place.
              */
-            _vmaList.push_back(*vma);
-
-            if (vma->start() < start_addr) {
-                /**
-                 * Overlaps from the right.
-                 */
-                _vmaList.back().sliceRegionRight(start_addr);
-
-                /**
-                 * Remap the old region.
-                 */
-                vma->sliceRegionLeft(start_addr);
-                vma->remap(new_start_addr);
-            } else {
-                /**
-                 * Overlaps from the left.
-                 */
-                _vmaList.back().sliceRegionLeft(end_addr);
-
-                /**
-                 * Remap the old region.
-                 */
-                vma->sliceRegionRight(end_addr);
-                vma->remap(new_start_addr + vma->start() - start_addr);
-            }
+            areas.push_back(area);
+            areas.back().sliceRegionLeft(end_addr);
+            area.sliceRegionRight(end_addr);
         }
 
-        vma++;
+        /**
+         * Remap what is left, which is within the region.
+         */
+        area.remap(area.start() - start_addr + new_start_addr);
+        areas.push_back(std::move(area));
+    }
+
+    for (auto &area : areas) {
+        [[maybe_unused]] bool inserted =
+            _vmas.emplace(area.start(), std::move(area)).second;
+        assert(inserted);
     }
 
     /**
@@ -395,31 +381,31 @@ MemState::fixupFault(Addr vaddr)
      * Check if we are accessing a mapped virtual address. If so then we
      * just haven't allocated it a physical page yet and can do so here.
      */
-    for (const auto &vma : _vmaList) {
-        if (vma.contains(vaddr)) {
-            Addr vpage_start = roundDown(vaddr, _pageBytes);
-            _ownerProcess->allocateMem(vpage_start, _pageBytes);
+    auto vma_it = firstVmaAfter(vaddr);
+    if (vma_it != _vmas.end() && vma_it->second.contains(vaddr)) {
+        const VMA &vma = vma_it->second;
+        Addr vpage_start = roundDown(vaddr, _pageBytes);
+        _ownerProcess->allocateMem(vpage_start, _pageBytes);
 
+        /**
+         * We are assuming that fresh pages are zero-filled, so there is
+         * no need to zero them out when there is no backing file.
+         * This assumption will not hold true if/when physical pages
+         * are recycled.
+         */
+        if (vma.hasHostBuf()) {
             /**
-             * We are assuming that fresh pages are zero-filled, so there is
-             * no need to zero them out when there is no backing file.
-             * This assumption will not hold true if/when physical pages
-             * are recycled.
+             * Write the memory for the host buffer contents for all
+             * ThreadContexts associated with this process.
              */
-            if (vma.hasHostBuf()) {
-                /**
-                 * Write the memory for the host buffer contents for all
-                 * ThreadContexts associated with this process.
-                 */
-                for (auto &cid : _ownerProcess->contextIds) {
-                    auto *tc = _ownerProcess->system->threads[cid];
-                    SETranslatingPortProxy
-                        virt_mem(tc, SETranslatingPortProxy::Always);
-                    vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
-                }
+            for (auto &cid : _ownerProcess->contextIds) {
+                auto *tc = _ownerProcess->system->threads[cid];
+                SETranslatingPortProxy
+                    virt_mem(tc, SETranslatingPortProxy::Always);
+                vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
             }
-            return true;
         }
+        return true;
     }
 
     /**
@@ -486,7 +472,7 @@ MemState::printVmaList()
 {
     std::stringstream file_content;
 
-    for (auto vma : _vmaList) {
+    for (auto &[start, vma] : _vmas) {
         std::stringstream line;
         line << std::hex << vma.start() << "-";
         line << std::hex << vma.end() << " ";
@@ -32,7 +32,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 
-#include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -197,9 +197,9 @@ class MemState : public Serializable
         paramOut(cp, "mmapEnd", _mmapEnd);
 
         ScopedCheckpointSection sec(cp, "vmalist");
-        paramOut(cp, "size", _vmaList.size());
+        paramOut(cp, "size", _vmas.size());
         int count = 0;
-        for (auto vma : _vmaList) {
+        for (auto &[vma_start, vma] : _vmas) {
             ScopedCheckpointSection sec(cp, csprintf("Vma%d", count++));
             paramOut(cp, "name", vma.getName());
             if (vma.hasHostBuf()) {
@@ -240,8 +240,8 @@ class MemState : public Serializable
             }
             paramIn(cp, "addrRangeStart", start);
             paramIn(cp, "addrRangeEnd", end);
-            _vmaList.emplace_back(AddrRange(start, end), _pageBytes, name,
-                                  host_fd, offset);
+            _vmas.try_emplace(start, AddrRange(start, end), _pageBytes, name,
+                              host_fd, offset);
             close(host_fd);
         }
     }
@@ -252,6 +252,14 @@ class MemState : public Serializable
     std::string printVmaList();
 
   private:
+    typedef std::map<Addr, VMA> VMAMap;
+
+    /**
+     * Find the first VMA which ends after addr, which is the VMA that
+     * contains addr if there is one.
+     */
+    VMAMap::iterator firstVmaAfter(Addr addr);
+
     /**
      * @param
      */
@@ -278,18 +286,17 @@ class MemState : public Serializable
     Addr _mmapEnd;
 
     /**
-     * The _vmaList member is a list of virtual memory areas in the target
+     * The _vmas member holds the virtual memory areas in the target
      * application space that have been allocated by the target. In most
      * operating systems, lazy allocation is used and these structures (or
      * equivalent ones) are used to track the valid address ranges.
      *
-     * This could use a more efficient data structure like an interval
-     * tree, but it is unclear whether the vmas will be modified often enough
-     * for the improvement in lookup time to matter. Unmapping VMAs currently
-     * modifies the list while iterating so the STL container must either
-     * support this or the unmapping method must be changed.
+     * The areas never overlap, so keeping them ordered by their start
+     * addresses makes finding the ones around an address logarithmic
+     * in the number of areas, which matters for processes with many
+     * mappings.
      */
-    std::list<VMA> _vmaList;
+    VMAMap _vmas;
 };
 
 } // namespace gem5
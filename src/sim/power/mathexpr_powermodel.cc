@@ -71,15 +71,86 @@ MathExprPowerModel::startup()
             statsMap[var] = info;
         }
     }
+
+    // Compile the expressions now that all their stats are known, so
+    // that sampling power needs no lookup by name
+    for (auto [expr, compiled] : {std::make_pair(&dyn_expr, &dyn_compiled),
+                                  std::make_pair(&st_expr, &st_compiled)}) {
+        std::unordered_map<std::string, unsigned> indices;
+        compiled->program = expr->compile(
+            [&](const std::string &name) {
+                auto it = indices.find(name);
+                if (it != indices.end())
+                    return it->second;
+                compiled->vars.push_back(resolveVariable(name, *expr));
+                return indices[name] = compiled->vars.size() - 1;
+            });
+        compiled->values.resize(compiled->vars.size());
+    }
+}
+
+MathExprPowerModel::Variable
+MathExprPowerModel::resolveVariable(const std::string &name,
+                                    const MathExpr &expr) const
+{
+    using namespace statistics;
+
+    Variable var;
+    if (name == "temp") {
+        var.kind = Variable::Temp;
+    } else if (name == "voltage") {
+        var.kind = Variable::Voltage;
+    } else if (name == "clock_period") {
+        var.kind = Variable::ClockPeriod;
+    } else {
+        const Info *info = statsMap.at(name);
+        // Only these stat types are supported right now
+        if ((var.scalar = dynamic_cast<const ScalarInfo *>(info))) {
+            var.kind = Variable::Scalar;
+        } else if ((var.formula = dynamic_cast<const FormulaInfo *>(info))) {
+            var.kind = Variable::Formula;
+        } else {
+            fatal("Unsupported type for stat %s in expression:\n%s\n",
+                  name, expr.toStr());
+        }
+    }
+    return var;
 }
 
 double
-MathExprPowerModel::eval(const MathExpr &expr) const
+MathExprPowerModel::getValue(const Variable &var) const
 {
-    return expr.eval(
-        std::bind(&MathExprPowerModel::getStatValue,
-                  this, std::placeholders::_1)
-        );
+    switch (var.kind) {
+      case Variable::Temp:
+        return _temp.toCelsius();
+      case Variable::Voltage:
+        return clocked_object->voltage();
+      case Variable::ClockPeriod:
+        return clocked_object->clockPeriod();
+      case Variable::Scalar:
+        return var.scalar->value();
+      case Variable::Formula:
+        return var.formula->total();
+      default:
+        panic("Unknown variable kind!\n");
+    }
+}
+
+double
+MathExprPowerModel::eval(const MathExpr &expr,
+                         const CompiledExpr &compiled) const
+{
+    if (compiled.program.empty()) {
+        // Not started up yet
+        return expr.eval(
+            std::bind(&MathExprPowerModel::getStatValue,
+                      this, std::placeholders::_1)
+            );
+    }
+
+    for (unsigned i = 0; i < compiled.vars.size(); i++)
+        compiled.values[i] = getValue(compiled.vars[i]);
+    return compiled.program.eval(compiled.values.data());
 }
 
 double
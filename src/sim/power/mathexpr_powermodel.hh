@@ -39,6 +39,7 @@
 #define __SIM_MATHEXPR_POWERMODEL_PM_HH__
 
 #include <unordered_map>
+#include <vector>
 
 #include "params/MathExprPowerModel.hh"
 #include "sim/mathexpr.hh"
@@ -50,6 +51,8 @@ namespace gem5
 namespace statistics
 {
     class Info;
+    class ScalarInfo;
+    class FormulaInfo;
 }
 
 /**
@@ -68,14 +71,22 @@ class MathExprPowerModel : public PowerModelState
      *
      * @return Power (Watts) consumed by this object (dynamic component)
      */
-    double getDynamicPower() const override { return eval(dyn_expr); }
+    double
+    getDynamicPower() const override
+    {
+        return eval(dyn_expr, dyn_compiled);
+    }
 
     /**
      * Get the static power consumption.
      *
      * @return Power (Watts) consumed by this object (static component)
      */
-    double getStaticPower() const override { return eval(st_expr); }
+    double
+    getStaticPower() const override
+    {
+        return eval(st_expr, st_compiled);
+    }
 
     /**
      * Get the value for a variable (maps to a stat)
@@ -90,18 +101,57 @@ class MathExprPowerModel : public PowerModelState
     void regStats() override;
 
   private:
+    /**
+     * A variable of an expression, with the stat it maps to resolved
+     * and cast to its type.
+     */
+    struct Variable
+    {
+        enum Kind
+        {
+            Temp, Voltage, ClockPeriod, Scalar, Formula
+        };
+
+        Kind kind;
+        const statistics::ScalarInfo *scalar = nullptr;
+        const statistics::FormulaInfo *formula = nullptr;
+    };
+
+    /**
+     * An expression compiled at startup, with the variables it reads in
+     * the order of the indices it was compiled with.
+     */
+    struct CompiledExpr
+    {
+        MathExpr::Program program;
+        std::vector<Variable> vars;
+        /** Current value of each of vars */
+        mutable std::vector<double> values;
+    };
+
     /**
      * Evaluate an expression in the context of this object, fatal if
-     * evaluation fails.
+     * evaluation fails. The compiled version is used once available.
      *
      * @param expr Expression to evaluate
+     * @param compiled The compiled version of expr
      * @return Value of expression.
      */
-    double eval(const MathExpr &expr) const;
+    double eval(const MathExpr &expr, const CompiledExpr &compiled) const;
+
+    /** Get the current value of a resolved variable */
+    double getValue(const Variable &var) const;
+
+    /** Resolve a variable of expr, fatal if it maps to no known stat */
+    Variable resolveVariable(const std::string &name,
+                             const MathExpr &expr) const;
 
     // Math expressions for dynamic and static power
     MathExpr dyn_expr, st_expr;
 
+    // Compiled versions of the expressions
+    CompiledExpr dyn_compiled, st_compiled;
+
     // Map that contains relevant stats for this power model
     std::unordered_map<std::string, const statistics::Info*> statsMap;
 };
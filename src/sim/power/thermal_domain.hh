@@ -87,6 +87,12 @@ class ThermalDomain : public SimObject, public ThermalEntity
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
 
+    bool
+    isConnected(const ThermalNode *tn) const override
+    {
+        return tn == node;
+    }
+
     /**
       *  Emit a temperature update through probe points interface
       */
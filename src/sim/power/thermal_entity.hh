@@ -57,6 +57,9 @@ class ThermalEntity
     // Get the equation given a node and a step in seconds (assuming N nodes)
     virtual LinearEquation getEquation(ThermalNode *tn, unsigned n,
                                        double step) const = 0;
+
+    // Whether this entity contributes to the equation of a node
+    virtual bool isConnected(const ThermalNode *tn) const = 0;
 };
 
 } // namespace gem5
@@ -155,16 +155,15 @@ ThermalModel::doStep()
     LinearSystem ls(eq_nodes.size());
     for (unsigned i = 0; i < eq_nodes.size(); i++) {
         auto n = eq_nodes[i];
-        LinearEquation node_equation (eq_nodes.size());
-        for (auto e : entities) {
-            LinearEquation eq = e->getEquation(n, eq_nodes.size(), _step);
-            node_equation = node_equation + eq;
-        }
-        ls[i] = node_equation;
+        for (auto e : node_entities[i])
+            ls[i] += e->getEquation(n, eq_nodes.size(), _step);
     }
 
-    // Get temperatures for this iteration
-    std::vector <double> temps = ls.solve();
+    // Get temperatures for this iteration, only the constant terms
+    // change from one step to the next
+    if (!factors.sameCoefficients(ls))
+        factors = LUDecomposition(ls);
+    std::vector <double> temps = factors.solve(ls.rhs());
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->temp = Temperature::fromKelvin(temps[i]);
 
@@ -205,6 +204,15 @@ ThermalModel::startup()
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->id = i;
 
+    // Only a few entities are connected to each node
+    node_entities.resize(eq_nodes.size());
+    for (unsigned i = 0; i < eq_nodes.size(); i++) {
+        for (auto e : entities) {
+            if (e->isConnected(eq_nodes[i]))
+                node_entities[i].push_back(e);
+        }
+    }
+
     // Schedule first thermal update
     schedule(stepEvent, curTick() + sim_clock::as_int::s * _step);
 }
@@ -42,6 +42,7 @@
 
 #include "base/temperature.hh"
 #include "sim/clocked_object.hh"
+#include "sim/linear_solver.hh"
 #include "sim/power/thermal_domain.hh"
 #include "sim/power/thermal_entity.hh"
 #include "sim/power/thermal_node.hh"
@@ -74,6 +75,12 @@ class ThermalResistor : public SimObject, public ThermalEntity
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
 
+    bool
+    isConnected(const ThermalNode *tn) const override
+    {
+        return tn == node1 || tn == node2;
+    }
+
   private:
     /* Resistance value in K/W */
     const double _resistance;
@@ -95,6 +102,12 @@ class ThermalCapacitor : public SimObject, public ThermalEntity
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
 
+    bool
+    isConnected(const ThermalNode *tn) const override
+    {
+        return tn == node1 || tn == node2;
+    }
+
     void setNodes(ThermalNode * n1, ThermalNode * n2) {
         node1 = n1;
         node2 = n2;
@@ -126,6 +139,12 @@ class ThermalReference : public SimObject, public ThermalEntity
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
 
+    bool
+    isConnected(const ThermalNode *tn) const override
+    {
+        return tn == node;
+    }
+
     /* Fixed temperature value */
     const Temperature _temperature;
     /* Nodes connected to the resistor */
@@ -173,6 +192,16 @@ class ThermalModel : public ClockedObject
     std::vector <ThermalNode*> nodes;
     std::vector <ThermalNode*> eq_nodes;
 
+    /* Entities contributing to the equation of each of eq_nodes */
+    std::vector < std::vector <ThermalEntity *> > node_entities;
+
+    /**
+     * Factorization of the nodal equations. Their coefficients only
+     * depend on the resistances, the capacitances and the step, so it is
+     * reused by every step and computed again only if they change.
+     */
+    LUDecomposition factors;
+
     /** Stepping event to update the model values */
     EventFunctionWrapper stepEvent;
 
@@ -108,6 +108,28 @@ struct PacketInfo
 typedef ProbePointArg<PacketInfo> Packet;
 typedef std::unique_ptr<Packet> PacketUPtr;
 
+/**
+ * A completed memory access and its latency, for components that know
+ * when an access they handle started, e.g., a memory controller.
+ */
+struct AccessLatencyInfo
+{
+    Addr addr;
+    uint32_t size;
+    bool isRead;
+    RequestorID id;
+    /** PC of the access, or 0 if unknown */
+    Addr pc;
+    /** Ticks from the start of the access to its completion */
+    Tick latency;
+};
+
+/**
+ * Access latency probe point, conventionally named AccessLatency.
+ */
+typedef ProbePointArg<AccessLatencyInfo> AccessLatency;
+typedef std::unique_ptr<AccessLatency> AccessLatencyUPtr;
+
 } // namespace probing
 
 } // namespace gem5
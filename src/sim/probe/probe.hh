@@ -316,6 +316,24 @@ class ProbePointArg : public ProbePoint
             (*l)->notify(arg);
         }
     }
+
+    /**
+     * @brief called at the ProbePoint call site when building the
+     * argument has a cost. The argument is only built if there are
+     * listeners to pass it to, e.g.:
+     *
+     *   ppHit->notifyWith([&]() { return CacheAccessProbeArg(pkt, *this); });
+     *
+     * @param make callable returning the argument to pass to each
+     * listener.
+     */
+    template <typename MakeArg>
+    void
+    notifyWith(MakeArg &&make)
+    {
+        if (hasListeners())
+            notify(make());
+    }
 };
 
 
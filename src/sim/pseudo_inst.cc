@@ -321,7 +321,7 @@ resetstats(ThreadContext *tc, Tick delay, Tick period)
     Tick when = curTick() + delay * sim_clock::as_int::ns;
     Tick repeat = period * sim_clock::as_int::ns;
 
-    statistics::schedStatEvent(false, true, when, repeat);
+    tc->getSystemPtr()->statsOp(false, true, when, repeat);
 }
 
 void
@@ -335,7 +335,7 @@ dumpstats(ThreadContext *tc, Tick delay, Tick period)
     Tick when = curTick() + delay * sim_clock::as_int::ns;
     Tick repeat = period * sim_clock::as_int::ns;
 
-    statistics::schedStatEvent(true, false, when, repeat);
+    tc->getSystemPtr()->statsOp(true, false, when, repeat);
 }
 
 void
@@ -350,7 +350,7 @@ dumpresetstats(ThreadContext *tc, Tick delay, Tick period)
     Tick when = curTick() + delay * sim_clock::as_int::ns;
     Tick repeat = period * sim_clock::as_int::ns;
 
-    statistics::schedStatEvent(true, true, when, repeat);
+    tc->getSystemPtr()->statsOp(true, true, when, repeat);
 }
 
 void
@@ -501,7 +501,8 @@ workbegin(ThreadContext *tc, uint64_t workid, uint64_t threadid)
     const System::Params &params = sys->params();
 
     if (params.exit_on_work_items) {
-        exitSimLoop("workbegin", static_cast<int>(workid));
+        if (sys->recordWorkItemEvent(true, workid))
+            exitSimLoop("workbegin", static_cast<int>(workid));
         return;
     }
 
@@ -564,7 +565,8 @@ workend(ThreadContext *tc, uint64_t workid, uint64_t threadid)
     const System::Params &params = sys->params();
 
     if (params.exit_on_work_items) {
-        exitSimLoop("workend", static_cast<int>(workid));
+        if (sys->recordWorkItemEvent(false, workid))
+            exitSimLoop("workend", static_cast<int>(workid));
         return;
     }
 
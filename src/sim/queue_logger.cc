@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/queue_logger.hh"
+
+#include <algorithm>
+#include <atomic>
+
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace trace
+{
+
+namespace
+{
+
+std::atomic<uint64_t> nextSerial(1);
+
+} // anonymous namespace
+
+QueueLogger::QueueLogger(const std::string &_filename)
+    : filename(_filename), serial(nextSerial++)
+{
+}
+
+QueueLogger::~QueueLogger()
+{
+    for (auto *os : streams) {
+        if (os)
+            simout.close(os);
+    }
+}
+
+std::ostream &
+QueueLogger::queueStream()
+{
+    thread_local uint64_t owner = 0;
+    thread_local EventQueue *queue = nullptr;
+    thread_local std::ostream *stream = nullptr;
+
+    EventQueue *const current = curEventQueue();
+    if (owner == serial && queue == current)
+        return *stream;
+
+    // Messages logged outside of any main queue go to the first file
+    auto it = std::find(mainEventQueue.begin(), mainEventQueue.end(),
+                        current);
+    const size_t index = it == mainEventQueue.end() ?
+        0 : it - mainEventQueue.begin();
+
+    std::lock_guard<std::mutex> lock(streamLock);
+    if (streams.size() <= index)
+        streams.resize(index + 1, nullptr);
+    if (!streams[index])
+        streams[index] = simout.create(csprintf("%s.%d", filename, index));
+
+    owner = serial;
+    queue = current;
+    stream = streams[index]->stream();
+    return *stream;
+}
+
+void
+QueueLogger::logMessage(Tick when, const std::string &name,
+        const std::string &flag, const std::string &message)
+{
+    if (!isEnabled(name))
+        return;
+
+    formatMessage(queueStream(), when, name, flag, message);
+}
+
+void
+QueueLogger::flush()
+{
+    std::lock_guard<std::mutex> lock(streamLock);
+    for (auto *os : streams) {
+        if (os)
+            os->stream()->flush();
+    }
+}
+
+} // namespace trace
+} // namespace gem5
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_QUEUE_LOGGER_HH__
+#define __SIM_QUEUE_LOGGER_HH__
+
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "base/trace.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+namespace trace
+{
+
+/**
+ * Debug logger that writes the messages of each main event queue to a
+ * separate file, <filename>.<queue index>.
+ *
+ * When several event queues are simulated in parallel, sharing a
+ * single stream serializes the simulator threads and interleaves their
+ * messages. This logger instead formats every message into the file of
+ * the queue the calling thread is servicing, without any locking once
+ * the file is open. Messages are not flushed one by one.
+ *
+ * Every file is ordered by tick, so they can be merged afterwards,
+ * e.g., with sort -m -s -n <filename>.* if ticks are printed.
+ */
+class QueueLogger : public Logger
+{
+  public:
+    QueueLogger(const std::string &filename);
+    ~QueueLogger();
+
+    QueueLogger(const QueueLogger &other) = delete;
+    QueueLogger &operator=(const QueueLogger &other) = delete;
+
+    void logMessage(Tick when, const std::string &name,
+            const std::string &flag, const std::string &message) override;
+
+    /** @return The stream of the current event queue */
+    std::ostream &getOstream() override { return queueStream(); }
+
+    /**
+     * Flush the files of all queues. No other thread may log messages
+     * while this is in progress.
+     */
+    void flush();
+
+  private:
+    std::ostream &queueStream();
+
+    const std::string filename;
+
+    /** Identifies this logger in the thread local stream caches */
+    const uint64_t serial;
+
+    /** Protects streams */
+    std::mutex streamLock;
+    /** File of each queue, by index in mainEventQueue */
+    std::vector<OutputStream *> streams;
+};
+
+} // namespace trace
+} // namespace gem5
+
+#endif // __SIM_QUEUE_LOGGER_HH__
@@ -39,14 +39,17 @@
  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include "base/cprintf.hh"
 #include "base/hostinfo.hh"
 #include "base/logging.hh"
+#include "base/pool_alloc.hh"
 #include "base/trace.hh"
 #include "debug/TimeSync.hh"
 #include "sim/core.hh"
 #include "sim/cur_tick.hh"
 #include "sim/eventq.hh"
 #include "sim/full_system.hh"
+#include "sim/global_event.hh"
 #include "sim/root.hh"
 
 namespace gem5
@@ -75,6 +78,23 @@ Root::RootStats::RootStats()
              "The number of ticks simulated per host second (ticks/s)"),
     ADD_STAT(hostMemory, statistics::units::Byte::get(),
              "Number of bytes of host memory used"),
+    ADD_STAT(hostPoolAllocs, statistics::units::Count::get(),
+             "Number of small objects (e.g., events) allocated from the "
+             "host memory pools (never reset)"),
+    ADD_STAT(hostPoolMemory, statistics::units::Byte::get(),
+             "Number of bytes of host memory reserved by the small object "
+             "pools"),
+    ADD_STAT(simQuantum, statistics::units::Tick::get(),
+             "Adaptive simulation quantum chosen at the last "
+             "synchronization"),
+    ADD_STAT(simQuantumAvg, statistics::units::Tick::get(),
+             "Average adaptive simulation quantum (never reset)"),
+    ADD_STAT(simQuantumGrows, statistics::units::Count::get(),
+             "Number of times the adaptive simulation quantum grew "
+             "(never reset)"),
+    ADD_STAT(simQuantumShrinks, statistics::units::Count::get(),
+             "Number of times the adaptive simulation quantum was reset "
+             "(never reset)"),
 
     statTime(true),
     startTick(0)
@@ -88,6 +108,27 @@ Root::RootStats::RootStats()
         .prereq(hostMemory)
         ;
 
+    hostPoolAllocs.functor(PoolAllocator::allocations);
+    hostPoolMemory.functor(PoolAllocator::reservedBytes);
+
+    // Only simulations with an adaptive quantum have these.
+    const auto &quanta = adaptiveQuantumCounters;
+    simQuantum
+        .functor([&quanta]() { return quanta.current; })
+        .flags(statistics::nozero);
+    simQuantumAvg
+        .functor([&quanta]() {
+                return quanta.syncs ?
+                    (double)quanta.totalQuantum / quanta.syncs : 0.0;
+            })
+        .flags(statistics::nozero);
+    simQuantumGrows
+        .functor([&quanta]() { return quanta.grows; })
+        .flags(statistics::nozero);
+    simQuantumShrinks
+        .functor([&quanta]() { return quanta.shrinks; })
+        .flags(statistics::nozero);
+
     hostSeconds
         .functor([this]() {
                 Time now;
@@ -186,7 +227,33 @@ Root::Root(const RootParams &p, int)
     _root = this;
     lastTime.setTimer();
 
-    simQuantum = p.sim_quantum;
+    fatal_if(p.sim_quantum && p.sim_lookahead,
+             "sim_quantum and sim_lookahead are mutually exclusive.");
+
+    // Cross-queue events need the same slack in both modes, so the
+    // lookahead doubles as the quantum for anything that schedules
+    // global events relative to simQuantum.
+    simLookahead = p.sim_lookahead;
+    simQuantum = p.sim_lookahead ? p.sim_lookahead : p.sim_quantum;
+    numSimulatorThreads = p.sim_threads;
+    simThreadAffinity.assign(p.sim_thread_affinity.begin(),
+                             p.sim_thread_affinity.end());
+    fatal_if(p.sim_max_quantum && p.sim_lookahead,
+             "sim_max_quantum does not apply to sim_lookahead.");
+    simMaxQuantum = p.sim_max_quantum;
+    fatal_if(p.sim_quantum_grow_accesses > p.sim_quantum_shrink_accesses,
+             "sim_quantum_grow_accesses must not exceed "
+             "sim_quantum_shrink_accesses.");
+    simQuantumGrowAccesses = p.sim_quantum_grow_accesses;
+    simQuantumShrinkAccesses = p.sim_quantum_shrink_accesses;
+    simQuantumTargetHostNs = p.sim_quantum_target_host_ns;
+    Serializable::binaryCheckpoints = p.binary_checkpoints;
+
+    // Queues created from now on pick the setting up on creation.
+    calendarEventQueues = p.calendar_event_queues;
+    deterministicAsyncInsertions = p.deterministic_parallel;
+    for (auto *eventq : mainEventQueue)
+        eventq->useCalendar(calendarEventQueues);
 
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
@@ -195,6 +262,17 @@ Root::Root(const RootParams &p, int)
     mergeStatGroup(&Root::RootStats::instance);
 }
 
+void
+Root::init()
+{
+    SimObject::init();
+
+    for (uint32_t i = 0; i < numMainEventQueues; ++i) {
+        eventqStats.emplace_back(new EventQueueStats(
+            this, csprintf("eventq%d", i), *mainEventQueue[i]));
+    }
+}
+
 void
 Root::startup()
 {
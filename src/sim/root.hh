@@ -51,11 +51,15 @@
 #ifndef __SIM_ROOT_HH__
 #define __SIM_ROOT_HH__
 
+#include <memory>
+#include <vector>
+
 #include "base/statistics.hh"
 #include "base/time.hh"
 #include "base/types.hh"
 #include "params/Root.hh"
 #include "sim/eventq.hh"
+#include "sim/eventq_stats.hh"
 #include "sim/globals.hh"
 #include "sim/sim_object.hh"
 
@@ -80,6 +84,9 @@ class Root : public SimObject
     void timeSync();
     EventFunctionWrapper syncEvent;
 
+    /** Statistics of each main event queue, eventq<index> */
+    std::vector<std::unique_ptr<EventQueueStats>> eventqStats;
+
   public:
     /**
      * Use this function to get a pointer to the single Root object in the
@@ -109,6 +116,13 @@ class Root : public SimObject
 
         statistics::Formula hostTickRate;
         statistics::Value hostMemory;
+        statistics::Value hostPoolAllocs;
+        statistics::Value hostPoolMemory;
+
+        statistics::Value simQuantum;
+        statistics::Value simQuantumAvg;
+        statistics::Value simQuantumGrows;
+        statistics::Value simQuantumShrinks;
 
         static RootStats instance;
 
@@ -144,6 +158,11 @@ class Root : public SimObject
     // create() method.
     Root(const Params &p, int);
 
+    /** Create the statistics of the main event queues. All SimObjects,
+     * and so the queues they are assigned to, exist by then.
+     */
+    void init() override;
+
     /** Schedule the timesync event at startup().
      */
     void startup() override;
@@ -27,6 +27,7 @@
 
 #include "sim/se_workload.hh"
 
+#include "base/logging.hh"
 #include "cpu/thread_context.hh"
 #include "params/SEWorkload.hh"
 #include "sim/process.hh"
@@ -36,7 +37,7 @@ namespace gem5
 {
 
 SEWorkload::SEWorkload(const Params &p, Addr page_shift) :
-    Workload(p), memPools(page_shift)
+    Workload(p), memPools(page_shift), _threadScheduler(p.thread_quantum)
 {}
 
 void
@@ -51,11 +52,14 @@ SEWorkload::setSystem(System *sys)
         memories -= m5op_range;
 
     memPools.populate(memories);
+    _threadScheduler.setSystem(sys);
 }
 
 void
 SEWorkload::serialize(CheckpointOut &cp) const
 {
+    fatal_if(_threadScheduler.numThreads(), "Can't checkpoint while guest "
+             "threads are waiting for a thread context.");
     memPools.serialize(cp);
 }
 
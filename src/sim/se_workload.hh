@@ -29,6 +29,7 @@
 #define __SIM_SE_WORKLOAD_HH__
 
 #include "params/SEWorkload.hh"
+#include "sim/guest_thread_scheduler.hh"
 #include "sim/mem_pool.hh"
 #include "sim/workload.hh"
 
@@ -41,6 +42,9 @@ class SEWorkload : public Workload
     /** Memory allocation objects for all physical memories in the system. */
     MemPools memPools;
 
+    /** Scheduler of the guest threads which don't fit on the contexts. */
+    GuestThreadScheduler _threadScheduler;
+
   public:
     using Params = SEWorkloadParams;
 
@@ -92,6 +96,8 @@ class SEWorkload : public Workload
     Addr allocPhysPages(int npages, int pool_id=0);
     Addr memSize(int pool_id=0) const;
     Addr freeMemSize(int pool_id=0) const;
+
+    GuestThreadScheduler &threadScheduler() { return _threadScheduler; }
 };
 
 } // namespace gem5
@@ -48,6 +48,10 @@
 
 #include <cassert>
 #include <cerrno>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 #include "base/trace.hh"
 #include "debug/Checkpoint.hh"
@@ -59,6 +63,7 @@ int ckptMaxCount = 0;
 int ckptCount = 0;
 int ckptPrevCount = -1;
 std::stack<std::string> Serializable::path;
+bool Serializable::binaryCheckpoints = false;
 
 /////////////////////////////
 
@@ -100,6 +105,91 @@ Serializable::generateCheckpointOut(const std::string &cpt_dir,
     outstream << "## checkpoint generated: " << ctime(&t);
 }
 
+std::unique_ptr<CheckpointOut>
+Serializable::generateCheckpointOut(const std::string &cpt_dir)
+{
+    if (!binaryCheckpoints) {
+        auto os = std::make_unique<std::ofstream>();
+        generateCheckpointOut(cpt_dir, *os);
+        return os;
+    }
+
+    std::string dir = CheckpointIn::setDir(cpt_dir);
+    if (mkdir(dir.c_str(), 0775) == -1 && errno != EEXIST)
+            fatal("couldn't mkdir %s\n", dir);
+
+    return std::make_unique<binary_checkpoint::Out>(
+            dir + CheckpointIn::baseFilename);
+}
+
+struct CheckpointWriter::Pool
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> queue;
+    bool done = false;
+    std::vector<std::thread> threads;
+
+    void
+    work()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [this]() { return done || !queue.empty(); });
+            if (queue.empty())
+                return;
+
+            auto write = std::move(queue.front());
+            queue.pop_front();
+            lock.unlock();
+            write();
+            lock.lock();
+        }
+    }
+};
+
+CheckpointWriter *CheckpointWriter::current = nullptr;
+
+CheckpointWriter::CheckpointWriter(unsigned num_threads)
+    : pool(new Pool)
+{
+    panic_if(current, "Only one checkpoint can be written at a time.");
+
+    if (!num_threads)
+        num_threads = std::max(1U, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < num_threads; ++i)
+        pool->threads.emplace_back([this]() { pool->work(); });
+    current = this;
+}
+
+CheckpointWriter::~CheckpointWriter()
+{
+    current = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        pool->done = true;
+    }
+    pool->cv.notify_all();
+    for (auto &t : pool->threads)
+        t.join();
+}
+
+void
+Serializable::writeAsync(std::function<void()> write)
+{
+    CheckpointWriter *writer = CheckpointWriter::current;
+    if (!writer) {
+        write();
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(writer->pool->mutex);
+        writer->pool->queue.push_back(std::move(write));
+    }
+    writer->pool->cv.notify_one();
+}
+
 Serializable::ScopedCheckpointSection::~ScopedCheckpointSection()
 {
     assert(!path.empty());
@@ -163,7 +253,8 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
     : db(), _cptDir(setDir(cpt_dir))
 {
     std::string filename = getCptDir() + "/" + CheckpointIn::baseFilename;
-    if (!db.load(filename)) {
+    isBinary = binary_checkpoint::In::isBinary(filename);
+    if (isBinary ? !binaryDb.load(filename) : !db.load(filename)) {
         fatal("Can't load checkpoint file '%s'\n", filename);
     }
 }
@@ -178,8 +269,13 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
  * we are looking in.
  */
 bool
-CheckpointIn::entryExists(const std::string &section, const std::string &entry)
+CheckpointIn::entryExists(const std::string &_section,
+                          const std::string &entry)
 {
+    std::string buf;
+    const std::string &section = mapSection(_section, buf);
+    if (isBinary)
+        return binaryDb.find(section, entry) != nullptr;
     return db.entryExists(section, entry);
 }
 /**
@@ -193,23 +289,59 @@ CheckpointIn::entryExists(const std::string &section, const std::string &entry)
  * the value, given the section .
  */
 bool
-CheckpointIn::find(const std::string &section, const std::string &entry,
+CheckpointIn::find(const std::string &_section, const std::string &entry,
         std::string &value)
 {
+    std::string buf;
+    const std::string &section = mapSection(_section, buf);
+    if (isBinary) {
+        const binary_checkpoint::Entry *e = binaryDb.find(section, entry);
+        if (e)
+            value = e->text();
+        return e != nullptr;
+    }
     return db.find(section, entry, value);
 }
 
 bool
-CheckpointIn::sectionExists(const std::string &section)
+CheckpointIn::sectionExists(const std::string &_section)
 {
+    std::string buf;
+    const std::string &section = mapSection(_section, buf);
+    if (isBinary)
+        return binaryDb.sectionExists(section);
     return db.sectionExists(section);
 }
 
 void
-CheckpointIn::visitSection(const std::string &section,
+CheckpointIn::visitSection(const std::string &_section,
     IniFile::VisitSectionCallback cb)
 {
-    db.visitSection(section, cb);
+    std::string buf;
+    const std::string &section = mapSection(_section, buf);
+    if (isBinary)
+        binaryDb.visitSection(section, cb);
+    else
+        db.visitSection(section, cb);
+}
+
+void
+CheckpointIn::renameSection(const std::string &from, const std::string &to)
+{
+    renames.emplace_back(to, from);
+}
+
+const std::string &
+CheckpointIn::mapSection(const std::string &section, std::string &buf) const
+{
+    for (const auto &[to, from] : renames) {
+        if (section.compare(0, to.size(), to) == 0 &&
+            (section.size() == to.size() || section[to.size()] == '.')) {
+            buf = from + section.substr(to.size());
+            return buf;
+        }
+    }
+    return section;
 }
 
 } // namespace gem5
@@ -47,9 +47,12 @@
 
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <stack>
 #include <string>
 #include <type_traits>
@@ -58,6 +61,7 @@
 
 #include "base/inifile.hh"
 #include "base/logging.hh"
+#include "sim/binary_checkpoint.hh"
 #include "sim/serialize_handlers.hh"
 
 namespace gem5
@@ -70,8 +74,30 @@ class CheckpointIn
   private:
     IniFile db;
 
+    /** The contents of binary checkpoints, which are not loaded to db. */
+    binary_checkpoint::In binaryDb;
+    bool isBinary;
+
     const std::string _cptDir;
 
+    /** Whether only the architectural state is restored. */
+    bool _transplant = false;
+
+    /** Prefixes of section names in this configuration, and the
+     * prefixes they replace in the checkpoint. */
+    std::vector<std::pair<std::string, std::string>> renames;
+
+    /**
+     * Translate the name of a section in this configuration to its name
+     * in the checkpoint.
+     *
+     * @param section Name of the section in this configuration.
+     * @param buf Storage for a translated name.
+     * @return The name of the section in the checkpoint.
+     */
+    const std::string &mapSection(const std::string &section,
+                                  std::string &buf) const;
+
   public:
     CheckpointIn(const std::string &cpt_dir);
     ~CheckpointIn() = default;
@@ -93,6 +119,43 @@ class CheckpointIn
         IniFile::VisitSectionCallback cb);
     /** @}*/ //end of api_checkout group
 
+    /**
+     * Restore only the architectural state of the checkpoint (thread
+     * contexts, memories and devices), so that it can be restored into
+     * a configuration with a different microarchitecture. The objects
+     * that have no architectural state then start cold.
+     *
+     * @see SimObject::hasArchitecturalState()
+     */
+    void setTransplant(bool transplant) { _transplant = transplant; }
+    bool transplant() const { return _transplant; }
+
+    /**
+     * Restore the sections of the objects named from in the checkpoint,
+     * and of their children, into the objects named to. This lets a
+     * checkpoint be restored into a configuration that names objects
+     * differently.
+     *
+     * @param from Name of an object in the checkpoint.
+     * @param to Name of the object in this configuration.
+     */
+    void renameSection(const std::string &from, const std::string &to);
+
+    /**
+     * Look up an entry of a binary checkpoint, so that values stored in
+     * their binary representation can be read without parsing them.
+     *
+     * @return The entry, or nullptr if it does not exist or this is a
+     * text checkpoint.
+     */
+    const binary_checkpoint::Entry *
+    findEntry(const std::string &section, const std::string &entry) const
+    {
+        std::string buf;
+        return isBinary ? binaryDb.find(mapSection(section, buf), entry) :
+            nullptr;
+    }
+
     // The following static functions have to do with checkpoint
     // creation rather than restoration.  This class makes a handy
     // namespace for them though.  Currently no Checkpoint object is
@@ -311,10 +374,71 @@ class Serializable
     static void generateCheckpointOut(const std::string &cpt_dir,
         std::ofstream &outstream);
 
+    /**
+     * Generate a checkpoint stream in the format selected by
+     * binaryCheckpoints. Binary checkpoints are written to the file
+     * when the stream is destroyed.
+     *
+     * @param cpt_dir The dir at which the cpt file will be created.
+     * @ingroup api_serialize
+     */
+    static std::unique_ptr<CheckpointOut>
+    generateCheckpointOut(const std::string &cpt_dir);
+
+    /**
+     * Whether checkpoints are created in the binary format (see
+     * sim/binary_checkpoint.hh) rather than as INI text. Checkpoints in
+     * either format can be restored.
+     */
+    static bool binaryCheckpoints;
+
+    /**
+     * Write a file that is part of the checkpoint being created on a
+     * host thread, concurrently with other such files and with the
+     * serialization of the remaining objects. This is meant for large,
+     * self-contained files such as memory images. The function has to
+     * capture everything it needs by value, and may only read state
+     * that does not change until the checkpoint is complete. If there
+     * is no CheckpointWriter, the function is called right away.
+     *
+     * @param write Function that writes the file.
+     * @ingroup api_serialize
+     */
+    static void writeAsync(std::function<void()> write);
+
   private:
     static std::stack<std::string> path;
 };
 
+/**
+ * A pool of host threads that write the files passed to
+ * Serializable::writeAsync() while it exists. Destroying the writer
+ * waits for all of them to be written.
+ *
+ * @ingroup api_serialize
+ */
+class CheckpointWriter
+{
+  public:
+    /**
+     * @param num_threads Number of host threads to use, where zero
+     * selects one per host core.
+     */
+    CheckpointWriter(unsigned num_threads=0);
+    ~CheckpointWriter();
+
+    CheckpointWriter(const CheckpointWriter &) = delete;
+    CheckpointWriter &operator=(const CheckpointWriter &) = delete;
+
+  private:
+    friend class Serializable;
+
+    struct Pool;
+    std::unique_ptr<Pool> pool;
+
+    static CheckpointWriter *current;
+};
+
 /**
  * This function is used for writing parameters to a checkpoint.
  * @param os The checkpoint to be written to.
@@ -326,6 +450,13 @@ template <class T>
 void
 paramOut(CheckpointOut &os, const std::string &name, const T &param)
 {
+    if constexpr (binary_checkpoint::isRaw<T>) {
+        if (auto *bin = dynamic_cast<binary_checkpoint::Out *>(&os)) {
+            bin->add(Serializable::currentSection(), name, &param, 1);
+            return;
+        }
+    }
+
     os << name << "=";
     ShowParam<T>::show(os, param);
     os << "\n";
@@ -336,6 +467,15 @@ bool
 paramInImpl(CheckpointIn &cp, const std::string &name, T &param)
 {
     const std::string &section(Serializable::currentSection());
+    if constexpr (binary_checkpoint::isRaw<T>) {
+        const auto *entry = cp.findEntry(section, name);
+        if (entry && entry->type == binary_checkpoint::typeOf<T>() &&
+                entry->count == 1) {
+            std::memcpy(&param, entry->data.data(), sizeof(T));
+            return true;
+        }
+    }
+
     std::string str;
     return cp.find(section, name, str) && ParseParam<T>::parse(str, param);
 }
@@ -388,9 +528,21 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               InputIterator start, InputIterator end)
 {
-    os << name << "=";
     auto it = start;
     using Elem = std::remove_cv_t<std::remove_reference_t<decltype(*it)>>;
+    // std::vector<bool> does not store its elements as an array, so
+    // arrays of bools are kept as text.
+    if constexpr (binary_checkpoint::isRaw<Elem> &&
+                  !std::is_same_v<Elem, bool>) {
+        if (auto *bin = dynamic_cast<binary_checkpoint::Out *>(&os)) {
+            std::vector<Elem> values(start, end);
+            bin->add(Serializable::currentSection(), name, values.data(),
+                     values.size());
+            return;
+        }
+    }
+
+    os << name << "=";
     if (it != end)
         ShowParam<Elem>::show(os, *it++);
     while (it != end) {
@@ -442,6 +594,22 @@ arrayParamIn(CheckpointIn &cp, const std::string &name,
              InsertIterator inserter, ssize_t fixed_size=-1)
 {
     const std::string &section = Serializable::currentSection();
+    if constexpr (binary_checkpoint::isRaw<T>) {
+        const auto *entry = cp.findEntry(section, name);
+        if (entry && entry->type == binary_checkpoint::typeOf<T>()) {
+            fatal_if(fixed_size >= 0 && entry->count != (uint64_t)fixed_size,
+                "Array size mismatch on %s:%s (Got %u, expected %u)'\n",
+                section, name, entry->count, fixed_size);
+            for (uint64_t i = 0; i < entry->count; ++i) {
+                T value;
+                std::memcpy(&value, entry->data.data() + i * sizeof(T),
+                            sizeof(T));
+                *inserter = value;
+            }
+            return;
+        }
+    }
+
     std::string str;
     fatal_if(!cp.find(section, name, str),
         "Can't unserialize '%s:%s'.", section, name);
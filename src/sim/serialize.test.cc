@@ -33,14 +33,18 @@
 #include <unistd.h>
 
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <deque>
 #include <fstream>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -263,6 +267,29 @@ TEST_F(CheckpointInFixture, ExtractEntries)
     ASSERT_FALSE(cpt->find("Junk", "test4", value));
 }
 
+/** Test restoring sections into objects with different names. */
+TEST_F(CheckpointInFixture, RenameSections)
+{
+    cpt->renameSection("Junk", "system.junk");
+    cpt->renameSection("Fo", "bar");
+
+    std::string value;
+    ASSERT_TRUE(cpt->sectionExists("system.junk"));
+    ASSERT_TRUE(cpt->entryExists("system.junk", "Test3"));
+    ASSERT_TRUE(cpt->find("system.junk", "Test4", value));
+    ASSERT_EQ(value, "mama mia");
+
+    // The other sections keep their names
+    ASSERT_TRUE(cpt->sectionExists("Junk"));
+    ASSERT_TRUE(cpt->find("General", "Test2", value));
+    ASSERT_EQ(value, "bar");
+
+    // Only whole components of the names are renamed
+    ASSERT_FALSE(cpt->sectionExists("system.junkyard"));
+    ASSERT_FALSE(cpt->sectionExists("baro"));
+    ASSERT_FALSE(cpt->sectionExists("bar"));
+}
+
 /**
  * Test that paths are increased and decreased according to the scope that
  * its SCS was created in (using CheckpointIn).
@@ -1366,3 +1393,147 @@ TEST_F(SerializeFixture, SerializeMapping)
         ASSERT_THAT(reals, testing::ElementsAre(0.1, 1.345, 892.72, 1e+10));
     }
 }
+
+/** Files are written right away if there is no checkpoint writer. */
+/** Test that a binary checkpoint restores what was serialized. */
+TEST_F(SerializeFixture, BinaryCheckpoint)
+{
+    const std::vector<uint64_t> expected_uint64 = {12751928501, 13, 111111};
+    const std::list<bool> expected_boolean = {true, false};
+    const double expected_real = 1.0 / 3;
+
+    // Serialization
+    {
+        const int integer = -5;
+        const bool boolean = true;
+        const std::string str = "a string";
+        const double real = expected_real;
+        const std::vector<uint64_t> uint64 = expected_uint64;
+        const std::list<bool> booleans = expected_boolean;
+        const int integers[] = {10, 32, 100};
+        const char* const names[] = {"ten", "thirty-two", "one hundred"};
+
+        binary_checkpoint::Out cp(getCptPath());
+        Serializable::ScopedCheckpointSection scs(cp, "Section1");
+        SERIALIZE_SCALAR(integer);
+        SERIALIZE_SCALAR(boolean);
+        SERIALIZE_SCALAR(str);
+        SERIALIZE_SCALAR(real);
+        SERIALIZE_CONTAINER(uint64);
+        SERIALIZE_CONTAINER(booleans);
+        SERIALIZE_MAPPING(integers, names, 3);
+        Serializable::ScopedCheckpointSection scs_2(cp, "Empty");
+    }
+    ASSERT_TRUE(binary_checkpoint::In::isBinary(getCptPath()));
+
+    // Unserialization
+    {
+        CheckpointIn cp(getDirName());
+        ASSERT_TRUE(cp.sectionExists("Section1"));
+        ASSERT_TRUE(cp.sectionExists("Section1.integers"));
+        ASSERT_TRUE(cp.sectionExists("Section1.Empty"));
+        ASSERT_FALSE(cp.sectionExists("Section2"));
+        ASSERT_TRUE(cp.entryExists("Section1", "integer"));
+        ASSERT_FALSE(cp.entryExists("Section1", "integers"));
+
+        int integer;
+        bool boolean;
+        std::string str;
+        double real;
+        std::vector<uint64_t> uint64;
+        std::list<bool> booleans;
+        int integers[3];
+        const char* const names[] = {"ten", "thirty-two", "one hundred"};
+
+        Serializable::ScopedCheckpointSection scs(cp, "Section1");
+        UNSERIALIZE_SCALAR(integer);
+        ASSERT_EQ(integer, -5);
+        UNSERIALIZE_SCALAR(boolean);
+        ASSERT_TRUE(boolean);
+        UNSERIALIZE_SCALAR(str);
+        ASSERT_EQ(str, "a string");
+        UNSERIALIZE_SCALAR(real);
+        ASSERT_EQ(real, expected_real);
+        UNSERIALIZE_CONTAINER(uint64);
+        ASSERT_EQ(uint64, expected_uint64);
+        UNSERIALIZE_CONTAINER(booleans);
+        ASSERT_EQ(booleans, expected_boolean);
+        UNSERIALIZE_MAPPING(integers, names, 3);
+        ASSERT_THAT(integers, testing::ElementsAre(10, 32, 100));
+    }
+}
+
+/**
+ * Test that the values of a binary checkpoint can be read as text, which
+ * is also what happens if they are restored to a different type.
+ */
+TEST_F(SerializeFixture, BinaryCheckpointText)
+{
+    {
+        const int32_t integer = -5;
+        const uint8_t uint8[] = {17, 42, 255};
+
+        binary_checkpoint::Out cp(getCptPath());
+        Serializable::ScopedCheckpointSection scs(cp, "Section1");
+        SERIALIZE_SCALAR(integer);
+        SERIALIZE_ARRAY(uint8, 3);
+    }
+
+    CheckpointIn cp(getDirName());
+    std::string value;
+    ASSERT_TRUE(cp.find("Section1", "integer", value));
+    ASSERT_EQ(value, "-5");
+    ASSERT_TRUE(cp.find("Section1", "uint8", value));
+    ASSERT_EQ(value, "17 42 255");
+
+    std::map<std::string, std::string> entries;
+    cp.visitSection("Section1",
+        [&entries](const std::string &name, const std::string &value) {
+            entries[name] = value;
+        });
+    ASSERT_EQ(entries.size(), 2);
+    ASSERT_EQ(entries["integer"], "-5");
+
+    Serializable::ScopedCheckpointSection scs(cp, "Section1");
+    int64_t integer;
+    std::vector<unsigned> uint8;
+    UNSERIALIZE_SCALAR(integer);
+    ASSERT_EQ(integer, -5);
+    UNSERIALIZE_CONTAINER(uint8);
+    ASSERT_THAT(uint8, testing::ElementsAre(17, 42, 255));
+    ASSERT_ANY_THROW(arrayParamIn(cp, "uint8", uint8.data(), 2));
+}
+
+TEST(CheckpointWriterTest, WriteWithoutWriter)
+{
+    bool written = false;
+    Serializable::writeAsync([&]() { written = true; });
+    ASSERT_TRUE(written);
+}
+
+/** Destroying a checkpoint writer waits for all files to be written. */
+TEST(CheckpointWriterTest, WaitForWrites)
+{
+    std::atomic<int> written(0);
+    {
+        CheckpointWriter writer(3);
+        for (int i = 0; i < 100; i++) {
+            Serializable::writeAsync([&]() {
+                std::this_thread::sleep_for(std::chrono::microseconds(10));
+                written++;
+            });
+        }
+    }
+    ASSERT_EQ(written, 100);
+
+    // The writer is gone, so the next file is written synchronously.
+    Serializable::writeAsync([&]() { written++; });
+    ASSERT_EQ(written, 101);
+}
+
+/** Only one checkpoint can be written at a time. */
+TEST(CheckpointWriterDeathTest, NestedWriters)
+{
+    CheckpointWriter writer(1);
+    ASSERT_ANY_THROW(CheckpointWriter());
+}
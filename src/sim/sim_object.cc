@@ -35,6 +35,7 @@
 #include "base/match.hh"
 #include "base/trace.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/host_timeline.hh"
 #include "sim/probe/probe.hh"
 
 namespace gem5
@@ -77,7 +78,10 @@ SimObject::init()
 void
 SimObject::loadState(CheckpointIn &cp)
 {
-    if (cp.sectionExists(name())) {
+    if (cp.transplant() && !hasArchitecturalState()) {
+        DPRINTF(Checkpoint, "no architectural state to transplant\n");
+        initState();
+    } else if (cp.sectionExists(name())) {
         DPRINTF(Checkpoint, "unserializing\n");
         // This works despite name() returning a fully qualified name
         // since we are at the top level.
@@ -131,8 +135,14 @@ SimObject::getPort(const std::string &if_name, PortID idx)
 void
 SimObject::serializeAll(const std::string &cpt_dir)
 {
-    std::ofstream cp;
-    Serializable::generateCheckpointOut(cpt_dir, cp);
+    host_timeline::Span span("checkpoint");
+
+    std::unique_ptr<CheckpointOut> cp =
+        Serializable::generateCheckpointOut(cpt_dir);
+
+    // objects hand large files to the writer, which finishes writing
+    // them when it goes out of scope
+    CheckpointWriter writer;
 
     SimObjectList::reverse_iterator ri = simObjectList.rbegin();
     SimObjectList::reverse_iterator rend = simObjectList.rend();
@@ -141,7 +151,7 @@ SimObject::serializeAll(const std::string &cpt_dir)
         SimObject *obj = *ri;
         // This works despite name() returning a fully qualified name
         // since we are at the top level.
-        obj->serializeSection(cp, obj->name());
+        obj->serializeSection(*cp, obj->name());
    }
 }
 
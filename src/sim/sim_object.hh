@@ -208,6 +208,19 @@ class SimObject : public EventManager, public Serializable, public Drainable,
      */
     virtual void loadState(CheckpointIn &cp);
 
+    /**
+     * Whether the checkpointed state of this object is part of the
+     * architectural state of the simulated system. Objects that only
+     * checkpoint microarchitectural state, e.g., cache contents, can
+     * skip it when a checkpoint is transplanted into a different
+     * configuration, and they are initialized with initState() instead.
+     *
+     * @see CheckpointIn::setTransplant()
+     *
+     * @ingroup api_serialize
+     */
+    virtual bool hasArchitecturalState() const { return true; }
+
     /**
      * initState() is called on each SimObject when *not* restoring
      * from a checkpoint.  This provides a hook for state
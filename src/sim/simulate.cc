@@ -42,7 +42,12 @@
 
 #include "sim/simulate.hh"
 
+#include <pthread.h>
+
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <numeric>
 #include <thread>
 
 #include "base/logging.hh"
@@ -50,6 +55,8 @@
 #include "base/types.hh"
 #include "sim/async.hh"
 #include "sim/eventq.hh"
+#include "sim/global_event.hh"
+#include "sim/host_timeline.hh"
 #include "sim/init_signals.hh"
 #include "sim/sim_events.hh"
 #include "sim/sim_exit.hh"
@@ -58,11 +65,35 @@
 namespace gem5
 {
 
-//! forward declaration
+//! forward declarations
 Event *doSimLoop(EventQueue *);
+bool serviceAsyncEvents(EventQueue *);
 
 GlobalSimLoopExitEvent *simulate_limit_event = nullptr;
 
+/**
+ * Pin a host thread to the host CPU simThreadAffinity assigns to the
+ * given simulator thread index, if any.
+ */
+static void
+pinSimulatorThread(pthread_t thread, uint32_t index)
+{
+    if (simThreadAffinity.empty())
+        return;
+
+#if defined(__linux__)
+    const int cpu = simThreadAffinity[index % simThreadAffinity.size()];
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (pthread_setaffinity_np(thread, sizeof(set), &set) != 0)
+        warn("Failed to pin simulator thread %d to host CPU %d.\n",
+             index, cpu);
+#else
+    warn_once("Pinning simulator threads is only supported on Linux.\n");
+#endif
+}
+
 class SimulatorThreads
 {
   public:
@@ -70,12 +101,18 @@ class SimulatorThreads
     SimulatorThreads(const SimulatorThreads &) = delete;
     SimulatorThreads &operator=(SimulatorThreads &) = delete;
 
-    SimulatorThreads(uint32_t num_queues)
+    SimulatorThreads(uint32_t num_queues, uint32_t num_threads)
         : terminate(false),
           numQueues(num_queues),
-          barrier(num_queues)
+          numThreads(num_threads),
+          barrier(num_threads),
+          nextQueue(0),
+          queueOrder(num_queues),
+          queueCost(num_queues, 0)
     {
-        threads.reserve(num_queues);
+        assert(num_threads > 0 && num_threads <= num_queues);
+        threads.reserve(num_threads);
+        std::iota(queueOrder.begin(), queueOrder.end(), 0);
     }
 
     ~SimulatorThreads()
@@ -90,20 +127,30 @@ class SimulatorThreads
         terminateThreads();
     }
 
+    /**
+     * Whether the queues are shared between fewer threads than there
+     * are queues, in which case the simulation must be driven by
+     * runPartitioned() rather than one doSimLoop() per thread.
+     */
+    bool partitioned() const { return numThreads < numQueues; }
+
     void runUntilLocalExit()
     {
         assert(!terminate);
+        assert(!partitioned());
 
         // Start subordinate threads if needed.
         if (threads.empty()) {
             // the main thread (the one running Python) handles queue 0,
             // so we only need to allocate new threads for queues 1..N-1.
             // We'll call these the "subordinate" threads.
+            pinSimulatorThread(pthread_self(), 0);
             for (uint32_t i = 1; i < numQueues; i++) {
                 threads.emplace_back(
                     [this](EventQueue *eq) {
                         thread_main(eq);
                     }, mainEventQueue[i]);
+                pinSimulatorThread(threads.back().native_handle(), i);
             }
         }
 
@@ -111,7 +158,76 @@ class SimulatorThreads
         // threads should be waiting on the barrier when the function
         // is called. The arrival of the main thread here will satisfy
         // the barrier and start another iteration in the thread loop.
-        barrier.wait();
+        waitBarrier();
+    }
+
+    /**
+     * Simulate with the queues partitioned among the threads until a
+     * global exit event is reached.
+     *
+     * Every round, all threads (including the main thread) repeatedly
+     * claim a queue that has not run yet and service it until its next
+     * event is a global barrier event. The queues that were most
+     * expensive in the previous round are handed out first so that a
+     * busy queue does not end up being the last one to start. Once all
+     * queues are parked, the main thread services the barrier events
+     * one queue at a time and moves on to the next round.
+     *
+     * @return The local exit event of queue 0, or nullptr if the
+     * simulation loop was aborted.
+     */
+    Event *
+    runPartitioned()
+    {
+        assert(!terminate);
+        assert(partitioned());
+
+        if (threads.empty()) {
+            pinSimulatorThread(pthread_self(), 0);
+            for (uint32_t i = 1; i < numThreads; i++) {
+                threads.emplace_back([this]() { partitioned_main(); });
+                pinSimulatorThread(threads.back().native_handle(), i);
+            }
+        }
+
+        curEventQueue(mainEventQueue[0]);
+        if (!serviceAsyncEvents(mainEventQueue[0]))
+            return nullptr;
+        mergeAsyncInsertions();
+
+        BaseGlobalEvent::cooperativeBarriers = true;
+        Event *exit_event = nullptr;
+        bool aborted = false;
+        while (!exit_event && !aborted) {
+            // Release the subordinate threads for another round.
+            nextQueue = 0;
+            waitBarrier();
+            runQueues();
+            waitBarrier();
+
+            {
+                host_timeline::Span span("global events");
+                exit_event = serviceBarriers();
+            }
+            curEventQueue(mainEventQueue[0]);
+            aborted = !serviceAsyncEvents(mainEventQueue[0]);
+
+            // The last queue to arrive at the barrier processed the
+            // global event, which may have scheduled new global events
+            // after the other queues merged their asynchronous
+            // insertions. Servicing asynchronous requests may have done
+            // the same.
+            mergeAsyncInsertions();
+
+            std::stable_sort(queueOrder.begin(), queueOrder.end(),
+                             [this](uint32_t a, uint32_t b) {
+                                 return queueCost[a] > queueCost[b];
+                             });
+        }
+        BaseGlobalEvent::cooperativeBarriers = false;
+        curEventQueue(mainEventQueue[0]);
+
+        return aborted ? nullptr : exit_event;
     }
 
     void
@@ -139,6 +255,13 @@ class SimulatorThreads
     }
 
   protected:
+    void
+    waitBarrier()
+    {
+        host_timeline::Span span("barrier wait");
+        barrier.wait();
+    }
+
     /**
      * The main function for all subordinate threads (i.e., all threads
      * other than the main thread).  These threads start by waiting on
@@ -151,18 +274,115 @@ class SimulatorThreads
     thread_main(EventQueue *queue)
     {
         /* Wait for all initialisation to complete */
-        barrier.wait();
+        waitBarrier();
 
         while (!terminate) {
             doSimLoop(queue);
-            barrier.wait();
+            waitBarrier();
+        }
+    }
+
+    /**
+     * The main function for subordinate threads in partitioned mode.
+     * Each iteration waits for the main thread to start a round, helps
+     * running the queues, and reports back at the end of the round.
+     */
+    void
+    partitioned_main()
+    {
+        while (true) {
+            waitBarrier();
+            if (terminate)
+                return;
+
+            runQueues();
+            waitBarrier();
+        }
+    }
+
+    /** Claim and run queues until every queue has run in this round. */
+    void
+    runQueues()
+    {
+        uint32_t idx;
+        while ((idx = nextQueue.fetch_add(1)) < numQueues) {
+            const uint32_t q = queueOrder[idx];
+            const auto start = std::chrono::steady_clock::now();
+            host_timeline::Span span("run queue", q);
+            runToBarrier(mainEventQueue[q]);
+            queueCost[q] = (std::chrono::steady_clock::now() - start).count();
+        }
+        curEventQueue(nullptr);
+    }
+
+    /**
+     * Service a queue until the next event is the local part of a
+     * global event. Every queue holds the local events of every global
+     * event, so all queues end up parked at the same one.
+     */
+    void
+    runToBarrier(EventQueue *eventq)
+    {
+        curEventQueue(eventq);
+        assert(!eventq->empty());
+        while (!eventq->getHead()->globalEvent()) {
+            // Local exit events are not supported in parallel mode,
+            // ignore them like subordinate threads would.
+            eventq->serviceOne();
+            assert(!eventq->empty());
+        }
+    }
+
+    /**
+     * Service the global barrier event at the head of every queue. The
+     * queues arrive in reverse order so that the last one, which
+     * processes the global event, is queue 0: its local event is the
+     * one deleting the global event when it auto-deletes.
+     *
+     * @return The local exit event of queue 0 if the global event
+     * terminates the simulation loop, nullptr otherwise.
+     */
+    Event *
+    serviceBarriers()
+    {
+        [[maybe_unused]] BaseGlobalEvent *global_event =
+            mainEventQueue[0]->getHead()->globalEvent();
+
+        Event *exit_event = nullptr;
+        for (uint32_t i = numQueues; i-- > 0;) {
+            EventQueue *eventq = mainEventQueue[i];
+            curEventQueue(eventq);
+            assert(eventq->getHead()->globalEvent() == global_event);
+            Event *local_event = eventq->serviceOne();
+            if (i == 0)
+                exit_event = local_event;
+        }
+
+        return exit_event;
+    }
+
+    /** Merge the events that were posted to other queues. */
+    void
+    mergeAsyncInsertions()
+    {
+        for (auto *eventq : mainEventQueue) {
+            curEventQueue(eventq);
+            eventq->handleAsyncInsertions();
         }
     }
 
     std::atomic<bool> terminate;
     uint32_t numQueues;
+    uint32_t numThreads;
     std::vector<std::thread> threads;
     Barrier barrier;
+
+    //! Index of the next entry of queueOrder to be claimed.
+    std::atomic<uint32_t> nextQueue;
+    //! Order in which queues are handed out to threads.
+    std::vector<uint32_t> queueOrder;
+    //! Host time spent on each queue in the last round.
+    std::vector<uint64_t> queueCost;
 };
 
 static std::unique_ptr<SimulatorThreads> simulatorThreads;
@@ -194,12 +414,17 @@ simulate(Tick num_cycles)
 
     if (global_exit_event)//cleaning last global exit event
         global_exit_event->clean();
-    std::unique_ptr<GlobalSyncEvent, DescheduleDeleter> quantum_event;
+    std::unique_ptr<BaseGlobalEvent, DescheduleDeleter> sync_event;
 
     inform("Entering event queue @ %d.  Starting simulation...\n", curTick());
 
-    if (!simulatorThreads)
-        simulatorThreads.reset(new SimulatorThreads(numMainEventQueues));
+    if (!simulatorThreads) {
+        const uint32_t num_threads = numSimulatorThreads ?
+            std::min(numSimulatorThreads, numMainEventQueues) :
+            numMainEventQueues;
+        simulatorThreads.reset(
+            new SimulatorThreads(numMainEventQueues, num_threads));
+    }
 
     if (!simulate_limit_event) {
         // If the simulate_limit_event is not set, we set it to MaxTick.
@@ -220,18 +445,37 @@ simulate(Tick num_cycles)
     }
 
     if (numMainEventQueues > 1) {
-        fatal_if(simQuantum == 0,
-                 "Quantum for multi-eventq simulation not specified");
-
-        quantum_event.reset(
-            new GlobalSyncEvent(curTick() + simQuantum, simQuantum,
-                                EventBase::Progress_Event_Pri, 0));
+        fatal_if(simLookahead && simulatorThreads->partitioned(),
+                 "sim_lookahead requires one thread per event queue.");
+
+        if (simLookahead) {
+            // Synchronize right away to compute the first window.
+            sync_event.reset(
+                new LookaheadSyncEvent(curTick(), simLookahead,
+                                       EventBase::Progress_Event_Pri, 0));
+        } else {
+            fatal_if(simQuantum == 0,
+                     "Quantum for multi-eventq simulation not specified");
+
+            auto *sync = new GlobalSyncEvent(
+                curTick() + simQuantum, simQuantum,
+                EventBase::Progress_Event_Pri, 0);
+            sync->adaptRepeat(simMaxQuantum, simQuantumGrowAccesses,
+                              simQuantumShrinkAccesses,
+                              simQuantumTargetHostNs);
+            sync_event.reset(sync);
+        }
 
         inParallelMode = true;
     }
 
-    simulatorThreads->runUntilLocalExit();
-    Event *local_event = doSimLoop(mainEventQueue[0]);
+    Event *local_event;
+    if (simulatorThreads->partitioned()) {
+        local_event = simulatorThreads->runPartitioned();
+    } else {
+        simulatorThreads->runUntilLocalExit();
+        local_event = doSimLoop(mainEventQueue[0]);
+    }
     assert(local_event);
 
     // Restore normal ctrl-c operation as soon as the event queue is done
@@ -288,6 +532,10 @@ terminateEventQueueThreads()
 Event *
 doSimLoop(EventQueue *eventq)
 {
+    host_timeline::Span span("run queue",
+        std::find(mainEventQueue.begin(), mainEventQueue.end(), eventq) -
+        mainEventQueue.begin());
+
     // set the per thread current eventq pointer
     curEventQueue(eventq);
     eventq->handleAsyncInsertions();
@@ -301,32 +549,8 @@ doSimLoop(EventQueue *eventq)
         assert(curTick() <= eventq->nextTick() &&
                "event scheduled in the past");
 
-        if (mainQueue && async_event) {
-            async_event = false;
-            // Take the event queue lock in case any of the service
-            // routines want to schedule new events.
-            std::lock_guard<EventQueue> lock(*eventq);
-            if (async_statdump || async_statreset) {
-                statistics::schedStatEvent(async_statdump, async_statreset);
-                async_statdump = false;
-                async_statreset = false;
-            }
-
-            if (async_io) {
-                async_io = false;
-                pollQueue.service();
-            }
-
-            if (async_exit) {
-                async_exit = false;
-                exitSimLoop("user interrupt received");
-            }
-
-            if (async_exception) {
-                async_exception = false;
-                return NULL;
-            }
-        }
+        if (mainQueue && !serviceAsyncEvents(eventq))
+            return NULL;
 
         Event *exit_event = eventq->serviceOne();
         if (exit_event != NULL) {
@@ -337,4 +561,46 @@ doSimLoop(EventQueue *eventq)
     // not reached... only exit is return on SimLoopExitEvent
 }
 
+/**
+ * Service the asynchronous requests (e.g., stat dumps, IO and user
+ * interrupts) posted to the simulator. This must be called from the
+ * thread running the main queue.
+ *
+ * @return false if the simulation loop must be aborted.
+ */
+bool
+serviceAsyncEvents(EventQueue *eventq)
+{
+    if (!async_event)
+        return true;
+
+    async_event = false;
+    host_timeline::Span span("async events");
+    // Take the event queue lock in case any of the service
+    // routines want to schedule new events.
+    std::lock_guard<EventQueue> lock(*eventq);
+    if (async_statdump || async_statreset) {
+        statistics::schedStatEvent(async_statdump, async_statreset);
+        async_statdump = false;
+        async_statreset = false;
+    }
+
+    if (async_io) {
+        async_io = false;
+        pollQueue.service();
+    }
+
+    if (async_exit) {
+        async_exit = false;
+        exitSimLoop("user interrupt received");
+    }
+
+    if (async_exception) {
+        async_exception = false;
+        return false;
+    }
+
+    return true;
+}
+
 } // namespace gem5
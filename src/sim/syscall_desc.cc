@@ -31,6 +31,8 @@
 
 #include "base/types.hh"
 #include "sim/eventq.hh"
+#include "sim/process.hh"
+#include "sim/se_workload.hh"
 #include "sim/syscall_debug_macros.hh"
 
 namespace gem5
@@ -55,6 +57,7 @@ SyscallDesc::doSyscall(ThreadContext *tc)
     }
 
     handleReturn(tc, retval);
+    tc->getProcessPtr()->seWorkload->threadScheduler().syscallDone(tc);
 }
 
 void
@@ -74,6 +77,7 @@ SyscallDesc::retrySyscall(ThreadContext *tc)
     tc->activate();
 
     handleReturn(tc, retval);
+    tc->getProcessPtr()->seWorkload->threadScheduler().syscallDone(tc);
 }
 
 void
@@ -189,6 +189,13 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
         }
     }
 
+    // Parked threads of the group are not on any context
+    auto &scheduler = p->seWorkload->threadScheduler();
+    if (*p->exitGroup)
+        scheduler.discard(p->tgid());
+    else if (scheduler.hasThreads(p->tgid()))
+        last_thread = false;
+
     if (last_thread) {
         if (parent) {
             assert(tg_lead);
@@ -225,6 +232,7 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
     int activeContexts = 0;
     for (auto &system: sys->systemList)
         activeContexts += system->threads.numRunning();
+    activeContexts += scheduler.numThreads();
 
     if (activeContexts == 0) {
         /**
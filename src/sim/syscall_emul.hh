@@ -103,8 +103,10 @@
 #include "sim/emul_driver.hh"
 #include "sim/futex_map.hh"
 #include "sim/guest_abi.hh"
+#include "sim/guest_thread_scheduler.hh"
 #include "sim/process.hh"
 #include "sim/proxy_ptr.hh"
+#include "sim/se_workload.hh"
 #include "sim/syscall_debug_macros.hh"
 #include "sim/syscall_desc.hh"
 #include "sim/syscall_emul_buf.hh"
@@ -1760,8 +1762,20 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
         ((flags & OS::TGT_CLONE_VM)     && !(newStack)))
         return -EINVAL;
 
-    ThreadContext *ctc;
-    if (!(ctc = tc->getSystemPtr()->threads.findFree())) {
+    ThreadContext *ctc = tc->getSystemPtr()->threads.findFree();
+    auto &scheduler = p->seWorkload->threadScheduler();
+    std::unique_ptr<GuestThread> parent;
+    if (!ctc && scheduler.enabled() && (flags & OS::TGT_CLONE_THREAD) &&
+        !(flags & OS::TGT_CLONE_VFORK)) {
+        // Set the new thread up on this context, then park it until the
+        // scheduler finds it a context of its own.
+        DPRINTF_SYSCALL(Verbose, "clone: no spare thread context, parking "
+                        "the new thread [cpu %d]\n", tc->cpuId());
+        parent = std::make_unique<GuestThread>(tc);
+        ctc = tc;
+    }
+
+    if (!ctc) {
         DPRINTF_SYSCALL(Verbose, "clone: no spare thread context in system"
                         "[cpu %d, thread %d]", tc->cpuId(), tc->threadId());
         return -EAGAIN;
@@ -1805,17 +1819,7 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
     // the params pointer. Both the params pointer (pp) and the process
     // pointer (cp) are normally managed in python and are never cleaned up.
 
-    Process *owner = ctc->getProcessPtr();
-    ctc->setProcessPtr(cp);
-    cp->assignThreadContext(ctc->contextId());
-    owner->revokeThreadContext(ctc->contextId());
-
-    if (flags & OS::TGT_CLONE_PARENT_SETTID) {
-        BufferArg ptidBuf(ptidPtr, sizeof(long));
-        long *ptid = (long *)ptidBuf.bufferPtr();
-        *ptid = cp->pid();
-        ptidBuf.copyOut(SETranslatingPortProxy(tc));
-    }
+    GuestThreadScheduler::bind(ctc, cp);
 
     if (flags & OS::TGT_CLONE_THREAD) {
         cp->pTable->initState();
@@ -1827,6 +1831,15 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
     cp->initState();
     p->clone(tc, ctc, cp, flags);
 
+    // The parent's address space is only reachable from this context
+    // once the child shares it, if the child is set up here
+    if (flags & OS::TGT_CLONE_PARENT_SETTID) {
+        BufferArg ptidBuf(ptidPtr, sizeof(long));
+        long *ptid = (long *)ptidBuf.bufferPtr();
+        *ptid = cp->pid();
+        ptidBuf.copyOut(SETranslatingPortProxy(tc));
+    }
+
     if (flags & OS::TGT_CLONE_THREAD) {
         delete cp->sigchld;
         cp->sigchld = p->sigchld;
@@ -1844,13 +1857,24 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
     if (flags & OS::TGT_CLONE_CHILD_CLEARTID)
         cp->childClearTID = (uint64_t)ctidPtr;
 
-    ctc->clearArchRegs();
+    // Setting up the process may have used the registers of this
+    // context, which the child starts from
+    if (parent)
+        parent->restoreRegs(ctc);
+    else
+        ctc->clearArchRegs();
 
     OS::archClone(flags, p, cp, tc, ctc, newStack, tlsPtr);
 
     desc->returnInto(ctc, 0);
 
-    ctc->activate();
+    if (parent) {
+        scheduler.park(ctc);
+        GuestThreadScheduler::bind(tc, p);
+        parent->restoreRegs(tc);
+    } else {
+        ctc->activate();
+    }
 
     if (flags & OS::TGT_CLONE_VFORK) {
         tc->suspend();
@@ -1933,19 +1957,28 @@ readvFunc(SyscallDesc *desc, ThreadContext *tc,
     SETranslatingPortProxy prox(tc);
     typename OS::tgt_iovec tiov[count];
     struct iovec hiov[count];
+    // Whether each host buffer is the target buffer itself
+    bool in_place[count];
     for (typename OS::size_t i = 0; i < count; ++i) {
         prox.readBlob(tiov_base + (i * sizeof(typename OS::tgt_iovec)),
                       &tiov[i], sizeof(typename OS::tgt_iovec));
         hiov[i].iov_len = gtoh(tiov[i].iov_len, OS::byteOrder);
-        hiov[i].iov_base = new char [hiov[i].iov_len];
+        hiov[i].iov_base = prox.tryHostPtr(
+                gtoh(tiov[i].iov_base, OS::byteOrder), hiov[i].iov_len,
+                MemBackdoor::Writeable);
+        in_place[i] = hiov[i].iov_base != nullptr;
+        if (!in_place[i])
+            hiov[i].iov_base = new char [hiov[i].iov_len];
     }
 
     int result = readv(sim_fd, hiov, count);
     int local_errno = errno;
 
     for (typename OS::size_t i = 0; i < count; ++i) {
+        if (in_place[i])
+            continue;
         if (result != -1) {
-            prox.writeBlob(htog(tiov[i].iov_base, OS::byteOrder),
+            prox.writeBlob(gtoh(tiov[i].iov_base, OS::byteOrder),
                            hiov[i].iov_base, hiov[i].iov_len);
         }
         delete [] (char *)hiov[i].iov_base;
@@ -1970,21 +2003,30 @@ writevFunc(SyscallDesc *desc, ThreadContext *tc,
 
     SETranslatingPortProxy prox(tc);
     struct iovec hiov[count];
+    // Whether each host buffer is the target buffer itself
+    bool in_place[count];
     for (typename OS::size_t i = 0; i < count; ++i) {
         typename OS::tgt_iovec tiov;
 
         prox.readBlob(tiov_base + i*sizeof(typename OS::tgt_iovec),
                       &tiov, sizeof(typename OS::tgt_iovec));
+        const Addr base = gtoh(tiov.iov_base, OS::byteOrder);
         hiov[i].iov_len = gtoh(tiov.iov_len, OS::byteOrder);
-        hiov[i].iov_base = new char [hiov[i].iov_len];
-        prox.readBlob(gtoh(tiov.iov_base, OS::byteOrder), hiov[i].iov_base,
-                      hiov[i].iov_len);
+        hiov[i].iov_base = prox.tryHostPtr(base, hiov[i].iov_len,
+                                           MemBackdoor::Readable);
+        in_place[i] = hiov[i].iov_base != nullptr;
+        if (!in_place[i]) {
+            hiov[i].iov_base = new char [hiov[i].iov_len];
+            prox.readBlob(base, hiov[i].iov_base, hiov[i].iov_len);
+        }
     }
 
     int result = writev(sim_fd, hiov, count);
 
-    for (typename OS::size_t i = 0; i < count; ++i)
-        delete [] (char *)hiov[i].iov_base;
+    for (typename OS::size_t i = 0; i < count; ++i) {
+        if (!in_place[i])
+            delete [] (char *)hiov[i].iov_base;
+    }
 
     return (result == -1) ? -errno : result;
 }
@@ -2145,11 +2187,12 @@ pread64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
-    BufferArg bufArg(bufPtr, nbytes);
+    SETranslatingPortProxy prox(tc);
+    BufferArg bufArg(bufPtr, nbytes, prox, MemBackdoor::Writeable);
 
     int bytes_read = pread(sim_fd, bufArg.bufferPtr(), nbytes, offset);
 
-    bufArg.copyOut(SETranslatingPortProxy(tc));
+    bufArg.copyOut(prox);
 
     return (bytes_read == -1) ? -errno : bytes_read;
 }
@@ -2167,8 +2210,9 @@ pwrite64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
-    BufferArg bufArg(bufPtr, nbytes);
-    bufArg.copyIn(SETranslatingPortProxy(tc));
+    SETranslatingPortProxy prox(tc);
+    BufferArg bufArg(bufPtr, nbytes, prox, MemBackdoor::Readable);
+    bufArg.copyIn(prox);
 
     int bytes_written = pwrite(sim_fd, bufArg.bufferPtr(), nbytes, offset);
 
@@ -2807,11 +2851,12 @@ readFunc(SyscallDesc *desc, ThreadContext *tc,
         && !(hbfdp->getFlags() & OS::TGT_O_NONBLOCK))
         return SyscallReturn::retry();
 
-    BufferArg buf_arg(buf_ptr, nbytes);
+    SETranslatingPortProxy prox(tc);
+    BufferArg buf_arg(buf_ptr, nbytes, prox, MemBackdoor::Writeable);
     int bytes_read = read(sim_fd, buf_arg.bufferPtr(), nbytes);
 
     if (bytes_read > 0)
-        buf_arg.copyOut(SETranslatingPortProxy(tc));
+        buf_arg.copyOut(prox);
 
     return (bytes_read == -1) ? -errno : bytes_read;
 }
@@ -2828,8 +2873,9 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = hbfdp->getSimFD();
 
-    BufferArg buf_arg(buf_ptr, nbytes);
-    buf_arg.copyIn(SETranslatingPortProxy(tc));
+    SETranslatingPortProxy prox(tc);
+    BufferArg buf_arg(buf_ptr, nbytes, prox, MemBackdoor::Readable);
+    buf_arg.copyIn(prox);
 
     struct pollfd pfd;
     pfd.fd = sim_fd;
@@ -52,7 +52,9 @@ namespace gem5
  * instance provides an internal (simulator-space) buffer of the
  * appropriate size and tracks the user-space address.  The copyIn()
  * and copyOut() methods copy the user-space buffer to and from the
- * simulator-space buffer, respectively.
+ * simulator-space buffer, respectively. Untyped buffers which are
+ * contiguous on the host can instead be accessed in place, in which
+ * case copying them is a no-op.
  */
 class BaseBufferArg
 {
@@ -64,15 +66,32 @@ class BaseBufferArg
      * target address 'addr'.
      */
     BaseBufferArg(Addr _addr, int _size)
-        : addr(_addr), size(_size), bufPtr(new uint8_t[size])
+        : BaseBufferArg(_addr, _size, nullptr)
+    {}
+
+    /**
+     * Represent the memory at target address 'addr', which the host
+     * pointer 'host' refers to if it isn't null.
+     */
+    BaseBufferArg(Addr _addr, int _size, uint8_t *host)
+        : addr(_addr), size(_size), inPlace(host != nullptr),
+          bufPtr(inPlace ? host : new uint8_t[size])
     {
         // clear out buffer: in case we only partially populate this,
         // and then do a copyOut(), we want to make sure we don't
         // introduce any random junk into the simulated address space
-        memset(bufPtr, 0, size);
+        if (!inPlace)
+            memset(bufPtr, 0, size);
+    }
+
+    ~BaseBufferArg()
+    {
+        if (!inPlace)
+            delete [] bufPtr;
     }
 
-    ~BaseBufferArg() { delete [] bufPtr; }
+    BaseBufferArg(const BaseBufferArg &) = delete;
+    BaseBufferArg &operator=(const BaseBufferArg &) = delete;
 
     /**
      * copy data into simulator space (read from target memory)
@@ -80,6 +99,8 @@ class BaseBufferArg
     bool
     copyIn(const PortProxy &memproxy)
     {
+        if (inPlace)
+            return true;
         memproxy.readBlob(addr, bufPtr, size);
         return true;    // no EFAULT detection for now
     }
@@ -90,6 +111,8 @@ class BaseBufferArg
     bool
     copyOut(const PortProxy &memproxy)
     {
+        if (inPlace)
+            return true;
         memproxy.writeBlob(addr, bufPtr, size);
         return true;    // no EFAULT detection for now
     }
@@ -97,6 +120,7 @@ class BaseBufferArg
   protected:
     const Addr addr;        ///< address of buffer in target address space
     const int size;         ///< buffer size
+    const bool inPlace;     ///< whether bufPtr points to target memory
     uint8_t * const bufPtr; ///< pointer to buffer in simulator space
 };
 
@@ -113,6 +137,18 @@ class BufferArg : public BaseBufferArg
      */
     BufferArg(Addr _addr, int _size) : BaseBufferArg(_addr, _size) { }
 
+    /**
+     * Represent the memory at target address 'addr', accessing it in
+     * place when memproxy can provide a host pointer to all of it
+     * with the given access flags. System calls can then read and
+     * write the target buffer directly.
+     */
+    BufferArg(Addr _addr, int _size, const PortProxy &memproxy,
+              MemBackdoor::Flags access)
+        : BaseBufferArg(_addr, _size,
+                        memproxy.tryHostPtr(_addr, _size, access))
+    { }
+
     /**
      * Return a pointer to the internal simulator-space buffer.
      */
@@ -52,6 +52,7 @@
 #include "cpu/base.hh"
 #include "cpu/thread_context.hh"
 #include "debug/Loader.hh"
+#include "debug/PseudoInst.hh"
 #include "debug/Quiesce.hh"
 #include "debug/WorkItems.hh"
 #include "mem/abstract_mem.hh"
@@ -61,6 +62,7 @@
 #include "sim/debug.hh"
 #include "sim/redirect_path.hh"
 #include "sim/serialize_handlers.hh"
+#include "sim/stat_control.hh"
 
 namespace gem5
 {
@@ -168,15 +170,24 @@ System::System(const Params &p)
     : SimObject(p), _systemPort("system_port"),
       multiThread(p.multi_thread),
       init_param(p.init_param),
-      physProxy(_systemPort, p.cache_line_size),
+      physProxy([this](PacketPtr pkt) { _systemPort.sendFunctional(pkt); },
+                [this](const MemBackdoorReq &req, MemBackdoorPtr &backdoor) {
+                    // Memory has the latest data until caches are used
+                    if (!startedUp || bypassCaches())
+                        _systemPort.sendMemBackdoorReq(req, backdoor);
+                },
+                p.cache_line_size),
       workload(p.workload),
       physmem(name() + ".physmem", p.memories, p.mmap_using_noreserve,
-              p.shared_backstore, p.auto_unlink_shared_backstore),
+              p.shared_backstore, p.auto_unlink_shared_backstore,
+              p.memory_checkpoint_format, p.lazy_memory_restore,
+              p.mergeable_backstore, p.memory_image_cache),
       ShadowRomRanges(p.shadow_rom_ranges.begin(),
                       p.shadow_rom_ranges.end()),
       memoryMode(p.mem_mode),
       _cacheLineSize(p.cache_line_size),
       numWorkIds(p.num_work_ids),
+      statsOpEvent([this]{ processStatsOpEvent(); }, name() + ".statsOp"),
       thermalModel(p.thermal_model),
       _m5opRange(p.m5ops_base ?
                  RangeSize(p.m5ops_base, 0x10000) :
@@ -187,6 +198,9 @@ System::System(const Params &p)
             "(could use StubWorkload?).", name());
     workload->setSystem(this);
 
+    fatal_if(p.work_item_exit_batch == 0,
+             "%s: work_item_exit_batch must be at least 1.", name());
+
     // add self to global system list
     systemList.push_back(this);
 
@@ -335,6 +349,16 @@ System::serialize(CheckpointOut &cp) const
         paramOut(cp, csprintf("quiesceEndTick_%d", id), when);
     }
 
+    SERIALIZE_SCALAR(workBeginEvents);
+    SERIALIZE_SCALAR(workEndEvents);
+    SERIALIZE_SCALAR(lastWorkBeginTick);
+    SERIALIZE_SCALAR(lastWorkEndTick);
+    SERIALIZE_SCALAR(pendingStatsDump);
+    SERIALIZE_SCALAR(pendingStatsReset);
+    SERIALIZE_SCALAR(lastStatsOpTick);
+    Tick statsOpTick = statsOpEvent.scheduled() ? statsOpEvent.when() : 0;
+    SERIALIZE_SCALAR(statsOpTick);
+
     // also serialize the memories in the system
     physmem.serializeSection(cp, "physmem");
 }
@@ -353,10 +377,31 @@ System::unserialize(CheckpointIn &cp)
         t.context->getCpuPtr()->schedule(t.resumeEvent, when);
     }
 
+    // Checkpoints from before the batching of the pseudo instructions
+    // don't have these.
+    UNSERIALIZE_OPT_SCALAR(workBeginEvents);
+    UNSERIALIZE_OPT_SCALAR(workEndEvents);
+    UNSERIALIZE_OPT_SCALAR(lastWorkBeginTick);
+    UNSERIALIZE_OPT_SCALAR(lastWorkEndTick);
+    UNSERIALIZE_OPT_SCALAR(pendingStatsDump);
+    UNSERIALIZE_OPT_SCALAR(pendingStatsReset);
+    UNSERIALIZE_OPT_SCALAR(lastStatsOpTick);
+    Tick statsOpTick = 0;
+    UNSERIALIZE_OPT_SCALAR(statsOpTick);
+    if (statsOpTick)
+        schedule(statsOpEvent, statsOpTick);
+
     // also unserialize the memories in the system
     physmem.unserializeSection(cp, "physmem");
 }
 
+void
+System::startup()
+{
+    SimObject::startup();
+    startedUp = true;
+}
+
 void
 System::regStats()
 {
@@ -390,6 +435,67 @@ System::workItemEnd(uint32_t tid, uint32_t workid)
     lastWorkItemStarted.erase(p);
 }
 
+bool
+System::recordWorkItemEvent(bool begin, uint64_t workid)
+{
+    uint64_t count;
+    if (begin) {
+        count = ++workBeginEvents;
+        lastWorkBeginTick = curTick();
+    } else {
+        count = ++workEndEvents;
+        lastWorkEndTick = curTick();
+    }
+
+    const auto &exit_ids = params().work_item_exit_ids;
+    bool exit = count % params().work_item_exit_batch == 0 ||
+        std::find(exit_ids.begin(), exit_ids.end(),
+                  static_cast<int>(workid)) != exit_ids.end();
+
+    DPRINTF(WorkItems, "Work item %s %d: %d so far%s\n",
+            begin ? "begin" : "end", workid, count, exit ? ", exiting" : "");
+    return exit;
+}
+
+void
+System::statsOp(bool dump, bool reset, Tick when, Tick repeat)
+{
+    const Tick window = params().stats_insts_window;
+    if (!window || repeat) {
+        statistics::schedStatEvent(dump, reset, when, repeat);
+        return;
+    }
+
+    if (!statsOpEvent.scheduled() &&
+            (lastStatsOpTick == MaxTick || when >= lastStatsOpTick + window)) {
+        lastStatsOpTick = when;
+        statistics::schedStatEvent(dump, reset, when, 0);
+        return;
+    }
+
+    // Too close to the last operation, do this one along with any others
+    // at the end of the window.
+    pendingStatsDump |= dump;
+    pendingStatsReset |= reset;
+    when = std::max(when, lastStatsOpTick + window);
+    if (!statsOpEvent.scheduled())
+        schedule(statsOpEvent, when);
+    else if (when > statsOpEvent.when())
+        reschedule(statsOpEvent, when);
+    DPRINTF(PseudoInst, "Statistics dump %d reset %d merged until %d\n",
+            pendingStatsDump, pendingStatsReset, statsOpEvent.when());
+}
+
+void
+System::processStatsOpEvent()
+{
+    lastStatsOpTick = curTick();
+    statistics::schedStatEvent(pendingStatsDump, pendingStatsReset,
+                               curTick(), 0);
+    pendingStatsDump = false;
+    pendingStatsReset = false;
+}
+
 bool
 System::trapToGdb(GDBSignal signal, ContextID ctx_id) const
 {
@@ -405,12 +405,39 @@ class System : public SimObject, public PCEventScope
 
     enums::MemoryMode memoryMode;
 
+    /**
+     * Set once the simulation starts, after which caches may hold data
+     * that memory backdoors would miss.
+     */
+    bool startedUp = false;
+
     const Addr _cacheLineSize;
 
     uint64_t workItemsBegin = 0;
     uint64_t workItemsEnd = 0;
     uint32_t numWorkIds;
 
+    /**
+     * Work item begins and ends seen with exit_on_work_items, whether or
+     * not they exited from the simulation loop, and when the last ones
+     * happened.
+     */
+    uint64_t workBeginEvents = 0;
+    uint64_t workEndEvents = 0;
+    Tick lastWorkBeginTick = 0;
+    Tick lastWorkEndTick = 0;
+
+    /**
+     * Statistics operations merged by stats_insts_window, which
+     * statsOpEvent carries out, and when the last one was carried out.
+     */
+    bool pendingStatsDump = false;
+    bool pendingStatsReset = false;
+    Tick lastStatsOpTick = MaxTick;
+    EventFunctionWrapper statsOpEvent;
+
+    void processStatsOpEvent();
+
     /** This array is a per-system list of all devices capable of issuing a
      * memory system request and an associated string for each requestor id.
      * It's used to uniquely id any requestor in the system by name for things
@@ -509,6 +536,8 @@ class System : public SimObject, public PCEventScope
   public:
 
     void regStats() override;
+
+    void startup() override;
     /**
      * Called by pseudo_inst to track the number of work items started by this
      * system.
@@ -550,6 +579,30 @@ class System : public SimObject, public PCEventScope
 
     void workItemEnd(uint32_t tid, uint32_t workid);
 
+    /**
+     * Called by pseudo_inst to count a work item begin or end when
+     * exit_on_work_items is set.
+     *
+     * @param begin Whether the work item begins rather than ends.
+     * @param workid The id of the work item.
+     * @return Whether to exit from the simulation loop.
+     */
+    bool recordWorkItemEvent(bool begin, uint64_t workid);
+
+    uint64_t getWorkBeginEvents() const { return workBeginEvents; }
+    uint64_t getWorkEndEvents() const { return workEndEvents; }
+
+    /**
+     * Called by pseudo_inst to dump and/or reset the statistics, which
+     * may be merged with other requests following stats_insts_window.
+     *
+     * @param dump Whether to dump the statistics.
+     * @param reset Whether to reset the statistics.
+     * @param when When to carry out the operation.
+     * @param repeat The period to repeat it at, 0 for once.
+     */
+    void statsOp(bool dump, bool reset, Tick when, Tick repeat);
+
     /* Returns whether we successfully trapped into GDB. */
     bool trapToGdb(GDBSignal signal, ContextID ctx_id) const;
 
@@ -37,3 +37,8 @@ class OutgoingRequestBridge(SimObject):
     physical_address_ranges = VectorParam.AddrRange(
         [AddrRange(0x80000000, MaxAddr)], "Physical address ranges."
     )
+    batch_requests = Param.Bool(
+        False,
+        "Hold timing requests until SST collects them at the end of a "
+        "synchronization window, instead of forwarding them one by one",
+    )
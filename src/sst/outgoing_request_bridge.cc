@@ -41,7 +41,8 @@ OutgoingRequestBridge::OutgoingRequestBridge(
     outgoingPort(std::string(name()), this),
     sstResponder(nullptr),
     physicalAddressRanges(params.physical_address_ranges.begin(),
-                          params.physical_address_ranges.end())
+                          params.physical_address_ranges.end()),
+    batchRequests(params.batch_requests)
 {
 }
 
@@ -105,6 +106,61 @@ OutgoingRequestBridge::sendTimingSnoopReq(gem5::PacketPtr pkt)
     outgoingPort.sendTimingSnoopReq(pkt);
 }
 
+void
+OutgoingRequestBridge::flushRequests()
+{
+    if (requestBatch.empty())
+        return;
+
+    std::vector<PacketPtr> batch;
+    batch.swap(requestBatch);
+    sstResponder->handleRecvTimingReqs(batch);
+}
+
+void
+OutgoingRequestBridge::queueTimingResp(PacketPtr pkt)
+{
+    std::lock_guard<std::mutex> lock(incomingLock);
+    incoming.emplace_back(pkt, false);
+}
+
+void
+OutgoingRequestBridge::queueTimingSnoopReq(PacketPtr pkt)
+{
+    std::lock_guard<std::mutex> lock(incomingLock);
+    incoming.emplace_back(pkt, true);
+}
+
+void
+OutgoingRequestBridge::deliverResponses()
+{
+    std::vector<std::pair<PacketPtr, bool>> delivered;
+    {
+        std::lock_guard<std::mutex> lock(incomingLock);
+        delivered.swap(incoming);
+    }
+
+    bool was_blocked = !blockedResponses.empty();
+    for (auto &p : delivered) {
+        if (p.second)
+            outgoingPort.sendTimingSnoopReq(p.first);
+        else
+            blockedResponses.push_back(p.first);
+    }
+
+    // if the port refused a response, wait for its retry
+    if (!was_blocked)
+        retryResponses();
+}
+
+void
+OutgoingRequestBridge::retryResponses()
+{
+    while (!blockedResponses.empty() &&
+           outgoingPort.sendTimingResp(blockedResponses.front()))
+        blockedResponses.pop_front();
+}
+
 void
 OutgoingRequestBridge::handleRecvFunctional(PacketPtr pkt)
 {
@@ -133,7 +189,10 @@ bool
 OutgoingRequestBridge::
 OutgoingRequestPort::recvTimingReq(PacketPtr pkt)
 {
-    owner->sstResponder->handleRecvTimingReq(pkt);
+    if (owner->batchRequests)
+        owner->requestBatch.push_back(pkt);
+    else
+        owner->sstResponder->handleRecvTimingReq(pkt);
     return true;
 }
 
@@ -141,7 +200,11 @@ void
 OutgoingRequestBridge::
 OutgoingRequestPort::recvRespRetry()
 {
-    owner->sstResponder->handleRecvRespRetry();
+    // responses queued by the bridge or by SST, only one is used at once
+    if (!owner->blockedResponses.empty())
+        owner->retryResponses();
+    else
+        owner->sstResponder->handleRecvRespRetry();
 }
 
 AddrRangeList
@@ -27,6 +27,8 @@
 #ifndef __SST_OUTGOING_REQUEST_BRIDGE_HH__
 #define __SST_OUTGOING_REQUEST_BRIDGE_HH__
 
+#include <deque>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -44,6 +46,13 @@
  * SST-version-independent. Thus, there's no translation between a gem5 packet
  * and SST Response here.
  *
+ * -  When batch_requests is set, timing requests are held by the bridge
+ * until SST collects them with flushRequests(), once per synchronization
+ * window, instead of crossing into SST one at a time. Likewise, SST may
+ * queue its responses with queueTimingResp(), from any thread, and have
+ * them delivered to gem5 by deliverResponses(). Together, they let gem5
+ * run in its own thread while SST is processing the same window.
+ *
  *  - OutgoingRequestPort is a specialized ResponsePort working with
  * OutgoingRequestBridge.
  */
@@ -79,6 +88,19 @@ class OutgoingRequestBridge: public SimObject
 
     AddrRangeList physicalAddressRanges;
 
+  private:
+    // whether timing requests are held until flushRequests() is called
+    bool batchRequests;
+    std::vector<PacketPtr> requestBatch;
+
+    // responses and snoops queued by SST, the latter flagged with true
+    std::mutex incomingLock;
+    std::vector<std::pair<PacketPtr, bool>> incoming;
+    // responses from incoming refused by the port, waiting for a retry
+    std::deque<PacketPtr> blockedResponses;
+
+    void retryResponses();
+
   public:
     OutgoingRequestBridge(const OutgoingRequestBridgeParams &params);
     ~OutgoingRequestBridge();
@@ -111,6 +133,23 @@ class OutgoingRequestBridge: public SimObject
     // This function is called when SST sends response having an invalidate .
     void sendTimingSnoopReq(PacketPtr pkt);
 
+    // Hold the timing requests until flushRequests() is called, or not.
+    void setBatchRequests(bool batch) { batchRequests = batch; }
+
+    // Forward the timing requests held since the last call to SST. This
+    // must not be called while gem5 is simulating.
+    void flushRequests();
+
+    // These functions are the thread-safe counterparts of sendTimingResp()
+    // and sendTimingSnoopReq(). The packets are sent on the next call to
+    // deliverResponses().
+    void queueTimingResp(PacketPtr pkt);
+    void queueTimingSnoopReq(PacketPtr pkt);
+
+    // Send the packets queued by SST to gem5. This must not be called while
+    // gem5 is simulating.
+    void deliverResponses();
+
     // This function is called when gem5 wants to send a non-timing request
     // to SST. Should only be called during the SST construction phase, i.e.
     // not at the simulation time.
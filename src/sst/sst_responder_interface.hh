@@ -29,6 +29,7 @@
 #define __SST_RESPONDER_INTERFACE_HH__
 
 #include <string>
+#include <vector>
 
 #include "mem/port.hh"
 
@@ -54,6 +55,16 @@ class SSTResponderInterface
     // is called.
     virtual bool handleRecvTimingReq(PacketPtr pkt) = 0;
 
+    // This function is called when OutgoingRequestBridge forwards the
+    // requests it has batched, in the order gem5 sent them. By default,
+    // they are handled one at a time.
+    virtual void
+    handleRecvTimingReqs(const std::vector<PacketPtr> &pkts)
+    {
+        for (auto pkt : pkts)
+            handleRecvTimingReq(pkt);
+    }
+
     // This function is called when OutogingRequestPort::recvRespRetry() is
     // called.
     virtual void handleRecvRespRetry() = 0;
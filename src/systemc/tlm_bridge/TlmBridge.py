@@ -44,6 +44,11 @@ class Gem5ToTlmBridgeBase(SystemC_ScModule):
     addr_ranges = VectorParam.AddrRange(
         [], "Addresses served by this port's TLM side"
     )
+    use_dmi = Param.Bool(
+        True,
+        "Serve atomic reads and writes from the DMI regions granted by the "
+        "TLM target instead of calling b_transport",
+    )
 
 
 class TlmToGem5BridgeBase(SystemC_ScModule):
@@ -55,6 +60,17 @@ class TlmToGem5BridgeBase(SystemC_ScModule):
     system = Param.System(Parent.any, "system")
 
     gem5 = RequestPort("gem5 request port")
+    use_dmi = Param.Bool(
+        True,
+        "Serve b_transport reads and writes from the gem5 backdoors already "
+        "handed out as DMI regions",
+    )
+    sync_to_quantum = Param.Bool(
+        False,
+        "Wait for the annotated time of a b_transport when it reaches the "
+        "global quantum, as tlm_quantumkeeper::sync() would, so temporally "
+        "decoupled initiators see gem5 at most one quantum behind",
+    )
 
 
 class Gem5ToTlmBridge32(Gem5ToTlmBridgeBase):
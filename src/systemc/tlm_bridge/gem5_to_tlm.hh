@@ -69,6 +69,7 @@
 #include "sim/system.hh"
 #include "systemc/ext/core/sc_module.hh"
 #include "systemc/ext/core/sc_module_name.hh"
+#include "systemc/ext/core/sc_time.hh"
 #include "systemc/ext/tlm_core/2/generic_payload/gp.hh"
 #include "systemc/ext/tlm_utils/simple_initiator_socket.h"
 #include "systemc/tlm_port_wrapper.hh"
@@ -182,12 +183,37 @@ class Gem5ToTlmBridge : public Gem5ToTlmBridgeBase
 
     gem5::AddrRangeList addrRanges;
 
+    /**
+     * Serve atomic accesses from the DMI regions of the target directly.
+     */
+    bool useDmi;
+
+    /**
+     * The latencies the target annotated each DMI region with.
+     */
+    struct DmiLatency
+    {
+        sc_core::sc_time read;
+        sc_core::sc_time write;
+    };
+    std::unordered_map<gem5::MemBackdoorPtr, DmiLatency> dmiLatencies;
+
   protected:
     void pec(tlm::tlm_generic_payload &trans, const tlm::tlm_phase &phase);
 
     gem5::MemBackdoorPtr getBackdoor(tlm::tlm_generic_payload &trans);
     gem5::AddrRangeMap<gem5::MemBackdoorPtr> backdoorMap;
 
+    /**
+     * Perform an atomic access through a known DMI region, without building
+     * a transaction.
+     *
+     * @param packet The request, turned into a response on success.
+     * @param latency Set to the DMI latency of the access on success.
+     * @return Whether the access could be served.
+     */
+    bool tryDmiAccess(gem5::PacketPtr packet, gem5::Tick &latency);
+
     // The gem5 port interface.
     gem5::Tick recvAtomic(gem5::PacketPtr packet);
     gem5::Tick recvAtomicBackdoor(gem5::PacketPtr pkt,
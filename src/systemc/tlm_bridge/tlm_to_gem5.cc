@@ -57,6 +57,7 @@
 
 #include "systemc/tlm_bridge/tlm_to_gem5.hh"
 
+#include <cstring>
 #include <utility>
 
 #include "base/trace.hh"
@@ -70,6 +71,7 @@
 #include "sim/system.hh"
 #include "systemc/ext/core/sc_module_name.hh"
 #include "systemc/ext/core/sc_time.hh"
+#include "systemc/ext/tlm_core/2/quantum/global_quantum.hh"
 
 using namespace gem5;
 
@@ -326,6 +328,52 @@ TlmToGem5Bridge<BITWIDTH>::invalidateDmi(const gem5::MemBackdoor &backdoor)
     requestedBackdoors.erase(const_cast<gem5::MemBackdoorPtr>(&backdoor));
 }
 
+template <unsigned int BITWIDTH>
+bool
+TlmToGem5Bridge<BITWIDTH>::tryDmiAccess(tlm::tlm_generic_payload &trans)
+{
+    // Transactions which carry gem5 state, or need extra conversion steps,
+    // are still sent as packets.
+    if (!useDmi || !extraPayloadToPacketSteps.empty())
+        return false;
+
+    Gem5SystemC::Gem5Extension *extension = nullptr;
+    trans.get_extension(extension);
+    Gem5SystemC::AtomicExtension *atomic_ex = nullptr;
+    trans.get_extension(atomic_ex);
+    if (extension || atomic_ex)
+        return false;
+
+    unsigned len = trans.get_data_length();
+    if (trans.get_byte_enable_ptr() || trans.get_streaming_width() < len)
+        return false;
+
+    bool is_read = trans.get_command() == tlm::TLM_READ_COMMAND;
+    if (!is_read && trans.get_command() != tlm::TLM_WRITE_COMMAND)
+        return false;
+
+    Addr start = trans.get_address();
+    AddrRange r(start, start + len);
+    for (auto &b : requestedBackdoors) {
+        if (!r.isSubset(b->range()) ||
+                !(is_read ? b->readable() : b->writeable())) {
+            continue;
+        }
+
+        uint8_t *ptr = b->ptr() + (start - b->range().start());
+        if (is_read)
+            std::memcpy(trans.get_data_ptr(), ptr, len);
+        else
+            std::memcpy(ptr, trans.get_data_ptr(), len);
+
+        trans.set_dmi_allowed(true);
+        trans.set_response_status(tlm::TLM_OK_RESPONSE);
+        return true;
+    }
+
+    return false;
+}
+
 template <unsigned int BITWIDTH>
 void
 TlmToGem5Bridge<BITWIDTH>::peq_cb(tlm::tlm_generic_payload &trans,
@@ -374,6 +422,21 @@ void
 TlmToGem5Bridge<BITWIDTH>::b_transport(tlm::tlm_generic_payload &trans,
                                        sc_core::sc_time &t)
 {
+    // A temporally decoupled initiator may run ahead of gem5 by its local
+    // time offset. Once that reaches the global quantum, synchronize before
+    // looking at gem5 state, as the initiator's quantum keeper would.
+    if (syncToQuantum) {
+        const sc_core::sc_time &quantum =
+            tlm::tlm_global_quantum::instance().get();
+        if (quantum != sc_core::SC_ZERO_TIME && t >= quantum) {
+            sc_core::wait(t);
+            t = sc_core::SC_ZERO_TIME;
+        }
+    }
+
+    if (tryDmiAccess(trans))
+        return;
+
     auto [pkt, pkt_created] = payload2packet(_id, trans);
     pkt->pushSenderState(new Gem5SystemC::TlmSenderState(trans));
 
@@ -598,6 +661,7 @@ TlmToGem5Bridge<BITWIDTH>::TlmToGem5Bridge(
     TlmToGem5BridgeBase(mn), peq(this, &TlmToGem5Bridge<BITWIDTH>::peq_cb),
     waitForRetry(false), pendingRequest(nullptr), pendingPacket(nullptr),
     needToSendRetry(false), responseInProgress(false),
+    useDmi(params.use_dmi), syncToQuantum(params.sync_to_quantum),
     bmp(std::string(name()) + "master", *this), socket("tlm_socket"),
     wrapper(socket, std::string(name()) + ".tlm", InvalidPortID),
     system(params.system),
@@ -125,6 +125,17 @@ class TlmToGem5Bridge : public TlmToGem5BridgeBase
 
     std::unordered_set<gem5::MemBackdoorPtr> requestedBackdoors;
 
+    /**
+     * Serve blocking transactions from the requested backdoors directly.
+     */
+    bool useDmi;
+
+    /**
+     * Catch up with temporally decoupled initiators once they are a global
+     * quantum ahead.
+     */
+    bool syncToQuantum;
+
     BridgeRequestPort bmp;
     tlm_utils::simple_target_socket<
         TlmToGem5Bridge<BITWIDTH>, BITWIDTH> socket;
@@ -145,6 +156,14 @@ class TlmToGem5Bridge : public TlmToGem5BridgeBase
 
     void cacheBackdoor(gem5::MemBackdoorPtr backdoor);
 
+    /**
+     * Perform a blocking transaction through one of the requested backdoors,
+     * without sending a packet into gem5.
+     *
+     * @return Whether the transaction could be served.
+     */
+    bool tryDmiAccess(tlm::tlm_generic_payload &trans);
+
   protected:
     // payload event call back
     void peq_cb(tlm::tlm_generic_payload &trans, const tlm::tlm_phase &phase);
@@ -0,0 +1,139 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Compare the host metrics of two runs of the sim_throughput tests, e.g., of
+two releases, and report the regressions.
+
+```
+./compare_host_metrics.py BASELINE CURRENT [--threshold 0.05] [--json FILE]
+```
+
+BASELINE and CURRENT are searched for host_metrics.json files, usually in
+the testing-results directories of the two runs. The runs are matched by
+name. The exit status is 1 if any of them got slower, or needs more memory,
+by more than the threshold.
+"""
+
+import argparse
+import json
+import os
+import sys
+
+# For each metric, whether a higher value is better.
+METRICS = {
+    "insts_per_second": True,
+    "events_per_second": True,
+    "startup_seconds": False,
+    "peak_rss_bytes": False,
+}
+
+
+def load(directory):
+    """Map the name of every run under directory to its metrics."""
+    runs = {}
+    for root, _, files in os.walk(directory):
+        if "host_metrics.json" in files:
+            with open(os.path.join(root, "host_metrics.json")) as f:
+                metrics = json.load(f)
+            runs[metrics["name"]] = metrics
+    return runs
+
+
+def compare(baseline, current, threshold):
+    """Return the relative change of every metric of the runs in both
+    sets, and whether it is a regression."""
+    changes = []
+    for name in sorted(baseline.keys() & current.keys()):
+        for metric, higher_is_better in METRICS.items():
+            old = baseline[name].get(metric)
+            new = current[name].get(metric)
+            if not old or new is None:
+                continue
+            change = (new - old) / old
+            regression = (
+                change < -threshold if higher_is_better else change > threshold
+            )
+            changes.append(
+                {
+                    "name": name,
+                    "metric": metric,
+                    "baseline": old,
+                    "current": new,
+                    "change": change,
+                    "regression": regression,
+                }
+            )
+    return changes
+
+
+parser = argparse.ArgumentParser(
+    description="Compare the host metrics of two sets of simulations."
+)
+parser.add_argument("baseline", help="The directory of the reference runs.")
+parser.add_argument("current", help="The directory of the new runs.")
+parser.add_argument(
+    "--threshold",
+    type=float,
+    default=0.05,
+    help="The relative change past which a metric regressed.",
+)
+parser.add_argument(
+    "--json",
+    type=str,
+    default=None,
+    help="Also write the comparison to this file.",
+)
+args = parser.parse_args()
+
+baseline = load(args.baseline)
+current = load(args.current)
+
+for name in sorted(baseline.keys() ^ current.keys()):
+    where = "baseline" if name in baseline else "current"
+    print(f"{name}: only in the {where} runs")
+
+changes = compare(baseline, current, args.threshold)
+for change in changes:
+    print(
+        "{:<40} {:<18} {:>14.4g} {:>14.4g} {:>+8.1%}{}".format(
+            change["name"],
+            change["metric"],
+            change["baseline"],
+            change["current"],
+            change["change"],
+            "  REGRESSION" if change["regression"] else "",
+        )
+    )
+
+if args.json:
+    with open(args.json, "w") as f:
+        json.dump(changes, f, indent=4)
+        f.write("\n")
+
+sys.exit(1 if any(change["regression"] for change in changes) else 0)
@@ -0,0 +1,209 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Run a gem5 configuration script and record the host cost of the simulation
+it performs, as JSON in the output directory.
+
+```
+gem5 host_metrics.py [--name NAME] [--output FILE] CONFIG [CONFIG_ARGS...]
+```
+
+The metrics are:
+
+* startup_seconds: host time from the creation of the gem5 process to the
+  first call to `m5.simulate()`, i.e., configuring and instantiating the
+  system.
+* simulate_seconds: host time spent in `m5.simulate()`.
+* sim_insts, sim_ticks and events: instructions committed by the CPUs (null
+  when there are none), ticks simulated and events processed during
+  `m5.simulate()`, along with their rates per simulate second.
+* peak_rss_bytes: the peak resident set size of the gem5 process.
+
+Any configuration script can be run this way, whether it uses the standard
+library or not, as the metrics are gathered around `m5.simulate()`.
+"""
+
+import argparse
+import json
+import os
+import platform
+import resource
+import runpy
+import sys
+import time
+
+import m5
+from m5.objects import Root
+
+from _m5 import core
+
+parser = argparse.ArgumentParser(
+    description="Run a gem5 configuration script and record the host time "
+    "and memory it needs."
+)
+parser.add_argument(
+    "--name",
+    type=str,
+    default=None,
+    help="The name of the run in the metrics. Defaults to the name of the "
+    "configuration script.",
+)
+parser.add_argument(
+    "--output",
+    type=str,
+    default="host_metrics.json",
+    help="The file to write the metrics to, relative to the output "
+    "directory.",
+)
+parser.add_argument("config", type=str, help="The configuration script.")
+parser.add_argument(
+    "config_args",
+    nargs=argparse.REMAINDER,
+    help="The arguments of the configuration script.",
+)
+args = parser.parse_args()
+
+
+def process_age():
+    """Host seconds since the creation of this process, or 0 when the
+    platform does not tell."""
+    try:
+        with open("/proc/self/stat") as f:
+            # The name of the command may contain spaces, the fields are
+            # counted from the end of it. starttime is field 22.
+            start = int(f.read().rsplit(")", 1)[1].split()[19])
+        with open("/proc/uptime") as f:
+            uptime = float(f.read().split()[0])
+        return max(uptime - start / os.sysconf("SC_CLK_TCK"), 0.0)
+    except (OSError, ValueError, IndexError):
+        return 0.0
+
+
+launch = time.monotonic() - process_age()
+
+
+def sim_insts():
+    try:
+        return int(Root.getInstance().resolveStat("simInsts").value)
+    except KeyError:
+        # There are no CPUs, e.g., in a traffic generator config.
+        return None
+
+
+def events_serviced():
+    return sum(queue["serviced"] for queue in m5.event.queue_stats())
+
+
+class Totals:
+    first_simulate = None
+    simulate_seconds = 0.0
+    sim_ticks = 0
+    sim_insts = None
+    events = 0
+
+
+totals = Totals()
+_simulate = m5.simulate
+
+
+def simulate(*args, **kwargs):
+    if totals.first_simulate is None:
+        totals.first_simulate = time.monotonic() - launch
+
+    insts = sim_insts()
+    events = events_serviced()
+    tick = m5.curTick()
+    start = time.monotonic()
+    try:
+        return _simulate(*args, **kwargs)
+    finally:
+        totals.simulate_seconds += time.monotonic() - start
+        totals.sim_ticks += m5.curTick() - tick
+        totals.events += events_serviced() - events
+        after = sim_insts()
+        if after is not None:
+            # The count restarts when the statistics are reset.
+            delta = after - insts if after >= insts else after
+            totals.sim_insts = (totals.sim_insts or 0) + delta
+
+
+m5.simulate = simulate
+
+
+def rate(count):
+    if count is None or totals.simulate_seconds == 0:
+        return None
+    return count / totals.simulate_seconds
+
+
+def write_metrics(exit_code):
+    # ru_maxrss is in KiB, except on macOS where it is in bytes.
+    peak_rss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    if sys.platform != "darwin":
+        peak_rss *= 1024
+
+    name = args.name or os.path.splitext(os.path.basename(args.config))[0]
+    metrics = {
+        "name": name,
+        "config": os.path.abspath(args.config),
+        "config_args": args.config_args,
+        "gem5_version": core.gem5Version,
+        "host": platform.node(),
+        "host_machine": platform.machine(),
+        "exit_code": exit_code,
+        "startup_seconds": totals.first_simulate,
+        "simulate_seconds": totals.simulate_seconds,
+        "total_seconds": time.monotonic() - launch,
+        "sim_insts": totals.sim_insts,
+        "sim_ticks": totals.sim_ticks,
+        "events": totals.events,
+        "insts_per_second": rate(totals.sim_insts),
+        "ticks_per_second": rate(totals.sim_ticks),
+        "events_per_second": rate(totals.events),
+        "peak_rss_bytes": peak_rss,
+    }
+
+    path = os.path.join(m5.options.outdir, args.output)
+    with open(path, "w") as f:
+        json.dump(metrics, f, indent=4)
+        f.write("\n")
+
+
+# Run the script the way gem5 would have run it.
+sys.argv = [args.config] + args.config_args
+sys.path[0] = os.path.dirname(os.path.abspath(args.config))
+
+exit_code = 1
+try:
+    runpy.run_path(args.config, run_name="__m5_main__")
+    exit_code = 0
+except SystemExit as e:
+    exit_code = e.code if isinstance(e.code, int) else int(e.code is not None)
+    raise
+finally:
+    write_metrics(exit_code)
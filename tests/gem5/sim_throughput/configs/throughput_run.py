@@ -0,0 +1,201 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+A RISC-V system whose CPU model, memory system, mode and number of cores
+are picked on the command line, for measuring the simulation throughput.
+
+In SE mode every core runs its own copy of a matrix multiplication, so that
+all of them are busy. In FS mode the cores boot Ubuntu. Either way, the
+simulation stops after the given number of ticks.
+
+Characteristics
+---------------
+
+* Runs exclusively on the RISC-V ISA.
+* Meant to be run through host_metrics.py.
+"""
+
+import argparse
+
+from m5.objects import Process
+
+from gem5.coherence_protocol import CoherenceProtocol
+from gem5.components.boards.riscv_board import RiscvBoard
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.memory import DualChannelDDR4_2400
+from gem5.components.processors.cpu_types import get_cpu_type_from_str
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import ISA
+from gem5.resources.resource import obtain_resource
+from gem5.simulate.simulator import Simulator
+from gem5.utils.requires import requires
+
+parser = argparse.ArgumentParser(
+    description="A RISC-V system for measuring the simulation throughput."
+)
+parser.add_argument(
+    "-c",
+    "--cpu",
+    type=str,
+    choices=("atomic", "timing", "minor", "o3"),
+    required=True,
+    help="The CPU model.",
+)
+parser.add_argument(
+    "-m",
+    "--mem-system",
+    type=str,
+    choices=("classic", "mesi_two_level", "chi"),
+    required=True,
+    help="The memory system.",
+)
+parser.add_argument(
+    "--mode",
+    type=str,
+    choices=("se", "fs"),
+    required=True,
+    help="Whether to run a program in SE mode or to boot Linux.",
+)
+parser.add_argument(
+    "-n",
+    "--num-cores",
+    type=int,
+    default=1,
+    help="The number of cores.",
+)
+parser.add_argument(
+    "-t",
+    "--max-ticks",
+    type=int,
+    required=True,
+    help="The number of ticks to simulate.",
+)
+parser.add_argument(
+    "-r",
+    "--resource-directory",
+    type=str,
+    required=False,
+    default=None,
+    help="The directory in which resources will be downloaded or exist.",
+)
+
+args = parser.parse_args()
+
+protocols = {
+    "classic": None,
+    "mesi_two_level": CoherenceProtocol.MESI_TWO_LEVEL,
+    "chi": CoherenceProtocol.CHI,
+}
+
+requires(
+    isa_required=ISA.RISCV,
+    coherence_protocol_required=protocols[args.mem_system],
+)
+
+if args.mem_system == "classic":
+    from gem5.components.cachehierarchies.classic.private_l1_private_l2_walk_cache_hierarchy import (
+        PrivateL1PrivateL2WalkCacheHierarchy,
+    )
+
+    cache_hierarchy = PrivateL1PrivateL2WalkCacheHierarchy(
+        l1d_size="32KiB", l1i_size="32KiB", l2_size="512KiB"
+    )
+elif args.mem_system == "mesi_two_level":
+    from gem5.components.cachehierarchies.ruby.mesi_two_level_cache_hierarchy import (
+        MESITwoLevelCacheHierarchy,
+    )
+
+    cache_hierarchy = MESITwoLevelCacheHierarchy(
+        l1d_size="32KiB",
+        l1d_assoc=8,
+        l1i_size="32KiB",
+        l1i_assoc=8,
+        l2_size="512KiB",
+        l2_assoc=16,
+        num_l2_banks=1,
+    )
+else:
+    from gem5.components.cachehierarchies.chi.private_l1_cache_hierarchy import (
+        PrivateL1CacheHierarchy,
+    )
+
+    cache_hierarchy = PrivateL1CacheHierarchy(size="32KiB", assoc=8)
+
+processor = SimpleProcessor(
+    cpu_type=get_cpu_type_from_str(args.cpu),
+    isa=ISA.RISCV,
+    num_cores=args.num_cores,
+)
+
+if args.mode == "se":
+    board = SimpleBoard(
+        clk_freq="1GHz",
+        processor=processor,
+        memory=DualChannelDDR4_2400(size="2GiB"),
+        cache_hierarchy=cache_hierarchy,
+    )
+
+    binary = obtain_resource(
+        "riscv-matrix-multiply",
+        resource_directory=args.resource_directory,
+        resource_version="1.0.0",
+    )
+    board.set_se_binary_workload(binary)
+
+    # set_se_binary_workload() gives the same process, with a single
+    # thread, to all the cores. Start one process per core instead.
+    for i, core in enumerate(processor.get_cores()):
+        process = Process(pid=100 + i)
+        process.executable = binary.get_local_path()
+        process.cmd = [binary.get_local_path()]
+        core.set_workload(process)
+else:
+    board = RiscvBoard(
+        clk_freq="1GHz",
+        processor=processor,
+        memory=DualChannelDDR4_2400(size="4GiB"),
+        cache_hierarchy=cache_hierarchy,
+    )
+
+    board.set_workload(
+        obtain_resource(
+            "riscv-ubuntu-20.04-boot",
+            resource_directory=args.resource_directory,
+            resource_version="3.0.0",
+        )
+    )
+
+simulator = Simulator(board=board)
+simulator.set_max_ticks(args.max_ticks)
+simulator.run()
+
+print(
+    "Exiting @ tick {} because {}.".format(
+        simulator.get_current_tick(), simulator.get_last_exit_event_cause()
+    )
+)
@@ -0,0 +1,139 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Measures the simulation throughput and the host cost of gem5 for a range of
+systems. Each run writes host_metrics.json to its output directory in the
+testing results (see README.md), to be compared between versions with
+compare_host_metrics.py.
+
+The runs only fail if gem5 does: the metrics depend on the host too much to
+be checked against fixed references.
+"""
+
+from testlib import *
+
+if config.bin_path:
+    resource_path = config.bin_path
+else:
+    resource_path = joinpath(absdirpath(__file__), "..", "resources")
+
+config_dir = joinpath(
+    config.base_dir, "tests", "gem5", "sim_throughput", "configs"
+)
+host_metrics = joinpath(config_dir, "host_metrics.py")
+throughput_run = joinpath(config_dir, "throughput_run.py")
+
+
+def test_throughput(name, config_path, config_args, length, **kwargs):
+    gem5_verify_config(
+        name=f"sim-throughput-{name}",
+        verifiers=(),
+        fixtures=(),
+        config=host_metrics,
+        config_args=["--name", name, config_path] + config_args,
+        length=length,
+        **kwargs,
+    )
+
+
+# Simulated time of each run, long enough for the rate to settle past the
+# start of the workload.
+max_ticks = {"se": 10_000_000_000, "fs": 50_000_000_000}
+
+for cpu in ("atomic", "timing", "minor", "o3"):
+    for mem_system in ("classic", "mesi_two_level", "chi"):
+        # Ruby only supports timing accesses.
+        if cpu == "atomic" and mem_system != "classic":
+            continue
+        for mode in ("se", "fs"):
+            for num_cores in (1, 4, 16, 64):
+                test_throughput(
+                    name=f"{cpu}-{mem_system}-{mode}-{num_cores}c",
+                    config_path=throughput_run,
+                    config_args=[
+                        "--cpu",
+                        cpu,
+                        "--mem-system",
+                        mem_system,
+                        "--mode",
+                        mode,
+                        "--num-cores",
+                        str(num_cores),
+                        "--max-ticks",
+                        str(max_ticks[mode]),
+                        "--resource-directory",
+                        resource_path,
+                    ],
+                    valid_isas=(constants.all_compiled_tag,),
+                    valid_hosts=constants.supported_hosts,
+                    length=(
+                        constants.long_tag
+                        if num_cores == 1
+                        else constants.very_long_tag
+                    ),
+                )
+
+# The network alone, without any CPU.
+for rows, cpus in ((4, 16), (8, 64)):
+    test_throughput(
+        name=f"garnet-mesh-{cpus}",
+        config_path=joinpath(
+            config.base_dir, "configs", "example", "garnet_synth_traffic.py"
+        ),
+        config_args=[
+            "--network=garnet",
+            "--topology=Mesh_XY",
+            f"--mesh-rows={rows}",
+            f"--num-cpus={cpus}",
+            f"--num-dirs={cpus}",
+            "--synthetic=uniform_random",
+            "--injectionrate=0.1",
+            "--sim-cycles=1000000",
+        ],
+        valid_isas=(constants.null_tag,),
+        valid_hosts=constants.supported_hosts,
+        length=constants.long_tag,
+    )
+
+test_throughput(
+    name="gpu-apu-se-square",
+    config_path=joinpath(config.base_dir, "configs", "example", "apu_se.py"),
+    config_args=[
+        "--download-resource",
+        "square-gpu-test",
+        "--download-dir",
+        resource_path,
+        "--reg-alloc-policy=dynamic",
+        "-n3",
+        "-c",
+        joinpath(resource_path, "square-gpu-test"),
+    ],
+    valid_isas=(constants.vega_x86_tag,),
+    valid_hosts=(constants.host_gcn_gpu_tag,),
+    length=constants.long_tag,
+)
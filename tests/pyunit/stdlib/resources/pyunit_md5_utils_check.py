@@ -31,6 +31,8 @@ import unittest
 from pathlib import Path
 
 from gem5.resources.md5_utils import (
+    get_cached_md5,
+    md5_cached,
     md5_dir,
     md5_file,
 )
@@ -116,3 +118,45 @@ class MD5DirTestSuite(unittest.TestCase):
         shutil.rmtree(dir2)
 
         self.assertEqual(first_md5, second_md5)
+
+
+class MD5CachedTestSuite(unittest.TestCase):
+    """Test cases for gem5.resources.md5_utils.md5_cached()"""
+
+    def setUp(self) -> None:
+        self.dir = Path(tempfile.mkdtemp())
+
+    def tearDown(self) -> None:
+        shutil.rmtree(self.dir)
+
+    def test_fileValueIsRecorded(self) -> None:
+        file = self.dir / "file"
+        file.write_text("This is a test string, to be put in a temp file")
+
+        self.assertIsNone(get_cached_md5(file))
+        md5 = md5_cached(file)
+        self.assertEqual("b113b29fce251f2023066c3fda2ec9dd", md5)
+        self.assertTrue((self.dir / "file.md5cache").is_file())
+        self.assertEqual(md5, get_cached_md5(file))
+        self.assertEqual(md5, md5_cached(file))
+
+    def test_fileChangeInvalidates(self) -> None:
+        file = self.dir / "file"
+        file.write_text("Some test data")
+        md5_cached(file)
+
+        file.write_text("Some other test data")
+        self.assertIsNone(get_cached_md5(file))
+        self.assertEqual(md5_file(file), md5_cached(file))
+
+    def test_dirChangeInvalidates(self) -> None:
+        dir = self.dir / "dir"
+        os.mkdir(dir)
+        (dir / "file1").write_text("Some test data here")
+        md5 = md5_cached(dir)
+        self.assertEqual(md5_dir(dir), md5)
+        self.assertEqual(md5, get_cached_md5(dir))
+
+        os.mkdir(dir / "dir2")
+        self.assertIsNone(get_cached_md5(dir))
+        self.assertEqual(md5_dir(dir), md5_cached(dir))
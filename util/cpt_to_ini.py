@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Convert a binary checkpoint file (see src/sim/binary_checkpoint.hh) to
+the INI text format, e.g., to inspect it or to use it with tools such as
+cpt_upgrader.py. The text is the same as if gem5 had written a text
+checkpoint.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = b"gem5cpt\0"
+VERSION = 1
+
+# Struct format characters of the entry types, in the order of
+# binary_checkpoint::Type. Text entries are stored as is.
+TYPES = [None, "?", "b", "B", "h", "H", "i", "I", "q", "Q", "f", "d"]
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def get(self, fmt):
+        values = struct.unpack_from("=" + fmt, self.data, self.offset)
+        self.offset += struct.calcsize("=" + fmt)
+        return values
+
+    def get_string(self):
+        (size,) = self.get("Q")
+        start = self.offset
+        self.offset += size
+        if self.offset > len(self.data):
+            raise ValueError("truncated checkpoint")
+        return self.data[start : self.offset]
+
+
+def show(value):
+    if isinstance(value, bool):
+        return "true" if value else "false"
+    if isinstance(value, float):
+        return "%g" % value
+    return str(value)
+
+
+def convert(data, out):
+    reader = Reader(data)
+    if data[: len(MAGIC)] != MAGIC:
+        raise ValueError("not a binary checkpoint")
+    reader.offset = len(MAGIC)
+    version, num_sections = reader.get("II")
+    if version != VERSION:
+        raise ValueError(f"unsupported checkpoint version {version}")
+
+    for _ in range(num_sections):
+        section = reader.get_string().decode()
+        out.write(f"\n[{section}]\n")
+        (num_entries,) = reader.get("I")
+        for _ in range(num_entries):
+            name = reader.get_string().decode()
+            type_id, count = reader.get("BQ")
+            data = reader.get_string()
+            if TYPES[type_id] is None:
+                value = data.decode()
+            else:
+                values = struct.unpack(f"={count}{TYPES[type_id]}", data)
+                value = " ".join(show(v) for v in values)
+            out.write(f"{name}={value}\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("checkpoint", help="binary checkpoint file (m5.cpt)")
+    parser.add_argument(
+        "-o", "--output", help="output file (default: standard output)"
+    )
+    args = parser.parse_args()
+
+    with open(args.checkpoint, "rb") as f:
+        data = f.read()
+
+    if args.output:
+        with open(args.output, "w") as out:
+            convert(data, out)
+    else:
+        convert(data, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
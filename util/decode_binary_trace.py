@@ -0,0 +1,392 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Format a binary debug trace recorded with --debug-binary.
+
+The output matches what gem5 prints with the text logger. Records from
+different simulator threads are stored in the order their buffers were
+written, use --sort to order the output by tick.
+
+Example:
+
+    gem5.opt --debug-flags=Cache --debug-binary --debug-file=trace.bin \\
+        config.py
+    util/decode_binary_trace.py --flags m5out/trace.bin > trace.txt
+"""
+
+import argparse
+import gzip
+import math
+import struct
+import sys
+
+MAGIC = b"gem5trc\0"
+VERSION = 1
+MAX_TICK = 2**64 - 1
+
+
+class Arg:
+    """A recorded DPRINTF argument, see trace::RawArg"""
+
+    def __init__(self, kind, value):
+        self.kind = kind
+        self.value = value
+
+    def to_int(self):
+        if self.kind in "iucCp":
+            return self.value
+        return 0
+
+
+def read_trace(f):
+    """Yield (tick, name, flag, fmt, args) for every record. Messages
+    that were formatted when recorded have a fmt of None and the
+    message in args."""
+
+    if f.read(len(MAGIC)) != MAGIC:
+        sys.exit("Not a binary gem5 debug trace")
+    version, bom = struct.unpack("<II", f.read(8))
+    order = "<" if bom == 0x01020304 else ">"
+    if order == ">":
+        (version,) = struct.unpack(">I", struct.pack("<I", version))
+    if version != VERSION:
+        sys.exit(f"Unsupported trace version {version}")
+
+    data = f.read()
+    pos = 0
+
+    def unpack(fmt):
+        nonlocal pos
+        values = struct.unpack_from(order + fmt, data, pos)
+        pos += struct.calcsize(order + fmt)
+        return values
+
+    def string():
+        nonlocal pos
+        (length,) = unpack("I")
+        pos += length
+        return data[pos - length : pos]
+
+    # Strings can be defined by another thread's buffer after they are
+    # first used, so collect every definition before decoding records.
+    strings = {}
+    records = []
+    while pos < len(data):
+        kind = data[pos : pos + 1]
+        pos += 1
+        if kind == b"N":
+            (sid,) = unpack("I")
+            strings[sid] = string().decode(errors="replace")
+        elif kind == b"R":
+            records.append((kind,) + unpack("QIII") + (string(),))
+        elif kind == b"M":
+            records.append((kind,) + unpack("QII") + (string(),))
+        else:
+            sys.exit(f"Corrupted trace, unknown record {kind!r}")
+
+    for record in records:
+        kind, tick, name, flag = record[:4]
+        if kind == b"R":
+            fmt = strings[record[4]]
+            args = decode_args(record[5], order)
+        else:
+            fmt = None
+            args = record[4].decode(errors="replace")
+        yield tick, strings[name], strings[flag], fmt, args
+
+
+def decode_args(data, order):
+    args = []
+    pos = 0
+    while pos < len(data):
+        kind = chr(data[pos])
+        pos += 1
+        if kind in "cC":
+            fmt = "b" if kind == "c" else "B"
+            (value,) = struct.unpack_from(fmt, data, pos)
+            pos += 1
+        elif kind == "s":
+            (length,) = struct.unpack_from(order + "I", data, pos)
+            pos += 4
+            value = data[pos : pos + length].decode(errors="replace")
+            pos += length
+        else:
+            fmt = {"i": "q", "u": "Q", "p": "Q", "f": "d"}[kind]
+            (value,) = struct.unpack_from(order + fmt, data, pos)
+            pos += 8
+        args.append(Arg(kind, value))
+    return args
+
+
+def stream_str(arg, state):
+    """What operator<< prints for an argument with default flags"""
+    if arg.kind in "cC":
+        return chr(arg.value & 0xFF)
+    if arg.kind == "p":
+        return hex(arg.value)
+    if arg.kind == "f":
+        return format_float(arg.value, "g", state["precision"])
+    return str(arg.value)
+
+
+def format_float(value, conv, precision):
+    if math.isnan(value):
+        return "nan"
+    if math.isinf(value):
+        return "inf" if value > 0 else "-inf"
+    return f"{value:.{precision}{conv}}"
+
+
+def pad(text, spec, zero=False):
+    width = spec["width"]
+    if len(text) >= width:
+        return text
+    if spec["left"] and not zero:
+        return text + " " * (width - len(text))
+    if zero:
+        sign = text[0] if text[:1] in "+-" else ""
+        body = text[len(sign) :]
+        return sign + "0" * (width - len(text)) + body
+    return " " * (width - len(text)) + text
+
+
+def format_integer(arg, spec, state):
+    if arg.kind not in "iucCp":
+        return pad(stream_str(arg, state), spec)
+
+    value = arg.value
+    prefix = ""
+    if spec["base"] == 16:
+        digits = f"{value & (2**64 - 1) if value < 0 else value:x}"
+        if spec["alt"] and value != 0:
+            prefix = "0x"
+    elif spec["base"] == 8:
+        digits = f"{value & (2**64 - 1) if value < 0 else value:o}"
+        if spec["alt"] and value != 0:
+            prefix = "0"
+    else:
+        digits = str(abs(value))
+        if value < 0:
+            prefix = "-"
+        elif spec["sign"]:
+            prefix = "+"
+    if spec["upper"]:
+        digits = digits.upper()
+        prefix = prefix.upper()
+
+    if spec["zero"]:
+        width = spec["width"] - len(prefix)
+        return prefix + digits.rjust(width, "0")
+    return pad(prefix + digits, spec)
+
+
+def format_arg(arg, spec, state):
+    conv = spec["conv"]
+    if conv == "c":
+        if arg.kind in "iucC":
+            return chr(arg.value & 0xFF)
+        return stream_str(arg, state)
+    if conv == "d":
+        return format_integer(arg, spec, state)
+    if conv == "f":
+        if arg.kind != "f":
+            return "<bad arg type for float format>"
+        # Like _formatFloat(), a precision sticks to the stream for the
+        # rest of the message.
+        style = "g"
+        precision = spec["precision"]
+        if precision != -1:
+            if spec["float"] == "scientific" and precision == 0:
+                precision = 1
+            elif spec["float"] == "scientific":
+                style = "e"
+            elif spec["float"] == "fixed":
+                style = "f"
+            state["precision"] = precision
+        text = format_float(arg.value, style, state["precision"])
+        if spec["upper"]:
+            text = text.upper()
+        return pad(text, spec, spec["zero"])
+    if conv == "s":
+        return pad(stream_str(arg, state), spec)
+    return "<bad format>"
+
+
+def parse_spec(fmt, pos):
+    """Parse a format specification starting after its '%', following
+    cp::Print::processFlag()."""
+    spec = {
+        "alt": False,
+        "left": False,
+        "sign": False,
+        "zero": False,
+        "upper": False,
+        "base": 10,
+        "conv": None,
+        "float": "best",
+        "width": 0,
+        "precision": -1,
+        "get_width": False,
+        "get_precision": False,
+    }
+    have_precision = False
+    number = 0
+    while pos < len(fmt):
+        c = fmt[pos]
+        pos += 1
+        if c.isdigit() and not (c == "0" and number == 0):
+            number = number * 10 + int(c)
+            continue
+        if number:
+            spec["precision" if have_precision else "width"] = number
+            number = 0
+
+        if c in "sc":
+            spec["conv"] = c
+        elif c in "hlqLjzt":
+            continue
+        elif c == "p":
+            spec.update(conv="d", base=16, alt=True)
+        elif c in "xX":
+            spec.update(conv="d", base=16, upper=c == "X")
+        elif c == "o":
+            spec.update(conv="d", base=8)
+        elif c in "diu":
+            spec["conv"] = "d"
+        elif c in "gG":
+            spec.update(conv="f", float="best", upper=c == "G")
+        elif c in "eE":
+            spec.update(conv="f", float="scientific", upper=c == "E")
+        elif c == "f":
+            spec.update(conv="f", float="fixed")
+        elif c == "#":
+            spec["alt"] = True
+            continue
+        elif c == "-":
+            spec["left"] = True
+            continue
+        elif c == "+":
+            spec["sign"] = True
+            continue
+        elif c == " ":
+            continue
+        elif c == ".":
+            spec["precision"] = 0
+            have_precision = True
+            continue
+        elif c == "0":
+            spec["zero"] = True
+            continue
+        elif c == "*":
+            spec["get_precision" if have_precision else "get_width"] = True
+            continue
+        break
+
+    if spec["conv"] == "d" and have_precision:
+        spec["width"] = spec["precision"]
+        spec["zero"] = True
+    elif spec["conv"] == "f" and not have_precision and spec["zero"]:
+        spec["precision"] = spec["width"]
+    return spec, pos
+
+
+def cprintf(fmt, args):
+    """Format a message the way cprintf() does"""
+    out = []
+    pos = 0
+    args = list(args)
+    state = {"precision": 6}
+    while pos < len(fmt):
+        start = fmt.find("%", pos)
+        if start == -1:
+            out.append(fmt[pos:])
+            break
+        out.append(fmt[pos:start])
+        if fmt[start + 1 : start + 2] == "%":
+            out.append("%")
+            pos = start + 2
+            continue
+        if not args:
+            out.append("<extra arg>%")
+            pos = start + 2
+            continue
+
+        spec, pos = parse_spec(fmt, start + 1)
+        if spec["get_width"] and args:
+            spec["width"] = args.pop(0).to_int()
+        if spec["get_precision"] and args:
+            spec["precision"] = args.pop(0).to_int()
+        if args:
+            out.append(format_arg(args.pop(0), spec, state))
+
+    out += ["<bad format>"] * len(args)
+    return "".join(out).replace("\r\n", "\n").replace("\r", "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Format a binary gem5 debug trace as text."
+    )
+    parser.add_argument("trace", help="Trace file, optionally gzipped")
+    parser.add_argument(
+        "--flags",
+        action="store_true",
+        help="Prefix messages with their debug flag, like FmtFlag",
+    )
+    parser.add_argument(
+        "--no-ticks",
+        action="store_true",
+        help="Do not print ticks, like FmtTicksOff",
+    )
+    parser.add_argument(
+        "--sort",
+        action="store_true",
+        help="Sort messages by tick across simulator threads",
+    )
+    args = parser.parse_args()
+
+    opener = gzip.open if args.trace.endswith(".gz") else open
+    with opener(args.trace, "rb") as f:
+        records = read_trace(f)
+        if args.sort:
+            records = sorted(records, key=lambda r: r[0])
+
+        out = sys.stdout
+        for tick, name, flag, fmt, values in records:
+            if not args.no_ticks and tick != MAX_TICK:
+                out.write(f"{tick:7d}: ")
+            if args.flags and flag:
+                out.write(f"{flag}: ")
+            if name:
+                out.write(f"{name}: ")
+            out.write(values if fmt is None else cprintf(fmt, values))
+
+
+if __name__ == "__main__":
+    main()
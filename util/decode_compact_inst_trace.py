@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Decode the compact instruction traces written by the CompactInstTrace
+instruction tracer (see src/cpu/compact_inst_trace.hh).
+
+The script can be used on its own to print a trace as text, or
+imported as a library:
+
+    from decode_compact_inst_trace import CompactInstTraceReader
+
+    reader = CompactInstTraceReader("m5out/insts.cit")
+    for inst in reader:
+        print(hex(inst.pc), reader.op_classes[inst.op_class])
+
+Blocks are independent from each other. Use blocks() and
+decode_block() to split the decoding of a large trace across several
+processes.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+from typing import (
+    BinaryIO,
+    Iterator,
+    List,
+    NamedTuple,
+    Optional,
+    Tuple,
+)
+
+MAGIC = b"gem5cit\0"
+VERSION = 1
+
+# Record flags, see CompactInstTrace::Flags
+SAME_PC_DELTA = 0x1
+HAS_REGS = 0x2
+HAS_MEM = 0x4
+NEW_THREAD = 0x8
+
+CODEC_RAW = 0
+CODEC_DEFLATE = 1
+
+MASK64 = 2**64 - 1
+
+
+class Inst(NamedTuple):
+    pc: int
+    op_class: int
+    tid: int
+    tick: Optional[int]
+    # (register class, register index) of every register written
+    regs: List[Tuple[int, int]]
+    # (address, size) of every memory access
+    mem: List[Tuple[int, int]]
+
+
+def _varint(data: bytes, pos: int) -> Tuple[int, int]:
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def _zigzag(data: bytes, pos: int) -> Tuple[int, int]:
+    value, pos = _varint(data, pos)
+    return (value >> 1) ^ -(value & 1), pos
+
+
+def _string(f: BinaryIO) -> str:
+    length = _read_varint(f)
+    return f.read(length).decode()
+
+
+def _read_varint(f: BinaryIO) -> int:
+    value = 0
+    shift = 0
+    while True:
+        byte = f.read(1)[0]
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value
+        shift += 7
+
+
+class CompactInstTraceReader:
+    def __init__(self, filename: str):
+        self.filename = filename
+        with open(filename, "rb") as f:
+            self._read_header(f)
+            self._data_start = f.tell()
+
+    def _read_header(self, f: BinaryIO) -> None:
+        if f.read(len(MAGIC)) != MAGIC:
+            raise ValueError(f"{self.filename} is not a compact inst trace")
+        version, flags = struct.unpack("<II", f.read(8))
+        if version != VERSION:
+            raise ValueError(f"Unsupported trace version {version}")
+        self.has_ticks = bool(flags & 1)
+        self.op_classes = [_string(f) for _ in range(_read_varint(f))]
+        self.reg_classes = [_string(f) for _ in range(_read_varint(f))]
+
+    def blocks(self) -> Iterator[Tuple[int, bytes]]:
+        """Yield the record count and the raw records of every block"""
+        with open(self.filename, "rb") as f:
+            f.seek(self._data_start)
+            while True:
+                header = f.read(13)
+                if not header:
+                    return
+                records, raw_size, stored_size, codec = struct.unpack(
+                    "<IIIB", header
+                )
+                payload = f.read(stored_size)
+                if codec == CODEC_DEFLATE:
+                    payload = zlib.decompress(payload)
+                elif codec != CODEC_RAW:
+                    raise ValueError(f"Unknown block codec {codec}")
+                if len(payload) != raw_size:
+                    raise ValueError("Truncated or corrupted block")
+                yield records, payload
+
+    def decode_block(self, records: int, data: bytes) -> List[Inst]:
+        """Decode the records of a block"""
+        insts = []
+        pos = 0
+        pc = pc_delta = addr = tick = tid = 0
+        for _ in range(records):
+            flags, pos = _varint(data, pos)
+            op_class, pos = _varint(data, pos)
+            if not flags & SAME_PC_DELTA:
+                pc_delta, pos = _zigzag(data, pos)
+            pc = (pc + pc_delta) & MASK64
+            if flags & NEW_THREAD:
+                tid, pos = _varint(data, pos)
+            inst_tick = None
+            if self.has_ticks:
+                delta, pos = _varint(data, pos)
+                tick += delta
+                inst_tick = tick
+
+            regs = []
+            if flags & HAS_REGS:
+                groups, pos = _varint(data, pos)
+                for _ in range(groups):
+                    reg_class, pos = _varint(data, pos)
+                    word, pos = _varint(data, pos)
+                    mask, pos = _varint(data, pos)
+                    regs += [
+                        (reg_class, word * 64 + bit)
+                        for bit in range(64)
+                        if mask & (1 << bit)
+                    ]
+
+            mem = []
+            if flags & HAS_MEM:
+                accesses, pos = _varint(data, pos)
+                for _ in range(accesses):
+                    delta, pos = _zigzag(data, pos)
+                    size, pos = _varint(data, pos)
+                    addr = (addr + delta) & MASK64
+                    mem.append((addr, size))
+
+            insts.append(Inst(pc, op_class, tid, inst_tick, regs, mem))
+        return insts
+
+    def __iter__(self) -> Iterator[Inst]:
+        for records, data in self.blocks():
+            yield from self.decode_block(records, data)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Print a compact gem5 instruction trace as text."
+    )
+    parser.add_argument("trace", help="Trace file")
+    parser.add_argument(
+        "--count",
+        action="store_true",
+        help="Only print the number of instructions",
+    )
+    args = parser.parse_args()
+
+    reader = CompactInstTraceReader(args.trace)
+    if args.count:
+        print(sum(records for records, _ in reader.blocks()))
+        return
+
+    out = sys.stdout
+    for inst in reader:
+        line = []
+        if inst.tick is not None:
+            line.append(f"{inst.tick:7d}:")
+        op_class = reader.op_classes[inst.op_class]
+        line.append(f"T{inst.tid} {inst.pc:#x} {op_class}")
+        for reg_class, index in inst.regs:
+            line.append(f"{reader.reg_classes[reg_class]}[{index}]")
+        for addr, size in inst.mem:
+            line.append(f"mem {addr:#x}/{size}")
+        out.write(" ".join(line) + "\n")
+
+
+if __name__ == "__main__":
+    main()
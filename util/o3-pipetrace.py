@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+"""
+Convert the binary pipeline traces written by the PipeTrace probe
+listener of the O3 CPU (see src/cpu/o3/probe/pipe_trace.hh) for the
+Konata pipeline viewer.
+
+Traces compressed with zstd or LZ4 are read if the zstandard or lz4
+Python packages are installed.
+
+The reader can also be used as a library:
+
+    from importlib import import_module
+    reader = import_module("o3-pipetrace").PipeTraceReader("pipetrace.bin")
+    for inst in reader:
+        print(inst.seq_num, inst.disasm, inst.ticks)
+"""
+
+import argparse
+import struct
+import sys
+from typing import (
+    Dict,
+    Iterator,
+    List,
+    NamedTuple,
+    Optional,
+    TextIO,
+    Tuple,
+)
+
+MAGIC = b"gem5pip\0"
+VERSION = 1
+
+# Record flags, see PipeTrace::Flags
+SQUASHED = 0x1
+NEW_DISASM = 0x2
+NEW_THREAD = 0x4
+
+MASK64 = 2**64 - 1
+
+# Stage names shown by Konata
+KONATA_STAGES = {
+    "fetch": "F",
+    "decode": "Dc",
+    "rename": "Rn",
+    "dispatch": "Ds",
+    "issue": "Is",
+    "complete": "Cm",
+    "retire": "Rt",
+}
+
+
+class Inst(NamedTuple):
+    seq_num: int
+    tid: int
+    pc: int
+    upc: int
+    disasm: str
+    squashed: bool
+    # Tick of every stage the instruction went through, None otherwise
+    ticks: List[Optional[int]]
+
+
+def _open(filename: str) -> bytes:
+    with open(filename, "rb") as f:
+        data = f.read()
+    if filename.endswith(".zst"):
+        import zstandard
+
+        return zstandard.ZstdDecompressor().decompressobj().decompress(data)
+    if filename.endswith(".lz4"):
+        import lz4.frame
+
+        return lz4.frame.decompress(data)
+    return data
+
+
+def _varint(data: bytes, pos: int) -> Tuple[int, int]:
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def _zigzag(data: bytes, pos: int) -> Tuple[int, int]:
+    value, pos = _varint(data, pos)
+    return (value >> 1) ^ -(value & 1), pos
+
+
+def _string(data: bytes, pos: int) -> Tuple[str, int]:
+    length, pos = _varint(data, pos)
+    return data[pos : pos + length].decode(), pos + length
+
+
+class PipeTraceReader:
+    def __init__(self, filename: str):
+        self.filename = filename
+        self._data = _open(filename)
+        data = self._data
+        if data[: len(MAGIC)] != MAGIC:
+            raise ValueError(f"{filename} is not an O3 pipeline trace")
+        pos = len(MAGIC)
+        version, self.clock_period = struct.unpack_from("<IQ", data, pos)
+        if version != VERSION:
+            raise ValueError(f"Unsupported trace version {version}")
+        pos += 12
+        count, pos = _varint(data, pos)
+        self.stages = []
+        for _ in range(count):
+            name, pos = _string(data, pos)
+            self.stages.append(name)
+        self._records_start = pos
+
+    def __iter__(self) -> Iterator[Inst]:
+        data = self._data
+        pos = self._records_start
+        disasms: Dict[int, str] = {}
+        seq_num = pc = fetch = tid = 0
+        num_stages = len(self.stages)
+        while pos < len(data):
+            flags, pos = _varint(data, pos)
+            disasm_id, pos = _varint(data, pos)
+            if flags & NEW_DISASM:
+                disasms[disasm_id], pos = _string(data, pos)
+            delta, pos = _zigzag(data, pos)
+            seq_num = (seq_num + delta) & MASK64
+            delta, pos = _zigzag(data, pos)
+            pc = (pc + delta) & MASK64
+            delta, pos = _zigzag(data, pos)
+            fetch = (fetch + delta) & MASK64
+            upc, pos = _varint(data, pos)
+            if flags & NEW_THREAD:
+                tid, pos = _varint(data, pos)
+
+            ticks: List[Optional[int]] = [fetch] + [None] * (num_stages - 1)
+            stages, pos = _varint(data, pos)
+            for i in range(1, num_stages):
+                if stages & (1 << i):
+                    delta, pos = _varint(data, pos)
+                    ticks[i] = fetch + delta
+
+            yield Inst(
+                seq_num,
+                tid,
+                pc,
+                upc,
+                disasms[disasm_id],
+                bool(flags & SQUASHED),
+                ticks,
+            )
+
+
+def write_konata(
+    reader: PipeTraceReader, insts: List[Inst], out: TextIO
+) -> None:
+    """Write instructions in the Kanata 0004 log format"""
+    period = reader.clock_period
+    stage_names = [KONATA_STAGES.get(s, s) for s in reader.stages]
+
+    # (cycle, order, line) of every command, sorted by cycle below. The
+    # order keeps the commands of an instruction in sequence.
+    commands = []
+    retired = 0
+    for uid, inst in enumerate(insts):
+        stages = [
+            (tick // period, name)
+            for tick, name in zip(inst.ticks, stage_names)
+            if tick is not None
+        ]
+        start = stages[0][0]
+        label = f"{inst.pc:#x}"
+        if inst.upc:
+            label += f".{inst.upc}"
+        label += f": {inst.disasm}"
+        commands.append(
+            (start, uid, 0, f"I\t{uid}\t{inst.seq_num}\t{inst.tid}")
+        )
+        commands.append((start, uid, 1, f"L\t{uid}\t0\t{label}"))
+        for i, (cycle, name) in enumerate(stages):
+            commands.append((cycle, uid, 2 + i, f"S\t{uid}\t0\t{name}"))
+        end = stages[-1][0] + 1
+        if inst.squashed:
+            commands.append((end, uid, 99, f"R\t{uid}\t{uid}\t1"))
+        else:
+            commands.append((end, uid, 99, f"R\t{uid}\t{retired}\t0"))
+            retired += 1
+    commands.sort()
+
+    out.write("Kanata\t0004\n")
+    cycle = commands[0][0] if commands else 0
+    out.write(f"C=\t{cycle}\n")
+    for when, _, _, line in commands:
+        if when != cycle:
+            out.write(f"C\t{when - cycle}\n")
+            cycle = when
+        out.write(line + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert an O3 pipeline trace for the Konata viewer."
+    )
+    parser.add_argument("trace", help="Trace file")
+    parser.add_argument(
+        "-o",
+        "--output",
+        default="-",
+        help="Konata log to write [Default: standard output]",
+    )
+    parser.add_argument(
+        "--start",
+        type=int,
+        default=0,
+        help="Skip the instructions fetched before this tick",
+    )
+    parser.add_argument(
+        "--count",
+        type=int,
+        default=None,
+        help="Only convert this many instructions",
+    )
+    parser.add_argument(
+        "--no-squashed",
+        action="store_true",
+        help="Leave the squashed instructions out",
+    )
+    args = parser.parse_args()
+
+    reader = PipeTraceReader(args.trace)
+    insts = []
+    for inst in reader:
+        if inst.ticks[0] < args.start:
+            continue
+        if args.no_squashed and inst.squashed:
+            continue
+        insts.append(inst)
+
+    # Records are written when instructions leave the pipeline, order
+    # them like they entered it.
+    insts.sort(key=lambda inst: (inst.ticks[0], inst.seq_num))
+    if args.count is not None:
+        insts = insts[: args.count]
+
+    if args.output == "-":
+        write_konata(reader, insts, sys.stdout)
+    else:
+        with open(args.output, "w") as out:
+            write_konata(reader, insts, out)
+
+
+if __name__ == "__main__":
+    main()
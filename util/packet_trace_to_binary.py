@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script converts protobuf packet traces, such as the ones recorded
+# by a MemTraceProbe attached to a CommMonitor, to the binary packet trace
+# format that the TraceGen state of the traffic generators memory maps. See
+# TraceGen::BinaryHeader in src/cpu/testers/traffic_gen/trace_gen.hh.
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+
+import protolib
+
+util_dir = os.path.dirname(os.path.realpath(__file__))
+# Make sure the proto definitions are up to date.
+subprocess.check_call(["make", "--quiet", "-C", util_dir, "packet_pb2.py"])
+import packet_pb2
+
+# magic, version, record size, tick frequency, number of records
+HEADER = struct.Struct("<8sIIQQ")
+# tick, address, flags, size, command
+RECORD = struct.Struct("<QQQII")
+
+MAGIC = b"gem5pktb"
+VERSION = 1
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a protobuf packet trace to a binary one."
+    )
+    parser.add_argument("input", help="protobuf packet trace, may be gzipped")
+    parser.add_argument("output", help="binary packet trace to write")
+    args = parser.parse_args()
+
+    proto_in = protolib.openFileRd(args.input)
+
+    # Read the magic number in 4-byte Little Endian
+    magic_number = proto_in.read(4).decode()
+    if magic_number != "gem5":
+        print("Unrecognized file", args.input)
+        sys.exit(-1)
+
+    header = packet_pb2.PacketHeader()
+    protolib.decodeMessage(proto_in, header)
+
+    with open(args.output, "wb") as out:
+        # The number of records is filled in once they are all written
+        out.write(
+            HEADER.pack(MAGIC, VERSION, RECORD.size, header.tick_freq, 0)
+        )
+
+        num_packets = 0
+        packet = packet_pb2.Packet()
+        while protolib.decodeMessage(proto_in, packet):
+            flags = packet.flags if packet.HasField("flags") else 0
+            out.write(
+                RECORD.pack(
+                    packet.tick, packet.addr, flags, packet.size, packet.cmd
+                )
+            )
+            num_packets += 1
+
+        out.seek(0)
+        out.write(
+            HEADER.pack(
+                MAGIC, VERSION, RECORD.size, header.tick_freq, num_packets
+            )
+        )
+
+    proto_in.close()
+    print("Converted packets:", num_packets)
+
+
+if __name__ == "__main__":
+    main()